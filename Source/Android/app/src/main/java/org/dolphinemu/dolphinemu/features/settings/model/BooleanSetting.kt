@@ -704,7 +704,7 @@ enum class BooleanSetting(
         Settings.FILE_GFX,
         Settings.SECTION_GFX_SETTINGS,
         "EnableGPUTextureDecoding",
-        false
+        true
     ),
     GFX_ENABLE_PIXEL_LIGHTING(
         Settings.FILE_GFX,
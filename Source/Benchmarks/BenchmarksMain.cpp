@@ -0,0 +1,35 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Based on benchmark_main.cc
+
+#include <cstdio>
+#include <fmt/format.h>
+
+#include <benchmark/benchmark.h>
+
+#include "Common/MsgHandler.h"
+#include "Core/Core.h"
+
+namespace
+{
+bool BenchmarkMsgHandler(const char* caption, const char* text, bool yes_no, Common::MsgType style)
+{
+  fmt::print(stderr, "{}\n", text);
+  // Return yes to any question (we don't need Dolphin to break on asserts)
+  return true;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  Common::RegisterMsgAlertHandler(BenchmarkMsgHandler);
+  Core::DeclareAsHostThread();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+
+using namespace Arm64Gen;
+
+namespace
+{
+class BenchmarkCodeBlock final : public ARM64CodeBlock
+{
+public:
+  BenchmarkCodeBlock() { AllocCodeSpace(16 * 1024 * 1024); }
+
+  // Emits a sequence resembling what JitArm64 generates for a guest instruction: loads from the
+  // state block, integer and floating point arithmetic, a store, and a conditional branch that
+  // has to be patched.
+  void EmitInstruction(u32 i)
+  {
+    const s32 offset = static_cast<s32>((i % 32) * sizeof(u32));
+    LDR(IndexType::Unsigned, ARM64Reg::W0, ARM64Reg::X29, offset);
+    ADDI2R(ARM64Reg::W0, ARM64Reg::W0, i, ARM64Reg::W1);
+    ADD(ARM64Reg::W2, ARM64Reg::W0, ARM64Reg::W3);
+    LDR(ARM64Reg::W4, ARM64Reg::X28, ArithOption(ARM64Reg::X2));
+    REV32(ARM64Reg::W4, ARM64Reg::W4);
+    FADD(ARM64Reg::D0, ARM64Reg::D0, ARM64Reg::D1);
+    STR(IndexType::Unsigned, ARM64Reg::W0, ARM64Reg::X29, offset);
+    FixupBranch skip = CBZ(ARM64Reg::W0);
+    MOVI2R(ARM64Reg::X0, 0x1234567890ull + i);
+    SetJumpTarget(skip);
+  }
+};
+
+void BlockSizeArguments(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(64, 32768);
+}
+}  // namespace
+
+static void BM_Arm64EmitBlock(benchmark::State& state)
+{
+  BenchmarkCodeBlock code;
+  const u8* const start = code.GetCodePtr();
+  const u32 instruction_count = static_cast<u32>(state.range(0));
+  for (auto _ : state)
+  {
+    const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+    code.ResetCodePtr();
+    for (u32 i = 0; i < instruction_count; ++i)
+      code.EmitInstruction(i);
+    benchmark::DoNotOptimize(code.GetCodePtr());
+  }
+  state.SetItemsProcessed(state.iterations() * instruction_count);
+  state.counters["bytes_per_instruction"] =
+      static_cast<double>(code.GetCodePtr() - start) / instruction_count;
+}
+BENCHMARK(BM_Arm64EmitBlock)->Apply(BlockSizeArguments);
@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+#include "Common/Crypto/SHA1.h"
+
+namespace
+{
+std::vector<u8> RandomBytes(size_t size)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(rng());
+  return bytes;
+}
+
+constexpr std::array<u8, Common::AES::Context::KEY_SIZE> KEY{};
+constexpr std::array<u8, Common::AES::Context::BLOCK_SIZE> IV{};
+
+// The sizes that show up when reading Wii discs: the hashed 0x400-byte blocks of a cluster,
+// the 0x7c00 bytes of data in it, and a full 2 MiB group of 64 clusters.
+void BytesArguments(benchmark::internal::Benchmark* b)
+{
+  b->Arg(0x400)->Arg(0x7c00)->Arg(0x200000);
+}
+}  // namespace
+
+static void BM_AESDecrypt(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  std::vector<u8> out(data.size());
+  const auto context = Common::AES::CreateContextDecrypt(KEY.data());
+  for (auto _ : state)
+  {
+    context->Crypt(IV.data(), data.data(), out.data(), data.size());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_AESDecrypt)->Apply(BytesArguments);
+
+static void BM_AESEncrypt(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  std::vector<u8> out(data.size());
+  const auto context = Common::AES::CreateContextEncrypt(KEY.data());
+  for (auto _ : state)
+  {
+    context->Crypt(IV.data(), data.data(), out.data(), data.size());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_AESEncrypt)->Apply(BytesArguments);
+
+static void BM_SHA1(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Common::SHA1::CalculateDigest(data.data(), data.size()));
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetLabel(Common::SHA1::CreateContext()->HwAccelerated() ? "hw" : "sw");
+}
+BENCHMARK(BM_SHA1)->Apply(BytesArguments);
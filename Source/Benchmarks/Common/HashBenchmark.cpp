@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+std::vector<u8> RandomBytes(size_t size)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(rng());
+  return bytes;
+}
+
+void BytesArguments(benchmark::internal::Benchmark* b)
+{
+  // From a small texture to a large texture or EFB copy.
+  b->RangeMultiplier(8)->Range(512, 4 << 20);
+}
+}  // namespace
+
+static void BM_GetHash64(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Common::GetHash64(data.data(), static_cast<u32>(data.size()), 0));
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_GetHash64)->Apply(BytesArguments);
+
+// Hashes 128 samples, the default of the texture cache accuracy setting.
+static void BM_GetHash64Sampled(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Common::GetHash64(data.data(), static_cast<u32>(data.size()), 128));
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_GetHash64Sampled)->Apply(BytesArguments);
+
+static void BM_XXH64(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(XXH64(data.data(), data.size(), 0));
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_XXH64)->Apply(BytesArguments);
+
+static void BM_XXH3_64bits(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(XXH3_64bits(data.data(), data.size()));
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_XXH3_64bits)->Apply(BytesArguments);
+
+static void BM_CRC32(benchmark::State& state)
+{
+  const std::vector<u8> data = RandomBytes(state.range(0));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Common::ComputeCRC32(data.data(), data.size()));
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_CRC32)->Apply(BytesArguments);
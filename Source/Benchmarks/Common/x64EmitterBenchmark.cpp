@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <benchmark/benchmark.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/x64Emitter.h"
+
+using namespace Gen;
+
+namespace
+{
+class BenchmarkCodeBlock final : public X64CodeBlock
+{
+public:
+  BenchmarkCodeBlock() { AllocCodeSpace(16 * 1024 * 1024); }
+
+  // Emits a sequence resembling what Jit64 generates for a guest instruction: loads from the
+  // state block, integer and floating point arithmetic, a store, and a conditional branch that
+  // has to be patched.
+  void EmitInstruction(u32 i)
+  {
+    const s32 offset = static_cast<s32>((i % 32) * sizeof(u32));
+    MOV(32, R(EAX), MDisp(RBP, offset));
+    ADD(32, R(EAX), Imm32(i));
+    LEA(32, ECX, MComplex(RAX, RDX, SCALE_4, 8));
+    MOV(32, R(EDX), MComplex(RBX, RCX, SCALE_1, 0));
+    BSWAP(32, EDX);
+    MOVSD(XMM0, MDisp(RBP, 0x100 + offset * 2));
+    ADDSD(XMM0, R(XMM1));
+    MOVSD(MDisp(RBP, 0x100 + offset * 2), XMM0);
+    MOV(32, MDisp(RBP, offset), R(EAX));
+    CMP(32, R(EAX), Imm8(0));
+    FixupBranch skip = J_CC(CC_NZ);
+    MOV(64, R(RAX), Imm64(0x1234567890ull + i));
+    SetJumpTarget(skip);
+  }
+};
+
+void BlockSizeArguments(benchmark::internal::Benchmark* b)
+{
+  b->RangeMultiplier(8)->Range(64, 32768);
+}
+}  // namespace
+
+static void BM_x64EmitBlock(benchmark::State& state)
+{
+  BenchmarkCodeBlock code;
+  const u8* const start = code.GetCodePtr();
+  const u32 instruction_count = static_cast<u32>(state.range(0));
+  for (auto _ : state)
+  {
+    code.ResetCodePtr();
+    for (u32 i = 0; i < instruction_count; ++i)
+      code.EmitInstruction(i);
+    benchmark::DoNotOptimize(code.GetCodePtr());
+  }
+  state.SetItemsProcessed(state.iterations() * instruction_count);
+  state.counters["bytes_per_instruction"] =
+      static_cast<double>(code.GetCodePtr() - start) / instruction_count;
+}
+BENCHMARK(BM_x64EmitBlock)->Apply(BlockSizeArguments);
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <lz4.h>
+#include <zstd.h>
+
+#include "Common/CommonTypes.h"
+
+namespace
+{
+// These match the chunk size and zstd level used by Core/State.cpp.
+constexpr size_t STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+constexpr int STATE_ZSTD_COMPRESSION_LEVEL = 1;
+
+// Roughly what a chunk of emulated RAM looks like: runs of zeroes, a repeating pattern and
+// incompressible data. The argument is the percentage of incompressible data.
+std::vector<u8> CreateStateChunk(int random_percentage)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> chunk(STATE_CHUNK_SIZE);
+  constexpr size_t block_size = 0x1000;
+  for (size_t offset = 0; offset < chunk.size(); offset += block_size)
+  {
+    const u32 kind = rng() % 100;
+    for (size_t i = offset; i < offset + block_size; ++i)
+    {
+      if (kind < static_cast<u32>(random_percentage))
+        chunk[i] = static_cast<u8>(rng());
+      else if (kind % 2 == 0)
+        chunk[i] = static_cast<u8>(i % 16);
+    }
+  }
+  return chunk;
+}
+
+void CompressibilityArguments(benchmark::internal::Benchmark* b)
+{
+  b->Arg(10)->Arg(50)->Arg(90);
+}
+}  // namespace
+
+static void BM_StateCompressLZ4(benchmark::State& state)
+{
+  const std::vector<u8> chunk = CreateStateChunk(static_cast<int>(state.range(0)));
+  std::vector<char> out(LZ4_compressBound(static_cast<int>(chunk.size())));
+  int compressed_size = 0;
+  for (auto _ : state)
+  {
+    compressed_size =
+        LZ4_compress_default(reinterpret_cast<const char*>(chunk.data()), out.data(),
+                             static_cast<int>(chunk.size()), static_cast<int>(out.size()));
+    benchmark::DoNotOptimize(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * chunk.size());
+  state.counters["ratio"] = static_cast<double>(compressed_size) / chunk.size();
+}
+BENCHMARK(BM_StateCompressLZ4)->Apply(CompressibilityArguments);
+
+static void BM_StateDecompressLZ4(benchmark::State& state)
+{
+  const std::vector<u8> chunk = CreateStateChunk(static_cast<int>(state.range(0)));
+  std::vector<char> compressed(LZ4_compressBound(static_cast<int>(chunk.size())));
+  compressed.resize(LZ4_compress_default(reinterpret_cast<const char*>(chunk.data()),
+                                         compressed.data(), static_cast<int>(chunk.size()),
+                                         static_cast<int>(compressed.size())));
+  std::vector<char> out(chunk.size());
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(LZ4_decompress_safe(compressed.data(), out.data(),
+                                                 static_cast<int>(compressed.size()),
+                                                 static_cast<int>(out.size())));
+  }
+  state.SetBytesProcessed(state.iterations() * chunk.size());
+}
+BENCHMARK(BM_StateDecompressLZ4)->Apply(CompressibilityArguments);
+
+static void BM_StateCompressZstd(benchmark::State& state)
+{
+  const std::vector<u8> chunk = CreateStateChunk(static_cast<int>(state.range(0)));
+  std::vector<u8> out(ZSTD_compressBound(chunk.size()));
+  size_t compressed_size = 0;
+  for (auto _ : state)
+  {
+    compressed_size = ZSTD_compress(out.data(), out.size(), chunk.data(), chunk.size(),
+                                    STATE_ZSTD_COMPRESSION_LEVEL);
+    benchmark::DoNotOptimize(compressed_size);
+  }
+  state.SetBytesProcessed(state.iterations() * chunk.size());
+  state.counters["ratio"] = static_cast<double>(compressed_size) / chunk.size();
+}
+BENCHMARK(BM_StateCompressZstd)->Apply(CompressibilityArguments);
+
+static void BM_StateDecompressZstd(benchmark::State& state)
+{
+  const std::vector<u8> chunk = CreateStateChunk(static_cast<int>(state.range(0)));
+  std::vector<u8> compressed(ZSTD_compressBound(chunk.size()));
+  compressed.resize(ZSTD_compress(compressed.data(), compressed.size(), chunk.data(),
+                                  chunk.size(), STATE_ZSTD_COMPRESSION_LEVEL));
+  std::vector<u8> out(chunk.size());
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+        ZSTD_decompress(out.data(), out.size(), compressed.data(), compressed.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * chunk.size());
+}
+BENCHMARK(BM_StateDecompressZstd)->Apply(CompressibilityArguments);
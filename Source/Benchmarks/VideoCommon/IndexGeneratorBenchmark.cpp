@@ -0,0 +1,57 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace
+{
+// A typical draw call's worth of vertices.
+constexpr u32 VERTICES_PER_CALL = 300;
+constexpr u32 CALLS_PER_BUFFER = 64;
+
+void PrimitiveArguments(benchmark::internal::Benchmark* b)
+{
+  using OpcodeDecoder::Primitive;
+  for (const Primitive primitive :
+       {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_TRIANGLES, Primitive::GX_DRAW_TRIANGLE_STRIP,
+        Primitive::GX_DRAW_TRIANGLE_FAN, Primitive::GX_DRAW_LINES, Primitive::GX_DRAW_POINTS})
+  {
+    for (const int primitive_restart : {0, 1})
+      b->Args({static_cast<int>(primitive), primitive_restart});
+  }
+  b->ArgNames({"primitive", "restart"});
+}
+}  // namespace
+
+static void BM_IndexGenerator(benchmark::State& state)
+{
+  const auto primitive = static_cast<OpcodeDecoder::Primitive>(state.range(0));
+  g_Config.backend_info.bSupportsPrimitiveRestart = state.range(1) != 0;
+
+  IndexGenerator generator;
+  generator.Init();
+  // Quads, the worst case, turn into 6 indices for every 4 vertices, plus restart indices.
+  std::vector<u16> indices(VERTICES_PER_CALL * CALLS_PER_BUFFER * 2);
+
+  for (auto _ : state)
+  {
+    generator.Start(indices.data());
+    for (u32 i = 0; i < CALLS_PER_BUFFER; ++i)
+      generator.AddIndices(primitive, VERTICES_PER_CALL);
+    benchmark::DoNotOptimize(generator.GetIndexLen());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * VERTICES_PER_CALL * CALLS_PER_BUFFER);
+  state.SetLabel(fmt::to_string(primitive));
+
+  g_Config.backend_info.bSupportsPrimitiveRestart = false;
+}
+BENCHMARK(BM_IndexGenerator)->Apply(PrimitiveArguments);
@@ -0,0 +1,58 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+std::vector<u8> RandomBytes(size_t size)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> bytes(size);
+  for (u8& byte : bytes)
+    byte = static_cast<u8>(rng());
+  return bytes;
+}
+
+void FormatArguments(benchmark::internal::Benchmark* b)
+{
+  for (const TextureFormat format :
+       {TextureFormat::I4, TextureFormat::I8, TextureFormat::IA4, TextureFormat::IA8,
+        TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+        TextureFormat::C8, TextureFormat::C14X2, TextureFormat::CMPR})
+  {
+    for (const int size : {64, 512})
+      b->Args({static_cast<int>(format), size});
+  }
+  b->ArgNames({"format", "size"});
+}
+}  // namespace
+
+static void BM_TexDecoder_Decode(benchmark::State& state)
+{
+  const TextureFormat format = static_cast<TextureFormat>(state.range(0));
+  const int size = static_cast<int>(state.range(1));
+
+  const std::vector<u8> src = RandomBytes(TexDecoder_GetTextureSizeInBytes(size, size, format));
+  // Large enough for the 14-bit indices of C14X2.
+  const std::vector<u8> tlut = RandomBytes(0x4000 * sizeof(u16));
+  std::vector<u32> dst(size * size);
+
+  for (auto _ : state)
+  {
+    TexDecoder_Decode(reinterpret_cast<u8*>(dst.data()), src.data(), size, size, format,
+                      tlut.data(), TLUTFormat::RGB5A3);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * size * size);
+  state.SetBytesProcessed(state.iterations() * src.size());
+  state.SetLabel(fmt::to_string(format));
+}
+BENCHMARK(BM_TexDecoder_Decode)->Apply(FormatArguments);
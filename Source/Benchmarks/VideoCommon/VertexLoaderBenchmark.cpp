@@ -0,0 +1,138 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoader.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+#if defined(_M_X86_64)
+#include "VideoCommon/VertexLoaderX64.h"
+#elif defined(_M_ARM_64)
+#include "VideoCommon/VertexLoaderARM64.h"
+#endif
+
+namespace
+{
+constexpr int VERTEX_COUNT = 10000;
+
+enum class LoaderKind
+{
+  Cpp,
+  Jit,
+};
+
+enum class VertexFormat
+{
+  // Position, color and one texture coordinate, read straight from the FIFO.
+  Direct,
+  // Most attributes as floats, read through 16-bit indices into the vertex arrays.
+  IndexedFloat,
+};
+
+void SetUpFormat(VertexFormat format, TVtxDesc* vtx_desc, VAT* vtx_attr)
+{
+  vtx_desc->low.Hex = 0;
+  vtx_desc->high.Hex = 0;
+  vtx_attr->g0.Hex = 0;
+  vtx_attr->g1.Hex = 0;
+  vtx_attr->g2.Hex = 0;
+
+  if (format == VertexFormat::Direct)
+  {
+    vtx_desc->low.Position = VertexComponentFormat::Direct;
+    vtx_desc->low.Color0 = VertexComponentFormat::Direct;
+    vtx_desc->high.Tex0Coord = VertexComponentFormat::Direct;
+    vtx_attr->g0.PosElements = CoordComponentCount::XYZ;
+    vtx_attr->g0.PosFormat = ComponentFormat::Short;
+    vtx_attr->g0.PosFrac = 8;
+    vtx_attr->g0.Color0Elements = ColorComponentCount::RGBA;
+    vtx_attr->g0.Color0Comp = ColorFormat::RGBA8888;
+    vtx_attr->g0.Tex0CoordElements = TexComponentCount::ST;
+    vtx_attr->g0.Tex0CoordFormat = ComponentFormat::Short;
+    vtx_attr->g0.Tex0Frac = 10;
+    return;
+  }
+
+  vtx_desc->low.PosMatIdx = 1;
+  vtx_desc->low.Position = VertexComponentFormat::Index16;
+  vtx_desc->low.Normal = VertexComponentFormat::Index16;
+  vtx_desc->low.Color0 = VertexComponentFormat::Index16;
+  vtx_desc->high.Tex0Coord = VertexComponentFormat::Index16;
+  vtx_desc->high.Tex1Coord = VertexComponentFormat::Index16;
+  vtx_attr->g0.PosElements = CoordComponentCount::XYZ;
+  vtx_attr->g0.PosFormat = ComponentFormat::Float;
+  vtx_attr->g0.NormalElements = NormalComponentCount::NTB;
+  vtx_attr->g0.NormalFormat = ComponentFormat::Float;
+  vtx_attr->g0.Color0Elements = ColorComponentCount::RGBA;
+  vtx_attr->g0.Color0Comp = ColorFormat::RGBA8888;
+  vtx_attr->g0.Tex0CoordElements = TexComponentCount::ST;
+  vtx_attr->g0.Tex0CoordFormat = ComponentFormat::Float;
+  vtx_attr->g1.Tex1CoordElements = TexComponentCount::ST;
+  vtx_attr->g1.Tex1CoordFormat = ComponentFormat::Float;
+}
+
+std::unique_ptr<VertexLoaderBase> CreateLoader(LoaderKind kind, const TVtxDesc& vtx_desc,
+                                               const VAT& vtx_attr)
+{
+  if (kind == LoaderKind::Cpp)
+    return std::make_unique<VertexLoader>(vtx_desc, vtx_attr);
+
+#if defined(_M_X86_64)
+  return std::make_unique<VertexLoaderX64>(vtx_desc, vtx_attr);
+#elif defined(_M_ARM_64)
+  return std::make_unique<VertexLoaderARM64>(vtx_desc, vtx_attr);
+#else
+  return nullptr;
+#endif
+}
+
+void LoaderArguments(benchmark::internal::Benchmark* b)
+{
+  for (const VertexFormat format : {VertexFormat::Direct, VertexFormat::IndexedFloat})
+  {
+    for (const LoaderKind kind : {LoaderKind::Cpp, LoaderKind::Jit})
+      b->Args({static_cast<int>(format), static_cast<int>(kind)});
+  }
+  b->ArgNames({"format", "jit"});
+}
+}  // namespace
+
+static void BM_VertexLoader(benchmark::State& state)
+{
+  TVtxDesc vtx_desc;
+  VAT vtx_attr;
+  SetUpFormat(static_cast<VertexFormat>(state.range(0)), &vtx_desc, &vtx_attr);
+  const std::unique_ptr<VertexLoaderBase> loader =
+      CreateLoader(static_cast<LoaderKind>(state.range(1)), vtx_desc, vtx_attr);
+  if (!loader)
+  {
+    state.SkipWithError("No vertex loader JIT for this host");
+    return;
+  }
+
+  // All indices are zero, so every vertex reads the start of the arrays.
+  std::vector<u8> src(VERTEX_COUNT * loader->m_vertex_size);
+  std::vector<u8> dst(VERTEX_COUNT * loader->m_native_vtx_decl.stride);
+  std::vector<u8> arrays(0x1000);
+  for (int i = 0; i < NUM_VERTEX_COMPONENT_ARRAYS; i++)
+  {
+    VertexLoaderManager::cached_arraybases[static_cast<CPArray>(i)] = arrays.data();
+    g_main_cp_state.array_strides[static_cast<CPArray>(i)] = 64;
+  }
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(loader->RunVertices(src.data(), dst.data(), VERTEX_COUNT));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * VERTEX_COUNT);
+  state.SetBytesProcessed(state.iterations() * src.size());
+}
+BENCHMARK(BM_VertexLoader)->Apply(LoaderArguments);
@@ -46,6 +46,7 @@ bool AlsaSound::Init()
 void AlsaSound::SoundLoop()
 {
   Common::SetCurrentThreadName("Audio thread - alsa");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Realtime);
   while (m_thread_status.load() != ALSAThreadStatus::STOPPING)
   {
     while (m_thread_status.load() == ALSAThreadStatus::RUNNING)
@@ -23,6 +23,7 @@ public:
   ~AlsaSound() override;
 
   bool Init() override;
+  bool CanInitOnAnyThread() const override { return true; }
   bool SetRunning(bool running) override;
 
   static bool IsValid() { return true; }
@@ -45,7 +45,7 @@ static std::unique_ptr<SoundStream> CreateSoundStreamForBackend(std::string_view
   return {};
 }
 
-void InitSoundStream(Core::System& system)
+PendingSoundStream BeginInitSoundStream()
 {
   std::string backend = Config::Get(Config::MAIN_AUDIO_BACKEND);
   std::unique_ptr<SoundStream> sound_stream = CreateSoundStreamForBackend(backend);
@@ -57,7 +57,28 @@ void InitSoundStream(Core::System& system)
     sound_stream = CreateSoundStreamForBackend(backend);
   }
 
-  if (!sound_stream || !sound_stream->Init())
+  std::future<bool> init_result;
+  if (sound_stream && sound_stream->CanInitOnAnyThread())
+  {
+    init_result = std::async(std::launch::async,
+                             [stream = sound_stream.get()] { return stream->Init(); });
+  }
+
+  return {std::move(sound_stream), std::move(backend), std::move(init_result)};
+}
+
+void InitSoundStream(Core::System& system, PendingSoundStream pending)
+{
+  std::unique_ptr<SoundStream> sound_stream = std::move(pending.sound_stream);
+  const std::string& backend = pending.backend;
+
+  bool initialized = false;
+  if (pending.init_result.valid())
+    initialized = pending.init_result.get();
+  else if (sound_stream)
+    initialized = sound_stream->Init();
+
+  if (!initialized)
   {
     WARN_LOG_FMT(AUDIO, "Could not initialize backend {}, using {} instead.", backend,
                  BACKEND_NULLSOUND);
@@ -68,6 +89,11 @@ void InitSoundStream(Core::System& system)
   system.SetSoundStream(std::move(sound_stream));
 }
 
+void InitSoundStream(Core::System& system)
+{
+  InitSoundStream(system, BeginInitSoundStream());
+}
+
 void PostInitSoundStream(Core::System& system)
 {
   // This needs to be called after AudioInterface::Init and SerialInterface::Init (for GBA devices)
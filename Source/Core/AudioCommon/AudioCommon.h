@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -20,6 +21,17 @@ class System;
 
 namespace AudioCommon
 {
+// A sound stream whose audio device is still being opened. Opening a device can take a noticeable
+// part of the boot, so it's started before the rest of the core is initialized.
+struct PendingSoundStream
+{
+  std::unique_ptr<SoundStream> sound_stream;
+  std::string backend;
+  std::future<bool> init_result;
+};
+
+PendingSoundStream BeginInitSoundStream();
+void InitSoundStream(Core::System& system, PendingSoundStream pending);
 void InitSoundStream(Core::System& system);
 void PostInitSoundStream(Core::System& system);
 void ShutdownSoundStream(Core::System& system);
@@ -16,12 +16,14 @@ public:
   void ProcessSamples(const short* in, unsigned int num_in, unsigned int num_out);
   void GetStretchedSamples(short* out, unsigned int num_out);
   void Clear();
+  void SetMaxLatency(int max_latency_ms) { m_max_latency_ms = max_latency_ms; }
 
 private:
   unsigned int m_sample_rate;
   std::array<short, 2> m_last_stretched_sample = {};
   soundtouch::SoundTouch m_sound_touch;
   double m_stretch_ratio = 1.0;
+  int m_max_latency_ms = 80;
 };
 
 }  // namespace AudioCommon
@@ -23,6 +23,7 @@ public:
   CubebStream& operator=(CubebStream&& other) = delete;
   ~CubebStream() override;
   bool Init() override;
+  bool CanInitOnAnyThread() const override { return true; }
   bool SetRunning(bool running) override;
   void SetVolume(int) override;
 
@@ -10,8 +10,10 @@
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Instrumentation.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "VideoCommon/PerformanceMetrics.h"
@@ -44,6 +46,11 @@ Mixer::Mixer(unsigned int BackendSampleRate)
 
 Mixer::~Mixer()
 {
+  if (const u32 underruns = GetDMAUnderrunCount())
+    INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer had {} DMA underrun(s)", underruns);
+  if (const u32 misses = GetDeadlineMissCount())
+    INFO_LOG_FMT(AUDIO_INTERFACE, "Mixer missed {} processing deadline(s)", misses);
+
   Config::RemoveConfigChangedCallback(m_config_changed_callback_id);
 }
 
@@ -89,64 +96,92 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
     low_watermark = std::min(low_watermark, MAX_SAMPLES / 2);
 
     m_numLeftI = (numLeft + m_numLeftI * (CONTROL_AVG - 1)) / CONTROL_AVG;
-    float offset = (m_numLeftI - low_watermark) * CONTROL_FACTOR;
-    if (offset > MAX_FREQ_SHIFT)
-      offset = MAX_FREQ_SHIFT;
-    if (offset < -MAX_FREQ_SHIFT)
-      offset = -MAX_FREQ_SHIFT;
+    const float error = m_numLeftI - low_watermark;
+
+    // The integral term removes the steady-state offset a purely proportional controller leaves
+    // between the buffer level and the watermark, which lets the watermark itself stay small.
+    // Clamping it to the shift range keeps it from winding up while the FIFO is starved.
+    m_control_integral = std::clamp(m_control_integral + error * CONTROL_INTEGRAL_FACTOR,
+                                    float(-MAX_FREQ_SHIFT), float(MAX_FREQ_SHIFT));
+
+    const float offset = std::clamp(error * CONTROL_FACTOR + m_control_integral,
+                                    float(-MAX_FREQ_SHIFT), float(MAX_FREQ_SHIFT));
 
     aid_sample_rate = (aid_sample_rate + offset) * emulationspeed;
   }
+  else
+  {
+    m_control_integral = 0.0f;
+  }
 
   const u32 ratio = (u32)(65536.0f * aid_sample_rate / (float)m_mixer->m_sampleRate);
 
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  const auto read_buffer = [this](auto index) {
-    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
+  // The interpolation loop is instantiated once per byte order so that the endianness check
+  // doesn't have to be evaluated for every sample read.
+  const auto mix_samples = [&](auto read_buffer) {
+    // TODO: consider a higher-quality resampling algorithm.
+    for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2;
+         currentSample += 2)
+    {
+      u32 indexR2 = indexR + 2;  // next sample
+
+      s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
+      s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
+      int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
+      sampleL = (sampleL * lvolume) >> 8;
+      sampleL += samples[currentSample + 1];
+      samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
+
+      s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
+      s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
+      int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
+      sampleR = (sampleR * rvolume) >> 8;
+      sampleR += samples[currentSample];
+      samples[currentSample] = std::clamp(sampleR, -32767, 32767);
+
+      m_frac += ratio;
+      indexR += 2 * (u16)(m_frac >> 16);
+      m_frac &= 0xffff;
+    }
+
+    return std::array<short, 2>{read_buffer((indexR - 1) & INDEX_MASK),
+                                read_buffer((indexR - 2) & INDEX_MASK)};
   };
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
-  {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
-  }
+  std::array<short, 2> s;
+  if (m_little_endian)
+    s = mix_samples([this](u32 index) { return m_buffer[index]; });
+  else
+    s = mix_samples([this](u32 index) { return Common::swap16(m_buffer[index]); });
 
   // Actual number of samples written to the buffer without padding.
   unsigned int actual_sample_count = currentSample / 2;
 
+  // Count each transition into starvation once rather than every padded block.
+  const bool starved = actual_sample_count < numSamples;
+  if (starved && !m_starved)
+    m_underrun_count.fetch_add(1, std::memory_order_relaxed);
+  m_starved = starved;
+
   // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
   s[0] = (s[0] * rvolume) >> 8;
   s[1] = (s[1] * lvolume) >> 8;
-  for (; currentSample < numSamples * 2; currentSample += 2)
+
+  // Inactive FIFOs (most of the time the Wii Remote speaker, Skylander portal and GBA ones) pad
+  // with silence, and adding zero to the output buffer can be skipped entirely.
+  if (s[0] != 0 || s[1] != 0)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
+    for (; currentSample < numSamples * 2; currentSample += 2)
+    {
+      int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
+      int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
 
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+      samples[currentSample + 0] = sampleR;
+      samples[currentSample + 1] = sampleL;
+    }
   }
 
   // Flush cached variable
@@ -160,6 +195,8 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   if (!samples)
     return 0;
 
+  INSTRUMENT_ZONE("Mixer::Mix");
+
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
   // TODO: Determine how emulation speed will be used in audio
@@ -197,8 +234,10 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
       m_stretcher.Clear();
       m_is_stretching = true;
     }
+    const u64 start_us = Common::Timer::NowUs();
     m_stretcher.ProcessSamples(m_scratch_buffer.data(), available_samples, num_samples);
     m_stretcher.GetStretchedSamples(samples, num_samples);
+    CheckProcessingDeadline(start_us, num_samples);
   }
   else
   {
@@ -237,8 +276,10 @@ unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
     return 0;
   }
 
+  const u64 start_us = Common::Timer::NowUs();
   m_surround_decoder.PutFrames(m_scratch_buffer.data(), needed_frames);
   m_surround_decoder.ReceiveFrames(samples, num_samples);
+  CheckProcessingDeadline(start_us, num_samples);
 
   return num_samples;
 }
@@ -458,6 +499,21 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_stretcher.SetMaxLatency(Config::Get(Config::MAIN_AUDIO_STRETCH_LATENCY));
+}
+
+// Called from the sound stream thread after an expensive processing step. If producing
+// num_samples took longer than playing them back, the backend is bound to underrun.
+void Mixer::CheckProcessingDeadline(u64 start_us, unsigned int num_samples)
+{
+  const u64 elapsed_us = Common::Timer::NowUs() - start_us;
+  const u64 deadline_us = u64(num_samples) * 1000000 / m_sampleRate;
+  if (elapsed_us <= deadline_us)
+    return;
+
+  m_deadline_miss_count.fetch_add(1, std::memory_order_relaxed);
+  DEBUG_LOG_FMT(AUDIO, "Audio processing took {} us for {} us of output", elapsed_us,
+                deadline_us);
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -35,6 +35,12 @@ public:
   void PushGBASamples(int device_number, const short* samples, unsigned int num_samples);
 
   unsigned int GetSampleRate() const { return m_sampleRate; }
+  // Number of samples at the output sample rate that are buffered from the DSP.
+  unsigned int GetDMABufferedSamples() const { return m_dma_mixer.AvailableSamples(); }
+  // Number of times the backend drained the DSP FIFO and had to be fed padding.
+  u32 GetDMAUnderrunCount() const { return m_dma_mixer.GetUnderrunCount(); }
+  // Number of times stretching or surround decoding took longer than the audio it produced.
+  u32 GetDeadlineMissCount() const { return m_deadline_miss_count.load(std::memory_order_relaxed); }
 
   void SetDMAInputSampleRateDivisor(unsigned int rate_divisor);
   void SetStreamInputSampleRateDivisor(unsigned int rate_divisor);
@@ -58,6 +64,8 @@ private:
   static constexpr u32 INDEX_MASK = MAX_SAMPLES * 2 - 1;
   static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
   static constexpr float CONTROL_FACTOR = 0.2f;
+  // Integral gain of the buffer level controller, applied per mixed block.
+  static constexpr float CONTROL_INTEGRAL_FACTOR = 0.002f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
 
   const unsigned int SURROUND_CHANNELS = 6;
@@ -79,6 +87,7 @@ private:
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     std::pair<s32, s32> GetVolume() const;
     unsigned int AvailableSamples() const;
+    u32 GetUnderrunCount() const { return m_underrun_count.load(std::memory_order_relaxed); }
 
   private:
     Mixer* m_mixer;
@@ -91,10 +100,14 @@ private:
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
     float m_numLeftI = 0.0f;
+    float m_control_integral = 0.0f;
     u32 m_frac = 0;
+    bool m_starved = false;
+    std::atomic<u32> m_underrun_count{0};
   };
 
   void RefreshConfig();
+  void CheckProcessingDeadline(u64 start_us, unsigned int num_samples);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -110,6 +123,7 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  std::atomic<u32> m_deadline_miss_count{0};
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
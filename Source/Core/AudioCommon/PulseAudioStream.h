@@ -20,6 +20,7 @@ public:
   ~PulseAudio() override;
 
   bool Init() override;
+  bool CanInitOnAnyThread() const override { return true; }
   bool SetRunning(bool running) override { return true; }
   static bool IsValid() { return true; }
   void StateCallback(pa_context* c);
@@ -19,6 +19,8 @@ public:
   static bool IsValid() { return false; }
   Mixer* GetMixer() const { return m_mixer.get(); }
   virtual bool Init() { return false; }
+  // Whether Init may run on a different thread than the one that constructed the stream.
+  virtual bool CanInitOnAnyThread() const { return false; }
   virtual void SetVolume(int) {}
   // Returns true if successful.
   virtual bool SetRunning(bool running) { return false; }
@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <list>
 #include <map>
 #include <optional>
@@ -50,6 +51,7 @@ private:
   u8** m_ptr_current;
   u8* m_ptr_end;
   Mode m_mode;
+  std::function<void(const std::string& name)> m_marker_callback;
 
 public:
   PointerWrap(u8** ptr, size_t size, Mode mode)
@@ -64,6 +66,12 @@ public:
   bool IsMeasureMode() const { return m_mode == Mode::Measure; }
   bool IsVerifyMode() const { return m_mode == Mode::Verify; }
 
+  // Called for every marker after it has been processed. Used to profile the parts of a state.
+  void SetMarkerCallback(std::function<void(const std::string& name)> callback)
+  {
+    m_marker_callback = std::move(callback);
+  }
+
   template <typename K, class V>
   void Do(std::map<K, V>& x)
   {
@@ -73,14 +81,32 @@ public:
     switch (m_mode)
     {
     case Mode::Read:
-      for (x.clear(); count != 0; --count)
+    {
+      // Reuse the nodes of the current entries instead of allocating new ones. The entries were
+      // written in order, so each one is inserted at the end.
+      std::map<K, V> old_entries = std::move(x);
+      x.clear();
+      for (; count != 0; --count)
       {
-        std::pair<K, V> pair;
-        Do(pair.first);
-        Do(pair.second);
-        x.insert(pair);
+        if (old_entries.empty())
+        {
+          std::pair<K, V> pair;
+          Do(pair.first);
+          Do(pair.second);
+          x.insert(x.end(), std::move(pair));
+        }
+        else
+        {
+          auto node = old_entries.extract(old_entries.begin());
+          node.key() = K{};
+          node.mapped() = V{};
+          Do(node.key());
+          Do(node.mapped());
+          x.insert(x.end(), std::move(node));
+        }
       }
       break;
+    }
 
     case Mode::Write:
     case Mode::Measure:
@@ -103,13 +129,28 @@ public:
     switch (m_mode)
     {
     case Mode::Read:
-      for (x.clear(); count != 0; --count)
+    {
+      // Same as for maps above.
+      std::set<V> old_values = std::move(x);
+      x.clear();
+      for (; count != 0; --count)
       {
-        V value = {};
-        Do(value);
-        x.insert(value);
+        if (old_values.empty())
+        {
+          V value = {};
+          Do(value);
+          x.insert(x.end(), std::move(value));
+        }
+        else
+        {
+          auto node = old_values.extract(old_values.begin());
+          node.value() = V{};
+          Do(node.value());
+          x.insert(x.end(), std::move(node));
+        }
       }
       break;
+    }
 
     case Mode::Write:
     case Mode::Measure:
@@ -312,6 +353,9 @@ public:
           prevName, cookie, cookie, arbitraryNumber, arbitraryNumber);
       SetMeasureMode();
     }
+
+    if (m_marker_callback)
+      m_marker_callback(prevName);
   }
 
   template <typename T, typename Functor>
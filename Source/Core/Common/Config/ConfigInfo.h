@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -19,6 +20,16 @@ namespace detail
 // std::underlying_type may only be used with enum types, so make sure T is an enum type first.
 template <typename T>
 using UnderlyingType = typename std::enable_if_t<std::is_enum<T>{}, std::underlying_type<T>>::type;
+
+// std::atomic<T> may only be instantiated for trivially copyable types, so check that first.
+template <typename T>
+constexpr bool IsLockFreeAtomic()
+{
+  if constexpr (std::is_trivially_copyable_v<T>)
+    return std::atomic<T>::is_always_lock_free;
+  else
+    return false;
+}
 }  // namespace detail
 
 struct Location
@@ -44,7 +55,8 @@ class Info
 {
 public:
   constexpr Info(const Location& location, const T& default_value)
-      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value, 0}
+      : m_location{location}, m_default_value{default_value}, m_cached_value{default_value},
+        m_cached_config_version{0}
   {
   }
 
@@ -66,7 +78,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = other.GetDefaultValue();
-    m_cached_value = other.GetCachedValue();
+    StoreCachedValue(other.GetCachedValue());
     return *this;
   }
 
@@ -75,7 +87,7 @@ public:
   {
     m_location = std::move(other.m_location);
     m_default_value = std::move(other.m_default_value);
-    m_cached_value = std::move(other.m_cached_value);
+    StoreCachedValue(other.GetCachedValue());
     return *this;
   }
 
@@ -87,7 +99,7 @@ public:
   {
     m_location = other.GetLocation();
     m_default_value = static_cast<T>(other.GetDefaultValue());
-    m_cached_value = other.template GetCachedValueCasted<T>();
+    StoreCachedValue(other.template GetCachedValueCasted<T>());
     return *this;
   }
 
@@ -96,29 +108,55 @@ public:
 
   CachedValue<T> GetCachedValue() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return m_cached_value;
+    if constexpr (LOCK_FREE_CACHE)
+    {
+      // The version is loaded first. A concurrent SetCachedValue can only make the value newer
+      // than the version says, which at worst causes a redundant lookup.
+      const u64 config_version = m_cached_config_version.load(std::memory_order_acquire);
+      return CachedValue<T>{m_cached_value.load(std::memory_order_relaxed), config_version};
+    }
+    else
+    {
+      std::shared_lock lock(m_cached_value_mutex);
+      return CachedValue<T>{m_cached_value,
+                            m_cached_config_version.load(std::memory_order_relaxed)};
+    }
   }
 
   template <typename U>
   CachedValue<U> GetCachedValueCasted() const
   {
-    std::shared_lock lock(m_cached_value_mutex);
-    return CachedValue<U>{static_cast<U>(m_cached_value.value), m_cached_value.config_version};
+    const CachedValue<T> cached_value = GetCachedValue();
+    return CachedValue<U>{static_cast<U>(cached_value.value), cached_value.config_version};
   }
 
   void SetCachedValue(const CachedValue<T>& cached_value) const
   {
     std::unique_lock lock(m_cached_value_mutex);
-    if (m_cached_value.config_version < cached_value.config_version)
-      m_cached_value = cached_value;
+    if (m_cached_config_version.load(std::memory_order_relaxed) < cached_value.config_version)
+      StoreCachedValue(cached_value);
   }
 
 private:
+  // Settings that fit in a lock-free atomic have their cached value read without taking a lock,
+  // as Config::Get is called from hot paths on the CPU and GPU threads.
+  static constexpr bool LOCK_FREE_CACHE = detail::IsLockFreeAtomic<T>();
+
+  // Writers must be serialized by m_cached_value_mutex, except in the copy/move operators.
+  void StoreCachedValue(const CachedValue<T>& cached_value) const
+  {
+    if constexpr (LOCK_FREE_CACHE)
+      m_cached_value.store(cached_value.value, std::memory_order_relaxed);
+    else
+      m_cached_value = cached_value.value;
+    m_cached_config_version.store(cached_value.config_version, std::memory_order_release);
+  }
+
   Location m_location;
   T m_default_value;
 
-  mutable CachedValue<T> m_cached_value;
+  mutable std::conditional_t<LOCK_FREE_CACHE, std::atomic<T>, T> m_cached_value;
+  mutable std::atomic<u64> m_cached_config_version;
   mutable std::shared_mutex m_cached_value_mutex;
 };
 }  // namespace Config
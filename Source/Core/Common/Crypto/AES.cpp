@@ -361,6 +361,36 @@ public:
     vst1q_u8(buf_out, block);
   }
 
+  // CBC decryption doesn't depend on the result of the previous block, so interleaving several
+  // blocks hides the latency of the AES instructions, like ContextAESNI::DecryptPipelined.
+  template <size_t NumBlocks>
+  inline void DecryptPipelined(uint8x16_t* iv, const u8* buf_in, u8* buf_out) const
+  {
+    constexpr size_t Depth = NumBlocks;
+
+    uint8x16_t block[Depth];
+    for (size_t d = 0; d < Depth; d++)
+      block[d] = vld1q_u8(buf_in + d * BLOCK_SIZE);
+
+    uint8x16_t iv_next[1 + Depth];
+    iv_next[0] = *iv;
+    for (size_t d = 0; d < Depth; d++)
+      iv_next[1 + d] = block[d];
+
+    for (size_t i = 0; i < Nr - 1; ++i)
+      for (size_t d = 0; d < Depth; d++)
+        block[d] = vaesimcq_u8(vaesdq_u8(block[d], round_keys[i]));
+    for (size_t d = 0; d < Depth; d++)
+      block[d] = veorq_u8(vaesdq_u8(block[d], round_keys[Nr - 1]), round_keys[Nr]);
+
+    for (size_t d = 0; d < Depth; d++)
+      block[d] = veorq_u8(block[d], iv_next[d]);
+    *iv = iv_next[Depth];
+
+    for (size_t d = 0; d < Depth; d++)
+      vst1q_u8(buf_out + d * BLOCK_SIZE, block[d]);
+  }
+
   virtual bool Crypt(const u8* iv, u8* iv_out, const u8* buf_in, u8* buf_out,
                      size_t len) const override
   {
@@ -369,6 +399,20 @@ public:
 
     uint8x16_t iv_block = iv ? vld1q_u8(iv) : vmovq_n_u8(0);
 
+    if constexpr (AesMode == Mode::Decrypt)
+    {
+      // 8 blocks plus the round keys and IVs still fit in the 32 vector registers.
+      constexpr size_t BLOCK_DEPTH = 8;
+      constexpr size_t CHUNK_LEN = BLOCK_DEPTH * BLOCK_SIZE;
+      while (len >= CHUNK_LEN)
+      {
+        DecryptPipelined<BLOCK_DEPTH>(&iv_block, buf_in, buf_out);
+        buf_in += CHUNK_LEN;
+        buf_out += CHUNK_LEN;
+        len -= CHUNK_LEN;
+      }
+    }
+
     len /= BLOCK_SIZE;
     while (len--)
     {
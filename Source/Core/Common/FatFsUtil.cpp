@@ -9,6 +9,7 @@
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -435,6 +436,16 @@ static bool Pack(const std::function<bool()>& cancelled, const File::FSTEntry& e
       return false;
     }
 
+    // Clear the archive attribute, so that files which are still unchanged when the image is
+    // unpacked again can be told apart from those the emulated software wrote to.
+    const auto chmod_error_code = f_chmod(entry.virtualName.c_str(), 0, AM_ARC);
+    if (chmod_error_code != FR_OK)
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to set attributes of file {} in SD image: {}",
+                    entry.physicalName, FatFsErrorToString(chmod_error_code));
+      return false;
+    }
+
     if (!src.Close())
     {
       ERROR_LOG_FMT(COMMON, "Failed to close file {}", entry.physicalName);
@@ -606,8 +617,14 @@ bool SyncSDFolderToSDImage(const std::function<bool()>& cancelled, bool determin
   return true;
 }
 
+// Files that are moved from the old SD folder instead of being unpacked, as (old, new) paths.
+using KeptFiles = std::vector<std::pair<std::string, std::string>>;
+
+// If old_path is not empty, files that are still unchanged since the image was packed are moved
+// from there instead of being copied out of the image.
 static bool Unpack(const std::function<bool()>& cancelled, const std::string path,
-                   bool is_directory, const char* name, std::vector<u8>& tmp_buffer)
+                   const std::string& old_path, bool is_directory, const char* name,
+                   std::vector<u8>& tmp_buffer, KeptFiles* kept_files)
 {
   if (cancelled())
     return false;
@@ -739,8 +756,22 @@ static bool Unpack(const std::function<bool()>& cancelled, const std::string pat
       return false;
     }
 
-    if (!Unpack(cancelled, fmt::format("{}/{}", path, childname), entry.fattrib & AM_DIR,
-                entry.fname, tmp_buffer))
+    const std::string child_path = fmt::format("{}/{}", path, childname);
+    const std::string old_child_path =
+        old_path.empty() ? std::string() : fmt::format("{}/{}", old_path, childname);
+
+    // Any write to a file sets its archive attribute again.
+    const bool unchanged = !(entry.fattrib & (AM_DIR | AM_ARC));
+    if (unchanged && !old_child_path.empty() && File::IsFile(old_child_path) &&
+        File::GetSize(old_child_path) == entry.fsize &&
+        File::Rename(old_child_path, child_path))
+    {
+      kept_files->emplace_back(old_child_path, child_path);
+      continue;
+    }
+
+    if (!Unpack(cancelled, child_path, old_child_path, entry.fattrib & AM_DIR, entry.fname,
+                tmp_buffer, kept_files))
     {
       return false;
     }
@@ -821,10 +852,21 @@ bool SyncSDImageToSDFolder(const std::function<bool()>& cancelled)
     }
   }
 
+  // Only the image knows which files were written to, but an image that was not packed from this
+  // folder may have the archive attribute cleared for any file, so this is opt-in.
+  const bool keep_unchanged_files =
+      target_dir_exists && Config::Get(Config::MAIN_WII_SD_CARD_SYNC_CHANGED_FILES_ONLY);
+  const std::string old_dir_without_slash =
+      keep_unchanged_files ? backup_target_dir_without_slash : std::string();
+
   std::vector<u8> tmp_buffer(MAX_CLUSTER_SIZE);
-  if (!Unpack(cancelled, target_dir_without_slash, true, "", tmp_buffer))
+  KeptFiles kept_files;
+  if (!Unpack(cancelled, target_dir_without_slash, old_dir_without_slash, true, "", tmp_buffer,
+              &kept_files))
   {
     ERROR_LOG_FMT(COMMON, "Failed to unpack SD image {} to {}", image_path, target_dir);
+    for (const auto& [old_file_path, new_file_path] : kept_files)
+      File::Rename(new_file_path, old_file_path);
     File::DeleteDirRecursively(target_dir_without_slash);
     if (target_dir_exists)
       File::Rename(backup_target_dir_without_slash, target_dir_without_slash);
@@ -840,7 +882,8 @@ bool SyncSDImageToSDFolder(const std::function<bool()>& cancelled)
   if (!image.Close())
     ERROR_LOG_FMT(COMMON, "Failed to close SD image {}", image_path);
 
-  INFO_LOG_FMT(COMMON, "Successfully unpacked SD image {} to {}", image_path, target_dir);
+  INFO_LOG_FMT(COMMON, "Successfully unpacked SD image {} to {} ({} unchanged files kept)",
+               image_path, target_dir, kept_files.size());
   return true;
 }
 
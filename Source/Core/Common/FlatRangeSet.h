@@ -0,0 +1,89 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Common
+{
+// A set of values stored as a sorted vector of disjoint, non-adjacent half-open ranges.
+//
+// Meant for small sets made up of a few long runs, e.g. the addresses occupied by a block of code.
+// Unlike a node based set, it needs a single allocation, and inserting values in ascending order
+// (the common case) just extends the last range.
+template <typename T>
+class FlatRangeSet
+{
+public:
+  struct Range
+  {
+    T start;
+    T end;
+
+    bool operator==(const Range& other) const = default;
+  };
+
+  using const_iterator = typename std::vector<Range>::const_iterator;
+
+  // Adds [start, end) to the set. Ranges which overlap or touch it are merged into it.
+  void Insert(T start, T end)
+  {
+    if (start >= end)
+      return;
+
+    if (m_ranges.empty() || m_ranges.back().end < start)
+    {
+      m_ranges.push_back({start, end});
+      return;
+    }
+
+    // First range which ends at or after start, i.e. the first one that can be merged.
+    auto first = std::lower_bound(m_ranges.begin(), m_ranges.end(), start,
+                                  [](const Range& range, T value) { return range.end < value; });
+    // First range which starts after end, i.e. the first one that can't be merged.
+    auto last = std::upper_bound(first, m_ranges.end(), end,
+                                 [](T value, const Range& range) { return value < range.start; });
+
+    if (first == last)
+    {
+      m_ranges.insert(first, {start, end});
+      return;
+    }
+
+    first->start = std::min(first->start, start);
+    first->end = std::max(std::prev(last)->end, end);
+    m_ranges.erase(std::next(first), last);
+  }
+
+  // Returns whether any value in [start, end) is in the set.
+  bool Overlaps(T start, T end) const
+  {
+    if (start >= end)
+      return false;
+
+    auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), start,
+                               [](T value, const Range& range) { return value < range.end; });
+    return it != m_ranges.end() && it->start < end;
+  }
+
+  bool Contains(T value) const
+  {
+    auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), value,
+                               [](T v, const Range& range) { return v < range.end; });
+    return it != m_ranges.end() && it->start <= value;
+  }
+
+  void Clear() { m_ranges.clear(); }
+  bool Empty() const { return m_ranges.empty(); }
+  std::size_t NumRanges() const { return m_ranges.size(); }
+
+  const_iterator begin() const { return m_ranges.begin(); }
+  const_iterator end() const { return m_ranges.end(); }
+
+private:
+  std::vector<Range> m_ranges;
+};
+}  // namespace Common
@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -424,6 +425,13 @@ static u64 SetHash64Function(const u8* src, u32 len, u32 samples)
 
 u64 GetHash64(const u8* src, u32 len, u32 samples)
 {
+  // Hashing everything with XXH3 is much faster than with the CRC32 instructions, except for
+  // small inputs like most TLUTs, where the hardware CRC32 has less setup cost.
+  constexpr u32 SMALL_INPUT_SIZE = 512;
+  const bool hash_everything = samples == 0 || samples >= len / sizeof(u64);
+  if (hash_everything && (len > SMALL_INPUT_SIZE || !cpu_info.bCRC32))
+    return XXH3_64bits(src, len);
+
   return s_texture_hash_func(src, len, samples);
 }
 
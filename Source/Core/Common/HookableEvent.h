@@ -6,6 +6,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/StringLiteral.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -71,6 +72,8 @@ private:
   {
     std::recursive_mutex m_mutex;
     std::vector<HookImpl*> m_listeners;
+    // Mirrors m_listeners.size(), so that Trigger can skip the lock when nobody is listening.
+    std::atomic<size_t> m_listener_count = 0;
   };
 
   // We use the "Construct On First Use" idiom to avoid the static initialization order fiasco.
@@ -87,6 +90,7 @@ private:
     std::lock_guard lock(storage.m_mutex);
 
     std::erase(storage.m_listeners, handle);
+    storage.m_listener_count.store(storage.m_listeners.size(), std::memory_order_release);
   }
 
 public:
@@ -99,12 +103,16 @@ public:
     DEBUG_LOG_FMT(COMMON, "Registering {} handler at {} event hook", name, EventName.value);
     auto handle = std::make_unique<HookImpl>(std::move(callback), std::move(name));
     storage.m_listeners.push_back(handle.get());
+    storage.m_listener_count.store(storage.m_listeners.size(), std::memory_order_release);
     return handle;
   }
 
   static void Trigger(const CallbackArgs&... args)
   {
     auto& storage = GetStorage();
+    if (storage.m_listener_count.load(std::memory_order_acquire) == 0)
+      return;
+
     std::lock_guard lock(storage.m_mutex);
 
     for (const auto& handle : storage.m_listeners)
@@ -0,0 +1,32 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Zones for external frame profilers, for attributing frame-time spikes to whatever work caused
+// them. When Dolphin is built with ENABLE_TRACY, these are Tracy zones and thread names set through
+// Common::SetCurrentThreadName show up in the trace. Otherwise they compile to nothing.
+//
+// Unlike Common::Profiler, these are safe to use on any thread.
+
+#ifdef USE_TRACY
+
+#include <tracy/Tracy.hpp>
+
+// Measures the enclosing scope. The name must be a string literal.
+#define INSTRUMENT_ZONE(name) ZoneScopedN(name)
+// Marks the end of a presented frame.
+#define INSTRUMENT_FRAME_MARK() FrameMark
+
+#else
+
+#define INSTRUMENT_ZONE(name)                                                                      \
+  do                                                                                               \
+  {                                                                                                \
+  } while (false)
+#define INSTRUMENT_FRAME_MARK()                                                                    \
+  do                                                                                               \
+  {                                                                                                \
+  } while (false)
+
+#endif
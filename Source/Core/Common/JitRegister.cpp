@@ -6,8 +6,10 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -21,6 +23,12 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
 #if defined USE_OPROFILE && USE_OPROFILE
 #include <opagent.h>
 #endif
@@ -40,7 +48,123 @@ namespace Common::JitRegister
 {
 static bool s_is_enabled = false;
 
-void Init(const std::string& perf_dir)
+#ifdef __linux__
+// See tools/perf/Documentation/jitdump-specification.txt in the Linux sources.
+namespace JitDump
+{
+constexpr u32 MAGIC = 0x4A695444;
+constexpr u32 VERSION = 1;
+constexpr u32 RECORD_CODE_LOAD = 0;
+
+#if defined(_M_X86_64)
+constexpr u32 ELF_MACHINE = 62;  // EM_X86_64
+#elif defined(_M_ARM_64)
+constexpr u32 ELF_MACHINE = 183;  // EM_AARCH64
+#else
+constexpr u32 ELF_MACHINE = 0;  // EM_NONE
+#endif
+
+struct FileHeader
+{
+  u32 magic;
+  u32 version;
+  u32 total_size;
+  u32 elf_mach;
+  u32 pad1;
+  u32 pid;
+  u64 timestamp;
+  u64 flags;
+};
+
+struct CodeLoadRecord
+{
+  u32 id;
+  u32 total_size;
+  u64 timestamp;
+  u32 pid;
+  u32 tid;
+  u64 vma;
+  u64 code_addr;
+  u64 code_size;
+  u64 code_index;
+  // Followed by the null-terminated name and the code.
+};
+
+static File::IOFile s_file;
+// perf notices jitdump files by the executable mapping of them showing up in the trace.
+static void* s_marker = nullptr;
+static long s_marker_size = 0;
+static u64 s_code_index = 0;
+
+// perf has to be told to use the same clock, i.e. "perf record -k mono".
+static u64 GetTimestamp()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<u64>(ts.tv_sec) * 1000000000 + static_cast<u64>(ts.tv_nsec);
+}
+
+static void Open(const std::string& dir)
+{
+  const std::string filename = fmt::format("{}/jit-{}.dump", dir, getpid());
+  if (!s_file.Open(filename, "w+b"))
+    return;
+
+  s_marker_size = sysconf(_SC_PAGESIZE);
+  s_marker = mmap(nullptr, s_marker_size, PROT_READ | PROT_EXEC, MAP_PRIVATE,
+                  fileno(s_file.GetHandle()), 0);
+  if (s_marker == MAP_FAILED)
+  {
+    s_marker = nullptr;
+    s_file.Close();
+    return;
+  }
+
+  const FileHeader header{MAGIC,  VERSION, sizeof(FileHeader), ELF_MACHINE, 0,
+                          static_cast<u32>(getpid()), GetTimestamp(), 0};
+  s_file.WriteBytes(&header, sizeof(header));
+  s_file.Flush();
+}
+
+static void Close()
+{
+  if (s_marker)
+  {
+    munmap(s_marker, s_marker_size);
+    s_marker = nullptr;
+  }
+  s_file.Close();
+  s_code_index = 0;
+}
+
+static void WriteCodeLoad(const void* base_address, u32 code_size, const std::string& symbol_name)
+{
+  if (!s_file.IsOpen())
+    return;
+
+  const u64 address = reinterpret_cast<u64>(base_address);
+  const CodeLoadRecord record{
+      RECORD_CODE_LOAD,
+      static_cast<u32>(sizeof(CodeLoadRecord) + symbol_name.size() + 1 + code_size),
+      GetTimestamp(),
+      static_cast<u32>(getpid()),
+      static_cast<u32>(syscall(SYS_gettid)),
+      address,
+      address,
+      code_size,
+      s_code_index++};
+
+  std::vector<u8> buffer(record.total_size);
+  std::memcpy(buffer.data(), &record, sizeof(record));
+  std::memcpy(buffer.data() + sizeof(record), symbol_name.c_str(), symbol_name.size() + 1);
+  std::memcpy(buffer.data() + sizeof(record) + symbol_name.size() + 1, base_address, code_size);
+  s_file.WriteBytes(buffer.data(), buffer.size());
+  s_file.Flush();
+}
+}  // namespace JitDump
+#endif
+
+void Init(const std::string& perf_dir, bool write_jit_dump)
 {
 #if defined USE_OPROFILE && USE_OPROFILE
   s_agent = op_open_agent();
@@ -57,6 +181,14 @@ void Init(const std::string& perf_dir)
     std::setvbuf(s_perf_map_file.GetHandle(), nullptr, _IONBF, 0);
     s_is_enabled = true;
   }
+
+#ifdef __linux__
+  if (write_jit_dump)
+  {
+    JitDump::Open(perf_dir.empty() ? "/tmp" : perf_dir);
+    s_is_enabled |= JitDump::s_file.IsOpen();
+  }
+#endif
 }
 
 void Shutdown()
@@ -73,6 +205,10 @@ void Shutdown()
   if (s_perf_map_file.IsOpen())
     s_perf_map_file.Close();
 
+#ifdef __linux__
+  JitDump::Close();
+#endif
+
   s_is_enabled = false;
 }
 
@@ -84,7 +220,7 @@ bool IsEnabled()
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name)
 {
 #if !(defined USE_OPROFILE && USE_OPROFILE) && !defined(USE_VTUNE)
-  if (!s_perf_map_file.IsOpen())
+  if (!s_is_enabled)
     return;
 #endif
 
@@ -101,6 +237,10 @@ void Register(const void* base_address, u32 code_size, const std::string& symbol
   iJIT_NotifyEvent(iJVM_EVENT_TYPE_METHOD_LOAD_FINISHED, (void*)&jmethod);
 #endif
 
+#ifdef __linux__
+  JitDump::WriteCodeLoad(base_address, code_size, symbol_name);
+#endif
+
   // Linux perf /tmp/perf-$pid.map:
   if (!s_perf_map_file.IsOpen())
     return;
@@ -11,7 +11,10 @@
 
 namespace Common::JitRegister
 {
-void Init(const std::string& perf_dir);
+// perf_dir: where to write a perf map file (or "" to only do so if PERF_BUILDID_DIR is set).
+// write_jit_dump: also write a jitdump file, which additionally contains the emitted code, so that
+// "perf inject --jit" can attribute samples inside JIT code to the guest blocks (Linux only).
+void Init(const std::string& perf_dir, bool write_jit_dump = false);
 void Shutdown();
 void Register(const void* base_address, u32 code_size, const std::string& symbol_name);
 bool IsEnabled();
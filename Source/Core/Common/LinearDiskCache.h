@@ -5,9 +5,9 @@
 
 #include <algorithm>
 #include <cstring>
-#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -74,7 +74,9 @@ public:
       // good header, read some key/value pairs
       K key;
 
-      std::unique_ptr<V[]> value = nullptr;
+      // Reused for all entries, so that it only needs to be reallocated when a larger value is
+      // read than any before it.
+      std::vector<V> value;
       u32 value_size = 0;
       u32 entry_number = 0;
       u64 last_valid_value_start = m_file.Tell();
@@ -85,15 +87,15 @@ public:
         if (next_extent > file_size)
           break;
 
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
+        if (value.size() < value_size)
+          value.resize(value_size);
 
         // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
+        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.data(), value_size) &&
             m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
         {
           last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
+          reader.Read(key, value.data(), value_size);
         }
         else
         {
@@ -42,13 +42,23 @@ public:
     SetEnable(true);
   }
 
-  void Log(LogLevel, const char* msg) override
+  void Log(LogLevel level, const char* msg) override
   {
     if (!IsEnabled() || !IsValid())
       return;
 
     std::lock_guard<std::mutex> lk(m_log_lock);
-    m_logfile << msg << std::flush;
+    m_logfile << msg;
+
+    // Flushing costs a write to the file for every line, which dominates when verbose channels
+    // are enabled. Warnings and more important messages are still flushed right away so that
+    // they make it to the file if we crash; chattier levels are flushed at most every 100 ms.
+    const auto now = std::chrono::steady_clock::now();
+    if (level <= LogLevel::LWARNING || now - m_last_flush >= std::chrono::milliseconds(100))
+    {
+      m_logfile.flush();
+      m_last_flush = now;
+    }
   }
 
   bool IsValid() const { return m_logfile.good(); }
@@ -58,6 +68,7 @@ public:
 private:
   std::mutex m_log_lock;
   std::ofstream m_logfile;
+  std::chrono::steady_clock::time_point m_last_flush{};
   bool m_enable;
 };
 
@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a simple lockless thread-safe,
+// multiple producer, single consumer queue
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+template <typename T>
+class MPSCQueue
+{
+public:
+  MPSCQueue() { m_write_ptr = m_read_ptr = new ElementPtr(); }
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+  ~MPSCQueue()
+  {
+    while (m_read_ptr)
+    {
+      ElementPtr* next_ptr = m_read_ptr->next.load();
+      delete m_read_ptr;
+      m_read_ptr = next_ptr;
+    }
+  }
+
+  // Can be called from any thread.
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    ElementPtr* new_ptr = new ElementPtr();
+    new_ptr->current = std::forward<Arg>(t);
+    // Claim the place at the end of the queue, then link it to the previous element. Until the
+    // second step is done, the consumer sees the queue as ending at the previous element.
+    ElementPtr* prev_ptr = m_write_ptr.exchange(new_ptr, std::memory_order_acq_rel);
+    prev_ptr->next.store(new_ptr, std::memory_order_release);
+  }
+
+  // The functions below must only be called from the consumer thread.
+  bool Empty() const { return !m_read_ptr->next.load(std::memory_order_acquire); }
+
+  bool Pop(T& t)
+  {
+    ElementPtr* next_ptr = m_read_ptr->next.load(std::memory_order_acquire);
+    if (!next_ptr)
+      return false;
+
+    // The element after the read pointer holds the value, and becomes the new read pointer.
+    t = std::move(next_ptr->current);
+    delete m_read_ptr;
+    m_read_ptr = next_ptr;
+    return true;
+  }
+
+private:
+  // stores an element
+  // and a pointer to the next ElementPtr
+  struct ElementPtr
+  {
+    T current{};
+    std::atomic<ElementPtr*> next{nullptr};
+  };
+
+  std::atomic<ElementPtr*> m_write_ptr;
+  ElementPtr* m_read_ptr;
+};
+}  // namespace Common
@@ -257,6 +257,16 @@ bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute)
   return true;
 }
 
+bool AdviseHugePages(void* ptr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+  if (madvise(ptr, size, MADV_HUGEPAGE) == 0)
+    return true;
+  WARN_LOG_FMT(MEMMAP, "AdviseHugePages failed!\nmadvise: {}", LastStrerrorString());
+#endif
+  return false;
+}
+
 size_t MemPhysical()
 {
 #ifdef _WIN32
@@ -33,6 +33,9 @@ void FreeAlignedMemory(void* ptr);
 bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
+// Asks the OS to back the given page aligned range with huge pages where it can, to cut down on
+// TLB misses. Returns false if huge pages aren't available, in which case nothing changes.
+bool AdviseHugePages(void* ptr, size_t size);
 size_t MemPhysical();
 
 }  // namespace Common
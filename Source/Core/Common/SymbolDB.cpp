@@ -52,6 +52,7 @@ void SymbolDB::Clear(const char* prefix)
   // TODO: honor prefix
   m_functions.clear();
   m_checksum_to_function.clear();
+  ++m_functions_version;
 }
 
 void SymbolDB::Index()
@@ -108,6 +109,7 @@ std::vector<Symbol*> SymbolDB::GetSymbolsFromHash(u32 hash)
 
 void SymbolDB::AddCompleteSymbol(const Symbol& symbol)
 {
-  m_functions.emplace(symbol.address, symbol);
+  if (m_functions.emplace(symbol.address, symbol).second)
+    ++m_functions_version;
 }
 }  // namespace Common
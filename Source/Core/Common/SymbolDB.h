@@ -94,5 +94,8 @@ public:
 protected:
   XFuncMap m_functions;
   XFuncPtrMap m_checksum_to_function;
+  // Bumped whenever symbols are added to or removed from m_functions, so that derived classes
+  // know when to rebuild indices of it.
+  u32 m_functions_version = 0;
 };
 }  // namespace Common
@@ -11,6 +11,11 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __APPLE__
 #include <mach/mach.h>
 #elif defined BSD4_4 || defined __FreeBSD__ || defined __OpenBSD__
@@ -21,17 +26,30 @@
 #include <OS.h>
 #endif
 
+#ifdef USE_TRACY
+#include <tracy/Tracy.hpp>
+#endif
+
 #ifdef USE_VTUNE
 #include <ittnotify.h>
 #pragma comment(lib, "libittnotify.lib")
 #endif
 
+#include <atomic>
+
 #include "Common/CommonFuncs.h"
 #include "Common/CommonTypes.h"
 #include "Common/StringUtil.h"
 
 namespace Common
 {
+static std::atomic<bool> s_thread_roles_enabled = true;
+
+void SetThreadRolesEnabled(bool enabled)
+{
+  s_thread_roles_enabled.store(enabled, std::memory_order_relaxed);
+}
+
 int CurrentThreadId()
 {
 #ifdef _WIN32
@@ -110,10 +128,33 @@ static void SetCurrentThreadNameViaApi(const char* name)
   }
 }
 
+void SetCurrentThreadRole(ThreadRole role)
+{
+  if (!s_thread_roles_enabled.load(std::memory_order_relaxed))
+    return;
+
+  // Opting out of power throttling explicitly marks the thread as high QoS, which makes the
+  // scheduler prefer performance cores. Throttled (EcoQoS) threads prefer efficiency cores.
+  THREAD_POWER_THROTTLING_STATE throttling{};
+  throttling.Version = THREAD_POWER_THROTTLING_CURRENT_VERSION;
+  throttling.ControlMask = THREAD_POWER_THROTTLING_EXECUTION_SPEED;
+  throttling.StateMask =
+      role == ThreadRole::Background ? THREAD_POWER_THROTTLING_EXECUTION_SPEED : 0;
+  SetThreadInformation(GetCurrentThread(), ThreadPowerThrottling, &throttling, sizeof(throttling));
+
+  if (role == ThreadRole::Realtime)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+  else if (role == ThreadRole::Background)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+}
+
 void SetCurrentThreadName(const char* name)
 {
   SetCurrentThreadNameViaException(name);
   SetCurrentThreadNameViaApi(name);
+#ifdef USE_TRACY
+  tracy::SetThreadName(name);
+#endif
 }
 
 #else  // !WIN32, so must be POSIX threads
@@ -165,6 +206,85 @@ void SwitchCurrentThread()
   usleep(1000 * 1);
 }
 
+#if defined(__linux__) && defined(SYS_sched_setattr)
+// Not every libc declares this, so it's copied from the kernel's uapi/linux/sched/types.h.
+struct SchedAttr
+{
+  u32 size;
+  u32 sched_policy;
+  u64 sched_flags;
+  s32 sched_nice;
+  u32 sched_priority;
+  u64 sched_runtime;
+  u64 sched_deadline;
+  u64 sched_period;
+  u32 sched_util_min;
+  u32 sched_util_max;
+};
+
+// Asks the scheduler to treat the thread as needing at least util_min and at most util_max of
+// a core's capacity (out of 1024). Energy aware schedulers, like the ones on Android phones, use
+// this to place threads on big or LITTLE cores. Requires Linux 5.3.
+static void SetCurrentThreadUtilClamp(u32 util_min, u32 util_max)
+{
+  constexpr u64 SCHED_FLAG_KEEP_POLICY = 0x08;
+  constexpr u64 SCHED_FLAG_KEEP_PARAMS = 0x10;
+  constexpr u64 SCHED_FLAG_UTIL_CLAMP_MIN = 0x20;
+  constexpr u64 SCHED_FLAG_UTIL_CLAMP_MAX = 0x40;
+
+  SchedAttr attr{};
+  attr.size = sizeof(attr);
+  attr.sched_flags = SCHED_FLAG_KEEP_POLICY | SCHED_FLAG_KEEP_PARAMS | SCHED_FLAG_UTIL_CLAMP_MIN |
+                     SCHED_FLAG_UTIL_CLAMP_MAX;
+  attr.sched_util_min = util_min;
+  attr.sched_util_max = util_max;
+  syscall(SYS_sched_setattr, 0, &attr, 0);
+}
+#endif
+
+void SetCurrentThreadRole(ThreadRole role)
+{
+  if (!s_thread_roles_enabled.load(std::memory_order_relaxed))
+    return;
+
+#ifdef __APPLE__
+  // The QoS class is what decides between performance and efficiency cores on Apple silicon.
+  switch (role)
+  {
+  case ThreadRole::Emulation:
+  case ThreadRole::Realtime:
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+    break;
+  case ThreadRole::IO:
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+    break;
+  case ThreadRole::Background:
+    pthread_set_qos_class_self_np(QOS_CLASS_UTILITY, 0);
+    break;
+  }
+#elif defined(__linux__)
+  // On Linux, the nice value is per thread. Lowering it needs privileges, so only background
+  // threads are changed.
+  if (role == ThreadRole::Background)
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 5);
+
+#ifdef SYS_sched_setattr
+  switch (role)
+  {
+  case ThreadRole::Emulation:
+    SetCurrentThreadUtilClamp(512, 1024);
+    break;
+  case ThreadRole::Background:
+    SetCurrentThreadUtilClamp(0, 512);
+    break;
+  case ThreadRole::Realtime:
+  case ThreadRole::IO:
+    break;
+  }
+#endif
+#endif
+}
+
 void SetCurrentThreadName(const char* name)
 {
 #ifdef __APPLE__
@@ -184,6 +304,9 @@ void SetCurrentThreadName(const char* name)
   // API.
   __itt_thread_set_name(name);
 #endif
+#ifdef USE_TRACY
+  tracy::SetThreadName(name);
+#endif
 }
 
 std::tuple<void*, size_t> GetCurrentThreadStack()
@@ -39,6 +39,25 @@ inline void YieldCPU()
 
 void SetCurrentThreadName(const char* name);
 
+// What a thread is used for. This decides which scheduling hints it gets, so that on CPUs with
+// both performance and efficiency cores the emulation threads end up on the fast ones.
+enum class ThreadRole
+{
+  // The threads that run the emulated CPU and GPU, and therefore limit emulation speed.
+  Emulation,
+  // Threads that do little work but have to meet deadlines, like audio output.
+  Realtime,
+  // Threads that emulation only occasionally waits on, like DVD reads.
+  IO,
+  // Throughput work that nothing is waiting on right away, like shader compilation.
+  Background,
+};
+
+// Scheduling hints are only applied while enabled. Doesn't change threads that already have a role.
+void SetThreadRolesEnabled(bool enabled);
+// Best effort: does nothing on platforms without a fitting API or if the OS refuses the request.
+void SetCurrentThreadRole(ThreadRole role);
+
 #ifndef _WIN32
 // Returns the lowest address of the stack and the size of the stack
 std::tuple<void*, size_t> GetCurrentThreadStack();
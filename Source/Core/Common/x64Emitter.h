@@ -1199,6 +1199,15 @@ public:
     auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
     ABI_CallFunctionPPC(trampoline, reinterpret_cast<const void*>(f), p1, p2);
   }
+
+  template <typename T, typename... Args>
+  void ABI_CallLambdaPCR(const std::function<T(Args...)>* f, void* p1, u32 p2, X64Reg reg3)
+  {
+    auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+    if (reg3 != ABI_PARAM4)
+      MOV(32, R(ABI_PARAM4), R(reg3));
+    ABI_CallFunctionPPC(trampoline, reinterpret_cast<const void*>(f), p1, p2);
+  }
 };  // class XEmitter
 
 class X64CodeBlock : public Common::CodeBlock<XEmitter>
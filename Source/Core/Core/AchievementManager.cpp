@@ -6,6 +6,7 @@
 #include "Core/AchievementManager.h"
 
 #include <cctype>
+#include <cstring>
 #include <memory>
 
 #include <fmt/format.h>
@@ -19,6 +20,7 @@
 #include "Common/WorkQueueThread.h"
 #include "Core/Config/AchievementSettings.h"
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/System.h"
 #include "DiscIO/Blob.h"
@@ -856,12 +858,40 @@ void AchievementManager::Request(const rc_api_request_t* request,
   });
 }
 
+// Returns the host pointer for a range of physical addresses that lies entirely in MEM1 or MEM2,
+// or nullptr if it doesn't.
+static const u8* GetPhysicalRAMPointer(Memory::MemoryManager& memory, u32 address, u32 num_bytes)
+{
+  const u32 ram_size = memory.GetRamSizeReal();
+  if (address < ram_size && num_bytes <= ram_size - address)
+    return memory.GetRAM() + address;
+
+  constexpr u32 EXRAM_BASE = 0x10000000;
+  const u32 exram_size = memory.GetExRamSizeReal();
+  if (memory.GetEXRAM() && address >= EXRAM_BASE && address - EXRAM_BASE < exram_size &&
+      num_bytes <= exram_size - (address - EXRAM_BASE))
+  {
+    return memory.GetEXRAM() + (address - EXRAM_BASE);
+  }
+
+  return nullptr;
+}
+
 u32 AchievementManager::MemoryPeeker(u32 address, u8* buffer, u32 num_bytes, rc_client_t* client)
 {
   if (buffer == nullptr)
     return 0u;
   auto& system = Core::System::GetInstance();
   Core::CPUThreadGuard threadguard(system);
+
+  // rcheevos reads each referenced address once per frame, almost always from RAM. Copy those
+  // reads directly instead of going through the MMU one byte at a time.
+  if (const u8* ram = GetPhysicalRAMPointer(system.GetMemory(), address, num_bytes))
+  {
+    std::memcpy(buffer, ram, num_bytes);
+    return num_bytes;
+  }
+
   for (u32 num_read = 0; num_read < num_bytes; num_read++)
   {
     auto value = system.GetMMU().HostTryReadU8(threadguard, address + num_read,
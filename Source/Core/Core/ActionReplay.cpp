@@ -37,6 +37,7 @@
 #include "Common/IniFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/Timer.h"
 
 #include "Core/ARDecrypt.h"
 #include "Core/CheatCodes.h"
@@ -91,6 +92,33 @@ static std::atomic<bool> s_use_internal_log{false};
 static const ARCode* s_current_code = nullptr;
 static bool s_disable_logging = false;
 
+// Codes made only of RAM writes do the same every frame, so they are flattened into a list of
+// writes instead of being decoded line by line. s_batched_codes is parallel to s_active_codes.
+struct BatchedWrite
+{
+  u32 address;
+  u32 value;
+  u32 size;
+};
+
+struct BatchedCode
+{
+  bool batched = false;
+  u32 first_write = 0;
+  u32 write_count = 0;
+};
+
+// Fills expanding to more writes than this are left to the interpreter.
+constexpr u32 MAX_BATCHED_WRITES_PER_CODE = 0x1000;
+// How many frames the time spent running codes is averaged over before it is logged.
+constexpr u32 RUN_TIME_REPORT_INTERVAL = 600;
+
+static std::vector<BatchedWrite> s_batched_writes;
+static std::vector<BatchedCode> s_batched_codes;
+static bool s_batched_codes_dirty = true;
+static u64 s_run_time_us = 0;
+static u32 s_run_count = 0;
+
 struct ARAddr
 {
   union
@@ -123,6 +151,7 @@ void ApplyCodes(std::span<const ARCode> codes)
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.enabled; });
   s_active_codes.shrink_to_fit();
+  s_batched_codes_dirty = true;
 }
 
 void SetSyncedCodesAsActive()
@@ -130,6 +159,7 @@ void SetSyncedCodesAsActive()
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
+  s_batched_codes_dirty = true;
 }
 
 void UpdateSyncedCodes(std::span<const ARCode> codes)
@@ -152,6 +182,7 @@ std::vector<ARCode> ApplyAndReturnCodes(std::span<const ARCode> codes)
                  [](const ARCode& code) { return code.enabled; });
   }
   s_active_codes.shrink_to_fit();
+  s_batched_codes_dirty = true;
 
   return s_active_codes;
 }
@@ -166,6 +197,7 @@ void AddCode(ARCode code)
     std::lock_guard guard(s_lock);
     s_disable_logging = false;
     s_active_codes.emplace_back(std::move(code));
+    s_batched_codes_dirty = true;
   }
 }
 
@@ -988,21 +1020,149 @@ static bool RunCodeLocked(const Core::CPUThreadGuard& guard, const ARCode& arcod
   return true;
 }
 
+// Appends the writes of a code made only of RAM writes and fills, or returns false if the code
+// does anything else.
+static bool BatchRamWrites(const ARCode& arcode)
+{
+  const size_t first_write = s_batched_writes.size();
+  const auto reject = [first_write] {
+    s_batched_writes.resize(first_write);
+    return false;
+  };
+
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+    const u32 data = entry.value;
+
+    if (addr == 0 || addr.type != 0 || addr.subtype != SUB_RAM_WRITE ||
+        (addr >= 0x00002000 && addr < 0x00003000))
+    {
+      return reject();
+    }
+
+    const u32 new_addr = addr.GCAddress();
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+    case DATATYPE_16BIT:
+    {
+      const bool is_8bit = addr.size == DATATYPE_8BIT;
+      const u32 repeat = is_8bit ? data >> 8 : data >> 16;
+      if (s_batched_writes.size() - first_write + repeat >= MAX_BATCHED_WRITES_PER_CODE)
+        return reject();
+      const u32 size = is_8bit ? 1 : 2;
+      const u32 value = is_8bit ? data & 0xFF : data & 0xFFFF;
+      for (u32 i = 0; i <= repeat; ++i)
+        s_batched_writes.push_back({new_addr + i * size, value, size});
+      break;
+    }
+
+    case DATATYPE_32BIT_FLOAT:
+    case DATATYPE_32BIT:
+      s_batched_writes.push_back({new_addr, data, 4});
+      break;
+
+    default:
+      return reject();
+    }
+  }
+
+  return true;
+}
+
+static void UpdateBatchedCodesLocked()
+{
+  s_batched_writes.clear();
+  s_batched_codes.clear();
+  s_batched_codes.reserve(s_active_codes.size());
+  for (const ARCode& code : s_active_codes)
+  {
+    BatchedCode& batched_code = s_batched_codes.emplace_back();
+    batched_code.first_write = static_cast<u32>(s_batched_writes.size());
+    batched_code.batched = BatchRamWrites(code);
+    batched_code.write_count =
+        static_cast<u32>(s_batched_writes.size()) - batched_code.first_write;
+  }
+  s_batched_codes_dirty = false;
+
+  INFO_LOG_FMT(ACTIONREPLAY, "{} of {} codes batched into {} writes",
+               std::ranges::count(s_batched_codes, true, &BatchedCode::batched),
+               s_active_codes.size(), s_batched_writes.size());
+}
+
+static void ApplyBatchedWrites(const Core::CPUThreadGuard& guard, const BatchedCode& batched_code)
+{
+  for (u32 i = 0; i < batched_code.write_count; ++i)
+  {
+    const BatchedWrite& write = s_batched_writes[batched_code.first_write + i];
+    switch (write.size)
+    {
+    case 1:
+      PowerPC::MMU::HostWrite_U8(guard, write.value, write.address);
+      break;
+    case 2:
+      PowerPC::MMU::HostWrite_U16(guard, write.value, write.address);
+      break;
+    default:
+      PowerPC::MMU::HostWrite_U32(guard, write.value, write.address);
+      break;
+    }
+  }
+}
+
 void RunAllActive(const Core::CPUThreadGuard& cpu_guard)
 {
   if (!Config::AreCheatsEnabled())
     return;
 
+  const u64 start_time = Common::Timer::NowUs();
+
   // If the mutex is idle then acquiring it should be cheap, fast mutexes
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard guard(s_lock);
-  std::erase_if(s_active_codes, [&cpu_guard](const ARCode& code) {
-    const bool success = RunCodeLocked(cpu_guard, code);
-    LogInfo("\n");
-    return !success;
-  });
+  if (s_batched_codes_dirty)
+    UpdateBatchedCodesLocked();
+
+  // The first run after the codes change is interpreted, so that every line is logged.
+  const bool use_batches = s_disable_logging;
+  size_t kept = 0;
+  for (size_t i = 0; i < s_active_codes.size(); ++i)
+  {
+    bool success = true;
+    if (use_batches && s_batched_codes[i].batched)
+    {
+      ApplyBatchedWrites(cpu_guard, s_batched_codes[i]);
+    }
+    else
+    {
+      success = RunCodeLocked(cpu_guard, s_active_codes[i]);
+      LogInfo("\n");
+    }
+
+    if (!success)
+      continue;
+
+    if (kept != i)
+    {
+      s_active_codes[kept] = std::move(s_active_codes[i]);
+      s_batched_codes[kept] = s_batched_codes[i];
+    }
+    ++kept;
+  }
+  s_active_codes.resize(kept);
+  s_batched_codes.resize(kept);
   s_disable_logging = true;
+
+  s_run_time_us += Common::Timer::NowUs() - start_time;
+  if (++s_run_count == RUN_TIME_REPORT_INTERVAL)
+  {
+    INFO_LOG_FMT(ACTIONREPLAY, "Running {} codes took {} us per frame on average",
+                 s_active_codes.size(), s_run_time_us / s_run_count);
+    s_run_time_us = 0;
+    s_run_count = 0;
+  }
 }
 
 }  // namespace ActionReplay
@@ -54,6 +54,7 @@
 
 #include "DiscIO/Enums.h"
 #include "DiscIO/GameModDescriptor.h"
+#include "DiscIO/HttpBlob.h"
 #include "DiscIO/RiivolutionParser.h"
 #include "DiscIO/RiivolutionPatcher.h"
 #include "DiscIO/VolumeDisc.h"
@@ -196,7 +197,7 @@ std::unique_ptr<BootParameters> BootParameters::GenerateFromFile(std::vector<std
 
   // Check if the file exist, we may have gotten it from a --elf command line
   // that gave an incorrect file name
-  if (!File::Exists(paths.front()))
+  if (!DiscIO::IsHttpUrl(paths.front()) && !File::Exists(paths.front()))
   {
     PanicAlertFmtT("The specified file \"{0}\" does not exist", paths.front());
     return {};
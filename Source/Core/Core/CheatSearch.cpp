@@ -4,9 +4,11 @@
 #include "Core/CheatSearch.h"
 
 #include <bit>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <variant>
@@ -15,6 +17,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -198,6 +201,48 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 {
   return PowerPC::MMU::HostTryReadF64(guard, addr, space);
 }
+
+// Searches read every address in a range, so going through the MMU for each value is slow. This
+// reads values straight from the host memory of the current page while it is plain RAM, and only
+// falls back to the MMU for values in other kinds of memory or that cross a page boundary.
+template <typename T>
+class PageCachedReader
+{
+public:
+  PageCachedReader(const Core::CPUThreadGuard& guard, PowerPC::RequestedAddressSpace space)
+      : m_guard(guard), m_space(space)
+  {
+  }
+
+  std::optional<PowerPC::ReadResult<T>> Read(u32 addr)
+  {
+    const u32 page_address = addr & ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    const u32 offset = addr & static_cast<u32>(PowerPC::HW_PAGE_MASK);
+    if (offset + sizeof(T) > PowerPC::HW_PAGE_SIZE)
+      return TryReadValueFromEmulatedMemory<T>(m_guard, addr, m_space);
+
+    if (!m_has_page || page_address != m_page_address)
+    {
+      m_page = PowerPC::MMU::HostTryGetRAMPage(m_guard, page_address, m_space);
+      m_page_address = page_address;
+      m_has_page = true;
+    }
+
+    if (!m_page)
+      return TryReadValueFromEmulatedMemory<T>(m_guard, addr, m_space);
+
+    T value;
+    std::memcpy(&value, m_page->value.data() + offset, sizeof(T));
+    return PowerPC::ReadResult<T>(m_page->translated, Common::FromBigEndian(value));
+  }
+
+private:
+  const Core::CPUThreadGuard& m_guard;
+  PowerPC::RequestedAddressSpace m_space;
+  std::optional<PowerPC::ReadResult<std::span<const u8>>> m_page;
+  u32 m_page_address = 0;
+  bool m_has_page = false;
+};
 }  // namespace
 
 template <typename T>
@@ -234,10 +279,11 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
       continue;
 
     const u64 length = aligned_length - (sizeof(T) - 1);
+    PageCachedReader<T> reader(guard, address_space);
     for (u64 i = 0; i < length; i += increment_per_loop)
     {
       const u32 addr = start_address + i;
-      const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+      const auto current_value = reader.Read(addr);
       if (!current_value)
         continue;
 
@@ -276,10 +322,11 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  PageCachedReader<T> reader(guard, address_space);
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+    const auto current_value = reader.Read(addr);
     if (!current_value)
     {
       auto& r = results.emplace_back();
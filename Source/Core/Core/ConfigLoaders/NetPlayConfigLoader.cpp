@@ -83,6 +83,7 @@ public:
 
     layer->Set(Config::MAIN_JIT_FOLLOW_BRANCH, m_settings.jit_follow_branch);
     layer->Set(Config::MAIN_FAST_DISC_SPEED, m_settings.fast_disc_speed);
+    layer->Set(Config::MAIN_FAST_DISC_SEEK, false);
     layer->Set(Config::MAIN_MMU, m_settings.mmu);
     layer->Set(Config::MAIN_FASTMEM, m_settings.fastmem);
     layer->Set(Config::MAIN_SKIP_IPL, m_settings.skip_ipl);
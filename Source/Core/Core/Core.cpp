@@ -9,6 +9,7 @@
 #include <functional>
 #include <mutex>
 #include <queue>
+#include <string_view>
 #include <utility>
 #include <variant>
 
@@ -177,6 +178,8 @@ void OnFrameEnd(Core::System& system)
     s_memory_watcher->Step(guard);
   }
 #endif
+
+  State::CaptureRewindPoint(system);
 }
 
 // Display messages and return values
@@ -373,6 +376,7 @@ static void CpuThread(Core::System& system, const std::optional<std::string>& sa
     Common::SetCurrentThreadName("CPU thread");
   else
     Common::SetCurrentThreadName("CPU-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   // This needs to be delayed until after the video backend is ready.
   DolphinAnalytics::Instance().ReportGameStart();
@@ -450,6 +454,7 @@ static void FifoPlayerThread(Core::System& system, const std::optional<std::stri
     Common::SetCurrentThreadName("FIFO player thread");
   else
     Common::SetCurrentThreadName("FIFO-GPU thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   // Enter CPU run loop. When we leave it - we are done.
   if (auto cpu_core = system.GetFifoPlayer().GetCPUCore())
@@ -492,6 +497,17 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }};
 
   Common::SetCurrentThreadName("Emuthread - Starting");
+  Common::SetThreadRolesEnabled(Config::Get(Config::MAIN_THREAD_ROLES));
+
+  // Log how long each step of the boot takes, so that slow boots can be narrowed down.
+  const u64 boot_start_us = Common::Timer::NowUs();
+  u64 boot_phase_start_us = boot_start_us;
+  const auto end_boot_phase = [&boot_phase_start_us](std::string_view phase) {
+    const u64 now_us = Common::Timer::NowUs();
+    INFO_LOG_FMT(BOOT, "Boot phase \"{}\" took {:.1f} ms", phase,
+                 (now_us - boot_phase_start_us) / 1000.0);
+    boot_phase_start_us = now_us;
+  };
 
   DeclareAsGPUThread();
 
@@ -507,6 +523,10 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   ASSERT(g_controller_interface.IsInit());
   g_controller_interface.ChangeWindow(wsi.render_window);
 
+  // Opening the audio device doesn't depend on the emulated hardware, so it runs in the background
+  // while the input configs are loaded, the SD card is synced and the asset loader starts up.
+  AudioCommon::PendingSoundStream pending_sound_stream = AudioCommon::BeginInitSoundStream();
+
   Pad::LoadConfig();
   Pad::LoadGBAConfig();
   Keyboard::LoadConfig();
@@ -545,18 +565,22 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   FreeLook::LoadInputConfig();
+  end_boot_phase("input configs and SD card sync");
 
   system.GetCustomAssetLoader().Init();
   Common::ScopeGuard asset_loader_guard([&system] { system.GetCustomAssetLoader().Shutdown(); });
 
   system.GetMovie().Init(*boot);
   Common::ScopeGuard movie_guard([&system] { system.GetMovie().Shutdown(); });
+  end_boot_phase("asset loader and movie");
 
-  AudioCommon::InitSoundStream(system);
+  AudioCommon::InitSoundStream(system, std::move(pending_sound_stream));
   Common::ScopeGuard audio_guard([&system] { AudioCommon::ShutdownSoundStream(system); });
+  end_boot_phase("audio");
 
   HW::Init(system,
            NetPlay::IsNetPlayRunning() ? &(boot_session_data.GetNetplaySettings()->sram) : nullptr);
+  end_boot_phase("hardware");
 
   Common::ScopeGuard hw_guard{[&system] {
     // We must set up this flag before executing HW::Shutdown()
@@ -583,6 +607,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     PanicAlertFmt("Failed to initialize video backend!");
     return;
   }
+  end_boot_phase("video backend");
   Common::ScopeGuard video_guard{[] {
     // Clear on screen messages that haven't expired
     OSD::ClearMessages();
@@ -603,6 +628,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
   }
 
   AudioCommon::PostInitSoundStream(system);
+  end_boot_phase("DSP");
 
   // The hardware is initialized.
   s_hardware_initialized = true;
@@ -632,6 +658,7 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
     if (!CBoot::BootUp(system, guard, std::move(boot)))
       return;
   }
+  end_boot_phase("title boot");
 
   // Initialise Wii filesystem contents.
   // This is done here after Boot and not in BootManager to ensure that we operate
@@ -660,12 +687,17 @@ static void EmuThread(Core::System& system, std::unique_ptr<BootParameters> boot
 
   UpdateTitle(system);
 
+  end_boot_phase("Wii filesystem and CPU core");
+  INFO_LOG_FMT(BOOT, "Boot took {:.1f} ms in total",
+               (Common::Timer::NowUs() - boot_start_us) / 1000.0);
+
   // ENTER THE VIDEO THREAD LOOP
   if (system.IsDualCoreMode())
   {
     // This thread, after creating the EmuWindow, spawns a CPU
     // thread, and then takes over and becomes the video thread
     Common::SetCurrentThreadName("Video thread");
+    Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
     UndeclareAsCPUThread();
     Common::FPU::LoadDefaultSIMDState();
 
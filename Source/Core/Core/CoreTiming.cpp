@@ -4,7 +4,6 @@
 #include "Core/CoreTiming.h"
 
 #include <algorithm>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -13,6 +12,7 @@
 
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
+#include "Common/Instrumentation.h"
 #include "Common/Logging/Log.h"
 #include "Common/SPSCQueue.h"
 
@@ -86,7 +86,10 @@ EventType* CoreTimingManager::RegisterEvent(const std::string& name, TimedCallba
 
 void CoreTimingManager::UnregisterAllEvents()
 {
-  ASSERT_MSG(POWERPC, m_event_queue.empty(), "Cannot unregister events with events pending");
+  ASSERT_MSG(POWERPC, m_event_queue.size() == m_removed_event_count,
+             "Cannot unregister events with events pending");
+  m_event_queue.clear();
+  m_removed_event_count = 0;
   m_event_types.clear();
 }
 
@@ -118,7 +121,6 @@ void CoreTimingManager::Init()
 
 void CoreTimingManager::Shutdown()
 {
-  std::lock_guard lk(m_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
   UnregisterAllEvents();
@@ -138,6 +140,8 @@ void CoreTimingManager::RefreshConfig()
 
   m_max_variance = std::chrono::duration_cast<DT>(DT_ms(Config::Get(Config::MAIN_TIMING_VARIANCE)));
 
+  m_config_low_latency_throttle = Config::Get(Config::MAIN_LOW_LATENCY_THROTTLE);
+
 #ifdef USE_RETRO_ACHIEVEMENTS
   if (AchievementManager::GetInstance().IsHardcoreModeActive() &&
       Config::Get(Config::MAIN_EMULATION_SPEED) < 1.0f &&
@@ -154,7 +158,6 @@ void CoreTimingManager::RefreshConfig()
 
 void CoreTimingManager::DoState(PointerWrap& p)
 {
-  std::lock_guard lk(m_ts_write_lock);
   p.Do(m_globals.slice_length);
   p.Do(m_globals.global_timer);
   p.Do(m_idled_cycles);
@@ -169,6 +172,8 @@ void CoreTimingManager::DoState(PointerWrap& p)
   p.DoMarker("CoreTimingData");
 
   MoveEvents();
+  if (!p.IsReadMode())
+    CompactEventQueue();
   p.DoEachElement(m_event_queue, [this](PointerWrap& pw, Event& ev) {
     pw.Do(ev.time);
     pw.Do(ev.fifo_order);
@@ -208,6 +213,8 @@ void CoreTimingManager::DoState(PointerWrap& p)
     // The exact layout of the heap in memory is implementation defined, therefore it is platform
     // and library version specific.
     std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    m_removed_event_count = 0;
+    RecountPendingEvents();
 
     // The stave state has changed the time, so our previous Throttle targets are invalid.
     // Especially when global_time goes down; So we create a fake throttle update.
@@ -236,6 +243,61 @@ u64 CoreTimingManager::GetIdleTicks() const
 void CoreTimingManager::ClearPendingEvents()
 {
   m_event_queue.clear();
+  m_removed_event_count = 0;
+  RecountPendingEvents();
+}
+
+bool CoreTimingManager::IsRemoved(const Event& event)
+{
+  return event.fifo_order < event.type->removed_before_fifo_id;
+}
+
+void CoreTimingManager::PushEvent(Event event)
+{
+  ++event.type->pending_events;
+  m_event_queue.emplace_back(std::move(event));
+  std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+}
+
+Event CoreTimingManager::PopEvent()
+{
+  Event event = std::move(m_event_queue.front());
+  std::pop_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+  m_event_queue.pop_back();
+
+  if (IsRemoved(event))
+    --m_removed_event_count;
+  else
+    --event.type->pending_events;
+  return event;
+}
+
+void CoreTimingManager::DiscardRemovedEvents()
+{
+  while (!m_event_queue.empty() && IsRemoved(m_event_queue.front()))
+    PopEvent();
+}
+
+void CoreTimingManager::CompactEventQueue()
+{
+  if (m_removed_event_count == 0)
+    return;
+
+  std::erase_if(m_event_queue, IsRemoved);
+  std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+  m_removed_event_count = 0;
+}
+
+void CoreTimingManager::RecountPendingEvents()
+{
+  // Only called when the queue doesn't contain any removed events.
+  for (auto& [name, event_type] : m_event_types)
+  {
+    event_type.removed_before_fifo_id = 0;
+    event_type.pending_events = 0;
+  }
+  for (const Event& event : m_event_queue)
+    ++event.type->pending_events;
 }
 
 void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_type, u64 userdata,
@@ -264,8 +326,7 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
     if (!m_is_global_timer_sane)
       ForceExceptionCheck(cycles_into_future);
 
-    m_event_queue.emplace_back(Event{timeout, m_event_fifo_id++, userdata, event_type});
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    PushEvent(Event{timeout, m_event_fifo_id++, userdata, event_type});
   }
   else
   {
@@ -277,22 +338,23 @@ void CoreTimingManager::ScheduleEvent(s64 cycles_into_future, EventType* event_t
                     *event_type->name);
     }
 
-    std::lock_guard lk(m_ts_write_lock);
     m_ts_queue.Push(Event{m_globals.global_timer + cycles_into_future, 0, userdata, event_type});
   }
 }
 
 void CoreTimingManager::RemoveEvent(EventType* event_type)
 {
-  auto itr = std::remove_if(m_event_queue.begin(), m_event_queue.end(),
-                            [&](const Event& e) { return e.type == event_type; });
+  if (event_type->pending_events == 0)
+    return;
 
-  // Removing random items breaks the invariant so we have to re-establish it.
-  if (itr != m_event_queue.end())
-  {
-    m_event_queue.erase(itr, m_event_queue.end());
-    std::make_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-  }
+  // Removing random items would break the heap invariant, so only mark them as removed.
+  event_type->removed_before_fifo_id = m_event_fifo_id;
+  m_removed_event_count += event_type->pending_events;
+  event_type->pending_events = 0;
+
+  // Don't let removed events pile up if they don't make it to the front of the queue quickly.
+  if (m_removed_event_count > m_event_queue.size() / 2)
+    CompactEventQueue();
 }
 
 void CoreTimingManager::RemoveAllEvents(EventType* event_type)
@@ -319,13 +381,14 @@ void CoreTimingManager::MoveEvents()
   for (Event ev; m_ts_queue.Pop(ev);)
   {
     ev.fifo_order = m_event_fifo_id++;
-    m_event_queue.emplace_back(std::move(ev));
-    std::push_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
+    PushEvent(std::move(ev));
   }
 }
 
 void CoreTimingManager::Advance()
 {
+  INSTRUMENT_ZONE("CoreTiming::Advance");
+
   CPUThreadConfigCallback::CheckForConfigChanges();
 
   MoveEvents();
@@ -341,14 +404,14 @@ void CoreTimingManager::Advance()
 
   m_is_global_timer_sane = true;
 
+  DiscardRemovedEvents();
   while (!m_event_queue.empty() && m_event_queue.front().time <= m_globals.global_timer)
   {
-    Event evt = std::move(m_event_queue.front());
-    std::pop_heap(m_event_queue.begin(), m_event_queue.end(), std::greater<Event>());
-    m_event_queue.pop_back();
+    Event evt = PopEvent();
 
     Throttle(evt.time);
     evt.type->callback(m_system, evt.userdata, m_globals.global_timer - evt.time);
+    DiscardRemovedEvents();
   }
 
   m_is_global_timer_sane = false;
@@ -407,6 +470,22 @@ void CoreTimingManager::Throttle(const s64 target_cycle)
   // It doesn't matter what amount of lag we skip VI at, as long as it's constant.
   m_throttle_disable_vi_int = 0.0 < speed && m_throttle_deadline < vi_deadline;
 
+  // The low latency throttle only sleeps at the start of each field, see ThrottleField.
+  if (!m_config_low_latency_throttle)
+    SleepUntilThrottleDeadline(time);
+}
+
+void CoreTimingManager::ThrottleField()
+{
+  if (!m_config_low_latency_throttle)
+    return;
+
+  Throttle(m_globals.global_timer);
+  SleepUntilThrottleDeadline(Clock::now());
+}
+
+void CoreTimingManager::SleepUntilThrottleDeadline(TimePoint time)
+{
   // Only sleep if we are behind the deadline
   if (time < m_throttle_deadline)
   {
@@ -446,6 +525,8 @@ void CoreTimingManager::LogPendingEvents() const
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
+    if (IsRemoved(ev))
+      continue;
     INFO_LOG_FMT(POWERPC, "PENDING: Now: {} Pending: {} Type: {}", m_globals.global_timer, ev.time,
                  *ev.type->name);
   }
@@ -489,6 +570,8 @@ std::string CoreTimingManager::GetScheduledEventsSummary() const
   std::sort(clone.begin(), clone.end());
   for (const Event& ev : clone)
   {
+    if (IsRemoved(ev))
+      continue;
     text += fmt::format("{} : {} {:016x}\n", *ev.type->name, ev.time, ev.userdata);
   }
   return text;
@@ -22,7 +22,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/SPSCQueue.h"
+#include "Common/MPSCQueue.h"
 #include "Core/CPUThreadConfigCallback.h"
 
 class PointerWrap;
@@ -50,6 +50,11 @@ struct EventType
 {
   TimedCallback callback;
   const std::string* name;
+
+  // Events of this type with a lower fifo_order have been removed, but may still be in the queue.
+  u64 removed_before_fifo_id = 0;
+  // Number of events of this type in the queue which haven't been removed.
+  u32 pending_events = 0;
 };
 
 struct Event
@@ -148,6 +153,11 @@ public:
   // in order to allow custom throttling implementations to be tested.
   void Throttle(const s64 target_cycle);
 
+  // With the low latency throttle enabled, Throttle only moves the deadline forward and the CPU
+  // thread instead sleeps here once per field. The whole field is then emulated in one go right
+  // after sleeping, so the input polled during it reaches the screen as early as possible.
+  void ThrottleField();
+
   TimePoint GetCPUTimePoint(s64 cyclesLate) const;  // Used by Dolphin Analytics
   bool GetVISkip() const;                           // Used By VideoInterface
 
@@ -167,10 +177,14 @@ private:
   // We don't use std::priority_queue because we need to be able to serialize, unserialize and
   // erase arbitrary events (RemoveEvent()) regardless of the queue order. These aren't accomodated
   // by the standard adaptor class.
+  // RemoveEvent() doesn't erase events right away, it only marks them as removed through their
+  // EventType. Removed events are dropped once they reach the front of the queue, or all at once
+  // when they make up most of the queue.
   std::vector<Event> m_event_queue;
+  size_t m_removed_event_count = 0;
   u64 m_event_fifo_id = 0;
-  std::mutex m_ts_write_lock;
-  Common::SPSCQueue<Event, false> m_ts_queue;
+  // Events scheduled from other threads, until the CPU thread moves them into m_event_queue.
+  Common::MPSCQueue<Event> m_ts_queue;
 
   float m_last_oc_factor = 0.0f;
 
@@ -187,6 +201,7 @@ private:
   float m_config_oc_factor = 0.0f;
   float m_config_oc_inv_factor = 0.0f;
   bool m_config_sync_on_skip_idle = false;
+  bool m_config_low_latency_throttle = false;
 
   s64 m_throttle_last_cycle = 0;
   TimePoint m_throttle_deadline = Clock::now();
@@ -199,6 +214,14 @@ private:
   double m_emulation_speed = 1.0;
 
   void ResetThrottle(s64 cycle);
+  void SleepUntilThrottleDeadline(TimePoint time);
+
+  static bool IsRemoved(const Event& event);
+  void PushEvent(Event event);
+  Event PopEvent();
+  void DiscardRemovedEvents();
+  void CompactEventQueue();
+  void RecountPendingEvents();
 
   int DowncountToCycles(int downcount) const;
   int CyclesToDowncount(int cycles) const;
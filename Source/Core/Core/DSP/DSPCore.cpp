@@ -419,7 +419,7 @@ bool DSPCore::Initialize(const DSPInitOptions& opts)
   m_init_hax = false;
 
   // Initialize JIT, if necessary
-  if (opts.core_type == DSPInitOptions::CoreType::JIT64)
+  if (opts.core_type == DSPInitOptions::CoreType::JIT)
     m_dsp_jit = JIT::CreateDSPEmitter(*this);
 
   m_dsp_cap.reset(opts.capture_logger);
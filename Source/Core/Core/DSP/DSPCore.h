@@ -293,13 +293,13 @@ struct DSPInitOptions
   std::array<u16, DSP_COEF_SIZE> coef_contents{};
 
   // Core used to emulate the DSP.
-  // Default: JIT64.
+  // Default: JIT.
   enum class CoreType
   {
     Interpreter,
-    JIT64,
+    JIT,
   };
-  CoreType core_type = CoreType::JIT64;
+  CoreType core_type = CoreType::JIT;
 
   // Optional capture logger used to log internal DSP data transfers.
   // Default: dummy implementation, does nothing.
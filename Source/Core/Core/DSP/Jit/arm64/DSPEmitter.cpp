@@ -0,0 +1,429 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Common/Assert.h"
+#include "Common/BitSet.h"
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
+
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Interpreter/DSPIntTables.h"
+#include "Core/DSP/Interpreter/DSPInterpreter.h"
+#include "Core/DSP/Jit/arm64/DSPJitTables.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t MAX_BLOCK_SIZE = 250;
+constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
+
+// X19 to X30, as required by the AAPCS64. Only the low halves of the FPRs are callee-saved, and
+// the compiled code doesn't use them.
+constexpr u32 CALLEE_SAVED_GPRS = 0x7FF80000;
+
+DSPEmitter::DSPEmitter(DSPCore& dsp)
+    : m_blocks(MAX_BLOCKS), m_block_size(MAX_BLOCKS), m_dsp_core{dsp}
+{
+  arm64::InitInstructionTables();
+  AllocCodeSpace(COMPILED_CODE_SIZE);
+
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+  CompileDispatcher();
+  m_stub_entry_point = CompileStub();
+  FlushIcache();
+
+  // Clear all of the block references
+  std::fill(m_blocks.begin(), m_blocks.end(), (DSPCompiledCode)m_stub_entry_point);
+}
+
+DSPEmitter::~DSPEmitter()
+{
+  FreeCodeSpace();
+}
+
+u16 DSPEmitter::RunCycles(u16 cycles)
+{
+  if (m_dsp_core.DSPState().external_interrupt_waiting.exchange(false, std::memory_order_acquire))
+  {
+    m_dsp_core.CheckExternalInterrupt();
+    m_dsp_core.CheckExceptions();
+  }
+
+  m_cycles_left = cycles;
+  auto exec_addr = (DSPCompiledCode)m_enter_dispatcher;
+  exec_addr();
+
+  if (m_dsp_core.DSPState().reset_dspjit_codespace)
+    ClearIRAMandDSPJITCodespaceReset();
+
+  return m_cycles_left;
+}
+
+void DSPEmitter::DoState(PointerWrap& p)
+{
+  p.Do(m_cycles_left);
+}
+
+void DSPEmitter::ClearIRAM()
+{
+  for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
+  {
+    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
+    m_block_size[i] = 0;
+  }
+  m_dsp_core.DSPState().reset_dspjit_codespace = true;
+}
+
+void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+  ClearCodeSpace();
+  CompileDispatcher();
+  m_stub_entry_point = CompileStub();
+  FlushIcache();
+
+  for (size_t i = 0; i < MAX_BLOCKS; i++)
+  {
+    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
+    m_block_size[i] = 0;
+  }
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+static void CheckExceptionsThunk(DSPCore& dsp)
+{
+  dsp.CheckExceptions();
+}
+
+// Must go out of block if exception is detected
+void DSPEmitter::checkExceptions(u32 retval)
+{
+  // Check for interrupts and exceptions
+  LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_exceptions());
+  FixupBranch skip_check = CBZ(ARM64Reg::W0);
+
+  MOVI2R(ARM64Reg::W0, m_compile_pc);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+
+  m_gpr.StoreDirtyRegs();
+  ABI_CallFunction(CheckExceptionsThunk, &m_dsp_core);
+  MOVI2R(ARM64Reg::W0, retval);
+  B(m_return_dispatcher);
+
+  SetJumpTarget(skip_check);
+}
+
+static void FallbackThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetOp(inst))(inst);
+}
+
+void DSPEmitter::FallBackToInterpreter(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+
+  if (op_template->reads_pc)
+  {
+    // Fallbacks to interpreter need this for fetching immediate values
+    MOVI2R(ARM64Reg::W0, static_cast<u16>(m_compile_pc + 1));
+    STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+  }
+
+  // Fall back to interpreter
+  ASSERT_MSG(DSPLLE, Interpreter::GetOp(inst) != nullptr, "No function for {:04x}", inst);
+  m_gpr.Flush();
+  ABI_CallFunction(FallbackThunk, &m_dsp_core.GetInterpreter(), inst);
+}
+
+static void FallbackExtThunk(Interpreter::Interpreter& interpreter, UDSPInstruction inst)
+{
+  (interpreter.*Interpreter::GetExtOp(inst))(inst);
+}
+
+static void ApplyWriteBackLogThunk(Interpreter::Interpreter& interpreter)
+{
+  interpreter.ApplyWriteBackLog();
+}
+
+void DSPEmitter::EmitInstruction(UDSPInstruction inst)
+{
+  const DSPOPCTemplate* const op_template = GetOpTemplate(inst);
+
+  // The extension part always runs in the interpreter. It only reads the registers and queues
+  // its writes in the write-back log, which is applied after the main part.
+  const auto ext_function = op_template->extended ? Interpreter::GetExtOp(inst) : nullptr;
+  const bool run_ext = ext_function != nullptr &&
+                       ext_function != &Interpreter::Interpreter::nop_ext &&
+                       ext_function != &Interpreter::Interpreter::nop;
+  if (run_ext)
+  {
+    m_gpr.Flush();
+    ABI_CallFunction(FallbackExtThunk, &m_dsp_core.GetInterpreter(), inst);
+  }
+
+  // Main instruction
+  const auto jit_function = GetOp(inst);
+  if (jit_function)
+  {
+    (this->*jit_function)(inst);
+  }
+  else
+  {
+    FallBackToInterpreter(inst);
+    DEBUG_LOG_FMT(DSPLLE, "Instruction not JITed(main part): {:04x}", inst);
+  }
+
+  // Backlog
+  if (run_ext)
+  {
+    m_gpr.Flush();
+    ABI_CallFunction(ApplyWriteBackLogThunk, &m_dsp_core.GetInterpreter());
+  }
+}
+
+u16 DSPEmitter::GetBlockExitCycles() const
+{
+  if (!Host::OnThread() && m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
+    return DSP_IDLE_SKIP_CYCLES;
+
+  return m_block_size[m_start_address];
+}
+
+void DSPEmitter::WriteBlockExit()
+{
+  m_gpr.StoreDirtyRegs();
+  MOVI2R(ARM64Reg::W0, GetBlockExitCycles());
+  B(m_return_dispatcher);
+}
+
+void DSPEmitter::Compile(u16 start_addr)
+{
+  // Remember the current block address for later
+  m_start_address = start_addr;
+
+  const u8* entry_point = AlignCode16();
+
+  m_gpr.Reset();
+
+  m_compile_pc = start_addr;
+  bool fixup_pc = false;
+  m_block_size[start_addr] = 0;
+
+  auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+  while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
+  {
+    if (analyzer.IsCheckExceptions(m_compile_pc))
+      checkExceptions(m_block_size[start_addr]);
+
+    const UDSPInstruction inst = m_dsp_core.DSPState().ReadIMEM(m_compile_pc);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+
+    EmitInstruction(inst);
+
+    m_block_size[start_addr]++;
+    m_compile_pc += opcode->size;
+
+    fixup_pc = true;
+
+    // Handle loop condition, only if current instruction was flagged as a loop destination
+    // by the analyzer.
+    if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
+    {
+      LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_r_st(2));
+      FixupBranch loop_address_exit = CBZ(ARM64Reg::W0);
+      LDRH(IndexType::Unsigned, ARM64Reg::W1, STATE_REG, SDSP_r_st(3));
+      FixupBranch loop_counter_exit = CBZ(ARM64Reg::W1);
+
+      if (!opcode->branch)
+      {
+        // branch insns update the g_dsp.pc
+        MOVI2R(ARM64Reg::W2, m_compile_pc);
+        STRH(IndexType::Unsigned, ARM64Reg::W2, STATE_REG, SDSP_pc());
+      }
+
+      // These functions branch and therefore only need to be called in the
+      // end of each block and in this order
+      m_gpr.StoreDirtyRegs();
+      HandleLoop();
+      MOVI2R(ARM64Reg::W0, GetBlockExitCycles());
+      B(m_return_dispatcher);
+
+      SetJumpTarget(loop_address_exit);
+      SetJumpTarget(loop_counter_exit);
+    }
+
+    if (opcode->branch)
+    {
+      // don't update g_dsp.pc -- the branch insn already did
+      fixup_pc = false;
+      if (opcode->uncond_branch)
+      {
+        break;
+      }
+
+      const auto jit_function = GetOp(inst);
+      if (!jit_function)
+      {
+        // look at g_dsp.pc if we actually branched
+        LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+        CMPI2R(ARM64Reg::W0, m_compile_pc, ARM64Reg::W1);
+        FixupBranch no_branch = B(CC_EQ);
+
+        // don't update g_dsp.pc -- the branch insn already did
+        WriteBlockExit();
+
+        SetJumpTarget(no_branch);
+      }
+    }
+
+    // End the block if we're before an idle skip address
+    if (analyzer.IsIdleSkip(m_compile_pc))
+    {
+      break;
+    }
+  }
+
+  if (fixup_pc)
+  {
+    MOVI2R(ARM64Reg::W0, m_compile_pc);
+    STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+  }
+
+  m_blocks[start_addr] = (DSPCompiledCode)entry_point;
+
+  if (m_block_size[start_addr] == 0)
+  {
+    // just a safeguard, should never happen anymore.
+    // if it does we might get stuck over in RunForCycles.
+    ERROR_LOG_FMT(DSPLLE, "Block at {:#06x} has zero size", start_addr);
+    m_block_size[start_addr] = 1;
+  }
+
+  m_gpr.Flush();
+  MOVI2R(ARM64Reg::W0, GetBlockExitCycles());
+  B(m_return_dispatcher);
+
+  FlushIcacheSection(const_cast<u8*>(entry_point), GetWritableCodePtr());
+}
+
+void DSPEmitter::CompileCurrent(DSPEmitter& emitter)
+{
+  const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
+  emitter.Compile(emitter.m_dsp_core.DSPState().pc);
+}
+
+const u8* DSPEmitter::CompileStub()
+{
+  const u8* entry_point = AlignCode16();
+  ABI_CallFunction(CompileCurrent, this);
+  MOVI2R(ARM64Reg::W0, 0);  // Return 0 cycles executed
+  B(m_return_dispatcher);
+  return entry_point;
+}
+
+void DSPEmitter::CompileDispatcher()
+{
+  m_enter_dispatcher = AlignCode16();
+  const BitSet32 registers_used(CALLEE_SAVED_GPRS);
+  ABI_PushRegisters(registers_used);
+
+  MOVP2R(STATE_REG, &m_dsp_core.DSPState());
+
+  const u8* dispatcher_loop = GetCodePtr();
+
+  FixupBranch exception_exit;
+  if (Host::OnThread())
+  {
+    LDRB(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_external_interrupt_waiting());
+    exception_exit = CBNZ(ARM64Reg::W0);
+  }
+
+  // Check for DSP halt
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_control_reg());
+  static_assert(CR_HALT == 1 << 2);
+  FixupBranch halt = TBNZ(ARM64Reg::W0, 2);
+
+  // Execute block. Cycles executed returned in W0.
+  LDRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+  MOVP2R(ARM64Reg::X1, m_blocks.data());
+  LDR(ARM64Reg::X1, ARM64Reg::X1, ArithOption(ARM64Reg::X0, true));
+  BR(ARM64Reg::X1);
+
+  m_return_dispatcher = GetCodePtr();
+
+  // Decrement cyclesLeft
+  MOVP2R(ARM64Reg::X1, &m_cycles_left);
+  LDRH(IndexType::Unsigned, ARM64Reg::W2, ARM64Reg::X1, 0);
+  SUBS(ARM64Reg::W2, ARM64Reg::W2, ARM64Reg::W0);
+  STRH(IndexType::Unsigned, ARM64Reg::W2, ARM64Reg::X1, 0);
+
+  B(CC_HI, dispatcher_loop);
+
+  // DSP gave up the remaining cycles.
+  SetJumpTarget(halt);
+  if (Host::OnThread())
+  {
+    SetJumpTarget(exception_exit);
+  }
+  ABI_PopRegisters(registers_used);
+  RET();
+}
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+s32 DSPEmitter::SDSP_pc()
+{
+  return static_cast<s32>(offsetof(SDSP, pc));
+}
+
+s32 DSPEmitter::SDSP_exceptions()
+{
+  return static_cast<s32>(offsetof(SDSP, exceptions));
+}
+
+s32 DSPEmitter::SDSP_control_reg()
+{
+  return static_cast<s32>(offsetof(SDSP, control_reg));
+}
+
+s32 DSPEmitter::SDSP_external_interrupt_waiting()
+{
+  static_assert(decltype(SDSP::external_interrupt_waiting)::is_always_lock_free &&
+                sizeof(SDSP::external_interrupt_waiting) == sizeof(u8));
+
+  return static_cast<s32>(offsetof(SDSP, external_interrupt_waiting));
+}
+
+s32 DSPEmitter::SDSP_r_st(size_t index)
+{
+  return static_cast<s32>(offsetof(SDSP, r.st) + sizeof(SDSP::r.st[0]) * index);
+}
+
+s32 DSPEmitter::SDSP_dram()
+{
+  return static_cast<s32>(offsetof(SDSP, dram));
+}
+
+s32 DSPEmitter::SDSP_coef()
+{
+  return static_cast<s32>(offsetof(SDSP, coef));
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+}  // namespace DSP::JIT::arm64
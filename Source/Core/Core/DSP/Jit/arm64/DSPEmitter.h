@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCommon.h"
+#include "Core/DSP/Jit/DSPEmitterBase.h"
+#include "Core/DSP/Jit/arm64/DSPJitRegCache.h"
+
+class PointerWrap;
+
+namespace DSP
+{
+struct SDSP;
+
+namespace JIT::arm64
+{
+// Block-based DSP recompiler for AArch64 hosts.
+//
+// Blocks are laid out like in the x64 recompiler, and the same analyzer flags decide where blocks
+// end, where loops and exceptions are checked and which blocks are idle loops. Instructions
+// without an AArch64 implementation are run by calling into the interpreter from the block.
+class DSPEmitter final : public JIT::DSPEmitter, public Arm64Gen::ARM64CodeBlock
+{
+public:
+  // Holds a pointer to the SDSP state while compiled code runs.
+  static constexpr Arm64Gen::ARM64Reg STATE_REG = Arm64Gen::ARM64Reg::X28;
+
+  explicit DSPEmitter(DSPCore& dsp);
+  ~DSPEmitter() override;
+
+  u16 RunCycles(u16 cycles) override;
+  void DoState(PointerWrap& p) override;
+  void ClearIRAM() override;
+
+  void nop(const UDSPInstruction opc) {}
+
+  // Commands
+  void dar(UDSPInstruction opc);
+  void iar(UDSPInstruction opc);
+  void sbclr(UDSPInstruction opc);
+  void sbset(UDSPInstruction opc);
+  void srbith(UDSPInstruction opc);
+  void lri(UDSPInstruction opc);
+  void lris(UDSPInstruction opc);
+  void mrr(UDSPInstruction opc);
+  void nx(UDSPInstruction opc) {}
+
+  // Branch
+  void jmp(UDSPInstruction opc);
+  void jmpr(UDSPInstruction opc);
+
+  // Load/Store
+  void lr(UDSPInstruction opc);
+  void sr(UDSPInstruction opc);
+  void si(UDSPInstruction opc);
+
+private:
+  using DSPCompiledCode = u32 (*)();
+  using Block = const u8*;
+
+  // The emitter emits calls to this function. It's present here
+  // within the class itself to allow access to member variables.
+  static void CompileCurrent(DSPEmitter& emitter);
+
+  void EmitInstruction(UDSPInstruction inst);
+  void ClearIRAMandDSPJITCodespaceReset();
+
+  void CompileDispatcher();
+  Block CompileStub();
+  void Compile(u16 start_addr);
+
+  void FallBackToInterpreter(UDSPInstruction inst);
+
+  // Leaves the block, returning the number of cycles it took to the dispatcher. The PC must have
+  // been written already. Doesn't change the register cache state.
+  void WriteBlockExit();
+  u16 GetBlockExitCycles() const;
+
+  // Branch helpers
+  void HandleLoop();
+
+  // Register helpers
+  void setCompileSR(u16 bit);
+  void clrCompileSR(u16 bit);
+  void checkExceptions(u32 retval);
+
+  // Whether a register can be read or written without any side effect on other registers, so
+  // that instructions which do so can be compiled without falling back to the interpreter.
+  static bool CanReadRegDirectly(int reg);
+  static bool CanWriteRegDirectly(int reg);
+  void dsp_op_write_reg(int reg, Arm64Gen::ARM64Reg host_sreg);
+  void dsp_op_write_reg_imm(int reg, u16 val);
+
+  // Memory helper functions
+  void increment_addr_reg(int reg);
+  void decrement_addr_reg(int reg);
+  // Whether data memory at addr can be accessed with a plain load or store. The immediate access
+  // helpers below may only be used for such addresses.
+  static bool IsDirectDMEMAddress(u16 addr, bool write);
+  void dmem_read_imm(Arm64Gen::ARM64Reg host_dreg, u16 addr);
+  void dmem_write_imm(u16 addr, Arm64Gen::ARM64Reg host_sreg);
+
+  // SDSP memory offset helpers
+  static s32 SDSP_pc();
+  static s32 SDSP_exceptions();
+  static s32 SDSP_control_reg();
+  static s32 SDSP_external_interrupt_waiting();
+  static s32 SDSP_r_st(size_t index);
+  static s32 SDSP_dram();
+  static s32 SDSP_coef();
+
+  static constexpr size_t MAX_BLOCKS = 0x10000;
+
+  DSPJitRegCache m_gpr{*this};
+
+  u16 m_compile_pc = 0;
+  u16 m_start_address = 0;
+
+  std::vector<DSPCompiledCode> m_blocks;
+  std::vector<u16> m_block_size;
+
+  u16 m_cycles_left = 0;
+
+  // CALL this to start the dispatcher
+  const u8* m_enter_dispatcher = nullptr;
+  const u8* m_return_dispatcher = nullptr;
+  const u8* m_stub_entry_point = nullptr;
+
+  DSPCore& m_dsp_core;
+};
+}  // namespace JIT::arm64
+}  // namespace DSP
@@ -0,0 +1,67 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCore.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+// JMP addressA
+// 0000 0010 1001 1111
+// aaaa aaaa aaaa aaaa
+// Jump unconditionally to addressA. The conditional forms go through the interpreter.
+void DSPEmitter::jmp(const UDSPInstruction opc)
+{
+  const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
+  MOVI2R(ARM64Reg::W0, dest);
+  STRH(IndexType::Unsigned, ARM64Reg::W0, STATE_REG, SDSP_pc());
+  WriteBlockExit();
+}
+
+// JMPR $R
+// 0001 0111 rrr0 1111
+// Jump unconditionally to the address in register $R. The conditional forms go through the
+// interpreter.
+void DSPEmitter::jmpr(const UDSPInstruction opc)
+{
+  // reg can only be DSP_REG_ARx and DSP_REG_IXx, which are all cacheable.
+  const u8 reg = (opc >> 5) & 0x7;
+  STRH(IndexType::Unsigned, m_gpr.BindReg(reg, DSPJitRegCache::Access::Read), STATE_REG,
+       SDSP_pc());
+  WriteBlockExit();
+}
+
+static void EndLoopThunk(SDSP& state)
+{
+  state.PopStack(StackRegister::Call);
+  state.PopStack(StackRegister::LoopAddress);
+  state.PopStack(StackRegister::LoopCounter);
+}
+
+// Expects the loop address ($st2) in W0 and the loop counter ($st3) in W1, neither being zero.
+void DSPEmitter::HandleLoop()
+{
+  CMPI2R(ARM64Reg::W0, static_cast<u16>(m_compile_pc - 1), ARM64Reg::W2);
+  FixupBranch not_loop_end = B(CC_NEQ);
+
+  SUB(ARM64Reg::W1, ARM64Reg::W1, 1);
+  STRH(IndexType::Unsigned, ARM64Reg::W1, STATE_REG, SDSP_r_st(3));
+  FixupBranch end_of_loop = CBZ(ARM64Reg::W1);
+
+  LDRH(IndexType::Unsigned, ARM64Reg::W2, STATE_REG, SDSP_r_st(0));
+  STRH(IndexType::Unsigned, ARM64Reg::W2, STATE_REG, SDSP_pc());
+  FixupBranch loop_updated = B();
+
+  SetJumpTarget(end_of_loop);
+  ABI_CallFunction(EndLoopThunk, &m_dsp_core.DSPState());
+
+  SetJumpTarget(loop_updated);
+  SetJumpTarget(not_loop_end);
+}
+}  // namespace DSP::JIT::arm64
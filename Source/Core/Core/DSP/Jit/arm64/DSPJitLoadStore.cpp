@@ -0,0 +1,71 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCore.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+// LR $D, @M
+// 0000 0000 110d dddd
+// mmmm mmmm mmmm mmmm
+// Move value from data memory pointed by address M to register $D.
+void DSPEmitter::lr(const UDSPInstruction opc)
+{
+  const u8 reg = opc & 0x1F;
+  const u16 address = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
+
+  if (!CanWriteRegDirectly(reg) || !IsDirectDMEMAddress(address, false))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  dmem_read_imm(ARM64Reg::W1, address);
+  dsp_op_write_reg(reg, ARM64Reg::W1);
+}
+
+// SR @M, $S
+// 0000 0000 111s ssss
+// mmmm mmmm mmmm mmmm
+// Store value from register $S to a memory pointed by address M.
+void DSPEmitter::sr(const UDSPInstruction opc)
+{
+  const u8 reg = opc & 0x1F;
+  const u16 address = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
+
+  if (!CanReadRegDirectly(reg) || !IsDirectDMEMAddress(address, true))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  dmem_write_imm(address, m_gpr.BindReg(reg, DSPJitRegCache::Access::Read));
+}
+
+// SI @M, #I
+// 0001 0110 mmmm mmmm
+// iiii iiii iiii iiii
+// Store 16-bit immediate value I to a memory location pointed by address
+// M (M is 8-bit value sign extended).
+void DSPEmitter::si(const UDSPInstruction opc)
+{
+  const u16 address = static_cast<u16>(static_cast<s8>(opc));
+  const u16 imm = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
+
+  if (!IsDirectDMEMAddress(address, true))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  MOVI2R(ARM64Reg::W1, imm);
+  dmem_write_imm(address, ARM64Reg::W1);
+}
+}  // namespace DSP::JIT::arm64
@@ -0,0 +1,155 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCore.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+// MRR $D, $S
+// 0001 11dd ddds ssss
+// Move value from register $S to register $D.
+void DSPEmitter::mrr(const UDSPInstruction opc)
+{
+  const u8 sreg = opc & 0x1f;
+  const u8 dreg = (opc >> 5) & 0x1f;
+
+  if (!CanReadRegDirectly(sreg) || !CanWriteRegDirectly(dreg))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  dsp_op_write_reg(dreg, m_gpr.BindReg(sreg, DSPJitRegCache::Access::Read));
+}
+
+// LRI $D, #I
+// 0000 0000 100d dddd
+// iiii iiii iiii iiii
+// Load immediate value I to register $D.
+void DSPEmitter::lri(const UDSPInstruction opc)
+{
+  const u8 reg = opc & 0x1F;
+
+  if (!CanWriteRegDirectly(reg))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  dsp_op_write_reg_imm(reg, m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1));
+}
+
+// LRIS $(0x18+D), #I
+// 0000 1ddd iiii iiii
+// Load immediate value I (8-bit sign extended) to accumulator register.
+void DSPEmitter::lris(const UDSPInstruction opc)
+{
+  const u8 reg = ((opc >> 8) & 0x7) + DSP_REG_AXL0;
+
+  if (!CanWriteRegDirectly(reg))
+  {
+    FallBackToInterpreter(opc);
+    return;
+  }
+
+  dsp_op_write_reg_imm(reg, static_cast<u16>(static_cast<s8>(opc)));
+}
+
+//----
+
+// DAR $arD
+// 0000 0000 0000 01dd
+// Decrement address register $arD.
+void DSPEmitter::dar(const UDSPInstruction opc)
+{
+  decrement_addr_reg(opc & 0x3);
+}
+
+// IAR $arD
+// 0000 0000 0000 10dd
+// Increment address register $arD.
+void DSPEmitter::iar(const UDSPInstruction opc)
+{
+  increment_addr_reg(opc & 0x3);
+}
+
+//----
+
+void DSPEmitter::setCompileSR(u16 bit)
+{
+  const ARM64Reg sr_reg = m_gpr.BindReg(DSP_REG_SR, DSPJitRegCache::Access::ReadWrite);
+  ORR(sr_reg, sr_reg, LogicalImm(bit, GPRSize::B32));
+}
+
+void DSPEmitter::clrCompileSR(u16 bit)
+{
+  const ARM64Reg sr_reg = m_gpr.BindReg(DSP_REG_SR, DSPJitRegCache::Access::ReadWrite);
+  AND(sr_reg, sr_reg, LogicalImm(~u32{bit}, GPRSize::B32));
+}
+
+// SBCLR #I
+// 0001 0011 aaaa aiii
+// Clear bit of status register $sr. Bit number is calculated by adding 6 to immediate value I;
+// thus, bits 6 through 13 (LZ through AM) can be cleared with this instruction.
+void DSPEmitter::sbclr(const UDSPInstruction opc)
+{
+  const u8 bit = (opc & 0x7) + 6;
+
+  clrCompileSR(1 << bit);
+}
+
+// SBSET #I
+// 0001 0010 aaaa aiii
+// Set bit of status register $sr. Bit number is calculated by adding 6 to immediate value I;
+// thus, bits 6 through 13 (LZ through AM) can be set with this instruction.
+void DSPEmitter::sbset(const UDSPInstruction opc)
+{
+  const u8 bit = (opc & 0x7) + 6;
+
+  setCompileSR(1 << bit);
+}
+
+// 1000 1bbb xxxx xxxx, bbb >= 010
+// This is a bunch of flag setters, flipping bits in SR.
+void DSPEmitter::srbith(const UDSPInstruction opc)
+{
+  switch ((opc >> 8) & 0xf)
+  {
+  // M0/M2 change the multiplier mode (it can multiply by 2 for free).
+  case 0xa:  // M2
+    clrCompileSR(SR_MUL_MODIFY);
+    break;
+  case 0xb:  // M0
+    setCompileSR(SR_MUL_MODIFY);
+    break;
+
+  // If set, treat multiplicands as unsigned.
+  // If clear, treat them as signed.
+  case 0xc:  // CLR15
+    clrCompileSR(SR_MUL_UNSIGNED);
+    break;
+  case 0xd:  // SET15
+    setCompileSR(SR_MUL_UNSIGNED);
+    break;
+
+  // Automatic 40-bit sign extension when loading ACx.M.
+  case 0xe:  // SET16 (CLR40)
+    clrCompileSR(SR_40_MODE_BIT);
+    break;
+
+  case 0xf:  // SET40
+    setCompileSR(SR_40_MODE_BIT);
+    break;
+
+  default:
+    break;
+  }
+}
+}  // namespace DSP::JIT::arm64
@@ -0,0 +1,172 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPJitRegCache.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+static size_t GetRegOffset(int reg)
+{
+  switch (reg)
+  {
+  case DSP_REG_AR0:
+  case DSP_REG_AR1:
+  case DSP_REG_AR2:
+  case DSP_REG_AR3:
+    return offsetof(SDSP, r.ar) + sizeof(SDSP::r.ar[0]) * (reg - DSP_REG_AR0);
+  case DSP_REG_IX0:
+  case DSP_REG_IX1:
+  case DSP_REG_IX2:
+  case DSP_REG_IX3:
+    return offsetof(SDSP, r.ix) + sizeof(SDSP::r.ix[0]) * (reg - DSP_REG_IX0);
+  case DSP_REG_WR0:
+  case DSP_REG_WR1:
+  case DSP_REG_WR2:
+  case DSP_REG_WR3:
+    return offsetof(SDSP, r.wr) + sizeof(SDSP::r.wr[0]) * (reg - DSP_REG_WR0);
+  case DSP_REG_CR:
+    return offsetof(SDSP, r.cr);
+  case DSP_REG_SR:
+    return offsetof(SDSP, r.sr);
+  case DSP_REG_PRODL:
+    return offsetof(SDSP, r.prod.l);
+  case DSP_REG_PRODM:
+    return offsetof(SDSP, r.prod.m);
+  case DSP_REG_PRODH:
+    return offsetof(SDSP, r.prod.h);
+  case DSP_REG_PRODM2:
+    return offsetof(SDSP, r.prod.m2);
+  case DSP_REG_AXL0:
+  case DSP_REG_AXL1:
+    return offsetof(SDSP, r.ax[0].l) + sizeof(SDSP::r.ax[0]) * (reg - DSP_REG_AXL0);
+  case DSP_REG_AXH0:
+  case DSP_REG_AXH1:
+    return offsetof(SDSP, r.ax[0].h) + sizeof(SDSP::r.ax[0]) * (reg - DSP_REG_AXH0);
+  case DSP_REG_ACL0:
+  case DSP_REG_ACL1:
+    return offsetof(SDSP, r.ac[0].l) + sizeof(SDSP::r.ac[0]) * (reg - DSP_REG_ACL0);
+  case DSP_REG_ACM0:
+  case DSP_REG_ACM1:
+    return offsetof(SDSP, r.ac[0].m) + sizeof(SDSP::r.ac[0]) * (reg - DSP_REG_ACM0);
+  default:
+    ASSERT_MSG(DSPLLE, false, "Register {} can't be cached", reg);
+    return 0;
+  }
+}
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+DSPJitRegCache::DSPJitRegCache(DSPEmitter& emitter) : m_emitter(emitter)
+{
+}
+
+bool DSPJitRegCache::IsCacheable(int reg)
+{
+  if (reg < 0 || reg > DSP_REG_ACM1)
+    return false;
+
+  switch (reg)
+  {
+  case DSP_REG_ST0:
+  case DSP_REG_ST1:
+  case DSP_REG_ST2:
+  case DSP_REG_ST3:
+  case DSP_REG_ACH0:
+  case DSP_REG_ACH1:
+    return false;
+  default:
+    return true;
+  }
+}
+
+ARM64Reg DSPJitRegCache::BindReg(int reg, Access access)
+{
+  ASSERT(IsCacheable(reg));
+
+  const auto it = std::find_if(m_host_regs.begin(), m_host_regs.end(),
+                               [reg](const CachedReg& cached) { return cached.guest_reg == reg; });
+
+  size_t index;
+  if (it != m_host_regs.end())
+  {
+    index = static_cast<size_t>(it - m_host_regs.begin());
+  }
+  else
+  {
+    index = AllocateHostReg();
+    m_host_regs[index].guest_reg = reg;
+    m_host_regs[index].dirty = false;
+    if (access != Access::Write)
+    {
+      m_emitter.LDRH(IndexType::Unsigned, HOST_REGS[index], DSPEmitter::STATE_REG,
+                     static_cast<s32>(GetRegOffset(reg)));
+    }
+  }
+
+  CachedReg& cached = m_host_regs[index];
+  cached.last_use = ++m_use_counter;
+  if (access != Access::Read)
+    cached.dirty = true;
+
+  return HOST_REGS[index];
+}
+
+size_t DSPJitRegCache::AllocateHostReg()
+{
+  const auto free_reg = std::find_if(m_host_regs.begin(), m_host_regs.end(),
+                                     [](const CachedReg& cached) { return cached.guest_reg < 0; });
+  if (free_reg != m_host_regs.end())
+    return static_cast<size_t>(free_reg - m_host_regs.begin());
+
+  // Evict the least recently used register.
+  const auto lru = std::min_element(
+      m_host_regs.begin(), m_host_regs.end(),
+      [](const CachedReg& a, const CachedReg& b) { return a.last_use < b.last_use; });
+  const size_t index = static_cast<size_t>(lru - m_host_regs.begin());
+  StoreReg(*lru, HOST_REGS[index]);
+  *lru = {};
+  return index;
+}
+
+void DSPJitRegCache::StoreReg(const CachedReg& cached_reg, ARM64Reg host_reg)
+{
+  if (cached_reg.guest_reg < 0 || !cached_reg.dirty)
+    return;
+
+  m_emitter.STRH(IndexType::Unsigned, host_reg, DSPEmitter::STATE_REG,
+                 static_cast<s32>(GetRegOffset(cached_reg.guest_reg)));
+}
+
+void DSPJitRegCache::Flush()
+{
+  StoreDirtyRegs();
+  Reset();
+}
+
+void DSPJitRegCache::StoreDirtyRegs()
+{
+  for (size_t i = 0; i < m_host_regs.size(); ++i)
+    StoreReg(m_host_regs[i], HOST_REGS[i]);
+}
+
+void DSPJitRegCache::Reset()
+{
+  m_host_regs.fill({});
+}
+}  // namespace DSP::JIT::arm64
@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "Common/Arm64Emitter.h"
+#include "Common/CommonTypes.h"
+
+namespace DSP::JIT::arm64
+{
+class DSPEmitter;
+
+// Keeps 16-bit DSP registers in callee-saved host registers while a block runs.
+//
+// Guest registers are loaded the first time they are used and written back when the cache is
+// flushed. Anything that accesses the DSP state in memory (interpreter fallbacks, exception checks,
+// block exits) must be preceded by a flush. The stack registers, whose accesses push and pop, and
+// $ac0.h/$ac1.h, which are wider in memory, are never cached.
+class DSPJitRegCache
+{
+public:
+  enum class Access
+  {
+    Read,
+    Write,
+    ReadWrite,
+  };
+
+  explicit DSPJitRegCache(DSPEmitter& emitter);
+
+  static bool IsCacheable(int reg);
+
+  // Returns a host register holding the zero-extended value of reg. Unless access is Read, the
+  // register is marked as modified, and the caller must leave a zero-extended 16-bit value in it.
+  // The returned register stays valid until the next flush, or until seven other registers have
+  // been bound since.
+  Arm64Gen::ARM64Reg BindReg(int reg, Access access);
+
+  // Writes back all modified registers and forgets all bindings.
+  void Flush();
+
+  // Writes back all modified registers without changing the state of the cache. Used on paths
+  // which leave the block, so that the code following the branch can keep using the bindings.
+  void StoreDirtyRegs();
+
+  // Forgets all bindings without writing anything back. Only valid when no code has been emitted
+  // since the last flush, e.g. at the start of a block.
+  void Reset();
+
+private:
+  struct CachedReg
+  {
+    int guest_reg = -1;
+    bool dirty = false;
+    u32 last_use = 0;
+  };
+
+  static constexpr std::array<Arm64Gen::ARM64Reg, 8> HOST_REGS{
+      Arm64Gen::ARM64Reg::W19, Arm64Gen::ARM64Reg::W20, Arm64Gen::ARM64Reg::W21,
+      Arm64Gen::ARM64Reg::W22, Arm64Gen::ARM64Reg::W23, Arm64Gen::ARM64Reg::W24,
+      Arm64Gen::ARM64Reg::W25, Arm64Gen::ARM64Reg::W26,
+  };
+
+  size_t AllocateHostReg();
+  void StoreReg(const CachedReg& cached_reg, Arm64Gen::ARM64Reg host_reg);
+
+  std::array<CachedReg, HOST_REGS.size()> m_host_regs{};
+  DSPEmitter& m_emitter;
+  u32 m_use_counter = 0;
+};
+}  // namespace DSP::JIT::arm64
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPJitTables.h"
+
+#include <array>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPTables.h"
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+namespace DSP::JIT::arm64
+{
+struct JITOpInfo
+{
+  u16 opcode;
+  u16 opcode_mask;
+  JITFunction function;
+};
+
+// Instructions which aren't listed here are run through the interpreter.
+// clang-format off
+constexpr std::array<JITOpInfo, 16> s_opcodes =
+{{
+  {0x0000, 0xfffc, &DSPEmitter::nop},
+
+  {0x0004, 0xfffc, &DSPEmitter::dar},
+  {0x0008, 0xfffc, &DSPEmitter::iar},
+
+  {0x029f, 0xffff, &DSPEmitter::jmp},
+  {0x170f, 0xff1f, &DSPEmitter::jmpr},
+
+  {0x1200, 0xff00, &DSPEmitter::sbclr},
+  {0x1300, 0xff00, &DSPEmitter::sbset},
+
+  {0x0080, 0xffe0, &DSPEmitter::lri},
+  {0x00c0, 0xffe0, &DSPEmitter::lr},
+  {0x00e0, 0xffe0, &DSPEmitter::sr},
+
+  {0x1c00, 0xfc00, &DSPEmitter::mrr},
+
+  {0x1600, 0xff00, &DSPEmitter::si},
+
+  {0x0800, 0xf800, &DSPEmitter::lris},
+
+  // 8
+  {0x8000, 0xf700, &DSPEmitter::nx},
+  {0x8a00, 0xfe00, &DSPEmitter::srbith},
+  {0x8c00, 0xfc00, &DSPEmitter::srbith},
+}};
+// clang-format on
+
+namespace
+{
+std::array<JITFunction, 65536> s_op_table;
+bool s_tables_initialized = false;
+}  // Anonymous namespace
+
+JITFunction GetOp(UDSPInstruction inst)
+{
+  return s_op_table[inst];
+}
+
+void InitInstructionTables()
+{
+  if (s_tables_initialized)
+    return;
+
+  for (size_t i = 0; i < s_op_table.size(); i++)
+  {
+    s_op_table[i] = nullptr;
+
+    const auto iter = FindByOpcode(static_cast<UDSPInstruction>(i), s_opcodes);
+    if (iter == s_opcodes.cend())
+      continue;
+
+    s_op_table[i] = iter->function;
+  }
+
+  s_tables_initialized = true;
+}
+}  // namespace DSP::JIT::arm64
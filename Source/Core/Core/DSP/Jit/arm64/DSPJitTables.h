@@ -0,0 +1,16 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Core/DSP/DSPCommon.h"
+
+namespace DSP::JIT::arm64
+{
+class DSPEmitter;
+
+using JITFunction = void (DSPEmitter::*)(UDSPInstruction);
+
+JITFunction GetOp(UDSPInstruction inst);
+void InitInstructionTables();
+}  // namespace DSP::JIT::arm64
@@ -0,0 +1,140 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/DSP/Jit/arm64/DSPEmitter.h"
+
+#include "Common/Arm64Emitter.h"
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+
+#include "Core/DSP/DSPCore.h"
+
+using namespace Arm64Gen;
+
+namespace DSP::JIT::arm64
+{
+// Increment addr register, wrapping around according to the corresponding wr register
+void DSPEmitter::increment_addr_reg(int reg)
+{
+  const ARM64Reg wr = m_gpr.BindReg(DSP_REG_WR0 + reg, DSPJitRegCache::Access::Read);
+  const ARM64Reg ar = m_gpr.BindReg(DSP_REG_AR0 + reg, DSPJitRegCache::Access::ReadWrite);
+
+  // u32 nar = ar + 1;
+  // if ((nar ^ ar) > ((wr | 1) << 1))
+  //   nar -= wr + 1;
+  ADD(ARM64Reg::W0, ar, 1);
+  EOR(ARM64Reg::W1, ARM64Reg::W0, ar);
+  ORR(ARM64Reg::W2, wr, LogicalImm(1, GPRSize::B32));
+  CMP(ARM64Reg::W1, ARM64Reg::W2, ArithOption(ARM64Reg::W2, ShiftType::LSL, 1));
+  ADD(ARM64Reg::W2, wr, 1);
+  SUB(ARM64Reg::W2, ARM64Reg::W0, ARM64Reg::W2);
+  CSEL(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W0, CC_HI);
+  UXTH(ar, ARM64Reg::W0);
+}
+
+// Decrement addr register, wrapping around according to the corresponding wr register
+void DSPEmitter::decrement_addr_reg(int reg)
+{
+  const ARM64Reg wr = m_gpr.BindReg(DSP_REG_WR0 + reg, DSPJitRegCache::Access::Read);
+  const ARM64Reg ar = m_gpr.BindReg(DSP_REG_AR0 + reg, DSPJitRegCache::Access::ReadWrite);
+
+  // u32 nar = ar + wr;
+  // if (((nar ^ ar) & ((wr | 1) << 1)) > wr)
+  //   nar -= wr + 1;
+  ADD(ARM64Reg::W0, ar, wr);
+  EOR(ARM64Reg::W1, ARM64Reg::W0, ar);
+  ORR(ARM64Reg::W2, wr, LogicalImm(1, GPRSize::B32));
+  AND(ARM64Reg::W1, ARM64Reg::W1, ARM64Reg::W2, ArithOption(ARM64Reg::W2, ShiftType::LSL, 1));
+  CMP(ARM64Reg::W1, wr);
+  ADD(ARM64Reg::W2, wr, 1);
+  SUB(ARM64Reg::W2, ARM64Reg::W0, ARM64Reg::W2);
+  CSEL(ARM64Reg::W0, ARM64Reg::W2, ARM64Reg::W0, CC_HI);
+  UXTH(ar, ARM64Reg::W0);
+}
+
+bool DSPEmitter::CanReadRegDirectly(int reg)
+{
+  // Reads from $ac0.m and $ac1.m saturate in 40-bit mode.
+  if (reg == DSP_REG_ACM0 || reg == DSP_REG_ACM1)
+    return false;
+
+  return DSPJitRegCache::IsCacheable(reg);
+}
+
+bool DSPEmitter::CanWriteRegDirectly(int reg)
+{
+  // Writes to $ac0.m and $ac1.m extend the whole accumulator in 40-bit mode, and some bits of $sr
+  // can't be written.
+  if (reg == DSP_REG_ACM0 || reg == DSP_REG_ACM1 || reg == DSP_REG_SR)
+    return false;
+
+  return DSPJitRegCache::IsCacheable(reg);
+}
+
+void DSPEmitter::dsp_op_write_reg(int reg, ARM64Reg host_sreg)
+{
+  const ARM64Reg host_dreg = m_gpr.BindReg(reg, DSPJitRegCache::Access::Write);
+
+  switch (reg)
+  {
+  case DSP_REG_CR:
+  case DSP_REG_PRODH:
+    // Only the low 8 bits of these registers exist.
+    AND(host_dreg, host_sreg, LogicalImm(0xff, GPRSize::B32));
+    break;
+  default:
+    if (host_dreg != host_sreg)
+      MOV(host_dreg, host_sreg);
+    break;
+  }
+}
+
+void DSPEmitter::dsp_op_write_reg_imm(int reg, u16 val)
+{
+  const ARM64Reg host_dreg = m_gpr.BindReg(reg, DSPJitRegCache::Access::Write);
+
+  switch (reg)
+  {
+  case DSP_REG_CR:
+  case DSP_REG_PRODH:
+    MOVI2R(host_dreg, val & 0xff);
+    break;
+  default:
+    MOVI2R(host_dreg, val);
+    break;
+  }
+}
+
+bool DSPEmitter::IsDirectDMEMAddress(u16 addr, bool write)
+{
+  // The coefficient ROM can only be read, and the hardware registers have side effects.
+  return (addr >> 12) == 0x0 || (!write && (addr >> 12) == 0x1);
+}
+
+void DSPEmitter::dmem_read_imm(ARM64Reg host_dreg, u16 addr)
+{
+  ASSERT(IsDirectDMEMAddress(addr, false));
+
+  if ((addr >> 12) == 0x0)
+  {
+    LDR(IndexType::Unsigned, ARM64Reg::X0, STATE_REG, SDSP_dram());
+    LDRH(IndexType::Unsigned, host_dreg, ARM64Reg::X0,
+         static_cast<s32>((addr & DSP_DRAM_MASK) * sizeof(u16)));
+  }
+  else
+  {
+    LDR(IndexType::Unsigned, ARM64Reg::X0, STATE_REG, SDSP_coef());
+    LDRH(IndexType::Unsigned, host_dreg, ARM64Reg::X0,
+         static_cast<s32>((addr & DSP_COEF_MASK) * sizeof(u16)));
+  }
+}
+
+void DSPEmitter::dmem_write_imm(u16 addr, ARM64Reg host_sreg)
+{
+  ASSERT(IsDirectDMEMAddress(addr, true));
+
+  LDR(IndexType::Unsigned, ARM64Reg::X0, STATE_REG, SDSP_dram());
+  STRH(IndexType::Unsigned, host_sreg, ARM64Reg::X0,
+         static_cast<s32>((addr & DSP_DRAM_MASK) * sizeof(u16)));
+}
+}  // namespace DSP::JIT::arm64
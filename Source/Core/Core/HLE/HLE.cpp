@@ -13,6 +13,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/GeckoCode.h"
+#include "Core/HLE/HLE_Lib.h"
 #include "Core/HLE/HLE_Misc.h"
 #include "Core/HLE/HLE_OS.h"
 #include "Core/HW/Memmap.h"
@@ -27,7 +28,7 @@ namespace HLE
 static std::map<u32, u32> s_hooked_addresses;
 
 // clang-format off
-constexpr std::array<Hook, 23> os_patches{{
+constexpr std::array<Hook, 27> os_patches{{
     // Placeholder, os_patches[0] is the "non-existent function" index
     {"FAKE_TO_SKIP_0",               HLE_Misc::UnimplementedFunction,       HookType::Replace, HookFlag::Generic},
 
@@ -57,6 +58,12 @@ constexpr std::array<Hook, 23> os_patches{{
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Hot libc/SDK routines
+    {"memcpy",                       HLE_Lib::HLE_memcpy,                   HookType::Replace, HookFlag::Library},
+    {"memset",                       HLE_Lib::HLE_memset,                   HookType::Replace, HookFlag::Library},
+    {"DCFlushRange",                 HLE_Lib::HLE_DCFlushRange,             HookType::Replace, HookFlag::Library},
+    {"DCStoreRange",                 HLE_Lib::HLE_DCStoreRange,             HookType::Replace, HookFlag::Library},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Fixed} // apploader needs OSReport-like function
@@ -134,8 +141,20 @@ void PatchFunctions(Core::System& system)
     if (os_patches[i].flags == HookFlag::Fixed)
       continue;
 
+    // Library hooks are opt-in
+    const bool is_library = os_patches[i].flags == HookFlag::Library;
+    if (is_library && !Config::Get(Config::MAIN_HLE_LIBRARY_FUNCTIONS))
+      continue;
+
     for (const auto& symbol : ppc_symbol_db.GetSymbolsFromName(os_patches[i].name))
     {
+      if (is_library && !HLE_Lib::IsValidReplacement(system, os_patches[i].name, *symbol))
+      {
+        WARN_LOG_FMT(OSHLE, "Not patching {} {:08x}: the code doesn't match", os_patches[i].name,
+                     symbol->address);
+        continue;
+      }
+
       for (u32 addr = symbol->address; addr < symbol->address + symbol->size; addr += 4)
       {
         s_hooked_addresses[addr] = i;
@@ -36,6 +36,7 @@ enum class HookFlag
   Generic,  // Miscellaneous function
   Debug,    // Debug output function
   Fixed,    // An arbitrary hook mapped to a fixed address instead of a symbol
+  Library,  // Native implementation of a library function, only used if the guest code matches
 };
 
 struct Hook
@@ -0,0 +1,269 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HLE/HLE_Lib.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+#include "Common/SymbolDB.h"
+#include "Core/Core.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/MMU.h"
+#include "Core/PowerPC/PPCTables.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace HLE_Lib
+{
+namespace
+{
+// Returns a host pointer for [address, address + size) if the range is inside a single BAT block
+// mapped to RAM (and therefore physically contiguous) and can be accessed without any checks.
+u8* GetRAMPointer(Core::System& system, u32 address, u32 size)
+{
+  if ((address >> PowerPC::BAT_INDEX_SHIFT) != ((address + size - 1) >> PowerPC::BAT_INDEX_SHIFT))
+    return nullptr;
+
+  auto& mmu = system.GetMMU();
+  if (!mmu.IsOptimizableRAMAddress(address, 8))
+    return nullptr;
+
+  const std::optional<u32> physical_address = mmu.GetTranslatedAddress(address);
+  if (!physical_address)
+    return nullptr;
+
+  return system.GetMemory().GetPointerForRange(*physical_address, size);
+}
+
+// Writes through pointers from GetRAMPointer bypass the fastmem views, so they have to be reported.
+void NotifyRAMWrite(Core::System& system, u32 address, u32 size)
+{
+  if (const std::optional<u32> physical_address = system.GetMMU().GetTranslatedAddress(address))
+    system.GetMemory().NotifyWrite(*physical_address, size);
+}
+
+// The largest chunk starting at address which doesn't cross a BAT block boundary.
+u32 ChunkSize(u32 address, u32 size)
+{
+  return std::min(size, PowerPC::BAT_PAGE_SIZE - (address & (PowerPC::BAT_PAGE_SIZE - 1)));
+}
+
+void Return(PowerPC::PowerPCState& ppc_state)
+{
+  ppc_state.npc = LR(ppc_state);
+}
+
+void DataCacheRange(const Core::CPUThreadGuard& guard, bool flush)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  const u32 address = ppc_state.gpr[3];
+  const u32 size = ppc_state.gpr[4];
+
+  if (size != 0)
+  {
+    const u32 num_lines = ((address & 0x1f) + size + 0x1f) >> 5;
+    if (!ppc_state.m_enable_dcache)
+    {
+      // Same heuristic as dcbf/dcbst: invalidate the JIT cache to make up for the lack of
+      // precise icache emulation.
+      system.GetJitInterface().InvalidateICacheLines(address, num_lines);
+    }
+    else
+    {
+      auto& mmu = system.GetMMU();
+      for (u32 i = 0; i < num_lines; ++i)
+      {
+        const u32 line_address = (address & ~0x1f) + i * 32;
+        if (flush)
+          mmu.FlushDCacheLine(line_address);
+        else
+          mmu.StoreDCacheLine(line_address);
+      }
+    }
+  }
+
+  Return(ppc_state);
+}
+
+struct ExpectedShape
+{
+  std::string_view name;
+  bool has_loads;
+  bool has_stores;
+  // SUBOP10 of the data cache instruction (with OPCD 31) the function must use, or 0 for none.
+  u32 cache_subop;
+};
+
+constexpr std::array<ExpectedShape, 4> expected_shapes{{
+    {"memcpy", true, true, 0},
+    {"memset", false, true, 0},
+    {"DCFlushRange", false, false, 86},  // dcbf
+    {"DCStoreRange", false, false, 54},  // dcbst
+}};
+
+// The SDK versions of these functions are a few dozen instructions at most.
+constexpr u32 MAX_FUNCTION_SIZE = 0x400;
+}  // namespace
+
+void HLE_memcpy(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  u32 dst = ppc_state.gpr[3];
+  u32 src = ppc_state.gpr[4];
+  u32 size = ppc_state.gpr[5];
+
+  while (size != 0)
+  {
+    const u32 chunk = std::min(ChunkSize(dst, size), ChunkSize(src, size));
+    u8* const host_dst = GetRAMPointer(system, dst, chunk);
+    const u8* const host_src = GetRAMPointer(system, src, chunk);
+    if (host_dst && host_src)
+    {
+      if (host_dst >= host_src + chunk || host_src >= host_dst + chunk)
+      {
+        std::memcpy(host_dst, host_src, chunk);
+      }
+      else
+      {
+        // Overlapping copies have to behave like the forward copy loop of the guest function.
+        for (u32 i = 0; i < chunk; ++i)
+          host_dst[i] = host_src[i];
+      }
+      NotifyRAMWrite(system, dst, chunk);
+    }
+    else
+    {
+      for (u32 i = 0; i < chunk; ++i)
+        PowerPC::MMU::HostWrite_U8(guard, PowerPC::MMU::HostRead_U8(guard, src + i), dst + i);
+    }
+
+    dst += chunk;
+    src += chunk;
+    size -= chunk;
+  }
+
+  // r3 (the destination) is also the return value.
+  Return(ppc_state);
+}
+
+void HLE_memset(const Core::CPUThreadGuard& guard)
+{
+  auto& system = guard.GetSystem();
+  auto& ppc_state = system.GetPPCState();
+  u32 dst = ppc_state.gpr[3];
+  const u8 value = static_cast<u8>(ppc_state.gpr[4]);
+  u32 size = ppc_state.gpr[5];
+
+  while (size != 0)
+  {
+    const u32 chunk = ChunkSize(dst, size);
+    if (u8* const host_dst = GetRAMPointer(system, dst, chunk))
+    {
+      std::memset(host_dst, value, chunk);
+      NotifyRAMWrite(system, dst, chunk);
+    }
+    else
+    {
+      for (u32 i = 0; i < chunk; ++i)
+        PowerPC::MMU::HostWrite_U8(guard, value, dst + i);
+    }
+
+    dst += chunk;
+    size -= chunk;
+  }
+
+  // r3 (the destination) is also the return value.
+  Return(ppc_state);
+}
+
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard)
+{
+  DataCacheRange(guard, true);
+}
+
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard)
+{
+  DataCacheRange(guard, false);
+}
+
+bool IsValidReplacement(Core::System& system, std::string_view name, const Common::Symbol& symbol)
+{
+  const auto shape = std::find_if(expected_shapes.begin(), expected_shapes.end(),
+                                  [&](const ExpectedShape& s) { return s.name == name; });
+  if (shape == expected_shapes.end())
+    return false;
+
+  if (symbol.size == 0 || symbol.size > MAX_FUNCTION_SIZE || (symbol.address & 3) != 0)
+    return false;
+
+  // Only look at code in MEM1 and MEM2, which is where these functions are linked.
+  auto& memory = system.GetMemory();
+  const u32 offset = symbol.address & 0x0FFFFFFF;
+  const u32 segment = (symbol.address >> 28) & 0x3;
+  const bool in_ram =
+      (segment == 0x0 && offset + symbol.size <= memory.GetRamSizeReal()) ||
+      (segment == 0x1 && memory.GetEXRAM() && offset + symbol.size <= memory.GetExRamSizeReal());
+  if (!in_ram)
+    return false;
+
+  bool has_loads = false;
+  bool has_stores = false;
+  bool has_cache_op = false;
+  bool has_return = false;
+  for (u32 address = symbol.address; address < symbol.address + symbol.size; address += 4)
+  {
+    const UGeckoInstruction inst{memory.Read_U32(address)};
+    const GekkoOPInfo* const opinfo = PPCTables::GetOpInfo(inst, address);
+
+    switch (opinfo->type)
+    {
+    case OpType::Load:
+    case OpType::LoadFP:
+    case OpType::LoadPS:
+      has_loads = true;
+      break;
+    case OpType::Store:
+    case OpType::StoreFP:
+    case OpType::StorePS:
+      has_stores = true;
+      break;
+    case OpType::Invalid:
+    case OpType::InstructionCache:
+      return false;
+    default:
+      break;
+    }
+
+    // Calls, exceptions and system register writes (other than mtctr) would all have side effects
+    // which the replacement doesn't have.
+    if ((inst.OPCD == 16 || inst.OPCD == 18 || inst.OPCD == 19) && inst.LK)
+      return false;
+    if (inst.OPCD == 17 || (inst.OPCD == 19 && inst.SUBOP10 == 50))  // sc, rfi
+      return false;
+    if (inst.OPCD == 31 && inst.SUBOP10 == 146)  // mtmsr
+      return false;
+    if (inst.OPCD == 31 && inst.SUBOP10 == 467)  // mtspr
+    {
+      const u32 index = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
+      if (index != SPR_CTR)
+        return false;
+    }
+
+    if (inst.OPCD == 31 && inst.SUBOP10 == shape->cache_subop)
+      has_cache_op = true;
+    if (inst.OPCD == 19 && inst.SUBOP10 == 16)
+      has_return = true;
+  }
+
+  return has_return && has_loads == shape->has_loads && has_stores == shape->has_stores &&
+         (has_cache_op || shape->cache_subop == 0);
+}
+}  // namespace HLE_Lib
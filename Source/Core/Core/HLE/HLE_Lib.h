@@ -0,0 +1,31 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string_view>
+
+namespace Common
+{
+class Symbol;
+}
+
+namespace Core
+{
+class CPUThreadGuard;
+class System;
+}  // namespace Core
+
+// Native implementations of hot libc/SDK routines, used instead of running the guest code.
+namespace HLE_Lib
+{
+void HLE_memcpy(const Core::CPUThreadGuard& guard);
+void HLE_memset(const Core::CPUThreadGuard& guard);
+void HLE_DCFlushRange(const Core::CPUThreadGuard& guard);
+void HLE_DCStoreRange(const Core::CPUThreadGuard& guard);
+
+// Symbol names alone aren't trustworthy (games ship functions with these names which do something
+// else, and signature databases can misidentify functions), so the guest code is checked to have
+// the expected shape before it gets replaced.
+bool IsValidReplacement(Core::System& system, std::string_view name, const Common::Symbol& symbol);
+}  // namespace HLE_Lib
@@ -119,9 +119,12 @@ void CPUManager::Run()
         state_lock.unlock();
         if (GDBStub::IsActive() && GDBStub::HasControl())
         {
-          if (!GDBStub::JustConnected())
-            GDBStub::SendSignal(GDBStub::Signal::Sigtrap);
-          GDBStub::ProcessCommands(true);
+          if (!GDBStub::ContinueRangeStep())
+          {
+            if (!GDBStub::JustConnected())
+              GDBStub::SendSignal(GDBStub::Signal::Sigtrap);
+            GDBStub::ProcessCommands(true);
+          }
           // If we are still going to step, emulate the fact we just sent a step command
           if (GDBStub::HasControl())
           {
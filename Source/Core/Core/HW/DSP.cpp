@@ -23,6 +23,7 @@
 
 #include "Core/HW/DSP.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "AudioCommon/AudioCommon.h"
@@ -478,29 +479,17 @@ void DSPManager::Do_ARAM_DMA()
 
     if (m_aram_dma.ARAddr < m_aram.size)
     {
+      // Reads don't depend on the memory map set up in m_aram_info, so the transfer is copied
+      // in as few pieces as possible, splitting it only where it wraps around the end of ARAM.
       while (m_aram_dma.Cnt.count)
       {
-        // These are logically separated in code to show that a memory map has been set up
-        // See below in the write section for more information
-        if ((m_aram_info.Hex & 0xf) == 3)
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
-        else if ((m_aram_info.Hex & 0xf) == 4)
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
-        else
-        {
-          memory.Write_U64_Swap(*(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask],
-                                m_aram_dma.MMAddr);
-        }
+        const u32 aram_offset = m_aram_dma.ARAddr & m_aram.mask;
+        const u32 length = std::min<u32>(m_aram_dma.Cnt.count, m_aram.mask + 1 - aram_offset);
+        memory.CopyToEmu(m_aram_dma.MMAddr, &m_aram.ptr[aram_offset], length);
 
-        m_aram_dma.MMAddr += 8;
-        m_aram_dma.ARAddr += 8;
-        m_aram_dma.Cnt.count -= 8;
+        m_aram_dma.MMAddr += length;
+        m_aram_dma.ARAddr += length;
+        m_aram_dma.Cnt.count -= length;
       }
     }
     else if (!m_aram.wii_mode)
@@ -525,30 +514,31 @@ void DSPManager::Do_ARAM_DMA()
     m_aram_dma.ARAddr &= 0x3ffffff;
     m_aram_dma.MMAddr &= 0x3ffffff;
 
-    if (m_aram_dma.ARAddr < m_aram.size)
+    if (m_aram_dma.ARAddr < m_aram.size && (m_aram_info.Hex & 0xf) != 4)
     {
       while (m_aram_dma.Cnt.count)
       {
-        if ((m_aram_info.Hex & 0xf) == 3)
-        {
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
-              Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
-        }
-        else if ((m_aram_info.Hex & 0xf) == 4)
-        {
-          if (m_aram_dma.ARAddr < 0x400000)
-          {
-            *(u64*)&m_aram.ptr[(m_aram_dma.ARAddr + 0x400000) & m_aram.mask] =
-                Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
-          }
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
-              Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
-        }
-        else
+        const u32 aram_offset = m_aram_dma.ARAddr & m_aram.mask;
+        const u32 length = std::min<u32>(m_aram_dma.Cnt.count, m_aram.mask + 1 - aram_offset);
+        memory.CopyFromEmu(&m_aram.ptr[aram_offset], m_aram_dma.MMAddr, length);
+
+        m_aram_dma.MMAddr += length;
+        m_aram_dma.ARAddr += length;
+        m_aram_dma.Cnt.count -= length;
+      }
+    }
+    else if (m_aram_dma.ARAddr < m_aram.size)
+    {
+      // With this memory map, writes to the first 4MB are mirrored to the second 4MB.
+      while (m_aram_dma.Cnt.count)
+      {
+        if (m_aram_dma.ARAddr < 0x400000)
         {
-          *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
+          *(u64*)&m_aram.ptr[(m_aram_dma.ARAddr + 0x400000) & m_aram.mask] =
               Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
         }
+        *(u64*)&m_aram.ptr[m_aram_dma.ARAddr & m_aram.mask] =
+            Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
 
         m_aram_dma.MMAddr += 8;
         m_aram_dma.ARAddr += 8;
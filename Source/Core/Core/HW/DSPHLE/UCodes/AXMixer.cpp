@@ -0,0 +1,104 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixer.h"
+
+#include <algorithm>
+
+#include "Common/CommonTypes.h"
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE
+{
+static s16 MixSample(int* out, s16 input, u16 volume)
+{
+  const s32 sample = std::clamp((s32(input) * s32(volume)) >> 15, -32767, 32767);  // -32768 ?
+  *out += sample;
+  return static_cast<s16>(sample);
+}
+
+void MixAddVoiceSamples(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                        s16* dpop)
+{
+  if (count == 0)
+    return;
+
+  u16 vol = *volume;
+  s16 last_sample = 0;
+  u32 i = 0;
+
+  // The product of a signed 16-bit sample and an unsigned 16-bit volume always fits in 32 bits,
+  // so the vector paths compute exactly what the scalar loop does, 8 samples at a time.
+#if defined(_M_X86_64)
+  const __m128i lane_index = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  __m128i vols = _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(vol)),
+                               _mm_mullo_epi16(lane_index, _mm_set1_epi16(volume_delta)));
+  const __m128i vol_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  const __m128i min_sample = _mm_set1_epi16(-32767);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+    // SSE2 only has signed 16-bit multiplies. Reading a volume >= 0x8000 as signed subtracts
+    // 0x10000 from it, so the high half of the product is off by exactly the sample value.
+    const __m128i lo = _mm_mullo_epi16(samples, vols);
+    const __m128i signed_hi = _mm_mulhi_epi16(samples, vols);
+    const __m128i hi = _mm_add_epi16(signed_hi, _mm_and_si128(samples, _mm_srai_epi16(vols, 15)));
+
+    // Packing saturates to [-32768, 32767], which only leaves the lower bound to fix up.
+    const __m128i prod_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+    const __m128i prod_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+    const __m128i mixed = _mm_max_epi16(_mm_packs_epi32(prod_lo, prod_hi), min_sample);
+
+    __m128i* const dst = reinterpret_cast<__m128i*>(out + i);
+    const __m128i mixed_lo = _mm_srai_epi32(_mm_unpacklo_epi16(mixed, mixed), 16);
+    const __m128i mixed_hi = _mm_srai_epi32(_mm_unpackhi_epi16(mixed, mixed), 16);
+    _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), mixed_lo));
+    _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), mixed_hi));
+
+    last_sample = static_cast<s16>(_mm_extract_epi16(mixed, 7));
+    vols = _mm_add_epi16(vols, vol_step);
+  }
+#elif defined(_M_ARM_64)
+  static constexpr u16 lane_index[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  uint16x8_t vols = vmlaq_n_u16(vdupq_n_u16(vol), vld1q_u16(lane_index), volume_delta);
+  const uint16x8_t vol_step = vdupq_n_u16(static_cast<u16>(volume_delta * 8));
+  const int32x4_t min_sample = vdupq_n_s32(-32767);
+  const int32x4_t max_sample = vdupq_n_s32(32767);
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = vld1q_s16(input + i);
+
+    const int32x4_t prod_lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                                        vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vols))));
+    const int32x4_t prod_hi = vmulq_s32(vmovl_s16(vget_high_s16(samples)),
+                                        vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(vols))));
+    const int32x4_t mixed_lo =
+        vminq_s32(vmaxq_s32(vshrq_n_s32(prod_lo, 15), min_sample), max_sample);
+    const int32x4_t mixed_hi =
+        vminq_s32(vmaxq_s32(vshrq_n_s32(prod_hi, 15), min_sample), max_sample);
+
+    vst1q_s32(out + i, vaddq_s32(vld1q_s32(out + i), mixed_lo));
+    vst1q_s32(out + i + 4, vaddq_s32(vld1q_s32(out + i + 4), mixed_hi));
+
+    last_sample = static_cast<s16>(vgetq_lane_s32(mixed_hi, 3));
+    vols = vaddq_u16(vols, vol_step);
+  }
+#endif
+  vol += static_cast<u16>(i * volume_delta);
+
+  for (; i < count; ++i)
+  {
+    last_sample = MixSample(&out[i], input[i], vol);
+    vol += volume_delta;
+  }
+
+  *volume = vol;
+  *dpop = last_sample;
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,19 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE
+{
+// Scales count samples by a 1.15 fixed point volume, clamps them to [-32767, 32767] and adds them
+// to out. The volume is increased by volume_delta after each sample (wrapping around like the
+// 16-bit register it emulates) and its final value is written back. The last mixed sample is
+// stored to *dpop.
+//
+// This is shared between AX GC and AX Wii and is vectorized on x64 and AArch64; the results are
+// identical to the scalar loop for all inputs.
+void MixAddVoiceSamples(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                        s16* dpop);
+}  // namespace DSP::HLE
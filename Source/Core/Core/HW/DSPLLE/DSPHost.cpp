@@ -14,6 +14,7 @@
 #include "Core/DSP/DSPCore.h"
 #include "Core/DSP/Jit/x64/DSPEmitter.h"
 #include "Core/HW/DSP.h"
+#include "Core/HW/DSPLLE/DSPLLE.h"
 #include "Core/HW/DSPLLE/DSPSymbols.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
@@ -68,8 +69,11 @@ bool IsWiiHost()
 
 void InterruptRequest()
 {
-  // Fire an interrupt on the PPC ASAP.
-  Core::System::GetInstance().GetDSP().GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP);
+  // Fire an interrupt on the PPC ASAP. This goes through DSPLLE, which may hold it back until the
+  // next sync with the CPU.
+  auto* dsp_lle =
+      static_cast<DSP::LLE::DSPLLE*>(Core::System::GetInstance().GetDSP().GetDSPEmulator());
+  dsp_lle->RequestInterrupt();
 }
 
 void CodeLoaded(DSPCore& dsp, u32 addr, size_t size)
@@ -25,8 +25,10 @@
 #include "Core/DSP/DSPTables.h"
 #include "Core/DSP/Interpreter/DSPInterpreter.h"
 #include "Core/DSP/Jit/DSPEmitterBase.h"
+#include "Core/HW/DSP.h"
 #include "Core/HW/Memmap.h"
 #include "Core/Host.h"
+#include "Core/System.h"
 
 namespace DSP::LLE
 {
@@ -49,14 +51,28 @@ void DSPLLE::DoState(PointerWrap& p)
     p.SetVerifyMode();
     return;
   }
+
+  // Savestates don't store the batched sync state, so make sure that the DSP core has seen all
+  // mailbox accesses before saving, and that the CPU's view reflects the DSP core after loading.
+  if (IsBatchedSync())
+  {
+    SyncBatchedState();
+    m_cycle_count.fetch_add(m_batched_cycles);
+    m_batched_cycles = 0;
+  }
+
   m_dsp_core.DoState(p);
   p.Do(m_cycle_count);
+
+  if (IsBatchedSync() && p.IsReadMode())
+    SyncBatchedState();
 }
 
 // Regular thread
 void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Emulation);
 
   while (dsp_lle->m_is_running.IsSet())
   {
@@ -120,9 +136,9 @@ static bool FillDSPInitOptions(DSPInitOptions* opts)
     return false;
 
   opts->core_type = DSPInitOptions::CoreType::Interpreter;
-#ifdef _M_X86_64
+#if defined(_M_X86_64) || defined(_M_ARM_64)
   if (Config::Get(Config::MAIN_DSP_JIT))
-    opts->core_type = DSPInitOptions::CoreType::JIT64;
+    opts->core_type = DSPInitOptions::CoreType::JIT;
 #endif
 
   if (Config::Get(Config::MAIN_DSP_CAPTURE_LOG))
@@ -150,8 +166,13 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   m_wii = wii;
   m_is_dsp_on_thread = dsp_thread;
+  m_sync_cycles = Config::Get(Config::MAIN_DSP_THREAD_SYNC_CYCLES);
+  m_batched_cycles = 0;
+  m_pending_mailbox_accesses.clear();
+  m_interrupt_pending.store(false);
 
   m_dsp_core.Reset();
+  m_mailbox_view = {m_dsp_core.PeekMailbox(Mailbox::CPU), m_dsp_core.PeekMailbox(Mailbox::DSP)};
 
   InitInstructionTable();
 
@@ -212,24 +233,48 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
-  return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
+  const Mailbox mailbox = cpu_mailbox ? Mailbox::CPU : Mailbox::DSP;
+  if (IsBatchedSync())
+    return static_cast<u16>(CPUMailboxView(mailbox) >> 16);
+
+  return m_dsp_core.ReadMailboxHigh(mailbox);
 }
 
 u16 DSPLLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 {
-  return m_dsp_core.ReadMailboxLow(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
+  const Mailbox mailbox = cpu_mailbox ? Mailbox::CPU : Mailbox::DSP;
+  if (IsBatchedSync())
+  {
+    u32& view = CPUMailboxView(mailbox);
+    m_pending_mailbox_accesses.push_back({MailboxAccess::Type::ReadLow, mailbox, view});
+    const u16 value = static_cast<u16>(view);
+    view &= ~0x80000000;
+    return value;
+  }
+
+  return m_dsp_core.ReadMailboxLow(mailbox);
 }
 
 void DSPLLE::DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value)
 {
   if (cpu_mailbox)
   {
-    if ((m_dsp_core.PeekMailbox(Mailbox::CPU) & 0x80000000) != 0)
+    const bool batched_sync = IsBatchedSync();
+    const u32 old_value =
+        batched_sync ? CPUMailboxView(Mailbox::CPU) : m_dsp_core.PeekMailbox(Mailbox::CPU);
+    if ((old_value & 0x80000000) != 0)
     {
       // the DSP didn't read the previous value
       WARN_LOG_FMT(DSPLLE, "Mailbox isn't empty ... strange");
     }
 
+    if (batched_sync)
+    {
+      CPUMailboxView(Mailbox::CPU) = ((old_value & 0xffff) | (value << 16)) & ~0x80000000;
+      m_pending_mailbox_accesses.push_back({MailboxAccess::Type::WriteHigh, Mailbox::CPU, value});
+      return;
+    }
+
     m_dsp_core.WriteMailboxHigh(Mailbox::CPU, value);
   }
   else
@@ -242,6 +287,14 @@ void DSPLLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 {
   if (cpu_mailbox)
   {
+    if (IsBatchedSync())
+    {
+      u32& view = CPUMailboxView(Mailbox::CPU);
+      view = (view & ~0xffff) | value | 0x80000000;
+      m_pending_mailbox_accesses.push_back({MailboxAccess::Type::WriteLow, Mailbox::CPU, value});
+      return;
+    }
+
     m_dsp_core.WriteMailboxLow(Mailbox::CPU, value);
   }
   else
@@ -252,7 +305,7 @@ void DSPLLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 
 void DSPLLE::DSP_Update(int cycles)
 {
-  const int dsp_cycles = cycles / 6;
+  int dsp_cycles = cycles / 6;
 
   if (dsp_cycles <= 0)
     return;
@@ -261,6 +314,14 @@ void DSPLLE::DSP_Update(int cycles)
   {
     if (m_request_disable_thread || Core::WantsDeterminism())
     {
+      // Hand everything that is still batched over to the DSP core before it's run on this thread.
+      if (IsBatchedSync())
+      {
+        m_ppc_event.Wait();
+        SyncBatchedState();
+        dsp_cycles += static_cast<int>(m_batched_cycles);
+        m_batched_cycles = 0;
+      }
       DSP_StopSoundStream();
       m_is_dsp_on_thread = false;
       m_request_disable_thread = false;
@@ -274,6 +335,20 @@ void DSPLLE::DSP_Update(int cycles)
     // ~1/6th as many cycles as the period PPC-side.
     m_dsp_core.RunCycles(dsp_cycles);
   }
+  else if (IsBatchedSync())
+  {
+    m_batched_cycles += dsp_cycles;
+    if (m_batched_cycles < m_sync_cycles)
+      return;
+
+    // Quantum boundary: wait for the DSP thread to finish the previous quantum, exchange state
+    // while it's idle, and let it run the next one.
+    m_ppc_event.Wait();
+    SyncBatchedState();
+    m_cycle_count.fetch_add(m_batched_cycles);
+    m_batched_cycles = 0;
+    m_dsp_event.Set();
+  }
   else
   {
     // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
@@ -283,6 +358,42 @@ void DSPLLE::DSP_Update(int cycles)
   }
 }
 
+void DSPLLE::SyncBatchedState()
+{
+  for (const MailboxAccess& access : m_pending_mailbox_accesses)
+  {
+    switch (access.type)
+    {
+    case MailboxAccess::Type::WriteHigh:
+      m_dsp_core.WriteMailboxHigh(access.mailbox, static_cast<u16>(access.value));
+      break;
+    case MailboxAccess::Type::WriteLow:
+      m_dsp_core.WriteMailboxLow(access.mailbox, static_cast<u16>(access.value));
+      break;
+    case MailboxAccess::Type::ReadLow:
+      // Only acknowledge the mail the CPU has seen, not one that the DSP has written since.
+      if (m_dsp_core.PeekMailbox(access.mailbox) == access.value)
+        m_dsp_core.ReadMailboxLow(access.mailbox);
+      break;
+    }
+  }
+  m_pending_mailbox_accesses.clear();
+
+  m_mailbox_view = {m_dsp_core.PeekMailbox(Mailbox::CPU), m_dsp_core.PeekMailbox(Mailbox::DSP)};
+
+  if (m_interrupt_pending.exchange(false))
+    Core::System::GetInstance().GetDSP().GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP);
+}
+
+void DSPLLE::RequestInterrupt()
+{
+  // With batched sync, interrupts are delivered at the next quantum boundary, like mail.
+  if (IsBatchedSync())
+    m_interrupt_pending.store(true);
+  else
+    Core::System::GetInstance().GetDSP().GenerateDSPInterruptFromDSPEmu(DSP::INT_DSP);
+}
+
 u32 DSPLLE::DSP_UpdateRate()
 {
   return 12600;  // TO BE TWEAKED
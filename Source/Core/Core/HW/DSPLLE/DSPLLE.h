@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
@@ -38,9 +40,37 @@ public:
   void DSP_StopSoundStream() override;
   u32 DSP_UpdateRate() override;
 
+  // Called by the DSP core when it raises an interrupt on the CPU.
+  void RequestInterrupt();
+
 private:
+  // With batched sync, the DSP thread runs a quantum of cycles at a time, and everything the CPU
+  // and the DSP exchange through the mailboxes only crosses over at quantum boundaries. While a
+  // quantum runs, the CPU works on a copy of the mailboxes, and its accesses are replayed on the
+  // DSP core at the next boundary. This makes what each side sees independent of how fast the
+  // host runs the two threads.
+  struct MailboxAccess
+  {
+    enum class Type
+    {
+      WriteHigh,
+      WriteLow,
+      ReadLow,
+    };
+
+    Type type;
+    Mailbox mailbox;
+    // The value written, or for reads, the value of the mailbox when it was read.
+    u32 value;
+  };
+
   static void DSPThread(DSPLLE* dsp_lle);
 
+  bool IsBatchedSync() const { return m_is_dsp_on_thread && m_sync_cycles != 0; }
+  u32& CPUMailboxView(Mailbox mailbox) { return m_mailbox_view[static_cast<u32>(mailbox)]; }
+  // Must only be called while the DSP thread is between quanta.
+  void SyncBatchedState();
+
   DSPCore m_dsp_core;
   std::thread m_dsp_thread;
   std::mutex m_dsp_thread_mutex;
@@ -51,5 +81,11 @@ private:
   Common::Event m_dsp_event;
   Common::Event m_ppc_event;
   bool m_request_disable_thread = false;
+
+  u32 m_sync_cycles = 0;
+  u32 m_batched_cycles = 0;
+  std::array<u32, 2> m_mailbox_view{};
+  std::vector<MailboxAccess> m_pending_mailbox_accesses;
+  std::atomic<bool> m_interrupt_pending{false};
 };
 }  // namespace DSP::LLE
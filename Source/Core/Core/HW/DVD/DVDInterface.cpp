@@ -1401,6 +1401,8 @@ void DVDInterface::ScheduleReads(u64 offset, u32 length, const DiscIO::Partition
   DEBUG_LOG_FMT(DVDINTERFACE, "Schedule reads: offset={:#x} length={:#x} address={:#x}", offset,
                 length, output_address);
 
+  const bool fast_seek = Config::Get(Config::MAIN_FAST_DISC_SEEK);
+
   s64 ticks_until_completion =
       READ_COMMAND_LATENCY_US * (m_system.GetSystemTimers().GetTicksPerSecond() / 1000000);
 
@@ -1435,7 +1437,15 @@ void DVDInterface::ScheduleReads(u64 offset, u32 length, const DiscIO::Partition
     {
       // In practice we'll only ever seek if this is the first time
       // through this loop.
-      if (dvd_offset != head_position)
+      if (dvd_offset != head_position && fast_seek)
+      {
+        // Unbuffered seek+read, timed as if the head was already in place
+        seek = true;
+        ticks_until_completion +=
+            static_cast<u64>(ticks_per_second * DVDMath::CalculateRawDiscReadTime(
+                                                    dvd_offset, DVD_ECC_BLOCK_SIZE, wii_disc));
+      }
+      else if (dvd_offset != head_position)
       {
         // Unbuffered seek+read
         seek = true;
@@ -3,6 +3,8 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -15,6 +17,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/Instrumentation.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SPSCQueue.h"
@@ -31,9 +34,12 @@
 #include "Core/IOS/ES/Formats.h"
 #include "Core/System.h"
 
+#include "DiscIO/Blob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/Volume.h"
 
+#include "VideoCommon/StutterTracker.h"
+
 namespace DVD
 {
 DVDThread::DVDThread(Core::System& system) : m_system(system)
@@ -69,6 +75,7 @@ void DVDThread::Stop()
 {
   StopDVDThread();
   m_disc.reset();
+  ResetReadAhead();
 }
 
 void DVDThread::StopDVDThread()
@@ -114,7 +121,7 @@ void DVDThread::DoState(PointerWrap& p)
     if (had_disc)
       PanicAlertFmtT("An inserted disc was expected but not found.");
     else
-      m_disc.reset();
+      SetDisc(nullptr);
   }
 
   // TODO: Savestates can be smaller if the buffers of results aren't saved,
@@ -132,6 +139,18 @@ void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   m_disc = std::move(disc);
+
+  ResetReadAhead();
+  if (m_disc)
+  {
+    const DiscIO::BlobType blob_type = m_disc->GetBlobType();
+    m_read_ahead_enabled = blob_type == DiscIO::BlobType::GCZ ||
+                           blob_type == DiscIO::BlobType::WIA || blob_type == DiscIO::BlobType::RVZ;
+  }
+  else
+  {
+    m_read_ahead_enabled = false;
+  }
 }
 
 bool DVDThread::HasDisc() const
@@ -202,6 +221,7 @@ void DVDThread::WaitUntilIdle()
 {
   ASSERT(Core::IsCPUThread());
 
+  StutterScope stutter_scope(StutterCause::DVDWait);
   while (!m_request_queue.Empty())
     m_result_queue_expanded.Wait();
 
@@ -280,8 +300,15 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
   {
     while (true)
     {
-      while (!m_result_queue.Pop(result))
-        m_result_queue_expanded.Wait();
+      if (!m_result_queue.Pop(result))
+      {
+        // The CPU thread is blocked until the disc read finishes.
+        StutterScope stutter_scope(StutterCause::DVDWait);
+        do
+        {
+          m_result_queue_expanded.Wait();
+        } while (!m_result_queue.Pop(result));
+      }
 
       if (result.first.id == id)
         break;
@@ -331,6 +358,7 @@ void DVDThread::FinishRead(u64 id, s64 cycles_late)
 void DVDThread::DVDThreadMain()
 {
   Common::SetCurrentThreadName("DVD thread");
+  Common::SetCurrentThreadRole(Common::ThreadRole::IO);
 
   while (true)
   {
@@ -345,7 +373,7 @@ void DVDThread::DVDThreadMain()
       m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
 
       std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
+      if (!ReadFromDisc(request, buffer.data()))
         buffer.resize(0);
 
       request.realtime_done_us = Common::Timer::NowUs();
@@ -356,6 +384,80 @@ void DVDThread::DVDThreadMain()
       if (m_dvd_thread_exiting.IsSet())
         return;
     }
+
+    ReadAhead();
+  }
+}
+
+bool DVDThread::ReadFromDisc(const ReadRequest& request, u8* out_ptr)
+{
+  INSTRUMENT_ZONE("DVDThread::ReadFromDisc");
+
+  const u64 offset = request.dvd_offset;
+  const u64 end = offset + request.length;
+  const bool sequential = request.partition == m_last_read_partition && offset == m_last_read_end;
+  m_last_read_partition = request.partition;
+  m_last_read_end = end;
+
+  u64 read_offset = offset;
+  const u64 read_ahead_end = m_read_ahead_offset + m_read_ahead_buffer.size();
+  if (request.partition == m_read_ahead_partition && offset >= m_read_ahead_offset &&
+      offset < read_ahead_end)
+  {
+    const u64 hit_end = std::min(end, read_ahead_end);
+    std::memcpy(out_ptr, m_read_ahead_buffer.data() + (offset - m_read_ahead_offset),
+                hit_end - offset);
+    read_offset = hit_end;
+
+    m_read_ahead_buffer.erase(m_read_ahead_buffer.begin(),
+                              m_read_ahead_buffer.begin() + (hit_end - m_read_ahead_offset));
+    m_read_ahead_offset = hit_end;
+  }
+  else
+  {
+    m_read_ahead_buffer.clear();
   }
+
+  const bool success =
+      read_offset == end ||
+      m_disc->Read(read_offset, end - read_offset, out_ptr + (read_offset - offset),
+                   request.partition);
+
+  // Continue reading ahead from wherever this request ended.
+  if (m_read_ahead_buffer.empty())
+  {
+    m_read_ahead_partition = request.partition;
+    m_read_ahead_offset = end;
+  }
+  m_read_ahead_pending = m_read_ahead_enabled && sequential && success;
+
+  return success;
+}
+
+void DVDThread::ReadAhead()
+{
+  while (m_read_ahead_pending && m_read_ahead_buffer.size() < READ_AHEAD_SIZE &&
+         m_request_queue.Empty() && !m_dvd_thread_exiting.IsSet())
+  {
+    const size_t old_size = m_read_ahead_buffer.size();
+    m_read_ahead_buffer.resize(old_size + READ_AHEAD_STEP);
+    if (!m_disc->Read(m_read_ahead_offset + old_size, READ_AHEAD_STEP,
+                      m_read_ahead_buffer.data() + old_size, m_read_ahead_partition))
+    {
+      // Most likely the end of the disc or partition.
+      m_read_ahead_buffer.resize(old_size);
+      m_read_ahead_pending = false;
+    }
+  }
+}
+
+void DVDThread::ResetReadAhead()
+{
+  m_read_ahead_pending = false;
+  m_last_read_partition = {};
+  m_last_read_end = 0;
+  m_read_ahead_partition = {};
+  m_read_ahead_offset = 0;
+  m_read_ahead_buffer.clear();
 }
 }  // namespace DVD
@@ -100,6 +100,11 @@ private:
 
   void DVDThreadMain();
 
+  struct ReadRequest;
+  bool ReadFromDisc(const ReadRequest& request, u8* out_ptr);
+  void ReadAhead();
+  void ResetReadAhead();
+
   struct ReadRequest
   {
     bool copy_to_ram = false;
@@ -141,6 +146,21 @@ private:
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  // Compressed discs are decompressed on demand, which stalls long sequential reads like the ones
+  // of loading screens. When the DVD thread runs out of requests after a sequential read, it reads
+  // ahead the data that follows, a step at a time so that new requests don't have to wait long.
+  // These are only accessed by the DVD thread, or by the CPU thread while the DVD thread is idle.
+  static constexpr u64 READ_AHEAD_SIZE = 0x100000;
+  static constexpr u64 READ_AHEAD_STEP = 0x20000;
+  bool m_read_ahead_enabled = false;
+  bool m_read_ahead_pending = false;
+  DiscIO::Partition m_last_read_partition{};
+  u64 m_last_read_end = 0;
+  // The data at m_read_ahead_offset onwards, which has been read but not requested yet.
+  DiscIO::Partition m_read_ahead_partition{};
+  u64 m_read_ahead_offset = 0;
+  std::vector<u8> m_read_ahead_buffer;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
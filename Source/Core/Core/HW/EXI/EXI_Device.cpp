@@ -4,6 +4,7 @@
 #include "Core/HW/EXI/EXI_Device.h"
 
 #include <memory>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Core/HW/EXI/EXI_DeviceAD16.h"
@@ -53,23 +54,19 @@ void IEXIDevice::ImmReadWrite(u32& data, u32 size)
 
 void IEXIDevice::DMAWrite(u32 address, u32 size)
 {
-  auto& memory = m_system.GetMemory();
-  while (size--)
-  {
-    u8 byte = memory.Read_U8(address++);
+  std::vector<u8> buffer(size);
+  m_system.GetMemory().CopyFromEmu(buffer.data(), address, size);
+  for (u8& byte : buffer)
     TransferByte(byte);
-  }
 }
 
 void IEXIDevice::DMARead(u32 address, u32 size)
 {
-  auto& memory = m_system.GetMemory();
-  while (size--)
-  {
-    u8 byte = 0;
+  // The bytes are collected first so that guest memory is written with a single copy.
+  std::vector<u8> buffer(size);
+  for (u8& byte : buffer)
     TransferByte(byte);
-    memory.Write_U8(byte, address++);
-  }
+  m_system.GetMemory().CopyToEmu(address, buffer.data(), size);
 }
 
 bool IEXIDevice::UseDelayedTransferCompletion() const
@@ -437,7 +437,8 @@ void Core::SetAVStream()
   };
   m_stream.postAudioBuffer = [](mAVStream* stream, blip_t* left, blip_t* right) {
     auto core = static_cast<AVStream*>(stream)->core;
-    std::vector<s16> buffer(SAMPLES * 2);
+    std::vector<s16>& buffer = core->m_audio_buffer;
+    buffer.resize(SAMPLES * 2);
     blip_read_samples(left, &buffer[0], SAMPLES, 1);
     blip_read_samples(right, &buffer[1], SAMPLES, 1);
 
@@ -123,6 +123,7 @@ private:
   SIODriver m_sio_driver{};
   AVStream m_stream{};
   std::vector<u32> m_video_buffer;
+  std::vector<s16> m_audio_buffer;
 
   u64 m_last_gc_ticks = 0;
   u64 m_gc_ticks_remainder = 0;
@@ -3,12 +3,15 @@
 
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -79,6 +82,7 @@ MemoryCard::MemoryCard(const std::string& filename, ExpansionInterface::Slot car
   // Class members (including inherited ones) have now been initialized, so
   // it's safe to startup the flush thread (which reads them).
   m_flush_buffer = std::make_unique<u8[]>(m_memory_card_size);
+  m_dirty_blocks.resize((m_memory_card_size + Memcard::BLOCK_SIZE - 1) / Memcard::BLOCK_SIZE);
   m_flush_thread = std::thread(&MemoryCard::FlushThread, this);
 }
 
@@ -121,6 +125,9 @@ void MemoryCard::FlushThread()
     // file doesn't disappear out from under us after the first check.
     File::IOFile file(m_filename, "r+b");
 
+    // Only the dirty blocks need to be written if the file on disk is otherwise up to date.
+    const bool write_all = !file || file.GetSize() != m_memory_card_size;
+
     if (!file)
     {
       std::string dir;
@@ -147,15 +154,50 @@ void MemoryCard::FlushThread()
       return;
     }
 
+    // (offset, length) pairs of the parts of m_flush_buffer to write out.
+    std::vector<std::pair<u32, u32>> ranges;
     {
       std::unique_lock l(m_flush_mutex);
-      memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+      if (write_all)
+      {
+        memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+        ranges.emplace_back(0, m_memory_card_size);
+      }
+      else
+      {
+        // Coalesce runs of dirty blocks so that a save written block by block is still
+        // flushed with a single write.
+        for (size_t block = 0; block < m_dirty_blocks.size(); ++block)
+        {
+          if (!m_dirty_blocks[block])
+            continue;
+
+          const size_t first_block = block;
+          while (block < m_dirty_blocks.size() && m_dirty_blocks[block])
+            ++block;
+
+          const u32 offset = static_cast<u32>(first_block * Memcard::BLOCK_SIZE);
+          const u32 end = std::min<u32>(static_cast<u32>(block * Memcard::BLOCK_SIZE),
+                                        m_memory_card_size);
+          memcpy(&m_flush_buffer[offset], &m_memcard_data[offset], end - offset);
+          ranges.emplace_back(offset, end - offset);
+        }
+      }
+      std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), false);
+    }
+
+    for (const auto& [offset, length] : ranges)
+    {
+      file.Seek(offset, File::SeekOrigin::Begin);
+      file.WriteBytes(&m_flush_buffer[offset], length);
     }
-    file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
 
     if (do_exit)
       return;
 
+    if (ranges.empty())
+      continue;
+
     Core::DisplayMessage(fmt::format("Wrote to Memory Card {}",
                                      m_card_slot == ExpansionInterface::Slot::A ? 'A' : 'B'),
                          4000);
@@ -167,6 +209,16 @@ void MemoryCard::MakeDirty()
   m_dirty.Set();
 }
 
+void MemoryCard::MarkBlocksDirty(u32 address, u32 length)
+{
+  if (length == 0)
+    return;
+
+  const u32 first_block = address / Memcard::BLOCK_SIZE;
+  const u32 last_block = (address + length - 1) / Memcard::BLOCK_SIZE;
+  std::fill(m_dirty_blocks.begin() + first_block, m_dirty_blocks.begin() + last_block + 1, true);
+}
+
 s32 MemoryCard::Read(u32 src_address, s32 length, u8* dest_address)
 {
   if (!IsAddressInBounds(src_address, length))
@@ -191,6 +243,7 @@ s32 MemoryCard::Write(u32 dest_address, s32 length, const u8* src_address)
   {
     std::unique_lock l(m_flush_mutex);
     memcpy(&m_memcard_data[dest_address], src_address, length);
+    MarkBlocksDirty(dest_address, length);
   }
   MakeDirty();
   return length;
@@ -207,6 +260,7 @@ void MemoryCard::ClearBlock(u32 address)
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[address], 0xFF, Memcard::BLOCK_SIZE);
+    MarkBlocksDirty(address, Memcard::BLOCK_SIZE);
   }
   MakeDirty();
 }
@@ -216,6 +270,7 @@ void MemoryCard::ClearAll()
   {
     std::unique_lock l(m_flush_mutex);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
+    MarkBlocksDirty(0, m_memory_card_size);
   }
   MakeDirty();
 }
@@ -225,4 +280,12 @@ void MemoryCard::DoState(PointerWrap& p)
   p.Do(m_card_slot);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+
+  // The loaded card contents can differ anywhere from what is on disk, so the next flush has to
+  // write out the whole card.
+  if (p.IsReadMode())
+  {
+    std::unique_lock l(m_flush_mutex);
+    MarkBlocksDirty(0, m_memory_card_size);
+  }
 }
@@ -7,6 +7,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -36,6 +37,9 @@ private:
     return end_address <= static_cast<u64>(m_memory_card_size);
   }
 
+  // Must be called with m_flush_mutex held.
+  void MarkBlocksDirty(u32 address, u32 length);
+
   std::string m_filename;
   std::unique_ptr<u8[]> m_memcard_data;
   std::unique_ptr<u8[]> m_flush_buffer;
@@ -43,5 +47,8 @@ private:
   std::mutex m_flush_mutex;
   Common::Event m_flush_trigger;
   Common::Flag m_dirty;
+  // One entry per Memcard::BLOCK_SIZE bytes of the card, so that flushes only rewrite the blocks
+  // that were modified since the last one. Guarded by m_flush_mutex.
+  std::vector<bool> m_dirty_blocks;
   u32 m_memory_card_size;
 };
@@ -102,10 +102,13 @@ void GPFifoManager::UpdateGatherPipe()
       processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
     else
       processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
-
-    system.GetCommandProcessor().GatherPipeBursted();
   }
 
+  // Let the command processor handle all of the bursts at once, so that a block which filled the
+  // pipe several times only wakes up the GPU once.
+  if (processed != 0)
+    system.GetCommandProcessor().GatherPipeBursted(static_cast<u32>(processed / GATHER_PIPE_SIZE));
+
   // move back the spill bytes
   memmove(m_gather_pipe, m_gather_pipe + processed, pipe_count);
   SetGatherPipeCount(pipe_count);
@@ -3,10 +3,13 @@
 
 #include "Core/HW/MMIO.h"
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Core/HW/MMIOHandlers.h"
 
 namespace MMIO
@@ -416,6 +419,35 @@ void WriteHandler<T>::InitializeInvalid()
   ResetMethod(InvalidWrite<T>());
 }
 
+void Mapping::LogAccessStats() const
+{
+  constexpr size_t MAX_LOGGED_REGISTERS = 32;
+
+  std::vector<u32> ids;
+  for (u32 id = 0; id < m_access_stats.size(); ++id)
+  {
+    if (m_access_stats[id].reads != 0 || m_access_stats[id].writes != 0)
+      ids.push_back(id);
+  }
+
+  const auto total = [this](u32 id) {
+    return m_access_stats[id].reads + m_access_stats[id].writes;
+  };
+  const size_t count = std::min(ids.size(), MAX_LOGGED_REGISTERS);
+  std::partial_sort(ids.begin(), ids.begin() + count, ids.end(),
+                    [&](u32 a, u32 b) { return total(a) > total(b); });
+
+  NOTICE_LOG_FMT(MEMMAP, "Most accessed MMIO registers ({} accessed in total):", ids.size());
+  for (size_t i = 0; i < count; ++i)
+  {
+    const u32 unique_id = ids[i] * sizeof(u32);
+    const u32 address = (unique_id >> 16 == WII_BLOCK ? 0x0D000000 : 0x0C000000) |
+                        (unique_id & (BLOCK_SIZE - 1));
+    NOTICE_LOG_FMT(MEMMAP, "  {:08x}: {} reads, {} writes", address, m_access_stats[ids[i]].reads,
+                   m_access_stats[ids[i]].writes);
+  }
+}
+
 // Define all the public specializations that are exported in MMIOHandlers.h.
 #define MaybeExtern
 MMIO_PUBLIC_SPECIALIZATIONS()
@@ -136,15 +136,26 @@ public:
   template <typename Unit>
   Unit Read(Core::System& system, u32 addr)
   {
+    if (m_collect_access_stats) [[unlikely]]
+      ++m_access_stats[UniqueID(addr) / sizeof(u32)].reads;
     return GetHandlerForRead<Unit>(addr).Read(system, addr);
   }
 
   template <typename Unit>
   void Write(Core::System& system, u32 addr, Unit val)
   {
+    if (m_collect_access_stats) [[unlikely]]
+      ++m_access_stats[UniqueID(addr) / sizeof(u32)].writes;
     GetHandlerForWrite<Unit>(addr).Write(system, addr, val);
   }
 
+  // Access statistics, for finding the registers a title accesses the most (e.g. status registers
+  // it polls). While they are collected, the JITs don't inline MMIO accesses so that all accesses
+  // go through Read() and Write().
+  void SetCollectAccessStats(bool enable) { m_collect_access_stats = enable; }
+  bool IsCollectingAccessStats() const { return m_collect_access_stats; }
+  void LogAccessStats() const;
+
   // Handlers access interface.
   //
   // Use when you care more about how to access the MMIO register for an
@@ -186,6 +197,16 @@ private:
   HandlerArray<u16>::Write m_write_handlers16;
   HandlerArray<u32>::Write m_write_handlers32;
 
+  struct AccessStats
+  {
+    u64 reads = 0;
+    u64 writes = 0;
+  };
+
+  // Indexed by UniqueID(addr) / sizeof(u32), i.e. accesses are counted per 32-bit register.
+  std::array<AccessStats, NUM_MMIOS / sizeof(u32)> m_access_stats{};
+  bool m_collect_access_stats = false;
+
   // Getter functions for the handler arrays.
   template <typename Unit>
   ReadHandler<Unit>& GetReadHandler(size_t index)
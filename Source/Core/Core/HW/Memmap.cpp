@@ -10,15 +10,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <span>
 #include <tuple>
+#include <utility>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemArena.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
@@ -50,6 +55,7 @@ MemoryManager::~MemoryManager() = default;
 void MemoryManager::InitMMIO(bool is_wii)
 {
   m_mmio_mapping = std::make_unique<MMIO::Mapping>();
+  m_mmio_mapping->SetCollectAccessStats(Config::Get(Config::MAIN_DEBUG_MMIO_ACCESS_STATS));
 
   m_system.GetCommandProcessor().RegisterMMIO(m_mmio_mapping.get(), 0x0C000000);
   m_system.GetPixelEngine().RegisterMMIO(m_mmio_mapping.get(), 0x0C001000);
@@ -122,6 +128,7 @@ void MemoryManager::Init()
     mem_size += region.size;
   }
   m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
+  m_use_huge_pages = Config::Get(Config::MAIN_HUGE_PAGES);
 
   m_physical_page_mappings.fill(nullptr);
 
@@ -140,6 +147,8 @@ void MemoryManager::Init()
           region.physical_address, region.size);
       exit(0);
     }
+    if (m_use_huge_pages)
+      Common::AdviseHugePages(*region.out_pointer, region.size);
 
     for (u32 i = 0; i < region.size; i += PowerPC::BAT_PAGE_SIZE)
     {
@@ -153,6 +162,11 @@ void MemoryManager::Init()
 
   InitMMIO(wii);
 
+  const u32 watchable_size = GetRamSize() + (wii ? GetExRamSize() : 0);
+  m_write_watch_tokens =
+      std::make_unique<std::atomic<u64>[]>(watchable_size / FASTMEM_PROTECTION_PAGE_SIZE);
+  m_last_write_watch_token = 0;
+
   Clear();
 
   INFO_LOG_FMT(MEMMAP, "Memory system initialized. RAM at {}", fmt::ptr(m_ram));
@@ -196,9 +210,17 @@ bool MemoryManager::InitFastmemArena()
   // 2 GiB guard
   // 4 GiB view for enabled address translation
   // 2 GiB guard
+  //
+  // JitArm64 always truncates the address to 32 bits, so it only needs guards large enough to
+  // catch accesses straddling the end of a view. Leaving out the rest saves 6 GiB of address
+  // space, which is what makes the reservation fit on devices with a 39-bit address space.
 
   constexpr size_t ppc_view_size = 0x1'0000'0000;
+#ifdef _M_ARM_64
+  constexpr size_t guard_size = 0x1'0000;
+#else
   constexpr size_t guard_size = 0x8000'0000;
+#endif
   constexpr size_t memory_size = ppc_view_size * 2 + guard_size * 3;
 
   m_fastmem_arena = m_arena.ReserveMemoryRegion(memory_size);
@@ -226,6 +248,8 @@ bool MemoryManager::InitFastmemArena()
                     region.physical_address, region.size);
       return false;
     }
+    if (m_use_huge_pages)
+      Common::AdviseHugePages(view, region.size);
   }
 
   m_is_fastmem_arena_initialized = true;
@@ -235,6 +259,8 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  std::lock_guard lock(m_fastmem_protection_lock);
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -279,7 +305,9 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
                   intersection_start, mapped_size, logical_address);
               exit(0);
             }
-            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size});
+            if (m_use_huge_pages)
+              Common::AdviseHugePages(mapped_pointer, mapped_size);
+            m_logical_mapped_entries.push_back({mapped_pointer, mapped_size, intersection_start});
           }
 
           m_logical_page_mappings[i] =
@@ -288,6 +316,242 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
       }
     }
   }
+
+  // The new views of write protected pages start out writable.
+  for (const u32 page : m_write_protected_pages)
+    SetFastmemPageWritable(page, false);
+  for (const u32 page : m_write_watched_pages)
+    SetFastmemPageWritable(page, false);
+}
+
+void MemoryManager::SetFastmemPageWritable(u32 page, bool writable)
+{
+  const auto set_writable = [writable](void* pointer) {
+    if (writable)
+      Common::UnWriteProtectMemory(pointer, FASTMEM_PROTECTION_PAGE_SIZE);
+    else
+      Common::WriteProtectMemory(pointer, FASTMEM_PROTECTION_PAGE_SIZE);
+  };
+
+  set_writable(m_physical_base + page);
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    if (page >= entry.physical_address && page - entry.physical_address < entry.mapped_size)
+      set_writable(static_cast<u8*>(entry.mapped_pointer) + (page - entry.physical_address));
+  }
+}
+
+void MemoryManager::UpdateFastmemPageProtection(u32 page)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return;
+
+  const bool writable =
+      !m_write_protected_pages.contains(page) && !m_write_watched_pages.contains(page);
+  SetFastmemPageWritable(page, writable);
+}
+
+bool MemoryManager::WriteProtectFastmemPage(u32 physical_address)
+{
+  if (!m_is_fastmem_arena_initialized)
+    return false;
+
+  // Only RAM can contain code worth protecting.
+  const u32 page = physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  const bool is_ram = page < GetRamSize() || (m_exram && page >= 0x10000000 &&
+                                              page - 0x10000000 < GetExRamSize());
+  if (!is_ram)
+    return false;
+
+  std::lock_guard lock(m_fastmem_protection_lock);
+  if (m_write_protected_pages.insert(page).second)
+    SetFastmemPageWritable(page, false);
+  return true;
+}
+
+void MemoryManager::UnprotectFastmemPage(u32 physical_address)
+{
+  const u32 page = physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  std::lock_guard lock(m_fastmem_protection_lock);
+  if (m_write_protected_pages.erase(page) != 0)
+    UpdateFastmemPageProtection(page);
+}
+
+void MemoryManager::UnprotectAllFastmemPages()
+{
+  std::lock_guard lock(m_fastmem_protection_lock);
+  const std::set<u32> pages = std::move(m_write_protected_pages);
+  m_write_protected_pages.clear();
+  for (const u32 page : pages)
+    UpdateFastmemPageProtection(page);
+}
+
+std::optional<u32> MemoryManager::GetFastmemPhysicalAddress(const u8* address) const
+{
+  if (!IsAddressInFastmemArea(address))
+    return std::nullopt;
+
+  if (address >= m_physical_base && address < m_physical_base + 0x1'0000'0000)
+    return static_cast<u32>(address - m_physical_base);
+
+  for (const LogicalMemoryView& entry : m_logical_mapped_entries)
+  {
+    const u8* view = static_cast<const u8*>(entry.mapped_pointer);
+    if (address >= view && address < view + entry.mapped_size)
+      return entry.physical_address + static_cast<u32>(address - view);
+  }
+
+  return std::nullopt;
+}
+
+std::optional<u32> MemoryManager::GetWriteProtectedFastmemPage(const u8* address) const
+{
+  std::lock_guard lock(m_fastmem_protection_lock);
+  if (m_write_protected_pages.empty())
+    return std::nullopt;
+
+  const std::optional<u32> physical_address = GetFastmemPhysicalAddress(address);
+  if (!physical_address)
+    return std::nullopt;
+
+  const u32 page = *physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  if (!m_write_protected_pages.contains(page))
+    return std::nullopt;
+  return page;
+}
+
+std::atomic<u64>* MemoryManager::GetWriteWatchToken(u32 page) const
+{
+  if (!m_write_watch_tokens)
+    return nullptr;
+
+  // Pages are identified by their address in the physical view, like for WriteProtectFastmemPage.
+  if (page < GetRamSize())
+    return &m_write_watch_tokens[page / FASTMEM_PROTECTION_PAGE_SIZE];
+  if (m_exram && page >= 0x10000000 && page - 0x10000000 < GetExRamSize())
+  {
+    const u32 offset = GetRamSize() + (page - 0x10000000);
+    return &m_write_watch_tokens[offset / FASTMEM_PROTECTION_PAGE_SIZE];
+  }
+  return nullptr;
+}
+
+u64 MemoryManager::WatchWrites(u32 physical_address, u32 size)
+{
+  if (size == 0 || !m_write_watch_allowed.load(std::memory_order_acquire))
+    return 0;
+
+  const u32 first_page = physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  const u32 last_page = (physical_address + size - 1) & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  if (last_page < first_page)
+    return 0;
+
+  std::lock_guard lock(m_fastmem_protection_lock);
+  if (!m_is_fastmem_arena_initialized || !m_write_watch_allowed.load(std::memory_order_relaxed))
+    return 0;
+
+  for (u32 page = first_page; page <= last_page; page += FASTMEM_PROTECTION_PAGE_SIZE)
+  {
+    if (!GetWriteWatchToken(page))
+      return 0;
+  }
+
+  for (u32 page = first_page; page <= last_page; page += FASTMEM_PROTECTION_PAGE_SIZE)
+  {
+    // The page must be protected before it gets a token, as the token promises that any write
+    // from then on will be noticed.
+    if (m_write_watched_pages.insert(page).second)
+      UpdateFastmemPageProtection(page);
+
+    // A token of 0 means that the page has been written, possibly just now on another thread. The
+    // exchange makes sure that in that case, the data written is visible to the caller's hashing.
+    std::atomic<u64>& token = *GetWriteWatchToken(page);
+    if (token.load(std::memory_order_relaxed) == 0)
+      token.exchange(++m_last_write_watch_token, std::memory_order_acq_rel);
+  }
+
+  return m_last_write_watch_token;
+}
+
+bool MemoryManager::WasWrittenSince(u32 physical_address, u32 size, u64 token) const
+{
+  if (token == 0 || !m_write_watch_allowed.load(std::memory_order_acquire))
+    return true;
+
+  const u32 first_page = physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  const u32 last_page = (physical_address + size - 1) & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  for (u32 page = first_page; page <= last_page; page += FASTMEM_PROTECTION_PAGE_SIZE)
+  {
+    const std::atomic<u64>* page_token = GetWriteWatchToken(page);
+    if (!page_token)
+      return true;
+
+    // A page gets a newer token than the one handed out only after it has been written.
+    const u64 value = page_token->load(std::memory_order_acquire);
+    if (value == 0 || value > token)
+      return true;
+  }
+
+  return false;
+}
+
+void MemoryManager::NotifyWrite(u32 physical_address, size_t size)
+{
+  if (size == 0)
+    return;
+
+  // Accept the same addresses as GetSpanForAddress. Anything outside RAM and EXRAM is ignored.
+  physical_address &= 0x3FFFFFFF;
+
+  const u32 first_page = physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  const u32 last_page =
+      static_cast<u32>(physical_address + size - 1) & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  for (u32 page = first_page; page <= last_page; page += FASTMEM_PROTECTION_PAGE_SIZE)
+  {
+    if (std::atomic<u64>* token = GetWriteWatchToken(page))
+      token->store(0, std::memory_order_release);
+  }
+}
+
+bool MemoryManager::HandleWriteWatchFault(const u8* address)
+{
+  std::lock_guard lock(m_fastmem_protection_lock);
+  if (m_write_watched_pages.empty())
+    return false;
+
+  const std::optional<u32> physical_address = GetFastmemPhysicalAddress(address);
+  if (!physical_address)
+    return false;
+
+  const u32 page = *physical_address & ~(FASTMEM_PROTECTION_PAGE_SIZE - 1);
+  if (m_write_watched_pages.erase(page) == 0)
+    return false;
+
+  // The write happens after this returns, so the page has to stay unwatched until someone asks to
+  // watch it again, which protects it first.
+  GetWriteWatchToken(page)->store(0, std::memory_order_release);
+  UpdateFastmemPageProtection(page);
+  return true;
+}
+
+void MemoryManager::SetWriteWatchAllowed(bool allowed)
+{
+  // This is called whenever the JIT updates its memory base, which usually changes nothing.
+  if (m_write_watch_allowed.load(std::memory_order_relaxed) == allowed)
+    return;
+
+  if (m_write_watch_allowed.exchange(allowed) && !allowed)
+    ResetWriteWatches();
+}
+
+void MemoryManager::ResetWriteWatches()
+{
+  std::lock_guard lock(m_fastmem_protection_lock);
+
+  const size_t page_count =
+      (GetRamSize() + (m_exram ? GetExRamSize() : 0)) / FASTMEM_PROTECTION_PAGE_SIZE;
+  for (size_t i = 0; m_write_watch_tokens && i < page_count; ++i)
+    m_write_watch_tokens[i].store(0, std::memory_order_release);
 }
 
 void MemoryManager::DoState(PointerWrap& p)
@@ -337,6 +601,9 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (p.IsReadMode())
+    ResetWriteWatches();
 }
 
 void MemoryManager::Shutdown()
@@ -353,6 +620,9 @@ void MemoryManager::Shutdown()
     *region.out_pointer = nullptr;
   }
   m_arena.ReleaseSHMSegment();
+  m_write_watch_tokens.reset();
+  if (m_mmio_mapping && m_mmio_mapping->IsCollectingAccessStats())
+    m_mmio_mapping->LogAccessStats();
   m_mmio_mapping.reset();
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
@@ -377,6 +647,13 @@ void MemoryManager::ShutdownFastmemArena()
   }
   m_logical_mapped_entries.clear();
 
+  {
+    std::lock_guard lock(m_fastmem_protection_lock);
+    m_write_protected_pages.clear();
+    m_write_watched_pages.clear();
+  }
+  ResetWriteWatches();
+
   m_arena.ReleaseMemoryRegion();
 
   m_fastmem_arena = nullptr;
@@ -397,6 +674,7 @@ void MemoryManager::Clear()
     memset(m_fake_vmem, 0, GetFakeVMemSize());
   if (m_exram)
     memset(m_exram, 0, GetExRamSize());
+  ResetWriteWatches();
 }
 
 u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
@@ -446,6 +724,7 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+  NotifyWrite(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -460,6 +739,7 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+  NotifyWrite(address, size);
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
@@ -4,7 +4,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <span>
 #include <string>
 #include <vector>
@@ -54,6 +58,7 @@ struct LogicalMemoryView
 {
   void* mapped_pointer;
   u32 mapped_size;
+  u32 physical_address;
 };
 
 class MemoryManager
@@ -101,6 +106,33 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Write protection of the fastmem views of guest RAM, used by the JIT to find out when code it
+  // has compiled gets overwritten. Only the fastmem views are protected; accesses through GetRAM()
+  // and friends are unaffected. Protection is done in pages of FASTMEM_PROTECTION_PAGE_SIZE bytes,
+  // which is a multiple of the host page size on all supported hosts.
+  static constexpr u32 FASTMEM_PROTECTION_PAGE_SIZE = 0x4000;
+  bool WriteProtectFastmemPage(u32 physical_address);
+  void UnprotectFastmemPage(u32 physical_address);
+  void UnprotectAllFastmemPages();
+  // If the given host address in the fastmem arena belongs to a write protected page, returns the
+  // physical address of that page.
+  std::optional<u32> GetWriteProtectedFastmemPage(const u8* address) const;
+
+  // Write watching of guest RAM, used by the video backend to skip rehashing memory that hasn't
+  // changed. WatchWrites protects the fastmem views of the range and returns a nonzero token, or 0
+  // if the range can't be watched, and WasWrittenSince tells whether the range may have been
+  // written since the token was handed out. Writes that don't go through the fastmem views must be
+  // reported with NotifyWrite. All of these may be called from any thread.
+  u64 WatchWrites(u32 physical_address, u32 size);
+  bool WasWrittenSince(u32 physical_address, u32 size, u64 token) const;
+  void NotifyWrite(u32 physical_address, size_t size);
+  // Called by the fault handler. Returns true if the given host address belongs to a write watched
+  // page, in which case the page has been made writable again.
+  bool HandleWriteWatchFault(const u8* address);
+  // Write watching only works when guest memory is accessed through the fastmem arena. While it
+  // isn't allowed, no range can be watched and all ranges count as written.
+  void SetWriteWatchAllowed(bool allowed);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -153,6 +185,7 @@ public:
 
     for (size_t i = 0; i < size / sizeof(T); i++)
       dest[i] = Common::FromBigEndian(data[i]);
+    NotifyWrite(address, size);
   }
 
 private:
@@ -195,6 +228,8 @@ private:
   u32 m_exram_mask = 0;
 
   bool m_is_fastmem_arena_initialized = false;
+  // Whether the views of guest memory are backed by huge pages where the OS allows it.
+  bool m_use_huge_pages = false;
 
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
@@ -249,11 +284,29 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Physical addresses of the pages whose fastmem views are write protected.
+  std::set<u32> m_write_protected_pages;
+  // Physical addresses of the pages whose fastmem views are write watched.
+  std::set<u32> m_write_watched_pages;
+  // Guards the two sets above and the protection of the views.
+  mutable std::mutex m_fastmem_protection_lock;
+
+  // For each page of RAM and EXRAM, the token handed out when it was last watched, or 0 if it may
+  // have been written since.
+  std::unique_ptr<std::atomic<u64>[]> m_write_watch_tokens;
+  u64 m_last_write_watch_token = 0;
+  std::atomic<bool> m_write_watch_allowed{true};
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  void SetFastmemPageWritable(u32 page, bool writable);
+  void UpdateFastmemPageProtection(u32 page);
+  std::optional<u32> GetFastmemPhysicalAddress(const u8* address) const;
+  std::atomic<u64>* GetWriteWatchToken(u32 page) const;
+  void ResetWriteWatches();
 };
 }  // namespace Memory
@@ -3,12 +3,15 @@
 
 #include "Core/HW/SI/SI_DeviceGBAEmu.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/GBACore.h"
@@ -27,9 +30,20 @@ static s64 GetSyncInterval(const SystemTimers::SystemTimersManager& timers)
   return timers.GetTicksPerSecond() / 1000;
 }
 
+static s64 GetSyncWindow(const SystemTimers::SystemTimersManager& timers)
+{
+  // The window changes when the cores see joybus commands, so all NetPlay clients must agree on it.
+  if (NetPlay::IsNetPlayRunning())
+    return 0;
+
+  const s64 window_us = std::max(Config::Get(Config::MAIN_GBA_SYNC_WINDOW_US), 0);
+  return static_cast<s64>(timers.GetTicksPerSecond()) * window_us / 1000000;
+}
+
 CSIDevice_GBAEmu::CSIDevice_GBAEmu(Core::System& system, SIDevices device, int device_number)
     : ISIDevice(system, device, device_number)
 {
+  m_sync_window = GetSyncWindow(system.GetSystemTimers());
   m_core = std::make_shared<HW::GBA::Core>(system, m_device_number);
   m_core->Start(system.GetCoreTiming().GetTicks());
   m_gbahost = Host_CreateGBAHost(m_core);
@@ -64,12 +78,18 @@ int CSIDevice_GBAEmu::RunBuffer(u8* buffer, int request_length)
     si.RemoveEvent(m_device_number);
     si.ScheduleEvent(m_device_number,
                      TransferInterval() + GetSyncInterval(m_system.GetSystemTimers()));
-    for (int i = 0; i < MAX_SI_CHANNELS; ++i)
+
+    // Cores running inside a sync window are kept ahead by their regular sync events, so the other
+    // cores only need to be brought forward when they run in lockstep.
+    if (m_sync_window < TransferInterval())
     {
-      if (i == m_device_number || si.GetDeviceType(i) != GetDeviceType())
-        continue;
-      si.RemoveEvent(i);
-      si.ScheduleEvent(i, 0, static_cast<u64>(TransferInterval()));
+      for (int i = 0; i < MAX_SI_CHANNELS; ++i)
+      {
+        if (i == m_device_number || si.GetDeviceType(i) != GetDeviceType())
+          continue;
+        si.RemoveEvent(i);
+        si.ScheduleEvent(i, 0, static_cast<u64>(TransferInterval()));
+      }
     }
 
     m_next_action = NextAction::WaitTransferTime;
@@ -167,7 +187,8 @@ void CSIDevice_GBAEmu::DoState(PointerWrap& p)
 
 void CSIDevice_GBAEmu::OnEvent(u64 userdata, s64 cycles_late)
 {
-  m_core->SendJoybusCommand(m_system.GetCoreTiming().GetTicks() + userdata, 0, nullptr, m_keys);
+  m_core->SendJoybusCommand(m_system.GetCoreTiming().GetTicks() + userdata + m_sync_window, 0,
+                            nullptr, m_keys);
 
   const auto num_cycles = userdata + GetSyncInterval(m_system.GetSystemTimers());
   m_system.GetSerialInterface().ScheduleEvent(m_device_number, num_cycles);
@@ -879,7 +879,10 @@ void VideoInterfaceManager::Update(u64 ticks)
   // dealing with SI polls, but after potentially sending a swap request to the GPU thread
 
   if (m_half_line_count == 0 || m_half_line_count == GetHalfLinesPerEvenField())
+  {
+    m_system.GetCoreTiming().ThrottleField();
     Core::Callback_NewField(m_system);
+  }
 
   // If an SI poll is scheduled to happen on this half-line, do it!
 
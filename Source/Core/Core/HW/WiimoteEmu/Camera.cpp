@@ -64,9 +64,19 @@ CameraLogic::GetCameraPoints(const Common::Matrix44& transform, Common::Vec2 fie
       Vec3{SENSOR_BAR_LED_SEPARATION / 2, 0, 0},
   };
 
-  const auto camera_view =
-      Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
-      Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4))) * transform;
+  // The projection only depends on the field of view setting, which practically never changes,
+  // so keep the last one around instead of redoing the trigonometry on every update.
+  static thread_local Common::Vec2 s_projection_fov{};
+  static thread_local Matrix44 s_projection = Matrix44::Identity();
+  if (field_of_view.x != s_projection_fov.x || field_of_view.y != s_projection_fov.y)
+  {
+    s_projection =
+        Matrix44::Perspective(field_of_view.y, field_of_view.x / field_of_view.y, 0.001f, 1000) *
+        Matrix44::FromMatrix33(Matrix33::RotateX(float(MathUtil::TAU / 4)));
+    s_projection_fov = field_of_view;
+  }
+
+  const auto camera_view = s_projection * transform;
 
   std::array<CameraPoint, CameraLogic::NUM_POINTS> camera_points;
 
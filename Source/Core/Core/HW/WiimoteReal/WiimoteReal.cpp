@@ -330,25 +330,37 @@ void Wiimote::Read()
 
 bool Wiimote::Write()
 {
-  // nothing written, but this is not an error
-  if (m_write_reports.Empty())
-    return true;
+  // Write a few queued reports per loop iteration rather than one, as each leftover report used to
+  // cost an IOWakeup() and a trip through the blocking Read() just to get back here.
+  // The batch is kept small so pending input reports are still read promptly.
+  constexpr int MAX_REPORTS_PER_ITERATION = 4;
 
-  Report const& rpt = m_write_reports.Front();
-
-  if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+  for (int i = 0; i != MAX_REPORTS_PER_ITERATION; ++i)
   {
-    static sf::UdpSocket Socket;
-    Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost, m_balance_board_dump_port);
-  }
-  int ret = IOWrite(rpt.data(), rpt.size());
+    // nothing written, but this is not an error
+    if (m_write_reports.Empty())
+      return true;
 
-  m_write_reports.Pop();
+    Report const& rpt = m_write_reports.Front();
+
+    if (m_balance_board_dump_port > 0 && m_index == WIIMOTE_BALANCE_BOARD)
+    {
+      static sf::UdpSocket Socket;
+      Socket.send((char*)rpt.data(), rpt.size(), sf::IpAddress::LocalHost,
+                  m_balance_board_dump_port);
+    }
+    int ret = IOWrite(rpt.data(), rpt.size());
+
+    m_write_reports.Pop();
+
+    if (ret == 0)
+      return false;
+  }
 
   if (!m_write_reports.Empty())
     IOWakeup();
 
-  return ret != 0;
+  return true;
 }
 
 bool Wiimote::IsBalanceBoard()
@@ -7,6 +7,7 @@
 #include <array>
 #include <cctype>
 #include <functional>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -189,11 +190,26 @@ ESCore::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
 
   std::vector<ES::Content> stored_contents;
 
+  // The shared content map is only needed for shared contents, and a TMD can reference many of
+  // them, so read it once here rather than once per content like GetContentPath() would.
+  std::optional<ES::SharedContentMap> shared_content_map;
+
   std::copy_if(contents.begin(), contents.end(), std::back_inserter(stored_contents),
-               [this, &tmd, check_content_hashes](const ES::Content& content) {
+               [this, &tmd, &shared_content_map,
+                check_content_hashes](const ES::Content& content) {
                  const auto fs = m_ios.GetFS();
 
-                 const std::string path = GetContentPath(tmd.GetTitleId(), content);
+                 std::string path;
+                 if (content.IsShared())
+                 {
+                   if (!shared_content_map)
+                     shared_content_map.emplace(m_ios.GetFSCore());
+                   path = shared_content_map->GetFilenameFromSHA1(content.sha1).value_or("");
+                 }
+                 else
+                 {
+                   path = GetContentPath(tmd.GetTitleId(), content);
+                 }
                  if (path.empty())
                    return false;
 
@@ -207,10 +223,20 @@ ESCore::GetStoredContentsFromTMD(const ES::TMDReader& tmd,
                    return true;
 
                  // Otherwise, check whether the installed content SHA1 matches the expected hash.
-                 std::vector<u8> content_data(file->GetStatus()->size);
-                 if (!file->Read(content_data.data(), content_data.size()))
-                   return false;
-                 return Common::SHA1::CalculateDigest(content_data) == content.sha1;
+                 // Hash in fixed-size pieces so that large contents aren't read into memory whole.
+                 constexpr size_t CHUNK_SIZE = 1024 * 1024;
+                 auto context = Common::SHA1::CreateContext();
+                 const size_t size = file->GetStatus()->size;
+                 std::vector<u8> buffer(std::min(size, CHUNK_SIZE));
+                 for (size_t remaining = size; remaining != 0;)
+                 {
+                   const size_t chunk = std::min(remaining, CHUNK_SIZE);
+                   if (!file->Read(buffer.data(), chunk))
+                     return false;
+                   context->Update(buffer.data(), chunk);
+                   remaining -= chunk;
+                 }
+                 return context->Finish() == content.sha1;
                });
 
   return stored_contents;
@@ -210,6 +210,8 @@ void HostFileSystem::LoadFst()
 
 void HostFileSystem::SaveFst()
 {
+  m_root_stats_cache.reset();
+
   std::vector<SerializedFstEntry> to_write;
   auto collect_entries = [&to_write](const auto& collect, const FstEntry& entry) -> void {
     SerializedFstEntry& serialized = to_write.emplace_back();
@@ -373,6 +375,8 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  m_root_stats_cache.reset();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -822,6 +826,10 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   if (!IsValidPath(wii_path))
     return ResultCode::Invalid;
 
+  const bool is_root = wii_path == "/";
+  if (is_root && m_root_stats_cache)
+    return *m_root_stats_cache;
+
   ExtendedDirectoryStats stats{};
   std::string path(BuildFilename(wii_path).host_path);
   File::FileInfo info(path);
@@ -832,7 +840,7 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   if (info.IsDirectory())
   {
     File::FSTEntry parent_dir = File::ScanDirectoryTree(path, true);
-    FixupDirectoryEntries(&parent_dir, wii_path == "/");
+    FixupDirectoryEntries(&parent_dir, is_root);
 
     // add one for the folder itself
     stats.used_inodes = 1 + parent_dir.size;
@@ -842,11 +850,15 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
   {
     return ResultCode::Invalid;
   }
+
+  if (is_root)
+    m_root_stats_cache = stats;
   return stats;
 }
 
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  m_root_stats_cache.reset();
 }
 }  // namespace IOS::HLE::FS
@@ -6,6 +6,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -125,6 +126,11 @@ private:
 
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
+
+  /// Stats for the filesystem root. Computing them means walking the entire NAND, and titles
+  /// query free space repeatedly while saving, so they are kept until the next change made
+  /// through this backend (any FST update, file write, state load or redirect change).
+  std::optional<ExtendedDirectoryStats> m_root_stats_cache;
 };
 
 }  // namespace IOS::HLE::FS
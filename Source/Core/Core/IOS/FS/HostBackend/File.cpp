@@ -154,6 +154,7 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
     return ResultCode::AccessDenied;
 
   handle->file_offset += count;
+  m_root_stats_cache.reset();
   return count;
 }
 
@@ -188,6 +188,27 @@ static std::vector<u8> ReadCertFile(const std::string& path, const std::array<u8
   return bytes;
 }
 
+const std::vector<u8>& NetSSLDevice::GetCertFile(const std::string& file_name,
+                                                 const std::array<u8, 32>& correct_hash)
+{
+  if (const auto it = m_cert_files.find(file_name); it != m_cert_files.end())
+    return it->second;
+
+  const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
+  std::vector<u8> bytes = ReadCertFile(cert_base_path + "/" + file_name, correct_hash,
+                                       m_cert_error_shown);
+  // If any of the required files fail to load, show a panic alert, but only once
+  // per IOS instance (usually once per emulation session).
+  if (bytes.empty())
+  {
+    m_cert_error_shown = true;
+    static const std::vector<u8> empty;
+    return empty;
+  }
+
+  return m_cert_files.emplace(file_name, std::move(bytes)).first->second;
+}
+
 std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
 {
   u32 BufferIn = 0, BufferIn2 = 0, BufferIn3 = 0;
@@ -392,15 +413,8 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
-      const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
-      const std::vector<u8> client_cert =
-          ReadCertFile(cert_base_path + "/clientca.pem", s_client_cert_hash, m_cert_error_shown);
-      const std::vector<u8> client_key =
-          ReadCertFile(cert_base_path + "/clientcakey.pem", s_client_key_hash, m_cert_error_shown);
-      // If any of the required files fail to load, show a panic alert, but only once
-      // per IOS instance (usually once per emulation session).
-      if (client_cert.empty() || client_key.empty())
-        m_cert_error_shown = true;
+      const std::vector<u8>& client_cert = GetCertFile("clientca.pem", s_client_cert_hash);
+      const std::vector<u8>& client_key = GetCertFile("clientcakey.pem", s_client_key_hash);
 
       int ret = mbedtls_x509_crt_parse(&ssl->clicert, client_cert.data(), client_cert.size());
       int pk_ret = mbedtls_pk_parse_key(&ssl->pk, client_key.data(), client_key.size(), nullptr, 0);
@@ -458,11 +472,7 @@ std::optional<IPCReply> NetSSLDevice::IOCtlV(const IOCtlVRequest& request)
     if (IsSSLIDValid(sslID))
     {
       WII_SSL* ssl = &_SSL[sslID];
-      const std::string cert_base_path = File::GetUserPath(D_SESSION_WIIROOT_IDX);
-      const std::vector<u8> root_ca =
-          ReadCertFile(cert_base_path + "/rootca.pem", s_root_ca_hash, m_cert_error_shown);
-      if (root_ca.empty())
-        m_cert_error_shown = true;
+      const std::vector<u8>& root_ca = GetCertFile("rootca.pem", s_root_ca_hash);
 
       int ret = mbedtls_x509_crt_parse(&ssl->cacert, root_ca.data(), root_ca.size());
       if (ret)
@@ -13,7 +13,9 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl.h>
 #include <mbedtls/x509_crt.h>
+#include <map>
 #include <string>
+#include <vector>
 
 // clang-format on
 
@@ -94,7 +96,13 @@ public:
   static WII_SSL _SSL[NET_SSL_MAXINSTANCES];
 
 private:
+  const std::vector<u8>& GetCertFile(const std::string& file_name,
+                                     const std::array<u8, 32>& correct_hash);
+
   bool m_cert_error_shown = false;
+  // Contents of the certificate files that passed the hash check, by file name. Titles set these
+  // on every new connection, so this avoids reading and hashing them from disk each time.
+  std::map<std::string, std::vector<u8>> m_cert_files;
 };
 
 constexpr bool IsSSLIDValid(int id)
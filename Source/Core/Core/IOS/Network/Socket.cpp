@@ -1000,10 +1000,15 @@ void WiiSockMan::Update()
     const WiiSocket& sock = socket_iter->second;
     if (sock.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      // Only sockets with pending operations have anything to do with the select results, and
+      // titles tend to keep many idle sockets open.
+      if (!sock.pending_sockops.empty())
+      {
+        FD_SET(sock.fd, &read_fds);
+        FD_SET(sock.fd, &write_fds);
+        FD_SET(sock.fd, &except_fds);
+        nfds = std::max(nfds, sock.fd + 1);
+      }
       ++socket_iter;
     }
     else
@@ -1013,6 +1018,12 @@ void WiiSockMan::Update()
     }
   }
 
+  if (nfds == 0)
+  {
+    UpdatePollCommands();
+    return;
+  }
+
   const s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
 
   if (ret >= 0)
@@ -1020,6 +1031,8 @@ void WiiSockMan::Update()
     for (auto& pair : WiiSockets)
     {
       WiiSocket& sock = pair.second;
+      if (sock.pending_sockops.empty())
+        continue;
       sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
                   FD_ISSET(sock.fd, &except_fds) != 0);
     }
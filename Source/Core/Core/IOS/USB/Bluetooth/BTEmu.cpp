@@ -239,6 +239,13 @@ void BluetoothEmuDevice::IncDataPacket(u16 connection_handle)
 // The header is for example 07 00 41 00 which means size 0x0007 and channel 0x0041.
 void BluetoothEmuDevice::SendACLPacket(const bdaddr_t& source, const u8* data, u32 size)
 {
+  SendACLPacket(source, std::span<const u8>(data, size), {});
+}
+
+void BluetoothEmuDevice::SendACLPacket(const bdaddr_t& source, std::span<const u8> header,
+                                       std::span<const u8> payload)
+{
+  const u32 size = static_cast<u32>(header.size() + payload.size());
   const u16 connection_handle = GetConnectionHandle(source);
 
   DEBUG_LOG_FMT(IOS_WIIMOTE, "ACL packet from {:x} ready to send to stack...", connection_handle);
@@ -251,13 +258,20 @@ void BluetoothEmuDevice::SendACLPacket(const bdaddr_t& source, const u8* data, u
     auto& system = GetSystem();
     auto& memory = system.GetMemory();
 
-    hci_acldata_hdr_t* header = reinterpret_cast<hci_acldata_hdr_t*>(
-        memory.GetPointerForRange(m_acl_endpoint->data_address, sizeof(hci_acldata_hdr_t)));
-    header->con_handle = HCI_MK_CON_HANDLE(connection_handle, HCI_PACKET_START, HCI_POINT2POINT);
-    header->length = size;
+    u8* const buffer = memory.GetPointerForRange(m_acl_endpoint->data_address,
+                                                 sizeof(hci_acldata_hdr_t) + size);
+    if (!buffer)
+      return;
+
+    hci_acldata_hdr_t* acl_header = reinterpret_cast<hci_acldata_hdr_t*>(buffer);
+    acl_header->con_handle =
+        HCI_MK_CON_HANDLE(connection_handle, HCI_PACKET_START, HCI_POINT2POINT);
+    acl_header->length = size;
 
     // Write the packet to the buffer
-    memcpy(reinterpret_cast<u8*>(header) + sizeof(hci_acldata_hdr_t), data, header->length);
+    u8* const data = buffer + sizeof(hci_acldata_hdr_t);
+    std::copy(header.begin(), header.end(), data);
+    std::copy(payload.begin(), payload.end(), data + header.size());
 
     GetEmulationKernel().EnqueueIPCReply(m_acl_endpoint->ios_request,
                                          sizeof(hci_acldata_hdr_t) + size);
@@ -266,7 +280,7 @@ void BluetoothEmuDevice::SendACLPacket(const bdaddr_t& source, const u8* data, u
   else
   {
     DEBUG_LOG_FMT(IOS_WIIMOTE, "ACL endpoint not currently valid, queuing...");
-    m_acl_pool.Store(data, size, connection_handle);
+    m_acl_pool.Store(header, payload, connection_handle);
   }
 }
 
@@ -399,7 +413,8 @@ void BluetoothEmuDevice::Update()
   SendEventNumberOfCompletedPackets();
 }
 
-void BluetoothEmuDevice::ACLPool::Store(const u8* data, const u16 size, const u16 conn_handle)
+void BluetoothEmuDevice::ACLPool::Store(std::span<const u8> header, std::span<const u8> payload,
+                                        const u16 conn_handle)
 {
   if (m_queue.size() >= 100)
   {
@@ -408,13 +423,15 @@ void BluetoothEmuDevice::ACLPool::Store(const u8* data, const u16 size, const u1
     return;
   }
 
+  const size_t size = header.size() + payload.size();
   DEBUG_ASSERT_MSG(IOS_WIIMOTE, size < ACL_PKT_SIZE, "ACL packet too large for pool");
 
   m_queue.push_back(Packet());
   auto& packet = m_queue.back();
 
-  std::copy(data, data + size, packet.data);
-  packet.size = size;
+  std::copy(header.begin(), header.end(), packet.data);
+  std::copy(payload.begin(), payload.end(), packet.data + header.size());
+  packet.size = static_cast<u16>(size);
   packet.conn_handle = conn_handle;
 }
 
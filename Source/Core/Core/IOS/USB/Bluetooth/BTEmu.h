@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <deque>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -50,6 +51,10 @@ public:
 
   // Send ACL data back to Bluetooth stack
   void SendACLPacket(const bdaddr_t& source, const u8* data, u32 size);
+  // Same as above for a packet made of a header and a payload, which are written to the guest
+  // buffer directly instead of being assembled in a temporary buffer first.
+  void SendACLPacket(const bdaddr_t& source, std::span<const u8> header,
+                     std::span<const u8> payload);
 
   // Returns true if controller is configured to see the connection request.
   bool RemoteConnect(WiimoteDevice&);
@@ -75,7 +80,7 @@ private:
   {
   public:
     explicit ACLPool(EmulationKernel& ios) : m_ios(ios), m_queue() {}
-    void Store(const u8* data, const u16 size, const u16 conn_handle);
+    void Store(std::span<const u8> header, std::span<const u8> payload, const u16 conn_handle);
 
     void WriteToEndpoint(const USB::V0BulkMessage& endpoint);
 
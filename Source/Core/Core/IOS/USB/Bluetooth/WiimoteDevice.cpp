@@ -5,6 +5,7 @@
 
 #include <cstring>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -985,25 +986,28 @@ void WiimoteDevice::InterruptDataInputCallback(u8 hid_type, const u8* data, u32
     return;
   }
 
-  struct DataFrame
+  // The report is passed to the host separately from its headers, so that it is only copied once.
+  struct DataFrameHeader
   {
     l2cap_hdr_t header;
     u8 hid_type;
-    std::array<u8, WiimoteCommon::MAX_PAYLOAD - sizeof(hid_type)> data;
-  } data_frame;
+  } data_frame_header;
 
-  static_assert(sizeof(data_frame) == sizeof(data_frame.data) + sizeof(u8) + sizeof(l2cap_hdr_t));
+  static_assert(sizeof(data_frame_header) == sizeof(u8) + sizeof(l2cap_hdr_t));
 
-  data_frame.header.dcid = channel->remote_cid;
-  data_frame.header.length = u16(sizeof(hid_type) + size);
-  data_frame.hid_type = hid_type;
-  std::copy_n(data, size, data_frame.data.data());
+  DEBUG_ASSERT(sizeof(hid_type) + size <= WiimoteCommon::MAX_PAYLOAD);
 
-  const u32 data_frame_size = data_frame.header.length + sizeof(l2cap_hdr_t);
+  data_frame_header.header.dcid = channel->remote_cid;
+  data_frame_header.header.length = u16(sizeof(hid_type) + size);
+  data_frame_header.hid_type = hid_type;
+
+  const u32 data_frame_size = data_frame_header.header.length + sizeof(l2cap_hdr_t);
 
   // This should never be a problem as l2cap requires a minimum MTU of 48 bytes.
   DEBUG_ASSERT(data_frame_size <= channel->remote_mtu);
 
-  m_host->SendACLPacket(GetBD(), reinterpret_cast<const u8*>(&data_frame), data_frame_size);
+  const auto* const header_bytes = reinterpret_cast<const u8*>(&data_frame_header);
+  m_host->SendACLPacket(GetBD(), std::span<const u8>(header_bytes, sizeof(data_frame_header)),
+                        std::span<const u8>(data, size));
 }
 }  // namespace IOS::HLE
@@ -17,12 +17,17 @@ namespace IOS::HLE::USB
 {
 std::unique_ptr<u8[]> TransferCommand::MakeBuffer(const size_t size) const
 {
-  ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
   auto buffer = std::make_unique<u8[]>(size);
+  ReadBuffer(buffer.get(), size);
+  return buffer;
+}
+
+void TransferCommand::ReadBuffer(u8* dst, const size_t size) const
+{
+  ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
   auto& system = m_ios.GetSystem();
   auto& memory = system.GetMemory();
-  memory.CopyFromEmu(buffer.get(), data_address, size);
-  return buffer;
+  memory.CopyFromEmu(dst, data_address, size);
 }
 
 void TransferCommand::FillBuffer(const u8* src, const size_t size) const
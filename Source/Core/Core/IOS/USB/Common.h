@@ -111,6 +111,7 @@ struct TransferCommand
   virtual void OnTransferComplete(s32 return_value) const;
   void ScheduleTransferCompletion(s32 return_value, u32 expected_time_us) const;
   std::unique_ptr<u8[]> MakeBuffer(size_t size) const;
+  void ReadBuffer(u8* dst, size_t size) const;
   void FillBuffer(const u8* src, size_t size) const;
 
 protected:
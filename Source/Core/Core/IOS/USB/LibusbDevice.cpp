@@ -303,12 +303,12 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
                 "[{:04x}:{:04x} {}] Isochronous: length={:04x} endpoint={:02x} num_packets={:02x}",
                 m_vid, m_pid, m_active_interface, cmd->length, cmd->endpoint, cmd->num_packets);
 
-  libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
-  transfer->buffer = cmd->MakeBuffer(cmd->length).release();
+  TransferEndpoint& endpoint = m_transfer_endpoints[cmd->endpoint];
+  libusb_transfer* transfer = endpoint.GetIsoTransfer(cmd->num_packets, cmd->length);
+  cmd->ReadBuffer(transfer->buffer, cmd->length);
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
-  transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   for (size_t i = 0; i < cmd->num_packets; ++i)
     transfer->iso_packet_desc[i].length = cmd->packet_sizes[i];
   transfer->length = cmd->length;
@@ -316,7 +316,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
   transfer->timeout = 0;
   transfer->type = LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
   transfer->user_data = this;
-  m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
+  endpoint.AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
 }
 
@@ -360,6 +360,40 @@ static const std::map<u8, const char*> s_transfer_types = {
     {LIBUSB_TRANSFER_TYPE_INTERRUPT, "Interrupt"},
 };
 
+LibusbDevice::TransferEndpoint::~TransferEndpoint()
+{
+  for (const IsoTransfer& iso_transfer : m_iso_transfers)
+    libusb_free_transfer(iso_transfer.transfer);
+}
+
+libusb_transfer* LibusbDevice::TransferEndpoint::GetIsoTransfer(const u8 num_packets,
+                                                                const u32 length)
+{
+  std::lock_guard lk{m_transfers_mutex};
+  auto it = std::ranges::find_if(m_iso_transfers, [&](const IsoTransfer& iso_transfer) {
+    return !iso_transfer.in_use && iso_transfer.max_packets >= num_packets &&
+           iso_transfer.buffer_size >= length;
+  });
+  if (it == m_iso_transfers.end())
+  {
+    // Replace an idle transfer that is too small, or add a new one.
+    it = std::ranges::find_if(m_iso_transfers,
+                              [](const IsoTransfer& iso_transfer) { return !iso_transfer.in_use; });
+    if (it == m_iso_transfers.end())
+      it = m_iso_transfers.insert(m_iso_transfers.end(), IsoTransfer{});
+
+    libusb_free_transfer(it->transfer);
+    it->transfer = libusb_alloc_transfer(num_packets);
+    it->buffer = std::make_unique<u8[]>(length);
+    it->max_packets = num_packets;
+    it->buffer_size = length;
+  }
+
+  it->in_use = true;
+  it->transfer->buffer = it->buffer.get();
+  return it->transfer;
+}
+
 void LibusbDevice::TransferEndpoint::AddTransfer(std::unique_ptr<TransferCommand> command,
                                                  libusb_transfer* transfer)
 {
@@ -378,7 +412,9 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
     return;
   }
 
-  const std::unique_ptr<u8[]> buffer(transfer->buffer);
+  // Isochronous transfers are pooled and keep their buffer.
+  const bool is_iso = transfer->type == LIBUSB_TRANSFER_TYPE_ISOCHRONOUS;
+  const std::unique_ptr<u8[]> buffer(is_iso ? nullptr : transfer->buffer);
   const auto& cmd = *iterator->second.get();
   const auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   s32 return_value = LIBUSB_SUCCESS;
@@ -404,6 +440,13 @@ void LibusbDevice::TransferEndpoint::HandleTransfer(libusb_transfer* transfer,
   }
   cmd.OnTransferComplete(return_value);
   m_transfers.erase(transfer);
+
+  if (is_iso)
+  {
+    const auto it = std::ranges::find(m_iso_transfers, transfer, &IsoTransfer::transfer);
+    if (it != m_iso_transfers.end())
+      it->in_use = false;
+  }
 }
 
 void LibusbDevice::TransferEndpoint::CancelTransfers()
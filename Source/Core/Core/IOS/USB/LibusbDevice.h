@@ -60,13 +60,29 @@ private:
   class TransferEndpoint final
   {
   public:
+    ~TransferEndpoint();
+
     void AddTransfer(std::unique_ptr<TransferCommand> command, libusb_transfer* transfer);
     void HandleTransfer(libusb_transfer* tr, std::function<s32(const TransferCommand&)> function);
     void CancelTransfers();
 
+    // Audio and video devices keep several isochronous transfers in flight at all times, so these
+    // transfers and their buffers are reused instead of being allocated for every request.
+    libusb_transfer* GetIsoTransfer(u8 num_packets, u32 length);
+
   private:
+    struct IsoTransfer
+    {
+      libusb_transfer* transfer;
+      std::unique_ptr<u8[]> buffer;
+      u8 max_packets;
+      u32 buffer_size;
+      bool in_use;
+    };
+
     std::mutex m_transfers_mutex;
     std::map<libusb_transfer*, std::unique_ptr<TransferCommand>> m_transfers;
+    std::vector<IsoTransfer> m_iso_transfers;
   };
   std::map<u8, TransferEndpoint> m_transfer_endpoints;
   static void CtrlTransferCallback(libusb_transfer* transfer);
@@ -6,6 +6,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <unistd.h>
 
@@ -39,23 +40,31 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  // Address as stored in the file -> list of offsets to follow
+  std::map<std::string, std::vector<u32>> addresses;
   std::string line;
   while (std::getline(locations, line))
-    ParseLine(line);
+    addresses.emplace(line, ParseLine(line));
 
-  return !m_values.empty();
+  // Watched values are looked up every frame, so store them flat rather than keyed by string.
+  m_watches.reserve(addresses.size());
+  for (auto& [address, offsets] : addresses)
+    m_watches.push_back({address, std::move(offsets)});
+
+  return !m_watches.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+std::vector<u32> MemoryWatcher::ParseLine(const std::string& line)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  std::vector<u32> result;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+    result.push_back(offset);
+
+  return result;
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,10 +76,11 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard,
+                                const std::vector<u32>& offsets)
 {
   u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (u32 offset : offsets)
   {
     value = PowerPC::MMU::HostRead_U32(guard, value + offset);
     if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
@@ -84,17 +94,14 @@ std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (WatchEntry& entry : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    const u32 new_value = ChasePointer(guard, entry.offsets);
+    if (new_value != entry.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      entry.value = new_value;
+      message_stream << entry.address << '\n' << new_value << '\n';
     }
   }
 
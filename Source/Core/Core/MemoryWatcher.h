@@ -5,7 +5,6 @@
 
 #include "Common/CommonTypes.h"
 
-#include <map>
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -32,11 +31,20 @@ public:
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  struct WatchEntry
+  {
+    // Address as stored in the file
+    std::string address;
+    // List of offsets to follow
+    std::vector<u32> offsets;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
+  static std::vector<u32> ParseLine(const std::string& line);
+  static u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::vector<u32>& offsets);
   std::string ComposeMessages(const Core::CPUThreadGuard& guard);
 
   bool m_running = false;
@@ -44,8 +52,6 @@ private:
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  // Sorted by address, so that changes are reported in the same order as before.
+  std::vector<WatchEntry> m_watches;
 };
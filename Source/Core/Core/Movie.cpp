@@ -34,6 +34,9 @@
 #include "Common/Timer.h"
 #include "Common/Version.h"
 
+#include "AudioCommon/AudioCommon.h"
+#include "AudioCommon/SoundStream.h"
+
 #include "Core/AchievementManager.h"
 #include "Core/Boot/Boot.h"
 #include "Core/Config/AchievementSettings.h"
@@ -73,6 +76,7 @@
 
 #include "InputCommon/GCPadStatus.h"
 
+#include "VideoCommon/Present.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -196,6 +200,14 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  const u64 seek_target = m_seek_target_frame;
+  if (seek_target != 0 && m_current_frame >= seek_target)
+  {
+    CancelSeek();
+    m_system.GetCPU().Break();
+    Core::DisplayMessage(fmt::format("Reached frame {}", m_current_frame), 2000);
+  }
 }
 
 // called when game is booting up, even if no movie is active,
@@ -346,6 +358,46 @@ u64 MovieManager::GetTotalLagCount() const
   return m_total_lag_count;
 }
 
+// NOTE: Host Thread
+bool MovieManager::SeekToFrame(u64 frame)
+{
+  if (!IsPlayingInput() || frame <= m_current_frame || frame > m_total_frames)
+    return false;
+
+  if (m_seek_target_frame.exchange(frame) == 0)
+  {
+    m_emulation_speed_before_seek = Config::Get(Config::MAIN_EMULATION_SPEED);
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    if (g_presenter)
+      g_presenter->SetSkipPresenting(true);
+    if (SoundStream* sound_stream = m_system.GetSoundStream())
+      sound_stream->SetVolume(0);
+  }
+
+  Core::DisplayMessage(fmt::format("Seeking to frame {}", frame), 2000);
+  if (Core::GetState(m_system) == Core::State::Paused)
+    Core::SetState(m_system, Core::State::Running);
+  return true;
+}
+
+void MovieManager::CancelSeek()
+{
+  if (m_seek_target_frame.exchange(0) == 0)
+    return;
+
+  Core::QueueHostJob([this](Core::System& system) {
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, m_emulation_speed_before_seek);
+    if (g_presenter)
+      g_presenter->SetSkipPresenting(false);
+    AudioCommon::UpdateSoundStream(system);
+  });
+}
+
+bool MovieManager::IsSeeking() const
+{
+  return m_seek_target_frame != 0;
+}
+
 void MovieManager::SetClearSave(bool enabled)
 {
   m_clear_save = enabled;
@@ -1339,6 +1391,8 @@ void MovieManager::EndPlayInput(bool cont)
   }
   else if (m_play_mode != PlayMode::None)
   {
+    CancelSeek();
+
     // We can be called by EmuThread during boot (CPU::State::PowerDown)
     auto& cpu = m_system.GetCPU();
     const bool was_running = Core::IsRunningAndStarted() && !cpu.IsStepping();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <mutex>
 #include <optional>
@@ -183,6 +184,13 @@ public:
   u64 GetCurrentLagCount() const;
   u64 GetTotalLagCount() const;
 
+  // Plays the movie back as fast as possible, without presenting frames or outputting audio,
+  // until the given frame is reached, and then pauses. Returns false if no movie is being played
+  // or the frame is not ahead of the current one.
+  bool SeekToFrame(u64 frame);
+  void CancelSeek();
+  bool IsSeeking() const;
+
   void SetClearSave(bool enabled);
   void SignalDiscChange(const std::string& new_path);
   void SetReset(bool reset);
@@ -236,6 +244,10 @@ private:
   u32 m_rerecords = 0;
   PlayMode m_play_mode = PlayMode::None;
 
+  // The frame that playback is seeking to, or 0 if not seeking
+  std::atomic<u64> m_seek_target_frame = 0;
+  float m_emulation_speed_before_seek = 1.0f;
+
   std::array<ControllerType, 4> m_controllers{};
   std::array<bool, 4> m_wiimotes{};
   ControllerState m_pad_state{};
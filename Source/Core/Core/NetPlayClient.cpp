@@ -1530,8 +1530,24 @@ void NetPlayClient::DisplayPlayersPing()
   if (!g_ActiveConfig.bShowNetPlayPing)
     return;
 
-  OSD::AddTypedMessage(OSD::MessageType::NetPlayPing, fmt::format("Ping: {}", GetPlayersMaxPing()),
-                       OSD::Duration::SHORT, OSD::Color::CYAN);
+  std::string message = fmt::format("Ping: {}", GetPlayersMaxPing());
+  if (const u32 stall_count = m_input_stall_count; stall_count != 0)
+  {
+    message += fmt::format(" | Input stalls: {} ({} ms)", stall_count,
+                           m_input_stall_time_us.load() / 1000);
+  }
+
+  OSD::AddTypedMessage(OSD::MessageType::NetPlayPing, std::move(message), OSD::Duration::SHORT,
+                       OSD::Color::CYAN);
+}
+
+// called from ---CPU--- thread
+void NetPlayClient::RecordInputStall(u64 wait_start_us)
+{
+  const u64 stall_time_us = Common::Timer::NowUs() - wait_start_us;
+  ++m_input_stall_count;
+  m_input_stall_time_us += stall_time_us;
+  DEBUG_LOG_FMT(NETPLAY, "Waited {} us for remote input", stall_time_us);
 }
 
 u32 NetPlayClient::GetPlayersMaxPing() const
@@ -1715,8 +1731,7 @@ void NetPlayClient::AddWiimoteStateToPacket(int in_game_pad,
 {
   packet << static_cast<PadIndex>(in_game_pad);
   packet << state.length;
-  for (size_t i = 0; i < state.length; ++i)
-    packet << state.data[i];
+  packet.append(state.data.data(), state.length);
 }
 
 // called from ---GUI--- thread
@@ -1760,6 +1775,10 @@ bool NetPlayClient::StartGame(const std::string& path)
   ClearBuffers();
 
   m_first_pad_status_received.fill(false);
+  m_pad_input_started.fill(false);
+  m_wiimote_input_started.fill(false);
+  m_input_stall_count = 0;
+  m_input_stall_time_us = 0;
 
   if (m_dialog->IsRecording())
   {
@@ -2103,6 +2122,8 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
 
   // Now, we either use the data pushed earlier, or wait for the
   // other clients to send it to us
+  const u64 wait_start_us = Common::Timer::NowUs();
+  bool waited = false;
   while (m_pad_buffer[pad_nb].Size() == 0)
   {
     if (!m_is_running.IsSet())
@@ -2110,9 +2131,14 @@ bool NetPlayClient::GetNetPads(const int pad_nb, const bool batching, GCPadStatu
       return false;
     }
 
+    waited = true;
     m_gc_pad_event.Wait();
   }
 
+  if (waited && m_pad_input_started[pad_nb])
+    RecordInputStall(wait_start_us);
+  m_pad_input_started[pad_nb] = true;
+
   m_pad_buffer[pad_nb].Pop(*pad_status);
 
   auto& movie = Core::System::GetInstance().GetMovie();
@@ -2137,6 +2163,11 @@ u64 NetPlayClient::GetInitialRTCValue() const
 // called from ---CPU--- thread
 bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entries)
 {
+  // Send the states of all local Wii Remotes in one packet before waiting for any remote ones
+  sf::Packet packet;
+  packet << MessageID::WiimoteData;
+
+  bool send_packet = false;
   for (const WiimoteDataBatchEntry& entry : entries)
   {
     const int local_wiimote = InGameWiimoteToLocalWiimote(entry.wiimote);
@@ -2145,15 +2176,18 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
                   entry.wiimote, local_wiimote,
                   fmt::join(std::span(entry.state->data.data(), entry.state->length), ", "));
     if (local_wiimote < 4)
-    {
-      sf::Packet packet;
-      packet << MessageID::WiimoteData;
-      if (AddLocalWiimoteToBuffer(local_wiimote, *entry.state, packet))
-        SendAsync(std::move(packet));
-    }
+      send_packet = AddLocalWiimoteToBuffer(local_wiimote, *entry.state, packet) || send_packet;
+  }
 
+  if (send_packet)
+    SendAsync(std::move(packet));
+
+  for (const WiimoteDataBatchEntry& entry : entries)
+  {
     // Now, we either use the data pushed earlier, or wait for the
     // other clients to send it to us
+    const u64 wait_start_us = Common::Timer::NowUs();
+    bool waited = false;
     while (m_wiimote_buffer[entry.wiimote].Size() == 0)
     {
       if (!m_is_running.IsSet())
@@ -2161,9 +2195,14 @@ bool NetPlayClient::WiimoteUpdate(const std::span<WiimoteDataBatchEntry>& entrie
         return false;
       }
 
+      waited = true;
       m_wii_pad_event.Wait();
     }
 
+    if (waited && m_wiimote_input_started[entry.wiimote])
+      RecordInputStall(wait_start_us);
+    m_wiimote_input_started[entry.wiimote] = true;
+
     m_wiimote_buffer[entry.wiimote].Pop(*entry.state);
 
     DEBUG_LOG_FMT(NETPLAY, "Exiting WiimoteUpdate() with wiimote {}, state [{:02x}]", entry.wiimote,
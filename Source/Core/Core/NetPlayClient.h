@@ -5,6 +5,7 @@
 
 #include <SFML/Network/Packet.hpp>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
@@ -206,6 +207,13 @@ protected:
 
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
+  // How often and for how long the CPU thread had to wait for remote input that the pad buffer
+  // didn't cover, not counting the wait for the first input of each pad.
+  std::atomic<u32> m_input_stall_count = 0;
+  std::atomic<u64> m_input_stall_time_us = 0;
+  std::array<bool, 4> m_pad_input_started{};
+  std::array<bool, 4> m_wiimote_input_started{};
+
   NetPlayUI* m_dialog = nullptr;
 
   ENetHost* m_client = nullptr;
@@ -272,6 +280,7 @@ private:
   void SendGameStatus();
   void ComputeGameDigest(const SyncIdentifier& sync_identifier);
   void DisplayPlayersPing();
+  void RecordInputStall(u64 wait_start_us);
   u32 GetPlayersMaxPing() const;
 
   void OnData(sf::Packet& packet);
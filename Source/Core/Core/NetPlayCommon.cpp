@@ -70,10 +70,7 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
@@ -154,10 +151,7 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != LZO_IN_LEN)
       break;
@@ -197,12 +191,19 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     if (!cur_len)
       break;  // We reached the end of the data stream
 
+    if (cur_len > in_buffer.size())
+    {
+      PanicAlertFmtT("Internal LZO Error - decompression failed");
+      return false;
+    }
+
     for (size_t j = 0; j < cur_len; j++)
     {
       packet >> in_buffer[j];
     }
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
+    new_len = out_buffer.size();
+    if (lzo1x_decompress_safe(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
         LZO_E_OK)
     {
       PanicAlertFmtT("Internal LZO Error - decompression failed");
@@ -281,12 +282,21 @@ std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
     if (!cur_len)
       break;  // We reached the end of the data stream
 
+    if (cur_len > in_buffer.size())
+    {
+      PanicAlertFmtT("Internal LZO Error - decompression failed");
+      return {};
+    }
+
     for (size_t j = 0; j < cur_len; j++)
     {
       packet >> in_buffer[j];
     }
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
+    // Chunks decompress to at most LZO_IN_LEN bytes, and must not run past the announced size
+    new_len = std::min<lzo_uint>(LZO_IN_LEN, size - i);
+    if (lzo1x_decompress_safe(in_buffer.data(), cur_len, out_buffer.data() + i, &new_len,
+                              nullptr) != LZO_E_OK)
     {
       PanicAlertFmtT("Internal LZO Error - decompression failed");
       return {};
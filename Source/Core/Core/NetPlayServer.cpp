@@ -837,7 +837,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     }
     else
     {
-      SendToClients(spac, player.pid);
+      SendInputToClients(spac, player.pid);
     }
   }
   break;
@@ -869,7 +869,7 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       }
     }
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(spac, player.pid);
   }
   break;
 
@@ -903,11 +903,10 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 
       spac << map;
       spac << pad.length;
-      for (size_t i = 0; i < pad.length; ++i)
-        spac << pad.data[i];
+      spac.append(pad.data.data(), pad.length);
     }
 
-    SendToClients(spac, player.pid);
+    SendInputToClients(spac, player.pid);
   }
   break;
 
@@ -2206,6 +2205,36 @@ void NetPlayServer::Send(ENetPeer* socket, const sf::Packet& packet, const u8 ch
   Common::ENet::SendPacket(socket, packet, channel_id);
 }
 
+// called from ---NETPLAY--- thread
+void NetPlayServer::SendInputToClients(const sf::Packet& packet, const PlayerId skip_pid)
+{
+  // Players with a controller mapped stall when their input is late, spectators don't. So send
+  // the input to the players first and flush it right away, rather than letting it queue up with
+  // the copies for every spectator on the host's uplink.
+  bool has_spectators = false;
+  for (auto& p : m_players)
+  {
+    if (!p.second.pid || p.second.pid == skip_pid)
+      continue;
+
+    if (PlayerHasControllerMapped(p.second.pid))
+      Send(p.second.socket, packet);
+    else
+      has_spectators = true;
+  }
+
+  if (!has_spectators)
+    return;
+
+  enet_host_flush(m_server);
+
+  for (auto& p : m_players)
+  {
+    if (p.second.pid && p.second.pid != skip_pid && !PlayerHasControllerMapped(p.second.pid))
+      Send(p.second.socket, packet);
+  }
+}
+
 void NetPlayServer::KickPlayer(PlayerId player)
 {
   for (auto& current_player : m_players)
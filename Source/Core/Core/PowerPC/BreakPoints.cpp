@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -27,32 +28,59 @@ BreakPoints::~BreakPoints() = default;
 
 bool BreakPoints::IsAddressBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.address == address; });
+  return FindBreakPoint(address) != nullptr;
 }
 
 bool BreakPoints::IsBreakPointEnable(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(),
-                     [address](const auto& bp) { return bp.is_enabled && bp.address == address; });
+  const TBreakPoint* bp = FindBreakPoint(address);
+  return bp && bp->is_enabled;
 }
 
 bool BreakPoints::IsTempBreakPoint(u32 address) const
 {
-  return std::any_of(m_breakpoints.begin(), m_breakpoints.end(), [address](const auto& bp) {
-    return bp.address == address && bp.is_temporary;
-  });
+  const TBreakPoint* bp = FindBreakPoint(address);
+  return bp && bp->is_temporary;
 }
 
 const TBreakPoint* BreakPoints::GetBreakpoint(u32 address) const
 {
-  auto bp = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                         [address](const auto& bp_) { return bp_.address == address; });
+  return FindBreakPoint(address);
+}
+
+TBreakPoint* BreakPoints::FindBreakPoint(u32 address)
+{
+  return const_cast<TBreakPoint*>(std::as_const(*this).FindBreakPoint(address));
+}
+
+const TBreakPoint* BreakPoints::FindBreakPoint(u32 address) const
+{
+  if (!m_breakpoint_pages[address >> BREAKPOINT_PAGE_SHIFT])
+    return nullptr;
 
-  if (bp == m_breakpoints.end())
+  const auto iter = m_breakpoint_indices.find(address);
+  if (iter == m_breakpoint_indices.end())
     return nullptr;
 
-  return &*bp;
+  return &m_breakpoints[iter->second];
+}
+
+void BreakPoints::Insert(TBreakPoint bp)
+{
+  m_breakpoint_indices.emplace(bp.address, m_breakpoints.size());
+  m_breakpoint_pages[bp.address >> BREAKPOINT_PAGE_SHIFT] = true;
+  m_breakpoints.emplace_back(std::move(bp));
+}
+
+void BreakPoints::RebuildIndex()
+{
+  m_breakpoint_indices.clear();
+  m_breakpoint_pages.reset();
+  for (size_t i = 0; i < m_breakpoints.size(); ++i)
+  {
+    m_breakpoint_indices.emplace(m_breakpoints[i].address, i);
+    m_breakpoint_pages[m_breakpoints[i].address >> BREAKPOINT_PAGE_SHIFT] = true;
+  }
 }
 
 BreakPoints::TBreakPointsStr BreakPoints::GetStrings() const
@@ -115,7 +143,7 @@ void BreakPoints::Add(TBreakPoint bp)
 
   m_system.GetJitInterface().InvalidateICache(bp.address, 4, true);
 
-  m_breakpoints.emplace_back(std::move(bp));
+  Insert(std::move(bp));
 }
 
 void BreakPoints::Add(u32 address, bool temp)
@@ -128,8 +156,7 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
 {
   // Check for existing breakpoint, and overwrite with new info.
   // This is assuming we usually want the new breakpoint over an old one.
-  auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                           [address](const auto& bp) { return bp.address == address; });
+  TBreakPoint* existing = FindBreakPoint(address);
 
   TBreakPoint bp;  // breakpoint settings
   bp.is_enabled = true;
@@ -139,14 +166,14 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
   bp.address = address;
   bp.condition = std::move(condition);
 
-  if (iter != m_breakpoints.end())  // We found an existing breakpoint
+  if (existing)  // We found an existing breakpoint
   {
-    bp.is_enabled = iter->is_enabled;
-    *iter = std::move(bp);
+    bp.is_enabled = existing->is_enabled;
+    *existing = std::move(bp);
   }
   else
   {
-    m_breakpoints.emplace_back(std::move(bp));
+    Insert(std::move(bp));
   }
 
   m_system.GetJitInterface().InvalidateICache(address, 4, true);
@@ -154,13 +181,11 @@ void BreakPoints::Add(u32 address, bool temp, bool break_on_hit, bool log_on_hit
 
 bool BreakPoints::ToggleBreakPoint(u32 address)
 {
-  auto iter = std::find_if(m_breakpoints.begin(), m_breakpoints.end(),
-                           [address](const auto& bp) { return bp.address == address; });
-
-  if (iter == m_breakpoints.end())
+  TBreakPoint* bp = FindBreakPoint(address);
+  if (!bp)
     return false;
 
-  iter->is_enabled = !iter->is_enabled;
+  bp->is_enabled = !bp->is_enabled;
   return true;
 }
 
@@ -173,6 +198,7 @@ void BreakPoints::Remove(u32 address)
     return;
 
   m_breakpoints.erase(iter);
+  RebuildIndex();
   m_system.GetJitInterface().InvalidateICache(address, 4, true);
 }
 
@@ -184,23 +210,20 @@ void BreakPoints::Clear()
   }
 
   m_breakpoints.clear();
+  RebuildIndex();
 }
 
 void BreakPoints::ClearAllTemporary()
 {
-  auto bp = m_breakpoints.begin();
-  while (bp != m_breakpoints.end())
-  {
-    if (bp->is_temporary)
-    {
-      m_system.GetJitInterface().InvalidateICache(bp->address, 4, true);
-      bp = m_breakpoints.erase(bp);
-    }
-    else
-    {
-      ++bp;
-    }
-  }
+  const size_t erased = std::erase_if(m_breakpoints, [this](const TBreakPoint& bp) {
+    if (!bp.is_temporary)
+      return false;
+    m_system.GetJitInterface().InvalidateICache(bp.address, 4, true);
+    return true;
+  });
+
+  if (erased != 0)
+    RebuildIndex();
 }
 
 MemChecks::MemChecks(Core::System& system) : m_system(system)
@@ -277,9 +300,9 @@ void MemChecks::Add(TMemCheck memory_check)
   // This is assuming we usually want the new breakpoint over an old one.
   const u32 address = memory_check.start_address;
   auto old_mem_check =
-      std::find_if(m_mem_checks.begin(), m_mem_checks.end(),
-                   [address](const auto& check) { return check.start_address == address; });
-  if (old_mem_check != m_mem_checks.end())
+      std::lower_bound(m_mem_checks.begin(), m_mem_checks.end(), address,
+                       [](const auto& check, u32 value) { return check.start_address < value; });
+  if (old_mem_check != m_mem_checks.end() && old_mem_check->start_address == address)
   {
     const bool is_enabled = old_mem_check->is_enabled;  // Preserve enabled status
     *old_mem_check = std::move(memory_check);
@@ -288,8 +311,9 @@ void MemChecks::Add(TMemCheck memory_check)
   }
   else
   {
-    m_mem_checks.emplace_back(std::move(memory_check));
+    m_mem_checks.insert(old_mem_check, std::move(memory_check));
   }
+  UpdateWatchedPages();
   // If this is the first one, clear the JIT cache so it can switch to
   // watchpoint-compatible code.
   if (!had_any)
@@ -320,6 +344,7 @@ void MemChecks::Remove(u32 address)
 
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.erase(iter);
+  UpdateWatchedPages();
   if (!HasAny())
     m_system.GetJitInterface().ClearCache(guard);
   m_system.GetMMU().DBATUpdated();
@@ -329,38 +354,81 @@ void MemChecks::Clear()
 {
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.clear();
+  UpdateWatchedPages();
   m_system.GetJitInterface().ClearCache(guard);
   m_system.GetMMU().DBATUpdated();
 }
 
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
-  const auto iter =
-      std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
-        return mc.end_address >= address && address + size - 1 >= mc.start_address;
-      });
-
-  // None found
-  if (iter == m_mem_checks.cend())
-    return nullptr;
-
-  return &*iter;
+  // The memcheck is only modified through the returned pointer, the lookup itself is const.
+  return const_cast<TMemCheck*>(FindMemCheck(address, static_cast<u32>(address + size - 1)));
 }
 
 bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
+{
+  const u32 page_end_suffix = length - 1;
+  return FindMemCheck(address & ~page_end_suffix, address | page_end_suffix) != nullptr;
+}
+
+const TMemCheck* MemChecks::FindMemCheck(u32 first_address, u32 last_address) const
 {
   if (!HasAny())
-    return false;
+    return nullptr;
 
-  const u32 page_end_suffix = length - 1;
-  const u32 page_end_address = address | page_end_suffix;
+  // Accesses wrapping around the end of the address space stop at the end.
+  if (last_address < first_address)
+    last_address = 0xFFFFFFFF;
 
-  return std::any_of(m_mem_checks.cbegin(), m_mem_checks.cend(), [&](const auto& mc) {
-    return ((mc.start_address | page_end_suffix) == page_end_address ||
-            (mc.end_address | page_end_suffix) == page_end_address) ||
-           ((mc.start_address | page_end_suffix) < page_end_address &&
-            (mc.end_address | page_end_suffix) > page_end_address);
-  });
+  // Most accesses are to pages without any memcheck.
+  bool watched = false;
+  for (u32 page = first_address >> WATCHED_PAGE_SHIFT;; ++page)
+  {
+    if (m_watched_pages[page])
+    {
+      watched = true;
+      break;
+    }
+    if (page == last_address >> WATCHED_PAGE_SHIFT)
+      break;
+  }
+  if (!watched)
+    return nullptr;
+
+  // Every memcheck before this one starts at or before last_address, so look back through them
+  // until they start too far before first_address to reach it.
+  auto iter = std::upper_bound(
+      m_mem_checks.cbegin(), m_mem_checks.cend(), last_address,
+      [](u32 value, const auto& mc) { return value < mc.start_address; });
+  while (iter != m_mem_checks.cbegin())
+  {
+    --iter;
+    if (iter->end_address >= first_address)
+      return &*iter;
+    if (iter->start_address < first_address &&
+        first_address - iter->start_address > m_max_mem_check_span)
+    {
+      break;
+    }
+  }
+
+  return nullptr;
+}
+
+void MemChecks::UpdateWatchedPages()
+{
+  m_watched_pages.reset();
+  m_max_mem_check_span = 0;
+  for (const TMemCheck& mc : m_mem_checks)
+  {
+    if (mc.end_address < mc.start_address)
+      continue;
+
+    m_max_mem_check_span = std::max(m_max_mem_check_span, mc.end_address - mc.start_address);
+    const u32 last_page = mc.end_address >> WATCHED_PAGE_SHIFT;
+    for (u32 page = mc.start_address >> WATCHED_PAGE_SHIFT; page <= last_page; ++page)
+      m_watched_pages.set(page);
+  }
 }
 
 bool TMemCheck::Action(Core::System& system, u64 value, u32 addr, bool write, size_t size, u32 pc)
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <bitset>
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -87,7 +89,20 @@ public:
   void ClearAllTemporary();
 
 private:
+  // Instruction addresses are checked against a bitmap of the pages containing breakpoints
+  // before the index is searched, as most instructions executed are nowhere near one.
+  static constexpr u32 BREAKPOINT_PAGE_SHIFT = 12;
+  static constexpr u32 BREAKPOINT_PAGE_COUNT = 1u << (32 - BREAKPOINT_PAGE_SHIFT);
+
+  TBreakPoint* FindBreakPoint(u32 address);
+  const TBreakPoint* FindBreakPoint(u32 address) const;
+  void Insert(TBreakPoint bp);
+  void RebuildIndex();
+
   TBreakPoints m_breakpoints;
+  // Maps each breakpoint address to its position in m_breakpoints.
+  std::unordered_map<u32, size_t> m_breakpoint_indices;
+  std::bitset<BREAKPOINT_PAGE_COUNT> m_breakpoint_pages;
   Core::System& m_system;
 };
 
@@ -115,6 +130,8 @@ public:
 
   // memory breakpoint
   TMemCheck* GetMemCheck(u32 address, size_t size = 1);
+  // Whether any memcheck overlaps the naturally aligned block of length bytes (a power of two)
+  // containing address.
   bool OverlapsMemcheck(u32 address, u32 length) const;
   void Remove(u32 address);
 
@@ -122,6 +139,19 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  // Watched pages are tracked at the hardware page size, so that lookups for accesses to the rest
+  // of memory are rejected without searching the memchecks.
+  static constexpr u32 WATCHED_PAGE_SHIFT = 12;
+  static constexpr u32 WATCHED_PAGE_COUNT = 1u << (32 - WATCHED_PAGE_SHIFT);
+
+  const TMemCheck* FindMemCheck(u32 first_address, u32 last_address) const;
+  void UpdateWatchedPages();
+
+  // Sorted by start address.
   TMemChecks m_mem_checks;
+  std::bitset<WATCHED_PAGE_COUNT> m_watched_pages;
+  // The largest end_address - start_address of any memcheck, which bounds how far back from an
+  // address FindMemCheck has to look.
+  u32 m_max_mem_check_span = 0;
   Core::System& m_system;
 };
@@ -15,6 +15,7 @@
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
+#include "VideoCommon/StutterTracker.h"
 
 struct CachedInterpreter::Instruction
 {
@@ -288,6 +289,8 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
 
 void CachedInterpreter::Jit(u32 address)
 {
+  StutterScope stutter_scope(StutterCause::JitCompile);
+
   if (m_code.size() >= CODE_SIZE / sizeof(Instruction) - 0x1000 ||
       SConfig::GetInstance().bJITNoBlockCache)
   {
@@ -399,6 +399,167 @@ Expression::Expression(std::string_view text, ExprPointer ex, ExprVarListPointer
     else
       m_binds.emplace_back();
   }
+
+  if (!Compile(*m_expr, 0))
+  {
+    m_program.clear();
+    m_program_reads_memory = false;
+  }
+}
+
+bool Expression::Compile(const expr& e, int depth)
+{
+  if (depth >= MAX_STACK_DEPTH)
+    return false;
+
+  const auto emit = [this](Opcode opcode, int operand = 0, double value = 0.0) {
+    m_program.push_back({opcode, operand, value});
+  };
+  const auto compile_args = [this, &e, depth](size_t count) {
+    if (static_cast<size_t>(vec_len(&e.param.op.args)) != count)
+      return false;
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (!Compile(e.param.op.args.buf[i], depth + static_cast<int>(i)))
+        return false;
+    }
+    return true;
+  };
+
+  switch (e.type)
+  {
+  case OP_CONST:
+    emit(Opcode::Const, 0, e.param.num.value);
+    return true;
+  case OP_VAR:
+  {
+    auto bind = m_binds.begin();
+    for (auto* v = m_vars->head; v != nullptr; v = v->next, ++bind)
+    {
+      if (&v->value != e.param.var.value)
+        continue;
+
+      switch (bind->type)
+      {
+      case VarBindingType::Zero:
+        emit(Opcode::Const, 0, 0.0);
+        break;
+      case VarBindingType::GPR:
+        emit(Opcode::LoadGPR, bind->index);
+        break;
+      case VarBindingType::FPR:
+        emit(Opcode::LoadFPR, bind->index);
+        break;
+      case VarBindingType::SPR:
+        emit(Opcode::LoadSPR, bind->index);
+        break;
+      case VarBindingType::PCtr:
+        emit(Opcode::LoadPC);
+        break;
+      case VarBindingType::MSR:
+        emit(Opcode::LoadMSR);
+        break;
+      }
+      return true;
+    }
+    return false;
+  }
+  case OP_FUNC:
+  {
+    static const std::array<std::pair<exprfn_t, Opcode>, 14> function_opcodes{{
+        {HostReadFunc<u8>, Opcode::ReadU8},
+        {HostReadFunc<s8, u8>, Opcode::ReadS8},
+        {HostReadFunc<u16>, Opcode::ReadU16},
+        {HostReadFunc<s16, u16>, Opcode::ReadS16},
+        {HostReadFunc<u32>, Opcode::ReadU32},
+        {HostReadFunc<s32, u32>, Opcode::ReadS32},
+        {HostReadFunc<float, u32>, Opcode::ReadF32},
+        {HostReadFunc<double, u64>, Opcode::ReadF64},
+        {CastFunc<u8>, Opcode::CastU8},
+        {CastFunc<s8, u8>, Opcode::CastS8},
+        {CastFunc<u16>, Opcode::CastU16},
+        {CastFunc<s16, u16>, Opcode::CastS16},
+        {CastFunc<u32>, Opcode::CastU32},
+        {CastFunc<s32, u32>, Opcode::CastS32},
+    }};
+    // Functions with side effects or string arguments are left to the interpreter.
+    const auto iter = std::ranges::find(function_opcodes, e.param.func.f->f,
+                                        &std::pair<exprfn_t, Opcode>::first);
+    if (iter == function_opcodes.end() || vec_len(&e.param.func.args) != 1 ||
+        !Compile(e.param.func.args.buf[0], depth))
+    {
+      return false;
+    }
+    if (iter->second <= Opcode::ReadF64)
+      m_program_reads_memory = true;
+    emit(iter->second);
+    return true;
+  }
+  case OP_UNARY_MINUS:
+  case OP_UNARY_LOGICAL_NOT:
+  case OP_UNARY_BITWISE_NOT:
+  {
+    if (!compile_args(1))
+      return false;
+    emit(e.type == OP_UNARY_MINUS       ? Opcode::Negate :
+         e.type == OP_UNARY_LOGICAL_NOT ? Opcode::LogicalNot :
+                                          Opcode::BitwiseNot);
+    return true;
+  }
+  case OP_LOGICAL_AND:
+  case OP_LOGICAL_OR:
+  {
+    if (vec_len(&e.param.op.args) != 2 || !Compile(e.param.op.args.buf[0], depth))
+      return false;
+    const size_t jump = m_program.size();
+    emit(e.type == OP_LOGICAL_AND ? Opcode::JumpIfZero : Opcode::JumpIfTrue);
+    if (!Compile(e.param.op.args.buf[1], depth))
+      return false;
+    emit(Opcode::Normalize);
+    m_program[jump].operand = static_cast<int>(m_program.size());
+    return true;
+  }
+  case OP_COMMA:
+  {
+    if (vec_len(&e.param.op.args) != 2 || !Compile(e.param.op.args.buf[0], depth))
+      return false;
+    emit(Opcode::Pop);
+    return Compile(e.param.op.args.buf[1], depth);
+  }
+  default:
+    break;
+  }
+
+  static constexpr auto binary_opcodes = [] {
+    std::array<std::optional<Opcode>, OP_FUNC + 1> opcodes{};
+    opcodes[OP_POWER] = Opcode::Power;
+    opcodes[OP_MULTIPLY] = Opcode::Multiply;
+    opcodes[OP_DIVIDE] = Opcode::Divide;
+    opcodes[OP_REMAINDER] = Opcode::Remainder;
+    opcodes[OP_PLUS] = Opcode::Add;
+    opcodes[OP_MINUS] = Opcode::Subtract;
+    opcodes[OP_SHL] = Opcode::ShiftLeft;
+    opcodes[OP_SHR] = Opcode::ShiftRight;
+    opcodes[OP_LT] = Opcode::Less;
+    opcodes[OP_LE] = Opcode::LessEqual;
+    opcodes[OP_GT] = Opcode::Greater;
+    opcodes[OP_GE] = Opcode::GreaterEqual;
+    opcodes[OP_EQ] = Opcode::Equal;
+    opcodes[OP_NE] = Opcode::NotEqual;
+    opcodes[OP_BITWISE_AND] = Opcode::BitwiseAnd;
+    opcodes[OP_BITWISE_OR] = Opcode::BitwiseOr;
+    opcodes[OP_BITWISE_XOR] = Opcode::BitwiseXor;
+    return opcodes;
+  }();
+
+  // Assignments write registers back, so they are left to the interpreter as well.
+  if (static_cast<size_t>(e.type) >= binary_opcodes.size() ||
+      !binary_opcodes[e.type] || !compile_args(2))
+  {
+    return false;
+  }
+  emit(*binary_opcodes[e.type]);
+  return true;
 }
 
 std::optional<Expression> Expression::TryParse(std::string_view text)
@@ -413,6 +574,22 @@ std::optional<Expression> Expression::TryParse(std::string_view text)
 
 double Expression::Evaluate(Core::System& system) const
 {
+  if (!m_program.empty())
+  {
+    bool encountered_nan = false;
+    const double result = Execute(system, &encountered_nan);
+
+    // The program doesn't write anything back, so the variables only need to be read for the
+    // report, which is only logged for a hit.
+    if (result != 0.0 || std::isnan(result) || encountered_nan)
+    {
+      SynchronizeBindings(system, SynchronizeDirection::From);
+      Reporting(result);
+    }
+
+    return result;
+  }
+
   SynchronizeBindings(system, SynchronizeDirection::From);
 
   double result = expr_eval(m_expr.get());
@@ -424,6 +601,198 @@ double Expression::Evaluate(Core::System& system) const
   return result;
 }
 
+double Expression::Execute(Core::System& system, bool* encountered_nan) const
+{
+  const auto& ppc_state = system.GetPPCState();
+  std::optional<Core::CPUThreadGuard> guard;
+  if (m_program_reads_memory)
+    guard.emplace(system);
+
+  std::array<double, MAX_STACK_DEPTH> stack;
+  int top = -1;
+
+  const auto read = [&](auto tag, auto raw_tag) -> double {
+    using T = decltype(tag);
+    using U = decltype(raw_tag);
+    const u32 address = static_cast<u32>(stack[top]);
+    return std::bit_cast<T>(HostRead<U>(*guard, address));
+  };
+  const auto cast = [&](auto tag, auto raw_tag) -> double {
+    using T = decltype(tag);
+    using U = decltype(raw_tag);
+    return std::bit_cast<T>(static_cast<U>(stack[top]));
+  };
+
+  for (size_t i = 0; i < m_program.size(); ++i)
+  {
+    const Instruction& inst = m_program[i];
+    switch (inst.opcode)
+    {
+    case Opcode::Const:
+      stack[++top] = inst.value;
+      break;
+    case Opcode::LoadGPR:
+      stack[++top] = static_cast<double>(ppc_state.gpr[inst.operand]);
+      break;
+    case Opcode::LoadFPR:
+      stack[++top] = ppc_state.ps[inst.operand].PS0AsDouble();
+      if (std::isnan(stack[top]))
+        *encountered_nan = true;
+      break;
+    case Opcode::LoadSPR:
+      stack[++top] = static_cast<double>(ppc_state.spr[inst.operand]);
+      break;
+    case Opcode::LoadPC:
+      stack[++top] = static_cast<double>(ppc_state.pc);
+      break;
+    case Opcode::LoadMSR:
+      stack[++top] = static_cast<double>(ppc_state.msr.Hex);
+      break;
+    case Opcode::ReadU8:
+      stack[top] = read(u8{}, u8{});
+      break;
+    case Opcode::ReadS8:
+      stack[top] = read(s8{}, u8{});
+      break;
+    case Opcode::ReadU16:
+      stack[top] = read(u16{}, u16{});
+      break;
+    case Opcode::ReadS16:
+      stack[top] = read(s16{}, u16{});
+      break;
+    case Opcode::ReadU32:
+      stack[top] = read(u32{}, u32{});
+      break;
+    case Opcode::ReadS32:
+      stack[top] = read(s32{}, u32{});
+      break;
+    case Opcode::ReadF32:
+      stack[top] = read(float{}, u32{});
+      break;
+    case Opcode::ReadF64:
+      stack[top] = read(double{}, u64{});
+      break;
+    case Opcode::CastU8:
+      stack[top] = cast(u8{}, u8{});
+      break;
+    case Opcode::CastS8:
+      stack[top] = cast(s8{}, u8{});
+      break;
+    case Opcode::CastU16:
+      stack[top] = cast(u16{}, u16{});
+      break;
+    case Opcode::CastS16:
+      stack[top] = cast(s16{}, u16{});
+      break;
+    case Opcode::CastU32:
+      stack[top] = cast(u32{}, u32{});
+      break;
+    case Opcode::CastS32:
+      stack[top] = cast(s32{}, u32{});
+      break;
+    case Opcode::Negate:
+      stack[top] = -stack[top];
+      break;
+    case Opcode::LogicalNot:
+      stack[top] = !stack[top];
+      break;
+    case Opcode::BitwiseNot:
+      stack[top] = static_cast<double>(~to_int(stack[top]));
+      break;
+    case Opcode::JumpIfZero:
+      if (stack[top] == 0)
+      {
+        stack[top] = 0;
+        i = inst.operand - 1;
+      }
+      else
+      {
+        --top;
+      }
+      break;
+    case Opcode::JumpIfTrue:
+      if (stack[top] != 0 && !std::isnan(stack[top]))
+        i = inst.operand - 1;
+      else
+        --top;
+      break;
+    case Opcode::Normalize:
+      if (stack[top] == 0)
+        stack[top] = 0;
+      break;
+    case Opcode::Pop:
+      --top;
+      break;
+    default:
+    {
+      const double b = stack[top--];
+      const double a = stack[top];
+      double& result = stack[top];
+      switch (inst.opcode)
+      {
+      case Opcode::Power:
+        result = std::pow(a, b);
+        break;
+      case Opcode::Multiply:
+        result = a * b;
+        break;
+      case Opcode::Divide:
+        result = a / b;
+        break;
+      case Opcode::Remainder:
+        result = std::fmod(a, b);
+        break;
+      case Opcode::Add:
+        result = a + b;
+        break;
+      case Opcode::Subtract:
+        result = a - b;
+        break;
+      case Opcode::ShiftLeft:
+        result = static_cast<double>(to_int(a) << to_int(b));
+        break;
+      case Opcode::ShiftRight:
+        result = static_cast<double>(to_int(a) >> to_int(b));
+        break;
+      case Opcode::Less:
+        result = a < b;
+        break;
+      case Opcode::LessEqual:
+        result = a <= b;
+        break;
+      case Opcode::Greater:
+        result = a > b;
+        break;
+      case Opcode::GreaterEqual:
+        result = a >= b;
+        break;
+      case Opcode::Equal:
+        result = a == b;
+        break;
+      case Opcode::NotEqual:
+        result = a != b;
+        break;
+      case Opcode::BitwiseAnd:
+        result = static_cast<double>(to_int(a) & to_int(b));
+        break;
+      case Opcode::BitwiseOr:
+        result = static_cast<double>(to_int(a) | to_int(b));
+        break;
+      case Opcode::BitwiseXor:
+        result = static_cast<double>(to_int(a) ^ to_int(b));
+        break;
+      default:
+        result = NAN;
+        break;
+      }
+      break;
+    }
+    }
+  }
+
+  return stack[0];
+}
+
 void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const
 {
   auto& ppc_state = system.GetPPCState();
@@ -64,8 +64,73 @@ private:
     int index = -1;
   };
 
+  // Conditions without side effects are compiled into a small stack machine program when
+  // parsed, with the register each variable reads resolved ahead of time. This skips walking the
+  // expression tree and synchronizing every variable on each hit.
+  enum class Opcode
+  {
+    Const,
+    LoadGPR,
+    LoadFPR,
+    LoadSPR,
+    LoadPC,
+    LoadMSR,
+    ReadU8,
+    ReadS8,
+    ReadU16,
+    ReadS16,
+    ReadU32,
+    ReadS32,
+    ReadF32,
+    ReadF64,
+    CastU8,
+    CastS8,
+    CastU16,
+    CastS16,
+    CastU32,
+    CastS32,
+    Negate,
+    LogicalNot,
+    BitwiseNot,
+    Power,
+    Multiply,
+    Divide,
+    Remainder,
+    Add,
+    Subtract,
+    ShiftLeft,
+    ShiftRight,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    // Leaves 0 and jumps to operand if the top of the stack is 0, pops it otherwise.
+    JumpIfZero,
+    // Jumps to operand if the top of the stack is neither 0 nor NaN, pops it otherwise.
+    JumpIfTrue,
+    // Replaces negative zero with zero, like the logical operators of expr do.
+    Normalize,
+    Pop,
+  };
+
+  struct Instruction
+  {
+    Opcode opcode = Opcode::Const;
+    int operand = 0;
+    double value = 0.0;
+  };
+
+  static constexpr int MAX_STACK_DEPTH = 16;
+
   Expression(std::string_view text, ExprPointer ex, ExprVarListPointer vars);
 
+  bool Compile(const expr& e, int depth);
+  double Execute(Core::System& system, bool* encountered_nan) const;
   void SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const;
   void Reporting(const double result) const;
 
@@ -73,6 +138,8 @@ private:
   ExprPointer m_expr;
   ExprVarListPointer m_vars;
   std::vector<VarBinding> m_binds;
+  std::vector<Instruction> m_program;
+  bool m_program_reads_memory = false;
 };
 
 inline bool EvaluateCondition(Core::System& system, const std::optional<Expression>& condition)
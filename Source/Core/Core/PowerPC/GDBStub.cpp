@@ -8,6 +8,7 @@
 #include <fmt/format.h>
 #include <optional>
 #include <signal.h>
+#include <string_view>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -44,7 +45,7 @@ namespace GDBStub
 {
 static std::optional<Common::SocketContext> s_socket_context;
 
-#define GDB_BFR_MAX 10000
+#define GDB_BFR_MAX 0x20000
 
 #define GDB_STUB_START '$'
 #define GDB_STUB_END '#'
@@ -77,6 +78,16 @@ static int s_sock = -1;
 static u8 s_cmd_bfr[GDB_BFR_MAX];
 static u32 s_cmd_len;
 
+// Bytes received from the socket but not consumed by ReadByte yet.
+static u8 s_recv_bfr[GDB_BFR_MAX];
+static u32 s_recv_pos = 0;
+static u32 s_recv_len = 0;
+
+// The [start, end) range of a vCont;r range step in progress.
+static bool s_range_stepping = false;
+static u32 s_range_step_start = 0;
+static u32 s_range_step_end = 0;
+
 static CoreTiming::EventType* s_update_event;
 
 static const char* CommandBufferAsString()
@@ -107,7 +118,7 @@ static u8 Nibble2hex(u8 n)
     return 'A' + n - 0xa;
 }
 
-static void Mem2hex(u8* dst, u8* src, u32 len)
+static void Mem2hex(u8* dst, const u8* src, u32 len)
 {
   while (len-- > 0)
   {
@@ -126,6 +137,45 @@ static void Hex2mem(u8* dst, u8* src, u32 len)
   }
 }
 
+static bool IsBinaryEscaped(u8 c)
+{
+  return c == '#' || c == '$' || c == '}' || c == '*';
+}
+
+// Escapes binary data for a reply, returns the escaped length.
+static u32 Mem2bin(u8* dst, const u8* src, u32 len)
+{
+  u8* const start = dst;
+  while (len-- > 0)
+  {
+    const u8 tmp = *src++;
+    if (IsBinaryEscaped(tmp))
+    {
+      *dst++ = '}';
+      *dst++ = tmp ^ 0x20;
+    }
+    else
+    {
+      *dst++ = tmp;
+    }
+  }
+  return static_cast<u32>(dst - start);
+}
+
+// Unescapes binary data of a command, returns the unescaped length.
+static u32 Bin2mem(u8* dst, const u8* src, u32 src_len, u32 max_len)
+{
+  u32 len = 0;
+  for (u32 i = 0; i < src_len && len < max_len; ++i)
+  {
+    if (src[i] == '}' && i + 1 < src_len)
+      dst[len++] = src[++i] ^ 0x20;
+    else
+      dst[len++] = src[i];
+  }
+  return len;
+}
+
 static void UpdateCallback(Core::System& system, u64 userdata, s64 cycles_late)
 {
   ProcessCommands(false);
@@ -135,16 +185,24 @@ static void UpdateCallback(Core::System& system, u64 userdata, s64 cycles_late)
 
 static u8 ReadByte()
 {
-  u8 c = '+';
-
-  const ssize_t res = recv(s_sock, (char*)&c, 1, MSG_WAITALL);
-  if (res != 1)
+  // Receive as much as is available at once, as large transfers arrive one byte at a time
+  // otherwise.
+  if (s_recv_pos == s_recv_len)
   {
-    ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
-    Deinit();
+    s_recv_pos = 0;
+    s_recv_len = 0;
+
+    const ssize_t res = recv(s_sock, (char*)s_recv_bfr, sizeof s_recv_bfr, 0);
+    if (res <= 0)
+    {
+      ERROR_LOG_FMT(GDB_STUB, "recv failed : {}", res);
+      Deinit();
+      return '+';
+    }
+    s_recv_len = static_cast<u32>(res);
   }
 
-  return c;
+  return s_recv_bfr[s_recv_pos++];
 }
 
 static u8 CalculateChecksum()
@@ -259,6 +317,9 @@ static void ReadCommand()
 
 static bool IsDataAvailable()
 {
+  if (s_recv_pos != s_recv_len)
+    return true;
+
   struct timeval t;
   fd_set _fds, *fds = &_fds;
 
@@ -279,18 +340,21 @@ static bool IsDataAvailable()
   return false;
 }
 
-static void SendReply(const char* reply)
+static void SendReply(std::string_view reply)
 {
   if (!IsActive())
     return;
 
   memset(s_cmd_bfr, 0, sizeof s_cmd_bfr);
 
-  s_cmd_len = (u32)strlen(reply);
+  s_cmd_len = static_cast<u32>(reply.size());
   if (s_cmd_len + 4 > sizeof s_cmd_bfr)
+  {
     ERROR_LOG_FMT(GDB_STUB, "cmd_bfr overflow in gdb_reply");
+    return;
+  }
 
-  memcpy(s_cmd_bfr + 1, reply, s_cmd_len);
+  memcpy(s_cmd_bfr + 1, reply.data(), s_cmd_len);
 
   s_cmd_len++;
   const u8 chk = CalculateChecksum();
@@ -300,7 +364,8 @@ static void SendReply(const char* reply)
   s_cmd_bfr[s_cmd_len + 2] = Nibble2hex(chk >> 4);
   s_cmd_bfr[s_cmd_len + 3] = Nibble2hex(chk);
 
-  DEBUG_LOG_FMT(GDB_STUB, "gdb: reply (len: {}): {}", s_cmd_len, CommandBufferAsString());
+  DEBUG_LOG_FMT(GDB_STUB, "gdb: reply (len: {}): {}", s_cmd_len,
+                std::string_view(CommandBufferAsString(), s_cmd_len + 4));
 
   const char* ptr = (const char*)s_cmd_bfr;
   u32 left = s_cmd_len + 4;
@@ -342,7 +407,10 @@ static void HandleQuery()
   else if (!strncmp((const char*)(s_cmd_bfr), "qHostInfo", strlen("qHostInfo")))
     return WriteHostInfo();
   else if (!strncmp((const char*)(s_cmd_bfr), "qSupported", strlen("qSupported")))
-    return SendReply("swbreak+;hwbreak+");
+  {
+    return SendReply(
+        fmt::format("swbreak+;hwbreak+;binary-upload+;PacketSize={:x}", GDB_BFR_MAX - 4));
+  }
 
   SendReply("");
 }
@@ -806,15 +874,18 @@ static void WriteRegister()
   SendReply("OK");
 }
 
+// Handles both hex (m) and binary (x) memory reads, which are copied straight out of emulated
+// memory.
 static void ReadMemory(const Core::CPUThreadGuard& guard)
 {
   static u8 reply[GDB_BFR_MAX - 4];
+  const bool binary = s_cmd_bfr[0] == 'x';
   u32 addr, len;
   u32 i;
 
   i = 1;
   addr = 0;
-  while (s_cmd_bfr[i] != ',')
+  while (i < s_cmd_len && s_cmd_bfr[i] != ',')
     addr = (addr << 4) | Hex2char(s_cmd_bfr[i++]);
   i++;
 
@@ -823,18 +894,28 @@ static void ReadMemory(const Core::CPUThreadGuard& guard)
     len = (len << 4) | Hex2char(s_cmd_bfr[i++]);
   INFO_LOG_FMT(GDB_STUB, "gdb: read memory: {:08x} bytes from {:08x}", len, addr);
 
-  if (len * 2 > sizeof reply)
-    SendReply("E01");
+  // Every byte takes two characters in the worst case either way, plus the 'b' of binary replies.
+  if (u64{len} * 2 + 1 > sizeof reply)
+    return SendReply("E01");
 
   if (!PowerPC::MMU::HostIsRAMAddress(guard, addr))
     return SendReply("E00");
 
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
-  u8* data = memory.GetPointerForRange(addr, len);
+  const u8* data = memory.GetPointerForRange(addr, len);
+  if (!data)
+    return SendReply("E00");
+
+  if (binary)
+  {
+    reply[0] = 'b';
+    const u32 reply_len = 1 + Mem2bin(reply + 1, data, len);
+    return SendReply(std::string_view(reinterpret_cast<const char*>(reply), reply_len));
+  }
+
   Mem2hex(reply, data, len);
-  reply[len * 2] = '\0';
-  SendReply((char*)reply);
+  SendReply(std::string_view(reinterpret_cast<const char*>(reply), len * 2));
 }
 
 static void WriteMemory(const Core::CPUThreadGuard& guard)
@@ -859,7 +940,18 @@ static void WriteMemory(const Core::CPUThreadGuard& guard)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u8* dst = memory.GetPointerForRange(addr, len);
-  Hex2mem(dst, s_cmd_bfr + i + 1, len);
+  if (!dst)
+    return SendReply("E00");
+
+  if (s_cmd_bfr[0] == 'X')
+  {
+    if (Bin2mem(dst, s_cmd_bfr + i + 1, s_cmd_len - (i + 1), len) != len)
+      return SendReply("E01");
+  }
+  else
+  {
+    Hex2mem(dst, s_cmd_bfr + i + 1, len);
+  }
   SendReply("OK");
 }
 
@@ -870,6 +962,69 @@ static void Step()
   Core::CallOnStateChangedCallbacks(Core::State::Paused);
 }
 
+static u32 ParseHex(std::string_view str)
+{
+  u32 value = 0;
+  for (const char c : str)
+    value = (value << 4) | Hex2char(static_cast<u8>(c));
+  return value;
+}
+
+// Handles vCont, returns whether the CPU was resumed.
+static bool HandleVCont()
+{
+  const std::string_view command(CommandBufferAsString(), s_cmd_len);
+  if (command == "vCont?")
+  {
+    SendReply("vCont;c;C;s;S;r");
+    return false;
+  }
+  if (!command.starts_with("vCont;"))
+  {
+    SendReply("");
+    return false;
+  }
+
+  // There is only one thread, so the first action applies to it regardless of its thread ID.
+  std::string_view action = command.substr(std::string_view("vCont;").size());
+  action = action.substr(0, action.find(';'));
+  action = action.substr(0, action.find(':'));
+  if (action.empty())
+  {
+    SendReply("E01");
+    return false;
+  }
+
+  switch (action[0])
+  {
+  case 'c':
+  case 'C':
+    Core::System::GetInstance().GetCPU().Continue();
+    s_has_control = false;
+    return true;
+  case 's':
+  case 'S':
+    Step();
+    return true;
+  case 'r':
+  {
+    const size_t comma = action.find(',');
+    if (comma == std::string_view::npos)
+      break;
+    s_range_step_start = ParseHex(action.substr(1, comma - 1));
+    s_range_step_end = ParseHex(action.substr(comma + 1));
+    s_range_stepping = true;
+    Step();
+    return true;
+  }
+  default:
+    break;
+  }
+
+  SendReply("E01");
+  return false;
+}
+
 static bool AddBreakpoint(BreakpointType type, u32 addr, u32 len)
 {
   if (type == BreakpointType::ExecuteHard || type == BreakpointType::ExecuteSoft)
@@ -1002,6 +1157,7 @@ void ProcessCommands(bool loop_until_continue)
       WriteRegister();
       break;
     case 'm':
+    case 'x':
     {
       ASSERT(Core::IsCPUThread());
       Core::CPUThreadGuard guard(system);
@@ -1010,6 +1166,7 @@ void ProcessCommands(bool loop_until_continue)
       break;
     }
     case 'M':
+    case 'X':
     {
       ASSERT(Core::IsCPUThread());
       Core::CPUThreadGuard guard(system);
@@ -1035,6 +1192,10 @@ void ProcessCommands(bool loop_until_continue)
     case 'Z':
       HandleAddBreakpoint();
       break;
+    case 'v':
+      if (HandleVCont())
+        return;
+      break;
     default:
       SendReply("");
       break;
@@ -1133,6 +1294,9 @@ void Deinit()
 
   s_socket_context.reset();
   s_has_control = false;
+  s_recv_pos = 0;
+  s_recv_len = 0;
+  s_range_stepping = false;
 }
 
 bool IsActive()
@@ -1155,6 +1319,23 @@ bool JustConnected()
   return s_just_connected;
 }
 
+bool ContinueRangeStep()
+{
+  if (!s_range_stepping)
+    return false;
+
+  auto& power_pc = Core::System::GetInstance().GetPowerPC();
+  const u32 pc = power_pc.GetPPCState().pc;
+  if (pc >= s_range_step_start && pc < s_range_step_end &&
+      !power_pc.GetBreakPoints().IsAddressBreakPoint(pc))
+  {
+    return true;
+  }
+
+  s_range_stepping = false;
+  return false;
+}
+
 void SendSignal(Signal signal)
 {
   auto& system = Core::System::GetInstance();
@@ -23,6 +23,9 @@ bool IsActive();
 bool HasControl();
 void TakeControl();
 bool JustConnected();
+// Whether the CPU should take another step on its own for a range step (vCont;r) without
+// reporting back to gdb. Ends the range step once the PC leaves the range.
+bool ContinueRangeStep();
 
 void ProcessCommands(bool loop_until_continue);
 void SendSignal(Signal signal);
@@ -118,6 +118,21 @@ bool Interpreter::HandleFunctionHooking(u32 address)
   return result.type != HLE::HookType::Start;
 }
 
+const Interpreter::DecodedInstruction& Interpreter::Decode(UGeckoInstruction inst)
+{
+  // The low bits mostly hold register numbers and extended opcodes, the high bits the primary
+  // opcode, so fold both into the index.
+  const u32 index = (inst.hex ^ (inst.hex >> 20)) & (DECODE_CACHE_SIZE - 1);
+  DecodedInstruction& decoded = m_decode_cache[index];
+  if (decoded.hex != inst.hex || !decoded.fn)
+  {
+    decoded.hex = inst.hex;
+    decoded.fn = GetInterpreterOp(inst);
+    decoded.opinfo = PPCTables::GetOpInfo(inst, m_ppc_state.pc);
+  }
+  return decoded;
+}
+
 int Interpreter::SingleStepInner()
 {
   if (HandleFunctionHooking(m_ppc_state.pc))
@@ -132,7 +147,8 @@ int Interpreter::SingleStepInner()
   m_ppc_state.npc = m_ppc_state.pc + sizeof(UGeckoInstruction);
   m_prev_inst.hex = m_mmu.Read_Opcode(m_ppc_state.pc);
 
-  const GekkoOPInfo* opinfo = PPCTables::GetOpInfo(m_prev_inst, m_ppc_state.pc);
+  const DecodedInstruction& decoded = Decode(m_prev_inst);
+  const GekkoOPInfo* opinfo = decoded.opinfo;
 
   // Uncomment to trace the interpreter
   // if ((m_ppc_state.pc & 0x00FFFFFF) >= 0x000AB54C &&
@@ -159,7 +175,7 @@ int Interpreter::SingleStepInner()
     }
     else if (m_ppc_state.msr.FP)
     {
-      RunInterpreterOp(*this, m_prev_inst);
+      decoded.fn(*this, m_prev_inst);
       if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
       {
         CheckExceptions();
@@ -175,7 +191,7 @@ int Interpreter::SingleStepInner()
       }
       else
       {
-        RunInterpreterOp(*this, m_prev_inst);
+        decoded.fn(*this, m_prev_inst);
         if ((m_ppc_state.Exceptions & EXCEPTION_DSI) != 0)
         {
           CheckExceptions();
@@ -196,6 +212,18 @@ int Interpreter::SingleStepInner()
   return opinfo->num_cycles;
 }
 
+// Runs instructions up to the end of the current block. This lets the JITs execute a block without
+// compiling it. Returns the number of cycles executed; updating the downcount is up to the caller.
+int Interpreter::RunBlock()
+{
+  m_end_block = false;
+
+  int cycles = 0;
+  while (!m_end_block)
+    cycles += SingleStepInner();
+  return cycles;
+}
+
 void Interpreter::SingleStep()
 {
   auto& core_timing = m_system.GetCoreTiming();
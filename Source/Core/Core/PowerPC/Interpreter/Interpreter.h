@@ -19,6 +19,7 @@ namespace PowerPC
 class MMU;
 struct PowerPCState;
 }  // namespace PowerPC
+struct GekkoOPInfo;
 class PPCSymbolDB;
 
 class Interpreter : public CPUCoreBase
@@ -36,6 +37,7 @@ public:
   void Shutdown() override;
   void SingleStep() override;
   int SingleStepInner();
+  int RunBlock();
 
   void Run() override;
   void ClearCache() override;
@@ -314,12 +316,27 @@ private:
 
   void Trace(const UGeckoInstruction& inst);
 
+  // Instructions are still fetched on every step, but the result of decoding them is cached by
+  // the full instruction word. This skips the subtable dispatch and the PPCTables lookup for the
+  // few thousand distinct instructions that make up a game's hot code.
+  struct DecodedInstruction
+  {
+    u32 hex = 0;
+    Instruction fn = nullptr;
+    const GekkoOPInfo* opinfo = nullptr;
+  };
+  static constexpr u32 DECODE_CACHE_SIZE = 0x1000;
+
+  const DecodedInstruction& Decode(UGeckoInstruction inst);
+
   Core::System& m_system;
   PowerPC::PowerPCState& m_ppc_state;
   PowerPC::MMU& m_mmu;
   Core::BranchWatch& m_branch_watch;
   PPCSymbolDB& m_ppc_symbol_db;
 
+  std::array<DecodedInstruction, DECODE_CACHE_SIZE> m_decode_cache{};
+
   UGeckoInstruction m_prev_inst{};
   u32 m_last_pc = 0;
   bool m_end_block = false;
@@ -3,6 +3,9 @@
 
 #include "Core/PowerPC/Jit64/Jit.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
 #include <map>
 #include <sstream>
 #include <string>
@@ -15,14 +18,17 @@
 #include <windows.h>
 #endif
 
+#include "Common/Align.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumUtils.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
+#include "Common/MemoryUtil.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Common/x64ABI.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -44,10 +50,19 @@
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
+#include "VideoCommon/StutterTracker.h"
 
 using namespace Gen;
 using namespace PowerPC;
 
+// How far r1 is checked to be from anything which isn't RAM at the start of a block. This is two
+// times the reach of a displacement, so that accesses after allocating a stack frame benefit too.
+constexpr u32 STACK_POINTER_MARGIN = 0x10000;
+
+// Running out of space in the middle of a block means clearing the whole cache, so hot blocks are
+// only put in free ranges of the hot region which are comfortably larger than any block.
+constexpr std::ptrdiff_t MIN_HOT_FREE_RANGE_SIZE = 0x20000;
+
 // Dolphin's PowerPC->x86_64 JIT dynamic recompiler
 // Written mostly by ector (hrydgard)
 // Features:
@@ -269,6 +284,8 @@ void Jit64::Init()
   const size_t farcode_size = jo.memcheck ? FARCODE_SIZE_MMU : FARCODE_SIZE;
   const size_t constpool_size = m_const_pool.CONST_POOL_SIZE;
   AllocCodeSpace(CODE_SIZE + routines_size + trampolines_size + farcode_size + constpool_size);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    Common::AdviseHugePages(region, total_region_size);
   AddChildCodeSpace(&asm_routines, routines_size);
   AddChildCodeSpace(&trampolines, trampolines_size);
   AddChildCodeSpace(&m_far_code, farcode_size);
@@ -292,6 +309,7 @@ void Jit64::Init()
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
   EnableOptimization();
+  analyzer.SetBranchTakenCounts(&js.branchTakenCounts, HOT_BRANCH_TAKEN_COUNT);
 
   ResetFreeMemoryRanges();
 }
@@ -313,8 +331,13 @@ void Jit64::ClearCache()
 void Jit64::ResetFreeMemoryRanges()
 {
   // Set the entire near and far code regions as unused.
+  const bool use_hot_region = m_enable_tiered_compilation && !m_enable_debugging;
+  m_hot_region_end = region + (use_hot_region ? std::min(HOT_CODE_SIZE, region_size / 4) : 0);
+  m_free_ranges_hot.clear();
+  if (m_hot_region_end != region)
+    m_free_ranges_hot.insert(region, m_hot_region_end);
   m_free_ranges_near.clear();
-  m_free_ranges_near.insert(region, region + region_size);
+  m_free_ranges_near.insert(m_hot_region_end, region + region_size);
   m_free_ranges_far.clear();
   m_free_ranges_far.insert(m_far_code.GetWritableCodePtr(), m_far_code.GetWritableCodeEnd());
 }
@@ -731,6 +754,7 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+  StutterScope stutter_scope(StutterCause::JitCompile);
   Jit(em_address, true);
 }
 
@@ -750,7 +774,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   // Check if any code blocks have been freed in the block cache and transfer this information to
   // the local rangesets to allow overwriting them with new code.
   for (auto range : blocks.GetRangesToFreeNear())
-    m_free_ranges_near.insert(range.first, range.second);
+    GetFreeRangesNear(range.first).insert(range.first, range.second);
   for (auto range : blocks.GetRangesToFreeFar())
     m_free_ranges_far.insert(range.first, range.second);
   blocks.ClearRangesToFree();
@@ -781,11 +805,25 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // With tiered compilation, blocks start out without branch following and instruction merging,
+  // which keeps them small and fast to compile. Hot blocks get recompiled with everything enabled.
+  const bool cold_tier = IsColdTierBlock(em_address);
+  if (cold_tier)
+  {
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CROR_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_CARRY_MERGE);
+    analyzer.ClearOption(PPCAnalyst::PPCAnalyzer::OPTION_BRANCH_FOLLOW);
+  }
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (cold_tier)
+    EnableOptimization();
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -797,7 +835,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     return;
   }
 
-  if (SetEmitterStateToFreeCodeRegion())
+  if (SetEmitterStateToFreeCodeRegion(!cold_tier && m_enable_tiered_compilation))
   {
     u8* near_start = GetWritableCodePtr();
     u8* far_start = m_far_code.GetWritableCodePtr();
@@ -810,7 +848,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       // Mark the memory regions that this code block uses as used in the local rangesets.
       u8* near_end = GetWritableCodePtr();
       if (near_start != near_end)
-        m_free_ranges_near.erase(near_start, near_end);
+        GetFreeRangesNear(near_start).erase(near_start, near_end);
       u8* far_end = m_far_code.GetWritableCodePtr();
       if (far_start != far_end)
         m_free_ranges_far.erase(far_start, far_end);
@@ -842,17 +880,33 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
   std::exit(-1);
 }
 
-bool Jit64::SetEmitterStateToFreeCodeRegion()
+HyoutaUtilities::RangeSizeSet<u8*>& Jit64::GetFreeRangesNear(const u8* ptr)
 {
-  // Find the largest free memory blocks and set code emitters to point at them.
-  // If we can't find a free block return false instead, which will trigger a JIT cache clear.
-  const auto free_near = m_free_ranges_near.by_size_begin();
-  if (free_near == m_free_ranges_near.by_size_end())
+  return ptr < m_hot_region_end ? m_free_ranges_hot : m_free_ranges_near;
+}
+
+bool Jit64::SetEmitterStateToFreeCodeRegion(bool hot)
+{
+  // Hot blocks go to the hot region as long as it has room left, and to the rest of the near code
+  // region otherwise, like any other block.
+  const auto free_hot = m_free_ranges_hot.by_size_begin();
+  if (hot && free_hot != m_free_ranges_hot.by_size_end() &&
+      free_hot.to() - free_hot.from() >= MIN_HOT_FREE_RANGE_SIZE)
   {
-    WARN_LOG_FMT(DYNA_REC, "Failed to find free memory region in near code region.");
-    return false;
+    SetCodePtr(free_hot.from(), free_hot.to());
+  }
+  else
+  {
+    // Find the largest free memory blocks and set code emitters to point at them.
+    // If we can't find a free block return false instead, which will trigger a JIT cache clear.
+    const auto free_near = m_free_ranges_near.by_size_begin();
+    if (free_near == m_free_ranges_near.by_size_end())
+    {
+      WARN_LOG_FMT(DYNA_REC, "Failed to find free memory region in near code region.");
+      return false;
+    }
+    SetCodePtr(free_near.from(), free_near.to());
   }
-  SetCodePtr(free_near.from(), free_near.to());
 
   const auto free_far = m_free_ranges_far.by_size_begin();
   if (free_far == m_free_ranges_far.by_size_end())
@@ -875,9 +929,11 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.curBlock = b;
   js.numLoadStoreInst = 0;
   js.numFloatingPointInst = 0;
+  js.numRegisterSpills = 0;
 
   // TODO: Test if this or AlignCode16 make a difference from GetCodePtr
-  b->normalEntry = AlignCode4();
+  // Hot blocks are few, so aligning their entry points for the host's instruction fetch is cheap.
+  b->normalEntry = GetCodePtr() < m_hot_region_end ? AlignCode16() : AlignCode4();
 
   // Used to get a trace of the last few blocks before a crash, sometimes VERY useful
   if (m_im_here_debug)
@@ -896,6 +952,25 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
 #endif
 
+  if (IsColdTierBlock(js.blockStart))
+  {
+    // Count down the runs of this block, and request a recompile once it is considered hot.
+    b->tier_up_countdown = TIER_UP_RUN_COUNT;
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tier_up_countdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch tier_up = J_CC(CC_Z, Jump::Near);
+
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                       static_cast<u32>(JitInterface::ExceptionType::TierUp));
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, Jump::Near);
+    SwitchToNearCode();
+  }
+
   // Start up the register allocators
   // They use the information in gpa/fpa to preload commonly used registers.
   gpr.Start();
@@ -905,6 +980,7 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   js.skipInstructions = 0;
   js.carryFlag = CarryFlag::InPPCState;
   js.constantGqrValid = BitSet8();
+  js.stackPointerMargin = 0;
 
   // Assume that GQR values don't change often at runtime. Many paired-heavy games use largely float
   // loads and stores, which are significantly faster when inlined (especially in MMU mode, where
@@ -1172,6 +1248,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       NOTICE_LOG_FMT(DYNA_REC, "Unflushed register: {}", ppc_inst);
     }
 #endif
+    for (u32 j = i; j <= i + js.skipInstructions; j++)
+      UpdateStackPointerMargin(m_code_buffer[j]);
+
     i += js.skipInstructions;
     js.skipInstructions = 0;
   }
@@ -1196,6 +1275,9 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   b->codeSize = static_cast<u32>(GetCodePtr() - b->normalEntry);
   b->originalSize = code_block.m_num_instructions;
 
+  DEBUG_LOG_FMT(DYNA_REC, "Compiled block at {:08x}: {} instructions, {} register spills",
+                em_address, code_block.m_num_instructions, js.numRegisterSpills);
+
 #ifdef JIT_LOG_GENERATED_CODE
   LogGeneratedX86(code_block.m_num_instructions, m_code_buffer, start, b);
 #endif
@@ -1236,33 +1318,87 @@ void Jit64::IntializeSpeculativeConstants()
   // constant, guess that it is actually a constant input, and specialize the block based on this
   // assumption. This happens when there are branches in code writing to the gather pipe, but only
   // the first block loads the constant.
+  // The same goes for the small data area anchors r2 and r13, which the EABI keeps constant for
+  // the lifetime of the program. Knowing them lets loads and stores of globals access RAM directly.
   // Insert a check at the start of the block to verify that the value is actually constant.
   // This can save a lot of backpatching and optimize gather pipe writes in more places.
   const u8* target = nullptr;
+  const auto get_target = [&] {
+    if (!target)
+    {
+      SwitchToFarCode();
+      target = GetCodePtr();
+      MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+      ABI_PushRegistersAndAdjustStack({}, 0);
+      ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                         static_cast<u32>(JitInterface::ExceptionType::SpeculativeConstants));
+      ABI_PopRegistersAndAdjustStack({}, 0);
+      JMP(asm_routines.dispatcher_no_check, Jump::Near);
+      SwitchToNearCode();
+    }
+    return target;
+  };
+
   for (auto i : code_block.m_gpr_inputs)
   {
     u32 compileTimeValue = m_ppc_state.gpr[i];
     if (m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue) ||
         m_mmu.IsOptimizableGatherPipeWrite(compileTimeValue - 0x8000) ||
-        compileTimeValue == 0xCC000000)
+        compileTimeValue == 0xCC000000 ||
+        ((i == 2 || i == 13) && m_mmu.IsOptimizableRAMAddress(compileTimeValue, 32)))
     {
-      if (!target)
-      {
-        SwitchToFarCode();
-        target = GetCodePtr();
-        MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
-        ABI_PushRegistersAndAdjustStack({}, 0);
-        ABI_CallFunctionPC(JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
-                           static_cast<u32>(JitInterface::ExceptionType::SpeculativeConstants));
-        ABI_PopRegistersAndAdjustStack({}, 0);
-        JMP(asm_routines.dispatcher_no_check, Jump::Near);
-        SwitchToNearCode();
-      }
       CMP(32, PPCSTATE_GPR(i), Imm32(compileTimeValue));
-      J_CC(CC_NZ, target);
+      J_CC(CC_NZ, get_target());
       gpr.SetImmediate32(i, compileTimeValue, false);
     }
   }
+
+  // The stack pointer changes all the time, so rather than guessing its value, only guess that it
+  // stays far enough away from anything which isn't RAM for accesses relative to it to hit RAM.
+  if (jo.fastmem_arena && code_block.m_gpr_inputs[1] && !gpr.IsImm(1))
+  {
+    const u32 sp = m_ppc_state.gpr[1];
+    if (sp < STACK_POINTER_MARGIN || sp > 0xFFFFFFFF - STACK_POINTER_MARGIN - BAT_PAGE_SIZE)
+      return;
+
+    // BAT mappings have a granularity of BAT_PAGE_SIZE, so checking one address per page is enough.
+    const u32 low = (sp - STACK_POINTER_MARGIN) & ~(BAT_PAGE_SIZE - 1);
+    const u32 high = sp + STACK_POINTER_MARGIN + 8;
+    for (u32 address = low; address < high; address += BAT_PAGE_SIZE)
+    {
+      if (!m_mmu.IsOptimizableRAMAddress(address, 32))
+        return;
+    }
+    const u32 min_sp = low + STACK_POINTER_MARGIN;
+    const u32 max_sp = Common::AlignUp(high, BAT_PAGE_SIZE) - STACK_POINTER_MARGIN - 8;
+
+    MOV(32, R(RSCRATCH), PPCSTATE_GPR(1));
+    SUB(32, R(RSCRATCH), Imm32(min_sp));
+    CMP(32, R(RSCRATCH), Imm32(max_sp - min_sp));
+    J_CC(CC_A, get_target());
+    js.stackPointerMargin = STACK_POINTER_MARGIN;
+  }
+}
+
+void Jit64::UpdateStackPointerMargin(const PPCAnalyst::CodeOp& op)
+{
+  if (!op.regsOut[1])
+    return;
+
+  // stwu r1, -x(r1) and addi r1, r1, x are how functions allocate and free their stack frames.
+  const UGeckoInstruction inst = op.inst;
+  const bool adjusts_sp = inst.RA == 1 && (inst.OPCD == 37 || (inst.OPCD == 14 && inst.RD == 1));
+  const u32 distance = static_cast<u32>(std::abs(static_cast<s32>(inst.SIMM_16)));
+  if (adjusts_sp && distance < js.stackPointerMargin)
+    js.stackPointerMargin -= distance;
+  else
+    js.stackPointerMargin = 0;
+}
+
+bool Jit64::IsKnownRAMAccess(u32 base_reg, s32 offset, int access_size) const
+{
+  const s32 margin = static_cast<s32>(js.stackPointerMargin);
+  return base_reg == 1 && offset >= -margin && offset + (access_size >> 3) <= margin;
 }
 
 bool Jit64::HandleFunctionHooking(u32 address)
@@ -67,12 +67,15 @@ public:
 
   // Finds a free memory region and sets the near and far code emitters to point at that region.
   // Returns false if no free memory region can be found for either of the two.
-  bool SetEmitterStateToFreeCodeRegion();
+  bool SetEmitterStateToFreeCodeRegion(bool hot);
+  HyoutaUtilities::RangeSizeSet<u8*>& GetFreeRangesNear(const u8* ptr);
 
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
   void IntializeSpeculativeConstants();
+  void UpdateStackPointerMargin(const PPCAnalyst::CodeOp& op);
+  bool IsKnownRAMAccess(u32 base_reg, s32 offset, int access_size) const;
 
   JitBlockCache* GetBlockCache() override { return &blocks; }
   void Trace();
@@ -117,6 +120,10 @@ public:
   void AndWithMask(Gen::X64Reg reg, u32 mask);
   void RotateLeft(int bits, Gen::X64Reg regOp, const Gen::OpArg& arg, u8 rotate);
 
+  bool IsCacheLineLoop(UGeckoInstruction inst) const;
+  void WriteCacheLineLoopCount(Gen::X64Reg loop_counter, Gen::X64Reg reg_cycle_count,
+                               Gen::X64Reg reg_downcount);
+
   bool CheckMergedBranch(u32 crf) const;
   void DoMergedBranch();
   void DoMergedBranchCondition();
@@ -135,6 +142,13 @@ public:
 
   void UpdateFPExceptionSummary(Gen::X64Reg fpscr, Gen::X64Reg tmp1, Gen::X64Reg tmp2);
 
+  // Whether the paired single instruction may skip the rounding of its inputs and results to single
+  // precision (and software FMA). This is an opt-in accuracy trade-off, see FastPairedSingles.
+  bool IsRelaxedPairedSingle(UGeckoInstruction inst) const
+  {
+    return m_fast_paired_singles && inst.OPCD == 4;
+  }
+
   void SetFPRFIfNeeded(const Gen::OpArg& xmm, bool single);
   void FinalizeSingleResult(Gen::X64Reg output, const Gen::OpArg& input, bool packed = true,
                             bool duplicate = false);
@@ -280,6 +294,11 @@ private:
 
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_near;
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_far;
+  // Blocks recompiled by tiered compilation are packed together at the start of the near code
+  // region, in [region, m_hot_region_end), so that they don't compete with cold blocks for host
+  // instruction cache and TLB entries. Empty if tiered compilation is disabled.
+  HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges_hot;
+  u8* m_hot_region_end = nullptr;
 
   const bool m_im_here_debug = false;
   const bool m_im_here_log = false;
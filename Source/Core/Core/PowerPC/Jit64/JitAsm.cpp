@@ -225,9 +225,14 @@ void Jit64AsmRoutineManager::Generate()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   MOV(64, R(RMEM), PPCSTATE(mem_ptr));
 
+  // If the block was interpreted instead of compiled, it may have used up the downcount
+  CMP(32, PPCSTATE(downcount), Imm8(0));
+  FixupBranch interpreted_out_of_cycles = J_CC(CC_LE, Jump::Near);
+
   JMP(dispatcher_no_check, Jump::Near);
 
   SetJumpTarget(bail);
+  SetJumpTarget(interpreted_out_of_cycles);
   do_timing = GetCodePtr();
 
   // make sure npc contains the next pc (needed for exception checking in CoreTiming::Advance)
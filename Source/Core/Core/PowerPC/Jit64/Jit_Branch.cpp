@@ -232,6 +232,26 @@ void Jit64::bcx(UGeckoInstruction inst)
     return;
   }
 
+  if (js.op->branchFollowed)
+  {
+    // The analyzer continued at the target of this branch because it is almost always taken, so
+    // the taken path stays inline and the rarely used fall through path becomes a side exit.
+    SwitchToFarCode();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+    {
+      RCForkGuard gpr_guard = gpr.Fork();
+      RCForkGuard fpr_guard = fpr.Fork();
+      gpr.Flush();
+      fpr.Flush();
+      WriteExit(js.compilerPC + 4);
+    }
+    SwitchToNearCode();
+    return;
+  }
+
   {
     RCForkGuard gpr_guard = gpr.Fork();
     RCForkGuard fpr_guard = fpr.Fork();
@@ -243,6 +263,11 @@ void Jit64::bcx(UGeckoInstruction inst)
       // ABI_PARAM1 is safe to use after a GPR flush for an optimization in this function.
       WriteBranchWatch<true>(js.compilerPC, js.op->branchTo, inst, ABI_PARAM1, RSCRATCH, {});
     }
+    if (IsProfiledBranch(inst))
+    {
+      MOV(64, R(RSCRATCH), ImmPtr(GetBranchTakenCounter(js.compilerPC)));
+      ADD(32, MatR(RSCRATCH), Imm8(1));
+    }
     if (js.op->branchIsIdleLoop)
     {
       WriteIdleExit(js.op->branchTo);
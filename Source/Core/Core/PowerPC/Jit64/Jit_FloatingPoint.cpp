@@ -54,7 +54,7 @@ void Jit64::SetFPRFIfNeeded(const OpArg& input, bool single)
 void Jit64::FinalizeSingleResult(X64Reg output, const OpArg& input, bool packed, bool duplicate)
 {
   // Most games don't need these. Zelda requires it though - some platforms get stuck without them.
-  if (jo.accurateSinglePrecision)
+  if (jo.accurateSinglePrecision && !(packed && IsRelaxedPairedSingle(js.op->inst)))
   {
     if (packed)
     {
@@ -268,7 +268,7 @@ void Jit64::fp_arith(UGeckoInstruction inst)
     break;
   case 25:
     reversible = true;
-    round_rhs = single && !js.op->fprIsSingle[c];
+    round_rhs = single && !js.op->fprIsSingle[c] && !IsRelaxedPairedSingle(inst);
     preserve_inputs = m_accurate_nans;
     avxOp = packed ? &XEmitter::VMULPD : &XEmitter::VMULSD;
     sseOp = packed ? &XEmitter::MULPD : &XEmitter::MULSD;
@@ -365,7 +365,11 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   // There is one circumstance where the software FMA path does get used: when an input recording
   // is created on a CPU that has FMA instructions and then gets played back on a CPU that doesn't.
   // (Or if the user just really wants to override the setting and knows how to do so.)
-  const bool use_fma = Config::Get(Config::SESSION_USE_FMA);
+  //
+  // With relaxed paired singles, results don't have to match exactly anyway, so the host's FMA is
+  // used whenever there is one and the slow software path is never used.
+  const bool relaxed = IsRelaxedPairedSingle(inst);
+  const bool use_fma = relaxed ? cpu_info.bFMA : Config::Get(Config::SESSION_USE_FMA);
   const bool software_fma = use_fma && !cpu_info.bFMA;
 
   int a = inst.FA;
@@ -373,7 +377,7 @@ void Jit64::fmaddXX(UGeckoInstruction inst)
   int c = inst.FC;
   int d = inst.FD;
   bool single = inst.OPCD == 4 || inst.OPCD == 59;
-  bool round_input = single && !js.op->fprIsSingle[c];
+  bool round_input = single && !js.op->fprIsSingle[c] && !relaxed;
   bool preserve_inputs = m_accurate_nans;
   bool preserve_d = preserve_inputs && (a == d || b == d || c == d);
   bool packed =
@@ -133,6 +133,7 @@ void Jit64::lXXx(UGeckoInstruction inst)
 
   bool storeAddress = false;
   s32 loadOffset = 0;
+  int flags = 0;
 
   // Prepare result
   RCX64Reg Rd = jo.memcheck ? gpr.RevertableBind(d, RCMode::Write) : gpr.Bind(d, RCMode::Write);
@@ -181,6 +182,9 @@ void Jit64::lXXx(UGeckoInstruction inst)
 
       RCOpArg Rb = use_constant_offset ? RCOpArg{} : gpr.Use(b, RCMode::Read);
 
+      if (use_constant_offset && IsKnownRAMAccess(a, offset, accessSize))
+        flags |= SAFE_LOADSTORE_KNOWN_RAM;
+
       // Depending on whether we have an immediate and/or update, find the optimum way to calculate
       // the load address.
       if ((update || use_constant_offset) && !jo.memcheck)
@@ -219,7 +223,7 @@ void Jit64::lXXx(UGeckoInstruction inst)
   if (update && storeAddress)
     registersInUse[RSCRATCH2] = true;
 
-  SafeLoadToReg(Rd, opAddress, accessSize, loadOffset, registersInUse, signExtend);
+  SafeLoadToReg(Rd, opAddress, accessSize, loadOffset, registersInUse, signExtend, flags);
 
   if (update && storeAddress)
     MOV(32, Ra, opAddress);
@@ -229,6 +233,102 @@ void Jit64::lXXx(UGeckoInstruction inst)
     BSWAP(accessSize, Rd);
 }
 
+// Checks if the next instructions match a known looping pattern:
+// - dcbx rX
+// - addi rX,rX,32
+// - bdnz+ -8
+bool Jit64::IsCacheLineLoop(UGeckoInstruction inst) const
+{
+  return inst.RA == 0 && inst.RB != 0 && CanMergeNextInstructions(2) &&
+         (js.op[1].inst.hex & 0xfc00'ffff) == 0x38000020 && js.op[1].inst.RA_6 == inst.RB &&
+         js.op[1].inst.RD_2 == inst.RB && js.op[2].inst.hex == 0x4200fff8;
+}
+
+// Handles the loop counting for a dcb* instruction at js.op[0] followed by the pattern
+//   addi rX,rX,32
+//   bdnz+ -8
+// We'll execute somewhere between one single loop iteration and however many are needed to reduce
+// the downcount to zero, never exceeding the amount requested by the game. To stay consistent with
+// the rest of the code we adjust CTR and the downcount by the amount of iterations minus one --
+// since we'll run the regular addi and bdnz afterwards! Afterwards, RSCRATCH2 holds the amount of
+// iterations minus one (which the caller must still add to rX, times 32), and loop_counter holds
+// the amount of iterations.
+void Jit64::WriteCacheLineLoopCount(X64Reg loop_counter, X64Reg reg_cycle_count,
+                                    X64Reg reg_downcount)
+{
+  // This must be true in order for us to pick up the DIV results and not trash any data.
+  static_assert(RSCRATCH == Gen::EAX && RSCRATCH2 == Gen::EDX);
+
+  // Alright, now figure out how many loops we want to do.
+  const u8 cycle_count_per_loop =
+      js.op[0].opinfo->num_cycles + js.op[1].opinfo->num_cycles + js.op[2].opinfo->num_cycles;
+
+  // This is both setting the adjusted loop count to 0 for the downcount <= 0 case and clearing
+  // the upper bits for the DIV instruction in the downcount > 0 case.
+  XOR(32, R(RSCRATCH2), R(RSCRATCH2));
+
+  MOV(32, R(RSCRATCH), PPCSTATE(downcount));
+  TEST(32, R(RSCRATCH), R(RSCRATCH));                       // if (downcount <= 0)
+  FixupBranch downcount_is_zero_or_negative = J_CC(CC_LE);  // only do 1 iteration; else:
+  MOV(32, R(loop_counter), PPCSTATE_CTR);
+  MOV(32, R(reg_downcount), R(RSCRATCH));
+  MOV(32, R(reg_cycle_count), Imm32(cycle_count_per_loop));
+  DIV(32, R(reg_cycle_count));                  // RSCRATCH = downcount / cycle_count
+  LEA(32, RSCRATCH2, MDisp(loop_counter, -1));  // RSCRATCH2 = CTR - 1
+  // ^ Note that this CTR-1 implicitly handles the CTR == 0 case correctly.
+  CMP(32, R(RSCRATCH), R(RSCRATCH2));
+  CMOVcc(32, RSCRATCH2, R(RSCRATCH), CC_B);  // RSCRATCH2 = min(RSCRATCH, RSCRATCH2)
+
+  // RSCRATCH2 now holds the amount of loops to execute minus 1, which is the amount we need to
+  // adjust downcount, CTR, and Rb by to exit the loop construct with the right values in those
+  // registers.
+  SUB(32, R(loop_counter), R(RSCRATCH2));
+  MOV(32, PPCSTATE_CTR, R(loop_counter));  // CTR -= RSCRATCH2
+  IMUL(32, reg_cycle_count, R(RSCRATCH2));
+  // ^ Note that this cannot overflow because it's limited by (downcount/cycle_count).
+  SUB(32, R(reg_downcount), R(reg_cycle_count));
+  MOV(32, PPCSTATE(downcount), R(reg_downcount));  // downcount -= (RSCRATCH2 * reg_cycle_count)
+
+  SetJumpTarget(downcount_is_zero_or_negative);
+
+  // Load the loop_counter register with the amount of iterations to execute.
+  LEA(32, loop_counter, MDisp(RSCRATCH2, 1));
+
+  if (IsDebuggingEnabled())
+  {
+    const X64Reg bw_reg_a = reg_cycle_count, bw_reg_b = reg_downcount;
+    const BitSet32 bw_caller_save = (CallerSavedRegistersInUse() | BitSet32{RSCRATCH2}) &
+                                    ~BitSet32{int(bw_reg_a), int(bw_reg_b)};
+
+    MOV(64, R(bw_reg_a), ImmPtr(&m_branch_watch));
+    MOVZX(32, 8, bw_reg_b, MDisp(bw_reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
+    TEST(32, R(bw_reg_b), R(bw_reg_b));
+
+    FixupBranch branch_in = J_CC(CC_NZ, Jump::Near);
+    SwitchToFarCode();
+    SetJumpTarget(branch_in);
+
+    // Assert RSCRATCH2 won't be clobbered before it is moved from.
+    static_assert(RSCRATCH2 != ABI_PARAM1);
+
+    ABI_PushRegistersAndAdjustStack(bw_caller_save, 0);
+    MOV(64, R(ABI_PARAM1), R(bw_reg_a));
+    // RSCRATCH2 holds the amount of faked branch watch hits. Move RSCRATCH2 first, because
+    // ABI_PARAM2 clobbers RSCRATCH2 on Windows and ABI_PARAM3 clobbers RSCRATCH2 on Linux!
+    MOV(32, R(ABI_PARAM4), R(RSCRATCH2));
+    const PPCAnalyst::CodeOp& op = js.op[2];
+    MOV(64, R(ABI_PARAM2), Imm64(Core::FakeBranchWatchCollectionKey{op.address, op.branchTo}));
+    MOV(32, R(ABI_PARAM3), Imm32(op.inst.hex));
+    ABI_CallFunction(m_ppc_state.msr.IR ? &Core::BranchWatch::HitVirtualTrue_fk_n :
+                                          &Core::BranchWatch::HitPhysicalTrue_fk_n);
+    ABI_PopRegistersAndAdjustStack(bw_caller_save, 0);
+
+    FixupBranch branch_out = J(Jump::Near);
+    SwitchToNearCode();
+    SetJumpTarget(branch_out);
+  }
+}
+
 void Jit64::dcbx(UGeckoInstruction inst)
 {
   FALLBACK_IF(m_accurate_cpu_cache_enabled);
@@ -236,14 +336,7 @@ void Jit64::dcbx(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStoreOff);
 
-  // Check if the next instructions match a known looping pattern:
-  // - dcbx rX
-  // - addi rX,rX,32
-  // - bdnz+ -8
-  const bool make_loop = inst.RA == 0 && inst.RB != 0 && CanMergeNextInstructions(2) &&
-                         (js.op[1].inst.hex & 0xfc00'ffff) == 0x38000020 &&
-                         js.op[1].inst.RA_6 == inst.RB && js.op[1].inst.RD_2 == inst.RB &&
-                         js.op[2].inst.hex == 0x4200fff8;
+  const bool make_loop = IsCacheLineLoop(inst);
 
   RCOpArg Ra = inst.RA ? gpr.Use(inst.RA, RCMode::Read) : RCOpArg::Imm32(0);
   RCX64Reg Rb = gpr.Bind(inst.RB, make_loop ? RCMode::ReadWrite : RCMode::Read);
@@ -252,89 +345,12 @@ void Jit64::dcbx(UGeckoInstruction inst)
   RCX64Reg loop_counter;
   if (make_loop)
   {
-    // We'll execute somewhere between one single cacheline invalidation and however many are needed
-    // to reduce the downcount to zero, never exceeding the amount requested by the game.
-    // To stay consistent with the rest of the code we adjust the involved registers (CTR and Rb)
-    // by the amount of cache lines we invalidate minus one -- since we'll run the regular addi and
-    // bdnz afterwards! So if we invalidate a single cache line, we don't adjust the registers at
-    // all, if we invalidate 2 cachelines we adjust the registers by one step, and so on.
-
     RCX64Reg reg_cycle_count = gpr.Scratch();
     RCX64Reg reg_downcount = gpr.Scratch();
     loop_counter = gpr.Scratch();
     RegCache::Realize(reg_cycle_count, reg_downcount, loop_counter);
 
-    // This must be true in order for us to pick up the DIV results and not trash any data.
-    static_assert(RSCRATCH == Gen::EAX && RSCRATCH2 == Gen::EDX);
-
-    // Alright, now figure out how many loops we want to do.
-    const u8 cycle_count_per_loop =
-        js.op[0].opinfo->num_cycles + js.op[1].opinfo->num_cycles + js.op[2].opinfo->num_cycles;
-
-    // This is both setting the adjusted loop count to 0 for the downcount <= 0 case and clearing
-    // the upper bits for the DIV instruction in the downcount > 0 case.
-    XOR(32, R(RSCRATCH2), R(RSCRATCH2));
-
-    MOV(32, R(RSCRATCH), PPCSTATE(downcount));
-    TEST(32, R(RSCRATCH), R(RSCRATCH));                       // if (downcount <= 0)
-    FixupBranch downcount_is_zero_or_negative = J_CC(CC_LE);  // only do 1 invalidation; else:
-    MOV(32, R(loop_counter), PPCSTATE_CTR);
-    MOV(32, R(reg_downcount), R(RSCRATCH));
-    MOV(32, R(reg_cycle_count), Imm32(cycle_count_per_loop));
-    DIV(32, R(reg_cycle_count));                  // RSCRATCH = downcount / cycle_count
-    LEA(32, RSCRATCH2, MDisp(loop_counter, -1));  // RSCRATCH2 = CTR - 1
-    // ^ Note that this CTR-1 implicitly handles the CTR == 0 case correctly.
-    CMP(32, R(RSCRATCH), R(RSCRATCH2));
-    CMOVcc(32, RSCRATCH2, R(RSCRATCH), CC_B);  // RSCRATCH2 = min(RSCRATCH, RSCRATCH2)
-
-    // RSCRATCH2 now holds the amount of loops to execute minus 1, which is the amount we need to
-    // adjust downcount, CTR, and Rb by to exit the loop construct with the right values in those
-    // registers.
-    SUB(32, R(loop_counter), R(RSCRATCH2));
-    MOV(32, PPCSTATE_CTR, R(loop_counter));  // CTR -= RSCRATCH2
-    IMUL(32, reg_cycle_count, R(RSCRATCH2));
-    // ^ Note that this cannot overflow because it's limited by (downcount/cycle_count).
-    SUB(32, R(reg_downcount), R(reg_cycle_count));
-    MOV(32, PPCSTATE(downcount), R(reg_downcount));  // downcount -= (RSCRATCH2 * reg_cycle_count)
-
-    SetJumpTarget(downcount_is_zero_or_negative);
-
-    // Load the loop_counter register with the amount of invalidations to execute.
-    LEA(32, loop_counter, MDisp(RSCRATCH2, 1));
-
-    if (IsDebuggingEnabled())
-    {
-      const X64Reg bw_reg_a = reg_cycle_count, bw_reg_b = reg_downcount;
-      const BitSet32 bw_caller_save = (CallerSavedRegistersInUse() | BitSet32{RSCRATCH2}) &
-                                      ~BitSet32{int(bw_reg_a), int(bw_reg_b)};
-
-      MOV(64, R(bw_reg_a), ImmPtr(&m_branch_watch));
-      MOVZX(32, 8, bw_reg_b, MDisp(bw_reg_a, Core::BranchWatch::GetOffsetOfRecordingActive()));
-      TEST(32, R(bw_reg_b), R(bw_reg_b));
-
-      FixupBranch branch_in = J_CC(CC_NZ, Jump::Near);
-      SwitchToFarCode();
-      SetJumpTarget(branch_in);
-
-      // Assert RSCRATCH2 won't be clobbered before it is moved from.
-      static_assert(RSCRATCH2 != ABI_PARAM1);
-
-      ABI_PushRegistersAndAdjustStack(bw_caller_save, 0);
-      MOV(64, R(ABI_PARAM1), R(bw_reg_a));
-      // RSCRATCH2 holds the amount of faked branch watch hits. Move RSCRATCH2 first, because
-      // ABI_PARAM2 clobbers RSCRATCH2 on Windows and ABI_PARAM3 clobbers RSCRATCH2 on Linux!
-      MOV(32, R(ABI_PARAM4), R(RSCRATCH2));
-      const PPCAnalyst::CodeOp& op = js.op[2];
-      MOV(64, R(ABI_PARAM2), Imm64(Core::FakeBranchWatchCollectionKey{op.address, op.branchTo}));
-      MOV(32, R(ABI_PARAM3), Imm32(op.inst.hex));
-      ABI_CallFunction(m_ppc_state.msr.IR ? &Core::BranchWatch::HitVirtualTrue_fk_n :
-                                            &Core::BranchWatch::HitPhysicalTrue_fk_n);
-      ABI_PopRegistersAndAdjustStack(bw_caller_save, 0);
-
-      FixupBranch branch_out = J(Jump::Near);
-      SwitchToNearCode();
-      SetJumpTarget(branch_out);
-    }
+    WriteCacheLineLoopCount(loop_counter, reg_cycle_count, reg_downcount);
   }
 
   X64Reg addr = RSCRATCH;
@@ -439,6 +455,39 @@ void Jit64::dcbz(UGeckoInstruction inst)
   int a = inst.RA;
   int b = inst.RB;
 
+  // The fast path writes to memory directly, which would bypass the emulated data cache.
+  const bool emit_fast_path = (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR) &&
+                              m_jit.jo.fastmem_arena && !m_accurate_cpu_cache_enabled;
+
+  // If each iteration of a dcbz loop would have to call ClearDCacheLine anyway, clear all lines
+  // with one call instead. This isn't done when memchecks are enabled, as a DSI in the middle of
+  // the loop would leave CTR and rB already adjusted for the whole loop.
+  if (!emit_fast_path && !m_low_dcbz_hack && !jo.memcheck && IsCacheLineLoop(inst))
+  {
+    RCX64Reg Rb = gpr.Bind(b, RCMode::ReadWrite);
+    RCX64Reg reg_cycle_count = gpr.Scratch();
+    RCX64Reg reg_downcount = gpr.Scratch();
+    RCX64Reg loop_counter = gpr.Scratch();
+    RegCache::Realize(Rb, reg_cycle_count, reg_downcount, loop_counter);
+
+    WriteCacheLineLoopCount(loop_counter, reg_cycle_count, reg_downcount);
+
+    MOV(32, R(RSCRATCH), R(Rb));
+    AND(32, R(RSCRATCH), Imm32(~31));
+    SHL(32, R(RSCRATCH2), Imm8(5));
+    ADD(32, R(Rb), R(RSCRATCH2));  // Rb += (RSCRATCH2 * 32)
+
+    MOV(32, PPCSTATE(pc), Imm32(js.compilerPC));
+    BitSet32 registersInUse = CallerSavedRegistersInUse();
+    registersInUse[X64Reg(reg_cycle_count)] = false;
+    registersInUse[X64Reg(reg_downcount)] = false;
+    registersInUse[X64Reg(loop_counter)] = false;
+    ABI_PushRegistersAndAdjustStack(registersInUse, 0);
+    ABI_CallFunctionPRR(PowerPC::ClearDCacheLinesFromJit, &m_mmu, RSCRATCH, loop_counter);
+    ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+    return;
+  }
+
   {
     RCOpArg Ra = a ? gpr.Use(a, RCMode::Read) : RCOpArg::Imm32(0);
     RCOpArg Rb = gpr.Use(b, RCMode::Read);
@@ -456,8 +505,6 @@ void Jit64::dcbz(UGeckoInstruction inst)
     end_dcbz_hack = J_CC(CC_L);
   }
 
-  bool emit_fast_path = (m_ppc_state.feature_flags & FEATURE_FLAG_MSR_DR) && m_jit.jo.fastmem_arena;
-
   if (emit_fast_path)
   {
     // Perform lookup to see if we can use fast path.
@@ -564,8 +611,10 @@ void Jit64::stX(UGeckoInstruction inst)
       reg_value = gpr.BindOrImm(s, RCMode::Read);
     }
     RegCache::Realize(Ra, reg_value);
-    SafeWriteRegToReg(reg_value, Ra, accessSize, offset, CallerSavedRegistersInUse(),
-                      SAFE_LOADSTORE_CLOBBER_RSCRATCH_INSTEAD_OF_ADDR);
+    int flags = SAFE_LOADSTORE_CLOBBER_RSCRATCH_INSTEAD_OF_ADDR;
+    if (IsKnownRAMAccess(a, offset, accessSize))
+      flags |= SAFE_LOADSTORE_KNOWN_RAM;
+    SafeWriteRegToReg(reg_value, Ra, accessSize, offset, CallerSavedRegistersInUse(), flags);
 
     if (update)
       ADD(32, Ra, Imm32((u32)offset));
@@ -67,7 +67,10 @@ void Jit64::lfXXX(UGeckoInstruction inst)
   BitSet32 registersInUse = CallerSavedRegistersInUse();
   if (update && jo.memcheck)
     registersInUse[RSCRATCH2] = true;
-  SafeLoadToReg(RSCRATCH, addr, single ? 32 : 64, offset, registersInUse, false);
+  int flags = 0;
+  if (!indexed && IsKnownRAMAccess(a, static_cast<s16>(inst.SIMM_16), single ? 32 : 64))
+    flags |= SAFE_LOADSTORE_KNOWN_RAM;
+  SafeLoadToReg(RSCRATCH, addr, single ? 32 : 64, offset, registersInUse, false, flags);
 
   if (single)
   {
@@ -180,7 +183,10 @@ void Jit64::stfXXX(UGeckoInstruction inst)
   if (update)
     registersInUse[RSCRATCH2] = true;
 
-  SafeWriteRegToReg(RSCRATCH, RSCRATCH2, accessSize, offset, registersInUse);
+  int flags = 0;
+  if (!indexed && IsKnownRAMAccess(a, imm, accessSize))
+    flags |= SAFE_LOADSTORE_KNOWN_RAM;
+  SafeWriteRegToReg(RSCRATCH, RSCRATCH2, accessSize, offset, registersInUse, flags);
 
   if (update)
     MOV(32, Ra, R(RSCRATCH2));
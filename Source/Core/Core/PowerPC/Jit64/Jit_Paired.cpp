@@ -81,7 +81,7 @@ void Jit64::ps_muls(UGeckoInstruction inst)
   int d = inst.FD;
   int a = inst.FA;
   int c = inst.FC;
-  bool round_input = !js.op->fprIsSingle[c];
+  bool round_input = !js.op->fprIsSingle[c] && !IsRelaxedPairedSingle(inst);
 
   RCOpArg Ra = fpr.Use(a, RCMode::Read);
   RCOpArg Rc = fpr.Use(c, RCMode::Read);
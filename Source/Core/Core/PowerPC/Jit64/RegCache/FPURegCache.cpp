@@ -42,7 +42,7 @@ BitSet32 FPURegCache::GetRegUtilization() const
   return m_jit.js.op->fprInXmm;
 }
 
-BitSet32 FPURegCache::CountRegsIn(preg_t preg, u32 lookahead) const
+std::optional<BitSet32> FPURegCache::CountRegsIn(preg_t preg, u32 lookahead) const
 {
   BitSet32 regs_used;
 
@@ -52,6 +52,8 @@ BitSet32 FPURegCache::CountRegsIn(preg_t preg, u32 lookahead) const
     regs_used |= regs_in;
     if (regs_in[preg])
       return regs_used;
+
+    // Don't treat writes as killing the value, as many instructions only replace PS0.
   }
 
   return regs_used;
@@ -18,5 +18,5 @@ protected:
   void LoadRegister(preg_t preg, Gen::X64Reg newLoc) override;
   std::span<const Gen::X64Reg> GetAllocationOrder() const override;
   BitSet32 GetRegUtilization() const override;
-  BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
+  std::optional<BitSet32> CountRegsIn(preg_t preg, u32 lookahead) const override;
 };
@@ -59,7 +59,7 @@ BitSet32 GPRRegCache::GetRegUtilization() const
   return m_jit.js.op->gprInUse;
 }
 
-BitSet32 GPRRegCache::CountRegsIn(preg_t preg, u32 lookahead) const
+std::optional<BitSet32> GPRRegCache::CountRegsIn(preg_t preg, u32 lookahead) const
 {
   BitSet32 regs_used;
 
@@ -69,6 +69,8 @@ BitSet32 GPRRegCache::CountRegsIn(preg_t preg, u32 lookahead) const
     regs_used |= regs_in;
     if (regs_in[preg])
       return regs_used;
+    if (m_jit.js.op[i].regsOut[preg])
+      return std::nullopt;
   }
 
   return regs_used;
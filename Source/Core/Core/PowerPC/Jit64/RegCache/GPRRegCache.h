@@ -19,5 +19,5 @@ protected:
   void LoadRegister(preg_t preg, Gen::X64Reg new_loc) override;
   std::span<const Gen::X64Reg> GetAllocationOrder() const override;
   BitSet32 GetRegUtilization() const override;
-  BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const override;
+  std::optional<BitSet32> CountRegsIn(preg_t preg, u32 lookahead) const override;
 };
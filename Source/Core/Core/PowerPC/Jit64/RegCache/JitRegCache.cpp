@@ -609,6 +609,7 @@ X64Reg RegCache::GetFreeXReg()
   if (best_xreg != INVALID_REG)
   {
     StoreFromRegister(best_preg);
+    m_jit.js.numRegisterSpills++;
     return best_xreg;
   }
 
@@ -651,10 +652,14 @@ float RegCache::ScoreRegister(X64Reg xreg) const
     // This actually improves register allocation a tiny bit; I'm not sure why.
     u32 lookahead = std::min(m_jit.js.instructionsLeft, 64);
     // Count how many other registers are going to be used before we need this one again.
-    u32 regs_in_count = CountRegsIn(preg, lookahead).Count();
-    // Totally ad-hoc heuristic to bias based on how many other registers we'll need
-    // before this one gets used again.
-    score += 1 + 2 * (5 - log2f(1 + (float)regs_in_count));
+    // If it gets overwritten first, it never has to be loaded again.
+    if (const std::optional<BitSet32> regs_in = CountRegsIn(preg, lookahead))
+    {
+      u32 regs_in_count = regs_in->Count();
+      // Totally ad-hoc heuristic to bias based on how many other registers we'll need
+      // before this one gets used again.
+      score += 1 + 2 * (5 - log2f(1 + (float)regs_in_count));
+    }
   }
 
   return score;
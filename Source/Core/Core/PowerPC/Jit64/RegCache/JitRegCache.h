@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <span>
 #include <type_traits>
 #include <variant>
@@ -190,7 +191,9 @@ protected:
   virtual std::span<const Gen::X64Reg> GetAllocationOrder() const = 0;
 
   virtual BitSet32 GetRegUtilization() const = 0;
-  virtual BitSet32 CountRegsIn(preg_t preg, u32 lookahead) const = 0;
+  // Returns the registers read by the upcoming instructions before preg is read again, or nullopt
+  // if preg is overwritten before it is read again, which means its current value is dead.
+  virtual std::optional<BitSet32> CountRegsIn(preg_t preg, u32 lookahead) const = 0;
 
   void FlushX(Gen::X64Reg reg);
   void DiscardRegContentsIfCached(preg_t preg);
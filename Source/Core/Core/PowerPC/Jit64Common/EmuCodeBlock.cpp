@@ -204,6 +204,70 @@ bool EmuCodeBlock::UnsafeLoadToReg(X64Reg reg_value, OpArg opAddress, int access
   return offsetAddedToAddress;
 }
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Core::System* system, Gen::X64CodeBlock* code, BitSet32 registers_in_use,
+                         const Gen::OpArg& value, u32 address, u32 pc)
+      : m_system(system), m_code(code), m_registers_in_use(registers_in_use), m_value(value),
+        m_address(address), m_pc(pc)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // Do nothing
+  }
+  void VisitDirect(T* addr, u32 mask) override { WriteRegToAddr(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(Core::System&, u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  // Loads the zero extended value to RSCRATCH.
+  void LoadValueToScratch(int sbits)
+  {
+    const u32 all_ones = (1ULL << sbits) - 1;
+    if (m_value.IsImm())
+      m_code->MOV(32, R(RSCRATCH), Imm32(m_value.AsImm32().Imm32() & all_ones));
+    else if (sbits == 32)
+      m_code->MOV(32, R(RSCRATCH), m_value);
+    else
+      m_code->MOVZX(32, sbits, RSCRATCH, m_value);
+  }
+
+  void WriteRegToAddr(int sbits, void* ptr, u32 mask)
+  {
+    const u32 all_ones = (1ULL << sbits) - 1;
+    LoadValueToScratch(sbits);
+    if ((all_ones & mask) != all_ones)
+      m_code->AND(32, R(RSCRATCH), Imm32(mask));
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+    m_code->MOV(sbits, MatR(RSCRATCH2), R(RSCRATCH));
+  }
+
+  void CallLambda(int sbits, const std::function<void(Core::System&, u32, T)>* lambda)
+  {
+    // Helps external systems know which instruction triggered the write
+    m_code->MOV(32, PPCSTATE(pc), Imm32(m_pc));
+
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    LoadValueToScratch(sbits);
+    m_code->ABI_CallLambdaPCR(lambda, m_system, m_address, RSCRATCH);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Core::System* m_system;
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_value;
+  u32 m_address;
+  u32 m_pc;
+};
+
 // Visitor that generates code to read a MMIO value.
 template <typename T>
 class MMIOReadCodeGenerator : public MMIO::ReadHandlingMethodVisitor<T>
@@ -323,6 +387,18 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
 
   auto& js = m_jit.js;
   registersInUse[reg_value] = false;
+
+  // Loads from RAM can't fault, so they don't need any fallback code or backpatching information.
+  const bool known_ram =
+      (flags & SAFE_LOADSTORE_KNOWN_RAM) ||
+      (opAddress.IsImm() &&
+       m_jit.m_mmu.IsOptimizableRAMAddress(opAddress.Imm32() + offset, accessSize));
+  if (known_ram && m_jit.jo.fastmem_arena && !force_slow_access)
+  {
+    UnsafeLoadToReg(reg_value, opAddress, accessSize, offset, signExtend);
+    return;
+  }
+
   if (m_jit.jo.fastmem && !(flags & (SAFE_LOADSTORE_NO_FASTMEM | SAFE_LOADSTORE_NO_UPDATE_PC)) &&
       !force_slow_access)
   {
@@ -501,6 +577,12 @@ void EmuCodeBlock::SafeWriteRegToReg(OpArg reg_value, X64Reg reg_addr, int acces
   reg_value = FixImmediate(accessSize, reg_value);
 
   auto& js = m_jit.js;
+  if ((flags & SAFE_LOADSTORE_KNOWN_RAM) && m_jit.jo.fastmem_arena && !force_slow_access)
+  {
+    UnsafeWriteRegToReg(reg_value, reg_addr, accessSize, offset, swap);
+    return;
+  }
+
   if (m_jit.jo.fastmem && !(flags & (SAFE_LOADSTORE_NO_FASTMEM | SAFE_LOADSTORE_NO_UPDATE_PC)) &&
       !force_slow_access)
   {
@@ -629,6 +711,35 @@ bool EmuCodeBlock::WriteClobbersRegValue(int accessSize, bool swap)
   return swap && !cpu_info.bMOVBE && accessSize > 8;
 }
 
+void EmuCodeBlock::MMIOWriteToAddr(MMIO::Mapping* mmio, const Gen::OpArg& value,
+                                   BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(&m_jit.m_system, this, registers_in_use, value, address,
+                                   m_jit.js.compilerPC);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(&m_jit.m_system, this, registers_in_use, value, address,
+                                    m_jit.js.compilerPC);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(&m_jit.m_system, this, registers_in_use, value, address,
+                                    m_jit.js.compilerPC);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
                                        BitSet32 registersInUse)
 {
@@ -661,6 +772,13 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
     WriteToConstRamAddress(accessSize, arg, address);
     return false;
   }
+  else if (const u32 mmio_address = m_jit.m_mmu.IsOptimizableMMIOAccess(address, accessSize);
+           accessSize != 64 && mmio_address)
+  {
+    auto& memory = m_jit.m_system.GetMemory();
+    MMIOWriteToAddr(memory.GetMMIOMapping(), arg, registersInUse, mmio_address, accessSize);
+    return false;
+  }
   else
   {
     // Helps external systems know which instruction triggered the write
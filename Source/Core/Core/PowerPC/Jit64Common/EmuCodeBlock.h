@@ -68,6 +68,9 @@ public:
   // call for known addresses in MMIO range (MMIO::IsMMIOAddress).
   void MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value, BitSet32 registers_in_use,
                      u32 address, int access_size, bool sign_extend);
+  // Same as above, for writes.
+  void MMIOWriteToAddr(MMIO::Mapping* mmio, const Gen::OpArg& value, BitSet32 registers_in_use,
+                       u32 address, int access_size);
 
   enum SafeLoadStoreFlags
   {
@@ -81,6 +84,9 @@ public:
     SAFE_LOADSTORE_DR_ON = 32,
     // Generated from a context that doesn't have the PC of the instruction that caused it
     SAFE_LOADSTORE_NO_UPDATE_PC = 64,
+    // The address is known to be in RAM which is mapped in the fastmem arena, so the access can't
+    // fault and doesn't need to be backpatchable
+    SAFE_LOADSTORE_KNOWN_RAM = 128,
   };
 
   void SafeLoadToReg(Gen::X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize, s32 offset,
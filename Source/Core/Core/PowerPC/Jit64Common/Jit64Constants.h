@@ -21,3 +21,5 @@ constexpr Gen::X64Reg RMEM = Gen::RBX;
 constexpr Gen::X64Reg RPPCSTATE = Gen::RBP;
 
 constexpr size_t CODE_SIZE = 1024 * 1024 * 128;
+// With tiered compilation, this much of the near code region is set aside for hot blocks.
+constexpr size_t HOT_CODE_SIZE = 1024 * 1024 * 16;
@@ -11,9 +11,11 @@
 #include "Common/EnumUtils.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
+#include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -28,6 +30,7 @@
 #include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
+#include "VideoCommon/StutterTracker.h"
 
 using namespace Arm64Gen;
 
@@ -56,6 +59,8 @@ void JitArm64::Init()
   // AddChildCodeSpace grabs space from the end of the parent region,
   // so we have to call AddChildCodeSpace in reverse order.
   AllocCodeSpace(TOTAL_CODE_SIZE);
+  if (Config::Get(Config::MAIN_HUGE_PAGES))
+    Common::AdviseHugePages(region, total_region_size);
   AddChildCodeSpace(&m_far_code_1, FAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_1, NEAR_CODE_SIZE);
   AddChildCodeSpace(&m_near_code_0, NEAR_CODE_SIZE);
@@ -74,6 +79,7 @@ void JitArm64::Init()
   code_block.m_stats = &js.st;
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
+  analyzer.SetBranchTakenCounts(&js.branchTakenCounts, HOT_BRANCH_TAKEN_COUNT);
 
   InitBLROptimization();
 
@@ -902,6 +908,7 @@ void JitArm64::Trace()
 
 void JitArm64::Jit(u32 em_address)
 {
+  StutterScope stutter_scope(StutterCause::JitCompile);
   Jit(em_address, true);
 }
 
@@ -963,11 +970,20 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  // With tiered compilation, blocks start out without branch following and instruction merging,
+  // which keeps them small and fast to compile. Hot blocks get recompiled with everything enabled.
+  const bool cold_tier = IsColdTierBlock(em_address);
+  if (cold_tier)
+    SetOptimizationEnabled(false);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (cold_tier)
+    SetOptimizationEnabled(true);
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -1101,6 +1117,27 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  if (IsColdTierBlock(js.blockStart))
+  {
+    // Count down the runs of this block, and request a recompile once it is considered hot.
+    b->tier_up_countdown = TIER_UP_RUN_COUNT;
+    MOVP2R(ARM64Reg::X0, &b->tier_up_countdown);
+    LDR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    SUB(ARM64Reg::W1, ARM64Reg::W1, 1);
+    STR(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+    FixupBranch no_tier_up = CBNZ(ARM64Reg::W1);
+    FixupBranch tier_up = B();
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOVI2R(DISPATCHER_PC, js.blockStart);
+    STR(IndexType::Unsigned, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
+    ABI_CallFunction(&JitInterface::CompileExceptionCheckFromJIT, &m_system.GetJitInterface(),
+                     static_cast<u32>(JitInterface::ExceptionType::TierUp));
+    B(dispatcher_no_check);
+    SwitchToNearCode();
+    SetJumpTarget(no_tier_up);
+  }
+
   if (code_block.m_gqr_used.Count() == 1 &&
       js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
   {
@@ -223,8 +223,9 @@ void JitArm64::bcx(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITBranchOff);
 
+  const bool profile_branch = IsProfiledBranch(inst);
   ARM64Reg WA = gpr.GetReg();
-  ARM64Reg WB = inst.LK || IsDebuggingEnabled() ? gpr.GetReg() : WA;
+  ARM64Reg WB = inst.LK || IsDebuggingEnabled() || profile_branch ? gpr.GetReg() : WA;
   ARM64Reg WC = IsDebuggingEnabled() && inst.LK && !js.op->branchIsIdleLoop ? gpr.GetReg() :
                                                                               ARM64Reg::INVALID_REG;
 
@@ -249,6 +250,30 @@ void JitArm64::bcx(UGeckoInstruction inst)
         JumpIfCRFieldBit(inst.BI >> 2, 3 - (inst.BI & 3), !(inst.BO_2 & BO_BRANCH_IF_TRUE));
   }
 
+  if (js.op->branchFollowed)
+  {
+    // The analyzer continued at the target of this branch because it is almost always taken, so
+    // the taken path stays inline and the rarely used fall through path becomes a side exit.
+    FixupBranch taken = B();
+    if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
+      SetJumpTarget(pConditionDontBranch);
+    if ((inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+      SetJumpTarget(pCTRDontBranch);
+
+    gpr.Flush(FlushMode::MaintainState, WA);
+    fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
+    WriteExit(js.compilerPC + 4);
+
+    SetJumpTarget(taken);
+
+    gpr.Unlock(WA);
+    if (WB != WA)
+      gpr.Unlock(WB);
+    if (WC != ARM64Reg::INVALID_REG)
+      gpr.Unlock(WC);
+    return;
+  }
+
   if (inst.LK)
   {
     MOVI2R(WA, js.compilerPC + 4);
@@ -258,6 +283,14 @@ void JitArm64::bcx(UGeckoInstruction inst)
   gpr.Flush(FlushMode::MaintainState, WB);
   fpr.Flush(FlushMode::MaintainState, ARM64Reg::INVALID_REG);
 
+  if (profile_branch)
+  {
+    MOVP2R(EncodeRegTo64(WA), GetBranchTakenCounter(js.compilerPC));
+    LDR(IndexType::Unsigned, WB, EncodeRegTo64(WA), 0);
+    ADD(WB, WB, 1);
+    STR(IndexType::Unsigned, WB, EncodeRegTo64(WA), 0);
+  }
+
   if (IsDebuggingEnabled())
   {
     ARM64Reg bw_reg_a, bw_reg_b;
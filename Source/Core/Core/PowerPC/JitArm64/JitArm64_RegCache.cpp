@@ -227,12 +227,32 @@ void Arm64GPRCache::FlushRegister(size_t index, FlushMode mode, ARM64Reg tmp_reg
         }
 
         const ARM64Reg encoded_tmp_reg = bitsize != 64 ? tmp_reg : EncodeRegTo64(tmp_reg);
+        const u64 imm = reg.GetImm();
 
-        m_emit->MOVI2R(encoded_tmp_reg, reg.GetImm());
+        if (!m_flushed_imm || m_flushed_imm->reg != encoded_tmp_reg)
+        {
+          m_emit->MOVI2R(encoded_tmp_reg, imm);
+        }
+        else if (m_flushed_imm->value != imm)
+        {
+          // A constant that needs both halves of a MOVZ/MOVK pair can instead be derived from
+          // the previous one if they are close.
+          const u64 previous = m_flushed_imm->value;
+          const u64 upper = imm >> 16;
+          const bool is_multi_part = (imm & 0xFFFF) != 0 && upper != 0 && upper != 0xFFFF;
+          if (is_multi_part && imm > previous && imm - previous < 0x1000)
+            m_emit->ADD(encoded_tmp_reg, encoded_tmp_reg, u32(imm - previous));
+          else if (is_multi_part && imm < previous && previous - imm < 0x1000)
+            m_emit->SUB(encoded_tmp_reg, encoded_tmp_reg, u32(previous - imm));
+          else
+            m_emit->MOVI2R(encoded_tmp_reg, imm);
+        }
         m_emit->STR(IndexType::Unsigned, encoded_tmp_reg, PPC_REG, u32(guest_reg.ppc_offset));
 
         if (allocated_tmp_reg)
           UnlockRegister(tmp_reg);
+        else
+          m_flushed_imm = FlushedImmediate{encoded_tmp_reg, imm};
       }
     }
 
@@ -243,6 +263,8 @@ void Arm64GPRCache::FlushRegister(size_t index, FlushMode mode, ARM64Reg tmp_reg
 
 void Arm64GPRCache::FlushRegisters(BitSet32 regs, FlushMode mode, ARM64Reg tmp_reg)
 {
+  m_flushed_imm.reset();
+
   for (auto iter = regs.begin(); iter != regs.end(); ++iter)
   {
     const int i = *iter;
@@ -282,6 +304,8 @@ void Arm64GPRCache::FlushRegisters(BitSet32 regs, FlushMode mode, ARM64Reg tmp_r
 
 void Arm64GPRCache::FlushCRRegisters(BitSet8 regs, FlushMode mode, ARM64Reg tmp_reg)
 {
+  m_flushed_imm.reset();
+
   for (int i : regs)
   {
     ASSERT_MSG(DYNA_REC, m_guest_registers[GUEST_CR_OFFSET + i].GetType() != RegType::Discarded,
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <vector>
 
@@ -371,6 +372,15 @@ private:
 
   void FlushRegisters(BitSet32 regs, FlushMode mode, Arm64Gen::ARM64Reg tmp_reg);
   void FlushCRRegisters(BitSet8 regs, FlushMode mode, Arm64Gen::ARM64Reg tmp_reg);
+
+  // The immediate that the current flush left in the caller's temporary register. Flushing several
+  // registers that hold the same or nearby constants then doesn't rematerialize it every time.
+  struct FlushedImmediate
+  {
+    Arm64Gen::ARM64Reg reg;
+    u64 value;
+  };
+  std::optional<FlushedImmediate> m_flushed_imm;
 };
 
 class Arm64FPRCache : public Arm64RegCache
@@ -185,9 +185,15 @@ void JitArm64::GenerateAsm()
   // If jitting triggered an ISI exception, MSR.DR may have changed
   EmitUpdateMembase();
 
+  // If the block was interpreted instead of compiled, it may have used up the downcount
+  LDR(IndexType::Unsigned, ARM64Reg::W8, PPC_REG, PPCSTATE_OFF(downcount));
+  CMP(ARM64Reg::W8, 0);
+  FixupBranch interpreted_out_of_cycles = B(CC_LE);
+
   B(dispatcher_no_check);
 
   SetJumpTarget(bail);
+  SetJumpTarget(interpreted_out_of_cycles);
   do_timing = GetCodePtr();
   // Write the current PC out to PPCSTATE
   static_assert(PPCSTATE_OFF(pc) <= 252);
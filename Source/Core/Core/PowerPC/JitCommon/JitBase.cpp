@@ -19,6 +19,8 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
 #include "Core/MemTools.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
@@ -57,7 +59,7 @@
 // After resetting the stack to the top, we call _resetstkoflw() to restore
 // the guard page at the 256kb mark.
 
-const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitBase::JIT_SETTINGS{{
+const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 27> JitBase::JIT_SETTINGS{{
     {&JitBase::bJITOff, &Config::MAIN_DEBUG_JIT_OFF},
     {&JitBase::bJITLoadStoreOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_OFF},
     {&JitBase::bJITLoadStorelXzOff, &Config::MAIN_DEBUG_JIT_LOAD_STORE_LXZ_OFF},
@@ -74,13 +76,17 @@ const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JitB
     {&JitBase::m_enable_profiling, &Config::MAIN_DEBUG_JIT_ENABLE_PROFILING},
     {&JitBase::m_enable_debugging, &Config::MAIN_ENABLE_DEBUGGING},
     {&JitBase::m_enable_branch_following, &Config::MAIN_JIT_FOLLOW_BRANCH},
+    {&JitBase::m_enable_tiered_compilation, &Config::MAIN_JIT_TIERED_COMPILATION},
+    {&JitBase::m_enable_deferred_compilation, &Config::MAIN_JIT_DEFERRED_COMPILATION},
     {&JitBase::m_enable_float_exceptions, &Config::MAIN_FLOAT_EXCEPTIONS},
     {&JitBase::m_enable_div_by_zero_exceptions, &Config::MAIN_DIVIDE_BY_ZERO_EXCEPTIONS},
     {&JitBase::m_low_dcbz_hack, &Config::MAIN_LOW_DCBZ_HACK},
     {&JitBase::m_fprf, &Config::MAIN_FPRF},
     {&JitBase::m_accurate_nans, &Config::MAIN_ACCURATE_NANS},
+    {&JitBase::m_fast_paired_singles, &Config::MAIN_FAST_PAIRED_SINGLES},
     {&JitBase::m_fastmem_enabled, &Config::MAIN_FASTMEM},
     {&JitBase::m_accurate_cpu_cache_enabled, &Config::MAIN_ACCURATE_CPU_CACHE},
+    {&JitBase::m_write_protect_code, &Config::MAIN_JIT_WRITE_PROTECT_CODE},
 }};
 
 const u8* JitBase::Dispatch(JitBase& jit)
@@ -90,7 +96,8 @@ const u8* JitBase::Dispatch(JitBase& jit)
 
 void JitTrampoline(JitBase& jit, u32 em_address)
 {
-  jit.Jit(em_address);
+  jit.JitOrInterpret(em_address);
+  jit.PrecompileFromDiskCache(em_address);
 }
 
 JitBase::JitBase(Core::System& system)
@@ -110,6 +117,66 @@ JitBase::~JitBase()
   CPUThreadConfigCallback::RemoveConfigChangedCallback(m_registered_config_callback_id);
 }
 
+void JitBase::JitOrInterpret(u32 em_address)
+{
+  if (!m_enable_deferred_compilation || m_enable_debugging)
+  {
+    Jit(em_address);
+    return;
+  }
+
+  const CompileClock::time_point now = CompileClock::now();
+  m_compile_budget = std::min(m_compile_budget +
+                                  (now - m_compile_budget_refill_time) / COMPILE_BUDGET_SHARE,
+                              MAX_COMPILE_BUDGET);
+  m_compile_budget_refill_time = now;
+
+  if (m_compile_budget <= CompileClock::duration::zero())
+  {
+    // Large code loads would otherwise cause a long stall here. Run the block through the
+    // interpreter for now; it gets compiled on a later visit once the budget has recovered.
+    // The dispatcher checks the downcount when we return, so we don't have to handle timing.
+    m_ppc_state.downcount -= m_system.GetInterpreter().RunBlock();
+    m_system.GetJitInterface().UpdateMembase();
+    return;
+  }
+
+  Jit(em_address);
+  m_compile_budget -= CompileClock::now() - now;
+}
+
+void JitBase::PrecompileFromDiskCache(u32 em_address)
+{
+  JitBaseBlockCache* block_cache = GetBlockCache();
+  JitDiskCache& disk_cache = block_cache->GetDiskCache();
+  if (!disk_cache.IsOpen() || m_enable_debugging || SConfig::GetInstance().bJITNoBlockCache)
+    return;
+
+  const auto translated = m_mmu.JitCache_TranslateAddress(em_address);
+  if (!translated.valid)
+    return;
+
+  const CPUEmuFeatureFlags feature_flags = m_ppc_state.feature_flags;
+  for (const JitDiskCache::Key& key :
+       disk_cache.TakeBlocksToPrecompile(translated.address, feature_flags))
+  {
+    const auto block_translated = m_mmu.JitCache_TranslateAddress(key.effective_address);
+    if (!block_translated.valid || block_translated.address != key.physical_address)
+      continue;
+
+    if (block_cache->GetBlockFromStartAddress(key.effective_address, feature_flags))
+      continue;
+
+    // Jit() raises an ISI if any instruction of the block can't be translated, which must not
+    // happen for a block the guest hasn't actually branched to. Check this up front.
+    analyzer.Analyze(key.effective_address, &code_block, &m_code_buffer, m_code_buffer.size());
+    if (code_block.m_memory_exception)
+      continue;
+
+    Jit(key.effective_address);
+  }
+}
+
 bool JitBase::DoesConfigNeedRefresh()
 {
   return std::any_of(JIT_SETTINGS.begin(), JIT_SETTINGS.end(), [this](const auto& pair) {
@@ -260,6 +327,20 @@ void JitBase::CleanUpAfterStackFault()
   }
 }
 
+bool JitBase::IsColdTierBlock(u32 em_address) const
+{
+  // Debugging relies on predictable block boundaries, so tiering is disabled there.
+  return m_enable_tiered_compilation && !m_enable_debugging &&
+         js.tierUpAddresses.find(em_address) == js.tierUpAddresses.end();
+}
+
+bool JitBase::IsProfiledBranch(UGeckoInstruction inst) const
+{
+  const bool conditional =
+      (inst.BO & BO_DONT_DECREMENT_FLAG) == 0 || (inst.BO & BO_DONT_CHECK_CONDITION) == 0;
+  return conditional && !inst.LK && IsColdTierBlock(js.blockStart);
+}
+
 bool JitBase::CanMergeNextInstructions(int count) const
 {
   if (m_system.GetCPU().IsStepping() || js.instructionsLeft < count)
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -76,6 +78,19 @@ protected:
   static constexpr size_t GUARD_SIZE = 64 * 1024;
   static constexpr size_t GUARD_OFFSET = SAFE_STACK_SIZE - GUARD_SIZE;
 
+  // With tiered compilation, the number of times a quickly compiled block has to run before it
+  // gets recompiled with all analysis optimizations.
+  static constexpr u32 TIER_UP_RUN_COUNT = 64;
+  // How many of those runs a conditional branch has to be taken in for the recompiled block to
+  // continue at its target, turning the fall through path into a side exit.
+  static constexpr u32 HOT_BRANCH_TAKEN_COUNT = TIER_UP_RUN_COUNT * 7 / 8;
+
+  // With deferred compilation, the JIT may spend at most 1/COMPILE_BUDGET_SHARE of host time
+  // compiling, averaged over a window of up to MAX_COMPILE_BUDGET of compile time.
+  using CompileClock = std::chrono::steady_clock;
+  static constexpr int COMPILE_BUDGET_SHARE = 4;
+  static constexpr CompileClock::duration MAX_COMPILE_BUDGET = std::chrono::milliseconds(8);
+
   struct JitOptions
   {
     bool enableBlocklink;
@@ -95,6 +110,7 @@ protected:
     u32 downcountAmount;
     u32 numLoadStoreInst;
     u32 numFloatingPointInst;
+    u32 numRegisterSpills;
     // If this is set, we need to generate an exception handler for the fastmem load.
     u8* fastmemLoadStore;
     // If this is set, a load or store already prepared a jump to the exception handler for us,
@@ -121,12 +137,18 @@ protected:
     PPCAnalyst::BlockRegStats fpa;
     PPCAnalyst::CodeOp* op;
     BitSet32 fpr_is_store_safe;
+    // How many bytes on either side of r1 are known to be RAM, as checked at the start of the
+    // block. 0 if nothing is known about r1.
+    u32 stackPointerMargin;
 
     JitBlock* curBlock;
 
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> tierUpAddresses;
+    // Counters incremented by cold tier blocks whenever a conditional branch is taken.
+    std::unordered_map<u32, u32> branchTakenCounts;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -150,19 +172,26 @@ protected:
   bool m_enable_profiling = false;
   bool m_enable_debugging = false;
   bool m_enable_branch_following = false;
+  bool m_enable_tiered_compilation = false;
+  bool m_enable_deferred_compilation = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
   bool m_low_dcbz_hack = false;
   bool m_fprf = false;
   bool m_accurate_nans = false;
+  bool m_fast_paired_singles = false;
   bool m_fastmem_enabled = false;
   bool m_accurate_cpu_cache_enabled = false;
+  bool m_write_protect_code = false;
 
   bool m_enable_blr_optimization = false;
   bool m_cleanup_after_stackfault = false;
+
+  CompileClock::duration m_compile_budget = MAX_COMPILE_BUDGET;
+  CompileClock::time_point m_compile_budget_refill_time{};
   u8* m_stack_guard = nullptr;
 
-  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 23> JIT_SETTINGS;
+  static const std::array<std::pair<bool JitBase::*, const Config::Info<bool>*>, 27> JIT_SETTINGS;
 
   bool DoesConfigNeedRefresh();
   void RefreshConfig();
@@ -176,6 +205,13 @@ protected:
 
   bool CanMergeNextInstructions(int count) const;
 
+  // Whether the block at the given address should be compiled by the quick first tier of
+  // tiered compilation, including a counter which triggers its recompilation once it gets hot.
+  bool IsColdTierBlock(u32 em_address) const;
+  // Whether the current block should count how often the given conditional branch is taken.
+  bool IsProfiledBranch(UGeckoInstruction inst) const;
+  u32* GetBranchTakenCounter(u32 address) { return &js.branchTakenCounts[address]; }
+
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
 
 public:
@@ -188,12 +224,21 @@ public:
 
   bool IsProfilingEnabled() const { return m_enable_profiling; }
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
+  bool IsCodeWriteProtectionEnabled() const { return m_write_protect_code; }
 
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
 
+  // Compiles the block at em_address, unless deferred compilation is enabled and the compile
+  // budget is used up, in which case the block is run through the interpreter instead.
+  void JitOrInterpret(u32 em_address);
+
+  // Compiles the blocks remembered by the persistent block cache which are located near
+  // em_address, so that they don't have to be compiled one at a time once they are reached.
+  void PrecompileFromDiskCache(u32 em_address);
+
   virtual const CommonAsmRoutinesBase* GetAsmRoutines() = 0;
 
   virtual bool HandleFault(uintptr_t access_address, SContext* ctx) = 0;
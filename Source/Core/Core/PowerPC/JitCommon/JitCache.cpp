@@ -8,17 +8,20 @@
 #include <cstring>
 #include <functional>
 #include <map>
-#include <set>
+#include <optional>
 #include <utility>
 
 #include "Common/CommonTypes.h"
 #include "Common/JitRegister.h"
+#include "Common/Logging/Log.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
 #include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -28,8 +31,29 @@ using namespace Gen;
 
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  return physical_addresses.Overlaps(address, address + length);
+}
+
+ValidBlockBitSet::ValidBlockBitSet()
+{
+  m_valid_block =
+      static_cast<u32*>(m_region.Create(sizeof(u32) * std::size_t(VALID_BLOCK_ALLOC_ELEMENTS)));
+  if (!m_valid_block)
+  {
+    m_fallback.reset(new u32[VALID_BLOCK_ALLOC_ELEMENTS]);
+    m_valid_block = m_fallback.get();
+    ClearAll();
+  }
+}
+
+ValidBlockBitSet::~ValidBlockBitSet() = default;
+
+void ValidBlockBitSet::ClearAll()
+{
+  if (m_fallback)
+    std::memset(m_valid_block, 0, sizeof(u32) * std::size_t(VALID_BLOCK_ALLOC_ELEMENTS));
+  else
+    m_region.Clear();
 }
 
 void JitBlock::ProfileData::BeginProfiling(ProfileData* data)
@@ -44,7 +68,8 @@ void JitBlock::ProfileData::EndProfiling(ProfileData* data, u32 downcount_amount
   data->time_spent += Clock::now() - data->time_start;
 }
 
-JitBaseBlockCache::JitBaseBlockCache(JitBase& jit) : m_jit{jit}
+JitBaseBlockCache::JitBaseBlockCache(JitBase& jit)
+    : m_jit{jit}, m_disk_cache{jit.m_system.GetMemory()}
 {
 }
 
@@ -52,7 +77,8 @@ JitBaseBlockCache::~JitBaseBlockCache() = default;
 
 void JitBaseBlockCache::Init()
 {
-  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR));
+  Common::JitRegister::Init(Config::Get(Config::MAIN_PERF_MAP_DIR),
+                            Config::Get(Config::MAIN_PERF_JIT_DUMP));
 
   m_entry_points_ptr = nullptr;
 #ifdef _ARCH_64
@@ -60,6 +86,9 @@ void JitBaseBlockCache::Init()
     m_entry_points_ptr = reinterpret_cast<u8**>(m_entry_points_arena.Create(FAST_BLOCK_MAP_SIZE));
 #endif
 
+  if (Config::Get(Config::MAIN_JIT_PERSISTENT_BLOCK_CACHE))
+    m_disk_cache.Open(SConfig::GetInstance().GetGameID());
+
   Clear();
 }
 
@@ -67,6 +96,7 @@ void JitBaseBlockCache::Shutdown()
 {
   Common::JitRegister::Shutdown();
 
+  m_disk_cache.Close();
   m_entry_points_arena.Release();
 }
 
@@ -80,6 +110,8 @@ void JitBaseBlockCache::Clear()
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
   m_jit.js.noSpeculativeConstantsAddresses.clear();
+  m_jit.js.tierUpAddresses.clear();
+  m_jit.js.branchTakenCounts.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -90,6 +122,9 @@ void JitBaseBlockCache::Clear()
 
   valid_block.ClearAll();
 
+  m_jit.m_system.GetMemory().UnprotectAllFastmemPages();
+  m_code_page_write_faults.clear();
+
   if (m_entry_points_ptr)
     m_entry_points_arena.Clear();
 }
@@ -130,7 +165,7 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 }
 
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
-                                      const std::set<u32>& physical_addresses)
+                                      const Common::FlatRangeSet<u32>& physical_addresses)
 {
   size_t index = FastLookupIndexForAddress(block.effectiveAddress, block.feature_flags);
   if (m_entry_points_ptr)
@@ -147,10 +182,12 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   block.physical_addresses = physical_addresses;
 
   u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
-  for (u32 addr : physical_addresses)
+  for (const auto& range : physical_addresses)
   {
-    valid_block.Set(addr / 32);
-    block_range_map[addr & range_mask].insert(&block);
+    for (u32 line = range.start / 32; line <= (range.end - 1) / 32; ++line)
+      valid_block.Set(line);
+    for (u32 macro = range.start & range_mask; macro < range.end; macro += BLOCK_RANGE_MAP_ELEMENTS)
+      block_range_map[macro].insert(&block);
   }
 
   if (block_link)
@@ -163,6 +200,11 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
     LinkBlock(block);
   }
 
+  m_disk_cache.RecordBlock(block, physical_addresses);
+
+  if (m_jit.IsCodeWriteProtectionEnabled() && m_jit.jo.fastmem_arena)
+    WriteProtectCodePages(physical_addresses);
+
   Common::Symbol* symbol = nullptr;
   if (Common::JitRegister::IsEnabled() &&
       (symbol = m_jit.m_ppc_symbol_db.GetSymbolFromAddr(block.effectiveAddress)) != nullptr)
@@ -316,11 +358,49 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
         m_jit.js.noSpeculativeConstantsAddresses.erase(i);
+        m_jit.js.tierUpAddresses.erase(i);
       }
     }
   }
 }
 
+void JitBaseBlockCache::WriteProtectCodePages(const Common::FlatRangeSet<u32>& physical_addresses)
+{
+  constexpr u32 page_size = Memory::MemoryManager::FASTMEM_PROTECTION_PAGE_SIZE;
+  auto& memory = m_jit.m_system.GetMemory();
+  for (const auto& range : physical_addresses)
+  {
+    for (u32 page = range.start & ~(page_size - 1); page < range.end; page += page_size)
+    {
+      const auto it = m_code_page_write_faults.find(page);
+      if (it == m_code_page_write_faults.end() || it->second < MAX_CODE_PAGE_WRITE_FAULTS)
+        memory.WriteProtectFastmemPage(page);
+    }
+  }
+}
+
+bool JitBaseBlockCache::HandleCodePageWriteFault(uintptr_t access_address)
+{
+  auto& memory = m_jit.m_system.GetMemory();
+  const std::optional<u32> page =
+      memory.GetWriteProtectedFastmemPage(reinterpret_cast<const u8*>(access_address));
+  if (!page)
+    return false;
+
+  // Only the page is known, not how much of it the guest is about to write, so every block compiled
+  // from it goes. Blocks compiled from it afterwards will protect it again. The effective
+  // addresses of the code aren't known here, so the per-address JIT hints are left alone, like for
+  // a forced invalidation.
+  constexpr u32 page_size = Memory::MemoryManager::FASTMEM_PROTECTION_PAGE_SIZE;
+  memory.UnprotectFastmemPage(*page);
+  ++m_code_page_write_faults[*page];
+  InvalidateICacheInternal(*page, *page, page_size, true);
+
+  DEBUG_LOG_FMT(DYNA_REC, "Write to compiled code in page {:08x} (fault {})", *page,
+                m_code_page_write_faults[*page]);
+  return true;
+}
+
 void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 {
   // Iterate over all macro blocks which overlap the given range.
@@ -338,9 +418,15 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
       {
         // If the block overlaps, also remove all other occupied slots in the other macro blocks.
         // This will leak empty macro blocks, but they may be reused or cleared later on.
-        for (u32 addr : block->physical_addresses)
-          if ((addr & range_mask) != start->first)
-            block_range_map[addr & range_mask].erase(block);
+        for (const auto& range : block->physical_addresses)
+        {
+          for (u32 macro = range.start & range_mask; macro < range.end;
+               macro += BLOCK_RANGE_MAP_ELEMENTS)
+          {
+            if (macro != start->first)
+              block_range_map[macro].erase(block);
+          }
+        }
 
         // And remove the block.
         DestroyBlock(*block);
@@ -372,7 +458,7 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
-  return valid_block.m_valid_block.get();
+  return valid_block.m_valid_block;
 }
 
 void JitBaseBlockCache::WriteDestroyBlock(const JitBlock& block)
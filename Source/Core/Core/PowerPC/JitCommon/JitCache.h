@@ -17,8 +17,11 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FlatRangeSet.h"
+#include "Common/MemArena.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
 
 class JitBase;
 
@@ -81,6 +84,10 @@ struct JitBlock : public JitBlockData
     Clock::time_point time_start;
   };
 
+  // With tiered compilation, the number of runs left before this block gets recompiled.
+  // Decremented directly by the JIT'ed code of the block.
+  u32 tier_up_countdown = 0;
+
   explicit JitBlock(bool profiling_enabled)
       : profile_data(profiling_enabled ? std::make_unique<ProfileData>() : nullptr)
   {
@@ -102,42 +109,59 @@ struct JitBlock : public JitBlockData
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // The physical memory occupied by the instructions of this block. Blocks are made of a few
+  // contiguous runs of instructions, so this is stored as ranges rather than one entry per address.
+  Common::FlatRangeSet<u32> physical_addresses;
 
   std::unique_ptr<ProfileData> profile_data;
 };
 
 typedef void (*CompiledCode)();
 
-// This is essentially just an std::bitset, but Visual Studia 2013's
-// implementation of std::bitset is slow.
+// A bitset with one bit per 32-byte chunk of the 32-bit address space.
+//
+// Only a few small parts of that space contain RAM, so the bitset is backed by a lazily committed
+// memory region: host pages only get committed once a bit in them is set, and reading the rest
+// just yields zeroes. This keeps the lookup used by the JITs a single flat load while only costing
+// memory for the pages which back code.
 class ValidBlockBitSet final
 {
 public:
   enum
   {
-    // ValidBlockBitSet covers the whole 32-bit address-space in 32-byte
-    // chunks.
-    // FIXME: Maybe we can get away with less? There isn't any actual
-    // RAM in most of this space.
     VALID_BLOCK_MASK_SIZE = (1ULL << 32) / 32,
     // The number of elements in the allocated array. Each u32 contains 32 bits.
     VALID_BLOCK_ALLOC_ELEMENTS = VALID_BLOCK_MASK_SIZE / 32
   };
   // Directly accessed by Jit64.
-  std::unique_ptr<u32[]> m_valid_block;
+  u32* m_valid_block = nullptr;
+
+  ValidBlockBitSet();
+  ValidBlockBitSet(const ValidBlockBitSet&) = delete;
+  ValidBlockBitSet(ValidBlockBitSet&&) = delete;
+  ValidBlockBitSet& operator=(const ValidBlockBitSet&) = delete;
+  ValidBlockBitSet& operator=(ValidBlockBitSet&&) = delete;
+  ~ValidBlockBitSet();
 
-  ValidBlockBitSet()
+  void Set(u32 bit)
   {
-    m_valid_block.reset(new u32[VALID_BLOCK_ALLOC_ELEMENTS]);
-    ClearAll();
+    if (!m_fallback)
+      m_region.EnsureMemoryPageWritable((bit / 32) * sizeof(u32));
+    m_valid_block[bit / 32] |= 1u << (bit % 32);
   }
-
-  void Set(u32 bit) { m_valid_block[bit / 32] |= 1u << (bit % 32); }
-  void Clear(u32 bit) { m_valid_block[bit / 32] &= ~(1u << (bit % 32)); }
-  void ClearAll() { memset(m_valid_block.get(), 0, sizeof(u32) * VALID_BLOCK_ALLOC_ELEMENTS); }
+  void Clear(u32 bit)
+  {
+    // Don't write to (and thereby commit) memory which has never been set.
+    if (Test(bit))
+      m_valid_block[bit / 32] &= ~(1u << (bit % 32));
+  }
+  void ClearAll();
   bool Test(u32 bit) const { return (m_valid_block[bit / 32] & (1u << (bit % 32))) != 0; }
+
+private:
+  Common::LazyMemoryRegion m_region;
+  // Used if the lazy region couldn't be reserved.
+  std::unique_ptr<u32[]> m_fallback;
 };
 
 class JitBaseBlockCache
@@ -163,7 +187,8 @@ public:
   void RunOnBlocks(const Core::CPUThreadGuard& guard, std::function<void(const JitBlock&)> f) const;
 
   JitBlock* AllocateBlock(u32 em_address);
-  void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  void FinalizeBlock(JitBlock& block, bool block_link,
+                     const Common::FlatRangeSet<u32>& physical_addresses);
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -180,8 +205,15 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
 
+  // Called for faults on the fastmem arena. If the fault is a write to a page which was write
+  // protected because it contains compiled code, destroys the blocks compiled from that page, lets
+  // the write through and returns true.
+  bool HandleCodePageWriteFault(uintptr_t access_address);
+
   u32* GetBlockBitSet() const;
 
+  JitDiskCache& GetDiskCache() { return m_disk_cache; }
+
 protected:
   virtual void DestroyBlock(JitBlock& block);
 
@@ -195,6 +227,7 @@ private:
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
+  void WriteProtectCodePages(const Common::FlatRangeSet<u32>& physical_addresses);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, CPUEmuFeatureFlags feature_flags);
 
@@ -229,4 +262,12 @@ private:
   // in case the shm memory region couldn't be allocated.
   std::array<JitBlock*, FAST_BLOCK_MAP_FALLBACK_ELEMENTS>
       m_fast_block_map_fallback{};  // start_addr & mask -> number
+
+  // Descriptions of the blocks compiled in previous sessions of the running title.
+  JitDiskCache m_disk_cache;
+
+  // Pages which keep getting written to (e.g. because they mix code and data) stop being write
+  // protected after this many faults, and rely on the guest invalidating the icache instead.
+  static constexpr u32 MAX_CODE_PAGE_WRITE_FAULTS = 8;
+  std::map<u32, u32> m_code_page_write_faults;  // physical page -> number of faults
 };
@@ -0,0 +1,180 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/PowerPC/JitCommon/JitDiskCache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/Logging/Log.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/JitCommon/JitCache.h"
+
+namespace
+{
+constexpr u32 PAGE_SHIFT = 12;
+
+// Entries whose guest code doesn't match memory are retried a few times (the code may simply not
+// have been loaded yet), but eventually dropped so that misses in the page stay cheap.
+constexpr u32 MAX_FAILED_VALIDATIONS = 4;
+}  // namespace
+
+class JitDiskCache::Reader final : public Common::LinearDiskCacheReader<Key, u32>
+{
+public:
+  explicit Reader(JitDiskCache& cache) : m_cache(cache) {}
+
+  void Read(const Key& key, const u32* value, u32 value_size) override
+  {
+    if (value_size == 0 || !m_cache.m_known_blocks.insert(key).second)
+      return;
+
+    PendingBlock block{key, std::vector<u32>(value, value + value_size)};
+    m_cache.m_pending_blocks[key.physical_address >> PAGE_SHIFT].push_back(std::move(block));
+  }
+
+private:
+  JitDiskCache& m_cache;
+};
+
+std::size_t JitDiskCache::KeyHash::operator()(const Key& key) const
+{
+  return static_cast<std::size_t>(key.physical_address) ^
+         (static_cast<std::size_t>(key.guest_hash) << 1) ^
+         (static_cast<std::size_t>(key.effective_address) << 3) ^ key.feature_flags;
+}
+
+JitDiskCache::JitDiskCache(Memory::MemoryManager& memory) : m_memory(memory)
+{
+}
+
+JitDiskCache::~JitDiskCache()
+{
+  Close();
+}
+
+void JitDiskCache::Open(const std::string& game_id)
+{
+  Close();
+
+  if (game_id.empty())
+    return;
+
+  const std::string& cache_dir = File::GetUserPath(D_CACHE_IDX);
+  if (!File::Exists(cache_dir))
+    File::CreateDir(cache_dir);
+
+  const std::string filename = cache_dir + game_id + ".jitcache";
+  Reader reader(*this);
+  const u32 count = m_file.OpenAndRead(filename, reader);
+  INFO_LOG_FMT(DYNA_REC, "Loaded {} cached JIT block descriptions from {}", count, filename);
+  m_is_open = true;
+}
+
+void JitDiskCache::Close()
+{
+  if (!m_is_open)
+    return;
+
+  m_file.Sync();
+  m_file.Close();
+  m_known_blocks.clear();
+  m_pending_blocks.clear();
+  m_is_open = false;
+  m_initial_sweep_done = false;
+}
+
+std::optional<u32> JitDiskCache::HashGuestCode(const std::vector<u32>& physical_addresses) const
+{
+  u32 crc = Common::StartCRC32();
+  for (const u32 address : physical_addresses)
+  {
+    // Only code in MEM1 and MEM2 is cached. Anything else (e.g. the locked L1 cache) is too
+    // volatile to be worth remembering.
+    const u32 segment = address >> 28;
+    const u32 offset = address & 0x0FFFFFFF;
+    const bool in_ram =
+        (segment == 0x0 && m_memory.GetRAM() && offset + 4 <= m_memory.GetRamSizeReal()) ||
+        (segment == 0x1 && m_memory.GetEXRAM() && offset + 4 <= m_memory.GetExRamSizeReal());
+    if (!in_ram)
+      return std::nullopt;
+
+    const u32 instruction = m_memory.Read_U32(address);
+    crc = Common::UpdateCRC32(crc, reinterpret_cast<const u8*>(&instruction), sizeof(instruction));
+  }
+  return crc;
+}
+
+void JitDiskCache::RecordBlock(const JitBlock& block,
+                               const Common::FlatRangeSet<u32>& physical_addresses)
+{
+  if (!m_is_open || physical_addresses.Empty())
+    return;
+
+  std::vector<u32> addresses;
+  for (const auto& range : physical_addresses)
+  {
+    for (u32 address = range.start; address < range.end; address += 4)
+      addresses.push_back(address);
+  }
+  const std::optional<u32> hash = HashGuestCode(addresses);
+  if (!hash)
+    return;
+
+  const Key key{block.effectiveAddress, block.physicalAddress, block.feature_flags, *hash};
+  if (!m_known_blocks.insert(key).second)
+    return;
+
+  m_file.Append(key, addresses.data(), static_cast<u32>(addresses.size()));
+}
+
+bool JitDiskCache::TakePendingBlock(PendingBlock& block, CPUEmuFeatureFlags feature_flags,
+                                    std::vector<Key>& result) const
+{
+  // Blocks compiled for other feature flags stay pending until the CPU is in that mode.
+  if (block.key.feature_flags != feature_flags)
+    return false;
+
+  if (HashGuestCode(block.physical_addresses) == block.key.guest_hash)
+  {
+    result.push_back(block.key);
+    return true;
+  }
+
+  return ++block.failed_validations >= MAX_FAILED_VALIDATIONS;
+}
+
+std::vector<JitDiskCache::Key>
+JitDiskCache::TakeBlocksToPrecompile(u32 physical_address, CPUEmuFeatureFlags feature_flags)
+{
+  std::vector<Key> result;
+  if (m_pending_blocks.empty())
+    return result;
+
+  const auto process_page = [&](std::vector<PendingBlock>& blocks) {
+    std::erase_if(blocks, [&](PendingBlock& block) {
+      return TakePendingBlock(block, feature_flags, result);
+    });
+  };
+
+  if (!m_initial_sweep_done)
+  {
+    m_initial_sweep_done = true;
+    for (auto& [page, blocks] : m_pending_blocks)
+      process_page(blocks);
+    std::erase_if(m_pending_blocks, [](const auto& entry) { return entry.second.empty(); });
+    return result;
+  }
+
+  const auto it = m_pending_blocks.find(physical_address >> PAGE_SHIFT);
+  if (it == m_pending_blocks.end())
+    return result;
+
+  process_page(it->second);
+  if (it->second.empty())
+    m_pending_blocks.erase(it);
+  return result;
+}
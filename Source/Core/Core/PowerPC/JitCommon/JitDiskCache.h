@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatRangeSet.h"
+#include "Common/LinearDiskCache.h"
+#include "Core/PowerPC/Gekko.h"
+
+namespace Memory
+{
+class MemoryManager;
+}
+
+struct JitBlock;
+
+// Remembers which guest blocks were compiled for a title, so that the next boot of the same title
+// can compile them before they are first executed instead of stuttering on them one by one.
+//
+// Host code isn't stored: emitted code references host addresses (asm routines, emulator state)
+// which aren't stable between runs. Instead, each entry describes a guest block precisely enough
+// to check that the guest code in memory is still the code the block was compiled from.
+class JitDiskCache
+{
+public:
+  struct Key
+  {
+    u32 effective_address;
+    u32 physical_address;
+    u32 feature_flags;
+    // CRC32 of the guest instructions of the block, in the order of the value array.
+    u32 guest_hash;
+
+    bool operator==(const Key& other) const = default;
+  };
+
+  explicit JitDiskCache(Memory::MemoryManager& memory);
+  JitDiskCache(const JitDiskCache&) = delete;
+  JitDiskCache(JitDiskCache&&) = delete;
+  JitDiskCache& operator=(const JitDiskCache&) = delete;
+  JitDiskCache& operator=(JitDiskCache&&) = delete;
+  ~JitDiskCache();
+
+  void Open(const std::string& game_id);
+  void Close();
+  bool IsOpen() const { return m_is_open; }
+
+  void RecordBlock(const JitBlock& block, const Common::FlatRangeSet<u32>& physical_addresses);
+
+  // Returns the recorded blocks starting in the same 4 KiB page as physical_address whose guest
+  // code is still intact, and stops tracking them. The first call after Open() considers every
+  // page, so that most blocks of the main executable get compiled in one go at boot.
+  std::vector<Key> TakeBlocksToPrecompile(u32 physical_address, CPUEmuFeatureFlags feature_flags);
+
+private:
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  struct PendingBlock
+  {
+    Key key;
+    std::vector<u32> physical_addresses;
+    u32 failed_validations = 0;
+  };
+
+  class Reader;
+
+  std::optional<u32> HashGuestCode(const std::vector<u32>& physical_addresses) const;
+  bool TakePendingBlock(PendingBlock& block, CPUEmuFeatureFlags feature_flags,
+                        std::vector<Key>& result) const;
+
+  Memory::MemoryManager& m_memory;
+  Common::LinearDiskCache<Key, u32> m_file;
+  bool m_is_open = false;
+  bool m_initial_sweep_done = false;
+
+  // Blocks which have been written to (or read from) the file. Used to avoid duplicate entries.
+  std::unordered_set<Key, KeyHash> m_known_blocks;
+
+  // Blocks read from the file which haven't been precompiled yet, grouped by physical page.
+  std::map<u32, std::vector<PendingBlock>> m_pending_blocks;
+};
@@ -83,17 +83,23 @@ CPUCoreBase* JitInterface::GetCore() const
 
 void JitInterface::UpdateMembase()
 {
+  auto& memory = m_system.GetMemory();
   if (!m_jit)
+  {
+    // The interpreter accesses memory through the MMU, which reports all writes.
+    memory.SetWriteWatchAllowed(true);
     return;
+  }
 
   auto& ppc_state = m_system.GetPPCState();
-  auto& memory = m_system.GetMemory();
 #ifdef _M_ARM_64
   // JitArm64 is currently using the no fastmem arena code path even when only fastmem is off.
   const bool fastmem_arena = m_jit->jo.fastmem;
 #else
   const bool fastmem_arena = m_jit->jo.fastmem_arena;
 #endif
+  // Without the fastmem arena, the JIT writes to RAM through views the write watch can't protect.
+  memory.SetWriteWatchAllowed(fastmem_arena);
   if (ppc_state.msr.DR)
   {
     ppc_state.mem_ptr =
@@ -182,6 +188,16 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
   }
 }
 
+std::size_t JitInterface::GetBlockCount(const Core::CPUThreadGuard& guard) const
+{
+  if (!m_jit)
+    return 0;
+
+  std::size_t count = 0;
+  m_jit->GetBlockCache()->RunOnBlocks(guard, [&count](const JitBlock&) { ++count; });
+  return count;
+}
+
 std::variant<JitInterface::GetHostCodeError, JitInterface::GetHostCodeResult>
 JitInterface::GetHostCode(u32 address) const
 {
@@ -232,6 +248,15 @@ bool JitInterface::HandleFault(uintptr_t access_address, SContext* ctx)
     return false;
   }
 
+  // A page can be both write watched and write protected, so give both a chance to handle the
+  // fault before retrying the write.
+  const bool watched = m_system.GetMemory().HandleWriteWatchFault(
+      reinterpret_cast<const u8*>(access_address));
+  if (m_jit->GetBlockCache()->HandleCodePageWriteFault(access_address))
+    return true;
+  if (watched)
+    return true;
+
   return m_jit->HandleFault(access_address, ctx);
 }
 
@@ -313,6 +338,9 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
   case ExceptionType::SpeculativeConstants:
     exception_addresses = &m_jit->js.noSpeculativeConstantsAddresses;
     break;
+  case ExceptionType::TierUp:
+    exception_addresses = &m_jit->js.tierUpAddresses;
+    break;
   }
 
   auto& ppc_state = m_system.GetPPCState();
@@ -333,7 +361,7 @@ void JitInterface::CompileExceptionCheck(ExceptionType type)
     exception_addresses->insert(ppc_state.pc);
 
     // Invalidate the JIT block so that it gets recompiled with the external exception check
-    // included.
+    // included (or, for TierUp, with all optimizations).
     m_jit->GetBlockCache()->InvalidateICache(ppc_state.pc, 4, true);
   }
 }
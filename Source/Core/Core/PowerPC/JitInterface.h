@@ -57,6 +57,7 @@ public:
 
   void UpdateMembase();
   void JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE* file) const;
+  std::size_t GetBlockCount(const Core::CPUThreadGuard& guard) const;
   std::variant<GetHostCodeError, GetHostCodeResult> GetHostCode(u32 address) const;
 
   // Memory Utilities
@@ -82,7 +83,8 @@ public:
   {
     FIFOWrite,
     PairedQuantize,
-    SpeculativeConstants
+    SpeculativeConstants,
+    TierUp
   };
   void CompileExceptionCheck(ExceptionType type);
   static void CompileExceptionCheckFromJIT(JitInterface& jit_interface, ExceptionType type);
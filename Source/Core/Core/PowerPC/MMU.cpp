@@ -25,6 +25,8 @@
 
 #include "Core/PowerPC/MMU.h"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cstddef>
 #include <cstring>
@@ -415,7 +417,10 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
       m_ppc_state.dCache.Write(m_memory, em_address, &swapped_data, size, HID0(m_ppc_state).DLOCK);
 
     if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&m_memory.GetRAM()[em_address], &swapped_data, size);
+      m_memory.NotifyWrite(em_address, size);
+    }
 
     return;
   }
@@ -432,7 +437,10 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     }
 
     if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&m_memory.GetEXRAM()[em_address], &swapped_data, size);
+      m_memory.NotifyWrite(em_address + 0x10000000, size);
+    }
 
     return;
   }
@@ -680,6 +688,54 @@ std::optional<ReadResult<double>> MMU::HostTryReadF64(const Core::CPUThreadGuard
   return ReadResult<double>(result->translated, std::bit_cast<double>(result->value));
 }
 
+std::optional<ReadResult<std::span<const u8>>>
+MMU::HostTryGetRAMPage(const Core::CPUThreadGuard& guard, u32 address, RequestedAddressSpace space)
+{
+  auto& mmu = guard.GetSystem().GetMMU();
+  bool translate;
+  switch (space)
+  {
+  case RequestedAddressSpace::Effective:
+    translate = mmu.m_ppc_state.msr.DR;
+    break;
+  case RequestedAddressSpace::Physical:
+    translate = false;
+    break;
+  case RequestedAddressSpace::Virtual:
+    if (!mmu.m_ppc_state.msr.DR)
+      return std::nullopt;
+    translate = true;
+    break;
+  default:
+    ASSERT(false);
+    return std::nullopt;
+  }
+
+  bool wi = false;
+  if (translate)
+  {
+    const auto translated_address = mmu.TranslateAddress<XCheckTLBFlag::NoException>(address);
+    if (!translated_address.Success())
+      return std::nullopt;
+    address = translated_address.address;
+    wi = translated_address.wi;
+  }
+
+  if (mmu.m_ppc_state.m_enable_dcache && !wi)
+    return std::nullopt;
+
+  // RAM sizes are multiples of the page size, so the rest of the page is always in range.
+  const size_t size = HW_PAGE_SIZE - (address & HW_PAGE_MASK);
+  const u32 offset = address & 0x0FFFFFFF;
+  const u32 segment = address >> 28;
+  if (mmu.m_memory.GetRAM() && segment == 0x0 && offset < mmu.m_memory.GetRamSizeReal())
+    return ReadResult<std::span<const u8>>(translate, {mmu.m_memory.GetRAM() + offset, size});
+  if (mmu.m_memory.GetEXRAM() && segment == 0x1 && offset < mmu.m_memory.GetExRamSizeReal())
+    return ReadResult<std::span<const u8>>(translate, {mmu.m_memory.GetEXRAM() + offset, size});
+
+  return std::nullopt;
+}
+
 void MMU::Write_U8(const u32 var, const u32 address)
 {
   Memcheck(address, var, true, 1);
@@ -920,9 +976,7 @@ std::optional<ReadResult<std::string>> MMU::HostTryReadString(const Core::CPUThr
 
 bool MMU::IsOptimizableRAMAddress(const u32 address, const u32 access_size) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
-    return false;
-
+  // Watched pages have no BAT_PHYSICAL_BIT, so memchecks are handled by the check below.
   if (!m_ppc_state.msr.DR)
     return false;
 
@@ -1089,25 +1143,84 @@ static bool TranslateBatAddress(const BatTable& bat_table, u32* address, bool* w
 }
 
 void MMU::ClearDCacheLine(u32 address)
+{
+  ClearDCacheLines(address, 1);
+}
+
+void MMU::ClearDCacheLines(u32 address, u32 count)
 {
   DEBUG_ASSERT((address & 0x1F) == 0);
-  if (m_ppc_state.msr.DR)
+  while (count != 0)
   {
-    auto translated_address = TranslateAddress<XCheckTLBFlag::Write>(address);
-    if (translated_address.result == TranslateAddressResultEnum::DIRECT_STORE_SEGMENT)
+    // All lines in a page share the same translation, so only translate once per page.
+    const u32 lines_in_page =
+        std::min<u32>(count, static_cast<u32>(HW_PAGE_SIZE - (address & HW_PAGE_MASK)) / 32);
+    const u32 next_address = address + lines_in_page * 32;
+    count -= lines_in_page;
+
+    if (m_ppc_state.msr.DR)
     {
-      // dcbz to direct store segments is ignored. This is a little
-      // unintuitive, but this is consistent with both console and the PEM.
-      // Advance Game Port crashes if we don't emulate this correctly.
-      return;
+      auto translated_address = TranslateAddress<XCheckTLBFlag::Write>(address);
+      if (translated_address.result == TranslateAddressResultEnum::DIRECT_STORE_SEGMENT)
+      {
+        // dcbz to direct store segments is ignored. This is a little
+        // unintuitive, but this is consistent with both console and the PEM.
+        // Advance Game Port crashes if we don't emulate this correctly.
+        address = next_address;
+        continue;
+      }
+      if (translated_address.result == TranslateAddressResultEnum::PAGE_FAULT)
+      {
+        // If translation fails, generate a DSI.
+        GenerateDSIException(address, true);
+        return;
+      }
+      address = translated_address.address;
     }
-    if (translated_address.result == TranslateAddressResultEnum::PAGE_FAULT)
+
+    for (u32 i = 0; i < lines_in_page; ++i)
+      ClearPhysicalDCacheLine(address + i * 32);
+
+    address = next_address;
+  }
+}
+
+void MMU::ClearPhysicalDCacheLine(u32 address)
+{
+  static constexpr std::array<u8, 32> zeroes{};
+
+  // Fast path for RAM, which is what dcbz is used on in practice. Writing the whole line at once
+  // means that the data cache (if emulated) only has to be looked up once.
+  if (m_memory.GetRAM() && (address & 0xF8000000) == 0x00000000)
+  {
+    address &= m_memory.GetRamMask();
+    if (m_ppc_state.m_enable_dcache)
     {
-      // If translation fails, generate a DSI.
-      GenerateDSIException(address, true);
-      return;
+      m_ppc_state.dCache.Write(m_memory, address, zeroes.data(), 32, HID0(m_ppc_state).DLOCK);
     }
-    address = translated_address.address;
+    else
+    {
+      std::memset(&m_memory.GetRAM()[address], 0, 32);
+      m_memory.NotifyWrite(address, 32);
+    }
+    return;
+  }
+
+  if (m_memory.GetEXRAM() && (address >> 28) == 0x1 &&
+      (address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+  {
+    address &= 0x0FFFFFFF;
+    if (m_ppc_state.m_enable_dcache)
+    {
+      m_ppc_state.dCache.Write(m_memory, address + 0x10000000, zeroes.data(), 32,
+                               HID0(m_ppc_state).DLOCK);
+    }
+    else
+    {
+      std::memset(&m_memory.GetEXRAM()[address], 0, 32);
+      m_memory.NotifyWrite(address + 0x10000000, 32);
+    }
+    return;
   }
 
   // TODO: This isn't precisely correct for non-RAM regions, but the difference
@@ -1212,7 +1325,7 @@ void MMU::TouchDCacheLine(u32 address, bool store)
 
 u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(address, static_cast<u32>(HW_PAGE_SIZE)))
     return 0;
 
   if (!m_ppc_state.msr.DR)
@@ -1221,6 +1334,9 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
   if (m_ppc_state.m_enable_dcache)
     return 0;
 
+  if (m_memory.GetMMIOMapping()->IsCollectingAccessStats())
+    return 0;
+
   // Translate address
   // If we also optimize for TLB mappings, we'd have to clear the
   // JitCache on each TLB invalidation.
@@ -1238,7 +1354,7 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
 
 bool MMU::IsOptimizableGatherPipeWrite(u32 address) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(address, static_cast<u32>(HW_PAGE_SIZE)))
     return false;
 
   if (!m_ppc_state.msr.DR)
@@ -1693,6 +1809,10 @@ void ClearDCacheLineFromJit(MMU& mmu, u32 address)
 {
   mmu.ClearDCacheLine(address);
 }
+void ClearDCacheLinesFromJit(MMU& mmu, u32 address, u32 count)
+{
+  mmu.ClearDCacheLines(address, count);
+}
 u32 ReadU8FromJit(MMU& mmu, u32 address)
 {
   return mmu.Read_U8(address);
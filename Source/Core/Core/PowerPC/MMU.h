@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <string>
 
 #include "Common/BitField.h"
@@ -164,6 +165,14 @@ public:
   HostTryReadString(const Core::CPUThreadGuard& guard, u32 address, size_t size = 0,
                     RequestedAddressSpace space = RequestedAddressSpace::Effective);
 
+  // Returns the host memory backing the given address up to the end of its page, if the address
+  // resolves to MEM1 or MEM2 in the given address space and the memory can be read directly, i.e.
+  // not through the emulated data cache. Reading from the returned span gives the same results as
+  // the HostTryRead functions, but only translates the address once for the whole page.
+  static std::optional<ReadResult<std::span<const u8>>>
+  HostTryGetRAMPage(const Core::CPUThreadGuard& guard, u32 address,
+                    RequestedAddressSpace space = RequestedAddressSpace::Effective);
+
   // Writes a value to emulated memory using the currently active MMU settings.
   // If the write fails (eg. address does not correspond to a mapped address in the current address
   // space), a PanicAlert will be shown to the user.
@@ -231,6 +240,9 @@ public:
   void DMA_MemoryToLC(u32 cache_address, u32 mem_address, u32 num_blocks);
 
   void ClearDCacheLine(u32 address);  // Zeroes 32 bytes; address should be 32-byte-aligned
+  // Zeroes count consecutive cache lines, as a loop of dcbz would, but only translates the address
+  // once per page. Stops at the first line that raises a DSI.
+  void ClearDCacheLines(u32 address, u32 count);
   void StoreDCacheLine(u32 address);
   void InvalidateDCacheLine(u32 address);
   void FlushDCacheLine(u32 address);
@@ -309,6 +321,7 @@ private:
   T ReadFromHardware(u32 em_address);
   template <XCheckTLBFlag flag, bool never_translate = false>
   void WriteToHardware(u32 em_address, const u32 data, const u32 size);
+  void ClearPhysicalDCacheLine(u32 address);
   template <XCheckTLBFlag flag>
   bool IsRAMAddress(u32 address, bool translate);
 
@@ -329,6 +342,7 @@ private:
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
+void ClearDCacheLinesFromJit(MMU& mmu, u32 address, u32 count);
 u32 ReadU8FromJit(MMU& mmu, u32 address);   // Returns zero-extended 32bit value
 u32 ReadU16FromJit(MMU& mmu, u32 address);  // Returns zero-extended 32bit value
 u32 ReadU32FromJit(MMU& mmu, u32 address);
@@ -731,20 +731,54 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code,
   }
 }
 
+// Returns whether an instruction which isn't a branch can be part of a busy wait loop. These are
+// instructions whose only effects are on registers, and that don't depend on anything but
+// registers, memory and the passing of time, as these are what a busy wait loop waits on.
+static bool IsAllowedInBusyWaitLoop(const CodeOp& op)
+{
+  const UGeckoInstruction inst = op.inst;
+  switch (op.opinfo->type)
+  {
+  case OpType::Integer:
+  case OpType::Load:
+  case OpType::CR:
+    return true;
+  case OpType::System:
+    // sync, eieio: Memory barriers, often found around MMIO reads.
+    // mftb: Loops waiting for the time base to reach a value.
+    return inst.OPCD == 31 && (inst.SUBOP10 == 598 || inst.SUBOP10 == 854 || inst.SUBOP10 == 371);
+  case OpType::InstructionCache:
+    // isync
+    return inst.OPCD == 19 && inst.SUBOP10 == 150;
+  case OpType::SPR:
+  {
+    // mfspr of the time base, same as mftb.
+    const u32 spr = (inst.SPRU << 5) | (inst.SPRL & 0x1F);
+    return inst.OPCD == 31 && inst.SUBOP10 == 339 && (spr == SPR_TL || spr == SPR_TU);
+  }
+  default:
+    return false;
+  }
+}
+
 bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
-  //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
-  //   * It only reads from registers it wrote to earlier in the loop, or it
+  //   * It loops to itself and does not contain any other backwards branches.
+  //   * It does not write to memory, and only contains instructions from the set
+  //     accepted by IsAllowedInBusyWaitLoop.
+  //   * It only reads from registers (GPRs and CR fields) it wrote to earlier in the loop, or it
   //     does not write to these registers.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // This typically matches loops polling a MMIO register (e.g. the CP or VI status) or a variable
+  // in RAM, as well as loops waiting for the time base to reach a certain value.
+  //
+  // Calls to pure leaf functions (e.g. DSP mailbox reads) are detected when branch following
+  // inlined them into the block.
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
+  std::bitset<8> write_disallowed_crs;
+  std::bitset<8> written_crs;
   for (size_t i = 0; i <= instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
@@ -754,31 +788,36 @@ bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instruct
       if (code[i].branchTo == block->m_address && i == instructions)
         return true;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
+    else if (!IsAllowedInBusyWaitLoop(code[i]))
     {
-      // In the future, some subsets of other instruction types might get
-      // supported. Right now, only try loops that have this very
-      // restricted instruction set.
       return false;
     }
     else
     {
       for (int reg : code[i].regsIn)
       {
-        if (reg == -1)
-          continue;
         if (written_regs[reg])
           continue;
         write_disallowed_regs[reg] = true;
       }
       for (int reg : code[i].regsOut)
       {
-        if (reg == -1)
-          continue;
         if (write_disallowed_regs[reg])
           return false;
         written_regs[reg] = true;
       }
+      for (int cr : code[i].crIn)
+      {
+        if (written_crs[cr])
+          continue;
+        write_disallowed_crs[cr] = true;
+      }
+      for (int cr : code[i].crOut)
+      {
+        if (write_disallowed_crs[cr])
+          return false;
+        written_crs[cr] = true;
+      }
     }
   }
   return false;
@@ -794,6 +833,21 @@ static bool CanCauseGatherPipeInterruptCheck(const CodeOp& op)
          op.opinfo->type == OpType::StorePS;
 }
 
+bool PPCAnalyzer::IsHotConditionalBranch(const CodeBlock* block, const CodeOp& code) const
+{
+  // Only plain conditional bcx are followed. Calls would need the LR stack to be faked on the
+  // side exit, and following a branch back to the start of the block would just unroll a loop.
+  const UGeckoInstruction inst = code.inst;
+  if (!m_branch_taken_counts || m_is_debugging_enabled || inst.OPCD != 16 || inst.LK ||
+      code.branchTo == block->m_address)
+  {
+    return false;
+  }
+
+  const auto it = m_branch_taken_counts->find(code.address);
+  return it != m_branch_taken_counts->end() && it->second >= m_hot_branch_threshold;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
                          std::size_t block_size) const
 {
@@ -812,7 +866,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
   block->m_memory_exception = false;
   block->m_num_instructions = 0;
   block->m_gqr_used = BitSet8(0);
-  block->m_physical_addresses.clear();
+  block->m_physical_addresses.Clear();
 
   CodeOp* const code = buffer->data();
 
@@ -846,11 +900,12 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
     code[i].inst = inst;
     code[i].skip = false;
     block->m_stats->numCycles += opinfo->num_cycles;
-    block->m_physical_addresses.insert(result.physical_address);
+    block->m_physical_addresses.Insert(result.physical_address, result.physical_address + 4);
 
     SetInstructionStats(block, &code[i], opinfo);
 
     bool follow = false;
+    bool follow_conditional = false;
 
     bool conditional_continue = false;
 
@@ -881,6 +936,13 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
           caller = i;
         }
       }
+      else if (inst.OPCD == 16 && HasOption(OPTION_CONDITIONAL_CONTINUE) &&
+               IsHotConditionalBranch(block, code[i]) && block_size > 1)
+      {
+        // Follow conditional BCX instructions which are almost always taken.
+        follow = true;
+        follow_conditional = true;
+      }
       else if (inst.OPCD == 19 && inst.SUBOP10 == 16 && !inst.LK && found_call)
       {
         code[i].branchTo = code[caller].address + 4;
@@ -944,12 +1006,23 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
     code[i].branchIsIdleLoop =
         code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    if (code[i].branchIsIdleLoop)
+    {
+      INFO_LOG_FMT(DYNA_REC, "Detected busy wait loop at {:08x} (looping from {:08x})",
+                   block->m_address, code[i].address);
+    }
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
       // Follow the unconditional branch.
       numFollows++;
       address = code[i].branchTo;
+      if (follow_conditional)
+      {
+        // Same as for conditional_continue: the matching CALL/RET pair isn't guaranteed anymore.
+        code[i].branchFollowed = true;
+        found_call = false;
+      }
     }
     else
     {
@@ -982,6 +1055,11 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
 
   auto& power_pc = system.GetPowerPC();
   auto& ppc_symbol_db = power_pc.GetSymbolDB();
+  const auto ppc_mode = power_pc.GetMode();
+  const auto& breakpoints = power_pc.GetBreakPoints();
+  // Breakpoints are rare outside of debugging, so avoid looking up every instruction.
+  const bool has_breakpoints = !breakpoints.GetBreakPoints().empty();
+
   // Scan for flag dependencies; assume the next block (or any branch that can leave the block)
   // wants flags, to be safe.
   bool wantsFPRF = true;
@@ -1001,9 +1079,8 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       crDiscardable = BitSet8{};
     }
 
-    const auto ppc_mode = power_pc.GetMode();
     const bool hle = !!HLE::TryReplaceFunction(ppc_symbol_db, op.address, ppc_mode);
-    const bool breakpoint = power_pc.GetBreakPoints().IsAddressBreakPoint(op.address);
+    const bool breakpoint = has_breakpoints && breakpoints.IsAddressBreakPoint(op.address);
     const bool may_exit_block = hle || breakpoint || op.canEndBlock || op.canCauseException;
 
     const bool opWantsFPRF = op.wantsFPRF;
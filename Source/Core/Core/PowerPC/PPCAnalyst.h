@@ -6,10 +6,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
+#include "Common/FlatRangeSet.h"
 #include "Core/PowerPC/PPCTables.h"
 
 class PPCSymbolDB;
@@ -41,6 +43,8 @@ struct CodeOp  // 16B
   bool isBranchTarget = false;
   bool branchUsesCtr = false;
   bool branchIsIdleLoop = false;
+  // Conditional branch whose target was followed; the not taken path leaves the block.
+  bool branchFollowed = false;
   BitSet8 wantsCR;
   bool wantsFPRF = false;
   bool wantsCA = false;
@@ -130,7 +134,7 @@ struct CodeBlock
   BitSet32 m_gpr_inputs;
 
   // Which memory locations are occupied by this block.
-  std::set<u32> m_physical_addresses;
+  Common::FlatRangeSet<u32> m_physical_addresses;
 };
 
 class PPCAnalyzer
@@ -182,6 +186,14 @@ public:
   void SetBranchFollowingEnabled(bool enabled) { m_enable_branch_following = enabled; }
   void SetFloatExceptionsEnabled(bool enabled) { m_enable_float_exceptions = enabled; }
   void SetDivByZeroExceptionsEnabled(bool enabled) { m_enable_div_by_zero_exceptions = enabled; }
+  // Conditional branches taken at least hot_threshold times according to taken_counts are
+  // followed like unconditional branches (with OPTION_BRANCH_FOLLOW). The JIT must then emit the
+  // not taken path as a side exit. See CodeOp::branchFollowed.
+  void SetBranchTakenCounts(const std::unordered_map<u32, u32>* taken_counts, u32 hot_threshold)
+  {
+    m_branch_taken_counts = taken_counts;
+    m_hot_branch_threshold = hot_threshold;
+  }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size) const;
 
 private:
@@ -198,6 +210,7 @@ private:
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo) const;
   bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsHotConditionalBranch(const CodeBlock* block, const CodeOp& code) const;
 
   // Options
   u32 m_options = 0;
@@ -206,6 +219,9 @@ private:
   bool m_enable_branch_following = false;
   bool m_enable_float_exceptions = false;
   bool m_enable_div_by_zero_exceptions = false;
+
+  const std::unordered_map<u32, u32>* m_branch_taken_counts = nullptr;
+  u32 m_hot_branch_threshold = 0;
 };
 
 void FindFunctions(const Core::CPUThreadGuard& guard, u32 startAddr, u32 endAddr,
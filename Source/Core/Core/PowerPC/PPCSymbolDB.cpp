@@ -42,6 +42,7 @@ Common::Symbol* PPCSymbolDB::AddFunction(const Core::CPUThreadGuard& guard, u32
     return nullptr;
 
   const auto insert = m_functions.emplace(start_addr, std::move(symbol));
+  ++m_functions_version;
   Common::Symbol* ptr = &insert.first->second;
   ptr->type = Common::Symbol::Type::Function;
   m_checksum_to_function[ptr->hash].insert(ptr);
@@ -65,6 +66,7 @@ void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAdd
   {
     // new symbol. run analyze.
     auto& new_symbol = m_functions.emplace(startAddr, name).first->second;
+    ++m_functions_version;
     new_symbol.type = type;
     new_symbol.address = startAddr;
 
@@ -89,23 +91,54 @@ void PPCSymbolDB::AddKnownSymbol(const Core::CPUThreadGuard& guard, u32 startAdd
 
 Common::Symbol* PPCSymbolDB::GetSymbolFromAddr(u32 addr)
 {
-  auto it = m_functions.lower_bound(addr);
-
-  if (it != m_functions.end())
-  {
-    // If the address is exactly the start address of a symbol, we're done.
-    if (it->second.address == addr)
-      return &it->second;
-  }
-  if (it != m_functions.begin())
+  if (m_address_index_version.load(std::memory_order_acquire) != m_functions_version)
+    UpdateAddressIndex();
+
+  const auto contains = [addr](const Common::Symbol* symbol) {
+    return addr == symbol->address ||
+           (addr > symbol->address && addr - symbol->address < symbol->size);
+  };
+
+  // The last hit is still the last symbol starting at or before the address if the address is
+  // before the start of the next symbol.
+  const size_t last_hit = m_last_hit.load(std::memory_order_relaxed);
+  if (last_hit < m_address_index.size())
   {
-    // Otherwise, check whether the address is within the bounds of a symbol.
-    --it;
-    if (addr >= it->second.address && addr < it->second.address + it->second.size)
-      return &it->second;
+    Common::Symbol* const symbol = m_address_index[last_hit];
+    const bool before_next = last_hit + 1 == m_address_index.size() ||
+                             addr < m_address_index[last_hit + 1]->address;
+    if (addr >= symbol->address && before_next)
+      return contains(symbol) ? symbol : nullptr;
   }
 
-  return nullptr;
+  // Find the last symbol starting at or before the address.
+  const auto it = std::ranges::upper_bound(m_address_index, addr, {}, &Common::Symbol::address);
+  if (it == m_address_index.begin())
+    return nullptr;
+
+  const size_t hit = static_cast<size_t>(it - m_address_index.begin()) - 1;
+  Common::Symbol* const symbol = m_address_index[hit];
+  if (!contains(symbol))
+    return nullptr;
+
+  m_last_hit.store(hit, std::memory_order_relaxed);
+  return symbol;
+}
+
+void PPCSymbolDB::UpdateAddressIndex()
+{
+  std::lock_guard lock(m_address_index_mutex);
+  const u32 version = m_functions_version;
+  if (m_address_index_version.load(std::memory_order_relaxed) == version)
+    return;
+
+  m_last_hit.store(0, std::memory_order_relaxed);
+  m_address_index.clear();
+  m_address_index.reserve(m_functions.size());
+  for (auto& [address, symbol] : m_functions)
+    m_address_index.push_back(&symbol);
+
+  m_address_index_version.store(version, std::memory_order_release);
 }
 
 std::string_view PPCSymbolDB::GetDescription(u32 addr)
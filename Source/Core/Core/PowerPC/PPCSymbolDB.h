@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/SymbolDB.h"
@@ -39,4 +42,16 @@ public:
   void PrintCalls(u32 funcAddr) const;
   void PrintCallers(u32 funcAddr) const;
   void LogFunctionCall(u32 addr);
+
+private:
+  void UpdateAddressIndex();
+
+  // Symbols sorted by address, which GetSymbolFromAddr binary searches instead of walking the
+  // map. It is rebuilt on the first lookup after symbols are added or removed.
+  std::vector<Common::Symbol*> m_address_index;
+  std::atomic<u32> m_address_index_version{~0u};
+  std::mutex m_address_index_mutex;
+  // Position in m_address_index of the last hit. Lookups tend to hit the same function
+  // repeatedly, e.g. when stepping or profiling.
+  std::atomic<size_t> m_last_hit{0};
 };
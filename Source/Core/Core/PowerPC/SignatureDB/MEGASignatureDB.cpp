@@ -9,7 +9,9 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
@@ -101,18 +103,38 @@ bool GetRefs(MEGASignature* sig, std::istringstream* iss)
   return true;
 }
 
-bool Compare(const Core::CPUThreadGuard& guard, u32 address, u32 size, const MEGASignature& sig)
+// Reads the words of a function from guest memory as they are needed, so that each word is only
+// read once no matter how many signatures it is compared against.
+class FunctionCode
 {
-  if (size != sig.code.size() * sizeof(u32))
-    return false;
+public:
+  FunctionCode(const Core::CPUThreadGuard& guard, u32 address) : m_guard(guard), m_address(address)
+  {
+  }
 
-  for (size_t i = 0; i < sig.code.size(); ++i)
+  u32 operator[](size_t i)
   {
-    if (sig.code[i] != 0 && PowerPC::MMU::HostRead_U32(
-                                guard, static_cast<u32>(address + i * sizeof(u32))) != sig.code[i])
+    while (m_words.size() <= i)
     {
-      return false;
+      const u32 offset = static_cast<u32>(m_words.size() * sizeof(u32));
+      m_words.push_back(PowerPC::MMU::HostRead_U32(m_guard, m_address + offset));
     }
+    return m_words[i];
+  }
+
+private:
+  const Core::CPUThreadGuard& m_guard;
+  u32 m_address;
+  std::vector<u32> m_words;
+};
+
+// The caller is responsible for only comparing signatures of the same size as the function.
+bool Compare(FunctionCode& function, const MEGASignature& sig)
+{
+  for (size_t i = 0; i < sig.code.size(); ++i)
+  {
+    if (sig.code[i] != 0 && function[i] != sig.code[i])
+      return false;
   }
   return true;
 }
@@ -160,12 +182,24 @@ bool MEGASignatureDB::Save(const std::string& file_path) const
 
 void MEGASignatureDB::Apply(const Core::CPUThreadGuard& guard, PPCSymbolDB* symbol_db) const
 {
+  // A signature can only match functions of exactly its size, so each function is only compared
+  // against the signatures of its size, in database order.
+  std::unordered_map<u32, std::vector<const MEGASignature*>> signatures_by_size;
+  for (const auto& sig : m_signatures)
+    signatures_by_size[static_cast<u32>(sig.code.size() * sizeof(u32))].push_back(&sig);
+
   for (auto& it : symbol_db->AccessSymbols())
   {
     auto& symbol = it.second;
-    for (const auto& sig : m_signatures)
+    const auto candidates = signatures_by_size.find(symbol.size);
+    if (candidates == signatures_by_size.end())
+      continue;
+
+    FunctionCode function(guard, symbol.address);
+    for (const MEGASignature* sig_ptr : candidates->second)
     {
-      if (Compare(guard, symbol.address, symbol.size, sig))
+      const MEGASignature& sig = *sig_ptr;
+      if (Compare(function, sig))
       {
         symbol.name = sig.name;
         INFO_LOG_FMT(SYMBOLS, "Found {} at {:08x} (size: {:08x})!", sig.name, symbol.address,
@@ -6,7 +6,10 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
@@ -21,12 +24,16 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
+#include "Common/Align.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/Logging/LogManager.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
@@ -36,6 +43,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -51,6 +59,7 @@
 
 #include "VideoCommon/FrameDumpFFMpeg.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/StutterTracker.h"
 #include "VideoCommon/VideoBackendBase.h"
 
 namespace State
@@ -89,6 +98,11 @@ static std::mutex s_save_thread_mutex;
 // Queue for compressing and writing savestates to disk.
 static Common::WorkQueueThread<CompressAndDumpState_args> s_save_thread;
 
+// The buffer of the last state written to disk. The next save reuses it, so that the CPU thread
+// doesn't have to wait for a new buffer of about the same size to be allocated and paged in.
+static std::vector<u8> s_spare_save_buffer;
+static std::mutex s_spare_save_buffer_mutex;
+
 // Keeps track of savestate writes that are currently happening, so we don't load a state while
 // another one is still saving. This is particularly important so if you save to a slot and then
 // immediately load from the same one, you don't accidentally load the state that's still at that
@@ -101,10 +115,16 @@ static std::condition_variable s_state_write_queue_is_empty;
 constexpr u32 STATE_VERSION = 168;  // Last changed in PR 12639
 
 // Increase this if the StateExtendedHeader definition changes
-constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
+constexpr u32 EXTENDED_HEADER_VERSION = 2;
+
+// States with this extended header version store LZ4 data as a sequence of chunks of up to
+// LZ4_MAX_INPUT_SIZE bytes, each preceded by its compressed size, and have no chunk header.
+constexpr u32 UNCHUNKED_EXTENDED_HEADER_VERSION = 1;
 
-// Change this if we ever need to store more data in the extended header
-constexpr u32 COMPRESSED_DATA_OFFSET = 0;
+// The uncompressed size of the chunks that compressed states are split into
+constexpr u32 STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+
+constexpr int STATE_ZSTD_COMPRESSION_LEVEL = 1;
 
 constexpr u32 COOKIE_BASE = 0xBAADBABE;
 
@@ -230,23 +250,88 @@ void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer)
       true);
 }
 
-void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+// The size of the last state that was written, used to size new buffers without measuring.
+// Only accessed by the CPU thread.
+static size_t s_last_state_size = 0;
+
+// Serializes the state into buffer. state_size is set to the size the state needs, which is larger
+// than the buffer if it ran out of space. If Core logging is enabled at the info level, this also
+// logs how long each part of the state took and how large it is. Returns false if DoState didn't
+// finish in write mode.
+static bool DoStateWritePass(Core::System& system, std::vector<u8>& buffer, size_t& state_size)
 {
-  Core::RunOnCPUThread(
-      system,
-      [&] {
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+
+  const bool profile = Common::Log::LogManager::GetInstance()->IsEnabled(
+      Common::Log::LogType::CORE, Common::Log::LogLevel::LINFO);
+  std::string profile_stats;
+  u64 section_start_us = Common::Timer::NowUs();
+  const u8* section_start = ptr;
+  if (profile)
+  {
+    p.SetMarkerCallback([&](const std::string& name) {
+      const u64 now_us = Common::Timer::NowUs();
+      profile_stats += fmt::format(" {} {}us/{}KiB", name, now_us - section_start_us,
+                                   (ptr - section_start) / 1024);
+      section_start_us = now_us;
+      section_start = ptr;
+    });
+  }
 
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-        buffer.resize(buffer_size);
+  DoState(system, p);
 
-        ptr = buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
-      },
-      true);
+  if (profile)
+    INFO_LOG_FMT(CORE, "Savestate sections:{}", profile_stats);
+
+  state_size = static_cast<size_t>(ptr - buffer.data());
+  return p.IsWriteMode();
+}
+
+// Every DoState pass synchronizes with the GPU thread and reads back the EFB, so rather than
+// measuring the state first, this serializes straight into a buffer sized like the previous state
+// (or with the capacity left over from it). Only if the state has grown past that does it take a
+// second pass, using the size measured by the rest of the first one. Returns false if DoState
+// aborted.
+static bool WriteStateToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  if (buffer.capacity() != 0)
+  {
+    buffer.resize(buffer.capacity());
+  }
+  else if (s_last_state_size != 0)
+  {
+    buffer.resize(s_last_state_size);
+  }
+  else
+  {
+    u8* ptr = nullptr;
+    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+    DoState(system, p_measure);
+    buffer.resize(reinterpret_cast<size_t>(ptr));
+  }
+
+  size_t state_size;
+  bool success = DoStateWritePass(system, buffer, state_size);
+
+  // If the mode was changed without running out of space, DoState aborted the save.
+  if (!success && state_size > buffer.size())
+  {
+    buffer.resize(state_size);
+    success = DoStateWritePass(system, buffer, state_size);
+  }
+
+  if (!success)
+    return false;
+
+  buffer.resize(state_size);
+  s_last_state_size = state_size;
+  return true;
+}
+
+void SaveToBuffer(Core::System& system, std::vector<u8>& buffer)
+{
+  Core::RunOnCPUThread(system, [&] { WriteStateToBuffer(system, buffer); }, true);
 }
 
 namespace
@@ -320,51 +405,114 @@ static bool CompareTimestamp(const SlotWithTimestamp& lhs, const SlotWithTimesta
   return lhs.timestamp < rhs.timestamp;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// Calls function(i) for each i in [0, count) spread over all host cores, and returns whether every
+// call returned true.
+template <typename Function>
+static bool ForEachChunkInParallel(size_t count, const Function& function)
 {
-  u64 total_bytes_compressed = 0;
+  const size_t thread_count =
+      std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+
+  const auto run_slice = [&](size_t first) {
+    bool success = true;
+    for (size_t i = first; i < count; i += thread_count)
+      success &= function(i);
+    return success;
+  };
+
+  std::vector<std::future<bool>> futures;
+  for (size_t i = 1; i < thread_count; ++i)
+    futures.push_back(std::async(std::launch::async, run_slice, i));
+
+  bool success = thread_count == 0 || run_slice(0);
+  for (std::future<bool>& future : futures)
+    success &= future.get();
+  return success;
+}
 
-  while (true)
+static bool CompressChunk(CompressionType compression_type, const u8* data, size_t size,
+                          std::vector<u8>& out)
+{
+  if (compression_type == CompressionType::Zstd)
   {
-    u64 bytes_left_to_compress = size - total_bytes_compressed;
+    out.resize(ZSTD_compressBound(size));
+    const size_t compressed_size =
+        ZSTD_compress(out.data(), out.size(), data, size, STATE_ZSTD_COMPRESSION_LEVEL);
+    if (ZSTD_isError(compressed_size))
+      return false;
 
-    int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
-    auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
-    s32 compressed_len =
-        LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
-                             compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
+    out.resize(compressed_size);
+    return true;
+  }
 
-    if (compressed_len == 0)
-    {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
-    }
+  out.resize(LZ4_compressBound(static_cast<int>(size)));
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+                           static_cast<int>(size), static_cast<int>(out.size()));
+  if (compressed_size <= 0)
+    return false;
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+  out.resize(compressed_size);
+  return true;
+}
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
-  }
+static bool DecompressChunk(CompressionType compression_type, const u8* data, size_t size,
+                            u8* out, size_t out_size)
+{
+  if (compression_type == CompressionType::Zstd)
+    return ZSTD_decompress(out, out_size, data, size) == out_size;
+
+  return LZ4_decompress_safe(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+                             static_cast<int>(size),
+                             static_cast<int>(out_size)) == static_cast<int>(out_size);
+}
+
+static bool CompressBuffer(CompressionType compression_type, const u8* raw_buffer, size_t size,
+                           std::vector<std::vector<u8>>& chunks)
+{
+  chunks.resize(Common::AlignUp(size, STATE_CHUNK_SIZE) / STATE_CHUNK_SIZE);
+  return ForEachChunkInParallel(chunks.size(), [&](size_t i) {
+    const size_t offset = i * STATE_CHUNK_SIZE;
+    return CompressChunk(compression_type, raw_buffer + offset,
+                         std::min<size_t>(STATE_CHUNK_SIZE, size - offset), chunks[i]);
+  });
+}
+
+static CompressionType GetCompressionType()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+
+  return Config::Get(Config::MAIN_SAVESTATE_ZSTD_COMPRESSION) ? CompressionType::Zstd :
+                                                                CompressionType::LZ4;
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static void CreateExtendedHeader(StateExtendedHeader& extended_header,
+                                 CompressionType compression_type, size_t uncompressed_size,
+                                 const std::vector<std::vector<u8>>& chunks)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
-  base_header.payload_offset = COMPRESSED_DATA_OFFSET;
+  base_header.compression_type = compression_type;
+  base_header.payload_offset = 0;
   base_header.uncompressed_size = uncompressed_size;
 
+  if (compression_type != CompressionType::Uncompressed)
+  {
+    extended_header.chunk_header.chunk_size = STATE_CHUNK_SIZE;
+    extended_header.chunk_header.chunk_count = static_cast<u32>(chunks.size());
+    for (const std::vector<u8>& chunk : chunks)
+      extended_header.compressed_chunk_sizes.push_back(static_cast<u32>(chunk.size()));
+
+    base_header.payload_offset = static_cast<u32>(
+        sizeof(StateExtendedChunkHeader) + chunks.size() * sizeof(u32));
+  }
+
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(CompressionType compression_type, size_t uncompressed_size,
+                               const std::vector<std::vector<u8>>& chunks, File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -376,14 +524,20 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, compression_type, uncompressed_size, chunks);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
   f.WriteString(header.version_string);
 
   f.WriteArray(&extended_header.base_header, 1);
-  // If StateExtendedHeader is amended to include more than the base, add WriteBytes() calls here.
+  if (compression_type != CompressionType::Uncompressed)
+  {
+    f.WriteArray(&extended_header.chunk_header, 1);
+    f.WriteArray(extended_header.compressed_chunk_sizes.data(),
+                 extended_header.compressed_chunk_sizes.size());
+  }
+  // If StateExtendedHeader is amended to include more fields, add WriteBytes() calls here.
 }
 
 static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args& save_args)
@@ -392,6 +546,15 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
   const size_t buffer_size = save_args.buffer_vector.size();
   const std::string& filename = save_args.filename;
 
+  const CompressionType compression_type = GetCompressionType();
+  std::vector<std::vector<u8>> chunks;
+  if (compression_type != CompressionType::Uncompressed &&
+      !CompressBuffer(compression_type, buffer_data, buffer_size, chunks))
+  {
+    PanicAlertFmtT("Failed to compress the state");
+    return;
+  }
+
   // Find free temporary filename.
   // TODO: The file exists check and the actual opening of the file should be atomic, we don't have
   // functions for that.
@@ -410,12 +573,17 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  WriteHeadersToFile(compression_type, buffer_size, chunks, f);
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
+  if (compression_type != CompressionType::Uncompressed)
+  {
+    for (const std::vector<u8>& chunk : chunks)
+      f.WriteBytes(chunk.data(), chunk.size());
+  }
   else
+  {
     f.WriteBytes(buffer_data, buffer_size);
+  }
 
   if (!f.IsGood())
     Core::DisplayMessage("Failed to write state file", 2000);
@@ -478,6 +646,8 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
   if (!lk)
     return;
 
+  StutterScope stutter_scope(StutterCause::SaveState);
+
   Core::RunOnCPUThread(
       system,
       [&] {
@@ -486,20 +656,13 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
           ++s_state_writes_in_queue;
         }
 
-        // Measure the size of the buffer.
-        u8* ptr = nullptr;
-        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-        DoState(system, p_measure);
-        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-        // Then actually do the write.
         std::vector<u8> current_buffer;
-        current_buffer.resize(buffer_size);
-        ptr = current_buffer.data();
-        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-        DoState(system, p);
+        {
+          std::lock_guard lk_(s_spare_save_buffer_mutex);
+          current_buffer.swap(s_spare_save_buffer);
+        }
 
-        if (p.IsWriteMode())
+        if (WriteStateToBuffer(system, current_buffer))
         {
           Core::DisplayMessage("Saving State...", 1000);
 
@@ -725,6 +888,49 @@ static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f
   }
 }
 
+static bool DecompressChunks(std::vector<u8>& raw_buffer,
+                             const StateExtendedHeader& extended_header, File::IOFile& f)
+{
+  const auto compression_type =
+      static_cast<CompressionType>(extended_header.base_header.compression_type);
+  const u64 size = extended_header.base_header.uncompressed_size;
+  const u32 chunk_size = extended_header.chunk_header.chunk_size;
+  const std::vector<u32>& compressed_sizes = extended_header.compressed_chunk_sizes;
+
+  if (chunk_size == 0 || compressed_sizes.size() != Common::AlignUp(size, chunk_size) / chunk_size)
+  {
+    PanicAlertFmt("State chunk header corrupted");
+    return false;
+  }
+
+  std::vector<u64> offsets(compressed_sizes.size());
+  u64 compressed_size = 0;
+  for (size_t i = 0; i < compressed_sizes.size(); ++i)
+  {
+    offsets[i] = compressed_size;
+    compressed_size += compressed_sizes[i];
+  }
+
+  std::vector<u8> compressed_data(compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  raw_buffer.resize(size);
+  const bool success = ForEachChunkInParallel(compressed_sizes.size(), [&](size_t i) {
+    const u64 offset = i * u64(chunk_size);
+    return DecompressChunk(compression_type, compressed_data.data() + offsets[i],
+                           compressed_sizes[i], raw_buffer.data() + offset,
+                           std::min<u64>(chunk_size, size - offset));
+  });
+
+  if (!success)
+    PanicAlertFmtT("Failed to decompress the state");
+  return success;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -802,23 +1008,62 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
     PanicAlertFmt("Unable to read state header");
     return;
   }
-  // If StateExtendedHeader is amended to include more than the base, add ReadBytes() calls here.
 
-  if (extended_header.base_header.header_version != EXTENDED_HEADER_VERSION)
+  const u16 header_version = extended_header.base_header.header_version;
+  if (header_version != EXTENDED_HEADER_VERSION &&
+      header_version != UNCHUNKED_EXTENDED_HEADER_VERSION)
   {
     PanicAlertFmt("State header corrupted");
     return;
   }
 
+  const bool is_chunked = header_version != UNCHUNKED_EXTENDED_HEADER_VERSION &&
+                          extended_header.base_header.compression_type !=
+                              CompressionType::Uncompressed;
+  if (!is_chunked && extended_header.base_header.compression_type == CompressionType::Zstd)
+  {
+    PanicAlertFmt("State header corrupted");
+    return;
+  }
+
+  if (is_chunked)
+  {
+    StateExtendedChunkHeader& chunk_header = extended_header.chunk_header;
+    std::vector<u32>& compressed_sizes = extended_header.compressed_chunk_sizes;
+    if (!f.ReadArray(&chunk_header, 1) ||
+        extended_header.base_header.payload_offset !=
+            sizeof(StateExtendedChunkHeader) + u64(chunk_header.chunk_count) * sizeof(u32))
+    {
+      PanicAlertFmt("Unable to read state header");
+      return;
+    }
+
+    compressed_sizes.resize(chunk_header.chunk_count);
+    if (!f.ReadArray(compressed_sizes.data(), compressed_sizes.size()))
+    {
+      PanicAlertFmt("Unable to read state header");
+      return;
+    }
+  }
+  // If StateExtendedHeader is amended to include more fields, add ReadBytes() calls here.
+
   std::vector<u8> buffer;
 
   switch (extended_header.base_header.compression_type)
   {
   case CompressionType::LZ4:
+  case CompressionType::Zstd:
   {
     Core::DisplayMessage("Decompressing State...", 500);
-    if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
+    if (is_chunked)
+    {
+      if (!DecompressChunks(buffer, extended_header, f))
+        return;
+    }
+    else if (!DecompressLZ4(buffer, extended_header.base_header.uncompressed_size, f))
+    {
       return;
+    }
 
     break;
   }
@@ -877,6 +1122,7 @@ void LoadAs(Core::System& system, const std::string& filename)
   if (!lk)
     return;
 
+  StutterScope stutter_scope(StutterCause::SaveState);
   Core::RunOnCPUThread(
       system,
       [&] {
@@ -939,6 +1185,249 @@ void LoadAs(Core::System& system, const std::string& filename)
       true);
 }
 
+namespace
+{
+struct RewindCapture
+{
+  std::vector<u8> buffer;
+  size_t memory_budget;
+};
+
+struct RewindEntry
+{
+  // LZ4 compressed in chunks of at most LZ4_MAX_INPUT_SIZE bytes, each preceded by its size
+  std::vector<u8> data;
+  u64 uncompressed_size;
+  // Keyframes hold a full state. Other entries hold the XOR of their state with the keyframe
+  // before them, which is mostly zeroes and compresses a lot better.
+  bool is_keyframe;
+};
+}  // namespace
+
+// Number of rewind points that share one keyframe
+constexpr size_t REWIND_KEYFRAME_INTERVAL = 16;
+
+// Everything below is protected by this mutex, except for s_rewind_frames_since_capture, which
+// is only accessed by the CPU thread
+// while emulation is running.
+static std::mutex s_rewind_mutex;
+static std::deque<RewindEntry> s_rewind_entries;
+static size_t s_rewind_memory_usage = 0;
+static std::vector<u8> s_rewind_keyframe;
+static size_t s_rewind_entries_since_keyframe = 0;
+static std::vector<u8> s_rewind_spare_buffer;
+
+static std::atomic<bool> s_rewind_capture_pending = false;
+static u32 s_rewind_frames_since_capture = 0;
+
+// Compresses and stores rewind points away from the CPU thread.
+static Common::WorkQueueThread<RewindCapture> s_rewind_thread;
+
+static void XorBuffer(std::vector<u8>& buffer, const std::vector<u8>& other)
+{
+  for (size_t i = 0; i < buffer.size(); ++i)
+    buffer[i] ^= other[i];
+}
+
+static std::vector<u8> CompressRewindBuffer(const std::vector<u8>& buffer)
+{
+  std::vector<u8> result;
+  size_t total_bytes_compressed = 0;
+  while (total_bytes_compressed < buffer.size())
+  {
+    const int bytes_to_compress = static_cast<int>(std::min(
+        static_cast<size_t>(LZ4_MAX_INPUT_SIZE), buffer.size() - total_bytes_compressed));
+
+    const size_t chunk_offset = result.size();
+    result.resize(chunk_offset + sizeof(s32) + LZ4_compressBound(bytes_to_compress));
+
+    const s32 compressed_size = LZ4_compress_default(
+        reinterpret_cast<const char*>(buffer.data()) + total_bytes_compressed,
+        reinterpret_cast<char*>(result.data()) + chunk_offset + sizeof(s32), bytes_to_compress,
+        static_cast<int>(result.size() - chunk_offset - sizeof(s32)));
+    if (compressed_size <= 0)
+      return {};
+
+    std::memcpy(result.data() + chunk_offset, &compressed_size, sizeof(s32));
+    result.resize(chunk_offset + sizeof(s32) + compressed_size);
+    total_bytes_compressed += bytes_to_compress;
+  }
+  result.shrink_to_fit();
+  return result;
+}
+
+static bool DecompressRewindEntry(const RewindEntry& entry, std::vector<u8>& buffer)
+{
+  buffer.resize(entry.uncompressed_size);
+
+  size_t read_offset = 0;
+  size_t total_bytes_decompressed = 0;
+  while (total_bytes_decompressed < buffer.size())
+  {
+    s32 compressed_size;
+    if (read_offset + sizeof(s32) > entry.data.size())
+      return false;
+    std::memcpy(&compressed_size, entry.data.data() + read_offset, sizeof(s32));
+    read_offset += sizeof(s32);
+
+    const int bytes_to_decompress = static_cast<int>(std::min(
+        static_cast<size_t>(LZ4_MAX_INPUT_SIZE), buffer.size() - total_bytes_decompressed));
+    if (compressed_size <= 0 || read_offset + compressed_size > entry.data.size())
+      return false;
+
+    const int bytes_decompressed = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(entry.data.data()) + read_offset,
+        reinterpret_cast<char*>(buffer.data()) + total_bytes_decompressed, compressed_size,
+        bytes_to_decompress);
+    if (bytes_decompressed != bytes_to_decompress)
+      return false;
+
+    read_offset += compressed_size;
+    total_bytes_decompressed += bytes_decompressed;
+  }
+  return true;
+}
+
+static void StoreRewindCapture(RewindCapture capture)
+{
+  {
+    std::lock_guard lk(s_rewind_mutex);
+
+    RewindEntry entry;
+    entry.uncompressed_size = capture.buffer.size();
+    entry.is_keyframe = s_rewind_entries.empty() ||
+                        s_rewind_entries_since_keyframe >= REWIND_KEYFRAME_INTERVAL ||
+                        s_rewind_keyframe.size() != capture.buffer.size();
+
+    if (entry.is_keyframe)
+    {
+      entry.data = CompressRewindBuffer(capture.buffer);
+      s_rewind_keyframe.swap(capture.buffer);
+      s_rewind_entries_since_keyframe = 0;
+    }
+    else
+    {
+      XorBuffer(capture.buffer, s_rewind_keyframe);
+      entry.data = CompressRewindBuffer(capture.buffer);
+      ++s_rewind_entries_since_keyframe;
+    }
+
+    if (!entry.data.empty())
+    {
+      s_rewind_memory_usage += entry.data.size();
+      s_rewind_entries.push_back(std::move(entry));
+    }
+    else if (entry.is_keyframe)
+    {
+      // Nothing may reference a keyframe that didn't make it into the buffer
+      s_rewind_entries_since_keyframe = REWIND_KEYFRAME_INTERVAL;
+    }
+
+    // Dropping a keyframe also drops the entries that were stored relative to it
+    while (s_rewind_memory_usage > capture.memory_budget && !s_rewind_entries.empty())
+    {
+      do
+      {
+        s_rewind_memory_usage -= s_rewind_entries.front().data.size();
+        s_rewind_entries.pop_front();
+      } while (!s_rewind_entries.empty() && !s_rewind_entries.front().is_keyframe);
+    }
+
+    s_rewind_spare_buffer.swap(capture.buffer);
+  }
+
+  s_rewind_capture_pending = false;
+}
+
+void CaptureRewindPoint(Core::System& system)
+{
+  if (!Config::Get(Config::MAIN_ENABLE_REWIND) || NetPlay::IsNetPlayRunning())
+    return;
+
+#ifdef USE_RETRO_ACHIEVEMENTS
+  if (AchievementManager::GetInstance().IsHardcoreModeActive())
+    return;
+#endif  // USE_RETRO_ACHIEVEMENTS
+
+  if (++s_rewind_frames_since_capture < Config::Get(Config::MAIN_REWIND_INTERVAL))
+    return;
+
+  // If the previous rewind point is still being compressed, try again next frame rather than
+  // queueing up more uncompressed states.
+  if (s_rewind_capture_pending)
+    return;
+
+  s_rewind_frames_since_capture = 0;
+
+  RewindCapture capture;
+  capture.memory_budget = size_t(Config::Get(Config::MAIN_REWIND_BUFFER_SIZE)) * 1024 * 1024;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    capture.buffer.swap(s_rewind_spare_buffer);
+  }
+
+  SaveToBuffer(system, capture.buffer);
+
+  s_rewind_capture_pending = true;
+  s_rewind_thread.Push(std::move(capture));
+}
+
+bool Rewind(Core::System& system)
+{
+  s_rewind_thread.WaitForCompletion();
+
+  std::vector<u8> buffer;
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    if (s_rewind_entries.empty())
+    {
+      Core::DisplayMessage("There is nothing to rewind to", 2000);
+      return false;
+    }
+
+    const auto keyframe = std::find_if(s_rewind_entries.rbegin(), s_rewind_entries.rend(),
+                                       [](const RewindEntry& entry) { return entry.is_keyframe; });
+    bool success = DecompressRewindEntry(*keyframe, buffer);
+    if (success && !s_rewind_entries.back().is_keyframe)
+    {
+      std::vector<u8> delta;
+      success = DecompressRewindEntry(s_rewind_entries.back(), delta) &&
+                delta.size() == buffer.size();
+      if (success)
+        XorBuffer(buffer, delta);
+    }
+
+    s_rewind_memory_usage -= s_rewind_entries.back().data.size();
+    s_rewind_entries.pop_back();
+
+    // The cached keyframe may just have been removed, so start over with a new one
+    s_rewind_entries_since_keyframe = REWIND_KEYFRAME_INTERVAL;
+
+    if (!success)
+    {
+      PanicAlertFmtT("Internal LZ4 Error - decompression failed");
+      return false;
+    }
+  }
+
+  // The movie state is part of the savestate, so input recording continues from the frame that
+  // was rewound to while playback stays in sync with the input file.
+  LoadFromBuffer(system, buffer);
+  return true;
+}
+
+static void ClearRewindBuffer()
+{
+  std::lock_guard lk(s_rewind_mutex);
+  std::deque<RewindEntry>().swap(s_rewind_entries);
+  s_rewind_memory_usage = 0;
+  std::vector<u8>().swap(s_rewind_keyframe);
+  std::vector<u8>().swap(s_rewind_spare_buffer);
+  s_rewind_entries_since_keyframe = 0;
+  s_rewind_frames_since_capture = 0;
+  s_rewind_capture_pending = false;
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -949,6 +1438,11 @@ void Init(Core::System& system)
   s_save_thread.Reset("Savestate Worker", [&system](CompressAndDumpState_args args) {
     CompressAndDumpState(system, args);
 
+    {
+      std::lock_guard lk(s_spare_save_buffer_mutex);
+      s_spare_save_buffer = std::move(args.buffer_vector);
+    }
+
     {
       std::lock_guard lk(s_state_writes_in_queue_mutex);
       if (--s_state_writes_in_queue == 0)
@@ -958,11 +1452,16 @@ void Init(Core::System& system)
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  s_rewind_thread.Reset("Rewind Worker", StoreRewindCapture);
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
+  s_rewind_thread.Shutdown();
+  ClearRewindBuffer();
+  s_last_state_size = 0;
 
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
@@ -971,6 +1470,10 @@ void Shutdown()
     std::lock_guard lk(s_undo_load_buffer_mutex);
     std::vector<u8>().swap(s_undo_load_buffer);
   }
+  {
+    std::lock_guard lk(s_spare_save_buffer_mutex);
+    std::vector<u8>().swap(s_spare_save_buffer);
+  }
 }
 
 static std::string MakeStateFilename(int number)
@@ -55,6 +55,7 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  Zstd = 2,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -72,12 +73,27 @@ static_assert(offsetof(StateExtendedBaseHeader, payload_offset) == 4);
 static_assert(offsetof(StateExtendedBaseHeader, uncompressed_size) == 8);
 static_assert(std::is_trivially_copyable_v<StateExtendedBaseHeader>);
 
+// Follows the base header of compressed states. The payload is split into chunks that are
+// compressed independently, so that they can be compressed and decompressed in parallel.
+struct StateExtendedChunkHeader
+{
+  // The uncompressed size of every chunk but the last one
+  u32 chunk_size;
+  u32 chunk_count;
+  // Followed by the compressed size of each chunk as a u32
+};
+static_assert(sizeof(StateExtendedChunkHeader) == 8);
+static_assert(std::is_trivially_copyable_v<StateExtendedChunkHeader>);
+
 struct StateExtendedHeader
 {
   StateExtendedBaseHeader base_header;
-  // Feel free to add new fields here, adjusting COMPRESSED_DATA_OFFSET accordingly, as well as
-  // CreateExtendedHeader(). Add the appropriate IOFile read/write calls within LoadFileStateData()
-  // and WriteHeadersToFile()
+  // Only used for compressed states
+  StateExtendedChunkHeader chunk_header;
+  std::vector<u32> compressed_chunk_sizes;
+  // Feel free to add new fields here, as well as to CreateExtendedHeader(). Add the appropriate
+  // IOFile read/write calls within LoadFileStateData() and WriteHeadersToFile(), and include them
+  // in payload_offset.
 };
 
 void Init(Core::System& system);
@@ -106,6 +122,9 @@ void Load(Core::System& system, int slot);
 void SaveAs(Core::System& system, const std::string& filename, bool wait = false);
 void LoadAs(Core::System& system, const std::string& filename);
 
+// In-memory snapshots without the file headers and compression of the functions above.
+// SaveToBuffer serializes into the capacity the buffer already has when it's large enough, so
+// passing the same buffer again avoids both a reallocation and a measuring pass.
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
@@ -114,6 +133,13 @@ void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
 void UndoLoadState(Core::System& system);
 
+// Called by the CPU thread at the end of every frame. Every few frames (MAIN_REWIND_INTERVAL),
+// this snapshots the emulated system into the in-memory rewind buffer when rewinding is enabled.
+void CaptureRewindPoint(Core::System& system);
+// Loads the most recent rewind point and removes it from the buffer, so that calling this
+// repeatedly steps further back in time. Returns false if there was nothing to rewind to.
+bool Rewind(Core::System& system);
+
 // for calling back into UI code without introducing a dependency on it in core
 using AfterLoadCallbackFunc = std::function<void()>;
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback);
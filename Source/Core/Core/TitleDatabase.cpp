@@ -3,8 +3,8 @@
 
 #include "Core/TitleDatabase.h"
 
+#include <algorithm>
 #include <cstddef>
-#include <fstream>
 #include <functional>
 #include <string>
 #include <string_view>
@@ -30,22 +30,27 @@ static Map LoadMap(const std::string& file_path)
 {
   Map map;
 
-  std::ifstream txt;
-  File::OpenFStream(txt, file_path, std::ios::in);
+  // Reading the whole file at once and splitting it in place is a lot faster than reading it line
+  // by line through a stream, and these files have tens of thousands of lines.
+  std::string contents;
+  if (!File::ReadFileToString(file_path, contents))
+    return map;
 
-  std::string line;
-  while (std::getline(txt, line))
+  map.reserve(std::count(contents.begin(), contents.end(), '\n') + 1);
+
+  std::string_view remaining(contents);
+  while (!remaining.empty())
   {
-    if (line.empty())
-      continue;
+    const size_t line_end = remaining.find('\n');
+    const std::string_view line = remaining.substr(0, line_end);
+    remaining.remove_prefix(line_end == std::string_view::npos ? remaining.size() : line_end + 1);
 
     const size_t equals_index = line.find('=');
-    if (equals_index != std::string::npos)
+    if (equals_index != std::string_view::npos)
     {
-      const std::string_view line_view(line);
-      const std::string_view game_id = StripWhitespace(line_view.substr(0, equals_index));
+      const std::string_view game_id = StripWhitespace(line.substr(0, equals_index));
       if (game_id.length() >= 4)
-        map.emplace(game_id, StripWhitespace(line_view.substr(equals_index + 1)));
+        map.emplace(game_id, StripWhitespace(line.substr(equals_index + 1)));
     }
   }
   return map;
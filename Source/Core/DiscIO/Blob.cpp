@@ -12,12 +12,14 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "DiscIO/CISOBlob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DirectoryBlob.h"
 #include "DiscIO/FileBlob.h"
+#include "DiscIO/HttpBlob.h"
 #include "DiscIO/NFSBlob.h"
 #include "DiscIO/SplitFileBlob.h"
 #include "DiscIO/TGCBlob.h"
@@ -214,8 +216,35 @@ u32 SectorReader::ReadChunk(u8* buffer, u64 chunk_num)
   return 0;
 }
 
+static std::unique_ptr<BlobReader> CreateHttpBlobReader(const std::string& url)
+{
+  std::unique_ptr<HttpFileReader> reader = HttpFileReader::Create(url);
+  u32 magic;
+  if (!reader || !reader->Read(0, sizeof(magic), reinterpret_cast<u8*>(&magic)))
+    return nullptr;
+
+  // The readers for the other formats need a local file
+  switch (magic)
+  {
+  case CISO_MAGIC:
+  case GCZ_MAGIC:
+  case TGC_MAGIC:
+  case WBFS_MAGIC:
+  case WIA_MAGIC:
+  case RVZ_MAGIC:
+  case NFS_MAGIC:
+    ERROR_LOG_FMT(DISCIO, "Only plain disc images can be read over HTTP: {}", url);
+    return nullptr;
+  default:
+    return reader;
+  }
+}
+
 std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
 {
+  if (IsHttpUrl(filename))
+    return CreateHttpBlobReader(filename);
+
   File::IOFile file(filename, "rb");
   u32 magic;
   if (!file.ReadArray(&magic, 1))
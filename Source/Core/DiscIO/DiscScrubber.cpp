@@ -32,7 +32,7 @@ bool DiscScrubber::SetupScrub(const Volume& disc)
   const size_t num_clusters = static_cast<size_t>((m_file_size + CLUSTER_SIZE - 1) / CLUSTER_SIZE);
 
   // Table of free blocks
-  m_free_table.resize(num_clusters, 1);
+  m_free_table = std::make_shared<std::vector<bool>>(num_clusters, true);
 
   // Fill out table of free blocks
   const bool success = ParseDisc(disc);
@@ -47,21 +47,20 @@ bool DiscScrubber::CanBlockBeScrubbed(u64 offset) const
     return false;
 
   const u64 cluster_index = offset / CLUSTER_SIZE;
-  return cluster_index >= m_free_table.size() || m_free_table[cluster_index];
+  return cluster_index >= m_free_table->size() || (*m_free_table)[cluster_index];
 }
 
 void DiscScrubber::MarkAsUsed(u64 offset, u64 size)
 {
-  u64 current_offset = Common::AlignDown(offset, CLUSTER_SIZE);
   const u64 end_offset = offset + size;
 
   DEBUG_LOG_FMT(DISCIO, "Marking {:#018x} - {:#018x} as used", offset, end_offset);
 
-  while (current_offset < end_offset && current_offset < m_file_size)
-  {
-    m_free_table[current_offset / CLUSTER_SIZE] = 0;
-    current_offset += CLUSTER_SIZE;
-  }
+  const u64 first_cluster = offset / CLUSTER_SIZE;
+  const u64 end_cluster =
+      std::min<u64>((end_offset + CLUSTER_SIZE - 1) / CLUSTER_SIZE, m_free_table->size());
+  if (first_cluster < end_cluster)
+    std::fill(m_free_table->begin() + first_cluster, m_free_table->begin() + end_cluster, false);
 }
 
 void DiscScrubber::MarkAsUsedE(u64 partition_data_offset, u64 offset, u64 size)
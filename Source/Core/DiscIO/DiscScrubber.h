@@ -8,6 +8,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 #include "Common/CommonTypes.h"
@@ -45,7 +46,9 @@ private:
   bool ParsePartitionData(const Volume& disc, const Partition& partition);
   void ParseFileSystemData(u64 partition_data_offset, const FileInfo& directory);
 
-  std::vector<u8> m_free_table;
+  // One bit per cluster, set if the cluster is unused. It isn't modified after SetupScrub(), so
+  // copies of the scrubber (such as one per conversion thread) share it.
+  std::shared_ptr<std::vector<bool>> m_free_table;
   u64 m_file_size = 0;
   bool m_has_wii_hashes = false;
   bool m_is_scrubbing = false;
@@ -4,20 +4,83 @@
 #include "DiscIO/FileBlob.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _WIN32
+#include <Windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 
 namespace DiscIO
 {
+// Reads at least this large tell the OS to start reading all of the range from the disk at once,
+// rather than one page fault at a time.
+constexpr u64 PREFETCH_THRESHOLD = 0x10000;
+
 PlainFileReader::PlainFileReader(File::IOFile file) : m_file(std::move(file))
 {
   m_size = m_file.GetSize();
+  MapFile();
+}
+
+PlainFileReader::~PlainFileReader()
+{
+  UnmapFile();
+}
+
+void PlainFileReader::MapFile()
+{
+  if (m_size == 0)
+    return;
+
+#ifdef _WIN32
+  const HANDLE file_handle =
+      reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file.GetHandle())));
+  if (file_handle == INVALID_HANDLE_VALUE)
+    return;
+
+  m_mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_mapping_handle)
+    return;
+
+  m_mapped_data = static_cast<u8*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+  if (!m_mapped_data)
+  {
+    CloseHandle(m_mapping_handle);
+    m_mapping_handle = nullptr;
+  }
+#else
+  void* const mapping =
+      mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fileno(m_file.GetHandle()), 0);
+  if (mapping != MAP_FAILED)
+    m_mapped_data = static_cast<u8*>(mapping);
+#endif
+}
+
+void PlainFileReader::UnmapFile()
+{
+  if (!m_mapped_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_mapped_data);
+  CloseHandle(m_mapping_handle);
+  m_mapping_handle = nullptr;
+#else
+  munmap(m_mapped_data, m_size);
+#endif
+  m_mapped_data = nullptr;
 }
 
 std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
@@ -35,6 +98,28 @@ std::unique_ptr<BlobReader> PlainFileReader::CopyReader() const
 
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (m_mapped_data)
+  {
+    if (offset > m_size || nbytes > m_size - offset)
+      return false;
+
+    if (nbytes >= PREFETCH_THRESHOLD)
+    {
+#ifdef _WIN32
+      WIN32_MEMORY_RANGE_ENTRY range{m_mapped_data + offset, static_cast<SIZE_T>(nbytes)};
+      PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+      // madvise requires a page aligned address.
+      static const u64 page_size = static_cast<u64>(sysconf(_SC_PAGESIZE));
+      const u64 aligned_offset = offset - offset % page_size;
+      madvise(m_mapped_data + aligned_offset, offset + nbytes - aligned_offset, MADV_WILLNEED);
+#endif
+    }
+
+    std::memcpy(out_ptr, m_mapped_data + offset, nbytes);
+    return true;
+  }
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
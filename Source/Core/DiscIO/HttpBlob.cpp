@@ -0,0 +1,216 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/HttpBlob.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "Common/Align.h"
+#include "Common/CommonPaths.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/HttpRequest.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace DiscIO
+{
+constexpr u32 SECTOR_SIZE = 0x800;
+// Each request downloads one chunk, so this also works as read-ahead for small reads
+constexpr u32 CHUNK_SIZE = 0x80000;
+constexpr auto REQUEST_TIMEOUT = std::chrono::seconds(30);
+
+bool IsHttpUrl(std::string_view path)
+{
+  return path.starts_with("http://") || path.starts_with("https://");
+}
+
+// HTTP/2 and later send header names in lowercase
+static std::string GetHeaderValue(const Common::HttpRequest& request, std::string_view name)
+{
+  std::string value = request.GetHeaderValue(name);
+  if (value.empty())
+  {
+    std::string lowercase_name(name);
+    Common::ToLower(&lowercase_name);
+    value = request.GetHeaderValue(lowercase_name);
+  }
+  return value;
+}
+
+HttpFileReader::HttpFileReader(std::unique_ptr<Common::HttpRequest> request, std::string url,
+                               u64 size, const std::string& validator)
+    : m_request(std::move(request)), m_url(std::move(url)), m_size(size),
+      m_cached_chunks(Common::AlignUp(size, CHUNK_SIZE) / CHUNK_SIZE)
+{
+  SetSectorSize(SECTOR_SIZE);
+  SetChunkSize(CHUNK_SIZE / SECTOR_SIZE);
+
+  // The server's validator is part of the name, so a changed file doesn't reuse the old cache
+  const Common::SHA1::Digest digest =
+      Common::SHA1::CalculateDigest(fmt::format("{}\n{}\n{}", m_url, m_size, validator));
+  const std::string cache_path =
+      fmt::format("{}HttpDiscs/{:02x}", File::GetUserPath(D_CACHE_IDX),
+                  fmt::join(digest.begin(), digest.begin() + 8, ""));
+  if (!File::CreateFullPath(cache_path))
+    return;
+
+  const bool cache_exists = File::Exists(cache_path + ".bin") && File::Exists(cache_path + ".map");
+  m_cache_file.Open(cache_path + ".bin", cache_exists ? "r+b" : "w+b");
+  m_cache_map_file.Open(cache_path + ".map", cache_exists ? "r+b" : "w+b");
+  if (!m_cache_file.IsOpen() || !m_cache_map_file.IsOpen())
+  {
+    WARN_LOG_FMT(DISCIO, "Can't open the cache for {}, every read will be downloaded", m_url);
+    m_cache_file.Close();
+    m_cache_map_file.Close();
+    return;
+  }
+
+  if (cache_exists)
+  {
+    // A map that is too short just means that the last chunks haven't been downloaded
+    size_t bytes_read = 0;
+    m_cache_map_file.ReadArray(m_cached_chunks.data(), m_cached_chunks.size(), &bytes_read);
+    std::fill(m_cached_chunks.begin() + bytes_read, m_cached_chunks.end(), 0);
+  }
+}
+
+std::unique_ptr<HttpFileReader> HttpFileReader::Create(const std::string& url)
+{
+  auto request = std::make_unique<Common::HttpRequest>(REQUEST_TIMEOUT);
+  if (!request->IsValid())
+    return nullptr;
+  request->FollowRedirects(5);
+
+  // This both checks that the server supports range requests and gets the size of the file
+  if (!request->Get(url, {{"Range", "bytes=0-0"}}, Common::HttpRequest::AllowedReturnCodes::All) ||
+      request->GetLastResponseCode() != 206)
+  {
+    ERROR_LOG_FMT(DISCIO, "{} can't be read with range requests", url);
+    return nullptr;
+  }
+
+  const std::string content_range = GetHeaderValue(*request, "Content-Range");
+  const size_t slash_position = content_range.rfind('/');
+  u64 size;
+  if (slash_position == std::string::npos ||
+      !TryParse(content_range.substr(slash_position + 1), &size) || size == 0)
+  {
+    ERROR_LOG_FMT(DISCIO, "Unexpected Content-Range \"{}\" for {}", content_range, url);
+    return nullptr;
+  }
+
+  std::string validator = GetHeaderValue(*request, "ETag");
+  if (validator.empty())
+    validator = GetHeaderValue(*request, "Last-Modified");
+
+  return std::unique_ptr<HttpFileReader>(
+      new HttpFileReader(std::move(request), url, size, validator));
+}
+
+std::unique_ptr<BlobReader> HttpFileReader::CopyReader() const
+{
+  return Create(m_url);
+}
+
+bool HttpFileReader::GetBlock(u64 block_num, u8* out)
+{
+  return ReadMultipleAlignedBlocks(block_num, 1, out);
+}
+
+bool HttpFileReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  u64 offset = block_num * SECTOR_SIZE;
+  u64 size = num_blocks * SECTOR_SIZE;
+  if (offset + size > Common::AlignUp(m_size, SECTOR_SIZE))
+    return false;
+
+  // SectorReader reads whole chunks, so this is usually a single iteration without a copy
+  std::vector<u8> chunk_buffer;
+  while (size > 0)
+  {
+    const u64 chunk = offset / CHUNK_SIZE;
+    const u64 offset_in_chunk = offset % CHUNK_SIZE;
+    const u64 bytes_to_copy = std::min<u64>(size, CHUNK_SIZE - offset_in_chunk);
+
+    if (offset_in_chunk == 0 && bytes_to_copy == CHUNK_SIZE)
+    {
+      if (!ReadChunk(chunk, out_ptr))
+        return false;
+    }
+    else
+    {
+      chunk_buffer.resize(CHUNK_SIZE);
+      if (!ReadChunk(chunk, chunk_buffer.data()))
+        return false;
+      std::memcpy(out_ptr, chunk_buffer.data() + offset_in_chunk, bytes_to_copy);
+    }
+
+    offset += bytes_to_copy;
+    size -= bytes_to_copy;
+    out_ptr += bytes_to_copy;
+  }
+
+  return true;
+}
+
+// Fills a whole CHUNK_SIZE buffer. The last chunk is zero-padded past the end of the file.
+bool HttpFileReader::ReadChunk(u64 chunk, u8* out)
+{
+  const u64 offset = chunk * CHUNK_SIZE;
+  const u64 size = std::min<u64>(CHUNK_SIZE, m_size - offset);
+  std::fill(out + size, out + CHUNK_SIZE, 0);
+
+  if (m_cache_file.IsOpen() && m_cached_chunks[chunk])
+  {
+    if (m_cache_file.Seek(offset, File::SeekOrigin::Begin) && m_cache_file.ReadBytes(out, size))
+      return true;
+
+    WARN_LOG_FMT(DISCIO, "Failed to read chunk {} of {} from the cache", chunk, m_url);
+  }
+
+  if (!Download(offset, size, out))
+    return false;
+
+  if (m_cache_file.IsOpen())
+  {
+    // The data has to be written before the chunk is marked as present, in case Dolphin stops
+    // in between
+    const u8 present = 1;
+    if (m_cache_file.Seek(offset, File::SeekOrigin::Begin) && m_cache_file.WriteBytes(out, size) &&
+        m_cache_file.Flush() && m_cache_map_file.Seek(chunk, File::SeekOrigin::Begin) &&
+        m_cache_map_file.WriteBytes(&present, 1) && m_cache_map_file.Flush())
+    {
+      m_cached_chunks[chunk] = present;
+    }
+  }
+
+  return true;
+}
+
+bool HttpFileReader::Download(u64 offset, u64 size, u8* out)
+{
+  const Common::HttpRequest::Response response =
+      m_request->Get(m_url, {{"Range", fmt::format("bytes={}-{}", offset, offset + size - 1)}},
+                     Common::HttpRequest::AllowedReturnCodes::All);
+  if (!response || m_request->GetLastResponseCode() != 206 || response->size() != size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Failed to download {:#x} bytes at {:#x} of {}", size, offset, m_url);
+    return false;
+  }
+
+  std::copy(response->begin(), response->end(), out);
+  return true;
+}
+
+}  // namespace DiscIO
@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HttpRequest.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+
+namespace DiscIO
+{
+bool IsHttpUrl(std::string_view path);
+
+// Reads a plain disc image from a web server using range requests. Everything that has been
+// downloaded is kept in a sparse file in the cache directory, so only the parts of the disc that
+// are actually read get downloaded, and each of them only once.
+class HttpFileReader final : public SectorReader
+{
+public:
+  static std::unique_ptr<HttpFileReader> Create(const std::string& url);
+
+  BlobType GetBlobType() const override { return BlobType::PLAIN; }
+  std::unique_ptr<BlobReader> CopyReader() const override;
+
+  u64 GetRawSize() const override { return m_size; }
+  u64 GetDataSize() const override { return m_size; }
+  DataSizeType GetDataSizeType() const override { return DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return 0; }
+  bool HasFastRandomAccessInBlock() const override { return false; }
+  std::string GetCompressionMethod() const override { return {}; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+private:
+  HttpFileReader(std::unique_ptr<Common::HttpRequest> request, std::string url, u64 size,
+                 const std::string& validator);
+
+  bool GetBlock(u64 block_num, u8* out) override;
+  bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
+
+  bool ReadChunk(u64 chunk, u8* out);
+  bool Download(u64 offset, u64 size, u8* out);
+
+  std::unique_ptr<Common::HttpRequest> m_request;
+  std::string m_url;
+  u64 m_size;
+
+  File::IOFile m_cache_file;
+  // One byte per chunk rather than a bitmap, so that several readers of the same URL never have
+  // to read, modify and write back each other's bits.
+  File::IOFile m_cache_map_file;
+  std::vector<u8> m_cached_chunks;
+};
+
+}  // namespace DiscIO
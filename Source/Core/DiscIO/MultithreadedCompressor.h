@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -14,6 +15,8 @@
 #include "Common/Assert.h"
 #include "Common/Event.h"
 #include "Common/Result.h"
+#include "Common/Semaphore.h"
+#include "Common/Thread.h"
 
 namespace DiscIO
 {
@@ -29,6 +32,15 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = Common::Result<ConversionResultCode, T>;
 
+// Shared by all MultithreadedCompressors, so that running several conversions at once doesn't
+// compress on more threads than there are CPU cores.
+inline Common::Semaphore& GetCompressionSlots()
+{
+  static const int count = std::max<int>(1, std::thread::hardware_concurrency());
+  static Common::Semaphore slots(count, count);
+  return slots;
+}
+
 // This class starts a number of compression threads and one output thread.
 // The set_up_compress_thread_state function is called at the start of each compression thread.
 // When CompressAndWrite is called, the compress function will be called on one of the
@@ -48,7 +60,8 @@ public:
       std::function<ConversionResultCode(OutputParameters)> output)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()) *
+                  THREADS_PER_COMPRESSION_SLOT)
   {
     m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
 
@@ -119,6 +132,12 @@ public:
   }
 
 private:
+  // Each compression thread can only hold one finished result, and results are output in order.
+  // Starting more threads than there are compression slots lets the threads that aren't
+  // compressing hold finished results, so one slow group doesn't stop all the others from being
+  // compressed while the output thread waits for it.
+  static constexpr unsigned int THREADS_PER_COMPRESSION_SLOT = 2;
+
   struct CompressThread
   {
     std::thread thread;
@@ -135,6 +154,8 @@ private:
 
   void CompressThreadFunction(CompressThread* state)
   {
+    Common::SetCurrentThreadRole(Common::ThreadRole::Background);
+
     CompressThreadState compress_thread_state;
 
     ConversionResultCode setup_result = m_set_up_compress_thread_state(&compress_thread_state);
@@ -156,8 +177,10 @@ private:
       state->compress_done_event.Reset();
       state->compress_ready_event.Set();
 
+      GetCompressionSlots().Wait();
       ConversionResult<OutputParameters> result =
           m_compress(&compress_thread_state, std::move(parameters));
+      GetCompressionSlots().Post();
 
       if (result)
       {
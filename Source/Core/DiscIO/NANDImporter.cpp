@@ -15,9 +15,16 @@
 
 namespace DiscIO
 {
-constexpr size_t NAND_SIZE = 0x20000000;
+constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
+constexpr size_t NAND_BLOCK_SIZE = 0x800;
+constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
+constexpr size_t NAND_BIN_SIZE =
+    (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
 constexpr size_t NAND_KEYS_SIZE = 0x400;
 
+constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+constexpr size_t NAND_BLOCKS_PER_FAT_BLOCK = NAND_FAT_BLOCK_SIZE / NAND_BLOCK_SIZE;
+
 NANDImporter::NANDImporter() : m_nand_root(File::GetUserPath(D_WIIROOT_IDX))
 {
 }
@@ -36,41 +43,22 @@ void NANDImporter::ImportNANDBin(const std::string& path_to_bin,
 
   ExportKeys();
   ProcessEntry(0, "");
+  m_nand.Close();
   ExtractCertificates();
 }
 
 bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
                                std::function<std::string()> get_otp_dump_path)
 {
-  constexpr size_t NAND_TOTAL_BLOCKS = 0x40000;
-  constexpr size_t NAND_BLOCK_SIZE = 0x800;
-  constexpr size_t NAND_ECC_BLOCK_SIZE = 0x40;
-  constexpr size_t NAND_BIN_SIZE =
-      (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_TOTAL_BLOCKS;  // 0x21000000
-
-  File::IOFile file(path_to_bin, "rb");
-  const u64 image_size = file.GetSize();
+  m_nand.Open(path_to_bin, "rb");
+  const u64 image_size = m_nand.GetSize();
   if (image_size != NAND_BIN_SIZE + NAND_KEYS_SIZE && image_size != NAND_BIN_SIZE)
   {
     PanicAlertFmtT("This file does not look like a BootMii NAND backup.");
     return false;
   }
 
-  m_nand.resize(NAND_SIZE);
-
-  for (size_t i = 0; i < NAND_TOTAL_BLOCKS; i++)
-  {
-    // Instead of updating on every cycle, we only update every 1000 cycles for a balance between
-    // not updating fast enough vs updating too fast
-    if (i % 1000 == 0)
-      m_update_callback();
-
-    file.ReadBytes(&m_nand[i * NAND_BLOCK_SIZE], NAND_BLOCK_SIZE);
-
-    // We don't care about the ECC blocks
-    file.Seek(NAND_ECC_BLOCK_SIZE, File::SeekOrigin::Current);
-  }
-
+  m_raw_cluster.resize((NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE) * NAND_BLOCKS_PER_FAT_BLOCK);
   m_nand_keys.resize(NAND_KEYS_SIZE);
 
   // Read the OTP/SEEPROM dump.
@@ -85,21 +73,51 @@ bool NANDImporter::ReadNANDBin(const std::string& path_to_bin,
   }
 
   // Otherwise, just read the key data from the NAND image.
-  return file.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
+  return m_nand.Seek(NAND_BIN_SIZE, File::SeekOrigin::Begin) &&
+         m_nand.ReadBytes(m_nand_keys.data(), NAND_KEYS_SIZE);
+}
+
+bool NANDImporter::ReadCluster(u16 cluster, u8* data)
+{
+  // Each cluster is stored as consecutive blocks, which are each followed by ECC data that we
+  // don't care about.
+  const u64 offset = static_cast<u64>(cluster) * m_raw_cluster.size();
+  if (!m_nand.Seek(offset, File::SeekOrigin::Begin) ||
+      !m_nand.ReadBytes(m_raw_cluster.data(), m_raw_cluster.size()))
+  {
+    ERROR_LOG_FMT(DISCIO, "Failed to read cluster {:#x} of the NAND image", cluster);
+    return false;
+  }
+
+  for (size_t i = 0; i < NAND_BLOCKS_PER_FAT_BLOCK; i++)
+  {
+    std::memcpy(data + i * NAND_BLOCK_SIZE,
+                &m_raw_cluster[i * (NAND_BLOCK_SIZE + NAND_ECC_BLOCK_SIZE)], NAND_BLOCK_SIZE);
+  }
+
+  return true;
 }
 
 bool NANDImporter::FindSuperblock()
 {
   constexpr size_t NAND_SUPERBLOCK_START = 0x1fc00000;
+  constexpr size_t SUPERBLOCK_CLUSTERS = sizeof(NANDSuperblock) / NAND_FAT_BLOCK_SIZE;
 
   // There are 16 superblocks, choose the highest/newest version
   for (int i = 0; i < 16; i++)
   {
     auto superblock = std::make_unique<NANDSuperblock>();
-    std::memcpy(superblock.get(), &m_nand[NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock)],
-                sizeof(NANDSuperblock));
+    u8* superblock_data = reinterpret_cast<u8*>(superblock.get());
+    const size_t first_cluster =
+        (NAND_SUPERBLOCK_START + i * sizeof(NANDSuperblock)) / NAND_FAT_BLOCK_SIZE;
+    bool read_ok = true;
+    for (size_t j = 0; j < SUPERBLOCK_CLUSTERS && read_ok; j++)
+    {
+      read_ok = ReadCluster(static_cast<u16>(first_cluster + j),
+                            superblock_data + j * NAND_FAT_BLOCK_SIZE);
+    }
 
-    if (std::memcmp(superblock->magic.data(), "SFFS", 4) != 0)
+    if (!read_ok || std::memcmp(superblock->magic.data(), "SFFS", 4) != 0)
     {
       ERROR_LOG_FMT(DISCIO, "Superblock #{} does not exist", i);
       continue;
@@ -150,9 +168,7 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
     Type type = static_cast<Type>(entry.mode & 3);
     if (type == Type::File)
     {
-      std::vector<u8> data = GetEntryData(entry);
-      File::IOFile file(m_nand_root + path, "wb");
-      file.WriteBytes(data.data(), data.size());
+      ExtractEntryData(entry, m_nand_root + path);
     }
     else if (type == Type::Directory)
     {
@@ -168,34 +184,45 @@ void NANDImporter::ProcessEntry(u16 entry_number, const std::string& parent_path
   }
 }
 
-std::vector<u8> NANDImporter::GetEntryData(const NANDFSTEntry& entry)
+bool NANDImporter::ExtractEntryData(const NANDFSTEntry& entry, const std::string& path)
 {
-  constexpr size_t NAND_FAT_BLOCK_SIZE = 0x4000;
+  File::IOFile file(path, "wb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(DISCIO, "Failed to create file {}", path);
+    return false;
+  }
 
   u16 sub = entry.sub;
   size_t remaining_bytes = entry.size;
-  std::vector<u8> data{};
-  data.reserve(remaining_bytes);
 
+  auto encrypted_block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
   auto block = std::make_unique<u8[]>(NAND_FAT_BLOCK_SIZE);
   while (remaining_bytes > 0)
   {
     if (sub >= m_superblock->fat.size())
     {
       ERROR_LOG_FMT(DISCIO, "FAT block index {} out of range", sub);
-      return {};
+      return false;
     }
 
-    m_aes_ctx->CryptIvZero(&m_nand[NAND_FAT_BLOCK_SIZE * sub], block.get(), NAND_FAT_BLOCK_SIZE);
+    if (!ReadCluster(sub, encrypted_block.get()))
+      return false;
+
+    m_aes_ctx->CryptIvZero(encrypted_block.get(), block.get(), NAND_FAT_BLOCK_SIZE);
 
     size_t size = std::min(remaining_bytes, NAND_FAT_BLOCK_SIZE);
-    data.insert(data.end(), block.get(), block.get() + size);
+    if (!file.WriteBytes(block.get(), size))
+    {
+      ERROR_LOG_FMT(DISCIO, "Failed to write to file {}", path);
+      return false;
+    }
     remaining_bytes -= size;
 
     sub = m_superblock->fat[sub];
   }
 
-  return data;
+  return true;
 }
 
 bool NANDImporter::ExtractCertificates()
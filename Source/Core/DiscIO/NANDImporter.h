@@ -13,6 +13,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
+#include "Common/IOFile.h"
 #include "Common/Swap.h"
 
 namespace DiscIO
@@ -69,11 +70,14 @@ private:
   std::string GetPath(const NANDFSTEntry& entry, const std::string& parent_path);
   std::string FormatDebugString(const NANDFSTEntry& entry);
   void ProcessEntry(u16 entry_number, const std::string& parent_path);
-  std::vector<u8> GetEntryData(const NANDFSTEntry& entry);
+  bool ReadCluster(u16 cluster, u8* data);
+  bool ExtractEntryData(const NANDFSTEntry& entry, const std::string& path);
   void ExportKeys();
 
   std::string m_nand_root;
-  std::vector<u8> m_nand;
+  // The NAND is read from the image one cluster at a time rather than being loaded as a whole.
+  File::IOFile m_nand;
+  std::vector<u8> m_raw_cluster;
   std::vector<u8> m_nand_keys;
   std::unique_ptr<Common::AES::Context> m_aes_ctx;
   std::unique_ptr<NANDSuperblock> m_superblock;
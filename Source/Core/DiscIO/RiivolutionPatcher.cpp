@@ -130,13 +130,12 @@ FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relativ
         result.erase(result.size() - element.size(), element.size());
 
         // Re-attach an element that actually matches the capitalization in the host filesystem.
-        auto possible_files = ::File::ScanDirectoryTree(result, false);
         bool found = false;
-        for (auto& f : possible_files.children)
+        for (const std::string& name : GetDirectoryListing(result))
         {
-          if (Common::CaseInsensitiveEquals(element, f.virtualName))
+          if (Common::CaseInsensitiveEquals(element, name))
           {
-            result += f.virtualName;
+            result += name;
             found = true;
             break;
           }
@@ -162,10 +161,34 @@ FileDataLoaderHostFS::MakeAbsoluteFromRelative(std::string_view external_relativ
   return result;
 }
 
+std::optional<std::string>
+FileDataLoaderHostFS::ResolvePath(std::string_view external_relative_path)
+{
+  const auto it = m_resolved_paths.find(external_relative_path);
+  if (it != m_resolved_paths.end())
+    return it->second;
+
+  std::optional<std::string> path = MakeAbsoluteFromRelative(external_relative_path);
+  m_resolved_paths.emplace(external_relative_path, path);
+  return path;
+}
+
+const std::vector<std::string>& FileDataLoaderHostFS::GetDirectoryListing(const std::string& path)
+{
+  const auto it = m_directory_listings.find(path);
+  if (it != m_directory_listings.end())
+    return it->second;
+
+  std::vector<std::string> names;
+  for (::File::FSTEntry& entry : ::File::ScanDirectoryTree(path, false).children)
+    names.push_back(std::move(entry.virtualName));
+  return m_directory_listings.emplace(path, std::move(names)).first->second;
+}
+
 std::optional<u64>
 FileDataLoaderHostFS::GetExternalFileSize(std::string_view external_relative_path)
 {
-  auto path = MakeAbsoluteFromRelative(external_relative_path);
+  auto path = ResolvePath(external_relative_path);
   if (!path)
     return std::nullopt;
   ::File::FileInfo f(*path);
@@ -176,7 +199,7 @@ FileDataLoaderHostFS::GetExternalFileSize(std::string_view external_relative_pat
 
 std::vector<u8> FileDataLoaderHostFS::GetFileContents(std::string_view external_relative_path)
 {
-  auto path = MakeAbsoluteFromRelative(external_relative_path);
+  auto path = ResolvePath(external_relative_path);
   if (!path)
     return {};
   ::File::IOFile f(*path, "rb");
@@ -193,7 +216,7 @@ std::vector<u8> FileDataLoaderHostFS::GetFileContents(std::string_view external_
 std::vector<FileDataLoader::Node>
 FileDataLoaderHostFS::GetFolderContents(std::string_view external_relative_path)
 {
-  auto path = MakeAbsoluteFromRelative(external_relative_path);
+  auto path = ResolvePath(external_relative_path);
   if (!path)
     return {};
   ::File::FSTEntry external_files = ::File::ScanDirectoryTree(*path, false);
@@ -208,7 +231,7 @@ BuilderContentSource
 FileDataLoaderHostFS::MakeContentSource(std::string_view external_relative_path,
                                         u64 external_offset, u64 external_size, u64 disc_offset)
 {
-  auto path = MakeAbsoluteFromRelative(external_relative_path);
+  auto path = ResolvePath(external_relative_path);
   if (!path)
     return BuilderContentSource{disc_offset, external_size, ContentFixedByte{0}};
   return BuilderContentSource{disc_offset, external_size,
@@ -218,7 +241,7 @@ FileDataLoaderHostFS::MakeContentSource(std::string_view external_relative_path,
 std::optional<std::string>
 FileDataLoaderHostFS::ResolveSavegameRedirectPath(std::string_view external_relative_path)
 {
-  return MakeAbsoluteFromRelative(external_relative_path);
+  return ResolvePath(external_relative_path);
 }
 
 // 'before' and 'after' should be two copies of the same source
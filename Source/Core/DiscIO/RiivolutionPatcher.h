@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <optional>
 #include <span>
 #include <string>
@@ -66,9 +67,16 @@ public:
 
 private:
   std::optional<std::string> MakeAbsoluteFromRelative(std::string_view external_relative_path);
+  std::optional<std::string> ResolvePath(std::string_view external_relative_path);
+  const std::vector<std::string>& GetDirectoryListing(const std::string& path);
 
   std::string m_sd_root;
   std::string m_patch_root;
+
+  // Folder patches resolve every file of a mod, usually more than once, so resolved paths and the
+  // directory listings used for matching capitalization are kept around.
+  std::map<std::string, std::optional<std::string>, std::less<>> m_resolved_paths;
+  std::map<std::string, std::vector<std::string>> m_directory_listings;
 };
 
 enum class PatchIndex
@@ -359,13 +359,30 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
 
+// WIA and RVZ decompress the groups of a read spanning several groups in parallel, so reads from
+// them should span several groups.
+constexpr u64 PARALLEL_READ_GROUPS = 8;
+
+// The blocks of a group are checked in this many slices at the same time.
+constexpr size_t BLOCK_CHECK_SLICES = 4;
+
+static u64 GetReadSize(const Volume& volume)
+{
+  const BlobType blob_type = volume.GetBlobType();
+  if (blob_type != BlobType::WIA && blob_type != BlobType::RVZ)
+    return DEFAULT_READ_SIZE;
+
+  return std::max(DEFAULT_READ_SIZE, volume.GetBlobReader().GetBlockSize() * PARALLEL_READ_GROUPS);
+}
+
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
     : m_volume(volume), m_redump_verification(redump_verification),
       m_hashes_to_calculate(hashes_to_calculate),
       m_calculating_any_hash(hashes_to_calculate.crc32 || hashes_to_calculate.md5 ||
                              hashes_to_calculate.sha1),
-      m_max_progress(volume.GetDataSize()), m_data_size_type(volume.GetDataSizeType())
+      m_read_size(GetReadSize(volume)), m_max_progress(volume.GetDataSize()),
+      m_data_size_type(volume.GetDataSizeType())
 {
   if (!m_calculating_any_hash)
     m_redump_verification = false;
@@ -1128,7 +1145,7 @@ void VolumeVerifier::Process()
   IOS::ES::Content content{};
   bool content_read = false;
   bool group_read = false;
-  u64 bytes_to_read = DEFAULT_READ_SIZE;
+  u64 bytes_to_read = m_read_size;
   u64 excess_bytes = 0;
   if (m_content_index < m_content_offsets.size() &&
       m_content_offsets[m_content_index] == m_progress)
@@ -1243,14 +1260,44 @@ void VolumeVerifier::Process()
     m_group_future = std::async(std::launch::async, [this, read_failed,
                                                      group_index = m_group_index] {
       const GroupToVerify& group = m_groups[group_index];
+      const size_t block_count = group.block_index_end - group.block_index_start;
+      // Not std::vector<bool>, so that the threads below write to separate bytes
+      std::vector<u8> block_is_valid(block_count, false);
+
+      const auto check_blocks = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {
+          block_is_valid[i] = m_volume.CheckBlockIntegrity(
+              group.block_index_start + i, m_data.data() + i * VolumeWii::BLOCK_TOTAL_SIZE,
+              group.partition);
+        }
+      };
+
+      if (!read_failed && block_count > 0)
+      {
+        // The first check sets up the partition's lazily loaded key and H3 table, which must not
+        // happen on several threads at once, so it's done before the other threads are started.
+        check_blocks(0, 1);
+
+        const size_t slice_size = Common::AlignUp(block_count - 1, BLOCK_CHECK_SLICES) /
+                                  BLOCK_CHECK_SLICES;
+        std::vector<std::future<void>> futures;
+        for (size_t start = 1; start + slice_size < block_count; start += slice_size)
+        {
+          futures.push_back(
+              std::async(std::launch::async, check_blocks, start, start + slice_size));
+        }
+        check_blocks(1 + futures.size() * slice_size, block_count);
+        for (std::future<void>& future : futures)
+          future.wait();
+      }
+
       u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+      for (size_t i = 0; i < block_count; ++i, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
       {
         const u64 block_offset = group.offset + offset_in_group;
 
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
+        if (block_is_valid[i])
         {
           m_biggest_verified_offset =
               std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
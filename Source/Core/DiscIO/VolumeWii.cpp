@@ -37,7 +37,7 @@ namespace DiscIO
 {
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
     : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
-      m_last_decrypted_block(UINT64_MAX)
+      m_decrypted_blocks(DECRYPTED_BLOCK_CACHE_SIZE)
 {
   ASSERT(m_reader);
 
@@ -161,6 +161,8 @@ VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
 
 VolumeWii::~VolumeWii()
 {
+  INFO_LOG_FMT(DISCIO, "Decrypted block cache: {} hits, {} misses", m_decrypted_block_cache_hits,
+               m_decrypted_block_cache_misses);
 }
 
 bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partition) const
@@ -186,14 +188,11 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   }
 
   Common::AES::Context* aes_context = nullptr;
-  std::unique_ptr<u8[]> read_buffer = nullptr;
   if (m_has_encryption)
   {
     aes_context = partition_details.key->get();
     if (!aes_context)
       return false;
-
-    read_buffer = std::make_unique<u8[]>(BLOCK_TOTAL_SIZE);
   }
 
   while (length > 0)
@@ -202,34 +201,13 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
     u64 block_offset_on_disc = partition_data_offset + offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
 
-    if (m_last_decrypted_block != block_offset_on_disc)
-    {
-      if (m_has_encryption)
-      {
-        // Read the current block
-        if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.get()))
-          return false;
-
-        // Decrypt the block's data
-        DecryptBlockData(read_buffer.get(), m_last_decrypted_block_data, aes_context);
-      }
-      else
-      {
-        // Read the current block
-        if (!m_reader->Read(block_offset_on_disc + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE,
-                            m_last_decrypted_block_data))
-        {
-          return false;
-        }
-      }
-
-      m_last_decrypted_block = block_offset_on_disc;
-    }
+    const DecryptedBlock* block = GetDecryptedBlock(block_offset_on_disc, aes_context);
+    if (!block)
+      return false;
 
     // Copy the decrypted data
     u64 copy_size = std::min(length, BLOCK_DATA_SIZE - data_offset_in_block);
-    memcpy(buffer, &m_last_decrypted_block_data[data_offset_in_block],
-           static_cast<size_t>(copy_size));
+    memcpy(buffer, &block->data[data_offset_in_block], static_cast<size_t>(copy_size));
 
     // Update offsets
     length -= copy_size;
@@ -240,6 +218,52 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
   return true;
 }
 
+const VolumeWii::DecryptedBlock*
+VolumeWii::GetDecryptedBlock(u64 block_offset_on_disc, Common::AES::Context* aes_context) const
+{
+  DecryptedBlock* least_recently_used = &m_decrypted_blocks.front();
+  for (DecryptedBlock& block : m_decrypted_blocks)
+  {
+    if (block.offset_on_disc == block_offset_on_disc)
+    {
+      ++m_decrypted_block_cache_hits;
+      block.last_used = ++m_decrypted_block_use_counter;
+      return &block;
+    }
+
+    if (block.last_used < least_recently_used->last_used)
+      least_recently_used = &block;
+  }
+
+  ++m_decrypted_block_cache_misses;
+  DecryptedBlock& block = *least_recently_used;
+  block.offset_on_disc = UINT64_MAX;
+
+  if (m_has_encryption)
+  {
+    // Read the current block
+    auto read_buffer = std::make_unique<u8[]>(BLOCK_TOTAL_SIZE);
+    if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.get()))
+      return nullptr;
+
+    // Decrypt the block's data
+    DecryptBlockData(read_buffer.get(), block.data.data(), aes_context);
+  }
+  else
+  {
+    // Read the current block
+    if (!m_reader->Read(block_offset_on_disc + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE,
+                        block.data.data()))
+    {
+      return nullptr;
+    }
+  }
+
+  block.offset_on_disc = block_offset_on_disc;
+  block.last_used = ++m_decrypted_block_use_counter;
+  return &block;
+}
+
 bool VolumeWii::HasWiiHashes() const
 {
   return m_has_hashes;
@@ -131,8 +131,23 @@ private:
   bool m_has_hashes;
   bool m_has_encryption;
 
-  mutable u64 m_last_decrypted_block;
-  mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE]{};
+  // Small files which get read over and over, like sound banks, would otherwise be read back and
+  // decrypted again on every read. Any user of the volume, including verification and extraction,
+  // goes through this cache.
+  static constexpr size_t DECRYPTED_BLOCK_CACHE_SIZE = 64;
+  struct DecryptedBlock
+  {
+    u64 offset_on_disc = UINT64_MAX;
+    u64 last_used = 0;
+    std::array<u8, BLOCK_DATA_SIZE> data;
+  };
+  const DecryptedBlock* GetDecryptedBlock(u64 block_offset_on_disc,
+                                          Common::AES::Context* aes_context) const;
+
+  mutable std::vector<DecryptedBlock> m_decrypted_blocks;
+  mutable u64 m_decrypted_block_use_counter = 0;
+  mutable u64 m_decrypted_block_cache_hits = 0;
+  mutable u64 m_decrypted_block_cache_misses = 0;
 };
 
 }  // namespace DiscIO
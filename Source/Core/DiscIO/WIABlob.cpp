@@ -6,11 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <future>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -500,6 +502,14 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   data_offset -= skipped_data;
   data_size += skipped_data;
 
+  // The hash exceptions have to be gathered in order, so only plain reads are parallelized.
+  if (!m_write_to_exception_list &&
+      !ReadFromGroupsInParallel(offset, size, out_ptr, chunk_size, data_offset, data_size,
+                                group_index, number_of_groups, exception_lists))
+  {
+    return false;
+  }
+
   const u64 start_group_index = (*offset - data_offset) / chunk_size;
   for (u64 i = start_group_index; i < number_of_groups && (*size) > 0; ++i)
   {
@@ -514,19 +524,10 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
-
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
+    u32 group_data_size;
+    u32 rvz_packed_size;
+    const WIARVZCompressionType compression_type =
+        GetGroupCompression(group, &group_data_size, &rvz_packed_size);
 
     if (group_data_size == 0)
     {
@@ -565,6 +566,134 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::ReadFromGroupsInParallel(u64* offset, u64* size, u8** out_ptr,
+                                                     u64 chunk_size, u64 data_offset,
+                                                     u64 data_size, u32 group_index,
+                                                     u32 number_of_groups, u32 exception_lists)
+{
+  struct GroupRead
+  {
+    GroupEntry group;
+    u64 chunk_size;
+    u64 offset_in_data;
+    u64 offset_in_group;
+    u64 bytes_to_read;
+    u8* out_ptr;
+  };
+
+  // Find the groups which the read covers. Anything unusual is left to ReadFromGroups.
+  std::vector<GroupRead> reads;
+  u64 read_offset = *offset;
+  u64 read_size = *size;
+  u8* read_ptr = *out_ptr;
+  for (u64 i = (read_offset - data_offset) / chunk_size; i < number_of_groups && read_size > 0;
+       ++i)
+  {
+    const u64 total_group_index = group_index + i;
+    const u64 group_offset_in_data = i * chunk_size;
+    if (total_group_index >= m_group_entries.size() || group_offset_in_data >= data_size)
+      break;
+
+    const u64 group_chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
+    const u64 offset_in_group = read_offset - group_offset_in_data - data_offset;
+    const u64 bytes_to_read = std::min(group_chunk_size - offset_in_group, read_size);
+    reads.push_back({m_group_entries[total_group_index], group_chunk_size, group_offset_in_data,
+                     offset_in_group, bytes_to_read, read_ptr});
+
+    read_offset += bytes_to_read;
+    read_size -= bytes_to_read;
+    read_ptr += bytes_to_read;
+  }
+
+  // The last group is left to ReadFromGroups, so that it ends up in m_cached_chunk for the reads
+  // which continue where this one ends. The same goes for a group that is already in the cache.
+  if (!reads.empty())
+    reads.pop_back();
+  if (!reads.empty() &&
+      (static_cast<u64>(Common::swap32(reads.front().group.data_offset)) << 2) ==
+          m_cached_chunk_offset)
+  {
+    reads.erase(reads.begin());
+  }
+  if (reads.size() < 2)
+    return true;
+
+  const size_t num_threads =
+      std::min<size_t>(reads.size(), std::max(1u, std::thread::hardware_concurrency()));
+  while (m_parallel_files.size() < num_threads)
+  {
+    File::IOFile file = m_file.Duplicate("rb");
+    if (!file.IsOpen())
+      return true;
+    m_parallel_files.push_back(std::move(file));
+  }
+
+  std::vector<std::future<bool>> futures(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    futures[i] = std::async(std::launch::async, [this, &reads, exception_lists, num_threads, i]() {
+      for (size_t j = i; j < reads.size(); j += num_threads)
+      {
+        const GroupRead& read = reads[j];
+        u32 group_data_size;
+        u32 rvz_packed_size;
+        const WIARVZCompressionType compression_type =
+            GetGroupCompression(read.group, &group_data_size, &rvz_packed_size);
+
+        if (group_data_size == 0)
+        {
+          std::memset(read.out_ptr, 0, read.bytes_to_read);
+          continue;
+        }
+
+        const u64 group_offset_in_file = static_cast<u64>(Common::swap32(read.group.data_offset))
+                                         << 2;
+        Chunk chunk = CreateChunk(&m_parallel_files[i], group_offset_in_file, group_data_size,
+                                  read.chunk_size, compression_type, exception_lists,
+                                  rvz_packed_size, read.offset_in_data);
+        if (!chunk.Read(read.offset_in_group, read.bytes_to_read, read.out_ptr))
+          return false;
+      }
+      return true;
+    });
+  }
+
+  bool success = true;
+  for (std::future<bool>& future : futures)
+    success &= future.get();
+  if (!success)
+    return false;
+
+  const u64 bytes_read = reads.back().out_ptr + reads.back().bytes_to_read - *out_ptr;
+  *offset += bytes_read;
+  *size -= bytes_read;
+  *out_ptr += bytes_read;
+  return true;
+}
+
+template <bool RVZ>
+WIARVZCompressionType WIARVZFileReader<RVZ>::GetGroupCompression(const GroupEntry& group,
+                                                                 u32* group_data_size,
+                                                                 u32* rvz_packed_size) const
+{
+  *group_data_size = Common::swap32(group.data_size);
+  *rvz_packed_size = 0;
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  if constexpr (RVZ)
+  {
+    if ((*group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    *group_data_size &= 0x7FFFFFFF;
+
+    *rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  return compression_type;
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -575,6 +704,18 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
   if (offset_in_file == m_cached_chunk_offset)
     return m_cached_chunk;
 
+  m_cached_chunk = CreateChunk(&m_file, offset_in_file, compressed_size, decompressed_size,
+                               compression_type, exception_lists, rvz_packed_size, data_offset);
+  m_cached_chunk_offset = offset_in_file;
+  return m_cached_chunk;
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                                   u64 decompressed_size, WIARVZCompressionType compression_type,
+                                   u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const
+{
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
   {
@@ -603,11 +744,8 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, offset_in_file, compressed_size, decompressed_size, exception_lists,
+               compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
 }
 
 template <bool RVZ>
@@ -1308,7 +1446,19 @@ WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressPa
     std::vector<u8>& data = parameters.data;
 
     if (AllSame(data))
+    {
       entry.reuse_id = ReuseID{WiiKey{}, data.size(), false, data.front()};
+    }
+    else
+    {
+      // Discs often contain several copies of the same files, so let identical groups share data
+      entry.reuse_id = ReuseID{WiiKey{},
+                               data.size(),
+                               false,
+                               0,
+                               Common::SHA1::CalculateDigest(data.data(), data.size()),
+                               parameters.data_offset % VolumeWii::BLOCK_TOTAL_SIZE};
+    }
 
     if constexpr (RVZ)
     {
@@ -1551,7 +1701,8 @@ WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressPa
       continue;
 
     // Special case - a compressed size of zero is treated by WIA as meaning the data is all zeroes
-    if (entry.reuse_id && !entry.reuse_id->encrypted && entry.reuse_id->value == 0)
+    if (entry.reuse_id && !entry.reuse_id->encrypted && !entry.reuse_id->content_hash &&
+        entry.reuse_id->value == 0)
     {
       entry.exception_lists.clear();
       entry.main_data.clear();
@@ -8,8 +8,10 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
@@ -237,9 +239,17 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  bool ReadFromGroupsInParallel(u64* offset, u64* size, u8** out_ptr, u64 chunk_size,
+                                u64 data_offset, u64 data_size, u32 group_index,
+                                u32 number_of_groups, u32 exception_lists);
+  WIARVZCompressionType GetGroupCompression(const GroupEntry& group, u32* group_data_size,
+                                            u32* rvz_packed_size) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk CreateChunk(File::IOFile* file, u64 offset_in_file, u64 compressed_size,
+                    u64 decompressed_size, WIARVZCompressionType compression_type,
+                    u32 exception_lists, u32 rvz_packed_size, u64 data_offset) const;
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -250,18 +260,21 @@ private:
   {
     bool operator==(const ReuseID& other) const
     {
-      return std::tie(partition_key, data_size, encrypted, value) ==
-             std::tie(other.partition_key, other.data_size, other.encrypted, other.value);
+      return std::tie(partition_key, data_size, encrypted, value, content_hash, offset_in_block) ==
+             std::tie(other.partition_key, other.data_size, other.encrypted, other.value,
+                      other.content_hash, other.offset_in_block);
     }
     bool operator<(const ReuseID& other) const
     {
-      return std::tie(partition_key, data_size, encrypted, value) <
-             std::tie(other.partition_key, other.data_size, other.encrypted, other.value);
+      return std::tie(partition_key, data_size, encrypted, value, content_hash, offset_in_block) <
+             std::tie(other.partition_key, other.data_size, other.encrypted, other.value,
+                      other.content_hash, other.offset_in_block);
     }
     bool operator>(const ReuseID& other) const
     {
-      return std::tie(partition_key, data_size, encrypted, value) >
-             std::tie(other.partition_key, other.data_size, other.encrypted, other.value);
+      return std::tie(partition_key, data_size, encrypted, value, content_hash, offset_in_block) >
+             std::tie(other.partition_key, other.data_size, other.encrypted, other.value,
+                      other.content_hash, other.offset_in_block);
     }
 
     bool operator!=(const ReuseID& other) const { return !operator==(other); }
@@ -272,6 +285,11 @@ private:
     u64 data_size;
     bool encrypted;
     u8 value;
+
+    // Set instead of value for data which isn't all the same byte. RVZ junk data decodes
+    // differently depending on where in a block it starts, so that's part of the ID too.
+    std::optional<Common::SHA1::Digest> content_hash{};
+    u64 offset_in_block = 0;
   };
 
   struct CompressThreadState
@@ -369,6 +387,8 @@ private:
   std::string m_path;
   Chunk m_cached_chunk;
   u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  // Additional handles to m_file, one for each thread of ReadFromGroupsInParallel
+  std::vector<File::IOFile> m_parallel_files;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
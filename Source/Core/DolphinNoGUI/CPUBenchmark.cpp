@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/CPUBenchmark.h"
+
+#include <cstdio>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Timer.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "VideoCommon/VideoEvents.h"
+
+CPUBenchmark::CPUBenchmark(Core::System& system, u32 fields, std::function<void()> on_finished)
+    : m_system(system), m_fields(fields), m_on_finished(std::move(on_finished))
+{
+  m_end_field_event = VIEndFieldEvent::Register([this] { OnFieldEnd(); }, "CPUBenchmark");
+}
+
+void CPUBenchmark::ApplySettings()
+{
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+}
+
+void CPUBenchmark::OnFieldEnd()
+{
+  if (m_fields_done == m_fields)
+    return;
+
+  // Measure from the end of the first field, so that boot and savestate loading aren't included.
+  if (m_start_us == 0)
+  {
+    m_start_us = Common::Timer::NowUs();
+    m_start_ticks = m_system.GetCoreTiming().GetTicks();
+    return;
+  }
+
+  if (++m_fields_done < m_fields)
+    return;
+
+  m_host_time_us = Common::Timer::NowUs() - m_start_us;
+  m_guest_ticks = m_system.GetCoreTiming().GetTicks() - m_start_ticks;
+  m_guest_time_us = m_guest_ticks * 1e6 / m_system.GetSystemTimers().GetTicksPerSecond();
+  m_cpu_name = m_system.GetPowerPC().GetCPUName();
+
+  const Core::CPUThreadGuard guard(m_system);
+  JitInterface& jit_interface = m_system.GetJitInterface();
+  m_jit_block_count = jit_interface.GetBlockCount(guard);
+
+  // With JIT profiling enabled, write the per-block profile next to where the debugger's
+  // "Write JIT Block Log Dump" puts it, so hotspots can be compared between runs.
+  if (Config::Get(Config::MAIN_DEBUG_JIT_ENABLE_PROFILING))
+  {
+    const std::string path = fmt::format("{}{}_benchmark.txt",
+                                         File::GetUserPath(D_DUMPDEBUG_JITBLOCKS_IDX),
+                                         SConfig::GetInstance().GetGameID());
+    File::IOFile file(path, "w");
+    if (file)
+    {
+      jit_interface.JitBlockLogDump(guard, file.GetHandle());
+      m_jit_block_log_path = path;
+    }
+  }
+
+  m_on_finished();
+}
+
+void CPUBenchmark::PrintResults() const
+{
+  const double host_time_ms = m_host_time_us / 1000.0;
+  const double avg_field_ms = m_fields_done != 0 ? host_time_ms / m_fields_done : 0.0;
+  const double speed_percent =
+      m_host_time_us != 0 ? 100.0 * m_guest_time_us / m_host_time_us : 0.0;
+
+  fmt::print(stdout,
+             "{{\"cpu_core\":\"{}\",\"fields\":{},\"host_ms\":{:.3f},\"avg_field_ms\":{:.3f},"
+             "\"guest_ticks\":{},\"speed_percent\":{:.1f},\"jit_blocks\":{},"
+             "\"jit_block_log\":\"{}\"}}\n",
+             m_cpu_name, m_fields_done, host_time_ms, avg_field_ms, m_guest_ticks, speed_percent,
+             m_jit_block_count, m_jit_block_log_path);
+  std::fflush(stdout);
+}
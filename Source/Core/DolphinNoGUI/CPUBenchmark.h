@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+namespace Core
+{
+class System;
+}
+
+// Runs emulation for a fixed number of VI fields as fast as possible and reports how long that
+// took on the host, for comparing CPU cores and JIT changes. Combined with a movie that starts from
+// a savestate and the Null video backend, the guest work done is the same on every run.
+class CPUBenchmark final
+{
+public:
+  CPUBenchmark(Core::System& system, u32 fields, std::function<void()> on_finished);
+
+  CPUBenchmark(const CPUBenchmark&) = delete;
+  CPUBenchmark& operator=(const CPUBenchmark&) = delete;
+
+  // Overrides the settings that would otherwise limit the emulation speed. Must be called before
+  // booting.
+  static void ApplySettings();
+
+  // Writes the results to stdout as JSON. Must be called after emulation has stopped.
+  void PrintResults() const;
+
+private:
+  void OnFieldEnd();
+
+  Core::System& m_system;
+  u32 m_fields;
+  std::function<void()> m_on_finished;
+
+  // Only accessed on the CPU thread until emulation has stopped.
+  u32 m_fields_done = 0;
+  u64 m_start_us = 0;
+  u64 m_start_ticks = 0;
+  std::string m_cpu_name;
+  u64 m_host_time_us = 0;
+  u64 m_guest_ticks = 0;
+  double m_guest_time_us = 0;
+  std::size_t m_jit_block_count = 0;
+  std::string m_jit_block_log_path;
+
+  Common::EventHook m_end_field_event;
+};
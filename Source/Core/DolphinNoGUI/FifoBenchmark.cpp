@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "Common/Config/Config.h"
+#include "Common/Timer.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/System.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+FifoBenchmark::FifoBenchmark(Core::System& system, u32 loops, std::function<void()> on_finished)
+    : m_system(system), m_loops(loops), m_on_finished(std::move(on_finished))
+{
+  m_system.GetFifoPlayer().SetFrameWrittenCallback([this] { OnFrameWritten(); });
+  m_after_frame_event =
+      AfterFrameEvent::Register([this](Core::System&) { OnFrameEnd(); }, "FifoBenchmark");
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  m_system.GetFifoPlayer().SetFrameWrittenCallback(nullptr);
+}
+
+void FifoBenchmark::ApplySettings()
+{
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  Config::SetCurrent(Config::GFX_VSYNC, false);
+}
+
+void FifoBenchmark::OnFrameWritten()
+{
+  if (m_finished)
+    return;
+
+  const FifoPlayer& fifo_player = m_system.GetFifoPlayer();
+  if (fifo_player.GetCurrentFrameNum() != fifo_player.GetFrameRangeStart())
+    return;
+
+  // The first frame of the range is about to be written again, so a loop has finished.
+  if (!m_started)
+  {
+    m_started = true;
+    return;
+  }
+
+  if (++m_loops_done < m_loops)
+    return;
+
+  m_finished = true;
+  m_on_finished();
+}
+
+void FifoBenchmark::OnFrameEnd()
+{
+  std::lock_guard lock(m_samples_mutex);
+  m_samples.push_back({Common::Timer::NowUs(), g_stats.this_frame.num_draw_calls,
+                       g_stats.this_frame.num_prims + g_stats.this_frame.num_dl_prims});
+}
+
+void FifoBenchmark::PrintResults() const
+{
+  std::lock_guard lock(m_samples_mutex);
+
+  // Each frame's time is measured from the end of the previous frame, so the first sample only
+  // provides the starting point.
+  std::vector<double> frame_times_ms;
+  u64 total_draw_calls = 0;
+  u64 total_prims = 0;
+  for (size_t i = 1; i < m_samples.size(); ++i)
+  {
+    frame_times_ms.push_back((m_samples[i].time_us - m_samples[i - 1].time_us) / 1000.0);
+    total_draw_calls += m_samples[i].num_draw_calls;
+    total_prims += m_samples[i].num_prims;
+  }
+
+  const size_t num_frames = frame_times_ms.size();
+  double total_ms = 0;
+  for (double frame_time_ms : frame_times_ms)
+    total_ms += frame_time_ms;
+
+  std::vector<double> sorted_times_ms = frame_times_ms;
+  std::sort(sorted_times_ms.begin(), sorted_times_ms.end());
+  const auto percentile = [&sorted_times_ms](double p) {
+    if (sorted_times_ms.empty())
+      return 0.0;
+    const size_t index = static_cast<size_t>(p * (sorted_times_ms.size() - 1));
+    return sorted_times_ms[index];
+  };
+  const auto average = [num_frames](double total) {
+    return num_frames != 0 ? total / num_frames : 0.0;
+  };
+
+  std::string frame_times_json;
+  for (size_t i = 0; i < num_frames; ++i)
+    frame_times_json += fmt::format("{}{:.3f}", i != 0 ? "," : "", frame_times_ms[i]);
+
+  fmt::print(stdout,
+             "{{\"loops\":{},\"frames\":{},\"total_ms\":{:.3f},\"avg_frame_ms\":{:.3f},"
+             "\"min_frame_ms\":{:.3f},\"median_frame_ms\":{:.3f},\"p99_frame_ms\":{:.3f},"
+             "\"max_frame_ms\":{:.3f},\"avg_draw_calls\":{:.1f},\"avg_prims\":{:.1f},"
+             "\"frame_times_ms\":[{}]}}\n",
+             m_loops_done, num_frames, total_ms, average(total_ms), percentile(0.0),
+             percentile(0.5), percentile(0.99), percentile(1.0),
+             average(static_cast<double>(total_draw_calls)),
+             average(static_cast<double>(total_prims)), frame_times_json);
+  std::fflush(stdout);
+}
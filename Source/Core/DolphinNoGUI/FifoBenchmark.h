@@ -0,0 +1,62 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+namespace Core
+{
+class System;
+}
+
+// Replays a FIFO log a given number of times as fast as possible while collecting per-frame
+// timings and statistics from the video thread, so that backend performance can be compared
+// between builds without going through the FIFO player UI.
+class FifoBenchmark final
+{
+public:
+  FifoBenchmark(Core::System& system, u32 loops, std::function<void()> on_finished);
+  ~FifoBenchmark();
+
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+
+  // Overrides the settings that would otherwise limit the replay speed. Must be called before
+  // booting the FIFO log.
+  static void ApplySettings();
+
+  // Writes the results to stdout as JSON. Must be called after emulation has stopped.
+  void PrintResults() const;
+
+private:
+  struct FrameSample
+  {
+    u64 time_us;
+    int num_draw_calls;
+    int num_prims;
+  };
+
+  void OnFrameWritten();
+  void OnFrameEnd();
+
+  Core::System& m_system;
+  u32 m_loops;
+  std::function<void()> m_on_finished;
+
+  // Only accessed on the CPU thread.
+  u32 m_loops_done = 0;
+  bool m_started = false;
+  bool m_finished = false;
+
+  // Written on the video thread.
+  mutable std::mutex m_samples_mutex;
+  std::vector<FrameSample> m_samples;
+
+  Common::EventHook m_after_frame_event;
+};
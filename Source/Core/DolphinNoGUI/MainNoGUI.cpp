@@ -7,8 +7,11 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <optional>
 #include <signal.h>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -24,7 +27,10 @@
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/Host.h"
+#include "Core/Movie.h"
 #include "Core/System.h"
+#include "DolphinNoGUI/CPUBenchmark.h"
+#include "DolphinNoGUI/FifoBenchmark.h"
 
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
@@ -211,6 +217,18 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--bench_fifo")
+      .type("int")
+      .action("store")
+      .metavar("<loops>")
+      .help("Replay the given FIFO log <loops> times as fast as possible, then print frame "
+            "timings and statistics as JSON");
+  parser->add_option("--bench_frames")
+      .type("int")
+      .action("store")
+      .metavar("<frames>")
+      .help("Emulate <frames> VI frames as fast as possible, then print host time and JIT "
+            "statistics as JSON. Use with --movie and --video_backend=Null for repeatable runs");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -285,6 +303,58 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  if (options.is_set("movie"))
+  {
+    std::optional<std::string> movie_savestate_path;
+    if (!Core::System::GetInstance().GetMovie().PlayInput(
+            static_cast<const char*>(options.get("movie")), &movie_savestate_path))
+    {
+      fprintf(stderr, "Could not play the specified movie\n");
+      return 1;
+    }
+    if (movie_savestate_path)
+    {
+      boot->boot_session_data.SetSavestateData(std::move(movie_savestate_path),
+                                               DeleteSavestateAfterBoot::No);
+    }
+  }
+
+  if (options.is_set("bench_fifo") && options.is_set("bench_frames"))
+  {
+    fprintf(stderr, "Only one benchmark can be run at a time.\n");
+    return 1;
+  }
+
+  std::unique_ptr<FifoBenchmark> fifo_benchmark;
+  if (options.is_set("bench_fifo"))
+  {
+    const int loops = static_cast<int>(options.get("bench_fifo"));
+    if (loops <= 0 || !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      fprintf(stderr, "Benchmarking requires a FIFO log and a positive number of loops.\n");
+      return 1;
+    }
+
+    FifoBenchmark::ApplySettings();
+    fifo_benchmark = std::make_unique<FifoBenchmark>(Core::System::GetInstance(), loops,
+                                                     [] { s_platform->Stop(); });
+  }
+
+  std::unique_ptr<CPUBenchmark> cpu_benchmark;
+  if (options.is_set("bench_frames"))
+  {
+    const int frames = static_cast<int>(options.get("bench_frames"));
+    if (frames <= 0)
+    {
+      fprintf(stderr, "Benchmarking requires a positive number of frames.\n");
+      return 1;
+    }
+
+    CPUBenchmark::ApplySettings();
+    cpu_benchmark = std::make_unique<CPUBenchmark>(Core::System::GetInstance(), frames,
+                                                   [] { s_platform->Stop(); });
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -321,6 +391,11 @@ int main(int argc, char* argv[])
   Core::Shutdown(Core::System::GetInstance());
   s_platform.reset();
 
+  if (fifo_benchmark)
+    fifo_benchmark->PrintResults();
+  if (cpu_benchmark)
+    cpu_benchmark->PrintResults();
+
   return 0;
 }
 
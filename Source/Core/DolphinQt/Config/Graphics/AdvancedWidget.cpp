@@ -63,6 +63,8 @@ void AdvancedWidget::CreateWidgets()
   m_show_graphs = new ConfigBool(tr("Show Performance Graphs"), Config::GFX_SHOW_GRAPHS);
   m_show_speed = new ConfigBool(tr("Show % Speed"), Config::GFX_SHOW_SPEED);
   m_show_speed_colors = new ConfigBool(tr("Show Speed Colors"), Config::GFX_SHOW_SPEED_COLORS);
+  m_show_gpu_times = new ConfigBool(tr("Show GPU Pass Times"), Config::GFX_SHOW_GPU_TIMES);
+  m_show_stutters = new ConfigBool(tr("Show Stutter Causes"), Config::GFX_SHOW_STUTTERS);
   m_perf_samp_window = new ConfigInteger(0, 10000, Config::GFX_PERF_SAMP_WINDOW, 100);
   m_perf_samp_window->SetTitle(tr("Performance Sample Window (ms)"));
   m_log_render_time =
@@ -78,6 +80,8 @@ void AdvancedWidget::CreateWidgets()
   performance_layout->addWidget(m_perf_samp_window, 3, 1);
   performance_layout->addWidget(m_log_render_time, 4, 0);
   performance_layout->addWidget(m_show_speed_colors, 4, 1);
+  performance_layout->addWidget(m_show_gpu_times, 5, 0);
+  performance_layout->addWidget(m_show_stutters, 5, 1);
 
   // Debugging
   auto* debugging_box = new QGroupBox(tr("Debugging"));
@@ -286,6 +290,17 @@ void AdvancedWidget::AddDescriptions()
       QT_TR_NOOP("Changes the color of the FPS counter depending on emulation speed."
                  "<br><br><dolphin_emphasis>If unsure, leave this "
                  "checked.</dolphin_emphasis>");
+  static const char TR_SHOW_GPU_TIMES_DESCRIPTION[] = QT_TR_NOOP(
+      "Shows how long the GPU took to render the scene, EFB copies, XFB copies and "
+      "post-processing of a recent frame. If Log Render Time to File is also enabled, the times "
+      "are logged to User/Logs/gpu_pass_times.csv.<br><br>Only supported by the OpenGL "
+      "backend.<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_SHOW_STUTTERS_DESCRIPTION[] = QT_TR_NOOP(
+      "Detects frames that take much longer than the ones before them, and shows what work was "
+      "done during the most recent one, such as shader compiles, texture uploads or JIT "
+      "compiles. If Log Render Time to File is also enabled, every frame is logged to "
+      "User/Logs/stutter_journal.csv.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_PERF_SAMP_WINDOW_DESCRIPTION[] =
       QT_TR_NOOP("The amount of time the FPS and VPS counters will sample over."
                  "<br><br>The higher the value, the more stable the FPS/VPS counter will be, "
@@ -438,6 +453,8 @@ void AdvancedWidget::AddDescriptions()
   m_show_graphs->SetDescription(tr(TR_SHOW_GRAPHS_DESCRIPTION));
   m_show_speed->SetDescription(tr(TR_SHOW_SPEED_DESCRIPTION));
   m_log_render_time->SetDescription(tr(TR_LOG_RENDERTIME_DESCRIPTION));
+  m_show_gpu_times->SetDescription(tr(TR_SHOW_GPU_TIMES_DESCRIPTION));
+  m_show_stutters->SetDescription(tr(TR_SHOW_STUTTERS_DESCRIPTION));
   m_show_speed_colors->SetDescription(tr(TR_SHOW_SPEED_COLORS_DESCRIPTION));
 
   m_enable_wireframe->SetDescription(tr(TR_WIREFRAME_DESCRIPTION));
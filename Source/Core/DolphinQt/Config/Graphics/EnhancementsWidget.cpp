@@ -41,8 +41,6 @@ EnhancementsWidget::EnhancementsWidget(GraphicsWindow* parent) : m_block_save(fa
           [this](const QString& backend) { LoadSettings(); });
   connect(parent, &GraphicsWindow::UseFastTextureSamplingChanged, this,
           &EnhancementsWidget::LoadSettings);
-  connect(parent, &GraphicsWindow::UseGPUTextureDecodingChanged, this,
-          &EnhancementsWidget::LoadSettings);
 }
 
 constexpr int TEXTURE_FILTERING_DEFAULT = 0;
@@ -159,6 +157,9 @@ void EnhancementsWidget::CreateWidgets()
   m_arbitrary_mipmap_detection = new ConfigBool(tr("Arbitrary Mipmap Detection"),
                                                 Config::GFX_ENHANCE_ARBITRARY_MIPMAP_DETECTION);
   m_hdr = new ConfigBool(tr("HDR Post-Processing"), Config::GFX_ENHANCE_HDR_OUTPUT);
+  m_coarse_shading = new ConfigBool(tr("Coarse Shading"), Config::GFX_ENHANCE_COARSE_SHADING);
+  m_temporal_upscaling =
+      new ConfigBool(tr("Temporal Upscaling"), Config::GFX_ENHANCE_TEMPORAL_UPSCALING);
 
   int row = 0;
   enhancements_layout->addWidget(new QLabel(tr("Internal Resolution:")), row, 0);
@@ -202,6 +203,10 @@ void EnhancementsWidget::CreateWidgets()
   enhancements_layout->addWidget(m_hdr, row, 1, 1, -1);
   ++row;
 
+  enhancements_layout->addWidget(m_coarse_shading, row, 0);
+  enhancements_layout->addWidget(m_temporal_upscaling, row, 1, 1, -1);
+  ++row;
+
   // Stereoscopy
   auto* stereoscopy_box = new QGroupBox(tr("Stereoscopy"));
   auto* stereoscopy_layout = new QGridLayout();
@@ -312,7 +317,6 @@ void EnhancementsWidget::LoadSettings()
 {
   m_block_save = true;
   m_texture_filtering_combo->setEnabled(Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING));
-  m_arbitrary_mipmap_detection->setEnabled(!Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING));
 
   // Anti-Aliasing
 
@@ -605,8 +609,9 @@ void EnhancementsWidget::AddDescriptions()
       "effects.<br><br>May have false positives that result in blurry textures at increased "
       "internal "
       "resolution, such as in games that use very low resolution mipmaps. Disabling this can also "
-      "reduce stutter in games that frequently load new textures. This feature is not compatible "
-      "with GPU Texture Decoding.<br><br><dolphin_emphasis>If unsure, leave this "
+      "reduce stutter in games that frequently load new textures. Textures are decoded on the CPU "
+      "while this is enabled, even if GPU Texture Decoding is enabled.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this "
       "unchecked.</dolphin_emphasis>");
   static const char TR_HDR_DESCRIPTION[] = QT_TR_NOOP(
       "Enables scRGB HDR output (if supported by your graphics backend and monitor)."
@@ -615,6 +620,22 @@ void EnhancementsWidget::AddDescriptions()
       "post-process shaders to work, and allows to fully display the PAL and NTSC-J color spaces."
       "<br><br>Note that games still render in SDR internally."
       "<br><br><dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_COARSE_SHADING_DESCRIPTION[] = QT_TR_NOOP(
+      "Runs the pixel shader once per 2x2 block of pixels for the game's draws when the internal "
+      "resolution is 3x Native or higher. Geometry edges stay at full resolution.<br><br>Reduces "
+      "GPU load at high internal resolutions, at the cost of slightly softer textures and "
+      "lighting. EFB copies, post-processing and the final image are not affected.<br><br>Only "
+      "works with the Vulkan backend, on GPUs which support variable rate shading, and is not "
+      "used with SSAA.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
+  static const char TR_TEMPORAL_UPSCALING_DESCRIPTION[] = QT_TR_NOOP(
+      "Renders the game at roughly half of the selected internal resolution, and reconstructs "
+      "the selected resolution from several frames using the depth buffer and the game's camera."
+      "<br><br>Greatly reduces GPU load at high internal resolutions, at the cost of some "
+      "blurring and ghosting in motion. EFB copies are made at the reduced resolution. The "
+      "performance overlay's GPU times show the estimated speedup.<br><br>Not used with "
+      "stereoscopic 3D.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
 
   m_ir_combo->SetTitle(tr("Internal Resolution"));
   m_ir_combo->SetDescription(tr(TR_INTERNAL_RESOLUTION_DESCRIPTION));
@@ -650,6 +671,10 @@ void EnhancementsWidget::AddDescriptions()
 
   m_hdr->SetDescription(tr(TR_HDR_DESCRIPTION));
 
+  m_coarse_shading->SetDescription(tr(TR_COARSE_SHADING_DESCRIPTION));
+
+  m_temporal_upscaling->SetDescription(tr(TR_TEMPORAL_UPSCALING_DESCRIPTION));
+
   m_3d_mode->SetTitle(tr("Stereoscopic 3D Mode"));
   m_3d_mode->SetDescription(tr(TR_3D_MODE_DESCRIPTION));
 
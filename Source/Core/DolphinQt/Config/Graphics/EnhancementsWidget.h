@@ -51,6 +51,8 @@ private:
   ConfigBool* m_disable_copy_filter;
   ConfigBool* m_arbitrary_mipmap_detection;
   ConfigBool* m_hdr;
+  ConfigBool* m_coarse_shading;
+  ConfigBool* m_temporal_upscaling;
 
   // Stereoscopy
   ConfigChoice* m_3d_mode;
@@ -25,7 +25,6 @@ public:
 signals:
   void BackendChanged(const QString& backend);
   void UseFastTextureSamplingChanged();
-  void UseGPUTextureDecodingChanged();
 
 private:
   void CreateMainLayout();
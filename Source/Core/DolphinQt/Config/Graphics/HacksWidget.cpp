@@ -31,10 +31,6 @@ HacksWidget::HacksWidget(GraphicsWindow* parent)
   connect(parent, &GraphicsWindow::BackendChanged, this, &HacksWidget::OnBackendChanged);
   OnBackendChanged(QString::fromStdString(Config::Get(Config::MAIN_GFX_BACKEND)));
   connect(&Settings::Instance(), &Settings::ConfigChanged, this, &HacksWidget::LoadSettings);
-  connect(m_gpu_texture_decoding, &QCheckBox::toggled, [this, parent] {
-    SaveSettings();
-    emit parent->UseGPUTextureDecodingChanged();
-  });
 }
 
 void HacksWidget::CreateWidgets()
@@ -53,11 +49,14 @@ void HacksWidget::CreateWidgets()
       new ConfigBool(tr("Store EFB Copies to Texture Only"), Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM);
   m_defer_efb_copies =
       new ConfigBool(tr("Defer EFB Copies to RAM"), Config::GFX_HACK_DEFER_EFB_COPIES);
+  m_native_res_small_efb_copies = new ConfigBool(tr("Native Resolution for Small EFB Copies"),
+                                                 Config::GFX_HACK_NATIVE_RES_SMALL_EFB_COPIES);
 
   efb_layout->addWidget(m_skip_efb_cpu, 0, 0);
   efb_layout->addWidget(m_ignore_format_changes, 0, 1);
   efb_layout->addWidget(m_store_efb_copies, 1, 0);
   efb_layout->addWidget(m_defer_efb_copies, 1, 1);
+  efb_layout->addWidget(m_native_res_small_efb_copies, 2, 0);
 
   // Texture Cache
   auto* texture_cache_box = new QGroupBox(tr("Texture Cache"));
@@ -268,8 +267,9 @@ void HacksWidget::AddDescriptions()
   static const char TR_GPU_DECODING_DESCRIPTION[] = QT_TR_NOOP(
       "Enables texture decoding using the GPU instead of the CPU.<br><br>This may result in "
       "performance gains in some scenarios, or on systems where the CPU is the "
-      "bottleneck.<br><br>This option is incompatible with Arbitrary Mipmap Detection.<br><br>"
-      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+      "bottleneck.<br><br>Textures are still decoded on the CPU while Arbitrary Mipmap Detection "
+      "or the texture format overlay is enabled.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this checked.</dolphin_emphasis>");
   static const char TR_FAST_DEPTH_CALC_DESCRIPTION[] = QT_TR_NOOP(
       "Uses a less accurate algorithm to calculate depth values.<br><br>Causes issues in a few "
       "games, but can result in a decent speed increase depending on the game and/or "
@@ -288,6 +288,12 @@ void HacksWidget::AddDescriptions()
       "Fixes graphical problems in some games at higher internal resolutions. This setting has no "
       "effect when native internal resolution is used.<br><br>"
       "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_NATIVE_RES_SMALL_EFB_COPIES_DESCRIPTION[] = QT_TR_NOOP(
+      "Keeps EFB copies of at most 128x128 pixels at native resolution, even when Scaled EFB Copy "
+      "is enabled.<br><br>Such small copies are mostly blurred effect buffers like bloom, so this "
+      "saves GPU time at high internal resolutions with little visible difference, but can "
+      "make some effects blockier.<br><br><dolphin_emphasis>If unsure, leave this "
+      "unchecked.</dolphin_emphasis>");
   static const char TR_VI_SKIP_DESCRIPTION[] =
       QT_TR_NOOP("Skips Vertical Blank Interrupts when lag is detected, allowing for "
                  "smooth audio playback when emulation speed is not 100%. <br><br>"
@@ -299,6 +305,7 @@ void HacksWidget::AddDescriptions()
   m_ignore_format_changes->SetDescription(tr(TR_IGNORE_FORMAT_CHANGE_DESCRIPTION));
   m_store_efb_copies->SetDescription(tr(TR_STORE_EFB_TO_TEXTURE_DESCRIPTION));
   m_defer_efb_copies->SetDescription(tr(TR_DEFER_EFB_COPIES_DESCRIPTION));
+  m_native_res_small_efb_copies->SetDescription(tr(TR_NATIVE_RES_SMALL_EFB_COPIES_DESCRIPTION));
   m_accuracy->SetTitle(tr("Texture Cache Accuracy"));
   m_accuracy->SetDescription(tr(TR_ACCUARCY_DESCRIPTION));
   m_store_xfb_copies->SetDescription(tr(TR_STORE_XFB_TO_TEXTURE_DESCRIPTION));
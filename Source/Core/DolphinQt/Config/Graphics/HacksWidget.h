@@ -27,6 +27,7 @@ private:
   ConfigBool* m_ignore_format_changes;
   ConfigBool* m_store_efb_copies;
   ConfigBool* m_defer_efb_copies;
+  ConfigBool* m_native_res_small_efb_copies;
 
   // Texture Cache
   QLabel* m_accuracy_label;
@@ -38,8 +38,24 @@ void GBAHost::GameChanged()
 
 void GBAHost::FrameEnded(const std::vector<u32>& video_buffer)
 {
-  QueueOnObject(m_widget_controller, [widget_controller = m_widget_controller, video_buffer] {
-    widget_controller->FrameEnded(video_buffer);
+  // Only the latest frame is kept, so the core thread neither allocates a copy nor queues an event
+  // for every frame when the UI thread falls behind.
+  {
+    std::lock_guard lock(m_pending_frame->lock);
+    m_pending_frame->video_buffer.assign(video_buffer.begin(), video_buffer.end());
+    if (m_pending_frame->queued)
+      return;
+    m_pending_frame->queued = true;
+  }
+
+  QueueOnObject(m_widget_controller, [widget_controller = m_widget_controller,
+                                      pending_frame = m_pending_frame] {
+    {
+      std::lock_guard lock(pending_frame->lock);
+      pending_frame->shown_video_buffer.swap(pending_frame->video_buffer);
+      pending_frame->queued = false;
+    }
+    widget_controller->FrameEnded(pending_frame->shown_video_buffer);
   });
 }
 
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Core/Host.h"
@@ -23,6 +25,16 @@ public:
   void FrameEnded(const std::vector<u32>& video_buffer) override;
 
 private:
+  // The latest frame of the core, waiting to be shown by the UI thread.
+  struct PendingFrame
+  {
+    std::mutex lock;
+    std::vector<u32> video_buffer;
+    std::vector<u32> shown_video_buffer;
+    bool queued = false;
+  };
+
   GBAWidgetController* m_widget_controller{};
   std::weak_ptr<HW::GBA::Core> m_core;
+  std::shared_ptr<PendingFrame> m_pending_frame = std::make_shared<PendingFrame>();
 };
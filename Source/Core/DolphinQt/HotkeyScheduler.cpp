@@ -630,6 +630,9 @@ void HotkeyScheduler::Run()
 
     if (IsHotkey(HK_SAVE_STATE_FILE))
       emit StateSaveFile();
+
+    if (IsHotkey(HK_REWIND))
+      State::Rewind(Core::System::GetInstance());
   }
 }
 
@@ -3,8 +3,10 @@
 
 #include "DolphinQt/MenuBar.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -803,6 +805,7 @@ void MenuBar::AddMovieMenu()
           [](bool value) { Core::System::GetInstance().GetMovie().SetReadOnly(value); });
 
   movie_menu->addAction(tr("TAS Input"), this, [this] { emit ShowTASInput(); });
+  movie_menu->addAction(tr("Seek to Frame..."), this, &MenuBar::SeekMovieToFrame);
 
   movie_menu->addSeparator();
 
@@ -1285,6 +1288,33 @@ void MenuBar::OnReadOnlyModeChanged(bool read_only)
   m_recording_read_only->setChecked(read_only);
 }
 
+void MenuBar::SeekMovieToFrame()
+{
+  auto& movie = Core::System::GetInstance().GetMovie();
+  if (!movie.IsPlayingInput())
+  {
+    ModalMessageBox::information(this, tr("Seek to Frame"),
+                                 tr("An input recording needs to be playing to seek in it."));
+    return;
+  }
+
+  constexpr u64 max_frame = std::numeric_limits<int>::max();
+  const int first_frame = static_cast<int>(std::min(movie.GetCurrentFrame() + 1, max_frame));
+  const int last_frame = static_cast<int>(std::min(movie.GetTotalFrames(), max_frame));
+
+  bool ok;
+  const int frame =
+      QInputDialog::getInt(this, tr("Seek to Frame"), tr("Frame to seek to:"), first_frame,
+                           first_frame, std::max(first_frame, last_frame), 1, &ok,
+                           Qt::WindowCloseButtonHint);
+  if (ok && !movie.SeekToFrame(static_cast<u64>(frame)))
+  {
+    ModalMessageBox::warning(this, tr("Seek to Frame"),
+                             tr("Frame %1 is not ahead of the current frame of the recording.")
+                                 .arg(frame));
+  }
+}
+
 void MenuBar::ChangeDebugFont()
 {
   bool okay;
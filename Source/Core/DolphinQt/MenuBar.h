@@ -156,6 +156,7 @@ private:
   void CheckNAND();
   void NANDExtractCertificates();
   void ChangeDebugFont();
+  void SeekMovieToFrame();
 
   // Debugging UI
   void ClearSymbols();
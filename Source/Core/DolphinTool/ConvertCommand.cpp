@@ -3,11 +3,16 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
@@ -15,6 +20,9 @@
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -56,6 +64,227 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+struct ConvertSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+};
+
+// Checks that depend on the input file are done here. Errors and warnings go to messages.
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConvertSettings& settings, std::ostream& messages)
+{
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    fmt::print(messages, "Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      fmt::print(messages, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    fmt::print(messages,
+               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      fmt::print(messages, "Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      fmt::print(messages, "Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    fmt::print(messages, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                         "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    fmt::print(messages,
+               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    fmt::print(messages,
+               "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+               "must be an integer multiple of the block size and must not be an integer "
+               "multiple of the block size multiplied by 32. Continuing anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
+                                        format == DiscIO::BlobType::RVZ,
+                                        settings.compression.value(),
+                                        settings.compression_level.value(),
+                                        settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  if (!success)
+  {
+    fmt::print(messages, "Error: Conversion failed\n");
+    return false;
+  }
+
+  return true;
+}
+
+// Converts several files at once. The compression threads of all conversions share one set of
+// CPU slots (see DiscIO::GetCompressionSlots), so this mainly lets reading and writing one image
+// overlap with compressing another.
+static int ConvertBatch(const std::vector<std::string>& input_file_paths,
+                        const std::string& output_directory, const ConvertSettings& settings,
+                        size_t jobs)
+{
+  // An empty output path marks an input whose name is already used by an earlier input
+  std::vector<std::string> output_file_paths;
+  output_file_paths.reserve(input_file_paths.size());
+  for (const std::string& input_file_path : input_file_paths)
+  {
+    std::string name;
+    SplitPath(WithUnifiedPathSeparators(input_file_path), nullptr, &name, nullptr);
+    std::string output_file_path =
+        output_directory + '/' + name + GetFormatExtension(settings.format);
+    if (std::ranges::find(output_file_paths, output_file_path) != output_file_paths.end())
+      output_file_path.clear();
+    output_file_paths.push_back(std::move(output_file_path));
+  }
+
+  std::atomic<size_t> next_index = 0;
+  std::atomic<size_t> failures = 0;
+  size_t files_done = 0;
+  std::mutex report_mutex;
+
+  const auto worker = [&] {
+    for (size_t i = next_index++; i < input_file_paths.size(); i = next_index++)
+    {
+      const std::string& input_file_path = input_file_paths[i];
+      const std::string& output_file_path = output_file_paths[i];
+
+      std::ostringstream messages;
+      bool success;
+      if (output_file_path.empty())
+      {
+        fmt::print(messages, "Error: An earlier input file has the same name\n");
+        success = false;
+      }
+      else if (File::Exists(output_file_path))
+      {
+        // This also keeps a file from being converted onto itself
+        fmt::print(messages, "Error: The output file already exists\n");
+        success = false;
+      }
+      else
+      {
+        success = ConvertFile(input_file_path, output_file_path, settings, messages);
+      }
+
+      if (!success)
+        ++failures;
+
+      std::lock_guard lk(report_mutex);
+      ++files_done;
+      fmt::print(std::cout, "[{}/{}] {} -> {}: {}\n", files_done, input_file_paths.size(),
+                 input_file_path, output_file_path, success ? "OK" : "FAILED");
+      fmt::print(std::cout, "{}", messages.str());
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < std::min(jobs, input_file_paths.size()); ++i)
+    threads.emplace_back(worker);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  fmt::print(std::cout, "Converted {} of {} files\n", input_file_paths.size() - failures,
+             input_file_paths.size());
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -72,13 +301,14 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-i", "--input")
       .type("string")
       .action("store")
-      .help("Path to disc image FILE.")
+      .help("Path to disc image FILE, or a directory of disc images to convert in batch mode. "
+            "Further FILEs can be given after the options to convert them in batch mode.")
       .metavar("FILE");
 
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE, or the destination directory in batch mode.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -110,6 +340,12 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of files to convert at the same time in batch mode. Default is 2.")
+      .set_default(2);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -144,48 +380,9 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
   // --scrub
   const bool scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
   if (scrub && format == DiscIO::BlobType::RVZ)
   {
     fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
@@ -198,19 +395,6 @@ int ConvertCommand(const std::vector<std::string>& args)
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +421,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,58 +471,43 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
+  const ConvertSettings settings{format, scrub, block_size_o, compression_o,
+                                 compression_level_o};
 
-  switch (format)
+  // Batch mode
+  std::vector<std::string> input_file_paths = parser.args();
+  const bool batch = File::IsDirectory(input_file_path) || !input_file_paths.empty();
+  if (File::IsDirectory(input_file_path))
   {
-  case DiscIO::BlobType::PLAIN:
+    static const std::vector<std::string> extensions = {".gcm", ".tgc", ".iso", ".ciso",
+                                                        ".gcz", ".wbfs", ".wia", ".rvz"};
+    const std::vector<std::string> found = Common::DoFileSearch({input_file_path}, extensions);
+    input_file_paths.insert(input_file_paths.begin(), found.begin(), found.end());
+  }
+  else
   {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    input_file_paths.insert(input_file_paths.begin(), input_file_path);
   }
 
-  case DiscIO::BlobType::GCZ:
+  if (batch)
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    if (!File::IsDirectory(output_file_path) && !File::CreateDirs(output_file_path))
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: The output directory could not be created\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
-  }
-
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
-  }
+    const int jobs = static_cast<int>(options.get("jobs"));
+    if (jobs < 1)
+    {
+      fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+      return EXIT_FAILURE;
+    }
 
-  if (!success)
-  {
-    fmt::print(std::cerr, "Error: Conversion failed\n");
-    return EXIT_FAILURE;
+    return ConvertBatch(input_file_paths, output_file_path, settings, static_cast<size_t>(jobs));
   }
 
-  return EXIT_SUCCESS;
+  return ConvertFile(input_file_path, output_file_path, settings, std::cerr) ? EXIT_SUCCESS :
+                                                                               EXIT_FAILURE;
 }
 }  // namespace DolphinTool
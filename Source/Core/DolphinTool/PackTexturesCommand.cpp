@@ -0,0 +1,137 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/PackTexturesCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+namespace DolphinTool
+{
+// Additional mip levels are loaded together with the base level, so they aren't packed on their
+// own.
+static bool IsMipLevelFile(std::string_view filename)
+{
+  const size_t mip_index = filename.rfind("_mip");
+  if (mip_index == std::string_view::npos || mip_index + 4 == filename.size())
+    return false;
+
+  const std::string_view digits = filename.substr(mip_index + 4);
+  return std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+int PackTexturesCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: pack-textures [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a directory of custom textures.")
+      .metavar("DIR");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack to create. Should end in .dtp.")
+      .metavar("FILE");
+
+  parser.add_option("-l", "--compression_level")
+      .type("int")
+      .action("store")
+      .set_default(9)
+      .help("Optional. zstd level used for textures that aren't block compressed. [%default]")
+      .metavar("LEVEL");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  const std::string& input_path = options["input"];
+  if (input_path.empty() || !File::IsDirectory(input_path))
+  {
+    fmt::print(std::cerr, "Error: No input directory set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_path = options["output"];
+  if (output_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  // Same rules as HiresTexture::Update, so the pack contains what the directory would provide.
+  std::map<std::string, std::pair<std::string, bool>> textures;
+  for (const std::string& path : Common::DoFileSearch({input_path}, {".png", ".dds"}, true))
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with("tex1_") || IsMipLevelFile(filename))
+      continue;
+
+    const size_t arb_index = filename.rfind("_arb");
+    const bool has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (has_arbitrary_mipmaps)
+      filename.erase(arb_index, 4);
+
+    if (!textures.try_emplace(filename, path, has_arbitrary_mipmaps).second)
+      fmt::print(std::cerr, "Warning: Skipping '{}', texture was already added\n", path);
+  }
+
+  VideoCommon::TexturePackWriter writer(static_cast<int>(options.get("compression_level")));
+  if (!writer.Open(output_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to create '{}'\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  VideoCommon::DirectFilesystemAssetLibrary library;
+  size_t packed_count = 0;
+  for (const auto& [name, path_and_arb] : textures)
+  {
+    const auto& [path, has_arbitrary_mipmaps] = path_and_arb;
+    library.SetAssetIDMapData(name, {{"texture", StringToPath(path)}});
+
+    VideoCommon::TextureData data;
+    if (library.LoadGameTexture(name, &data).m_bytes_loaded == 0)
+    {
+      fmt::print(std::cerr, "Warning: Skipping '{}', it could not be loaded\n", path);
+      continue;
+    }
+
+    if (!writer.AddTexture(name, has_arbitrary_mipmaps, data.m_texture.m_slices[0]))
+    {
+      fmt::print(std::cerr, "Error: Unable to write '{}' to the texture pack\n", path);
+      return EXIT_FAILURE;
+    }
+    packed_count++;
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Unable to finish writing '{}'\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} textures, {} MiB uncompressed, {} MiB in the pack\n",
+             packed_count, writer.GetUncompressedSize() >> 20, writer.GetStoredSize() >> 20);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
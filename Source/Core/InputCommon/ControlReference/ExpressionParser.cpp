@@ -448,6 +448,20 @@ private:
   const ControlState m_value{};
 };
 
+// Replaces a binary operation on two literals with the literal it evaluates to, so the arithmetic
+// isn't redone on every input poll. Assignments are never folded as they exist for their effect.
+static std::unique_ptr<Expression>
+FoldConstantBinaryExpression(std::unique_ptr<BinaryExpression> expr)
+{
+  if (expr->op == TOK_ASSIGN || !dynamic_cast<LiteralReal*>(expr->lhs.get()) ||
+      !dynamic_cast<LiteralReal*>(expr->rhs.get()))
+  {
+    return expr;
+  }
+
+  return std::make_unique<LiteralReal>(expr->GetValue());
+}
+
 static ParseResult MakeLiteralExpression(const Token& token)
 {
   ControlState val{};
@@ -892,7 +906,8 @@ private:
         return rhs;
       }
 
-      expr = std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr));
+      expr = FoldConstantBinaryExpression(
+          std::make_unique<BinaryExpression>(tok.type, std::move(expr), std::move(rhs.expr)));
     }
 
     return ParseResult::MakeSuccessfulResult(std::move(expr));
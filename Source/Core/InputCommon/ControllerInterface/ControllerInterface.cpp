@@ -7,6 +7,7 @@
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
+#include "Common/Timer.h"
 #include "Core/HW/WiimoteReal/WiimoteReal.h"
 
 #ifdef CIFACE_USE_WIN32
@@ -347,7 +348,10 @@ void ControllerInterface::UpdateInput()
     // Prefer outdated values over blocking UI or CPU thread (this avoids short but noticeable frame
     // drops)
     if (!m_devices_mutex.try_lock())
+    {
+      m_skipped_update_count[int(tls_input_channel)].fetch_add(1, std::memory_order_relaxed);
       return;
+    }
 
     std::lock_guard lk_devices(m_devices_mutex, std::adopt_lock);
 
@@ -365,6 +369,9 @@ void ControllerInterface::UpdateInput()
     }
 
     tls_is_updating_devices = false;
+
+    m_last_update_us[int(tls_input_channel)].store(Common::Timer::NowUs(),
+                                                   std::memory_order_relaxed);
   }
 
   if (devices_to_remove.size() > 0)
@@ -388,6 +395,16 @@ ciface::InputChannel ControllerInterface::GetCurrentInputChannel()
   return tls_input_channel;
 }
 
+u64 ControllerInterface::GetLastUpdateTimeUs(ciface::InputChannel input_channel) const
+{
+  return m_last_update_us[int(input_channel)].load(std::memory_order_relaxed);
+}
+
+u32 ControllerInterface::GetSkippedUpdateCount(ciface::InputChannel input_channel) const
+{
+  return m_skipped_update_count[int(input_channel)].load(std::memory_order_relaxed);
+}
+
 WindowSystemInfo ControllerInterface::GetWindowSystemInfo() const
 {
   return m_wsi;
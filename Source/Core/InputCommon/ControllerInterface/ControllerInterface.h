@@ -3,12 +3,14 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 
+#include "Common/CommonTypes.h"
 #include "Common/Matrix.h"
 #include "Common/WindowSystemInfo.h"
 #include "InputCommon/ControllerInterface/CoreDevice.h"
@@ -122,6 +124,13 @@ public:
   static void SetCurrentInputChannel(ciface::InputChannel);
   static ciface::InputChannel GetCurrentInputChannel();
 
+  // Common::Timer::NowUs() of the last UpdateInput() that actually polled the devices on the
+  // given channel, or 0 if it never has. Lets callers measure how old the input they read is.
+  u64 GetLastUpdateTimeUs(ciface::InputChannel) const;
+  // Number of UpdateInput() calls on the given channel that were skipped because another thread
+  // was holding the devices mutex. Each skip means the channel read the previous poll's state.
+  u32 GetSkippedUpdateCount(ciface::InputChannel) const;
+
   WindowSystemInfo GetWindowSystemInfo() const;
 
 private:
@@ -140,6 +149,9 @@ private:
   std::atomic<bool> m_requested_mouse_centering = false;
 
   std::vector<std::unique_ptr<ciface::InputBackend>> m_input_backends;
+
+  std::array<std::atomic<u64>, int(ciface::InputChannel::Count)> m_last_update_us{};
+  std::array<std::atomic<u32>, int(ciface::InputChannel::Count)> m_skipped_update_count{};
 };
 
 namespace ciface
@@ -23,26 +23,36 @@ DynamicInputTextureManager::~DynamicInputTextureManager() = default;
 
 void DynamicInputTextureManager::Load()
 {
-  m_configuration.clear();
-
   const std::string& game_id = SConfig::GetInstance().GetGameID();
   const std::set<std::string> dynamic_input_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_DYNAMICINPUT_IDX), game_id);
 
+  std::vector<std::string> json_files;
   for (const auto& dynamic_input_directory : dynamic_input_directories)
   {
-    const auto json_files = Common::DoFileSearch({dynamic_input_directory}, {".json"});
-    for (auto& file : json_files)
-    {
-      m_configuration.emplace_back(file);
-    }
+    const auto directory_json_files = Common::DoFileSearch({dynamic_input_directory}, {".json"});
+    json_files.insert(json_files.end(), directory_json_files.begin(), directory_json_files.end());
+  }
+
+  // Keep the loaded configurations if nothing changed, as they cache the decoded images and what
+  // was generated last time. This happens whenever an input profile is loaded.
+  if (game_id == m_game_id && json_files == m_json_files)
+    return;
+
+  m_configuration.clear();
+  for (auto& file : json_files)
+  {
+    m_configuration.emplace_back(file);
   }
+
+  m_game_id = game_id;
+  m_json_files = std::move(json_files);
 }
 
 void DynamicInputTextureManager::GenerateTextures(const Common::IniFile& file,
                                                   const std::vector<std::string>& controller_names)
 {
-  for (const auto& configuration : m_configuration)
+  for (auto& configuration : m_configuration)
   {
     (void)configuration.GenerateTextures(file, controller_names);
   }
@@ -26,5 +26,7 @@ public:
 private:
   std::vector<DynamicInputTextures::Configuration> m_configuration;
   std::string m_config_type;
+  std::string m_game_id;
+  std::vector<std::string> m_json_files;
 };
 }  // namespace InputCommon
@@ -77,27 +77,36 @@ Configuration::Configuration(const std::string& json_path)
 Configuration::~Configuration() = default;
 
 bool Configuration::GenerateTextures(const Common::IniFile& file,
-                                     const std::vector<std::string>& controller_names) const
+                                     const std::vector<std::string>& controller_names)
 {
+  m_generated_compositions.resize(m_dynamic_input_textures.size());
+
   bool any_dirty = false;
-  for (const auto& texture_data : m_dynamic_input_textures)
+  for (std::size_t i = 0; i < m_dynamic_input_textures.size(); i++)
   {
-    any_dirty |= GenerateTexture(file, controller_names, texture_data);
+    any_dirty |= GenerateTexture(file, controller_names, m_dynamic_input_textures[i],
+                                 &m_generated_compositions[i]);
   }
 
   return any_dirty;
 }
 
+const std::optional<ImagePixelData>& Configuration::GetImage(const std::string& image_name)
+{
+  auto it = m_images.find(image_name);
+  if (it == m_images.end())
+    it = m_images.emplace(image_name, LoadImage(m_base_path + image_name)).first;
+  return it->second;
+}
+
 bool Configuration::GenerateTexture(const Common::IniFile& file,
                                     const std::vector<std::string>& controller_names,
-                                    const Data& texture_data) const
+                                    const Data& texture_data,
+                                    std::optional<Composition>* generated_composition)
 {
-  // Two copies of the loaded texture
-  // The first one is used as a fallback if a key or device isn't mapped
-  // the second one is used as the final image to write to the textures directory
-  const auto original_image = LoadImage(m_base_path + texture_data.m_image_name);
-  auto image_to_write = original_image;
-
+  // Work out which host key images go where first. Decoding, composing and encoding the texture
+  // is only needed if that differs from what was written last time.
+  Composition composition;
   bool dirty = false;
 
   for (const auto& controller_name : controller_names)
@@ -153,59 +162,70 @@ bool Configuration::GenerateTexture(const Common::IniFile& file,
       {
         dirty = true;
       }
-      else
+      else if (!rects.empty())
       {
-        const auto host_key_image = LoadImage(m_base_path + input_image_iter->second);
-
-        for (const auto& rect : rects)
-        {
-          InputCommon::ImagePixelData pixel_data;
-          if (host_key_image->width == rect.GetWidth() &&
-              host_key_image->height == rect.GetHeight())
-          {
-            pixel_data = *host_key_image;
-          }
-          else if (texture_data.m_preserve_aspect_ratio)
-          {
-            pixel_data =
-                ResizeKeepAspectRatio(ResizeMode::Nearest, *host_key_image, rect.GetWidth(),
-                                      rect.GetHeight(), Pixel{0, 0, 0, 0});
-          }
-          else
-          {
-            pixel_data =
-                Resize(ResizeMode::Nearest, *host_key_image, rect.GetWidth(), rect.GetHeight());
-          }
-
-          CopyImageRegion(pixel_data, *image_to_write,
-                          Rect{0, 0, rect.GetWidth(), rect.GetHeight()}, rect);
-          dirty = true;
-        }
+        composition.emplace_back(&rects, input_image_iter->second);
+        dirty = true;
       }
     }
   }
 
-  if (dirty)
+  if (!dirty || composition == *generated_composition)
+    return false;
+
+  // The original image is kept where a key or device isn't mapped
+  const auto& original_image = GetImage(texture_data.m_image_name);
+  if (!original_image)
+    return false;
+
+  auto image_to_write = *original_image;
+
+  for (const auto& [rects, image_name] : composition)
   {
-    const std::string& game_id = SConfig::GetInstance().GetGameID();
-    const auto hi_res_folder =
-        File::GetUserPath(D_HIRESTEXTURES_IDX) + texture_data.m_generated_folder_name;
-    if (!File::IsDirectory(hi_res_folder))
-    {
-      File::CreateDir(hi_res_folder);
-    }
-    WriteImage(hi_res_folder + DIR_SEP + texture_data.m_hires_texture_name, *image_to_write);
+    const auto& host_key_image = GetImage(image_name);
+    if (!host_key_image)
+      continue;
 
-    const auto game_id_folder = hi_res_folder + DIR_SEP + "gameids";
-    if (!File::IsDirectory(game_id_folder))
+    for (const auto& rect : *rects)
     {
-      File::CreateDir(game_id_folder);
+      InputCommon::ImagePixelData pixel_data;
+      if (host_key_image->width == rect.GetWidth() && host_key_image->height == rect.GetHeight())
+      {
+        pixel_data = *host_key_image;
+      }
+      else if (texture_data.m_preserve_aspect_ratio)
+      {
+        pixel_data = ResizeKeepAspectRatio(ResizeMode::Nearest, *host_key_image, rect.GetWidth(),
+                                           rect.GetHeight(), Pixel{0, 0, 0, 0});
+      }
+      else
+      {
+        pixel_data =
+            Resize(ResizeMode::Nearest, *host_key_image, rect.GetWidth(), rect.GetHeight());
+      }
+
+      CopyImageRegion(pixel_data, image_to_write, Rect{0, 0, rect.GetWidth(), rect.GetHeight()},
+                      rect);
     }
-    File::CreateEmptyFile(game_id_folder + DIR_SEP + game_id + ".txt");
+  }
+
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  const auto hi_res_folder =
+      File::GetUserPath(D_HIRESTEXTURES_IDX) + texture_data.m_generated_folder_name;
+  if (!File::IsDirectory(hi_res_folder))
+  {
+    File::CreateDir(hi_res_folder);
+  }
+  WriteImage(hi_res_folder + DIR_SEP + texture_data.m_hires_texture_name, image_to_write);
 
-    return true;
+  const auto game_id_folder = hi_res_folder + DIR_SEP + "gameids";
+  if (!File::IsDirectory(game_id_folder))
+  {
+    File::CreateDir(game_id_folder);
   }
+  File::CreateEmptyFile(game_id_folder + DIR_SEP + game_id + ".txt");
 
-  return false;
+  *generated_composition = std::move(composition);
+  return true;
 }
 }  // namespace InputCommon::DynamicInputTextures
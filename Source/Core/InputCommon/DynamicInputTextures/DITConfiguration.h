@@ -3,7 +3,10 @@
 
 #pragma once
 
+#include <map>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -22,15 +25,24 @@ public:
   explicit Configuration(const std::string& json_path);
   ~Configuration();
   bool GenerateTextures(const Common::IniFile& file,
-                        const std::vector<std::string>& controller_names) const;
+                        const std::vector<std::string>& controller_names);
 
 private:
+  // The host key image that is drawn into each list of regions of a texture.
+  using Composition = std::vector<std::pair<const std::vector<Rect>*, std::string>>;
+
   bool GenerateTexture(const Common::IniFile& file,
-                       const std::vector<std::string>& controller_names,
-                       const Data& texture_data) const;
+                       const std::vector<std::string>& controller_names, const Data& texture_data,
+                       std::optional<Composition>* generated_composition);
+  const std::optional<ImagePixelData>& GetImage(const std::string& image_name);
 
   std::vector<Data> m_dynamic_input_textures;
   std::string m_base_path;
   bool m_valid = true;
+
+  // What was last written for each texture, so that unchanged textures aren't written again.
+  std::vector<std::optional<Composition>> m_generated_compositions;
+  // Decoded images, by name relative to m_base_path.
+  std::map<std::string, std::optional<ImagePixelData>> m_images;
 };
 }  // namespace InputCommon::DynamicInputTextures
@@ -28,6 +28,7 @@
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -200,6 +201,9 @@ static void ReadThreadFunc()
   // Reset rumble once on initial reading
   ResetRumble();
 
+  const u64 start_time_us = Common::Timer::NowUs();
+  u64 payload_count = 0;
+
   while (s_read_adapter_thread_running.IsSet())
   {
 #if GCADAPTER_USE_LIBUSB_IMPLEMENTATION
@@ -227,12 +231,14 @@ static void ReadThreadFunc()
     }
 
     ProcessInputPayload(input_buffer.data(), payload_size);
+    payload_count += std::size_t(payload_size) == CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE;
 
 #elif GCADAPTER_USE_ANDROID_IMPLEMENTATION
     const int payload_size = env->CallStaticIntMethod(s_adapter_class, input_func);
     jbyte* const java_data = env->GetByteArrayElements(*java_controller_payload, nullptr);
 
     ProcessInputPayload(reinterpret_cast<const u8*>(java_data), payload_size);
+    payload_count += std::size_t(payload_size) == CONTROLLER_INPUT_PAYLOAD_EXPECTED_SIZE;
 
     env->ReleaseByteArrayElements(*java_controller_payload, java_data, 0);
 
@@ -260,7 +266,10 @@ static void ReadThreadFunc()
   s_detected = false;
 #endif
 
-  NOTICE_LOG_FMT(CONTROLLERINTERFACE, "GCAdapter read thread stopped");
+  // The adapter is polled at 125 Hz by default; overclocked adapters are why this is worth knowing.
+  const u64 elapsed_us = Common::Timer::NowUs() - start_time_us;
+  NOTICE_LOG_FMT(CONTROLLERINTERFACE, "GCAdapter read thread stopped ({:.1f} Hz average poll rate)",
+                 elapsed_us ? payload_count * 1000000.0 / elapsed_us : 0.0);
 }
 
 static void WriteThreadFunc()
@@ -795,17 +804,19 @@ void ProcessInputPayload(const u8* data, std::size_t size)
   }
   else
   {
-    std::lock_guard lk(s_read_mutex);
+    // Decode all ports before taking the lock so the CPU thread reading them in Input() only ever
+    // waits for the state to be copied.
+    std::array<ControllerType, SerialInterface::MAX_SI_CHANNELS> types;
+    std::array<GCPadStatus, SerialInterface::MAX_SI_CHANNELS> pads{};
 
     for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
     {
       const u8* const channel_data = &data[1 + (9 * chan)];
 
       const auto type = IdentifyControllerType(channel_data[0]);
+      types[chan] = type;
 
-      auto& pad_state = s_port_states[chan];
-
-      GCPadStatus pad = {};
+      GCPadStatus& pad = pads[chan];
 
       if (type != ControllerType::None)
       {
@@ -853,11 +864,21 @@ void ProcessInputPayload(const u8* data, std::size_t size)
         // The corresponding code in DeviceGCAdapter has the same check
         pad.button = PAD_ERR_STATUS;
       }
+    }
+
+    std::lock_guard lk(s_read_mutex);
+
+    for (int chan = 0; chan != SerialInterface::MAX_SI_CHANNELS; ++chan)
+    {
+      const auto type = types[chan];
+      GCPadStatus& pad = pads[chan];
+
+      auto& pad_state = s_port_states[chan];
 
       if (type != ControllerType::None && pad_state.controller_type == ControllerType::None)
       {
         NOTICE_LOG_FMT(CONTROLLERINTERFACE, "New device connected to Port {} of Type: {:02x}",
-                       chan + 1, channel_data[0]);
+                       chan + 1, data[1 + (9 * chan)]);
 
         pad.button |= PAD_GET_ORIGIN;
         pad_state.origin = pad;
@@ -6,10 +6,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -131,19 +133,36 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Constructing a GameFile opens and parses the image, which mostly means waiting on storage,
+  // so a batch of them is constructed in parallel. The callback still runs on this thread.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  const size_t batch_size = std::max(1u, std::thread::hardware_concurrency()) * 2;
+  for (size_t batch_start = 0; batch_start < new_paths.size(); batch_start += batch_size)
   {
     if (processing_halted)
       break;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+    const size_t batch_end = std::min(batch_start + batch_size, new_paths.size());
+    std::vector<std::future<std::shared_ptr<GameFile>>> futures;
+    futures.reserve(batch_end - batch_start);
+    for (size_t i = batch_start; i < batch_end; ++i)
     {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+      futures.push_back(std::async(std::launch::async, [&path = new_paths[i]] {
+        return std::make_shared<GameFile>(path);
+      }));
+    }
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+    for (auto& future : futures)
+    {
+      auto file = future.get();
+      if (file->IsValid())
+      {
+        if (game_added_to_cache)
+          game_added_to_cache(file);
+
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      }
     }
   }
 
@@ -218,8 +237,12 @@ bool GameFileCache::Save()
 
 bool GameFileCache::SyncCacheFile(bool save)
 {
+  // The cache is written to a temporary file which then replaces the old one, so that a save
+  // that gets interrupted doesn't leave a truncated cache behind. Such a cache fails to load and
+  // gets deleted, forcing every game in the library to be opened and parsed again.
+  const std::string path = save ? File::GetTempFilenameForAtomicWrite(m_path) : m_path;
   const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
+  File::IOFile f(path, open_mode);
   if (!f)
     return false;
   bool success = false;
@@ -237,7 +260,11 @@ bool GameFileCache::SyncCacheFile(bool save)
     PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
     DoState(&p, buffer_size);
     if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
+    {
+      // The file must be closed before it can be renamed.
+      f.Close();
+      success = File::Rename(path, m_path);
+    }
   }
   else
   {
@@ -255,7 +282,7 @@ bool GameFileCache::SyncCacheFile(bool save)
   {
     // If some file operation failed, try to delete the probably-corrupted cache
     f.Close();
-    File::Delete(m_path);
+    File::Delete(path);
   }
   return success;
 }
@@ -12,6 +12,7 @@
 #include "Common/MsgHandler.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/ConfigManager.h"
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/DXTexture.h"
 #include "VideoBackends/D3DCommon/D3DCommon.h"
@@ -31,6 +32,8 @@ D3D_FEATURE_LEVEL feature_level;
 
 static ComPtr<ID3D11Debug> s_debug;
 
+constexpr u32 MAX_RECORDING_THREADS = 8;
+
 constexpr std::array<D3D_FEATURE_LEVEL, 3> s_supported_feature_levels{
     D3D_FEATURE_LEVEL_11_0,
     D3D_FEATURE_LEVEL_10_1,
@@ -130,12 +133,20 @@ bool Create(u32 adapter_index, bool enable_debug_layer)
                  DX11HRWrap(hr));
   }
 
-  stateman = std::make_unique<StateManager>();
+  stateman = std::make_unique<StateManager>(context.Get());
+
+  if (g_Config.iD3D11RecordingThreads > 0)
+  {
+    recorder = CommandRecorder::Create(
+        std::min(static_cast<u32>(g_Config.iD3D11RecordingThreads), MAX_RECORDING_THREADS));
+  }
+
   return true;
 }
 
 void Destroy()
 {
+  recorder.reset();
   stateman.reset();
 
   context->ClearState();
@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3DCommon/D3DCommon.h"
 
@@ -73,6 +74,7 @@ bool D3DBoundingBox::Initialize()
 std::vector<BBoxType> D3DBoundingBox::Read(u32 index, u32 length)
 {
   std::vector<BBoxType> values(length);
+  D3D::ExecuteRecordedDraws();
   D3D::context->CopyResource(m_staging_buffer.Get(), m_buffer.Get());
 
   D3D11_MAPPED_SUBRESOURCE map;
@@ -96,6 +98,7 @@ void D3DBoundingBox::Write(u32 index, std::span<const BBoxType> values)
                 static_cast<u32>((index + values.size()) * sizeof(BBoxType)),
                 1,
                 1};
+  D3D::ExecuteRecordedDraws();
   D3D::context->UpdateSubresource(m_buffer.Get(), 0, &box, values.data(), 0, 0);
 }
 
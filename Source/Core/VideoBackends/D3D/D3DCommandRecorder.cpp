@@ -0,0 +1,240 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
+
+#include <cstring>
+
+#include <fmt/format.h>
+
+#include "Common/Assert.h"
+#include "Common/Logging/Log.h"
+
+#include "VideoBackends/D3D/D3DVertexManager.h"
+
+#include "VideoCommon/Statistics.h"
+
+namespace DX11
+{
+// Draws per command list. Executing a command list has a fixed cost, and the state of the
+// immediate context is saved and restored around it.
+constexpr size_t SEGMENT_DRAWS = 128;
+
+namespace D3D
+{
+std::unique_ptr<CommandRecorder> recorder;
+}
+
+CommandRecorder::Worker::Worker(ComPtr<ID3D11DeviceContext> context, u32 index)
+    : m_context(std::move(context)), m_state(m_context.Get())
+{
+  m_thread.Reset(fmt::format("D3D Recording Worker {}", index),
+                 [this](Segment* segment) { Record(segment); });
+}
+
+void CommandRecorder::Worker::UploadConstants(ConstantBuffer buffer, const u8* data, u32 size)
+{
+  if (m_constant_buffer_sizes[buffer] < size)
+  {
+    m_constant_buffers[buffer] = VertexManager::AllocateConstantBuffer(size);
+    m_constant_buffer_sizes[buffer] = size;
+  }
+
+  // A deferred context starts every command list with undefined buffer contents, so the first
+  // map of each buffer in a segment must discard. All later ones do as well for simplicity.
+  D3D11_MAPPED_SUBRESOURCE map;
+  const HRESULT hr =
+      m_context->Map(m_constant_buffers[buffer].Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to map constant buffer: {}", DX11HRWrap(hr));
+  if (FAILED(hr))
+    return;
+
+  std::memcpy(map.pData, data, size);
+  m_context->Unmap(m_constant_buffers[buffer].Get(), 0);
+}
+
+void CommandRecorder::Worker::Record(Segment* segment)
+{
+  for (const Draw& draw : segment->draws)
+  {
+    for (u32 i = 0; i < NUM_CONSTANT_BUFFERS; i++)
+    {
+      if (draw.constants_size[i] != 0)
+      {
+        UploadConstants(static_cast<ConstantBuffer>(i),
+                        segment->constants.data() + draw.constants_offset[i],
+                        draw.constants_size[i]);
+      }
+    }
+
+    // The vertex manager's constant buffers are only written on the immediate context, so this
+    // worker's copies are bound in the same slots instead.
+    m_state.SetPendingState(draw.state);
+    m_state.SetPixelConstants(m_constant_buffers[CONSTANTS_PIXEL].Get(),
+                              draw.state.pixelConstants[1] ?
+                                  m_constant_buffers[CONSTANTS_VERTEX].Get() :
+                                  nullptr,
+                              draw.state.pixelConstants[2] ?
+                                  m_constant_buffers[CONSTANTS_CUSTOM_PIXEL].Get() :
+                                  nullptr);
+    m_state.SetVertexConstants(m_constant_buffers[CONSTANTS_VERTEX].Get());
+    m_state.SetGeometryConstants(m_constant_buffers[CONSTANTS_GEOMETRY].Get());
+    m_state.Apply();
+    m_context->DrawIndexed(draw.num_indices, draw.base_index, draw.base_vertex);
+  }
+
+  const HRESULT hr =
+      m_context->FinishCommandList(FALSE, segment->command_list.ReleaseAndGetAddressOf());
+  ASSERT_MSG(VIDEO, SUCCEEDED(hr), "Failed to finish command list: {}", DX11HRWrap(hr));
+
+  // FinishCommandList() cleared the state of the deferred context.
+  m_state.Reset();
+
+  segment->recorded.store(true, std::memory_order_release);
+  segment->recorded.notify_one();
+}
+
+CommandRecorder::~CommandRecorder()
+{
+  ExecuteAll();
+}
+
+std::unique_ptr<CommandRecorder> CommandRecorder::Create(u32 num_threads)
+{
+  D3D11_FEATURE_DATA_THREADING threading = {};
+  HRESULT hr =
+      D3D::device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threading, sizeof(threading));
+  if (FAILED(hr) || !threading.DriverCommandLists)
+  {
+    WARN_LOG_FMT(VIDEO, "Driver does not support command lists, not recording draws on workers");
+    return nullptr;
+  }
+
+  std::unique_ptr<CommandRecorder> recorder(new CommandRecorder());
+  for (u32 i = 0; i < num_threads; i++)
+  {
+    ComPtr<ID3D11DeviceContext> context;
+    hr = D3D::device->CreateDeferredContext(0, context.GetAddressOf());
+    if (FAILED(hr))
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to create deferred context: {}", DX11HRWrap(hr));
+      return nullptr;
+    }
+
+    recorder->m_workers.push_back(std::make_unique<Worker>(std::move(context), i));
+  }
+
+  INFO_LOG_FMT(VIDEO, "Recording draws on {} worker threads", num_threads);
+  return recorder;
+}
+
+void CommandRecorder::SetConstants(ConstantBuffer buffer, const void* data, u32 size)
+{
+  const u8* bytes = static_cast<const u8*>(data);
+  m_constants[buffer].assign(bytes, bytes + size);
+  m_constants_dirty[buffer] = true;
+
+  ADDSTAT(g_stats.this_frame.bytes_uniform_streamed, size);
+}
+
+void CommandRecorder::RecordDraw(const D3D::StateManager::Resources& state, u32 base_index,
+                                 u32 num_indices, u32 base_vertex)
+{
+  if (!m_current_segment)
+  {
+    if (!m_free_segments.empty())
+    {
+      m_current_segment = std::move(m_free_segments.back());
+      m_free_segments.pop_back();
+    }
+    else
+    {
+      m_current_segment = std::make_unique<Segment>();
+      m_current_segment->draws.reserve(SEGMENT_DRAWS);
+    }
+  }
+
+  Segment& segment = *m_current_segment;
+
+  // Each segment is recorded into a different command list, so its first draw uploads all of the
+  // constants.
+  const bool first_draw = segment.draws.empty();
+
+  Draw& draw = segment.draws.emplace_back();
+  draw.state = state;
+  draw.base_index = base_index;
+  draw.num_indices = num_indices;
+  draw.base_vertex = base_vertex;
+  for (u32 i = 0; i < NUM_CONSTANT_BUFFERS; i++)
+  {
+    const std::vector<u8>& constants = m_constants[i];
+    if ((first_draw || m_constants_dirty[i]) && !constants.empty())
+    {
+      draw.constants_offset[i] = static_cast<u32>(segment.constants.size());
+      draw.constants_size[i] = static_cast<u32>(constants.size());
+      segment.constants.insert(segment.constants.end(), constants.begin(), constants.end());
+    }
+    else
+    {
+      draw.constants_offset[i] = 0;
+      draw.constants_size[i] = 0;
+    }
+
+    m_constants_dirty[i] = false;
+  }
+
+  if (segment.draws.size() == SEGMENT_DRAWS)
+    SubmitSegment();
+}
+
+void CommandRecorder::SubmitSegment()
+{
+  if (!m_current_segment || m_current_segment->draws.empty())
+    return;
+
+  // Execute whatever the workers have finished already, and don't let them get too far ahead of
+  // the immediate context.
+  const size_t max_pending_segments = m_workers.size() * 2;
+  while (!m_submitted_segments.empty() &&
+         (m_submitted_segments.front()->recorded.load(std::memory_order_acquire) ||
+          m_submitted_segments.size() >= max_pending_segments))
+  {
+    std::unique_ptr<Segment> segment = std::move(m_submitted_segments.front());
+    m_submitted_segments.pop_front();
+    ExecuteSegment(std::move(segment));
+  }
+
+  Segment* segment = m_current_segment.get();
+  m_submitted_segments.push_back(std::move(m_current_segment));
+  m_workers[m_next_worker]->Push(segment);
+  m_next_worker = (m_next_worker + 1) % static_cast<u32>(m_workers.size());
+}
+
+void CommandRecorder::ExecuteSegment(std::unique_ptr<Segment> segment)
+{
+  segment->recorded.wait(false, std::memory_order_acquire);
+
+  // Restore the state of the immediate context afterwards, so that it still matches what the
+  // immediate StateManager thinks is bound.
+  if (segment->command_list)
+    D3D::context->ExecuteCommandList(segment->command_list.Get(), TRUE);
+
+  segment->command_list.Reset();
+  segment->draws.clear();
+  segment->constants.clear();
+  segment->recorded.store(false, std::memory_order_relaxed);
+  m_free_segments.push_back(std::move(segment));
+}
+
+void CommandRecorder::ExecuteAll()
+{
+  SubmitSegment();
+
+  while (!m_submitted_segments.empty())
+  {
+    std::unique_ptr<Segment> segment = std::move(m_submitted_segments.front());
+    m_submitted_segments.pop_front();
+    ExecuteSegment(std::move(segment));
+  }
+}
+}  // namespace DX11
@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+#include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DState.h"
+
+namespace DX11
+{
+// Records batched draws into deferred contexts on worker threads, and executes the resulting
+// command lists on the immediate context in the order the draws were made.
+//
+// Draws are grouped into segments. Each segment is recorded by one worker, which binds the state
+// captured from the GPU thread's StateManager and uploads the shader constants into its own
+// constant buffers. Vertex and index data stays in the vertex manager's buffers, which are only
+// discarded once all pending segments have been executed.
+//
+// Any other work on the immediate context must be ordered after the recorded draws, so it has to
+// call D3D::ExecuteRecordedDraws() first.
+class CommandRecorder
+{
+public:
+  enum ConstantBuffer : u32
+  {
+    CONSTANTS_VERTEX,
+    CONSTANTS_GEOMETRY,
+    CONSTANTS_PIXEL,
+    CONSTANTS_CUSTOM_PIXEL,
+    NUM_CONSTANT_BUFFERS
+  };
+
+  ~CommandRecorder();
+
+  // Returns nullptr if the driver does not natively support command lists, as the runtime's
+  // emulation would be slower than drawing on the immediate context.
+  static std::unique_ptr<CommandRecorder> Create(u32 num_threads);
+
+  // Stores a copy of the constants, which are uploaded before the next recorded draw.
+  void SetConstants(ConstantBuffer buffer, const void* data, u32 size);
+
+  void RecordDraw(const D3D::StateManager::Resources& state, u32 base_index, u32 num_indices,
+                  u32 base_vertex);
+
+  // Finishes the current segment, waits for all workers and executes their command lists.
+  void ExecuteAll();
+
+private:
+  struct Draw
+  {
+    D3D::StateManager::Resources state;
+    std::array<u32, NUM_CONSTANT_BUFFERS> constants_offset;
+    std::array<u32, NUM_CONSTANT_BUFFERS> constants_size;
+    u32 base_index;
+    u32 num_indices;
+    u32 base_vertex;
+  };
+
+  struct Segment
+  {
+    std::vector<Draw> draws;
+    std::vector<u8> constants;
+    ComPtr<ID3D11CommandList> command_list;
+    std::atomic_bool recorded{false};
+  };
+
+  class Worker
+  {
+  public:
+    Worker(ComPtr<ID3D11DeviceContext> context, u32 index);
+
+    void Push(Segment* segment) { m_thread.Push(segment); }
+
+  private:
+    void Record(Segment* segment);
+    void UploadConstants(ConstantBuffer buffer, const u8* data, u32 size);
+
+    ComPtr<ID3D11DeviceContext> m_context;
+    D3D::StateManager m_state;
+    std::array<ComPtr<ID3D11Buffer>, NUM_CONSTANT_BUFFERS> m_constant_buffers;
+    std::array<u32, NUM_CONSTANT_BUFFERS> m_constant_buffer_sizes{};
+    Common::WorkQueueThread<Segment*> m_thread;
+  };
+
+  CommandRecorder() = default;
+
+  void SubmitSegment();
+  void ExecuteSegment(std::unique_ptr<Segment> segment);
+
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  u32 m_next_worker = 0;
+
+  std::unique_ptr<Segment> m_current_segment;
+  std::deque<std::unique_ptr<Segment>> m_submitted_segments;
+  std::vector<std::unique_ptr<Segment>> m_free_segments;
+
+  // The latest constants, and which of them changed since the last recorded draw.
+  std::array<std::vector<u8>, NUM_CONSTANT_BUFFERS> m_constants;
+  std::array<bool, NUM_CONSTANT_BUFFERS> m_constants_dirty{};
+};
+
+namespace D3D
+{
+extern std::unique_ptr<CommandRecorder> recorder;
+
+// Executes all recorded draws. Must be called before issuing any other work on the immediate
+// context, or destroying an object the draws may use.
+inline void ExecuteRecordedDraws()
+{
+  if (recorder)
+    recorder->ExecuteAll();
+}
+}  // namespace D3D
+}  // namespace DX11
@@ -21,6 +21,7 @@
 
 #include "VideoBackends/D3D/D3DBase.h"
 #include "VideoBackends/D3D/D3DBoundingBox.h"
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/D3DSwapChain.h"
 #include "VideoBackends/D3D/DXPipeline.h"
@@ -123,28 +124,28 @@ void Gfx::SetPipeline(const AbstractPipeline* pipeline)
 
 void Gfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
 {
-  // TODO: Move to stateman
   const CD3D11_RECT rect(rc.left, rc.top, std::max(rc.right, rc.left + 1),
                          std::max(rc.bottom, rc.top + 1));
-  D3D::context->RSSetScissorRects(1, &rect);
+  D3D::stateman->SetScissorRect(rect);
 }
 
 void Gfx::SetViewport(float x, float y, float width, float height, float near_depth,
                       float far_depth)
 {
-  // TODO: Move to stateman
   const CD3D11_VIEWPORT vp(x, y, width, height, near_depth, far_depth);
-  D3D::context->RSSetViewports(1, &vp);
+  D3D::stateman->SetViewport(vp);
 }
 
 void Gfx::Draw(u32 base_vertex, u32 num_vertices)
 {
+  D3D::ExecuteRecordedDraws();
   D3D::stateman->Apply();
   D3D::context->Draw(num_vertices, base_vertex);
 }
 
 void Gfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
 {
+  D3D::ExecuteRecordedDraws();
   D3D::stateman->Apply();
   D3D::context->DrawIndexed(num_indices, base_index, base_vertex);
 }
@@ -152,6 +153,7 @@ void Gfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
 void Gfx::DispatchComputeShader(const AbstractShader* shader, u32 groupsize_x, u32 groupsize_y,
                                 u32 groupsize_z, u32 groups_x, u32 groups_y, u32 groups_z)
 {
+  D3D::ExecuteRecordedDraws();
   D3D::stateman->SetComputeShader(static_cast<const DXShader*>(shader)->GetD3DComputeShader());
   D3D::stateman->SyncComputeBindings();
   D3D::context->Dispatch(groups_x, groups_y, groups_z);
@@ -165,6 +167,7 @@ void Gfx::BindBackbuffer(const ClearColor& clear_color)
 
 void Gfx::PresentBackbuffer()
 {
+  D3D::ExecuteRecordedDraws();
   m_swap_chain->Present();
 }
 
@@ -247,18 +250,21 @@ void Gfx::SetComputeImageTexture(u32 index, AbstractTexture* texture, bool read,
 
 void Gfx::UnbindTexture(const AbstractTexture* texture)
 {
+  D3D::ExecuteRecordedDraws();
   if (D3D::stateman->UnsetTexture(static_cast<const DXTexture*>(texture)->GetD3DSRV()) != 0)
     D3D::stateman->ApplyTextures();
 }
 
 void Gfx::Flush()
 {
+  D3D::ExecuteRecordedDraws();
   D3D::context->Flush();
 }
 
 void Gfx::WaitForGPUIdle()
 {
   // There is no glFinish() equivalent in D3D.
+  D3D::ExecuteRecordedDraws();
   D3D::context->Flush();
 }
 
@@ -6,6 +6,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -49,6 +50,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup group)
   {
     auto& entry = m_query_buffer[(m_query_read_pos + query_count) % m_query_buffer.size()];
 
+    D3D::ExecuteRecordedDraws();
     D3D::context->Begin(entry.query.Get());
     entry.query_group = group;
 
@@ -64,6 +66,7 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
     auto& entry = m_query_buffer[(m_query_read_pos + m_query_count.load(std::memory_order_relaxed) +
                                   m_query_buffer.size() - 1) %
                                  m_query_buffer.size()];
+    D3D::ExecuteRecordedDraws();
     D3D::context->End(entry.query.Get());
   }
 }
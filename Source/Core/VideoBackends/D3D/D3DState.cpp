@@ -23,7 +23,10 @@ namespace D3D
 {
 std::unique_ptr<StateManager> stateman;
 
-StateManager::StateManager() = default;
+StateManager::StateManager(ID3D11DeviceContext* context) : m_context(context)
+{
+}
+
 StateManager::~StateManager() = default;
 
 void StateManager::Apply()
@@ -37,7 +40,7 @@ void StateManager::Apply()
   {
     if (g_ActiveConfig.backend_info.bSupportsBBox)
     {
-      D3D::context->OMSetRenderTargetsAndUnorderedAccessViews(
+      m_context->OMSetRenderTargetsAndUnorderedAccessViews(
           m_pending.framebuffer->GetNumRTVs(),
           m_pending.use_integer_rtv ? m_pending.framebuffer->GetIntegerRTVArray() :
                                       m_pending.framebuffer->GetRTVArray(),
@@ -46,7 +49,7 @@ void StateManager::Apply()
     }
     else
     {
-      D3D::context->OMSetRenderTargets(m_pending.framebuffer->GetNumRTVs(),
+      m_context->OMSetRenderTargets(m_pending.framebuffer->GetNumRTVs(),
                                        m_pending.use_integer_rtv ?
                                            m_pending.framebuffer->GetIntegerRTVArray() :
                                            m_pending.framebuffer->GetRTVArray(),
@@ -77,7 +80,7 @@ void StateManager::Apply()
         count++;
       if (m_pending.pixelConstants[2])
         count++;
-      D3D::context->PSSetConstantBuffers(0, count, m_pending.pixelConstants.data());
+      m_context->PSSetConstantBuffers(0, count, m_pending.pixelConstants.data());
       m_current.pixelConstants[0] = m_pending.pixelConstants[0];
       m_current.pixelConstants[1] = m_pending.pixelConstants[1];
       m_current.pixelConstants[2] = m_pending.pixelConstants[2];
@@ -85,14 +88,14 @@ void StateManager::Apply()
 
     if (m_current.vertexConstants != m_pending.vertexConstants)
     {
-      D3D::context->VSSetConstantBuffers(0, 1, &m_pending.vertexConstants);
-      D3D::context->VSSetConstantBuffers(1, 1, &m_pending.vertexConstants);
+      m_context->VSSetConstantBuffers(0, 1, &m_pending.vertexConstants);
+      m_context->VSSetConstantBuffers(1, 1, &m_pending.vertexConstants);
       m_current.vertexConstants = m_pending.vertexConstants;
     }
 
     if (m_current.geometryConstants != m_pending.geometryConstants)
     {
-      D3D::context->GSSetConstantBuffers(0, 1, &m_pending.geometryConstants);
+      m_context->GSSetConstantBuffers(0, 1, &m_pending.geometryConstants);
       m_current.geometryConstants = m_pending.geometryConstants;
     }
   }
@@ -103,7 +106,7 @@ void StateManager::Apply()
         m_current.vertexBufferStride != m_pending.vertexBufferStride ||
         m_current.vertexBufferOffset != m_pending.vertexBufferOffset)
     {
-      D3D::context->IASetVertexBuffers(0, 1, &m_pending.vertexBuffer, &m_pending.vertexBufferStride,
+      m_context->IASetVertexBuffers(0, 1, &m_pending.vertexBuffer, &m_pending.vertexBufferStride,
                                        &m_pending.vertexBufferOffset);
       m_current.vertexBuffer = m_pending.vertexBuffer;
       m_current.vertexBufferStride = m_pending.vertexBufferStride;
@@ -112,19 +115,19 @@ void StateManager::Apply()
 
     if (m_current.indexBuffer != m_pending.indexBuffer)
     {
-      D3D::context->IASetIndexBuffer(m_pending.indexBuffer, DXGI_FORMAT_R16_UINT, 0);
+      m_context->IASetIndexBuffer(m_pending.indexBuffer, DXGI_FORMAT_R16_UINT, 0);
       m_current.indexBuffer = m_pending.indexBuffer;
     }
 
     if (m_current.topology != m_pending.topology)
     {
-      D3D::context->IASetPrimitiveTopology(m_pending.topology);
+      m_context->IASetPrimitiveTopology(m_pending.topology);
       m_current.topology = m_pending.topology;
     }
 
     if (m_current.inputLayout != m_pending.inputLayout)
     {
-      D3D::context->IASetInputLayout(m_pending.inputLayout);
+      m_context->IASetInputLayout(m_pending.inputLayout);
       m_current.inputLayout = m_pending.inputLayout;
     }
   }
@@ -133,38 +136,48 @@ void StateManager::Apply()
   {
     if (m_current.pixelShader != m_pending.pixelShader)
     {
-      D3D::context->PSSetShader(m_pending.pixelShader, nullptr, 0);
+      m_context->PSSetShader(m_pending.pixelShader, nullptr, 0);
       m_current.pixelShader = m_pending.pixelShader;
     }
 
     if (m_current.vertexShader != m_pending.vertexShader)
     {
-      D3D::context->VSSetShader(m_pending.vertexShader, nullptr, 0);
+      m_context->VSSetShader(m_pending.vertexShader, nullptr, 0);
       m_current.vertexShader = m_pending.vertexShader;
     }
 
     if (m_current.geometryShader != m_pending.geometryShader)
     {
-      D3D::context->GSSetShader(m_pending.geometryShader, nullptr, 0);
+      m_context->GSSetShader(m_pending.geometryShader, nullptr, 0);
       m_current.geometryShader = m_pending.geometryShader;
     }
   }
 
   if (m_dirtyFlags.test(DirtyFlag_BlendState))
   {
-    D3D::context->OMSetBlendState(m_pending.blendState, nullptr, 0xFFFFFFFF);
+    m_context->OMSetBlendState(m_pending.blendState, nullptr, 0xFFFFFFFF);
     m_current.blendState = m_pending.blendState;
   }
   if (m_dirtyFlags.test(DirtyFlag_DepthState))
   {
-    D3D::context->OMSetDepthStencilState(m_pending.depthState, 0);
+    m_context->OMSetDepthStencilState(m_pending.depthState, 0);
     m_current.depthState = m_pending.depthState;
   }
   if (m_dirtyFlags.test(DirtyFlag_RasterizerState))
   {
-    D3D::context->RSSetState(m_pending.rasterizerState);
+    m_context->RSSetState(m_pending.rasterizerState);
     m_current.rasterizerState = m_pending.rasterizerState;
   }
+  if (m_dirtyFlags.test(DirtyFlag_Viewport))
+  {
+    m_context->RSSetViewports(1, &m_pending.viewport);
+    m_current.viewport = m_pending.viewport;
+  }
+  if (m_dirtyFlags.test(DirtyFlag_ScissorRect))
+  {
+    m_context->RSSetScissorRects(1, &m_pending.scissor);
+    m_current.scissor = m_pending.scissor;
+  }
 
   ApplyTextures();
 
@@ -180,7 +193,7 @@ void StateManager::ApplyTextures()
     {
       if (m_current.textures[i] != m_pending.textures[i])
       {
-        D3D::context->PSSetShaderResources(i, 1, &m_pending.textures[i]);
+        m_context->PSSetShaderResources(i, 1, &m_pending.textures[i]);
         m_current.textures[i] = m_pending.textures[i];
       }
       m_dirtyFlags.reset(flag);
@@ -194,7 +207,7 @@ void StateManager::ApplyTextures()
     {
       if (m_current.samplers[i] != m_pending.samplers[i])
       {
-        D3D::context->PSSetSamplers(i, 1, &m_pending.samplers[i]);
+        m_context->PSSetSamplers(i, 1, &m_pending.samplers[i]);
         m_current.samplers[i] = m_pending.samplers[i];
       }
       m_dirtyFlags.reset(flag);
@@ -202,6 +215,48 @@ void StateManager::ApplyTextures()
   }
 }
 
+void StateManager::SetPendingState(const Resources& state)
+{
+  for (u32 i = 0; i < VideoCommon::MAX_PIXEL_SHADER_SAMPLERS; i++)
+  {
+    SetTexture(i, state.textures[i]);
+    SetSampler(i, state.samplers[i]);
+  }
+
+  SetPixelConstants(state.pixelConstants[0], state.pixelConstants[1], state.pixelConstants[2]);
+  SetVertexConstants(state.vertexConstants);
+  SetGeometryConstants(state.geometryConstants);
+  SetVertexBuffer(state.vertexBuffer, state.vertexBufferStride, state.vertexBufferOffset);
+  SetIndexBuffer(state.indexBuffer);
+  SetPrimitiveTopology(state.topology);
+  SetInputLayout(state.inputLayout);
+  SetPixelShader(state.pixelShader);
+  SetVertexShader(state.vertexShader);
+  SetGeometryShader(state.geometryShader);
+  SetBlendState(state.blendState);
+  SetDepthState(state.depthState);
+  SetRasterizerState(state.rasterizerState);
+  if (state.framebuffer)
+    SetFramebuffer(state.framebuffer);
+  SetOMUAV(state.uav);
+  SetIntegerRTV(state.use_integer_rtv);
+  SetViewport(state.viewport);
+  SetScissorRect(state.scissor);
+}
+
+void StateManager::Reset()
+{
+  m_pending = {};
+  m_current = {};
+  m_dirtyFlags.reset();
+
+  m_compute_constants = nullptr;
+  m_compute_textures = {};
+  m_compute_samplers = {};
+  m_compute_images = {};
+  m_compute_shader = nullptr;
+}
+
 u32 StateManager::UnsetTexture(ID3D11ShaderResourceView* srv)
 {
   u32 mask = 0;
@@ -234,7 +289,7 @@ void StateManager::SetComputeUAV(u32 index, ID3D11UnorderedAccessView* uav)
     return;
 
   m_compute_images[index] = uav;
-  D3D::context->CSSetUnorderedAccessViews(0, static_cast<u32>(m_compute_images.size()),
+  m_context->CSSetUnorderedAccessViews(0, static_cast<u32>(m_compute_images.size()),
                                           m_compute_images.data(), nullptr);
 }
 
@@ -244,7 +299,7 @@ void StateManager::SetComputeShader(ID3D11ComputeShader* shader)
     return;
 
   m_compute_shader = shader;
-  D3D::context->CSSetShader(shader, nullptr, 0);
+  m_context->CSSetShader(shader, nullptr, 0);
 }
 
 void StateManager::SyncComputeBindings()
@@ -252,7 +307,7 @@ void StateManager::SyncComputeBindings()
   if (m_compute_constants != m_pending.pixelConstants[0])
   {
     m_compute_constants = m_pending.pixelConstants[0];
-    D3D::context->CSSetConstantBuffers(0, 1, &m_compute_constants);
+    m_context->CSSetConstantBuffers(0, 1, &m_compute_constants);
   }
 
   for (u32 start = 0; start < static_cast<u32>(m_compute_textures.size());)
@@ -274,7 +329,7 @@ void StateManager::SyncComputeBindings()
       m_compute_textures[end] = m_pending.textures[end];
     }
 
-    D3D::context->CSSetShaderResources(start, end - start, &m_compute_textures[start]);
+    m_context->CSSetShaderResources(start, end - start, &m_compute_textures[start]);
     start = end;
   }
 
@@ -297,7 +352,7 @@ void StateManager::SyncComputeBindings()
       m_compute_samplers[end] = m_pending.samplers[end];
     }
 
-    D3D::context->CSSetSamplers(start, end - start, &m_compute_samplers[start]);
+    m_context->CSSetSamplers(start, end - start, &m_compute_samplers[start]);
     start = end;
   }
 }
@@ -6,6 +6,7 @@
 #include <array>
 #include <bitset>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -48,7 +49,33 @@ namespace D3D
 class StateManager
 {
 public:
-  StateManager();
+  struct Resources
+  {
+    std::array<ID3D11ShaderResourceView*, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> textures;
+    std::array<ID3D11SamplerState*, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> samplers;
+    std::array<ID3D11Buffer*, 3> pixelConstants;
+    ID3D11Buffer* vertexConstants;
+    ID3D11Buffer* geometryConstants;
+    ID3D11Buffer* vertexBuffer;
+    ID3D11Buffer* indexBuffer;
+    u32 vertexBufferStride;
+    u32 vertexBufferOffset;
+    D3D11_PRIMITIVE_TOPOLOGY topology;
+    ID3D11InputLayout* inputLayout;
+    ID3D11PixelShader* pixelShader;
+    ID3D11VertexShader* vertexShader;
+    ID3D11GeometryShader* geometryShader;
+    ID3D11BlendState* blendState;
+    ID3D11DepthStencilState* depthState;
+    ID3D11RasterizerState* rasterizerState;
+    DXFramebuffer* framebuffer;
+    ID3D11UnorderedAccessView* uav;
+    bool use_integer_rtv;
+    D3D11_VIEWPORT viewport;
+    D3D11_RECT scissor;
+  };
+
+  explicit StateManager(ID3D11DeviceContext* context);
   ~StateManager();
 
   void SetBlendState(ID3D11BlendState* state)
@@ -165,7 +192,7 @@ public:
   void SetPixelShaderDynamic(ID3D11PixelShader* shader, ID3D11ClassInstance* const* classInstances,
                              u32 classInstancesCount)
   {
-    D3D::context->PSSetShader(shader, classInstances, classInstancesCount);
+    m_context->PSSetShader(shader, classInstances, classInstancesCount);
     m_current.pixelShader = shader;
     m_pending.pixelShader = shader;
   }
@@ -210,6 +237,31 @@ public:
     m_pending.use_integer_rtv = enable;
   }
 
+  void SetViewport(const D3D11_VIEWPORT& viewport)
+  {
+    if (std::memcmp(&m_current.viewport, &viewport, sizeof(viewport)) != 0)
+      m_dirtyFlags.set(DirtyFlag_Viewport);
+
+    m_pending.viewport = viewport;
+  }
+
+  void SetScissorRect(const D3D11_RECT& rect)
+  {
+    if (std::memcmp(&m_current.scissor, &rect, sizeof(rect)) != 0)
+      m_dirtyFlags.set(DirtyFlag_ScissorRect);
+
+    m_pending.scissor = rect;
+  }
+
+  // The state the next draw will use.
+  const Resources& GetPendingState() const { return m_pending; }
+
+  // Replaces the whole pending state, e.g. to replay a draw recorded by another StateManager.
+  void SetPendingState(const Resources& state);
+
+  // Forgets all bindings, after the state of the context was cleared.
+  void Reset();
+
   // removes currently set texture from all slots, returns mask of previously bound slots
   u32 UnsetTexture(ID3D11ShaderResourceView* srv);
   void SetTextureByMask(u32 textureSlotMask, ID3D11ShaderResourceView* srv);
@@ -246,34 +298,14 @@ private:
     DirtyFlag_DepthState,
     DirtyFlag_RasterizerState,
     DirtyFlag_Framebuffer,
+    DirtyFlag_Viewport,
+    DirtyFlag_ScissorRect,
     DirtyFlag_Max
   };
 
-  std::bitset<DirtyFlags::DirtyFlag_Max> m_dirtyFlags;
+  ID3D11DeviceContext* m_context;
 
-  struct Resources
-  {
-    std::array<ID3D11ShaderResourceView*, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> textures;
-    std::array<ID3D11SamplerState*, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS> samplers;
-    std::array<ID3D11Buffer*, 3> pixelConstants;
-    ID3D11Buffer* vertexConstants;
-    ID3D11Buffer* geometryConstants;
-    ID3D11Buffer* vertexBuffer;
-    ID3D11Buffer* indexBuffer;
-    u32 vertexBufferStride;
-    u32 vertexBufferOffset;
-    D3D11_PRIMITIVE_TOPOLOGY topology;
-    ID3D11InputLayout* inputLayout;
-    ID3D11PixelShader* pixelShader;
-    ID3D11VertexShader* vertexShader;
-    ID3D11GeometryShader* geometryShader;
-    ID3D11BlendState* blendState;
-    ID3D11DepthStencilState* depthState;
-    ID3D11RasterizerState* rasterizerState;
-    DXFramebuffer* framebuffer;
-    ID3D11UnorderedAccessView* uav;
-    bool use_integer_rtv;
-  };
+  std::bitset<DirtyFlags::DirtyFlag_Max> m_dirtyFlags;
 
   Resources m_pending = {};
   Resources m_current = {};
@@ -21,6 +21,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -29,7 +30,7 @@
 
 namespace DX11
 {
-static ComPtr<ID3D11Buffer> AllocateConstantBuffer(u32 size)
+ComPtr<ID3D11Buffer> VertexManager::AllocateConstantBuffer(u32 size)
 {
   const u32 cbsize = Common::AlignUp(size, 16u);  // must be a multiple of 16
   const CD3D11_BUFFER_DESC cbdesc(cbsize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC,
@@ -121,6 +122,8 @@ bool VertexManager::Initialize()
 
 void VertexManager::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
 {
+  D3D::ExecuteRecordedDraws();
+
   // Just use the one buffer for all three.
   InvalidateConstants();
   UpdateConstantBuffer(m_vertex_constant_buffer.Get(), uniforms, uniforms_size);
@@ -131,6 +134,8 @@ void VertexManager::UploadUtilityUniforms(const void* uniforms, u32 uniforms_siz
 
 bool VertexManager::MapTexelBuffer(u32 required_size, D3D11_MAPPED_SUBRESOURCE& sr)
 {
+  D3D::ExecuteRecordedDraws();
+
   if ((m_texel_buffer_offset + required_size) > TEXEL_STREAM_BUFFER_SIZE)
   {
     // Restart buffer.
@@ -234,7 +239,9 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
   if (cursor + totalBufferSize >= BUFFER_SIZE)
   {
-    // Wrap around
+    // Wrap around. Recorded draws use the buffer's contents at the time they are executed, so
+    // they have to run before it is discarded.
+    D3D::ExecuteRecordedDraws();
     m_current_buffer = (m_current_buffer + 1) % BUFFER_COUNT;
     cursor = 0;
     MapType = D3D11_MAP_WRITE_DISCARD;
@@ -260,31 +267,62 @@ void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_in
   D3D::stateman->SetIndexBuffer(m_buffers[m_current_buffer].Get());
 }
 
+bool VertexManager::UseCommandRecorder() const
+{
+  // Bounding box and perf query accesses happen on the immediate context between draws, which
+  // would have to wait for every recorded draw.
+  if (!D3D::recorder || PerfQueryBase::ShouldEmulate())
+    return false;
+
+  return !(g_bounding_box->IsEnabled() && g_ActiveConfig.bBBoxEnable &&
+           g_ActiveConfig.backend_info.bSupportsBBox);
+}
+
+void VertexManager::UpdateConstants(CommandRecorder::ConstantBuffer index, ID3D11Buffer* buffer,
+                                    const void* data, u32 data_size)
+{
+  if (m_uniforms_recorded)
+    D3D::recorder->SetConstants(index, data, data_size);
+  else
+    UpdateConstantBuffer(buffer, data, data_size);
+}
+
 void VertexManager::UploadUniforms()
 {
   auto& system = Core::System::GetInstance();
 
   auto& vertex_shader_manager = system.GetVertexShaderManager();
+  auto& geometry_shader_manager = system.GetGeometryShaderManager();
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+
+  // The recorder keeps its own copies of the constants, so everything has to be uploaded again
+  // when switching between it and the immediate context.
+  const bool use_recorder = UseCommandRecorder();
+  if (m_uniforms_recorded != use_recorder)
+  {
+    InvalidateConstants();
+    pixel_shader_manager.custom_constants_dirty = true;
+    m_uniforms_recorded = use_recorder;
+  }
+
   if (vertex_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_vertex_constant_buffer.Get(), &vertex_shader_manager.constants,
-                         sizeof(VertexShaderConstants));
+    UpdateConstants(CommandRecorder::CONSTANTS_VERTEX, m_vertex_constant_buffer.Get(),
+                    &vertex_shader_manager.constants, sizeof(VertexShaderConstants));
     vertex_shader_manager.dirty = false;
   }
 
-  auto& geometry_shader_manager = system.GetGeometryShaderManager();
   if (geometry_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_geometry_constant_buffer.Get(), &geometry_shader_manager.constants,
-                         sizeof(GeometryShaderConstants));
+    UpdateConstants(CommandRecorder::CONSTANTS_GEOMETRY, m_geometry_constant_buffer.Get(),
+                    &geometry_shader_manager.constants, sizeof(GeometryShaderConstants));
     geometry_shader_manager.dirty = false;
   }
 
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
   if (pixel_shader_manager.dirty)
   {
-    UpdateConstantBuffer(m_pixel_constant_buffer.Get(), &pixel_shader_manager.constants,
-                         sizeof(PixelShaderConstants));
+    UpdateConstants(CommandRecorder::CONSTANTS_PIXEL, m_pixel_constant_buffer.Get(),
+                    &pixel_shader_manager.constants, sizeof(PixelShaderConstants));
     pixel_shader_manager.dirty = false;
   }
 
@@ -295,9 +333,9 @@ void VertexManager::UploadUniforms()
       m_custom_pixel_constant_buffer =
           AllocateConstantBuffer(static_cast<u32>(pixel_shader_manager.custom_constants.size()));
     }
-    UpdateConstantBuffer(m_custom_pixel_constant_buffer.Get(),
-                         pixel_shader_manager.custom_constants.data(),
-                         static_cast<u32>(pixel_shader_manager.custom_constants.size()));
+    UpdateConstants(CommandRecorder::CONSTANTS_CUSTOM_PIXEL, m_custom_pixel_constant_buffer.Get(),
+                    pixel_shader_manager.custom_constants.data(),
+                    static_cast<u32>(pixel_shader_manager.custom_constants.size()));
     m_last_custom_pixel_buffer_size = pixel_shader_manager.custom_constants.size();
     pixel_shader_manager.custom_constants_dirty = false;
   }
@@ -310,4 +348,16 @@ void VertexManager::UploadUniforms()
   D3D::stateman->SetVertexConstants(m_vertex_constant_buffer.Get());
   D3D::stateman->SetGeometryConstants(m_geometry_constant_buffer.Get());
 }
+
+void VertexManager::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex)
+{
+  if (!m_uniforms_recorded)
+  {
+    VertexManagerBase::DrawCurrentBatch(base_index, num_indices, base_vertex);
+    return;
+  }
+
+  D3D::recorder->RecordDraw(D3D::stateman->GetPendingState(), base_index, num_indices,
+                            base_vertex);
+}
 }  // namespace DX11
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/VertexManagerBase.h"
 
@@ -40,6 +41,8 @@ public:
 
   bool Initialize();
 
+  static ComPtr<ID3D11Buffer> AllocateConstantBuffer(u32 size);
+
   void UploadUtilityUniforms(const void* uniforms, u32 uniforms_size) override;
   bool UploadTexelBuffer(const void* data, u32 data_size, TexelBufferFormat format,
                          u32* out_offset) override;
@@ -52,6 +55,7 @@ protected:
   void CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices, u32* out_base_vertex,
                     u32* out_base_index) override;
   void UploadUniforms() override;
+  void DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex) override;
 
 private:
   static constexpr u32 BUFFER_COUNT = 2;
@@ -60,6 +64,10 @@ private:
 
   bool MapTexelBuffer(u32 required_size, D3D11_MAPPED_SUBRESOURCE& sr);
 
+  bool UseCommandRecorder() const;
+  void UpdateConstants(CommandRecorder::ConstantBuffer index, ID3D11Buffer* buffer,
+                       const void* data, u32 data_size);
+
   ComPtr<ID3D11Buffer> m_buffers[BUFFER_COUNT] = {};
   u32 m_current_buffer = 0;
   u32 m_buffer_cursor = 0;
@@ -71,6 +79,9 @@ private:
   ComPtr<ID3D11Buffer> m_custom_pixel_constant_buffer = nullptr;
   std::size_t m_last_custom_pixel_buffer_size = 0;
 
+  // Whether the uniforms were last given to the command recorder instead of being uploaded.
+  bool m_uniforms_recorded = false;
+
   ComPtr<ID3D11Buffer> m_texel_buffer = nullptr;
   std::array<ComPtr<ID3D11ShaderResourceView>, NUM_TEXEL_BUFFER_FORMATS> m_texel_buffer_views;
   u32 m_texel_buffer_offset = 0;
@@ -7,6 +7,7 @@
 #include "Common/Logging/Log.h"
 
 #include "VideoBackends/D3D/D3DBase.h"
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoBackends/D3D/D3DGfx.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3D/D3DVertexManager.h"
@@ -28,7 +29,11 @@ DXPipeline::DXPipeline(const AbstractPipelineConfig& config, ID3D11InputLayout*
 {
 }
 
-DXPipeline::~DXPipeline() = default;
+DXPipeline::~DXPipeline()
+{
+  // Recorded draws only hold raw pointers to the pipeline's objects.
+  D3D::ExecuteRecordedDraws();
+}
 
 std::unique_ptr<DXPipeline> DXPipeline::Create(const AbstractPipelineConfig& config)
 {
@@ -10,6 +10,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 
+#include "VideoBackends/D3D/D3DCommandRecorder.h"
 #include "VideoBackends/D3D/D3DState.h"
 #include "VideoBackends/D3DCommon/D3DCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -29,6 +30,8 @@ DXTexture::DXTexture(const TextureConfig& config, ComPtr<ID3D11Texture2D> textur
 
 DXTexture::~DXTexture()
 {
+  // Recorded draws may still sample from this texture.
+  D3D::ExecuteRecordedDraws();
   if (m_srv && D3D::stateman->UnsetTexture(m_srv.Get()) != 0)
     D3D::stateman->ApplyTextures();
 }
@@ -152,6 +155,7 @@ void DXTexture::CopyRectangleFromTexture(const AbstractTexture* src,
                                          u32 src_level, const MathUtil::Rectangle<int>& dst_rect,
                                          u32 dst_layer, u32 dst_level)
 {
+  D3D::ExecuteRecordedDraws();
   const DXTexture* srcentry = static_cast<const DXTexture*>(src);
   ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
          src_rect.GetHeight() == dst_rect.GetHeight());
@@ -173,6 +177,7 @@ void DXTexture::CopyRectangleFromTexture(const AbstractTexture* src,
 void DXTexture::ResolveFromTexture(const AbstractTexture* src, const MathUtil::Rectangle<int>& rect,
                                    u32 layer, u32 level)
 {
+  D3D::ExecuteRecordedDraws();
   const DXTexture* srcentry = static_cast<const DXTexture*>(src);
   DEBUG_ASSERT(m_config.samples > 1 && m_config.width == srcentry->m_config.width &&
                m_config.height == srcentry->m_config.height && m_config.samples == 1);
@@ -188,6 +193,7 @@ void DXTexture::ResolveFromTexture(const AbstractTexture* src, const MathUtil::R
 void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                      size_t buffer_size, u32 layer)
 {
+  D3D::ExecuteRecordedDraws();
   size_t src_pitch = CalculateStrideForFormat(m_config.format, row_length);
   D3D::context->UpdateSubresource(m_texture.Get(),
                                   D3D11CalcSubresource(level, layer, m_config.levels), nullptr,
@@ -243,6 +249,7 @@ void DXStagingTexture::CopyFromTexture(const AbstractTexture* src,
                                        const MathUtil::Rectangle<int>& src_rect, u32 src_layer,
                                        u32 src_level, const MathUtil::Rectangle<int>& dst_rect)
 {
+  D3D::ExecuteRecordedDraws();
   ASSERT(m_type == StagingTextureType::Readback || m_type == StagingTextureType::Mutable);
   ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
          src_rect.GetHeight() == dst_rect.GetHeight());
@@ -278,6 +285,7 @@ void DXStagingTexture::CopyToTexture(const MathUtil::Rectangle<int>& src_rect, A
                                      const MathUtil::Rectangle<int>& dst_rect, u32 dst_layer,
                                      u32 dst_level)
 {
+  D3D::ExecuteRecordedDraws();
   ASSERT(m_type == StagingTextureType::Upload);
   ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
          src_rect.GetHeight() == dst_rect.GetHeight());
@@ -313,6 +321,8 @@ bool DXStagingTexture::Map()
   if (m_map_pointer)
     return true;
 
+  D3D::ExecuteRecordedDraws();
+
   D3D11_MAP map_type;
   if (m_type == StagingTextureType::Readback)
     map_type = D3D11_MAP_READ;
@@ -371,7 +381,10 @@ DXFramebuffer::DXFramebuffer(AbstractTexture* color_attachment, AbstractTexture*
   }
 }
 
-DXFramebuffer::~DXFramebuffer() = default;
+DXFramebuffer::~DXFramebuffer()
+{
+  D3D::ExecuteRecordedDraws();
+}
 
 void DXFramebuffer::Unbind()
 {
@@ -405,6 +418,7 @@ void DXFramebuffer::Unbind()
 
 void DXFramebuffer::Clear(const ClearColor& color_value, float depth_value)
 {
+  D3D::ExecuteRecordedDraws();
   if (GetDepthFormat() != AbstractTextureFormat::Undefined)
   {
     D3D::context->ClearDepthStencilView(GetDSV(), D3D11_CLEAR_DEPTH, depth_value, 0);
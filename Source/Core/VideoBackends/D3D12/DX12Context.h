@@ -67,7 +67,7 @@ public:
   {
     return m_command_lists[m_current_command_list].command_list.Get();
   }
-  DescriptorAllocator* GetDescriptorAllocator()
+  TextureDescriptorAllocator* GetDescriptorAllocator()
   {
     return &m_command_lists[m_current_command_list].descriptor_allocator;
   }
@@ -140,7 +140,7 @@ private:
   {
     ComPtr<ID3D12CommandAllocator> command_allocator;
     ComPtr<ID3D12GraphicsCommandList> command_list;
-    DescriptorAllocator descriptor_allocator;
+    TextureDescriptorAllocator descriptor_allocator;
     SamplerAllocator sampler_allocator;
     std::vector<ID3D12Resource*> pending_resources;
     std::vector<std::pair<DescriptorHeapManager&, u32>> pending_descriptors;
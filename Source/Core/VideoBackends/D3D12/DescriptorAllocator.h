@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include "VideoBackends/D3D12/DescriptorHeapManager.h"
 #include "VideoCommon/Constants.h"
@@ -33,6 +34,34 @@ protected:
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
 };
 
+using TextureDescriptorSet =
+    std::array<D3D12_CPU_DESCRIPTOR_HANDLE, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>;
+
+struct TextureDescriptorSetLess final
+{
+  bool operator()(const TextureDescriptorSet& lhs, const TextureDescriptorSet& rhs) const;
+};
+
+// Linear allocator for the shader-visible CBV/SRV/UAV heap of a command list. Texture tables are
+// remembered until the allocator is reset, so that draws which go back to a set of textures used
+// earlier in the command list can point at the same table instead of copying the descriptors
+// again. Source descriptors aren't freed until the GPU is done with the command list, so a handle
+// can't refer to a different texture before the reset.
+class TextureDescriptorAllocator final : public DescriptorAllocator
+{
+public:
+  TextureDescriptorAllocator();
+  ~TextureDescriptorAllocator();
+
+  bool GetTextureGroupHandle(const TextureDescriptorSet& textures,
+                             D3D12_GPU_DESCRIPTOR_HANDLE* handle);
+  void Reset();
+
+private:
+  std::map<TextureDescriptorSet, D3D12_GPU_DESCRIPTOR_HANDLE, TextureDescriptorSetLess>
+      m_texture_map;
+};
+
 struct SamplerStateSet final
 {
   SamplerState states[VideoCommon::MAX_PIXEL_SHADER_SAMPLERS];
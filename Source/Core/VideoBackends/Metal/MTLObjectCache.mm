@@ -6,8 +6,10 @@
 #include <map>
 #include <mutex>
 #include <optional>
+#include <string>
 
 #include "Common/Assert.h"
+#include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 
 #include "VideoBackends/Metal/MTLPipeline.h"
@@ -16,6 +18,7 @@
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VertexShaderGen.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -379,6 +382,140 @@ public:
   std::map<const Shader*, std::vector<PipelineID>> m_shaders;
   std::array<u32, 3> m_pipeline_counter;
 
+// The archive is only touched after checking for macOS 11 / iOS 14 at runtime.
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunguarded-availability"
+  /// Compiled pipelines, saved next to the shader caches so warm boots skip driver compilation
+  MRCOwned<id<MTLBinaryArchive>> m_archive;
+#pragma clang diagnostic pop
+  std::mutex m_archive_mtx;
+  std::string m_archive_filename;
+  std::string m_archive_key_filename;
+  bool m_archive_dirty = false;
+
+  Internal() { LoadArchive(); }
+  ~Internal() { SaveArchive(); }
+
+  /// Archives are only valid for the GPU and OS build (which ships the driver) they were made on
+  static std::string GetArchiveKey()
+  {
+    @autoreleasepool
+    {
+      return std::string([[g_device name] UTF8String]) + '\n' +
+             [[[NSProcessInfo processInfo] operatingSystemVersionString] UTF8String];
+    }
+  }
+
+  void LoadArchive()
+  {
+    if (!g_ActiveConfig.bShaderCache)
+      return;
+
+    if (@available(macOS 11, iOS 14, *))
+    {
+      @autoreleasepool
+      {
+        m_archive_filename =
+            GetDiskShaderCacheFileName(APIType::Metal, "BinaryArchive", false, true);
+        m_archive_key_filename =
+            GetDiskShaderCacheFileName(APIType::Metal, "BinaryArchiveKey", false, true);
+
+        // Pipelines compiled by another driver would never be hit, and would only grow the file.
+        std::string key;
+        auto desc = MRCTransfer([MTLBinaryArchiveDescriptor new]);
+        if (File::Exists(m_archive_filename) && File::ReadFileToString(m_archive_key_filename, key))
+        {
+          if (key == GetArchiveKey())
+            [desc setUrl:[NSURL fileURLWithPath:@(m_archive_filename.c_str())]];
+          else
+            INFO_LOG_FMT(VIDEO, "Discarding Metal binary archive from a different driver.");
+        }
+
+        NSError* err = nullptr;
+        id<MTLBinaryArchive> archive = [g_device newBinaryArchiveWithDescriptor:desc error:&err];
+        if (err && [desc url])
+        {
+          WARN_LOG_FMT(VIDEO, "Failed to load Metal binary archive '{}': {}", m_archive_filename,
+                       [[err localizedDescription] UTF8String]);
+          [archive release];
+          err = nullptr;
+          [desc setUrl:nil];
+          archive = [g_device newBinaryArchiveWithDescriptor:desc error:&err];
+        }
+        if (err)
+        {
+          WARN_LOG_FMT(VIDEO, "Failed to create Metal binary archive: {}",
+                       [[err localizedDescription] UTF8String]);
+          [archive release];
+          return;
+        }
+
+        m_archive = MRCTransfer(archive);
+      }
+    }
+  }
+
+  void SaveArchive()
+  {
+    std::lock_guard<std::mutex> lock(m_archive_mtx);
+    if (!m_archive || !m_archive_dirty)
+      return;
+
+    if (@available(macOS 11, iOS 14, *))
+    {
+      @autoreleasepool
+      {
+        // Write beside the loaded archive, which may still be mapped, then replace it.
+        const std::string temp_filename = m_archive_filename + ".tmp";
+        NSError* err = nullptr;
+        [m_archive serializeToURL:[NSURL fileURLWithPath:@(temp_filename.c_str())] error:&err];
+        if (err || !File::Rename(temp_filename, m_archive_filename))
+        {
+          WARN_LOG_FMT(VIDEO, "Failed to save Metal binary archive '{}': {}", m_archive_filename,
+                       err ? [[err localizedDescription] UTF8String] : "rename failed");
+          File::Delete(temp_filename);
+          return;
+        }
+
+        File::WriteStringToFile(m_archive_key_filename, GetArchiveKey());
+        m_archive_dirty = false;
+      }
+    }
+  }
+
+  /// Looks the pipeline up in the archive, adding it when missing
+  /// Returns nil on a miss, in which case the pipeline should be created as normal
+  id<MTLRenderPipelineState> CreatePipelineFromArchive(MTLRenderPipelineDescriptor* desc,
+                                                       MTLRenderPipelineReflection** reflection)
+  {
+    if (!m_archive)
+      return nil;
+
+    if (@available(macOS 11, iOS 14, *))
+    {
+      [desc setBinaryArchives:@[ m_archive.Get() ]];
+      NSError* err = nullptr;
+      id<MTLRenderPipelineState> pipe = [g_device
+          newRenderPipelineStateWithDescriptor:desc
+                                       options:MTLPipelineOptionArgumentInfo |
+                                               MTLPipelineOptionFailOnBinaryArchiveMiss
+                                    reflection:reflection
+                                         error:&err];
+      if (pipe)
+        return pipe;
+
+      // Adding compiles the pipeline into the archive, so the normal creation afterwards is a hit.
+      std::lock_guard<std::mutex> lock(m_archive_mtx);
+      err = nullptr;
+      if ([m_archive addRenderPipelineFunctionsWithDescriptor:desc error:&err])
+        m_archive_dirty = true;
+      else
+        WARN_LOG_FMT(VIDEO, "Failed to add pipeline to Metal binary archive: {}",
+                     [[err localizedDescription] UTF8String]);
+    }
+    return nil;
+  }
+
   StoredPipeline CreatePipeline(const AbstractPipelineConfig& config)
   {
     @autoreleasepool
@@ -438,11 +575,14 @@ public:
         [desc setStencilAttachmentPixelFormat:Util::FromAbstract(fs.depth_texture_format)];
       NSError* err = nullptr;
       MTLRenderPipelineReflection* reflection = nullptr;
-      id<MTLRenderPipelineState> pipe =
-          [g_device newRenderPipelineStateWithDescriptor:desc
-                                                 options:MTLPipelineOptionArgumentInfo
-                                              reflection:&reflection
-                                                   error:&err];
+      id<MTLRenderPipelineState> pipe = CreatePipelineFromArchive(desc, &reflection);
+      if (!pipe)
+      {
+        pipe = [g_device newRenderPipelineStateWithDescriptor:desc
+                                                      options:MTLPipelineOptionArgumentInfo
+                                                   reflection:&reflection
+                                                        error:&err];
+      }
       if (err)
       {
         PanicAlertFmt("Failed to compile pipeline for {} and {}: {}",
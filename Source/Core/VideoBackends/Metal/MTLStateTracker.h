@@ -69,7 +69,11 @@ public:
   void EndRenderPass();
   void FlushEncoders();
   void WaitForFlushedEncoders();
-  bool HasUnflushedData() { return static_cast<bool>(m_current_render_cmdbuf); }
+  bool HasUnflushedData()
+  {
+    return m_current_render_cmdbuf ||
+           (m_pending_render_pass.descriptor && m_pending_render_pass.clears);
+  }
   bool GPUBusy()
   {
     return m_current_draw != 1 + m_last_finished_draw.load(std::memory_order_acquire);
@@ -182,6 +186,16 @@ private:
   MRCOwned<id<MTLRenderCommandEncoder>> m_current_render_encoder;
   MRCOwned<id<MTLComputeCommandEncoder>> m_current_compute_encoder;
   MRCOwned<MTLRenderPassDescriptor*> m_resolve_pass_desc;
+  // The render pass most recently begun, if nothing has needed its encoder yet. Creating the
+  // encoder is put off until the first draw, so that passes which are replaced or left without
+  // any draws don't cost an encoder (or, if they don't clear, anything at all).
+  struct PendingRenderPass
+  {
+    MRCOwned<MTLRenderPassDescriptor*> descriptor;
+    u32 width = 0;
+    u32 height = 0;
+    bool clears = false;
+  } m_pending_render_pass;
   Framebuffer* m_current_framebuffer;
   CPUBuffer m_texture_upload_buffer;
   BufferPair m_upload_buffers[static_cast<int>(UploadBuffer::Last) + 1];
@@ -287,6 +301,7 @@ private:
   Map CommitPreallocation(UploadBuffer buffer_idx, size_t actual_amt);
   void CheckViewport();
   void CheckScissor();
+  void BeginRenderEncoder();
   void PrepareRender();
   void PrepareCompute();
 };
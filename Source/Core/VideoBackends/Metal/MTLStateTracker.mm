@@ -312,14 +312,44 @@ void Metal::StateTracker::BeginClearRenderPass(MTLClearColor color, float depth)
 
 void Metal::StateTracker::BeginRenderPass(MTLLoadAction load_action)
 {
-  if (m_current_render_encoder)
+  if (m_current_render_encoder || m_pending_render_pass.descriptor)
     return;
   BeginRenderPass(GetRenderPassDescriptor(m_current_framebuffer, load_action));
 }
 
 void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
 {
+  // A pass which hasn't been encoded yet can simply be dropped, as it was for the same framebuffer
+  // and every attachment is loaded, cleared or discarded again by this one.
+  m_pending_render_pass.descriptor.Reset();
   EndRenderPass();
+  AbstractTexture* attachment = m_current_framebuffer->GetColorAttachment();
+  if (!attachment)
+    attachment = m_current_framebuffer->GetDepthAttachment();
+  m_pending_render_pass.descriptor = MRCRetain(descriptor);
+  m_pending_render_pass.width = attachment->GetWidth();
+  m_pending_render_pass.height = attachment->GetHeight();
+  m_pending_render_pass.clears = descriptor.colorAttachments[0].loadAction == MTLLoadActionClear ||
+                                 descriptor.depthAttachment.loadAction == MTLLoadActionClear;
+}
+
+void Metal::StateTracker::BeginRenderEncoder()
+{
+  if (!m_pending_render_pass.descriptor)
+    BeginRenderPass(GetRenderPassDescriptor(m_current_framebuffer, MTLLoadActionLoad));
+  MTLRenderPassDescriptor* descriptor = m_pending_render_pass.descriptor;
+  const bool loads_color = m_current_framebuffer->HasColorBuffer() &&
+                           descriptor.colorAttachments[0].loadAction == MTLLoadActionLoad;
+  const bool loads_depth = m_current_framebuffer->HasDepthBuffer() &&
+                           descriptor.depthAttachment.loadAction == MTLLoadActionLoad;
+  INCSTAT(g_stats.this_frame.num_render_passes);
+  if (loads_color || loads_depth)
+  {
+    INCSTAT(g_stats.this_frame.num_render_pass_loads);
+    ADDSTAT(g_stats.this_frame.bytes_render_pass_loaded,
+            (loads_color ? m_current_framebuffer->GetColorAttachmentsSizeInBytes() : 0) +
+                (loads_depth ? m_current_framebuffer->GetDepthAttachmentSizeInBytes() : 0));
+  }
   if (m_current_perf_query)
     [descriptor setVisibilityResultBuffer:m_current_perf_query->buffer];
   m_current_render_encoder =
@@ -328,14 +358,12 @@ void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
     [descriptor setVisibilityResultBuffer:nil];
   if (m_manual_buffer_upload)
     [m_current_render_encoder waitForFence:m_fence beforeStages:MTLRenderStageVertex];
-  AbstractTexture* attachment = m_current_framebuffer->GetColorAttachment();
-  if (!attachment)
-    attachment = m_current_framebuffer->GetDepthAttachment();
   static_assert(std::is_trivially_copyable<decltype(m_current)>::value,
                 "Make sure we can memset this");
   memset(&m_current, 0, sizeof(m_current));
-  m_current.width = attachment->GetWidth();
-  m_current.height = attachment->GetHeight();
+  m_current.width = m_pending_render_pass.width;
+  m_current.height = m_pending_render_pass.height;
+  m_pending_render_pass.descriptor.Reset();
   m_current.scissor_rect = MathUtil::Rectangle<int>(0, 0, m_current.width, m_current.height);
   m_current.viewport = {
       0.f, 0.f, static_cast<float>(m_current.width), static_cast<float>(m_current.height),
@@ -349,6 +377,7 @@ void Metal::StateTracker::BeginRenderPass(MTLRenderPassDescriptor* descriptor)
   m_dirty_textures = (1 << MAX_TEXTURES) - 1;
   CheckScissor();
   CheckViewport();
+  INCSTAT(g_stats.this_frame.num_command_encoders);
   ASSERT_MSG(VIDEO, m_current_render_encoder, "Failed to create render encoder!");
 }
 
@@ -360,12 +389,21 @@ void Metal::StateTracker::BeginComputePass()
   if (m_manual_buffer_upload)
     [m_current_compute_encoder waitForFence:m_fence];
   m_flags.NewEncoder();
+  INCSTAT(g_stats.this_frame.num_command_encoders);
   m_dirty_samplers = (1 << MAX_SAMPLERS) - 1;
   m_dirty_textures = (1 << MAX_TEXTURES) - 1;
 }
 
 void Metal::StateTracker::EndRenderPass()
 {
+  // Passes which were never drawn to only need an encoder if they clear something.
+  if (m_pending_render_pass.descriptor)
+  {
+    if (m_pending_render_pass.clears)
+      BeginRenderEncoder();
+    else
+      m_pending_render_pass.descriptor.Reset();
+  }
   if (m_current_render_encoder)
   {
     if (m_flags.bbox_fence && m_state.bbox_download_fence)
@@ -373,6 +411,9 @@ void Metal::StateTracker::EndRenderPass()
                                 afterStages:MTLRenderStageFragment];
     [m_current_render_encoder endEncoding];
     m_current_render_encoder = nullptr;
+    ADDSTAT(g_stats.this_frame.bytes_render_pass_stored,
+            m_current_framebuffer->GetColorAttachmentsSizeInBytes() +
+                m_current_framebuffer->GetDepthAttachmentSizeInBytes());
   }
   if (m_current_compute_encoder)
   {
@@ -383,9 +424,9 @@ void Metal::StateTracker::EndRenderPass()
 
 void Metal::StateTracker::FlushEncoders()
 {
+  EndRenderPass();
   if (!m_current_render_cmdbuf)
     return;
-  EndRenderPass();
   for (int i = 0; i <= static_cast<int>(UploadBuffer::Last); ++i)
     Sync(m_upload_buffers[i]);
   if (!m_manual_buffer_upload)
@@ -608,6 +649,7 @@ void Metal::StateTracker::SetVertexBufferNow(u32 idx, id<MTLBuffer> buffer, u32
     [m_current_render_encoder setVertexBuffer:buffer offset:offset atIndex:idx];
     m_current.vertex_buffers[idx] = buffer;
   }
+  INCSTAT(g_stats.this_frame.num_resource_binds);
 }
 
 void Metal::StateTracker::SetFragmentBufferNow(u32 idx, id<MTLBuffer> buffer, u32 offset)
@@ -621,6 +663,7 @@ void Metal::StateTracker::SetFragmentBufferNow(u32 idx, id<MTLBuffer> buffer, u3
     [m_current_render_encoder setFragmentBuffer:buffer offset:offset atIndex:idx];
     m_current.fragment_buffers[idx] = buffer;
   }
+  INCSTAT(g_stats.this_frame.num_resource_binds);
 }
 
 std::shared_ptr<Metal::StateTracker::PerfQueryTracker> Metal::StateTracker::NewPerfQueryTracker()
@@ -709,7 +752,7 @@ void Metal::StateTracker::PrepareRender()
   if (m_state.perf_query_group != static_cast<PerfQueryGroup>(-1) && !m_current_perf_query)
     m_current_perf_query = NewPerfQueryTracker();
   if (!m_current_render_encoder)
-    BeginRenderPass(MTLLoadActionLoad);
+    BeginRenderEncoder();
   id<MTLRenderCommandEncoder> enc = m_current_render_encoder;
   const Pipeline* pipe = m_state.render_pipeline;
   bool is_gx = pipe->Usage() != AbstractPipelineUsage::Utility;
@@ -788,6 +831,7 @@ void Metal::StateTracker::PrepareRender()
     m_dirty_textures &= ~pipe->GetTextures();
     NSRange range = RangeOfBits(dirty);
     [enc setFragmentTextures:&m_state.textures[range.location] withRange:range];
+    INCSTAT(g_stats.this_frame.num_resource_binds);
   }
   if (u32 dirty = m_dirty_samplers & pipe->GetSamplers())
   {
@@ -797,6 +841,7 @@ void Metal::StateTracker::PrepareRender()
                      lodMinClamps:&m_state.sampler_min_lod[range.location]
                      lodMaxClamps:&m_state.sampler_max_lod[range.location]
                         withRange:range];
+    INCSTAT(g_stats.this_frame.num_resource_binds);
   }
   if (m_state.perf_query_group != m_current.perf_query_group)
   {
@@ -0,0 +1,61 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+#include "VideoCommon/Statistics.h"
+
+namespace Null
+{
+// Records the calls VideoCommon makes into the backend without acting on them, and drops them
+// again. This keeps the backend's cost to a few bytes per call, so running the Null backend
+// measures the CPU cost of VideoCommon alone, independent of any GPU driver.
+class CommandList
+{
+public:
+  enum class Type : u8
+  {
+    SetPipeline,
+    SetTexture,
+    SetSamplerState,
+    SetViewport,
+    SetScissorRect,
+    SetFramebuffer,
+    Draw,
+    DrawIndexed,
+    UploadTexture,
+  };
+
+  struct Command
+  {
+    Type type;
+    u32 arg0;
+    u32 arg1;
+  };
+
+  CommandList() { m_commands.reserve(MAX_COMMANDS); }
+
+  void Record(Type type, u32 arg0 = 0, u32 arg1 = 0)
+  {
+    if (m_commands.size() == MAX_COMMANDS)
+      Reset();
+
+    m_commands.push_back({type, arg0, arg1});
+    INCSTAT(g_stats.this_frame.num_backend_commands);
+  }
+
+  // Drops the recorded commands, keeping the storage for the next ones.
+  void Reset() { m_commands.clear(); }
+
+private:
+  // Large enough for a busy frame, so the list is usually dropped at a flush instead.
+  static constexpr std::size_t MAX_COMMANDS = 64 * 1024;
+
+  std::vector<Command> m_commands;
+};
+}  // namespace Null
@@ -34,6 +34,69 @@ bool NullGfx::SupportsUtilityDrawing() const
   return false;
 }
 
+void NullGfx::SetPipeline(const AbstractPipeline* pipeline)
+{
+  m_current_pipeline = pipeline;
+  m_command_list.Record(CommandList::Type::SetPipeline);
+}
+
+void NullGfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
+{
+  m_command_list.Record(CommandList::Type::SetScissorRect, rc.GetWidth(), rc.GetHeight());
+}
+
+void NullGfx::SetTexture(u32 index, const AbstractTexture* texture)
+{
+  m_command_list.Record(CommandList::Type::SetTexture, index);
+}
+
+void NullGfx::SetSamplerState(u32 index, const SamplerState& state)
+{
+  m_command_list.Record(CommandList::Type::SetSamplerState, index, state.tm0.hex);
+}
+
+void NullGfx::SetViewport(float x, float y, float width, float height, float near_depth,
+                          float far_depth)
+{
+  m_command_list.Record(CommandList::Type::SetViewport, static_cast<u32>(width),
+                        static_cast<u32>(height));
+}
+
+void NullGfx::SetFramebuffer(AbstractFramebuffer* framebuffer)
+{
+  AbstractGfx::SetFramebuffer(framebuffer);
+  m_command_list.Record(CommandList::Type::SetFramebuffer);
+}
+
+void NullGfx::SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer)
+{
+  AbstractGfx::SetAndDiscardFramebuffer(framebuffer);
+  m_command_list.Record(CommandList::Type::SetFramebuffer);
+}
+
+void NullGfx::SetAndClearFramebuffer(AbstractFramebuffer* framebuffer,
+                                     const ClearColor& color_value, float depth_value)
+{
+  AbstractGfx::SetAndClearFramebuffer(framebuffer, color_value, depth_value);
+  m_command_list.Record(CommandList::Type::SetFramebuffer);
+}
+
+void NullGfx::Draw(u32 base_vertex, u32 num_vertices)
+{
+  m_command_list.Record(CommandList::Type::Draw, base_vertex, num_vertices);
+}
+
+void NullGfx::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
+{
+  m_command_list.Record(CommandList::Type::DrawIndexed, base_index, num_indices);
+}
+
+void NullGfx::Flush()
+{
+  // There is no GPU to submit to, so the recorded commands are dropped here.
+  m_command_list.Reset();
+}
+
 std::unique_ptr<AbstractTexture> NullGfx::CreateTexture(const TextureConfig& config,
                                                         [[maybe_unused]] std::string_view name)
 {
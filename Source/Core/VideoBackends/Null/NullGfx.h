@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "VideoBackends/Null/NullCommandList.h"
+
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/RenderBase.h"
 
@@ -17,6 +19,22 @@ public:
   bool IsHeadless() const override;
   virtual bool SupportsUtilityDrawing() const override;
 
+  void SetPipeline(const AbstractPipeline* pipeline) override;
+  void SetScissorRect(const MathUtil::Rectangle<int>& rc) override;
+  void SetTexture(u32 index, const AbstractTexture* texture) override;
+  void SetSamplerState(u32 index, const SamplerState& state) override;
+  void SetViewport(float x, float y, float width, float height, float near_depth,
+                   float far_depth) override;
+  void SetFramebuffer(AbstractFramebuffer* framebuffer) override;
+  void SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer) override;
+  void SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const ClearColor& color_value = {},
+                              float depth_value = 0.0f) override;
+  void Draw(u32 base_vertex, u32 num_vertices) override;
+  void DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex) override;
+  void Flush() override;
+
+  CommandList& GetCommandList() { return m_command_list; }
+
   std::unique_ptr<AbstractTexture> CreateTexture(const TextureConfig& config,
                                                  std::string_view name) override;
   std::unique_ptr<AbstractStagingTexture>
@@ -36,6 +54,9 @@ public:
                                                    const void* cache_data = nullptr,
                                                    size_t cache_data_length = 0) override;
   SurfaceInfo GetSurfaceInfo() const override { return {}; }
+
+private:
+  CommandList m_command_list;
 };
 
 class NullRenderer final : public Renderer
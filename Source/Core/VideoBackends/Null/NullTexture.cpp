@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Null/NullTexture.h"
 
+#include "VideoBackends/Null/NullGfx.h"
+
 namespace Null
 {
 NullTexture::NullTexture(const TextureConfig& tex_config) : AbstractTexture(tex_config)
@@ -23,6 +25,9 @@ void NullTexture::ResolveFromTexture(const AbstractTexture* src,
 void NullTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
                        size_t buffer_size, u32 layer)
 {
+  static_cast<NullGfx*>(g_gfx.get())
+      ->GetCommandList()
+      .Record(CommandList::Type::UploadTexture, level, static_cast<u32>(buffer_size));
 }
 
 NullStagingTexture::NullStagingTexture(StagingTextureType type, const TextureConfig& config)
@@ -12,8 +12,5 @@ class VertexManager final : public VertexManagerBase
 public:
   VertexManager();
   ~VertexManager() override;
-
-protected:
-  void DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_vertex) override;
 };
 }  // namespace Null
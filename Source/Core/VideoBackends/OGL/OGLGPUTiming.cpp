@@ -0,0 +1,96 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/OGL/OGLGPUTiming.h"
+
+#include "Common/GL/GLExtensions/GLExtensions.h"
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+
+namespace OGL
+{
+OGLGPUTiming::~OGLGPUTiming()
+{
+  Reset();
+  if (!m_free_queries.empty())
+    glDeleteQueries(static_cast<GLsizei>(m_free_queries.size()), m_free_queries.data());
+}
+
+bool OGLGPUTiming::IsSupported()
+{
+  // GLES only has timer queries through EXT_disjoint_timer_query, which we don't load.
+  return GLExtensions::Supports("GL_ARB_timer_query");
+}
+
+void OGLGPUTiming::BeginMeasurement(GPUPass pass)
+{
+  GLuint query;
+  if (m_free_queries.empty())
+  {
+    glGenQueries(1, &query);
+  }
+  else
+  {
+    query = m_free_queries.back();
+    m_free_queries.pop_back();
+  }
+
+  glBeginQuery(GL_TIME_ELAPSED, query);
+  m_current_frame.push_back({query, pass});
+}
+
+void OGLGPUTiming::EndMeasurement()
+{
+  glEndQuery(GL_TIME_ELAPSED);
+}
+
+bool OGLGPUTiming::EndFrame(PassTimesNs* times)
+{
+  m_pending_frames.push_back(std::move(m_current_frame));
+  m_current_frame.clear();
+
+  if (m_pending_frames.size() > MAX_PENDING_FRAMES)
+  {
+    ReleaseFrame(&m_pending_frames.front());
+    m_pending_frames.pop_front();
+  }
+
+  // Queries complete in order, so the oldest frame is done once its last query is.
+  Frame& oldest_frame = m_pending_frames.front();
+  if (!oldest_frame.empty())
+  {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(oldest_frame.back().query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      return false;
+
+    for (const Measurement& measurement : oldest_frame)
+    {
+      GLuint time_ns = 0;
+      glGetQueryObjectuiv(measurement.query, GL_QUERY_RESULT, &time_ns);
+      (*times)[static_cast<size_t>(measurement.pass)] += time_ns;
+    }
+  }
+
+  ReleaseFrame(&oldest_frame);
+  m_pending_frames.pop_front();
+  return true;
+}
+
+void OGLGPUTiming::Reset()
+{
+  ReleaseFrame(&m_current_frame);
+  for (Frame& frame : m_pending_frames)
+    ReleaseFrame(&frame);
+  m_pending_frames.clear();
+}
+
+void OGLGPUTiming::ReleaseFrame(Frame* frame)
+{
+  for (const Measurement& measurement : *frame)
+    m_free_queries.push_back(measurement.query);
+  frame->clear();
+}
+}  // namespace OGL
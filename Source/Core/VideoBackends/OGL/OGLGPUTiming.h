@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "Common/GL/GLUtil.h"
+#include "VideoCommon/GPUTiming.h"
+
+namespace OGL
+{
+// Uses GL_TIME_ELAPSED queries, which don't nest, but only one pass is measured at a time anyway.
+class OGLGPUTiming final : public GPUTimingBase
+{
+public:
+  ~OGLGPUTiming() override;
+
+  static bool IsSupported();
+
+protected:
+  void BeginMeasurement(GPUPass pass) override;
+  void EndMeasurement() override;
+  bool EndFrame(PassTimesNs* times) override;
+  void Reset() override;
+
+private:
+  struct Measurement
+  {
+    GLuint query;
+    GPUPass pass;
+  };
+  using Frame = std::vector<Measurement>;
+
+  // Frames are dropped rather than waited for if the GPU falls this far behind.
+  static constexpr size_t MAX_PENDING_FRAMES = 8;
+
+  void ReleaseFrame(Frame* frame);
+
+  Frame m_current_frame;
+  std::deque<Frame> m_pending_frames;
+  std::vector<GLuint> m_free_queries;
+};
+}  // namespace OGL
@@ -49,6 +49,7 @@ Make AA apply instantly during gameplay if possible
 #include "VideoBackends/OGL/OGLBoundingBox.h"
 #include "VideoBackends/OGL/OGLConfig.h"
 #include "VideoBackends/OGL/OGLGfx.h"
+#include "VideoBackends/OGL/OGLGPUTiming.h"
 #include "VideoBackends/OGL/OGLPerfQuery.h"
 #include "VideoBackends/OGL/OGLVertexManager.h"
 #include "VideoBackends/OGL/ProgramShaderCache.h"
@@ -212,8 +213,16 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   auto perf_query = GetPerfQuery(gfx->IsGLES());
   auto bounding_box = std::make_unique<OGLBoundingBox>();
 
-  return InitializeShared(std::move(gfx), std::move(vertex_manager), std::move(perf_query),
-                          std::move(bounding_box));
+  if (!InitializeShared(std::move(gfx), std::move(vertex_manager), std::move(perf_query),
+                        std::move(bounding_box)))
+  {
+    return false;
+  }
+
+  if (OGLGPUTiming::IsSupported())
+    g_gpu_timing = std::make_unique<OGLGPUTiming>();
+
+  return true;
 }
 
 void VideoBackend::Shutdown()
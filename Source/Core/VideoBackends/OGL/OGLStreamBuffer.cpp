@@ -3,15 +3,19 @@
 
 #include "VideoBackends/OGL/OGLStreamBuffer.h"
 
+#include <algorithm>
+
 #include "Common/Align.h"
 #include "Common/GL/GLUtil.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
+#include "Common/Timer.h"
 
 #include "VideoBackends/OGL/OGLConfig.h"
 
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/OnScreenDisplay.h"
+#include "VideoCommon/Statistics.h"
 
 namespace OGL
 {
@@ -25,7 +29,8 @@ static u32 GenBuffer()
 
 StreamBuffer::StreamBuffer(u32 type, u32 size)
     : m_buffer(GenBuffer()), m_buffertype(type), m_size(MathUtil::NextPowerOf2(size)),
-      m_bit_per_slot(MathUtil::IntLog2(MathUtil::NextPowerOf2(size) / SYNC_POINTS))
+      m_sync_points(static_cast<int>(std::max(MIN_SYNC_POINTS, m_size / MIN_SYNC_SLOT_SIZE))),
+      m_bit_per_slot(MathUtil::IntLog2(m_size / m_sync_points)), m_fences(m_sync_points)
 {
   m_iterator = 0;
   m_used_iterator = 0;
@@ -42,7 +47,7 @@ StreamBuffer::~StreamBuffer()
  * The next three functions are to create/delete/use the OpenGL synchronization.
  * ARB_sync (OpenGL 3.2) is used and required.
  *
- * To reduce overhead, the complete buffer is splitted up into SYNC_POINTS chunks.
+ * To reduce overhead, the complete buffer is splitted up into m_sync_points chunks.
  * For each of this chunks, there is a fence which checks if this chunk is still in use.
  *
  * As our API allows to alloc more memory then it has to use, we have to catch how much is already
@@ -63,16 +68,31 @@ StreamBuffer::~StreamBuffer()
  * As ring buffers have an ugly behavior on rollover, have fun to read this code ;)
  */
 
+// Waits for and deletes the fence. The fence is polled first, so that the statistics only count
+// the waits which actually block the CPU.
+static void WaitForFence(GLsync fence)
+{
+  if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED)
+  {
+    const u64 start_time = Common::Timer::NowUs();
+    glClientWaitSync(fence, 0, GL_TIMEOUT_IGNORED);
+    INCSTAT(g_stats.this_frame.num_stream_buffer_stalls);
+    ADDSTAT(g_stats.this_frame.stream_buffer_stall_us,
+            static_cast<int>(Common::Timer::NowUs() - start_time));
+  }
+  glDeleteSync(fence);
+}
+
 void StreamBuffer::CreateFences()
 {
-  for (int i = 0; i < SYNC_POINTS; i++)
+  for (int i = 0; i < m_sync_points; i++)
   {
     m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
   }
 }
 void StreamBuffer::DeleteFences()
 {
-  for (int i = Slot(m_free_iterator) + 1; i < SYNC_POINTS; i++)
+  for (int i = Slot(m_free_iterator) + 1; i < m_sync_points; i++)
   {
     glDeleteSync(m_fences[i]);
   }
@@ -91,10 +111,9 @@ void StreamBuffer::AllocMemory(u32 size)
   m_used_iterator = m_iterator;
 
   // wait for new slots to end of buffer
-  for (int i = Slot(m_free_iterator) + 1; i <= Slot(m_iterator + size) && i < SYNC_POINTS; i++)
+  for (int i = Slot(m_free_iterator) + 1; i <= Slot(m_iterator + size) && i < m_sync_points; i++)
   {
-    glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
-    glDeleteSync(m_fences[i]);
+    WaitForFence(m_fences[i]);
   }
 
   // If we allocate a large amount of memory (A), commit a smaller amount, then allocate memory
@@ -108,7 +127,7 @@ void StreamBuffer::AllocMemory(u32 size)
   if (m_iterator + size >= m_size)
   {
     // insert waiting slots in unused space at the end of the buffer
-    for (int i = Slot(m_used_iterator); i < SYNC_POINTS; i++)
+    for (int i = Slot(m_used_iterator); i < m_sync_points; i++)
     {
       m_fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     }
@@ -119,8 +138,7 @@ void StreamBuffer::AllocMemory(u32 size)
     // wait for space at the start
     for (int i = 0; i <= Slot(m_iterator + size); i++)
     {
-      glClientWaitSync(m_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
-      glDeleteSync(m_fences[i]);
+      WaitForFence(m_fences[i]);
     }
     m_free_iterator = m_iterator + size;
   }
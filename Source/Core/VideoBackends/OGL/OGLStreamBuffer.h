@@ -6,6 +6,7 @@
 #include <array>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLUtil.h"
@@ -59,10 +60,14 @@ protected:
   u32 m_free_iterator;
 
 private:
-  static constexpr int SYNC_POINTS = 16;
+  // The buffer is split into at least MIN_SYNC_POINTS slots, and into slots of MIN_SYNC_SLOT_SIZE
+  // for larger buffers, so that a wait doesn't have to cover much more than the memory needed.
+  static constexpr u32 MIN_SYNC_POINTS = 16;
+  static constexpr u32 MIN_SYNC_SLOT_SIZE = 1024 * 1024;
   int Slot(u32 x) const { return x >> m_bit_per_slot; }
+  const int m_sync_points;
   const int m_bit_per_slot;
 
-  std::array<GLsync, SYNC_POINTS> m_fences{};
+  std::vector<GLsync> m_fences;
 };
 }  // namespace OGL
@@ -4,6 +4,7 @@
 #include "VideoBackends/Software/Rasterizer.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <vector>
 
@@ -19,11 +20,15 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/WorkerThreadPool.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace Rasterizer
 {
 static constexpr int BLOCK_SIZE = 2;
+static constexpr u32 MAX_WORKER_THREADS = 16;
+// Smaller triangles take about as long to draw as it takes to hand them to the workers.
+static constexpr s32 MIN_PARALLEL_PIXELS = 0x4000;
 
 struct SlopeContext
 {
@@ -101,8 +106,17 @@ static Slope WSlope;
 static Slope ColorSlopes[2][4];
 static Slope TexSlopes[8][3];
 
-static Tev tev;
-static RasterBlock rasterBlock;
+// Everything a thread drawing pixels modifies. The slopes above are only written while setting up
+// a triangle, so the threads drawing it can share them.
+struct RasterThreadState
+{
+  Tev tev;
+  RasterBlock raster_block;
+};
+
+// Tev keeps references to its own members, which is why these are never copied or moved.
+static std::array<RasterThreadState, MAX_WORKER_THREADS + 1> s_thread_states;
+static WorkerThreadPool s_thread_pool("Software Rasterizer Worker");
 
 static std::vector<BPFunctions::ScissorRect> scissors;
 
@@ -113,6 +127,11 @@ void Init()
   ZSlope = Slope();
 }
 
+void Shutdown()
+{
+  s_thread_pool.Stop();
+}
+
 void ScissorChanged()
 {
   scissors = std::move(BPFunctions::ComputeScissorRects().m_result);
@@ -140,31 +159,38 @@ static inline int iround(float x)
   return t;
 }
 
-void SetTevKonstColors()
+void SetupTev()
 {
-  tev.SetKonstColors();
+  for (RasterThreadState& state : s_thread_states)
+  {
+    state.tev.SetKonstColors();
+    state.tev.SetupStages();
+  }
 }
 
-static void Draw(s32 x, s32 y, s32 xi, s32 yi)
+static void Draw(RasterThreadState& state, s32 x, s32 y, s32 xi, s32 yi)
 {
-  INCSTAT(g_stats.this_frame.rasterized_pixels);
+  Tev& tev = state.tev;
+  const RasterBlock& rasterBlock = state.raster_block;
+
+  tev.counters.rasterized_pixels++;
 
   s32 z = (s32)std::clamp<float>(ZSlope.GetValue(x, y), 0.0f, 16777215.0f);
 
   if (bpmem.GetEmulatedZ() == EmulatedZ::Early)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
+    tev.counters.perf_quad_counts[PQ_ZCOMP_INPUT_ZCOMPLOC]++;
     if (bpmem.zmode.testenable)
     {
       // early z
       if (!EfbInterface::ZCompare(x, y, z))
         return;
     }
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT_ZCOMPLOC);
+    tev.counters.perf_quad_counts[PQ_ZCOMP_OUTPUT_ZCOMPLOC]++;
   }
 
-  RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
+  const RasterBlockPixel& pixel = rasterBlock.Pixel[xi][yi];
 
   tev.Position[0] = x;
   tev.Position[1] = y;
@@ -207,7 +233,8 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
   tev.Draw();
 }
 
-static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoord)
+static inline void CalculateLOD(const RasterBlock& rasterBlock, s32* lodp, bool* linear,
+                                u32 texmap, u32 texcoord)
 {
   auto texUnit = bpmem.tex.GetUnit(texmap);
 
@@ -218,9 +245,9 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
 
   float sDelta, tDelta;
 
-  float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
-  float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
-  float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
+  const float* uv00 = rasterBlock.Pixel[0][0].Uv[texcoord];
+  const float* uv10 = rasterBlock.Pixel[1][0].Uv[texcoord];
+  const float* uv01 = rasterBlock.Pixel[0][1].Uv[texcoord];
 
   float dudx = fabsf(uv00[0] - uv10[0]);
   float dvdx = fabsf(uv00[1] - uv10[1]);
@@ -258,8 +285,10 @@ static inline void CalculateLOD(s32* lodp, bool* linear, u32 texmap, u32 texcoor
   *lodp = lod;
 }
 
-static void BuildBlock(s32 blockX, s32 blockY)
+static void BuildBlock(RasterThreadState& state, s32 blockX, s32 blockY)
 {
+  RasterBlock& rasterBlock = state.raster_block;
+
   for (s32 yi = 0; yi < BLOCK_SIZE; yi++)
   {
     for (s32 xi = 0; xi < BLOCK_SIZE; xi++)
@@ -291,7 +320,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
     u32 texmap = bpmem.tevindref.getTexMap(i);
     u32 texcoord = bpmem.tevindref.getTexCoord(i);
 
-    CalculateLOD(&rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap, texcoord);
+    CalculateLOD(rasterBlock, &rasterBlock.IndirectLod[i], &rasterBlock.IndirectLinear[i], texmap,
+                 texcoord);
   }
 
   for (unsigned int i = 0; i <= bpmem.genMode.numtevstages; i++)
@@ -303,7 +333,8 @@ static void BuildBlock(s32 blockX, s32 blockY)
       u32 texmap = order.getTexMap(stageOdd);
       u32 texcoord = order.getTexCoord(stageOdd);
 
-      CalculateLOD(&rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap, texcoord);
+      CalculateLOD(rasterBlock, &rasterBlock.TextureLod[i], &rasterBlock.TextureLinear[i], texmap,
+                   texcoord);
     }
   }
 }
@@ -415,94 +446,130 @@ static void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertex
     C3++;
 
   // Start in corner of 2x2 block
-  s32 block_minx = minx & ~(BLOCK_SIZE - 1);
-  s32 block_miny = miny & ~(BLOCK_SIZE - 1);
+  const s32 block_minx = minx & ~(BLOCK_SIZE - 1);
+  const s32 block_miny = miny & ~(BLOCK_SIZE - 1);
 
-  // Loop through blocks
-  for (s32 y = block_miny & ~(BLOCK_SIZE - 1); y < maxy; y += BLOCK_SIZE)
-  {
-    for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
+  // Loop through the blocks of the rows from y_begin to y_end, which must be block aligned
+  const auto rasterize_block_rows = [&](RasterThreadState& state, s32 y_begin, s32 y_end) {
+    for (s32 y = y_begin; y < y_end; y += BLOCK_SIZE)
     {
-      s32 x1_ = (x + BLOCK_SIZE - 1);
-      s32 y1_ = (y + BLOCK_SIZE - 1);
-
-      // Corners of block
-      s32 x0 = x << 4;
-      s32 x1 = x1_ << 4;
-      s32 y0 = y << 4;
-      s32 y1 = y1_ << 4;
-
-      // Evaluate half-space functions
-      bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
-      bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
-      bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
-      bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
-      int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
-
-      bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
-      bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
-      bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
-      bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
-      int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
-
-      bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
-      bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
-      bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
-      bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
-      int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
-
-      // Skip block when outside an edge
-      if (a == 0x0 || b == 0x0 || c == 0x0)
-        continue;
-
-      BuildBlock(x, y);
-
-      // Accept whole block when totally covered
-      // We still need to check min/max x/y because of the scissor
-      if (a == 0xF && b == 0xF && c == 0xF && x >= minx && x1_ < maxx && y >= miny && y1_ < maxy)
+      for (s32 x = block_minx; x < maxx; x += BLOCK_SIZE)
       {
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        s32 x1_ = (x + BLOCK_SIZE - 1);
+        s32 y1_ = (y + BLOCK_SIZE - 1);
+
+        // Corners of block
+        s32 x0 = x << 4;
+        s32 x1 = x1_ << 4;
+        s32 y0 = y << 4;
+        s32 y1 = y1_ << 4;
+
+        // Evaluate half-space functions
+        bool a00 = C1 + DX12 * y0 - DY12 * x0 > 0;
+        bool a10 = C1 + DX12 * y0 - DY12 * x1 > 0;
+        bool a01 = C1 + DX12 * y1 - DY12 * x0 > 0;
+        bool a11 = C1 + DX12 * y1 - DY12 * x1 > 0;
+        int a = (a00 << 0) | (a10 << 1) | (a01 << 2) | (a11 << 3);
+
+        bool b00 = C2 + DX23 * y0 - DY23 * x0 > 0;
+        bool b10 = C2 + DX23 * y0 - DY23 * x1 > 0;
+        bool b01 = C2 + DX23 * y1 - DY23 * x0 > 0;
+        bool b11 = C2 + DX23 * y1 - DY23 * x1 > 0;
+        int b = (b00 << 0) | (b10 << 1) | (b01 << 2) | (b11 << 3);
+
+        bool c00 = C3 + DX31 * y0 - DY31 * x0 > 0;
+        bool c10 = C3 + DX31 * y0 - DY31 * x1 > 0;
+        bool c01 = C3 + DX31 * y1 - DY31 * x0 > 0;
+        bool c11 = C3 + DX31 * y1 - DY31 * x1 > 0;
+        int c = (c00 << 0) | (c10 << 1) | (c01 << 2) | (c11 << 3);
+
+        // Skip block when outside an edge
+        if (a == 0x0 || b == 0x0 || c == 0x0)
+          continue;
+
+        BuildBlock(state, x, y);
+
+        // Accept whole block when totally covered
+        // We still need to check min/max x/y because of the scissor
+        if (a == 0xF && b == 0xF && c == 0xF && x >= minx && x1_ < maxx && y >= miny &&
+            y1_ < maxy)
         {
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
           {
-            Draw(x + ix, y + iy, ix, iy);
+            for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+            {
+              Draw(state, x + ix, y + iy, ix, iy);
+            }
           }
         }
-      }
-      else  // Partially covered block
-      {
-        s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
-        s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
-        s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
-
-        for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
+        else  // Partially covered block
         {
-          s32 CX1 = CY1;
-          s32 CX2 = CY2;
-          s32 CX3 = CY3;
+          s32 CY1 = C1 + DX12 * y0 - DY12 * x0;
+          s32 CY2 = C2 + DX23 * y0 - DY23 * x0;
+          s32 CY3 = C3 + DX31 * y0 - DY31 * x0;
 
-          for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
+          for (s32 iy = 0; iy < BLOCK_SIZE; iy++)
           {
-            if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+            s32 CX1 = CY1;
+            s32 CX2 = CY2;
+            s32 CX3 = CY3;
+
+            for (s32 ix = 0; ix < BLOCK_SIZE; ix++)
             {
-              // This check enforces the scissor rectangle, since it might not be aligned with the
-              // blocks
-              if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
-                Draw(x + ix, y + iy, ix, iy);
+              if (CX1 > 0 && CX2 > 0 && CX3 > 0)
+              {
+                // This check enforces the scissor rectangle, since it might not be aligned with
+                // the blocks
+                if (x + ix >= minx && x + ix < maxx && y + iy >= miny && y + iy < maxy)
+                  Draw(state, x + ix, y + iy, ix, iy);
+              }
+
+              CX1 -= FDY12;
+              CX2 -= FDY23;
+              CX3 -= FDY31;
             }
 
-            CX1 -= FDY12;
-            CX2 -= FDY23;
-            CX3 -= FDY31;
+            CY1 += FDX12;
+            CY2 += FDX23;
+            CY3 += FDX31;
           }
-
-          CY1 += FDX12;
-          CY2 += FDX23;
-          CY3 += FDX31;
         }
       }
     }
+  };
+
+  const u32 num_threads = std::min(
+      static_cast<u32>(std::max(g_ActiveConfig.iSWRasterizerThreads, 0)), MAX_WORKER_THREADS);
+  if (s_thread_pool.GetNumThreads() != num_threads) [[unlikely]]
+    s_thread_pool.Start(num_threads);
+
+  // Every band needs at least two block rows, see below.
+  const s32 num_block_rows = (maxy - block_miny + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  const s32 num_bands = std::min(static_cast<s32>(num_threads) + 1, num_block_rows / 2);
+  if (num_bands < 2 || (maxx - minx) * (maxy - miny) < MIN_PARALLEL_PIXELS)
+  {
+    rasterize_block_rows(s_thread_states[0], block_miny, maxy);
+    s_thread_states[0].tev.FlushCounters();
+    return;
   }
+
+  // The pixels of different rows never overlap, so the bands can be drawn at the same time, each
+  // with its own Tev. Writing a pixel to the EFB reads and writes back the first byte of the
+  // following pixel though, so the last pixel of a row touches the first pixel of the next row (or
+  // of the depth buffer). The last block row of each band is therefore only drawn afterwards.
+  const auto band_begin = [&](s32 band) {
+    return block_miny + num_block_rows * band / num_bands * BLOCK_SIZE;
+  };
+  s_thread_pool.Run(static_cast<size_t>(num_bands), [&](size_t index) {
+    const s32 band = static_cast<s32>(index);
+    rasterize_block_rows(s_thread_states[index], band_begin(band),
+                         band_begin(band + 1) - BLOCK_SIZE);
+  });
+  for (s32 band = 1; band <= num_bands; band++)
+    rasterize_block_rows(s_thread_states[0], band_begin(band) - BLOCK_SIZE, band_begin(band));
+
+  for (s32 band = 0; band < num_bands; band++)
+    s_thread_states[band].tev.FlushCounters();
 }
 
 void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v1,
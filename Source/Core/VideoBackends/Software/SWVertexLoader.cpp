@@ -67,7 +67,7 @@ void SWVertexLoader::DrawCurrentBatch(u32 base_index, u32 num_indices, u32 base_
     g_bounding_box->Flush();
 
   m_setup_unit.Init(primitive_type);
-  Rasterizer::SetTevKonstColors();
+  Rasterizer::SetupTev();
 
   for (u32 i = 0; i < m_index_generator.GetIndexLen(); i++)
   {
@@ -39,28 +39,26 @@ static inline s16 Clamp1024(s16 in)
   return std::clamp<s16>(in, -1024, 1023);
 }
 
-void Tev::SetRasColor(RasColorChan colorChan, u32 swaptable)
+void Tev::SetRasColor(RasColorChan colorChan, const std::array<u8, 4>& swap)
 {
   switch (colorChan)
   {
   case RasColorChan::Color0:
   {
     const u8* color = Color[0];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    RasColor.r = color[swap[0]];
+    RasColor.g = color[swap[1]];
+    RasColor.b = color[swap[2]];
+    RasColor.a = color[swap[3]];
   }
   break;
   case RasColorChan::Color1:
   {
     const u8* color = Color[1];
-    const auto& swap = bpmem.tevksel.GetSwapTable(swaptable);
-    RasColor.r = color[u32(swap[ColorChannel::Red])];
-    RasColor.g = color[u32(swap[ColorChannel::Green])];
-    RasColor.b = color[u32(swap[ColorChannel::Blue])];
-    RasColor.a = color[u32(swap[ColorChannel::Alpha])];
+    RasColor.r = color[swap[0]];
+    RasColor.g = color[swap[1]];
+    RasColor.b = color[swap[2]];
+    RasColor.a = color[swap[3]];
   }
   break;
   case RasColorChan::AlphaBump:
@@ -397,66 +395,40 @@ void Tev::Draw()
   ASSERT(Position[0] >= 0 && Position[0] < s32(EFB_WIDTH));
   ASSERT(Position[1] >= 0 && Position[1] < s32(EFB_HEIGHT));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_in);
-
-  auto& system = Core::System::GetInstance();
-  auto& pixel_shader_manager = system.GetPixelShaderManager();
+  counters.tev_pixels_in++;
 
   // initial color values
   for (int i = 0; i < 4; i++)
-  {
-    Reg[static_cast<TevOutput>(i)].r = pixel_shader_manager.constants.colors[i][0];
-    Reg[static_cast<TevOutput>(i)].g = pixel_shader_manager.constants.colors[i][1];
-    Reg[static_cast<TevOutput>(i)].b = pixel_shader_manager.constants.colors[i][2];
-    Reg[static_cast<TevOutput>(i)].a = pixel_shader_manager.constants.colors[i][3];
-  }
+    Reg[static_cast<TevOutput>(i)] = m_initial_regs[i];
 
   for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-
-    u32 texcoordSel = bpmem.tevindref.getTexCoord(stageNum);
-    const u32 texmap = bpmem.tevindref.getTexMap(stageNum);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
-    // the number of tex gens to 2 (bug 11462).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
-
-    const TEXSCALE& texscale = bpmem.texscale[stageNum2];
-    const s32 scaleS = stageOdd ? texscale.ss1 : texscale.ss0;
-    const s32 scaleT = stageOdd ? texscale.ts1 : texscale.ts0;
-
-    TextureSampler::Sample(Uv[texcoordSel].s >> scaleS, Uv[texcoordSel].t >> scaleT,
-                           IndirectLod[stageNum], IndirectLinear[stageNum], texmap,
-                           IndirectTex[stageNum]);
+    const IndirectStageSetup& stage = m_indirect_stages[stageNum];
+    TextureSampler::Sample(Uv[stage.texcoord].s >> stage.scale_s,
+                           Uv[stage.texcoord].t >> stage.scale_t, IndirectLod[stageNum],
+                           IndirectLinear[stageNum], stage.texmap, IndirectTex[stageNum]);
   }
 
   for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
   {
-    const int stageNum2 = stageNum >> 1;
-    const int stageOdd = stageNum & 1;
-    const TwoTevStageOrders& order = bpmem.tevorders[stageNum2];
+    const StageSetup& stage = m_stages[stageNum];
 
     // stage combiners
-    const TevStageCombiner::ColorCombiner& cc = bpmem.combiners[stageNum].colorC;
-    const TevStageCombiner::AlphaCombiner& ac = bpmem.combiners[stageNum].alphaC;
+    const TevStageCombiner::ColorCombiner& cc = stage.cc;
+    const TevStageCombiner::AlphaCombiner& ac = stage.ac;
 
-    u32 texcoordSel = order.getTexCoord(stageOdd);
-    const u32 texmap = order.getTexMap(stageOdd);
-
-    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
-    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
-    if (texcoordSel >= bpmem.genMode.numtexgens)
-      texcoordSel = 0;
-
-    Indirect(stageNum, Uv[texcoordSel].s, Uv[texcoordSel].t);
+    if (stage.indirect_enabled)
+    {
+      Indirect(stageNum, Uv[stage.texcoord].s, Uv[stage.texcoord].t);
+    }
+    else
+    {
+      TexCoord = Uv[stage.texcoord];
+      AlphaBump = 0;
+    }
 
     // sample texture
-    if (order.getEnable(stageOdd))
+    if (stage.texture_enabled)
     {
       // RGBA
       u8 texel[4];
@@ -464,7 +436,7 @@ void Tev::Draw()
       if (bpmem.genMode.numtexgens > 0)
       {
         TextureSampler::Sample(TexCoord.s, TexCoord.t, TextureLod[stageNum],
-                               TextureLinear[stageNum], texmap, texel);
+                               TextureLinear[stageNum], stage.texmap, texel);
       }
       else
       {
@@ -473,23 +445,20 @@ void Tev::Draw()
         std::memset(texel, 0, 4);
       }
 
-      const auto& swap = bpmem.tevksel.GetSwapTable(ac.tswap);
-      TexColor.r = texel[u32(swap[ColorChannel::Red])];
-      TexColor.g = texel[u32(swap[ColorChannel::Green])];
-      TexColor.b = texel[u32(swap[ColorChannel::Blue])];
-      TexColor.a = texel[u32(swap[ColorChannel::Alpha])];
+      TexColor.r = texel[stage.tex_swap[0]];
+      TexColor.g = texel[stage.tex_swap[1]];
+      TexColor.b = texel[stage.tex_swap[2]];
+      TexColor.a = texel[stage.tex_swap[3]];
     }
 
     // set konst for this stage
-    const auto kc = bpmem.tevksel.GetKonstColor(stageNum);
-    const auto ka = bpmem.tevksel.GetKonstAlpha(stageNum);
-    StageKonst.r = m_KonstLUT[kc].r;
-    StageKonst.g = m_KonstLUT[kc].g;
-    StageKonst.b = m_KonstLUT[kc].b;
-    StageKonst.a = m_KonstLUT[ka].a;
+    StageKonst.r = m_KonstLUT[stage.konst_color].r;
+    StageKonst.g = m_KonstLUT[stage.konst_color].g;
+    StageKonst.b = m_KonstLUT[stage.konst_color].b;
+    StageKonst.a = m_KonstLUT[stage.konst_alpha].a;
 
     // set color
-    SetRasColor(order.getColorChan(stageOdd), ac.rswap);
+    SetRasColor(stage.ras_chan, stage.ras_swap);
 
     // combine inputs
     InputRegType inputs[4];
@@ -666,25 +635,51 @@ void Tev::Draw()
   if (bpmem.GetEmulatedZ() == EmulatedZ::Late)
   {
     // TODO: Check against hw if these values get incremented even if depth testing is disabled
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT);
+    counters.perf_quad_counts[PQ_ZCOMP_INPUT]++;
 
     if (!EfbInterface::ZCompare(Position[0], Position[1], Position[2]))
       return;
 
-    EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_OUTPUT);
+    counters.perf_quad_counts[PQ_ZCOMP_OUTPUT]++;
   }
 
   // The GC/Wii GPU rasterizes in 2x2 pixel groups, so bounding box values will be rounded to the
   // extents of these groups, rather than the exact pixel.
-  BBoxManager::Update(static_cast<u16>(Position[0] & ~1), static_cast<u16>(Position[0] | 1),
-                      static_cast<u16>(Position[1] & ~1), static_cast<u16>(Position[1] | 1));
+  counters.bbox_left = std::min(counters.bbox_left, static_cast<u16>(Position[0] & ~1));
+  counters.bbox_right = std::max(counters.bbox_right, static_cast<u16>(Position[0] | 1));
+  counters.bbox_top = std::min(counters.bbox_top, static_cast<u16>(Position[1] & ~1));
+  counters.bbox_bottom = std::max(counters.bbox_bottom, static_cast<u16>(Position[1] | 1));
 
-  INCSTAT(g_stats.this_frame.tev_pixels_out);
-  EfbInterface::IncPerfCounterQuadCount(PQ_BLEND_INPUT);
+  counters.tev_pixels_out++;
+  counters.perf_quad_counts[PQ_BLEND_INPUT]++;
 
   EfbInterface::BlendTev(Position[0], Position[1], output);
 }
 
+void Tev::FlushCounters()
+{
+  for (u32 type = 0; type < PQ_NUM_MEMBERS; type++)
+  {
+    if (counters.perf_quad_counts[type] != 0)
+    {
+      EfbInterface::IncPerfCounterQuadCount(static_cast<PerfQueryType>(type),
+                                            counters.perf_quad_counts[type]);
+    }
+  }
+
+  if (counters.bbox_left <= counters.bbox_right)
+  {
+    BBoxManager::Update(counters.bbox_left, counters.bbox_right, counters.bbox_top,
+                        counters.bbox_bottom);
+  }
+
+  ADDSTAT(g_stats.this_frame.rasterized_pixels, counters.rasterized_pixels);
+  ADDSTAT(g_stats.this_frame.tev_pixels_in, counters.tev_pixels_in);
+  ADDSTAT(g_stats.this_frame.tev_pixels_out, counters.tev_pixels_out);
+
+  counters = {};
+}
+
 void Tev::SetKonstColors()
 {
   auto& system = Core::System::GetInstance();
@@ -698,3 +693,72 @@ void Tev::SetKonstColors()
     KonstantColors[i].a = pixel_shader_manager.constants.kcolors[i][3];
   }
 }
+
+void Tev::SetupStages()
+{
+  auto& system = Core::System::GetInstance();
+  auto& pixel_shader_manager = system.GetPixelShaderManager();
+
+  for (int i = 0; i < 4; i++)
+  {
+    m_initial_regs[i].r = pixel_shader_manager.constants.colors[i][0];
+    m_initial_regs[i].g = pixel_shader_manager.constants.colors[i][1];
+    m_initial_regs[i].b = pixel_shader_manager.constants.colors[i][2];
+    m_initial_regs[i].a = pixel_shader_manager.constants.colors[i][3];
+  }
+
+  const auto decode_swap = [](u32 swap_table) {
+    const auto swap = bpmem.tevksel.GetSwapTable(swap_table);
+    return std::array<u8, 4>{
+        static_cast<u8>(swap[ColorChannel::Red]), static_cast<u8>(swap[ColorChannel::Green]),
+        static_cast<u8>(swap[ColorChannel::Blue]), static_cast<u8>(swap[ColorChannel::Alpha])};
+  };
+
+  for (unsigned int stageNum = 0; stageNum < bpmem.genMode.numindstages; stageNum++)
+  {
+    const int stageNum2 = stageNum >> 1;
+    const int stageOdd = stageNum & 1;
+    IndirectStageSetup& stage = m_indirect_stages[stageNum];
+
+    stage.texcoord = bpmem.tevindref.getTexCoord(stageNum);
+    stage.texmap = bpmem.tevindref.getTexMap(stageNum);
+
+    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+    // This affects the Mario portrait in Luigi's Mansion, where the developers forgot to set
+    // the number of tex gens to 2 (bug 11462).
+    if (stage.texcoord >= bpmem.genMode.numtexgens)
+      stage.texcoord = 0;
+
+    const TEXSCALE& texscale = bpmem.texscale[stageNum2];
+    stage.scale_s = stageOdd ? texscale.ss1 : texscale.ss0;
+    stage.scale_t = stageOdd ? texscale.ts1 : texscale.ts0;
+  }
+
+  for (unsigned int stageNum = 0; stageNum <= bpmem.genMode.numtevstages; stageNum++)
+  {
+    const int stageNum2 = stageNum >> 1;
+    const int stageOdd = stageNum & 1;
+    const TwoTevStageOrders& order = bpmem.tevorders[stageNum2];
+    StageSetup& stage = m_stages[stageNum];
+
+    stage.cc.hex = bpmem.combiners[stageNum].colorC.hex;
+    stage.ac.hex = bpmem.combiners[stageNum].alphaC.hex;
+
+    stage.texcoord = order.getTexCoord(stageOdd);
+    stage.texmap = order.getTexMap(stageOdd);
+
+    // Quirk: when the tex coord is not less than the number of tex gens (i.e. the tex coord does
+    // not exist), then tex coord 0 is used (though sometimes glitchy effects happen on console).
+    if (stage.texcoord >= bpmem.genMode.numtexgens)
+      stage.texcoord = 0;
+
+    stage.texture_enabled = order.getEnable(stageOdd);
+    stage.indirect_enabled = bpmem.tevind[stageNum].hex != 0;
+    stage.ras_chan = order.getColorChan(stageOdd);
+    stage.konst_color = bpmem.tevksel.GetKonstColor(stageNum);
+    stage.konst_alpha = bpmem.tevksel.GetKonstAlpha(stageNum);
+    stage.tex_swap = decode_swap(stage.ac.tswap);
+    stage.ras_swap = decode_swap(stage.ac.rswap);
+  }
+}
@@ -5,8 +5,10 @@
 
 #include <array>
 
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
 #include "VideoCommon/BPMemory.h"
+#include "VideoCommon/PerfQueryBase.h"
 
 class Tev
 {
@@ -203,7 +205,38 @@ class Tev
     INDIRECT = 32
   };
 
-  void SetRasColor(RasColorChan colorChan, u32 swaptable);
+  // The parts of the indirect and TEV stage configuration which are looked up for every pixel,
+  // decoded from bpmem once per draw by SetupStages.
+  struct IndirectStageSetup
+  {
+    u32 texcoord = 0;
+    u32 texmap = 0;
+    s32 scale_s = 0;
+    s32 scale_t = 0;
+  };
+
+  struct StageSetup
+  {
+    TevStageCombiner::ColorCombiner cc{};
+    TevStageCombiner::AlphaCombiner ac{};
+    u32 texcoord = 0;
+    u32 texmap = 0;
+    bool texture_enabled = false;
+    // A zero tevind passes the tex coord through unchanged, so Indirect can be skipped.
+    bool indirect_enabled = false;
+    RasColorChan ras_chan = RasColorChan::Zero;
+    KonstSel konst_color = KonstSel::V1;
+    KonstSel konst_alpha = KonstSel::V1;
+    // Which component of the texel or rasterized color ends up in r, g, b and a
+    std::array<u8, 4> tex_swap{};
+    std::array<u8, 4> ras_swap{};
+  };
+
+  std::array<IndirectStageSetup, 4> m_indirect_stages;
+  std::array<StageSetup, 16> m_stages;
+  std::array<TevColor, 4> m_initial_regs;
+
+  void SetRasColor(RasColorChan colorChan, const std::array<u8, 4>& swap);
 
   void DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
   void DrawColorCompare(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4]);
@@ -229,6 +262,24 @@ public:
     RED_C
   };
 
+  // What the pixels drawn since the last FlushCounters call added to the perf counters, bounding
+  // box and statistics. These are only applied to the shared state by FlushCounters, so that
+  // several threads can draw with their own Tev at the same time.
+  struct Counters
+  {
+    std::array<u32, PQ_NUM_MEMBERS> perf_quad_counts{};
+    u16 bbox_left = 0xFFFF;
+    u16 bbox_right = 0;
+    u16 bbox_top = 0xFFFF;
+    u16 bbox_bottom = 0;
+    int rasterized_pixels = 0;
+    int tev_pixels_in = 0;
+    int tev_pixels_out = 0;
+  };
+  Counters counters;
+
   void SetKonstColors();
+  void SetupStages();
   void Draw();
+  void FlushCounters();
 };
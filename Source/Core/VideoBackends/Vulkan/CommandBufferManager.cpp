@@ -239,6 +239,15 @@ void CommandBufferManager::WaitForWorkerThreadIdle()
   m_submit_thread.WaitForCompletion();
 }
 
+void CommandBufferManager::WaitForLastPresent()
+{
+  if (!m_present_pending)
+    return;
+
+  m_last_present_done.Wait();
+  m_present_pending = false;
+}
+
 void CommandBufferManager::WaitForFenceCounter(u64 fence_counter)
 {
   if (m_completed_fence_counter >= fence_counter)
@@ -336,6 +345,7 @@ void CommandBufferManager::SubmitCommandBuffer(bool submit_on_worker_thread,
 
   if (present_swap_chain != VK_NULL_HANDLE)
   {
+    m_present_pending = true;
     m_current_frame = (m_current_frame + 1) % NUM_FRAMES_IN_FLIGHT;
 
     // Wait for all command buffers that used the descriptor pool to finish
@@ -440,7 +450,6 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
                                      nullptr};
 
     m_last_present_result = vkQueuePresentKHR(g_vulkan_context->GetPresentQueue(), &present_info);
-    m_last_present_done.Set();
     if (m_last_present_result != VK_SUCCESS)
     {
       // VK_ERROR_OUT_OF_DATE_KHR is not fatal, just means we need to recreate our swap chain.
@@ -460,6 +469,8 @@ void CommandBufferManager::SubmitCommandBuffer(u32 command_buffer_index,
       m_last_present_failed.Set();
 #endif
     }
+
+    m_last_present_done.Set();
   }
 }
 
@@ -16,6 +16,7 @@
 
 #include <Common/WorkQueueThread.h>
 #include "Common/BlockingLoop.h"
+#include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/Semaphore.h"
 
@@ -84,7 +85,11 @@ public:
   // Was the last present submitted to the queue a failure? If so, we must recreate our swapchain.
   bool CheckLastPresentFail() { return m_last_present_failed.TestAndClear(); }
   VkResult GetLastPresentResult() const { return m_last_present_result; }
-  bool CheckLastPresentDone() { return m_last_present_done.TestAndClear(); }
+
+  // Waits until the last present has been passed to the driver. The swap chain may not be used by
+  // two threads at once, so this has to be called before acquiring the next image. Unlike waiting
+  // for the worker thread to become idle, this doesn't wait for any later submissions.
+  void WaitForLastPresent();
 
   // Schedule a vulkan resource for destruction later on. This will occur when the command buffer
   // is next re-used, and the GPU has finished working with the specified resource.
@@ -156,7 +161,8 @@ private:
   Common::WorkQueueThread<PendingCommandBufferSubmit> m_submit_thread;
   VkSemaphore m_present_semaphore = VK_NULL_HANDLE;
   Common::Flag m_last_present_failed;
-  Common::Flag m_last_present_done;
+  Common::Event m_last_present_done;
+  bool m_present_pending = false;
   VkResult m_last_present_result = VK_SUCCESS;
   bool m_use_threaded_submission = false;
   u32 m_descriptor_set_count = DESCRIPTOR_SETS_PER_POOL;
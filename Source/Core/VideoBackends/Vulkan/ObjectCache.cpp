@@ -32,6 +32,8 @@ ObjectCache::ObjectCache() = default;
 
 ObjectCache::~ObjectCache()
 {
+  m_pipeline_link_thread.Shutdown(true);
+  DestroyPipelineLibraries();
   DestroyPipelineCache();
   DestroySamplers();
   DestroyPipelineLayouts();
@@ -70,11 +72,20 @@ bool ObjectCache::Initialize()
       return false;
   }
 
+  if (g_vulkan_context->SupportsGraphicsPipelineLibrary())
+  {
+    m_pipeline_link_thread.Reset("Vulkan Pipeline Linker",
+                                 [](std::function<void()> work) { work(); });
+  }
+
   return true;
 }
 
 void ObjectCache::Shutdown()
 {
+  // Pending optimized links are dropped, the fast-linked pipelines stay usable until destroyed.
+  m_pipeline_link_thread.Shutdown(true);
+
   if (g_ActiveConfig.bShaderCache && m_pipeline_cache != VK_NULL_HANDLE)
     SavePipelineCache();
 }
@@ -188,16 +199,23 @@ bool ObjectCache::CreateDescriptorSetLayouts()
 
   std::array<VkDescriptorSetLayoutBinding, 4> ubo_bindings = standard_ubo_bindings;
 
+  // Samplers change far more often than the other bindings, so push them when we can rather than
+  // allocating and writing a new set from the pool each time.
+  const VkDescriptorSetLayoutCreateFlags sampler_set_flags =
+      g_vulkan_context->SupportsPushDescriptors() ?
+          VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR :
+          0;
+
   std::array<VkDescriptorSetLayoutCreateInfo, NUM_DESCRIPTOR_SET_LAYOUTS> create_infos{{
       {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
        static_cast<u32>(ubo_bindings.size()), ubo_bindings.data()},
-      {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
+      {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, sampler_set_flags,
        static_cast<u32>(standard_sampler_bindings.size()), standard_sampler_bindings.data()},
       {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
        static_cast<u32>(standard_ssbo_bindings.size()), standard_ssbo_bindings.data()},
       {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
        static_cast<u32>(utility_ubo_bindings.size()), utility_ubo_bindings.data()},
-      {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
+      {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, sampler_set_flags,
        static_cast<u32>(utility_sampler_bindings.size()), utility_sampler_bindings.data()},
       {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, nullptr, 0,
        static_cast<u32>(compute_set_bindings.size()), compute_set_bindings.data()},
@@ -216,6 +234,10 @@ bool ObjectCache::CreateDescriptorSetLayouts()
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_UNIFORM_BUFFERS].bindingCount--;
   }
 
+  // Multiview vertex shaders apply the stereo offset themselves.
+  if (g_vulkan_context->SupportsMultiview())
+    ubo_bindings[UBO_DESCRIPTOR_SET_BINDING_GS].stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
+
   // Remove the dynamic vertex loader's buffer if it'll never be needed
   if (!g_ActiveConfig.backend_info.bSupportsDynamicVertexLoader)
     create_infos[DESCRIPTOR_SET_LAYOUT_STANDARD_SHADER_STORAGE_BUFFERS].bindingCount--;
@@ -418,10 +440,19 @@ VkSampler ObjectCache::GetSampler(const SamplerState& info)
 
 VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
                                         u32 multisamples, VkAttachmentLoadOp load_op,
-                                        u8 additional_attachment_count)
+                                        u8 additional_attachment_count, u32 view_count)
+{
+  return GetRenderPass(color_format, depth_format, multisamples, load_op, load_op,
+                       additional_attachment_count, view_count);
+}
+
+VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_format,
+                                        u32 multisamples, VkAttachmentLoadOp color_load_op,
+                                        VkAttachmentLoadOp depth_load_op,
+                                        u8 additional_attachment_count, u32 view_count)
 {
-  auto key =
-      std::tie(color_format, depth_format, multisamples, load_op, additional_attachment_count);
+  auto key = std::tie(color_format, depth_format, multisamples, color_load_op, depth_load_op,
+                      additional_attachment_count, view_count);
   auto it = m_render_pass_cache.find(key);
   if (it != m_render_pass_cache.end())
     return it->second;
@@ -437,8 +468,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     color_reference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     color_attachment_references.push_back(std::move(color_reference));
     attachments.push_back({0, color_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           color_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
   }
@@ -448,8 +479,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     depth_reference.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     depth_reference_ptr = &depth_reference;
     attachments.push_back({0, depth_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           depth_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL});
   }
@@ -461,8 +492,8 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
     color_reference.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
     color_attachment_references.push_back(std::move(color_reference));
     attachments.push_back({0, color_format, static_cast<VkSampleCountFlagBits>(multisamples),
-                           load_op, VK_ATTACHMENT_STORE_OP_STORE, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                           VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                           color_load_op, VK_ATTACHMENT_STORE_OP_STORE,
+                           VK_ATTACHMENT_LOAD_OP_DONT_CARE, VK_ATTACHMENT_STORE_OP_DONT_CARE,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
   }
@@ -488,6 +519,14 @@ VkRenderPass ObjectCache::GetRenderPass(VkFormat color_format, VkFormat depth_fo
                                       0,
                                       nullptr};
 
+  // The views are rendered from the same position, so let the driver share work between them.
+  const u32 view_mask = (1u << view_count) - 1;
+  VkRenderPassMultiviewCreateInfo multiview_info = {
+      VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO, nullptr, 1, &view_mask, 0, nullptr, 1,
+      &view_mask};
+  if (view_count > 1)
+    pass_info.pNext = &multiview_info;
+
   VkRenderPass pass;
   VkResult res = vkCreateRenderPass(g_vulkan_context->GetDevice(), &pass_info, nullptr, &pass);
   if (res != VK_SUCCESS)
@@ -507,6 +546,62 @@ void ObjectCache::DestroyRenderPassCache()
   m_render_pass_cache.clear();
 }
 
+VkPipeline ObjectCache::GetPipelineLibrary(const PipelineLibraryKey& key,
+                                           const std::function<VkPipeline()>& create)
+{
+  {
+    std::lock_guard guard(m_pipeline_library_lock);
+    auto it = m_pipeline_library_cache.find(key);
+    if (it != m_pipeline_library_cache.end())
+      return it->second;
+  }
+
+  // Compile outside the lock, so the other compiler threads can keep linking cached parts.
+  VkPipeline library = create();
+  if (library == VK_NULL_HANDLE)
+    return VK_NULL_HANDLE;
+
+  std::lock_guard guard(m_pipeline_library_lock);
+  auto [it, inserted] = m_pipeline_library_cache.emplace(key, library);
+  if (!inserted)
+  {
+    // Another thread built the same part first.
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), library, nullptr);
+  }
+
+  return it->second;
+}
+
+void ObjectCache::ClearPipelineLibraries(VkShaderModule module)
+{
+  std::lock_guard guard(m_pipeline_library_lock);
+  for (auto it = m_pipeline_library_cache.begin(); it != m_pipeline_library_cache.end();)
+  {
+    if (std::get<2>(it->first) == module || std::get<3>(it->first) == module)
+    {
+      vkDestroyPipeline(g_vulkan_context->GetDevice(), it->second, nullptr);
+      it = m_pipeline_library_cache.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+void ObjectCache::DestroyPipelineLibraries()
+{
+  std::lock_guard guard(m_pipeline_library_lock);
+  for (auto& it : m_pipeline_library_cache)
+    vkDestroyPipeline(g_vulkan_context->GetDevice(), it.second, nullptr);
+  m_pipeline_library_cache.clear();
+}
+
+void ObjectCache::QueuePipelineLink(std::function<void()> work)
+{
+  m_pipeline_link_thread.Push(std::move(work));
+}
+
 class PipelineCacheReadCallback : public Common::LinearDiskCacheReader<u32, u8>
 {
 public:
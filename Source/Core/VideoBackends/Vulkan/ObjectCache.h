@@ -5,18 +5,22 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 
 #include "Common/CommonTypes.h"
 #include "Common/LinearDiskCache.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoBackends/Vulkan/Constants.h"
 
 #include "VideoCommon/GeometryShaderGen.h"
+#include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/VertexShaderGen.h"
@@ -59,12 +63,35 @@ public:
   VkSampler GetSampler(const SamplerState& info);
 
   // Render pass cache.
+  // A view count above 1 makes a multiview render pass, where each layer is a view.
   VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
-                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0);
+                             VkAttachmentLoadOp load_op, u8 additional_attachment_count = 0,
+                             u32 view_count = 1);
+  // Render passes only differing in load ops are compatible, so a pass which clears one attachment
+  // and loads the other can be used with any pipeline created for the framebuffer.
+  VkRenderPass GetRenderPass(VkFormat color_format, VkFormat depth_format, u32 multisamples,
+                             VkAttachmentLoadOp color_load_op, VkAttachmentLoadOp depth_load_op,
+                             u8 additional_attachment_count = 0, u32 view_count = 1);
 
   // Pipeline cache. Used when creating pipelines for drivers to store compiled programs.
   VkPipelineCache GetPipelineCache() const { return m_pipeline_cache; }
 
+  // Graphics pipeline library cache. Each part of a pipeline is keyed by the shaders and state it
+  // was built from, and shared by every pipeline it is linked into. The callback creates the part
+  // when it is not cached yet. Safe to call from the shader compiler threads.
+  // Key: part, vertex declaration, shader modules, state words, render pass, layout.
+  using PipelineLibraryKey =
+      std::tuple<u32, PortableVertexDeclaration, VkShaderModule, VkShaderModule, u32, u32,
+                 VkRenderPass, VkPipelineLayout>;
+  VkPipeline GetPipelineLibrary(const PipelineLibraryKey& key,
+                                const std::function<VkPipeline()>& create);
+
+  // Destroys the libraries built from a shader module. Call before the module is destroyed.
+  void ClearPipelineLibraries(VkShaderModule module);
+
+  // Runs work on the background thread which builds link-time optimized pipelines.
+  void QueuePipelineLink(std::function<void()> work);
+
   // Clear sampler cache, use when anisotropy mode changes
   // WARNING: Ensure none of the objects from here are in use when calling
   void ClearSamplerCache();
@@ -83,6 +110,7 @@ private:
   bool CreateStaticSamplers();
   void DestroySamplers();
   void DestroyRenderPassCache();
+  void DestroyPipelineLibraries();
   bool CreatePipelineCache();
   bool LoadPipelineCache();
   bool ValidatePipelineCache(const u8* data, size_t data_length);
@@ -102,9 +130,15 @@ private:
   std::unique_ptr<VKTexture> m_dummy_texture;
 
   // Render pass cache
-  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp, std::size_t>;
+  using RenderPassCacheKey = std::tuple<VkFormat, VkFormat, u32, VkAttachmentLoadOp,
+                                        VkAttachmentLoadOp, std::size_t, u32>;
   std::map<RenderPassCacheKey, VkRenderPass> m_render_pass_cache;
 
+  // Graphics pipeline library parts, and the thread doing optimized links of them
+  std::map<PipelineLibraryKey, VkPipeline> m_pipeline_library_cache;
+  std::mutex m_pipeline_library_lock;
+  Common::WorkQueueThread<std::function<void()>> m_pipeline_link_thread;
+
   // pipeline cache
   VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
   std::string m_pipeline_cache_filename;
@@ -88,16 +88,24 @@ static const char SUBGROUP_HELPER_HEADER[] = R"(
   #define SUBGROUP_MAX(value) value = subgroupMax(value)
 )";
 
+static const char MULTIVIEW_HEADER[] = R"(
+  #extension GL_EXT_multiview : enable
+)";
+
 static std::string GetShaderCode(std::string_view source, std::string_view header)
 {
   std::string full_source_code;
   if (!header.empty())
   {
     constexpr size_t subgroup_helper_header_length = std::size(SUBGROUP_HELPER_HEADER) - 1;
-    full_source_code.reserve(header.size() + subgroup_helper_header_length + source.size());
+    constexpr size_t multiview_header_length = std::size(MULTIVIEW_HEADER) - 1;
+    full_source_code.reserve(header.size() + subgroup_helper_header_length +
+                             multiview_header_length + source.size());
     full_source_code.append(header);
     if (g_vulkan_context->SupportsShaderSubgroupOperations())
       full_source_code.append(SUBGROUP_HELPER_HEADER, subgroup_helper_header_length);
+    if (g_vulkan_context->SupportsMultiview())
+      full_source_code.append(MULTIVIEW_HEADER, multiview_header_length);
     full_source_code.append(source);
   }
 
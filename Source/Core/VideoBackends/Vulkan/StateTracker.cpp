@@ -3,6 +3,8 @@
 
 #include "VideoBackends/Vulkan/StateTracker.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 
 #include "VideoBackends/Vulkan/CommandBufferManager.h"
@@ -14,6 +16,9 @@
 #include "VideoBackends/Vulkan/VKVertexFormat.h"
 #include "VideoBackends/Vulkan/VulkanContext.h"
 #include "VideoCommon/Constants.h"
+#include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace Vulkan
 {
@@ -270,11 +275,12 @@ void StateTracker::UnbindTexture(VkImageView view)
 void StateTracker::InvalidateCachedState()
 {
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
+  m_gx_sampler_descriptor_sets.clear();
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
   m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR |
                    DIRTY_FLAG_PIPELINE | DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS |
-                   DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
+                   DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET | DIRTY_FLAG_SHADING_RATE;
   if (m_vertex_buffer != VK_NULL_HANDLE)
     m_dirty_flags |= DIRTY_FLAG_VERTEX_BUFFER;
   if (m_index_buffer != VK_NULL_HANDLE)
@@ -288,6 +294,7 @@ void StateTracker::BeginRenderPass()
 
   m_current_render_pass = m_framebuffer->GetLoadRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
+  CountRenderPass(true, true);
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
@@ -308,6 +315,7 @@ void StateTracker::BeginDiscardRenderPass()
 
   m_current_render_pass = m_framebuffer->GetDiscardRenderPass();
   m_framebuffer_render_area = m_framebuffer->GetRect();
+  CountRenderPass(false, false);
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
@@ -328,15 +336,23 @@ void StateTracker::EndRenderPass()
 
   vkCmdEndRenderPass(g_command_buffer_mgr->GetCurrentCommandBuffer());
   m_current_render_pass = VK_NULL_HANDLE;
+  m_in_clear_render_pass = false;
+  ADDSTAT(g_stats.this_frame.bytes_render_pass_stored,
+          m_framebuffer->GetColorAttachmentsSizeInBytes() +
+              m_framebuffer->GetDepthAttachmentSizeInBytes());
 }
 
 void StateTracker::BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
-                                        u32 num_clear_values)
+                                        u32 num_clear_values, bool clear_color, bool clear_depth)
 {
   ASSERT(!InRenderPass());
 
-  m_current_render_pass = m_framebuffer->GetClearRenderPass();
+  m_current_render_pass = (clear_color && clear_depth) ?
+                              m_framebuffer->GetClearRenderPass() :
+                              m_framebuffer->GetPartialClearRenderPass(clear_color, clear_depth);
   m_framebuffer_render_area = area;
+  m_in_clear_render_pass = true;
+  CountRenderPass(!clear_color, !clear_depth);
 
   VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
                                       nullptr,
@@ -375,7 +391,7 @@ bool StateTracker::Bind()
     return false;
 
   // Check the render area if we were in a clear pass.
-  if (m_current_render_pass == m_framebuffer->GetClearRenderPass() && !IsViewportWithinRenderArea())
+  if (m_in_clear_render_pass && !IsViewportWithinRenderArea())
     EndRenderPass();
 
   // Get a new descriptor set if any parts have changed
@@ -407,11 +423,39 @@ bool StateTracker::Bind()
   if (m_dirty_flags & DIRTY_FLAG_SCISSOR)
     vkCmdSetScissor(command_buffer, 0, 1, &m_scissor);
 
-  m_dirty_flags &=
-      ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR);
+  if (g_vulkan_context->SupportsFragmentShadingRate())
+  {
+    const bool coarse_shading = UseCoarseShading();
+    if (coarse_shading != m_coarse_shading || (m_dirty_flags & DIRTY_FLAG_SHADING_RATE))
+    {
+      static constexpr std::array<VkFragmentShadingRateCombinerOpKHR, 2> combiner_ops = {
+          VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+          VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR};
+      const VkExtent2D shading_rate = coarse_shading ? VkExtent2D{2, 2} : VkExtent2D{1, 1};
+      vkCmdSetFragmentShadingRateKHR(command_buffer, &shading_rate, combiner_ops.data());
+      m_coarse_shading = coarse_shading;
+    }
+  }
+
+  m_dirty_flags &= ~(DIRTY_FLAG_INDEX_BUFFER | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_VIEWPORT |
+                     DIRTY_FLAG_SCISSOR | DIRTY_FLAG_SHADING_RATE);
   return true;
 }
 
+bool StateTracker::UseCoarseShading() const
+{
+  // Only the game's own draws are coarse shaded. Utility draws such as EFB copies, pokes and
+  // post-processing have to produce exact results.
+  if (!g_ActiveConfig.bCoarseShading || g_ActiveConfig.bSSAA ||
+      m_pipeline->GetUsage() == AbstractPipelineUsage::Utility)
+  {
+    return false;
+  }
+
+  return g_framebuffer_manager->GetEFBScale() >= COARSE_SHADING_MIN_EFB_SCALE &&
+         m_framebuffer->GetSamples() <= g_vulkan_context->GetMaxFragmentShadingRateSamples();
+}
+
 bool StateTracker::BindCompute()
 {
   if (!m_compute_shader)
@@ -457,7 +501,7 @@ bool StateTracker::IsViewportWithinRenderArea() const
 
 void StateTracker::EndClearRenderPass()
 {
-  if (m_current_render_pass != m_framebuffer->GetClearRenderPass())
+  if (!m_in_clear_render_pass)
     return;
 
   // End clear render pass. Bind() will call BeginRenderPass() which
@@ -465,6 +509,18 @@ void StateTracker::EndClearRenderPass()
   EndRenderPass();
 }
 
+void StateTracker::CountRenderPass(bool loads_color, bool loads_depth)
+{
+  INCSTAT(g_stats.this_frame.num_render_passes);
+  if (!loads_color && !loads_depth)
+    return;
+
+  INCSTAT(g_stats.this_frame.num_render_pass_loads);
+  ADDSTAT(g_stats.this_frame.bytes_render_pass_loaded,
+          (loads_color ? m_framebuffer->GetColorAttachmentsSizeInBytes() : 0) +
+              (loads_depth ? m_framebuffer->GetDepthAttachmentSizeInBytes() : 0));
+}
+
 void StateTracker::UpdateDescriptorSet()
 {
   if (m_pipeline->GetUsage() != AbstractPipelineUsage::Utility)
@@ -517,21 +573,34 @@ void StateTracker::UpdateGXDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_UBOS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
+  if (!push_samplers &&
+      (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE))
   {
-    m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
-
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            m_gx_descriptor_sets[1],
-                            0,
-                            0,
-                            static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.samplers.data(),
-                            nullptr,
-                            nullptr};
+    auto& sampler_set = m_gx_sampler_descriptor_sets[m_bindings.samplers];
+    if (sampler_set != VK_NULL_HANDLE)
+    {
+      INCSTAT(g_stats.this_frame.num_sampler_set_reuses);
+    }
+    else
+    {
+      INCSTAT(g_stats.this_frame.num_sampler_set_writes);
+      sampler_set = g_command_buffer_mgr->AllocateDescriptorSet(
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
+
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              sampler_set,
+                              0,
+                              0,
+                              static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.samplers.data(),
+                              nullptr,
+                              nullptr};
+    }
+
+    m_gx_descriptor_sets[1] = sampler_set;
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SAMPLERS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
@@ -573,15 +642,53 @@ void StateTracker::UpdateGXDescriptorSet()
   if (num_writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), num_writes, writes.data(), 0, nullptr);
 
+  // Pushed samplers have to be pushed again whenever the other sets are rebound, as that happens
+  // after a pipeline layout change or at the start of a new command buffer.
+  if (push_samplers && m_dirty_flags & (DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_DESCRIPTOR_SETS))
+  {
+    const VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                                        nullptr,
+                                        VK_NULL_HANDLE,
+                                        0,
+                                        0,
+                                        static_cast<u32>(VideoCommon::MAX_PIXEL_SHADER_SAMPLERS),
+                                        VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                        m_bindings.samplers.data(),
+                                        nullptr,
+                                        nullptr};
+    vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                              1, 1, &write);
+    INCSTAT(g_stats.this_frame.num_sampler_set_writes);
+    m_dirty_flags &= ~DIRTY_FLAG_GX_SAMPLERS;
+  }
+
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
-    vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
-                            VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
-                            m_gx_descriptor_sets.data(),
-                            needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS :
-                                           (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1),
-                            m_bindings.gx_ubo_offsets.data());
+    const u32 num_ubo_offsets =
+        needs_gs_ubo ? NUM_UBO_DESCRIPTOR_SET_BINDINGS : (NUM_UBO_DESCRIPTOR_SET_BINDINGS - 1);
+    if (!push_samplers)
+    {
+      vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                              0, needs_ssbo ? NUM_GX_DESCRIPTOR_SETS : (NUM_GX_DESCRIPTOR_SETS - 1),
+                              m_gx_descriptor_sets.data(), num_ubo_offsets,
+                              m_bindings.gx_ubo_offsets.data());
+    }
+    else
+    {
+      // The pushed sampler set sits between the other two, so they can't be bound in one go.
+      vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                              0, 1, m_gx_descriptor_sets.data(), num_ubo_offsets,
+                              m_bindings.gx_ubo_offsets.data());
+      if (needs_ssbo)
+      {
+        vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                                VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                                2, 1, &m_gx_descriptor_sets[2], 0, nullptr);
+      }
+    }
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_GX_UBO_OFFSETS);
   }
   else if (m_dirty_flags & DIRTY_FLAG_GX_UBO_OFFSETS)
@@ -595,6 +702,28 @@ void StateTracker::UpdateGXDescriptorSet()
   }
 }
 
+size_t StateTracker::GXSamplerBindingsHash::operator()(const GXSamplerBindings& bindings) const
+{
+  // Handles are unique while they're alive, so a simple mix of them is good enough.
+  u64 hash = 0;
+  for (const VkDescriptorImageInfo& info : bindings)
+  {
+    hash = hash * 31 + reinterpret_cast<u64>(info.imageView);
+    hash = hash * 31 + reinterpret_cast<u64>(info.sampler);
+    hash = hash * 31 + static_cast<u64>(info.imageLayout);
+  }
+  return static_cast<size_t>(hash);
+}
+
+bool StateTracker::GXSamplerBindingsEqual::operator()(const GXSamplerBindings& a,
+                                                       const GXSamplerBindings& b) const
+{
+  return std::equal(a.begin(), a.end(), b.begin(), [](const auto& lhs, const auto& rhs) {
+    return lhs.sampler == rhs.sampler && lhs.imageView == rhs.imageView &&
+           lhs.imageLayout == rhs.imageLayout;
+  });
+}
+
 void StateTracker::UpdateUtilityDescriptorSet()
 {
   // Max number of updates - UBO, Samplers, TexelBuffer
@@ -621,7 +750,9 @@ void StateTracker::UpdateUtilityDescriptorSet()
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_UTILITY_UBO) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
-  if (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS || m_utility_descriptor_sets[1] == VK_NULL_HANDLE)
+  const bool push_samplers = g_vulkan_context->SupportsPushDescriptors();
+  if (!push_samplers && (m_dirty_flags & DIRTY_FLAG_UTILITY_BINDINGS ||
+                         m_utility_descriptor_sets[1] == VK_NULL_HANDLE))
   {
     m_utility_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
         g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_UTILITY_SAMPLERS));
@@ -653,12 +784,28 @@ void StateTracker::UpdateUtilityDescriptorSet()
   if (writes > 0)
     vkUpdateDescriptorSets(g_vulkan_context->GetDevice(), writes, dswrites.data(), 0, nullptr);
 
+  if (push_samplers && m_dirty_flags & (DIRTY_FLAG_UTILITY_BINDINGS | DIRTY_FLAG_DESCRIPTOR_SETS))
+  {
+    const std::array<VkWriteDescriptorSet, 2> push_writes{{
+        {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 0, 0,
+         NUM_UTILITY_PIXEL_SAMPLERS, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+         m_bindings.samplers.data(), nullptr, nullptr},
+        {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET, nullptr, VK_NULL_HANDLE, 8, 0, 1,
+         VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, nullptr, nullptr,
+         m_bindings.texel_buffers.data()},
+    }};
+    vkCmdPushDescriptorSetKHR(g_command_buffer_mgr->GetCurrentCommandBuffer(),
+                              VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(),
+                              1, static_cast<u32>(push_writes.size()), push_writes.data());
+    m_dirty_flags &= ~DIRTY_FLAG_UTILITY_BINDINGS;
+  }
+
   if (m_dirty_flags & DIRTY_FLAG_DESCRIPTOR_SETS)
   {
     vkCmdBindDescriptorSets(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                             VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->GetVkPipelineLayout(), 0,
-                            NUM_UTILITY_DESCRIPTOR_SETS, m_utility_descriptor_sets.data(), 1,
-                            &m_bindings.utility_ubo_offset);
+                            push_samplers ? 1 : NUM_UTILITY_DESCRIPTOR_SETS,
+                            m_utility_descriptor_sets.data(), 1, &m_bindings.utility_ubo_offset);
     m_dirty_flags &= ~(DIRTY_FLAG_DESCRIPTOR_SETS | DIRTY_FLAG_UTILITY_UBO_OFFSET);
   }
   else if (m_dirty_flags & DIRTY_FLAG_UTILITY_UBO_OFFSET)
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <unordered_map>
 
 #include "Common/CommonTypes.h"
 #include "VideoBackends/Vulkan/Constants.h"
@@ -58,9 +59,11 @@ public:
   void BeginDiscardRenderPass();
   void EndRenderPass();
 
-  // Ends the current render pass if it was a clear render pass.
+  // Begins a render pass which clears the area of whichever attachments are selected, and loads
+  // the others. The pass is ended when something is drawn outside of the area.
   void BeginClearRenderPass(const VkRect2D& area, const VkClearValue* clear_values,
-                            u32 num_clear_values);
+                            u32 num_clear_values, bool clear_color = true, bool clear_depth = true);
+  // Ends the current render pass if it was a clear render pass.
   void EndClearRenderPass();
 
   void SetViewport(const VkViewport& viewport);
@@ -104,6 +107,7 @@ private:
     DIRTY_FLAG_COMPUTE_SHADER = (1 << 13),
     DIRTY_FLAG_DESCRIPTOR_SETS = (1 << 14),
     DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET = (1 << 15),
+    DIRTY_FLAG_SHADING_RATE = (1 << 16),
 
     DIRTY_FLAG_ALL_DESCRIPTORS = DIRTY_FLAG_GX_UBOS | DIRTY_FLAG_UTILITY_UBO |
                                  DIRTY_FLAG_GX_SAMPLERS | DIRTY_FLAG_GX_SSBO |
@@ -116,11 +120,27 @@ private:
   // If not, ends the render pass if it is a clear render pass.
   bool IsViewportWithinRenderArea() const;
 
+  bool UseCoarseShading() const;
+
+  // Counts a render pass, and the attachments it loads, in the frame statistics.
+  void CountRenderPass(bool loads_color, bool loads_depth);
+
   void UpdateDescriptorSet();
   void UpdateGXDescriptorSet();
   void UpdateUtilityDescriptorSet();
   void UpdateComputeDescriptorSet();
 
+  using GXSamplerBindings =
+      std::array<VkDescriptorImageInfo, VideoCommon::MAX_PIXEL_SHADER_SAMPLERS>;
+  struct GXSamplerBindingsHash
+  {
+    size_t operator()(const GXSamplerBindings& bindings) const;
+  };
+  struct GXSamplerBindingsEqual
+  {
+    bool operator()(const GXSamplerBindings& a, const GXSamplerBindings& b) const;
+  };
+
   // Which bindings/state has to be updated before the next draw.
   u32 m_dirty_flags = 0;
 
@@ -152,6 +172,12 @@ private:
   std::array<VkDescriptorSet, NUM_UTILITY_DESCRIPTOR_SETS> m_utility_descriptor_sets = {};
   VkDescriptorSet m_compute_descriptor_set = VK_NULL_HANDLE;
 
+  // GX sampler descriptor sets written since the state was last invalidated. Games tend to switch
+  // between a small number of texture combinations, so most changes can rebind an existing set.
+  std::unordered_map<GXSamplerBindings, VkDescriptorSet, GXSamplerBindingsHash,
+                     GXSamplerBindingsEqual>
+      m_gx_sampler_descriptor_sets;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -163,5 +189,7 @@ private:
   VKFramebuffer* m_framebuffer = nullptr;
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
   VkRect2D m_framebuffer_render_area = {};
+  bool m_in_clear_render_pass = false;
+  bool m_coarse_shading = false;
 };
 }  // namespace Vulkan
@@ -38,6 +38,46 @@ bool VKBoundingBox::Initialize()
 }
 
 std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
+{
+  CopyToReadbackBuffer(0);
+
+  // Wait until these commands complete.
+  VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
+
+  // Cache is now valid.
+  m_readback_buffer->InvalidateCPUCache();
+
+  // Read out the values and return
+  std::vector<BBoxType> values(length);
+  m_readback_buffer->Read(index * sizeof(BBoxType), values.data(), length * sizeof(BBoxType),
+                          false);
+  return values;
+}
+
+void VKBoundingBox::ReadAsync(u32 slot)
+{
+  CopyToReadbackBuffer((slot + 1) * BUFFER_SIZE);
+  m_readback_fence_counters[slot] = g_command_buffer_mgr->GetCurrentFenceCounter();
+}
+
+std::array<BBoxType, NUM_BBOX_VALUES> VKBoundingBox::GetAsyncReadResult(u32 slot)
+{
+  // By now, the copy has normally been submitted with an earlier frame and completed already.
+  const u64 fence_counter = m_readback_fence_counters[slot];
+  if (fence_counter == g_command_buffer_mgr->GetCurrentFenceCounter())
+    VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
+  else
+    g_command_buffer_mgr->WaitForFenceCounter(fence_counter);
+
+  const VkDeviceSize offset = (slot + 1) * BUFFER_SIZE;
+  m_readback_buffer->InvalidateCPUCache(offset, BUFFER_SIZE);
+
+  std::array<BBoxType, NUM_BBOX_VALUES> values;
+  m_readback_buffer->Read(offset, values.data(), BUFFER_SIZE, false);
+  return values;
+}
+
+void VKBoundingBox::CopyToReadbackBuffer(VkDeviceSize offset)
 {
   // Can't be done within a render pass.
   StateTracker::GetInstance()->EndRenderPass();
@@ -52,7 +92,7 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
                                         VK_PIPELINE_STAGE_TRANSFER_BIT);
 
   // Copy from GPU -> readback buffer.
-  VkBufferCopy region = {0, 0, BUFFER_SIZE};
+  VkBufferCopy region = {0, offset, BUFFER_SIZE};
   vkCmdCopyBuffer(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_gpu_buffer,
                   m_readback_buffer->GetBuffer(), 1, &region);
 
@@ -63,18 +103,6 @@ std::vector<BBoxType> VKBoundingBox::Read(u32 index, u32 length)
       VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
   m_readback_buffer->FlushGPUCache(g_command_buffer_mgr->GetCurrentCommandBuffer(),
                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-  // Wait until these commands complete.
-  VKGfx::GetInstance()->ExecuteCommandBuffer(false, true);
-
-  // Cache is now valid.
-  m_readback_buffer->InvalidateCPUCache();
-
-  // Read out the values and return
-  std::vector<BBoxType> values(length);
-  m_readback_buffer->Read(index * sizeof(BBoxType), values.data(), length * sizeof(BBoxType),
-                          false);
-  return values;
 }
 
 void VKBoundingBox::Write(u32 index, std::span<const BBoxType> values)
@@ -142,8 +170,9 @@ bool VKBoundingBox::CreateGPUBuffer()
 
 bool VKBoundingBox::CreateReadbackBuffer()
 {
-  m_readback_buffer = StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE,
-                                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  m_readback_buffer =
+      StagingBuffer::Create(STAGING_BUFFER_TYPE_READBACK, BUFFER_SIZE * (NUM_READBACK_SLOTS + 1),
+                            VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 
   if (!m_readback_buffer || !m_readback_buffer->Map())
     return false;
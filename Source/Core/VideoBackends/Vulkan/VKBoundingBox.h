@@ -27,17 +27,22 @@ public:
 protected:
   std::vector<BBoxType> Read(u32 index, u32 length) override;
   void Write(u32 index, std::span<const BBoxType> values) override;
+  void ReadAsync(u32 slot) override;
+  std::array<BBoxType, NUM_BBOX_VALUES> GetAsyncReadResult(u32 slot) override;
 
 private:
   bool CreateGPUBuffer();
   bool CreateReadbackBuffer();
+  void CopyToReadbackBuffer(VkDeviceSize offset);
 
   VkBuffer m_gpu_buffer = VK_NULL_HANDLE;
   VmaAllocation m_gpu_allocation = VK_NULL_HANDLE;
 
   static constexpr size_t BUFFER_SIZE = sizeof(BBoxType) * NUM_BBOX_VALUES;
 
+  // The first BUFFER_SIZE bytes are used by Read, followed by one region per readback slot.
   std::unique_ptr<StagingBuffer> m_readback_buffer;
+  std::array<u64, NUM_READBACK_SLOTS> m_readback_fence_counters = {};
 };
 
 }  // namespace Vulkan
@@ -98,6 +98,14 @@ VKGfx::CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* dep
                                std::move(additional_color_attachments));
 }
 
+std::unique_ptr<AbstractFramebuffer>
+VKGfx::CreateMultiviewFramebuffer(AbstractTexture* color_attachment,
+                                  AbstractTexture* depth_attachment)
+{
+  return VKFramebuffer::Create(static_cast<VKTexture*>(color_attachment),
+                               static_cast<VKTexture*>(depth_attachment), {}, true);
+}
+
 void VKGfx::SetPipeline(const AbstractPipeline* pipeline)
 {
   StateTracker::GetInstance()->SetPipeline(static_cast<const VKPipeline*>(pipeline));
@@ -122,10 +130,11 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
     clear_depth_value.depthStencil.depth = 1.0f - clear_depth_value.depthStencil.depth;
 
   // If we're not in a render pass (start of the frame), we can use a clear render pass
-  // to discard the data, rather than loading and then clearing.
+  // to discard the data, rather than loading and then clearing. On tiled GPUs this also skips
+  // loading the cleared attachments into tile memory, so it's worth doing for partial clears too.
   bool use_clear_attachments = (color_enable && alpha_enable) || z_enable;
   bool use_clear_render_pass =
-      !StateTracker::GetInstance()->InRenderPass() && color_enable && alpha_enable && z_enable;
+      !StateTracker::GetInstance()->InRenderPass() && use_clear_attachments;
 
   // The NVIDIA Vulkan driver causes the GPU to lock up, or throw exceptions if MSAA is enabled,
   // a non-full clear rect is specified, and a clear loadop or vkCmdClearAttachments is used.
@@ -146,8 +155,24 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
   // Fastest path: Use a render pass to clear the buffers.
   if (use_clear_render_pass)
   {
-    vk_frame_buffer->SetAndClear(target_vk_rc, clear_color_value, clear_depth_value);
-    return;
+    const bool clear_color = color_enable && alpha_enable;
+    if (clear_color && z_enable)
+    {
+      vk_frame_buffer->SetAndClear(target_vk_rc, clear_color_value, clear_depth_value);
+      return;
+    }
+
+    // Clear one attachment with the load op, and load the other. Color without alpha (or the
+    // reverse) is left to the slow path, which draws within this pass.
+    if (vk_frame_buffer->GetPartialClearRenderPass(clear_color, z_enable) != VK_NULL_HANDLE)
+    {
+      vk_frame_buffer->SetAndClear(target_vk_rc, clear_color_value, clear_depth_value,
+                                   clear_color, z_enable);
+      if (clear_color)
+        color_enable = alpha_enable = false;
+      z_enable = false;
+      use_clear_attachments = false;
+    }
   }
 
   // Fast path: Use vkCmdClearAttachments to clear the buffers within a render path
@@ -189,7 +214,10 @@ void VKGfx::ClearRegion(const MathUtil::Rectangle<int>& target_rc, bool color_en
     }
     if (!clear_attachments.empty())
     {
-      VkClearRect vk_rect = {target_vk_rc, 0, g_framebuffer_manager->GetEFBLayers()};
+      // Multiview clears cover every view with a single layer.
+      const u32 clear_layers =
+          vk_frame_buffer->IsMultiview() ? 1 : g_framebuffer_manager->GetEFBLayers();
+      VkClearRect vk_rect = {target_vk_rc, 0, clear_layers};
       if (!StateTracker::GetInstance()->IsWithinRenderArea(
               target_vk_rc.offset.x, target_vk_rc.offset.y, target_vk_rc.extent.width,
               target_vk_rc.extent.height))
@@ -225,8 +253,7 @@ void VKGfx::BindBackbuffer(const ClearColor& clear_color)
 {
   StateTracker::GetInstance()->EndRenderPass();
 
-  if (!g_command_buffer_mgr->CheckLastPresentDone())
-    g_command_buffer_mgr->WaitForWorkerThreadIdle();
+  g_command_buffer_mgr->WaitForLastPresent();
 
   // Handle host window resizes.
   CheckForSurfaceChange();
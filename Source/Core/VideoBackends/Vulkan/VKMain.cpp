@@ -193,6 +193,7 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
       &g_Config, g_vulkan_context->GetPhysicalDevice(), g_vulkan_context->GetDeviceProperties());
   g_Config.backend_info.bSupportsExclusiveFullscreen =
       enable_surface && g_vulkan_context->SupportsExclusiveFullscreen(wsi, surface);
+  g_Config.backend_info.bSupportsMultiview = g_vulkan_context->SupportsMultiview();
 
   UpdateActiveConfig();
 
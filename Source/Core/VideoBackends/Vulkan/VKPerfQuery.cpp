@@ -88,6 +88,26 @@ void PerfQuery::DisableQuery(PerfQueryGroup group)
 
 void PerfQuery::ResetQuery()
 {
+  if (g_ActiveConfig.bPerfQueriesApproximate)
+  {
+    // Keep the pending queries, and apply the reset once they have been read back. Only one reset
+    // can be pending, so an unresolved one has to be waited for.
+    if (m_reset_pending)
+      PartialFlush(true);
+    else
+      ReadbackQueries();
+
+    if (!IsFlushed())
+    {
+      m_reset_pending = true;
+      m_queries_before_reset = m_query_count.load(std::memory_order_relaxed);
+      return;
+    }
+
+    PublishApproximateResults();
+  }
+
+  m_reset_pending = false;
   m_query_count.store(0, std::memory_order_relaxed);
   m_query_readback_pos = 0;
   m_query_next_pos = 0;
@@ -104,23 +124,26 @@ void PerfQuery::ResetQuery()
 
 u32 PerfQuery::GetQueryResult(PerfQueryType type)
 {
+  const auto& results =
+      g_ActiveConfig.bPerfQueriesApproximate ? m_approximate_results : m_results;
+
   u32 result = 0;
   if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
   {
-    result = m_results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
+    result = results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
   }
   else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
   {
-    result = m_results[PQG_ZCOMP].load(std::memory_order_relaxed);
+    result = results[PQG_ZCOMP].load(std::memory_order_relaxed);
   }
   else if (type == PQ_BLEND_INPUT)
   {
-    result = m_results[PQG_ZCOMP].load(std::memory_order_relaxed) +
-             m_results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
+    result = results[PQG_ZCOMP].load(std::memory_order_relaxed) +
+             results[PQG_ZCOMP_ZCOMPLOC].load(std::memory_order_relaxed);
   }
   else if (type == PQ_EFB_COPY_CLOCKS)
   {
-    result = m_results[PQG_EFB_COPY_CLOCKS].load(std::memory_order_relaxed);
+    result = results[PQG_EFB_COPY_CLOCKS].load(std::memory_order_relaxed);
   }
 
   return result / 4;
@@ -226,6 +249,15 @@ void PerfQuery::ReadbackQueries(u32 query_count)
       native_res_result /= g_ActiveConfig.iMultisamples;
     m_results[entry.query_group].fetch_add(static_cast<u32>(native_res_result),
                                            std::memory_order_relaxed);
+
+    // The queries after this one were issued after the pending reset.
+    if (m_reset_pending && --m_queries_before_reset == 0)
+    {
+      PublishApproximateResults();
+      for (auto& result : m_results)
+        result.store(0, std::memory_order_relaxed);
+      m_reset_pending = false;
+    }
   }
 
   m_query_readback_pos = (m_query_readback_pos + query_count) % PERF_QUERY_BUFFER_SIZE;
@@ -243,4 +275,11 @@ void PerfQuery::PartialFlush(bool blocking)
 
   ReadbackQueries();
 }
+
+void PerfQuery::PublishApproximateResults()
+{
+  for (size_t i = 0; i < m_results.size(); ++i)
+    m_approximate_results[i].store(m_results[i].load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+}
 }  // namespace Vulkan
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -28,6 +29,7 @@ public:
   u32 GetQueryResult(PerfQueryType type) override;
   void FlushResults() override;
   bool IsFlushed() const override;
+  bool SupportsApproximateResults() const override { return true; }
 
 private:
   // u32 is used for the sample counts.
@@ -48,12 +50,20 @@ private:
   void ReadbackQueries();
   void ReadbackQueries(u32 query_count);
   void PartialFlush(bool blocking);
+  void PublishApproximateResults();
 
   VkQueryPool m_query_pool = VK_NULL_HANDLE;
   u32 m_query_readback_pos = 0;
   u32 m_query_next_pos = 0;
   std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
   std::array<PerfQueryDataType, PERF_QUERY_BUFFER_SIZE> m_query_result_buffer = {};
+
+  // In the approximate mode, a reset with queries still pending is only applied after the
+  // m_queries_before_reset oldest ones have been read back. m_approximate_results holds the
+  // totals of the queries issued between the last two applied resets.
+  bool m_reset_pending = false;
+  u32 m_queries_before_reset = 0;
+  std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_approximate_results{};
 };
 
 }  // namespace Vulkan
@@ -3,6 +3,7 @@
 
 #include "VideoBackends/Vulkan/VKPipeline.h"
 
+#include <algorithm>
 #include <array>
 
 #include "Common/Assert.h"
@@ -28,6 +29,15 @@ VKPipeline::VKPipeline(const AbstractPipelineConfig& config, VkPipeline pipeline
 
 VKPipeline::~VKPipeline()
 {
+  if (m_optimized_link)
+  {
+    std::lock_guard guard(m_optimized_link->lock);
+    m_optimized_link->abandoned = true;
+    VkPipeline optimized = m_optimized_link->pipeline.load(std::memory_order_relaxed);
+    if (optimized != VK_NULL_HANDLE)
+      vkDestroyPipeline(g_vulkan_context->GetDevice(), optimized, nullptr);
+  }
+
   vkDestroyPipeline(g_vulkan_context->GetDevice(), m_pipeline, nullptr);
 }
 
@@ -240,6 +250,154 @@ GetVulkanColorBlendState(const BlendingState& state,
   return vk_state;
 }
 
+// Multiview is only used for the stereo EFB, which has a layer for each eye.
+constexpr u32 STEREO_VIEW_COUNT = 2;
+
+// Builds one part of a pipeline from the matching state of the full pipeline description. State
+// which doesn't belong to the part is ignored by the driver, except for the shader stages.
+static VkPipeline CreatePipelineLibrary(const VkGraphicsPipelineCreateInfo& pipeline_info,
+                                        VkGraphicsPipelineLibraryFlagBitsEXT part)
+{
+  VkGraphicsPipelineLibraryCreateInfoEXT library_info = {
+      VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT, nullptr,
+      static_cast<VkGraphicsPipelineLibraryFlagsEXT>(part)};
+
+  std::array<VkPipelineShaderStageCreateInfo, 3> stages;
+  uint32_t num_stages = 0;
+  for (uint32_t i = 0; i < pipeline_info.stageCount; i++)
+  {
+    const bool is_fragment = pipeline_info.pStages[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+    if ((part == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT && !is_fragment) ||
+        (part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT && is_fragment))
+    {
+      stages[num_stages++] = pipeline_info.pStages[i];
+    }
+  }
+
+  VkGraphicsPipelineCreateInfo info = pipeline_info;
+  info.pNext = &library_info;
+  info.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+               VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+  info.stageCount = num_stages;
+  info.pStages = num_stages > 0 ? stages.data() : nullptr;
+
+  // Only the shader parts access descriptors, and vertex input is independent of the render pass.
+  if (part == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT ||
+      part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT)
+  {
+    info.layout = VK_NULL_HANDLE;
+  }
+  if (part == VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)
+    info.renderPass = VK_NULL_HANDLE;
+
+  VkPipeline library;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &info, nullptr, &library);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed for pipeline library: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return library;
+}
+
+using PipelineLibraries = std::array<VkPipeline, 4>;
+
+static VkPipeline LinkPipelineLibraries(const PipelineLibraries& libraries,
+                                        VkPipelineLayout pipeline_layout, bool optimize)
+{
+  VkPipelineLibraryCreateInfoKHR library_info = {
+      VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR, nullptr,
+      static_cast<uint32_t>(libraries.size()), libraries.data()};
+
+  VkGraphicsPipelineCreateInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  info.pNext = &library_info;
+  info.flags = optimize ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+  info.layout = pipeline_layout;
+  info.basePipelineIndex = -1;
+
+  VkPipeline pipeline;
+  VkResult res =
+      vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
+                                1, &info, nullptr, &pipeline);
+  if (res != VK_SUCCESS)
+  {
+    LOG_VULKAN_ERROR(res, "vkCreateGraphicsPipelines failed to link libraries: ");
+    return VK_NULL_HANDLE;
+  }
+
+  return pipeline;
+}
+
+static VkShaderModule GetShaderModule(const AbstractShader* shader)
+{
+  return shader ? static_cast<const VKShader*>(shader)->GetShaderModule() : VK_NULL_HANDLE;
+}
+
+std::unique_ptr<VKPipeline>
+VKPipeline::CreateFromLibraries(const AbstractPipelineConfig& config,
+                                const VkGraphicsPipelineCreateInfo& pipeline_info)
+{
+  // Each part is keyed by the state it is built from, so the parts for a pixel shader are compiled
+  // once however many vertex formats and blend states it is drawn with.
+  const u32 framebuffer = config.framebuffer_state.hex;
+  const VkRenderPass render_pass = pipeline_info.renderPass;
+  const VkPipelineLayout layout = pipeline_info.layout;
+  const auto get_library = [&pipeline_info](VkGraphicsPipelineLibraryFlagBitsEXT part,
+                                            const PortableVertexDeclaration& vertex_declaration,
+                                            VkShaderModule module_0, VkShaderModule module_1,
+                                            u32 state_0, u32 state_1, VkRenderPass key_render_pass,
+                                            VkPipelineLayout key_layout) {
+    return g_object_cache->GetPipelineLibrary(
+        {static_cast<u32>(part), vertex_declaration, module_0, module_1, state_0, state_1,
+         key_render_pass, key_layout},
+        [&] { return CreatePipelineLibrary(pipeline_info, part); });
+  };
+
+  const PortableVertexDeclaration vertex_declaration =
+      config.vertex_format ? config.vertex_format->GetVertexDeclaration() :
+                             PortableVertexDeclaration();
+  const PipelineLibraries libraries = {
+      get_library(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, vertex_declaration,
+                  VK_NULL_HANDLE, VK_NULL_HANDLE,
+                  static_cast<u32>(config.rasterization_state.primitive.Value()),
+                  config.vertex_format != nullptr, VK_NULL_HANDLE, VK_NULL_HANDLE),
+      get_library(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, {},
+                  GetShaderModule(config.vertex_shader), GetShaderModule(config.geometry_shader),
+                  config.rasterization_state.hex, framebuffer, render_pass, layout),
+      get_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, {},
+                  GetShaderModule(config.pixel_shader), VK_NULL_HANDLE, config.depth_state.hex,
+                  framebuffer, render_pass, layout),
+      get_library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, {},
+                  VK_NULL_HANDLE, VK_NULL_HANDLE, config.blending_state.hex, framebuffer,
+                  render_pass, VK_NULL_HANDLE),
+  };
+  if (std::find(libraries.begin(), libraries.end(), VK_NULL_HANDLE) != libraries.end())
+    return nullptr;
+
+  VkPipeline pipeline = LinkPipelineLibraries(libraries, layout, false);
+  if (pipeline == VK_NULL_HANDLE)
+    return nullptr;
+
+  // The fast link is usable straight away. The optimized link replaces it once it is ready.
+  auto vk_pipeline = std::make_unique<VKPipeline>(config, pipeline, layout, config.usage);
+  auto link = std::make_shared<OptimizedLink>();
+  vk_pipeline->m_optimized_link = link;
+  g_object_cache->QueuePipelineLink([link, libraries, layout] {
+    std::lock_guard guard(link->lock);
+    if (link->abandoned)
+      return;
+
+    VkPipeline optimized = LinkPipelineLibraries(libraries, layout, true);
+    link->pipeline.store(optimized, std::memory_order_release);
+  });
+
+  return vk_pipeline;
+}
+
 std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& config)
 {
   DEBUG_ASSERT(config.vertex_shader && config.pixel_shader);
@@ -249,7 +407,8 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.color_texture_format),
       VKTexture::GetVkFormatForHostTextureFormat(config.framebuffer_state.depth_texture_format),
       config.framebuffer_state.samples, VK_ATTACHMENT_LOAD_OP_LOAD,
-      config.framebuffer_state.additional_color_attachment_count);
+      config.framebuffer_state.additional_color_attachment_count,
+      config.framebuffer_state.multiview ? STEREO_VIEW_COUNT : 1);
 
   if (render_pass == VK_NULL_HANDLE)
   {
@@ -381,15 +540,18 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       &scissor    // const VkRect2D*                       pScissors
   };
 
-  // Set viewport and scissor dynamic state so we can change it elsewhere.
-  static const std::array<VkDynamicState, 2> dynamic_states{
+  // Set viewport and scissor dynamic state so we can change it elsewhere. The shading rate is set
+  // per draw too, when the device supports coarse shading.
+  static const std::array<VkDynamicState, 3> dynamic_states{
       VK_DYNAMIC_STATE_VIEWPORT,
       VK_DYNAMIC_STATE_SCISSOR,
+      VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR,
   };
-  static const VkPipelineDynamicStateCreateInfo dynamic_state = {
+  const u32 num_dynamic_states = g_vulkan_context->SupportsFragmentShadingRate() ? 3 : 2;
+  const VkPipelineDynamicStateCreateInfo dynamic_state = {
       VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, nullptr,
-      0,                                        // VkPipelineDynamicStateCreateFlags    flags
-      static_cast<u32>(dynamic_states.size()),  // uint32_t dynamicStateCount
+      0,                     // VkPipelineDynamicStateCreateFlags    flags
+      num_dynamic_states,    // uint32_t dynamicStateCount
       dynamic_states.data()  // const VkDynamicState*                pDynamicStates
   };
 
@@ -416,6 +578,14 @@ std::unique_ptr<VKPipeline> VKPipeline::Create(const AbstractPipelineConfig& con
       -1                     // int32_t                                          basePipelineIndex
   };
 
+  if (g_vulkan_context->SupportsGraphicsPipelineLibrary())
+  {
+    if (auto pipeline = CreateFromLibraries(config, pipeline_info))
+      return pipeline;
+
+    WARN_LOG_FMT(VIDEO, "Failed to link pipeline libraries, compiling a full pipeline instead.");
+  }
+
   VkPipeline pipeline;
   VkResult res =
       vkCreateGraphicsPipelines(g_vulkan_context->GetDevice(), g_object_cache->GetPipelineCache(),
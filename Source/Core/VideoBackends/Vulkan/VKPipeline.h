@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "VideoBackends/Vulkan/VulkanLoader.h"
 #include "VideoCommon/AbstractPipeline.h"
@@ -17,15 +19,39 @@ public:
                       VkPipelineLayout pipeline_layout, AbstractPipelineUsage usage);
   ~VKPipeline() override;
 
-  VkPipeline GetVkPipeline() const { return m_pipeline; }
+  VkPipeline GetVkPipeline() const
+  {
+    if (m_optimized_link)
+    {
+      VkPipeline optimized = m_optimized_link->pipeline.load(std::memory_order_acquire);
+      if (optimized != VK_NULL_HANDLE)
+        return optimized;
+    }
+    return m_pipeline;
+  }
   VkPipelineLayout GetVkPipelineLayout() const { return m_pipeline_layout; }
   AbstractPipelineUsage GetUsage() const { return m_usage; }
   static std::unique_ptr<VKPipeline> Create(const AbstractPipelineConfig& config);
 
 private:
+  // Link-time optimized pipeline, built by the background linker when the pipeline was created
+  // from graphics pipeline libraries. The link holds this lock while compiling, so the libraries
+  // stay alive until it finishes even if the pipeline is destroyed meanwhile.
+  struct OptimizedLink
+  {
+    std::mutex lock;
+    std::atomic<VkPipeline> pipeline{VK_NULL_HANDLE};
+    bool abandoned = false;
+  };
+
+  static std::unique_ptr<VKPipeline>
+  CreateFromLibraries(const AbstractPipelineConfig& config,
+                      const VkGraphicsPipelineCreateInfo& pipeline_info);
+
   VkPipeline m_pipeline;
   VkPipelineLayout m_pipeline_layout;
   AbstractPipelineUsage m_usage;
+  std::shared_ptr<OptimizedLink> m_optimized_link;
 };
 
 }  // namespace Vulkan
@@ -48,9 +48,16 @@ VKShader::VKShader(std::vector<u32> spv, VkPipeline compute_pipeline, std::strin
 VKShader::~VKShader()
 {
   if (m_stage != ShaderStage::Compute)
+  {
+    // Pipeline libraries are keyed by the module handle, which can be reused once destroyed.
+    if (g_object_cache)
+      g_object_cache->ClearPipelineLibraries(m_module);
     vkDestroyShaderModule(g_vulkan_context->GetDevice(), m_module, nullptr);
+  }
   else
+  {
     vkDestroyPipeline(g_vulkan_context->GetDevice(), m_compute_pipeline, nullptr);
+  }
 }
 
 AbstractShader::BinaryData VKShader::GetBinary() const
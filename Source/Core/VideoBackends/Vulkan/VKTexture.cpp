@@ -1011,16 +1011,16 @@ void VKStagingTexture::Flush()
 
 VKFramebuffer::VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment,
                              std::vector<AbstractTexture*> additional_color_attachments, u32 width,
-                             u32 height, u32 layers, u32 samples, VkFramebuffer fb,
-                             VkRenderPass load_render_pass, VkRenderPass discard_render_pass,
-                             VkRenderPass clear_render_pass)
+                             u32 height, u32 layers, u32 samples, bool multiview,
+                             VkFramebuffer fb, VkRenderPass load_render_pass,
+                             VkRenderPass discard_render_pass, VkRenderPass clear_render_pass)
     : AbstractFramebuffer(
           color_attachment, depth_attachment, std::move(additional_color_attachments),
           color_attachment ? color_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           depth_attachment ? depth_attachment->GetFormat() : AbstractTextureFormat::Undefined,
           width, height, layers, samples),
-      m_fb(fb), m_load_render_pass(load_render_pass), m_discard_render_pass(discard_render_pass),
-      m_clear_render_pass(clear_render_pass)
+      m_multiview(multiview), m_fb(fb), m_load_render_pass(load_render_pass),
+      m_discard_render_pass(discard_render_pass), m_clear_render_pass(clear_render_pass)
 {
 }
 
@@ -1031,7 +1031,7 @@ VKFramebuffer::~VKFramebuffer()
 
 std::unique_ptr<VKFramebuffer>
 VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
-                      std::vector<AbstractTexture*> additional_color_attachments)
+                      std::vector<AbstractTexture*> additional_color_attachments, bool multiview)
 {
   if (!ValidateConfig(color_attachment, depth_attachment, additional_color_attachments))
     return nullptr;
@@ -1058,15 +1058,17 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
     attachment_views.push_back(static_cast<VKTexture*>(attachment)->GetView());
   }
 
+  // With multiview, the views are the layers, and the framebuffer itself has a single layer.
+  const u32 view_count = multiview ? layers : 1;
   VkRenderPass load_render_pass = g_object_cache->GetRenderPass(
       vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_LOAD,
-      static_cast<u8>(additional_color_attachments.size()));
+      static_cast<u8>(additional_color_attachments.size()), view_count);
   VkRenderPass discard_render_pass = g_object_cache->GetRenderPass(
       vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-      static_cast<u8>(additional_color_attachments.size()));
+      static_cast<u8>(additional_color_attachments.size()), view_count);
   VkRenderPass clear_render_pass = g_object_cache->GetRenderPass(
       vk_color_format, vk_depth_format, samples, VK_ATTACHMENT_LOAD_OP_CLEAR,
-      static_cast<u8>(additional_color_attachments.size()));
+      static_cast<u8>(additional_color_attachments.size()), view_count);
   if (load_render_pass == VK_NULL_HANDLE || discard_render_pass == VK_NULL_HANDLE ||
       clear_render_pass == VK_NULL_HANDLE)
   {
@@ -1081,7 +1083,7 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
                                               attachment_views.data(),
                                               width,
                                               height,
-                                              layers};
+                                              layers / view_count};
 
   VkFramebuffer fb;
   VkResult res =
@@ -1094,7 +1096,7 @@ VKFramebuffer::Create(VKTexture* color_attachment, VKTexture* depth_attachment,
 
   return std::make_unique<VKFramebuffer>(
       color_attachment, depth_attachment, std::move(additional_color_attachments), width, height,
-      layers, samples, fb, load_render_pass, discard_render_pass, clear_render_pass);
+      layers, samples, multiview, fb, load_render_pass, discard_render_pass, clear_render_pass);
 }
 
 void VKFramebuffer::Unbind()
@@ -1138,8 +1140,24 @@ void VKFramebuffer::TransitionForRender()
   }
 }
 
+VkRenderPass VKFramebuffer::GetPartialClearRenderPass(bool clear_color, bool clear_depth) const
+{
+  const VkFormat vk_color_format =
+      m_color_attachment ? static_cast<VKTexture*>(m_color_attachment)->GetVkFormat() :
+                           VK_FORMAT_UNDEFINED;
+  const VkFormat vk_depth_format =
+      m_depth_attachment ? static_cast<VKTexture*>(m_depth_attachment)->GetVkFormat() :
+                           VK_FORMAT_UNDEFINED;
+  return g_object_cache->GetRenderPass(
+      vk_color_format, vk_depth_format, m_samples,
+      clear_color ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+      clear_depth ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+      static_cast<u8>(m_additional_color_attachments.size()), m_multiview ? m_layers : 1);
+}
+
 void VKFramebuffer::SetAndClear(const VkRect2D& rect, const VkClearValue& color_value,
-                                const VkClearValue& depth_value)
+                                const VkClearValue& depth_value, bool clear_color,
+                                bool clear_depth)
 {
   std::vector<VkClearValue> clear_values;
   if (GetColorFormat() != AbstractTextureFormat::Undefined)
@@ -1154,7 +1172,7 @@ void VKFramebuffer::SetAndClear(const VkRect2D& rect, const VkClearValue& color_
   {
     clear_values.push_back(color_value);
   }
-  StateTracker::GetInstance()->BeginClearRenderPass(rect, clear_values.data(),
-                                                    static_cast<u32>(clear_values.size()));
+  StateTracker::GetInstance()->BeginClearRenderPass(
+      rect, clear_values.data(), static_cast<u32>(clear_values.size()), clear_color, clear_depth);
 }
 }  // namespace Vulkan
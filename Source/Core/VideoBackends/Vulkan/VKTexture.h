@@ -128,22 +128,28 @@ class VKFramebuffer final : public AbstractFramebuffer
 public:
   VKFramebuffer(VKTexture* color_attachment, VKTexture* depth_attachment,
                 std::vector<AbstractTexture*> additional_color_attachments, u32 width, u32 height,
-                u32 layers, u32 samples, VkFramebuffer fb, VkRenderPass load_render_pass,
-                VkRenderPass discard_render_pass, VkRenderPass clear_render_pass);
+                u32 layers, u32 samples, bool multiview, VkFramebuffer fb,
+                VkRenderPass load_render_pass, VkRenderPass discard_render_pass,
+                VkRenderPass clear_render_pass);
   ~VKFramebuffer() override;
 
   VkFramebuffer GetFB() const { return m_fb; }
   VkRect2D GetRect() const { return VkRect2D{{0, 0}, {m_width, m_height}}; }
+  // Each layer is a multiview view, so render passes and clears cover all of them at once.
+  bool IsMultiview() const { return m_multiview; }
 
   VkRenderPass GetLoadRenderPass() const { return m_load_render_pass; }
   VkRenderPass GetDiscardRenderPass() const { return m_discard_render_pass; }
   VkRenderPass GetClearRenderPass() const { return m_clear_render_pass; }
+  // Clears one kind of attachment and loads the other
+  VkRenderPass GetPartialClearRenderPass(bool clear_color, bool clear_depth) const;
 
   void Unbind();
   void TransitionForRender();
 
   void SetAndClear(const VkRect2D& rect, const VkClearValue& color_value,
-                   const VkClearValue& depth_value);
+                   const VkClearValue& depth_value, bool clear_color = true,
+                   bool clear_depth = true);
   std::size_t GetNumberOfAdditonalAttachments() const
   {
     return m_additional_color_attachments.size();
@@ -151,9 +157,10 @@ public:
 
   static std::unique_ptr<VKFramebuffer>
   Create(VKTexture* color_attachments, VKTexture* depth_attachment,
-         std::vector<AbstractTexture*> additional_color_attachments);
+         std::vector<AbstractTexture*> additional_color_attachments, bool multiview = false);
 
 protected:
+  bool m_multiview;
   VkFramebuffer m_fb;
   VkRenderPass m_load_render_pass;
   VkRenderPass m_discard_render_pass;
@@ -595,6 +595,15 @@ bool VulkanContext::SelectDeviceExtensions(bool enable_surface)
 
   AddExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME, false);
   AddExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
+  AddExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false);
+
+  // VK_KHR_fragment_shading_rate depends on VK_KHR_create_renderpass2.
+  if (AddExtension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, false))
+    AddExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME, false);
+
+  // VK_EXT_graphics_pipeline_library depends on VK_KHR_pipeline_library.
+  if (AddExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, false))
+    AddExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME, false);
 
   return true;
 }
@@ -755,6 +764,36 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
 
   device_info.pEnabledFeatures = &m_device_features;
 
+  // Only the pipeline shading rate is used, which is set per draw.
+  VkPhysicalDeviceFragmentShadingRateFeaturesKHR shading_rate_features = {};
+  shading_rate_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+  if (QueryFragmentShadingRateSupport())
+  {
+    shading_rate_features.pipelineFragmentShadingRate = VK_TRUE;
+    device_info.pNext = &shading_rate_features;
+  }
+
+  VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+  multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  if (QueryMultiviewSupport())
+  {
+    multiview_features.multiview = VK_TRUE;
+    multiview_features.multiviewGeometryShader = VK_TRUE;
+    multiview_features.pNext = const_cast<void*>(device_info.pNext);
+    device_info.pNext = &multiview_features;
+  }
+
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipeline_library_features = {};
+  pipeline_library_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  if (QueryGraphicsPipelineLibrarySupport())
+  {
+    pipeline_library_features.graphicsPipelineLibrary = VK_TRUE;
+    pipeline_library_features.pNext = const_cast<void*>(device_info.pNext);
+    device_info.pNext = &pipeline_library_features;
+  }
+
   // Enable debug layer on debug builds
   if (enable_validation_layer)
   {
@@ -773,6 +812,15 @@ bool VulkanContext::CreateDevice(VkSurfaceKHR surface, bool enable_validation_la
   if (!LoadVulkanDeviceFunctions(m_device))
     return false;
 
+  m_supports_push_descriptors = SupportsDeviceExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) &&
+                                vkCmdPushDescriptorSetKHR != nullptr;
+  m_supports_fragment_shading_rate =
+      shading_rate_features.pipelineFragmentShadingRate == VK_TRUE &&
+      vkCmdSetFragmentShadingRateKHR != nullptr;
+  m_supports_multiview = multiview_features.multiview == VK_TRUE;
+  m_supports_graphics_pipeline_library =
+      pipeline_library_features.graphicsPipelineLibrary == VK_TRUE;
+
   // Grab the graphics and present queues.
   vkGetDeviceQueue(m_device, m_graphics_queue_family_index, 0, &m_graphics_queue);
   if (surface)
@@ -1004,6 +1052,108 @@ void VulkanContext::PopulateShaderSubgroupSupport()
       !DriverDetails::HasBug(DriverDetails::BUG_BROKEN_SUBGROUP_OPS);
 }
 
+bool VulkanContext::QueryFragmentShadingRateSupport()
+{
+  // Like subgroups, this needs Vulkan 1.1 for the *2() queries.
+  if (!SupportsDeviceExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME) ||
+      !vkGetPhysicalDeviceFeatures2 || !vkGetPhysicalDeviceProperties2 ||
+      (VK_VERSION_MAJOR(m_device_properties.apiVersion) == 1 &&
+       VK_VERSION_MINOR(m_device_properties.apiVersion) < 1))
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceFragmentShadingRateFeaturesKHR shading_rate_features = {};
+  shading_rate_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+  VkPhysicalDeviceFeatures2 features_2 = {};
+  features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  features_2.pNext = &shading_rate_features;
+  vkGetPhysicalDeviceFeatures2(m_physical_device, &features_2);
+
+  VkPhysicalDeviceFragmentShadingRatePropertiesKHR shading_rate_properties = {};
+  shading_rate_properties.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR;
+  VkPhysicalDeviceProperties2 properties_2 = {};
+  properties_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties_2.pNext = &shading_rate_properties;
+  vkGetPhysicalDeviceProperties2(m_physical_device, &properties_2);
+
+  // GX pixel shaders write depth for per-pixel depth, and without this those draws would have to be
+  // shaded at full rate.
+  if (!shading_rate_features.pipelineFragmentShadingRate ||
+      !shading_rate_properties.fragmentShadingRateWithShaderDepthStencilWrites)
+  {
+    return false;
+  }
+
+  m_max_fragment_shading_rate_samples =
+      static_cast<u32>(shading_rate_properties.maxFragmentShadingRateRasterizationSamples);
+  INFO_LOG_FMT(VIDEO, "Using VK_KHR_fragment_shading_rate for coarse shading.");
+  return true;
+}
+
+bool VulkanContext::QueryMultiviewSupport()
+{
+  // Multiview is core in Vulkan 1.1.
+  if (!vkGetPhysicalDeviceFeatures2 || !m_device_features.geometryShader ||
+      (VK_VERSION_MAJOR(m_device_properties.apiVersion) == 1 &&
+       VK_VERSION_MINOR(m_device_properties.apiVersion) < 1))
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+  multiview_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES;
+  VkPhysicalDeviceFeatures2 features_2 = {};
+  features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  features_2.pNext = &multiview_features;
+  vkGetPhysicalDeviceFeatures2(m_physical_device, &features_2);
+
+  // Lines, points and wireframe still go through a geometry shader in a multiview render pass.
+  if (!multiview_features.multiview || !multiview_features.multiviewGeometryShader)
+    return false;
+
+  INFO_LOG_FMT(VIDEO, "Using multiview for stereoscopic 3D.");
+  return true;
+}
+
+bool VulkanContext::QueryGraphicsPipelineLibrarySupport()
+{
+  if (!SupportsDeviceExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) ||
+      !vkGetPhysicalDeviceFeatures2 || !vkGetPhysicalDeviceProperties2)
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipeline_library_features = {};
+  pipeline_library_features.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+  VkPhysicalDeviceFeatures2 features_2 = {};
+  features_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  features_2.pNext = &pipeline_library_features;
+  vkGetPhysicalDeviceFeatures2(m_physical_device, &features_2);
+
+  VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT pipeline_library_properties = {};
+  pipeline_library_properties.sType =
+      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties_2 = {};
+  properties_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties_2.pNext = &pipeline_library_properties;
+  vkGetPhysicalDeviceProperties2(m_physical_device, &properties_2);
+
+  // Without fast linking, linking the parts costs about as much as a monolithic compile, and the
+  // libraries would only add memory and driver overhead.
+  if (!pipeline_library_features.graphicsPipelineLibrary ||
+      !pipeline_library_properties.graphicsPipelineLibraryFastLinking)
+  {
+    return false;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Using VK_EXT_graphics_pipeline_library for pipeline creation.");
+  return true;
+}
+
 bool VulkanContext::SupportsExclusiveFullscreen(const WindowSystemInfo& wsi, VkSurfaceKHR surface)
 {
 #ifdef SUPPORTS_VULKAN_EXCLUSIVE_FULLSCREEN
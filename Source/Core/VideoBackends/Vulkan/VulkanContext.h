@@ -83,6 +83,19 @@ public:
   }
   u32 GetShaderSubgroupSize() const { return m_shader_subgroup_size; }
   bool SupportsShaderSubgroupOperations() const { return m_supports_shader_subgroup_operations; }
+  // Whether the sampler descriptor sets are pushed with VK_KHR_push_descriptor instead of being
+  // allocated from the command buffer's descriptor pool.
+  bool SupportsPushDescriptors() const { return m_supports_push_descriptors; }
+  // Whether draws can be coarse shaded with VK_KHR_fragment_shading_rate's pipeline rate, and the
+  // highest sample count that can be used with it.
+  bool SupportsFragmentShadingRate() const { return m_supports_fragment_shading_rate; }
+  u32 GetMaxFragmentShadingRateSamples() const { return m_max_fragment_shading_rate_samples; }
+  // Whether both stereo layers can be rendered in one pass with multiview, including by geometry
+  // shaders for lines, points and wireframe.
+  bool SupportsMultiview() const { return m_supports_multiview; }
+  // Whether pipelines can be split into VK_EXT_graphics_pipeline_library parts which are compiled
+  // once and linked quickly for each combination of state.
+  bool SupportsGraphicsPipelineLibrary() const { return m_supports_graphics_pipeline_library; }
 
   // Helpers for getting constants
   VkDeviceSize GetUniformBufferAlignment() const
@@ -122,6 +135,9 @@ private:
   bool CreateDevice(VkSurfaceKHR surface, bool enable_validation_layer);
   void InitDriverDetails();
   void PopulateShaderSubgroupSupport();
+  bool QueryFragmentShadingRateSupport();
+  bool QueryMultiviewSupport();
+  bool QueryGraphicsPipelineLibrarySupport();
   bool CreateAllocator(u32 vk_api_version);
 
   VkInstance m_instance = VK_NULL_HANDLE;
@@ -143,6 +159,11 @@ private:
 
   u32 m_shader_subgroup_size = 1;
   bool m_supports_shader_subgroup_operations = false;
+  bool m_supports_push_descriptors = false;
+  bool m_supports_fragment_shading_rate = false;
+  u32 m_max_fragment_shading_rate_samples = 0;
+  bool m_supports_multiview = false;
+  bool m_supports_graphics_pipeline_library = false;
 
   std::vector<std::string> m_device_extensions;
 };
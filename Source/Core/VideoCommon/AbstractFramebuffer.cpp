@@ -80,3 +80,22 @@ MathUtil::Rectangle<int> AbstractFramebuffer::GetRect() const
 {
   return MathUtil::Rectangle<int>(0, 0, static_cast<int>(m_width), static_cast<int>(m_height));
 }
+
+u64 AbstractFramebuffer::GetColorAttachmentsSizeInBytes() const
+{
+  if (!HasColorBuffer())
+    return 0;
+
+  const u64 attachment_size = u64{m_width} * m_height * m_layers * m_samples *
+                              AbstractTexture::GetTexelSizeForFormat(m_color_format);
+  return attachment_size * (1 + m_additional_color_attachments.size());
+}
+
+u64 AbstractFramebuffer::GetDepthAttachmentSizeInBytes() const
+{
+  if (!HasDepthBuffer())
+    return 0;
+
+  return u64{m_width} * m_height * m_layers * m_samples *
+         AbstractTexture::GetTexelSizeForFormat(m_depth_format);
+}
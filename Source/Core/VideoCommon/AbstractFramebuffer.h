@@ -41,6 +41,11 @@ public:
   u32 GetSamples() const { return m_samples; }
   MathUtil::Rectangle<int> GetRect() const;
 
+  // Size of the attachments across all layers and samples, i.e. how much a tiled GPU moves between
+  // tile memory and VRAM to load or store them for the whole framebuffer.
+  u64 GetColorAttachmentsSizeInBytes() const;
+  u64 GetDepthAttachmentSizeInBytes() const;
+
 protected:
   AbstractTexture* m_color_attachment;
   AbstractTexture* m_depth_attachment;
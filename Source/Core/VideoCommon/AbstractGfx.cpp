@@ -39,6 +39,13 @@ void AbstractGfx::EndUtilityDrawing()
   BPFunctions::SetScissorAndViewport();
 }
 
+std::unique_ptr<AbstractFramebuffer>
+AbstractGfx::CreateMultiviewFramebuffer(AbstractTexture* color_attachment,
+                                        AbstractTexture* depth_attachment)
+{
+  return nullptr;
+}
+
 void AbstractGfx::SetFramebuffer(AbstractFramebuffer* framebuffer)
 {
   m_current_framebuffer = framebuffer;
@@ -78,6 +78,10 @@ public:
   virtual std::unique_ptr<AbstractFramebuffer>
   CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
                     std::vector<AbstractTexture*> additional_color_attachments = {}) = 0;
+  // Creates a framebuffer where every draw renders all layers, one multiview view per layer.
+  // Pipelines for it must set FramebufferState::multiview. Only used if bSupportsMultiview is set.
+  virtual std::unique_ptr<AbstractFramebuffer>
+  CreateMultiviewFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment);
 
   // Framebuffer operations.
   virtual void SetFramebuffer(AbstractFramebuffer* framebuffer);
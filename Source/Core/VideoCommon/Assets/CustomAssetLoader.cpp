@@ -44,33 +44,44 @@ void CustomAssetLoader::Init()
     }
   });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (m_memory_exceeded)
-        return;
+  m_asset_load_thread.Reset("Custom Asset Loader",
+                            [this](std::weak_ptr<CustomAsset> asset) { LoadQueuedAsset(asset); });
+  m_asset_prefetch_thread.Reset("Custom Asset Prefetcher",
+                                [this](std::weak_ptr<CustomAsset> asset) {
+                                  // Setting the role for every asset is cheap compared to loading
+                                  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
+                                  LoadQueuedAsset(asset);
+                                });
+}
+
+void CustomAssetLoader::LoadQueuedAsset(std::weak_ptr<CustomAsset> asset)
+{
+  if (auto ptr = asset.lock())
+  {
+    if (m_memory_exceeded)
+      return;
 
-      if (ptr->Load())
+    if (ptr->Load())
+    {
+      std::lock_guard lk(m_asset_load_lock);
+      const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
+      m_total_bytes_loaded += asset_memory_size;
+      m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
+      if (m_total_bytes_loaded > m_max_memory_available)
       {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        m_total_bytes_loaded += asset_memory_size;
-        m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        if (m_total_bytes_loaded > m_max_memory_available)
-        {
-          ERROR_LOG_FMT(VIDEO,
-                        "Asset memory exceeded with asset '{}', future assets won't load until "
-                        "memory is available.",
-                        ptr->GetAssetId());
-          m_memory_exceeded = true;
-        }
+        ERROR_LOG_FMT(VIDEO,
+                      "Asset memory exceeded with asset '{}', future assets won't load until "
+                      "memory is available.",
+                      ptr->GetAssetId());
+        m_memory_exceeded = true;
       }
     }
-  });
+  }
 }
 
 void CustomAssetLoader ::Shutdown()
 {
+  m_asset_prefetch_thread.Shutdown(true);
   m_asset_load_thread.Shutdown(true);
 
   m_asset_monitor_thread_shutdown.Set();
@@ -83,26 +94,37 @@ std::shared_ptr<GameTextureAsset>
 CustomAssetLoader::LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
                                    std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library));
+  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library),
+                                              m_asset_load_thread);
+}
+
+std::shared_ptr<GameTextureAsset>
+CustomAssetLoader::PrefetchGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                                       std::shared_ptr<CustomAssetLibrary> library)
+{
+  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library),
+                                              m_asset_prefetch_thread);
 }
 
 std::shared_ptr<PixelShaderAsset>
 CustomAssetLoader::LoadPixelShader(const CustomAssetLibrary::AssetID& asset_id,
                                    std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<PixelShaderAsset>(asset_id, m_pixel_shaders, std::move(library));
+  return LoadOrCreateAsset<PixelShaderAsset>(asset_id, m_pixel_shaders, std::move(library),
+                                             m_asset_load_thread);
 }
 
 std::shared_ptr<MaterialAsset>
 CustomAssetLoader::LoadMaterial(const CustomAssetLibrary::AssetID& asset_id,
                                 std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<MaterialAsset>(asset_id, m_materials, std::move(library));
+  return LoadOrCreateAsset<MaterialAsset>(asset_id, m_materials, std::move(library),
+                                          m_asset_load_thread);
 }
 
 std::shared_ptr<MeshAsset> CustomAssetLoader::LoadMesh(const CustomAssetLibrary::AssetID& asset_id,
                                                        std::shared_ptr<CustomAssetLibrary> library)
 {
-  return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library));
+  return LoadOrCreateAsset<MeshAsset>(asset_id, m_meshes, std::move(library), m_asset_load_thread);
 }
 }  // namespace VideoCommon
@@ -43,6 +43,12 @@ public:
   std::shared_ptr<GameTextureAsset> LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
                                                     std::shared_ptr<CustomAssetLibrary> library);
 
+  // Same as 'LoadGameTexture' but for textures that are only expected to be needed soon.
+  // These are loaded by a separate, lower priority thread so they never delay other loads
+  std::shared_ptr<GameTextureAsset>
+  PrefetchGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                      std::shared_ptr<CustomAssetLibrary> library);
+
   std::shared_ptr<PixelShaderAsset> LoadPixelShader(const CustomAssetLibrary::AssetID& asset_id,
                                                     std::shared_ptr<CustomAssetLibrary> library);
 
@@ -58,7 +64,8 @@ private:
   std::shared_ptr<AssetType>
   LoadOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
                     std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
-                    std::shared_ptr<CustomAssetLibrary> library)
+                    std::shared_ptr<CustomAssetLibrary> library,
+                    Common::WorkQueueThread<std::weak_ptr<CustomAsset>>& load_thread)
   {
     auto [it, inserted] = asset_map.try_emplace(asset_id);
     if (!inserted)
@@ -81,10 +88,12 @@ private:
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    load_thread.Push(it->second);
     return ptr;
   }
 
+  void LoadQueuedAsset(std::weak_ptr<CustomAsset> asset);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
@@ -104,5 +113,6 @@ private:
   // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
   Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_prefetch_thread;
 };
 }  // namespace VideoCommon
@@ -0,0 +1,310 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
+
+#include <algorithm>
+#include <chrono>
+#include <tuple>
+
+#include <xxhash.h>
+#include <zstd.h>
+
+#include "Common/Logging/Log.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/RenderState.h"
+
+namespace VideoCommon
+{
+namespace TexturePackFormat
+{
+u64 HashName(std::string_view name)
+{
+  return XXH3_64bits(name.data(), name.size());
+}
+}  // namespace TexturePackFormat
+
+using namespace TexturePackFormat;
+
+bool TexturePackAssetLibrary::Open(const std::string& path)
+{
+  m_path = path;
+  m_open_time = std::chrono::system_clock::now();
+  if (!m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' could not be opened", path);
+    return false;
+  }
+
+  const u64 file_size = m_file.GetSize();
+  Header header;
+  if (!m_file.ReadArray(&header, 1) || header.magic != MAGIC)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is not a texture pack", path);
+    return false;
+  }
+  if (header.version != VERSION)
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has unsupported version {}", path, header.version);
+    return false;
+  }
+
+  const auto table_fits = [file_size](u64 offset, u64 size) {
+    return offset <= file_size && size <= file_size - offset;
+  };
+  if (!table_fits(header.levels_offset, u64{header.level_count} * sizeof(LevelEntry)) ||
+      !table_fits(header.index_offset, u64{header.entry_count} * sizeof(IndexEntry)) ||
+      !table_fits(header.names_offset, header.names_size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is truncated", path);
+    return false;
+  }
+
+  m_levels.resize(header.level_count);
+  m_index.resize(header.entry_count);
+  m_names.resize(header.names_size);
+  if (!m_file.Seek(header.levels_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadArray(m_levels.data(), m_levels.size()) ||
+      !m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadArray(m_index.data(), m_index.size()) ||
+      !m_file.Seek(header.names_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadBytes(m_names.data(), m_names.size()))
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' could not be read", path);
+    return false;
+  }
+
+  for (const IndexEntry& entry : m_index)
+  {
+    if (u64{entry.name_offset} + entry.name_length > m_names.size() || entry.level_count == 0 ||
+        u64{entry.first_level} + entry.level_count > m_levels.size() ||
+        entry.format >= static_cast<u32>(AbstractTextureFormat::Undefined))
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture pack '{}' has a corrupt index", path);
+      return false;
+    }
+  }
+  for (const LevelEntry& level : m_levels)
+  {
+    if (!table_fits(level.data_offset, level.stored_size))
+    {
+      ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is truncated", path);
+      return false;
+    }
+  }
+
+  // The writer sorts the index, but don't rely on it for lookups.
+  std::sort(m_index.begin(), m_index.end(), [](const IndexEntry& a, const IndexEntry& b) {
+    return a.name_hash < b.name_hash;
+  });
+
+  INFO_LOG_FMT(VIDEO, "Opened texture pack '{}' with {} textures", path, m_index.size());
+  return true;
+}
+
+std::vector<TexturePackAssetLibrary::TextureEntry> TexturePackAssetLibrary::GetTextures() const
+{
+  std::vector<TextureEntry> textures;
+  textures.reserve(m_index.size());
+  for (const IndexEntry& entry : m_index)
+    textures.push_back({GetName(entry), (entry.flags & ENTRY_FLAG_ARBITRARY_MIPMAPS) != 0});
+  return textures;
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadTexture(const AssetID& asset_id,
+                                                                  TextureData* data)
+{
+  const IndexEntry* entry = FindEntry(asset_id);
+  if (!entry)
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - not found in texture pack '{}'!", asset_id, m_path);
+    return {};
+  }
+
+  data->m_sampler = RenderState::GetLinearSamplerState();
+  data->m_type = TextureData::Type::Type_Texture2D;
+  data->m_texture.m_slices.clear();
+  auto& slice = data->m_texture.m_slices.emplace_back();
+  slice.m_levels.resize(entry->level_count);
+
+  std::size_t bytes_loaded = 0;
+  for (u32 i = 0; i < entry->level_count; i++)
+  {
+    auto& level = slice.m_levels[i];
+    if (!ReadLevel(m_levels[entry->first_level + i], &level))
+    {
+      ERROR_LOG_FMT(VIDEO, "Asset '{}' error - could not read mipmap level {} from '{}'!",
+                    asset_id, i, m_path);
+      return {};
+    }
+    level.format = static_cast<AbstractTextureFormat>(entry->format);
+    bytes_loaded += level.data.size();
+  }
+
+  return LoadInfo{bytes_loaded, m_open_time};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadPixelShader(const AssetID& asset_id,
+                                                                      PixelShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMaterial(const AssetID& asset_id,
+                                                                   MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackAssetLibrary::LoadMesh(const AssetID& asset_id, MeshData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs only contain textures!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::TimeType TexturePackAssetLibrary::GetLastAssetWriteTime(const AssetID&) const
+{
+  return m_open_time;
+}
+
+const IndexEntry* TexturePackAssetLibrary::FindEntry(std::string_view name) const
+{
+  const u64 hash = HashName(name);
+  auto iter = std::lower_bound(
+      m_index.begin(), m_index.end(), hash,
+      [](const IndexEntry& entry, u64 value) { return entry.name_hash < value; });
+  for (; iter != m_index.end() && iter->name_hash == hash; ++iter)
+  {
+    if (GetName(*iter) == name)
+      return &*iter;
+  }
+  return nullptr;
+}
+
+std::string_view TexturePackAssetLibrary::GetName(const IndexEntry& entry) const
+{
+  return std::string_view(m_names).substr(entry.name_offset, entry.name_length);
+}
+
+bool TexturePackAssetLibrary::ReadLevel(const LevelEntry& level_entry,
+                                        CustomTextureData::ArraySlice::Level* level)
+{
+  level->width = level_entry.width;
+  level->height = level_entry.height;
+  level->row_length = level_entry.row_length;
+  level->data.resize(level_entry.data_size);
+
+  const bool compressed = (level_entry.flags & LEVEL_FLAG_ZSTD) != 0;
+  if (!compressed && level_entry.stored_size != level_entry.data_size)
+    return false;
+
+  std::vector<u8> compressed_data;
+  {
+    std::lock_guard lk(m_file_lock);
+    if (!m_file.Seek(level_entry.data_offset, File::SeekOrigin::Begin))
+      return false;
+
+    if (!compressed)
+      return m_file.ReadBytes(level->data.data(), level->data.size());
+
+    compressed_data.resize(level_entry.stored_size);
+    if (!m_file.ReadBytes(compressed_data.data(), compressed_data.size()))
+      return false;
+  }
+
+  const size_t result = ZSTD_decompress(level->data.data(), level->data.size(),
+                                        compressed_data.data(), compressed_data.size());
+  return !ZSTD_isError(result) && result == level->data.size();
+}
+
+bool TexturePackWriter::Open(const std::string& path)
+{
+  if (!m_file.Open(path, "wb"))
+    return false;
+
+  // The header is written by Finish, once the offsets are known.
+  const Header header{};
+  return m_file.WriteArray(&header, 1);
+}
+
+bool TexturePackWriter::AddTexture(std::string_view name, bool has_arbitrary_mipmaps,
+                                   const CustomTextureData::ArraySlice& slice)
+{
+  if (slice.m_levels.empty())
+    return false;
+
+  IndexEntry entry{};
+  entry.name_hash = HashName(name);
+  entry.name_offset = static_cast<u32>(m_names.size());
+  entry.name_length = static_cast<u32>(name.size());
+  entry.format = static_cast<u32>(slice.m_levels[0].format);
+  entry.flags = has_arbitrary_mipmaps ? ENTRY_FLAG_ARBITRARY_MIPMAPS : 0;
+  entry.first_level = static_cast<u32>(m_levels.size());
+  entry.level_count = static_cast<u32>(slice.m_levels.size());
+
+  std::vector<u8> compressed_data;
+  for (const auto& level : slice.m_levels)
+  {
+    if (level.format != slice.m_levels[0].format)
+      return false;
+
+    LevelEntry level_entry{};
+    level_entry.data_offset = m_file.Tell();
+    level_entry.data_size = static_cast<u32>(level.data.size());
+    level_entry.width = level.width;
+    level_entry.height = level.height;
+    level_entry.row_length = level.row_length;
+
+    // Block compressed data barely shrinks, so only keep the compressed copy when it helps.
+    compressed_data.resize(ZSTD_compressBound(level.data.size()));
+    const size_t compressed_size =
+        ZSTD_compress(compressed_data.data(), compressed_data.size(), level.data.data(),
+                      level.data.size(), m_compression_level);
+    const bool use_compressed =
+        !ZSTD_isError(compressed_size) && compressed_size < level.data.size() * 15 / 16;
+
+    const u8* stored_data = use_compressed ? compressed_data.data() : level.data.data();
+    level_entry.stored_size =
+        use_compressed ? static_cast<u32>(compressed_size) : level_entry.data_size;
+    level_entry.flags = use_compressed ? LEVEL_FLAG_ZSTD : 0;
+    if (!m_file.WriteBytes(stored_data, level_entry.stored_size))
+      return false;
+
+    m_uncompressed_size += level_entry.data_size;
+    m_stored_size += level_entry.stored_size;
+    m_levels.push_back(level_entry);
+  }
+
+  m_names.append(name);
+  m_index.push_back(entry);
+  return true;
+}
+
+bool TexturePackWriter::Finish()
+{
+  std::sort(m_index.begin(), m_index.end(), [](const IndexEntry& a, const IndexEntry& b) {
+    return std::tie(a.name_hash, a.name_offset) < std::tie(b.name_hash, b.name_offset);
+  });
+
+  Header header{};
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.entry_count = static_cast<u32>(m_index.size());
+  header.level_count = static_cast<u32>(m_levels.size());
+  header.levels_offset = m_file.Tell();
+  if (!m_file.WriteArray(m_levels.data(), m_levels.size()))
+    return false;
+  header.index_offset = m_file.Tell();
+  if (!m_file.WriteArray(m_index.data(), m_index.size()))
+    return false;
+  header.names_offset = m_file.Tell();
+  header.names_size = m_names.size();
+  if (!m_file.WriteString(m_names))
+    return false;
+
+  return m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
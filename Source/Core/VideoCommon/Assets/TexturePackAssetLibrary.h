@@ -0,0 +1,142 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// A texture pack is a single file holding many custom textures, so that a large pack doesn't
+// have to be scanned file by file at boot. Textures are stored in the format they are uploaded
+// in (PNGs are decoded to RGBA8 when the pack is built), optionally zstd compressed, so loading
+// one is a read and at most a decompression.
+//
+// Layout: header, level payloads, level table, index sorted by name hash, name table.
+namespace TexturePackFormat
+{
+constexpr u32 MAGIC = 0x31505444;  // "DTP1"
+constexpr u32 VERSION = 1;
+
+struct Header
+{
+  u32 magic;
+  u32 version;
+  u32 entry_count;
+  u32 level_count;
+  u64 levels_offset;
+  u64 index_offset;
+  u64 names_offset;
+  u64 names_size;
+};
+static_assert(sizeof(Header) == 48);
+
+enum EntryFlags : u32
+{
+  ENTRY_FLAG_ARBITRARY_MIPMAPS = 1 << 0,
+};
+
+struct IndexEntry
+{
+  u64 name_hash;
+  u32 name_offset;
+  u32 name_length;
+  u32 format;
+  u32 flags;
+  u32 first_level;
+  u32 level_count;
+};
+static_assert(sizeof(IndexEntry) == 32);
+
+enum LevelFlags : u32
+{
+  LEVEL_FLAG_ZSTD = 1 << 0,
+};
+
+struct LevelEntry
+{
+  u64 data_offset;
+  u32 stored_size;
+  u32 data_size;
+  u32 width;
+  u32 height;
+  u32 row_length;
+  u32 flags;
+};
+static_assert(sizeof(LevelEntry) == 32);
+
+u64 HashName(std::string_view name);
+}  // namespace TexturePackFormat
+
+// This class implements 'CustomAssetLibrary' and loads game textures from a texture pack
+class TexturePackAssetLibrary final : public CustomAssetLibrary
+{
+public:
+  struct TextureEntry
+  {
+    std::string_view name;
+    bool has_arbitrary_mipmaps;
+  };
+
+  bool Open(const std::string& path);
+
+  // The names stay valid as long as the library is alive
+  std::vector<TextureEntry> GetTextures() const;
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureData* data) override;
+  LoadInfo LoadPixelShader(const AssetID& asset_id, PixelShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+  LoadInfo LoadMesh(const AssetID& asset_id, MeshData* data) override;
+
+  // A pack doesn't change while it is open, so this is the time it was opened
+  TimeType GetLastAssetWriteTime(const AssetID& asset_id) const override;
+
+private:
+  const TexturePackFormat::IndexEntry* FindEntry(std::string_view name) const;
+  std::string_view GetName(const TexturePackFormat::IndexEntry& entry) const;
+  bool ReadLevel(const TexturePackFormat::LevelEntry& level_entry,
+                 CustomTextureData::ArraySlice::Level* level);
+
+  std::string m_path;
+  TimeType m_open_time;
+  std::vector<TexturePackFormat::IndexEntry> m_index;
+  std::vector<TexturePackFormat::LevelEntry> m_levels;
+  std::string m_names;
+
+  std::mutex m_file_lock;
+  File::IOFile m_file;
+};
+
+// Builds a texture pack. Textures are written out as they are added, so only the index is kept
+// in memory.
+class TexturePackWriter
+{
+public:
+  explicit TexturePackWriter(int compression_level) : m_compression_level(compression_level) {}
+
+  bool Open(const std::string& path);
+  bool AddTexture(std::string_view name, bool has_arbitrary_mipmaps,
+                  const CustomTextureData::ArraySlice& slice);
+  bool Finish();
+
+  u64 GetUncompressedSize() const { return m_uncompressed_size; }
+  u64 GetStoredSize() const { return m_stored_size; }
+
+private:
+  File::IOFile m_file;
+  int m_compression_level;
+  std::vector<TexturePackFormat::IndexEntry> m_index;
+  std::vector<TexturePackFormat::LevelEntry> m_levels;
+  std::string m_names;
+  u64 m_uncompressed_size = 0;
+  u64 m_stored_size = 0;
+};
+}  // namespace VideoCommon
@@ -3,11 +3,13 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 
 #include "Core/Core.h"
 #include "Core/System.h"
@@ -36,11 +38,53 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   else
   {
     std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
+    m_pending_work.emplace(priority, PendingWorkItem{std::move(item), Common::Timer::NowUs()});
+    m_pending_work_count.store(m_pending_work.size(), std::memory_order_relaxed);
     m_worker_thread_wake.notify_one();
   }
 }
 
+void AsyncShaderCompiler::SetBackgroundPriority(u32 priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  m_background_priority = priority;
+}
+
+void AsyncShaderCompiler::SetReserveWorkerForOnDemand(bool reserve)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  m_reserve_worker_for_on_demand = reserve;
+
+  // Workers that were held back may be able to take background work now.
+  m_worker_thread_wake.notify_all();
+}
+
+AsyncShaderCompiler::QueueLatencyStats
+AsyncShaderCompiler::GetQueueLatencyStats(WorkClass work_class) const
+{
+  const AtomicQueueLatencyStats& stats = m_latency_stats[static_cast<size_t>(work_class)];
+  QueueLatencyStats result;
+  result.items = stats.items.load(std::memory_order_relaxed);
+  result.total_wait_us = stats.total_wait_us.load(std::memory_order_relaxed);
+  result.max_wait_us = stats.max_wait_us.load(std::memory_order_relaxed);
+  return result;
+}
+
+AsyncShaderCompiler::WorkClass AsyncShaderCompiler::GetWorkClass(u32 priority) const
+{
+  return priority >= m_background_priority ? WorkClass::Background : WorkClass::OnDemand;
+}
+
+bool AsyncShaderCompiler::CanStartWork(WorkClass work_class) const
+{
+  if (work_class == WorkClass::OnDemand || !m_reserve_worker_for_on_demand)
+    return true;
+
+  // With a single worker there is nothing to reserve.
+  const size_t max_background_workers = std::max<size_t>(m_num_started_workers, 2) - 1;
+  return m_busy_background_workers < max_background_workers;
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -143,6 +187,12 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
     m_worker_threads.push_back(std::move(thr));
   }
 
+  {
+    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    m_num_started_workers = m_worker_threads.size();
+    m_worker_thread_wake.notify_all();
+  }
+
   return HasWorkerThreads();
 }
 
@@ -176,6 +226,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
   for (std::thread& thr : m_worker_threads)
     thr.join();
   m_worker_threads.clear();
+  m_num_started_workers = 0;
   m_exit_flag.Clear();
 }
 
@@ -196,6 +247,7 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
+  Common::SetCurrentThreadRole(Common::ThreadRole::Background);
 
   // Initialize worker thread with backend-specific method.
   if (!WorkerThreadInitWorkerThread(param))
@@ -223,10 +275,25 @@ void AsyncShaderCompiler::WorkerThreadRun()
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
-      m_busy_workers++;
       auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
+      const WorkClass work_class = GetWorkClass(iter->first);
+      if (!CanStartWork(work_class))
+        break;
+
+      m_busy_workers++;
+      if (work_class == WorkClass::Background)
+        m_busy_background_workers++;
+
+      WorkItemPtr item(std::move(iter->second.item));
+      const u64 wait_us = Common::Timer::NowUs() - iter->second.queue_time_us;
       m_pending_work.erase(iter);
+      m_pending_work_count.store(m_pending_work.size(), std::memory_order_relaxed);
+
+      AtomicQueueLatencyStats& stats = m_latency_stats[static_cast<size_t>(work_class)];
+      stats.items.fetch_add(1, std::memory_order_relaxed);
+      stats.total_wait_us.fetch_add(wait_us, std::memory_order_relaxed);
+      if (wait_us > stats.max_wait_us.load(std::memory_order_relaxed))
+        stats.max_wait_us.store(wait_us, std::memory_order_relaxed);
       pending_lock.unlock();
 
       if (item->Compile())
@@ -237,6 +304,13 @@ void AsyncShaderCompiler::WorkerThreadRun()
 
       pending_lock.lock();
       m_busy_workers--;
+      if (work_class == WorkClass::Background)
+      {
+        // A worker that was held back can take background work again.
+        m_busy_background_workers--;
+        if (m_reserve_worker_for_on_demand && !m_pending_work.empty())
+          m_worker_thread_wake.notify_one();
+      }
     }
   }
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <deque>
@@ -33,6 +34,21 @@ public:
 
   using WorkItemPtr = std::unique_ptr<WorkItem>;
 
+  // Work that is needed to draw the current frame, and work that is only compiled ahead of time.
+  enum class WorkClass : u32
+  {
+    OnDemand,
+    Background,
+    Count
+  };
+
+  struct QueueLatencyStats
+  {
+    u64 items = 0;
+    u64 total_wait_us = 0;
+    u64 max_wait_us = 0;
+  };
+
   AsyncShaderCompiler();
   virtual ~AsyncShaderCompiler();
 
@@ -45,10 +61,27 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+
+  // Work items with this priority value or higher are background work.
+  void SetBackgroundPriority(u32 priority);
+  // When enabled, background work is never given to the last idle worker, so that on-demand
+  // work queued during a burst of background work can start right away.
+  void SetReserveWorkerForOnDemand(bool reserve);
+
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
 
+  // Number of work items waiting for a worker thread. Doesn't lock, so it can be read from any
+  // thread, but may be slightly out of date.
+  size_t GetPendingWorkItemCount() const
+  {
+    return m_pending_work_count.load(std::memory_order_relaxed);
+  }
+
+  // Time work items of a class spent in the queue before a worker picked them up.
+  QueueLatencyStats GetQueueLatencyStats(WorkClass work_class) const;
+
   // Calls progress_callback periodically, with completed_items, and total_items.
   // Returns false if interrupted.
   bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
@@ -67,6 +100,8 @@ protected:
 private:
   void WorkerThreadEntryPoint(void* param);
   void WorkerThreadRun();
+  WorkClass GetWorkClass(u32 priority) const;
+  bool CanStartWork(WorkClass work_class) const;
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -74,13 +109,35 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
+  struct PendingWorkItem
+  {
+    WorkItemPtr item;
+    u64 queue_time_us;
+  };
+
+  struct AtomicQueueLatencyStats
+  {
+    std::atomic<u64> items{0};
+    std::atomic<u64> total_wait_us{0};
+    std::atomic<u64> max_wait_us{0};
+  };
+
   // A multimap is used to store the work items. We can't use a priority_queue here, because
   // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
+  std::multimap<u32, PendingWorkItem> m_pending_work;
   std::mutex m_pending_work_lock;
+  std::atomic_size_t m_pending_work_count{0};
   std::condition_variable m_worker_thread_wake;
   std::atomic_size_t m_busy_workers{0};
 
+  // Protected by m_pending_work_lock.
+  u32 m_background_priority = UINT32_MAX;
+  bool m_reserve_worker_for_on_demand = false;
+  size_t m_num_started_workers = 0;
+  size_t m_busy_background_workers = 0;
+
+  std::array<AtomicQueueLatencyStats, static_cast<size_t>(WorkClass::Count)> m_latency_stats;
+
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
 };
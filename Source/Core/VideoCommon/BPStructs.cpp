@@ -31,12 +31,14 @@
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PerfQueryBase.h"
 #include "VideoCommon/PixelEngine.h"
+#include "VideoCommon/PixelShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/TextureDecoder.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -96,6 +98,9 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
 
   ((u32*)&bpmem)[bp.address] = bp.newvalue;
 
+  if (IsPixelShaderUidBPRegister(bp.address))
+    g_vertex_manager->SetPixelShaderUidChanged();
+
   switch (bp.address)
   {
   case BPMEM_GENMODE:  // Set the Generation Mode
@@ -9,22 +9,32 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/VideoEvents.h"
 
 #include <algorithm>
 
 std::unique_ptr<BoundingBox> g_bounding_box;
 
+BoundingBox::BoundingBox()
+{
+  m_frame_end_handle =
+      AfterFrameEvent::Register([this](Core::System&) { EndOfFrame(); }, "BoundingBox");
+}
+
 void BoundingBox::Enable(PixelShaderManager& pixel_shader_manager)
 {
   m_is_active = true;
   pixel_shader_manager.SetBoundingBoxActive(m_is_active);
+  g_vertex_manager->SetPixelShaderUidChanged();
 }
 
 void BoundingBox::Disable(PixelShaderManager& pixel_shader_manager)
 {
   m_is_active = false;
   pixel_shader_manager.SetBoundingBoxActive(m_is_active);
+  g_vertex_manager->SetPixelShaderUidChanged();
 }
 
 void BoundingBox::Flush()
@@ -72,6 +82,58 @@ void BoundingBox::Readback()
   m_is_valid = true;
 }
 
+void BoundingBox::DeferredReadback()
+{
+  if (!g_ActiveConfig.backend_info.bSupportsBBox)
+    return;
+
+  const u32 index = m_readbacks_this_frame;
+  if (index >= MAX_DEFERRED_READBACKS_PER_FRAME)
+  {
+    Readback();
+    return;
+  }
+
+  // Without a matching readback in the previous frame, there is nothing to return yet but the
+  // current values.
+  if (index < m_readbacks_last_frame)
+  {
+    const u32 last_slot = (m_readback_set ^ 1) * MAX_DEFERRED_READBACKS_PER_FRAME + index;
+    const auto read_values = GetAsyncReadResult(last_slot);
+    for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+    {
+      if (!m_dirty[i])
+        m_values[i] = read_values[i];
+    }
+  }
+  else
+  {
+    Readback();
+  }
+
+  ReadAsync(m_readback_set * MAX_DEFERRED_READBACKS_PER_FRAME + index);
+  m_readbacks_this_frame++;
+  m_is_valid = true;
+}
+
+void BoundingBox::EndOfFrame()
+{
+  m_readbacks_last_frame = m_readbacks_this_frame;
+  m_readbacks_this_frame = 0;
+  m_readback_set ^= 1;
+}
+
+void BoundingBox::ReadAsync(u32 slot)
+{
+  const auto values = Read(0, NUM_BBOX_VALUES);
+  std::copy(values.begin(), values.end(), m_async_read_values[slot].begin());
+}
+
+std::array<BBoxType, NUM_BBOX_VALUES> BoundingBox::GetAsyncReadResult(u32 slot)
+{
+  return m_async_read_values[slot];
+}
+
 u16 BoundingBox::Get(u32 index)
 {
   ASSERT(index < NUM_BBOX_VALUES);
@@ -80,7 +142,12 @@ u16 BoundingBox::Get(u32 index)
     return m_bounding_box_fallback[index];
 
   if (!m_is_valid)
-    Readback();
+  {
+    if (g_ActiveConfig.bBBoxDeferredReadback)
+      DeferredReadback();
+    else
+      Readback();
+  }
 
   return static_cast<u16>(m_values[index]);
 }
@@ -120,6 +187,9 @@ void BoundingBox::DoState(PointerWrap& p)
   {
     p.Do(backend_values);
 
+    // The values read back before loading the state don't belong to it.
+    m_readbacks_last_frame = 0;
+
     if (g_ActiveConfig.backend_info.bSupportsBBox)
       Write(0, backend_values);
   }
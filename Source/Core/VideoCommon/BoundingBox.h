@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
 
 class PixelShaderManager;
 class PointerWrap;
@@ -19,7 +20,7 @@ constexpr u32 NUM_BBOX_VALUES = 4;
 class BoundingBox
 {
 public:
-  explicit BoundingBox() = default;
+  BoundingBox();
   virtual ~BoundingBox() = default;
 
   bool IsEnabled() const { return m_is_active; }
@@ -41,8 +42,21 @@ protected:
   virtual std::vector<BBoxType> Read(u32 index, u32 length) = 0;
   virtual void Write(u32 index, std::span<const BBoxType> values) = 0;
 
+  // Number of values the deferred readback mode can have in flight. Each frame uses half of the
+  // slots, while the results of the other half, from the previous frame, are consumed.
+  static constexpr u32 MAX_DEFERRED_READBACKS_PER_FRAME = 8;
+  static constexpr u32 NUM_READBACK_SLOTS = MAX_DEFERRED_READBACKS_PER_FRAME * 2;
+
+  // Queues a copy of the current values into the given slot without waiting for the GPU, and
+  // returns the values copied by the last ReadAsync call for that slot. Backends without an
+  // asynchronous path fall back to reading the values immediately.
+  virtual void ReadAsync(u32 slot);
+  virtual std::array<BBoxType, NUM_BBOX_VALUES> GetAsyncReadResult(u32 slot);
+
 private:
   void Readback();
+  void DeferredReadback();
+  void EndOfFrame();
 
   bool m_is_active = false;
 
@@ -50,6 +64,14 @@ private:
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
 
+  // Games tend to read the bounding box at the same points of every frame, so the nth deferred
+  // readback of a frame returns the values of the nth readback of the previous frame.
+  u32 m_readback_set = 0;
+  u32 m_readbacks_this_frame = 0;
+  u32 m_readbacks_last_frame = 0;
+  std::array<std::array<BBoxType, NUM_BBOX_VALUES>, NUM_READBACK_SLOTS> m_async_read_values = {};
+  Common::EventHook m_frame_end_handle;
+
   // Nintendo's SDK seems to write "default" bounding box values before every draw (1023 0 1023 0
   // are the only values encountered so far, which happen to be the extents allowed by the BP
   // registers) to reset the registers for comparison in the pixel engine, and presumably to detect
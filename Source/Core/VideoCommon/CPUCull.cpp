@@ -3,6 +3,8 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -164,9 +166,20 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
   if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
     cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
-  transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+
+  // Most draws that aren't culled can be rejected after looking at the first few triangles, so
+  // transform the vertices in growing chunks instead of all at once. Chunk sizes are multiples of
+  // 12 so that no quad or triangle is split across chunks.
+  u32 chunk_size = MIN_CHUNK_SIZE;
+  for (u32 begin = 0; begin < count; begin += chunk_size, chunk_size *= 2)
+  {
+    const u32 end = std::min(begin + chunk_size, count);
+    transform(&m_transform_buffer[begin], src + begin * stride, stride, end - begin);
+    if (!cull(m_transform_buffer.get(), begin, end))
+      return false;
+  }
+  return true;
 }
 
 template <typename T>
@@ -21,9 +21,11 @@ public:
   };
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int, int);
 
 private:
+  static constexpr u32 MIN_CHUNK_SIZE = 24;
+
   template <typename T>
   struct BufferDeleter
   {
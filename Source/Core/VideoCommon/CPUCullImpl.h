@@ -653,17 +653,19 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
+// Checks the triangles whose last vertex lies in [begin, end). All vertices before end must have
+// been transformed. begin must be a multiple of 12, so that no quad or triangle is split.
 template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
 ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+                                             int begin, int end)
 {
   switch (Primitive)
   {
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
   {
-    int i = 3;
-    for (; i < count; i += 4)
+    int i = begin + 3;
+    for (; i < end; i += 4)
     {
       if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
         return false;
@@ -671,7 +673,7 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
         return false;
     }
     // three vertices remaining, so render a triangle
-    if (i == count)
+    if (i == end)
     {
       if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
         return false;
@@ -679,7 +681,7 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
-    for (int i = 2; i < count; i += 3)
+    for (int i = begin + 2; i < end; i += 3)
     {
       if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - 1], transformed[i - 0]))
         return false;
@@ -687,17 +689,16 @@ ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* t
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
   {
-    bool wind = false;
-    for (int i = 2; i < count; ++i)
+    for (int i = std::max(begin, 2); i < end; ++i)
     {
+      const bool wind = i & 1;
       if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
         return false;
-      wind = !wind;
     }
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
-    for (int i = 2; i < count; ++i)
+    for (int i = std::max(begin, 2); i < end; ++i)
     {
       if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
         return false;
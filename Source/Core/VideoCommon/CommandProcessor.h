@@ -174,7 +174,8 @@ public:
 
   void SetCPStatusFromGPU();
   void SetCPStatusFromCPU();
-  void GatherPipeBursted();
+  // Called after the CPU has written the given number of 32-byte bursts to the FIFO.
+  void GatherPipeBursted(u32 num_bursts = 1);
   void UpdateInterrupts(u64 userdata);
   void UpdateInterruptsFromVideoBackend(u64 userdata);
 
@@ -11,8 +11,10 @@
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
 #include "Common/FPURoundMode.h"
+#include "Common/Instrumentation.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
+#include "Common/Timer.h"
 
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -27,7 +29,9 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/MetricsServer.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/StutterTracker.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -150,7 +154,10 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
-    m_gpu_mainloop.Wait();
+    {
+      StutterScope stutter_scope(StutterCause::GPUSync);
+      m_gpu_mainloop.Wait();
+    }
     if (!m_gpu_mainloop.IsRunning())
       return;
 
@@ -292,6 +299,8 @@ void FifoManager::RunGpuLoop()
 
   m_gpu_mainloop.Run(
       [this] {
+        INSTRUMENT_ZONE("Fifo::RunGpuLoop");
+
         // Run events from the CPU thread.
         AsyncRequests::GetInstance()->PullEvents();
 
@@ -299,6 +308,8 @@ void FifoManager::RunGpuLoop()
         if (!m_emu_running_state.IsSet())
           return;
 
+        const u64 busy_start_us = g_metrics_server.IsRunning() ? Common::Timer::NowUs() : 0;
+
         if (m_use_deterministic_gpu_thread)
         {
           // All the fifo/CP stuff is on the CPU.  We just need to run the opcode decoder.
@@ -389,6 +400,9 @@ void FifoManager::RunGpuLoop()
           g_vertex_manager->Flush();
           g_framebuffer_manager->RefreshPeekCache();
         }
+
+        if (busy_start_us != 0)
+          g_metrics_server.AddGPUThreadBusyTime(Common::Timer::NowUs() - busy_start_us);
       },
       100);
 
@@ -31,7 +31,7 @@ static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 FrameDumper::FrameDumper()
 {
   m_frame_end_handle =
-      AfterFrameEvent::Register([this](Core::System&) { FlushFrameDump(); }, "FrameDumper");
+      AfterFrameEvent::Register([this](Core::System&) { QueueReadbackFrames(); }, "FrameDumper");
 }
 
 FrameDumper::~FrameDumper()
@@ -62,13 +62,22 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // Only happens if frames are dumped without AfterFrameEvent being triggered in between.
+  if (m_readback_frames_pending == READBACK_DELAY + 1)
+    QueueOldestReadbackFrame();
+
+  const size_t index =
+      (m_readback_frames_start + m_readback_frames_pending) % m_readback_frames.size();
+  if (m_frame_dump_frame_running && m_frame_dump_output_index == index)
+    FinishFrameData();
+
+  ReadbackFrame& frame = m_readback_frames[index];
+  if (!CheckFrameDumpReadbackTexture(frame.texture, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  frame.texture->CopyFromTexture(src_texture, copy_rect, 0, 0, frame.texture->GetRect());
+  frame.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_readback_frames_pending++;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -99,9 +108,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                                 u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -118,32 +127,47 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  while (m_readback_frames_pending != 0)
+    QueueOldestReadbackFrame();
+}
+
+void FrameDumper::QueueReadbackFrames()
+{
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+  {
+    ShutdownFrameDumping();
     return;
+  }
+
+  while (m_readback_frames_pending > READBACK_DELAY)
+    QueueOldestReadbackFrame();
+}
 
-  // Ensure dumping thread is done with output texture before swapping.
+void FrameDumper::QueueOldestReadbackFrame()
+{
+  // Ensure dumping thread is done with output texture before handing it the next one.
   FinishFrameData();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  const size_t index = m_readback_frames_start;
+  m_readback_frames_start = (m_readback_frames_start + 1) % m_readback_frames.size();
+  m_readback_frames_pending--;
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
+  // Queue encoding of the oldest frame dumped.
+  const ReadbackFrame& frame = m_readback_frames[index];
+  AbstractStagingTexture* const output = frame.texture.get();
   output->Flush();
   if (output->Map())
   {
+    m_frame_dump_output_index = index;
     DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()),
+                  frame.state);
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
   }
-
-  m_frame_dump_needs_flush = false;
-
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
 }
 
 void FrameDumper::ShutdownFrameDumping()
@@ -165,13 +189,14 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  for (ReadbackFrame& frame : m_readback_frames)
+    frame.texture.reset();
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride,
+                                const FrameState& state)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  m_frame_dump_data = FrameData{data, w, h, stride, state};
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -194,7 +219,7 @@ void FrameDumper::FinishFrameData()
   m_frame_dump_done.Wait();
   m_frame_dump_frame_running = false;
 
-  m_frame_dump_output_texture->Unmap();
+  m_readback_frames[m_frame_dump_output_index].texture->Unmap();
 }
 
 void FrameDumper::FrameDumpThreadFunc()
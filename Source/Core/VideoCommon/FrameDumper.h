@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -25,6 +28,9 @@ public:
   // Ensures all rendered frames are queued for encoding.
   void FlushFrameDump();
 
+  // Queues the frames whose readback should have completed by now for encoding.
+  void QueueReadbackFrames();
+
   // Fills the frame dump staging texture with the current XFB texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
@@ -53,10 +59,14 @@ private:
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
   // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  bool CheckFrameDumpReadbackTexture(std::unique_ptr<AbstractStagingTexture>& rbtex,
+                                     u32 target_width, u32 target_height);
+
+  // Maps the oldest read back frame and hands it to the frame dump thread.
+  void QueueOldestReadbackFrame();
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void DumpFrameData(const u8* data, int w, int h, int stride, const FrameState& state);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -70,9 +80,6 @@ private:
   // Set by frame dump thread on frame completion.
   Common::Event m_frame_dump_done;
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
-
   // Communication of frame between video and dump threads.
   FrameData m_frame_dump_data;
 
@@ -80,11 +87,23 @@ private:
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
+  // Frames stay in their readback texture for this many frames before they are mapped, so that
+  // mapping them doesn't have to wait for the GPU to finish the copy.
+  static constexpr size_t READBACK_DELAY = 2;
+
+  struct ReadbackFrame
+  {
+    std::unique_ptr<AbstractStagingTexture> texture;
+    // Emulation state during the swap the frame was dumped at.
+    FrameState state;
+  };
+
+  // Ring of the frames waiting to be read back, plus the one being encoded.
+  std::array<ReadbackFrame, READBACK_DELAY + 2> m_readback_frames;
+  size_t m_readback_frames_start = 0;
+  size_t m_readback_frames_pending = 0;
+  // Index of the frame whose texture is mapped while the thread is processing it.
+  size_t m_frame_dump_output_index = 0;
   // Set when thread is processing output texture.
   bool m_frame_dump_frame_running = false;
 
@@ -22,6 +22,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/TemporalUpscaler.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -171,6 +172,7 @@ FramebufferState FramebufferManager::GetEFBFramebufferState() const
   ret.depth_texture_format = m_efb_depth_texture->GetFormat();
   ret.per_sample_shading = IsEFBMultisampled() && g_ActiveConfig.bSSAA;
   ret.samples = m_efb_color_texture->GetSamples();
+  ret.multiview = m_efb_multiview;
   return ret;
 }
 
@@ -221,6 +223,10 @@ std::tuple<u32, u32> FramebufferManager::CalculateTargetSize()
   if (max_size < EFB_WIDTH * m_efb_scale)
     m_efb_scale = max_size / EFB_WIDTH;
 
+  m_target_efb_scale = static_cast<unsigned int>(m_efb_scale);
+  if (VideoCommon::TemporalUpscaler::IsEnabled())
+    m_efb_scale = VideoCommon::TemporalUpscaler::GetRenderScale(m_target_efb_scale);
+
   u32 new_efb_width = std::max(EFB_WIDTH * static_cast<int>(m_efb_scale), 1u);
   u32 new_efb_height = std::max(EFB_HEIGHT * static_cast<int>(m_efb_scale), 1u);
 
@@ -242,10 +248,21 @@ bool FramebufferManager::CreateEFBFramebuffer()
   if (!m_efb_color_texture || !m_efb_depth_texture || !m_efb_convert_color_texture)
     return false;
 
-  m_efb_framebuffer =
-      g_gfx->CreateFramebuffer(m_efb_color_texture.get(), m_efb_depth_texture.get());
-  m_efb_convert_framebuffer =
-      g_gfx->CreateFramebuffer(m_efb_convert_color_texture.get(), m_efb_depth_texture.get());
+  m_efb_multiview = IsEFBStereo() && g_ActiveConfig.UseMultiviewStereo();
+  if (m_efb_multiview)
+  {
+    m_efb_framebuffer =
+        g_gfx->CreateMultiviewFramebuffer(m_efb_color_texture.get(), m_efb_depth_texture.get());
+    m_efb_convert_framebuffer = g_gfx->CreateMultiviewFramebuffer(
+        m_efb_convert_color_texture.get(), m_efb_depth_texture.get());
+  }
+  else
+  {
+    m_efb_framebuffer =
+        g_gfx->CreateFramebuffer(m_efb_color_texture.get(), m_efb_depth_texture.get());
+    m_efb_convert_framebuffer =
+        g_gfx->CreateFramebuffer(m_efb_convert_color_texture.get(), m_efb_depth_texture.get());
+  }
   if (!m_efb_framebuffer || !m_efb_convert_framebuffer)
     return false;
 
@@ -416,7 +433,9 @@ bool FramebufferManager::CompileConversionPipelines()
 
     AbstractPipelineConfig config = {};
     config.vertex_shader = g_shader_cache->GetScreenQuadVertexShader();
-    config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetTexcoordGeometryShader() : nullptr;
+    config.geometry_shader = IsEFBStereo() && !IsEFBMultiview() ?
+                                 g_shader_cache->GetTexcoordGeometryShader() :
+                                 nullptr;
     config.pixel_shader = pixel_shader.get();
     config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
     config.depth_state = RenderState::GetNoDepthTestingDepthState();
@@ -480,7 +499,11 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
+  {
+    // Queue the other tiles that are likely to be peeked soon, and wait for all of them at once.
+    PopulateEFBCache(false, tile_index, true);
+    PopulatePredictedEFBCacheTiles(false);
+  }
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -503,7 +526,11 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+  {
+    // Queue the other tiles that are likely to be peeked soon, and wait for all of them at once.
+    PopulateEFBCache(true, tile_index, true);
+    PopulatePredictedEFBCacheTiles(true);
+  }
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -538,20 +565,9 @@ void FramebufferManager::RefreshPeekCache()
     return;
   }
 
-  bool flush_command_buffer = false;
-  for (u32 i = 0; i < m_efb_color_cache.tiles.size(); i++)
-  {
-    if (m_efb_color_cache.tiles[i].frame_access_mask != 0 && !m_efb_color_cache.tiles[i].present)
-    {
-      PopulateEFBCache(false, i, true);
-      flush_command_buffer = true;
-    }
-    if (m_efb_depth_cache.tiles[i].frame_access_mask != 0 && !m_efb_depth_cache.tiles[i].present)
-    {
-      PopulateEFBCache(true, i, true);
-      flush_command_buffer = true;
-    }
-  }
+  const bool populated_color = PopulatePredictedEFBCacheTiles(false);
+  const bool populated_depth = PopulatePredictedEFBCacheTiles(true);
+  const bool flush_command_buffer = populated_color || populated_depth;
 
   m_efb_depth_cache.needs_refresh = false;
   m_efb_color_cache.needs_refresh = false;
@@ -562,8 +578,30 @@ void FramebufferManager::RefreshPeekCache()
   }
 }
 
+bool FramebufferManager::PopulatePredictedEFBCacheTiles(bool depth)
+{
+  // Games that peek the EFB tend to peek the same regions every frame, so any tile which was
+  // accessed in the last few frames is likely to be needed again. Reading those back together
+  // means that a peek which misses the cache waits for a single readback instead of one per tile.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  bool populated = false;
+  for (u32 i = 0; i < data.tiles.size(); i++)
+  {
+    if (data.tiles[i].frame_access_mask != 0 && !data.tiles[i].present)
+    {
+      PopulateEFBCache(depth, i, true);
+      populated = true;
+    }
+  }
+
+  return populated;
+}
+
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
+  if (forced)
+    m_efb_content_version++;
+
   if (forced || m_efb_color_cache.out_of_date)
   {
     if (m_efb_color_cache.has_active_tiles)
@@ -598,6 +636,8 @@ void FramebufferManager::InvalidatePeekCache(bool forced)
 
 void FramebufferManager::FlagPeekCacheAsOutOfDate()
 {
+  m_efb_content_version++;
+
   if (m_efb_color_cache.has_active_tiles)
     m_efb_color_cache.out_of_date = true;
   if (m_efb_depth_cache.has_active_tiles)
@@ -678,6 +718,8 @@ bool FramebufferManager::CompileReadbackPipelines()
   config.framebuffer_state = GetEFBFramebufferState();
   config.framebuffer_state.per_sample_shading = false;
   config.vertex_shader = g_shader_cache->GetScreenQuadVertexShader();
+  if (IsEFBMultiview())
+    config.geometry_shader = nullptr;
   config.pixel_shader = restore_shader.get();
   m_efb_restore_pipeline = g_gfx->CreatePipeline(config);
   if (!m_efb_restore_pipeline)
@@ -894,7 +936,8 @@ bool FramebufferManager::CompileClearPipelines()
   AbstractPipelineConfig config;
   config.vertex_format = nullptr;
   config.vertex_shader = vertex_shader.get();
-  config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetColorGeometryShader() : nullptr;
+  config.geometry_shader =
+      IsEFBStereo() && !IsEFBMultiview() ? g_shader_cache->GetColorGeometryShader() : nullptr;
   config.pixel_shader = g_shader_cache->GetColorPixelShader();
   config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
   config.depth_state = RenderState::GetAlwaysWriteDepthState();
@@ -946,7 +989,7 @@ AbstractPipeline* FramebufferManager::GetClearPipeline(bool colorEnable, bool al
 void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
 {
   // Flush if we exceeded the number of vertices per batch.
-  if ((m_color_poke_vertices.size() + 6) > MAX_POKE_VERTICES)
+  if ((m_color_poke_vertices.size() + m_depth_poke_vertices.size() + 6) > MAX_POKE_VERTICES)
     FlushEFBPokes();
 
   CreatePokeVertices(&m_color_poke_vertices, x, y, 0.0f, color);
@@ -964,7 +1007,7 @@ void FramebufferManager::PokeEFBColor(u32 x, u32 y, u32 color)
 void FramebufferManager::PokeEFBDepth(u32 x, u32 y, float depth)
 {
   // Flush if we exceeded the number of vertices per batch.
-  if ((m_depth_poke_vertices.size() + 6) > MAX_POKE_VERTICES)
+  if ((m_color_poke_vertices.size() + m_depth_poke_vertices.size() + 6) > MAX_POKE_VERTICES)
     FlushEFBPokes();
 
   CreatePokeVertices(&m_depth_poke_vertices, x, y, depth, 0);
@@ -1009,36 +1052,39 @@ void FramebufferManager::CreatePokeVertices(std::vector<EFBPokeVertex>* destinat
 
 void FramebufferManager::FlushEFBPokes()
 {
-  if (!m_color_poke_vertices.empty())
-  {
-    DrawPokeVertices(m_color_poke_vertices.data(), static_cast<u32>(m_color_poke_vertices.size()),
-                     m_color_poke_pipeline.get());
-    m_color_poke_vertices.clear();
-  }
+  if (m_color_poke_vertices.empty() && m_depth_poke_vertices.empty())
+    return;
 
-  if (!m_depth_poke_vertices.empty())
-  {
-    DrawPokeVertices(m_depth_poke_vertices.data(), static_cast<u32>(m_depth_poke_vertices.size()),
-                     m_depth_poke_pipeline.get());
-    m_depth_poke_vertices.clear();
-  }
-}
+  m_efb_content_version++;
+
+  // Upload the color and depth pokes in a single batch, then draw each range with its pipeline.
+  const u32 color_vertex_count = static_cast<u32>(m_color_poke_vertices.size());
+  const u32 depth_vertex_count = static_cast<u32>(m_depth_poke_vertices.size());
+  m_color_poke_vertices.insert(m_color_poke_vertices.end(), m_depth_poke_vertices.begin(),
+                               m_depth_poke_vertices.end());
 
-void FramebufferManager::DrawPokeVertices(const EFBPokeVertex* vertices, u32 vertex_count,
-                                          const AbstractPipeline* pipeline)
-{
-  // Copy to vertex buffer.
   g_gfx->BeginUtilityDrawing();
   u32 base_vertex, base_index;
-  g_vertex_manager->UploadUtilityVertices(vertices, sizeof(EFBPokeVertex),
-                                          static_cast<u32>(vertex_count), nullptr, 0, &base_vertex,
-                                          &base_index);
+  g_vertex_manager->UploadUtilityVertices(m_color_poke_vertices.data(), sizeof(EFBPokeVertex),
+                                          color_vertex_count + depth_vertex_count, nullptr, 0,
+                                          &base_vertex, &base_index);
 
   // Now we can draw.
   g_gfx->SetViewportAndScissor(m_efb_framebuffer->GetRect());
-  g_gfx->SetPipeline(pipeline);
-  g_gfx->Draw(base_vertex, vertex_count);
+  if (color_vertex_count > 0)
+  {
+    g_gfx->SetPipeline(m_color_poke_pipeline.get());
+    g_gfx->Draw(base_vertex, color_vertex_count);
+  }
+  if (depth_vertex_count > 0)
+  {
+    g_gfx->SetPipeline(m_depth_poke_pipeline.get());
+    g_gfx->Draw(base_vertex + color_vertex_count, depth_vertex_count);
+  }
   g_gfx->EndUtilityDrawing();
+
+  m_color_poke_vertices.clear();
+  m_depth_poke_vertices.clear();
 }
 
 bool FramebufferManager::CompilePokePipelines()
@@ -1069,7 +1115,8 @@ bool FramebufferManager::CompilePokePipelines()
   AbstractPipelineConfig config = {};
   config.vertex_format = m_poke_vertex_format.get();
   config.vertex_shader = poke_vertex_shader.get();
-  config.geometry_shader = IsEFBStereo() ? g_shader_cache->GetColorGeometryShader() : nullptr;
+  config.geometry_shader =
+      IsEFBStereo() && !IsEFBMultiview() ? g_shader_cache->GetColorGeometryShader() : nullptr;
   config.pixel_shader = g_shader_cache->GetColorPixelShader();
   config.rasterization_state = RenderState::GetNoCullRasterizationState(
       g_ActiveConfig.backend_info.bSupportsLargePoints ? PrimitiveType::Points :
@@ -68,6 +68,8 @@ public:
   u32 GetEFBSamples() const { return m_efb_color_texture->GetSamples(); }
   bool IsEFBMultisampled() const { return m_efb_color_texture->IsMultisampled(); }
   bool IsEFBStereo() const { return m_efb_color_texture->GetLayers() > 1; }
+  // Whether the EFB layers are rendered as multiview views instead of by a geometry shader.
+  bool IsEFBMultiview() const { return m_efb_multiview; }
   FramebufferState GetEFBFramebufferState() const;
 
   // EFB coordinate conversion functions
@@ -75,6 +77,9 @@ public:
   MathUtil::Rectangle<int> ConvertEFBRectangle(const MathUtil::Rectangle<int>& rc) const;
 
   unsigned int GetEFBScale() const;
+  // The scale the user picked. Only differs from GetEFBScale() with temporal upscaling, which
+  // renders at a lower scale and reconstructs this one when presenting.
+  unsigned int GetTargetEFBScale() const { return m_target_efb_scale; }
 
   // Use this to upscale native EFB coordinates to IDEAL internal resolution
   int EFBToScaledX(int x) const;
@@ -123,6 +128,10 @@ public:
   void FlagPeekCacheAsOutOfDate();
   void EndOfFrame();
 
+  // Changes whenever the EFB contents may have changed: draws, clears, pokes, format changes and
+  // re-creation. Two EFB copies made with the same value saw the same EFB contents.
+  u64 GetEFBContentVersion() const { return m_efb_content_version; }
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -182,21 +191,24 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  // Asynchronously reads back the tiles which were recently peeked but aren't cached. Returns
+  // whether any readbacks were queued.
+  bool PopulatePredictedEFBCacheTiles(bool depth);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
 
-  void DrawPokeVertices(const EFBPokeVertex* vertices, u32 vertex_count,
-                        const AbstractPipeline* pipeline);
-
   std::tuple<u32, u32> CalculateTargetSize();
 
   void DoLoadState(PointerWrap& p);
   void DoSaveState(PointerWrap& p);
 
   float m_efb_scale = 1.0f;
+  unsigned int m_target_efb_scale = 1;
   PixelFormat m_prev_efb_format;
 
+  u64 m_efb_content_version = 0;
+
   std::unique_ptr<AbstractTexture> m_efb_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_convert_color_texture;
   std::unique_ptr<AbstractTexture> m_efb_depth_texture;
@@ -205,6 +217,7 @@ protected:
 
   std::unique_ptr<AbstractFramebuffer> m_efb_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_convert_framebuffer;
+  bool m_efb_multiview = false;
   std::unique_ptr<AbstractFramebuffer> m_efb_color_resolve_framebuffer;
   std::unique_ptr<AbstractFramebuffer> m_efb_depth_resolve_framebuffer;
   std::unique_ptr<AbstractPipeline> m_efb_color_resolve_pipeline;
@@ -188,6 +188,10 @@ std::string GenerateScreenQuadVertexShader()
       "  v_tex0 = float3(float((id << 1) & 2), float(id & 2), 0.0f);\n"
       "  opos = float4(v_tex0.xy * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);\n");
 
+  // Without a geometry shader, the EFB pipelines read the layer of the view being drawn.
+  if (g_ActiveConfig.UseMultiviewStereo())
+    code.Write("  v_tex0.z = float(gl_ViewIndex);\n");
+
   // NDC space is flipped in Vulkan. We also flip in GL so that (0,0) is in the lower-left.
   if (GetAPIType() == APIType::Vulkan || GetAPIType() == APIType::OpenGL)
     code.Write("  opos.y = -opos.y;\n");
@@ -647,6 +651,99 @@ std::string GenerateEFBRestorePixelShader()
   return code.GetBuffer();
 }
 
+std::string GenerateTemporalUpscalingPixelShader()
+{
+  // samp0 is the frame rendered at the reduced resolution, samp1 is the EFB depth that frame was
+  // copied with, and samp2 is the reconstructed previous frame. All positions are in pixels of
+  // the rendered frame with a top-left origin, without jitter.
+  ShaderCode code;
+  EmitUniformBufferDeclaration(code);
+  code.Write("{{\n"
+             "  float4 reprojection[4];\n"
+             "  float4 render_size;\n"
+             "  float4 viewport;\n"
+             "  float4 prev_viewport;\n"
+             "  float2 jitter;\n"
+             "  float2 depth_transform;\n"
+             "  float history_valid;\n"
+             "}};\n\n");
+  EmitSamplerDeclarations(code, 0, 3, false);
+  EmitPixelMainDeclaration(code, 1, 0);
+
+  const bool lower_left = g_ActiveConfig.backend_info.bUsesLowerLeftOrigin;
+  code.Write("{{\n"
+             "  float2 pos = v_tex0.xy * render_size.xy;\n");
+  if (lower_left)
+    code.Write("  pos.y = render_size.y - pos.y;\n");
+
+  // The rendered pixel closest to this one, and how far the point it sampled is from here.
+  code.Write("  int2 texel = int2(floor(pos + jitter));\n"
+             "  float2 offset = float2(texel) + 0.5 - jitter - pos;\n"
+             "  float weight = exp(-2.29 * dot(offset, offset));\n"
+             "  int2 max_texel = int2(render_size.xy) - 1;\n\n");
+
+  // Gather the neighborhood statistics, and the closest depth so that edges of foreground objects
+  // are reprojected with the object.
+  code.Write("  float3 current = float3(0.0, 0.0, 0.0);\n"
+             "  float3 m1 = float3(0.0, 0.0, 0.0);\n"
+             "  float3 m2 = float3(0.0, 0.0, 0.0);\n"
+             "  float depth = 1.0;\n"
+             "  for (int y = -1; y <= 1; y++)\n"
+             "  {{\n"
+             "    for (int x = -1; x <= 1; x++)\n"
+             "    {{\n"
+             "      int2 coords = clamp(texel + int2(x, y), int2(0, 0), max_texel);\n");
+  if (lower_left)
+    code.Write("      coords.y = max_texel.y - coords.y;\n");
+  code.Write("      float3 color = texelFetch(samp0, int3(coords, 0), 0).rgb;\n"
+             "      float sample_depth = texelFetch(samp1, int3(coords, 0), 0).r;\n");
+  if (!g_ActiveConfig.backend_info.bSupportsReversedDepthRange)
+    code.Write("      sample_depth = 1.0 - sample_depth;\n");
+  code.Write("      if (x == 0 && y == 0)\n"
+             "        current = color;\n"
+             "      m1 += color;\n"
+             "      m2 += color * color;\n"
+             "      depth = min(depth, sample_depth);\n"
+             "    }}\n"
+             "  }}\n"
+             "  m1 /= 9.0;\n"
+             "  float3 sigma = sqrt(max(m2 / 9.0 - m1 * m1, float3(0.0, 0.0, 0.0)));\n\n");
+
+  // Find where this pixel was in the previous frame.
+  code.Write("  float4 ndc = float4((pos - viewport.xy) / viewport.zw,\n"
+             "                     depth * depth_transform.x + depth_transform.y, 1.0);\n"
+             "  float4 prev_clip = float4(dot(reprojection[0], ndc), dot(reprojection[1], ndc),\n"
+             "                            dot(reprojection[2], ndc), dot(reprojection[3], ndc));\n"
+             "  float2 prev_pos = prev_viewport.xy + prev_viewport.zw * prev_clip.xy /\n"
+             "                    max(abs(prev_clip.w), 0.0001);\n"
+             "  bool use_history = history_valid != 0.0 && prev_clip.w > 0.0 &&\n"
+             "                     all(greaterThanEqual(prev_pos, float2(0.0, 0.0))) &&\n"
+             "                     all(lessThan(prev_pos, render_size.xy));\n\n");
+
+  code.Write("  float2 upsample_uv = (pos + jitter) * render_size.zw;\n"
+             "  float2 history_uv = prev_pos * render_size.zw;\n");
+  if (lower_left)
+  {
+    code.Write("  upsample_uv.y = 1.0 - upsample_uv.y;\n"
+               "  history_uv.y = 1.0 - history_uv.y;\n");
+  }
+
+  // Clamp the history to the current neighborhood, which rejects whatever moved in a way the
+  // camera doesn't explain, and blend in the closest sample.
+  code.Write("  if (use_history)\n"
+             "  {{\n"
+             "    float3 history = texture(samp2, float3(history_uv, 0.0)).rgb;\n"
+             "    history = clamp(history, m1 - sigma * 1.25, m1 + sigma * 1.25);\n"
+             "    ocol0 = float4(mix(history, current, mix(0.04, 0.2, weight)), 1.0);\n"
+             "  }}\n"
+             "  else\n"
+             "  {{\n"
+             "    ocol0 = float4(texture(samp0, float3(upsample_uv, 0.0)).rgb, 1.0);\n"
+             "  }}\n"
+             "}}\n");
+  return code.GetBuffer();
+}
+
 std::string GenerateImGuiVertexShader()
 {
   ShaderCode code;
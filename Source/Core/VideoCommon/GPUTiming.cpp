@@ -0,0 +1,93 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUTiming.h"
+
+#include <iomanip>
+
+#include "Common/FileUtil.h"
+
+#include "VideoCommon/VideoConfig.h"
+
+std::unique_ptr<GPUTimingBase> g_gpu_timing;
+
+GPUTimingBase::~GPUTimingBase() = default;
+
+void GPUTimingBase::SetPass(GPUPass pass)
+{
+  if (pass == m_pass)
+    return;
+
+  m_pass = pass;
+  if (!m_measuring)
+    return;
+
+  EndMeasurement();
+  BeginMeasurement(pass);
+}
+
+void GPUTimingBase::OnFramePresented()
+{
+  if (m_measuring)
+  {
+    EndMeasurement();
+
+    PassTimesNs times_ns{};
+    if (EndFrame(&times_ns))
+    {
+      for (std::size_t i = 0; i < times_ns.size(); ++i)
+        m_latest_times_ms[i] = times_ns[i] / 1000000.0;
+
+      if (g_ActiveConfig.bLogRenderTimeToFile)
+        LogTimesToFile();
+    }
+  }
+
+  const bool enabled = g_ActiveConfig.bShowGPUTimes;
+  if (m_measuring && !enabled)
+  {
+    Reset();
+    m_latest_times_ms = {};
+  }
+
+  m_measuring = enabled;
+  m_pass = GPUPass::MainScene;
+  if (m_measuring)
+    BeginMeasurement(m_pass);
+}
+
+void GPUTimingBase::LogTimesToFile()
+{
+  if (!m_log_file.is_open())
+  {
+    File::OpenFStream(m_log_file, File::GetUserPath(D_LOGS_IDX) + "gpu_pass_times.csv",
+                      std::ios_base::out);
+    for (u32 i = 0; i < static_cast<u32>(GPUPass::Count); ++i)
+      m_log_file << (i != 0 ? "," : "") << GetPassName(static_cast<GPUPass>(i));
+    m_log_file << '\n';
+  }
+
+  m_log_file << std::fixed << std::setprecision(4);
+  for (std::size_t i = 0; i < m_latest_times_ms.size(); ++i)
+    m_log_file << (i != 0 ? "," : "") << m_latest_times_ms[i];
+  m_log_file << '\n';
+}
+
+const char* GPUTimingBase::GetPassName(GPUPass pass)
+{
+  switch (pass)
+  {
+  case GPUPass::MainScene:
+    return "Scene";
+  case GPUPass::EFBCopy:
+    return "EFB Copy";
+  case GPUPass::XFBCopy:
+    return "XFB Copy";
+  case GPUPass::PostProcessing:
+    return "Post";
+  case GPUPass::TemporalUpscaling:
+    return "Upscale";
+  default:
+    return "Unknown";
+  }
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+
+// The kinds of host GPU work that a frame's GPU time is broken down into.
+enum class GPUPass : u32
+{
+  MainScene,
+  EFBCopy,
+  XFBCopy,
+  PostProcessing,
+  TemporalUpscaling,
+  Count,
+};
+
+// Measures how long the host GPU spends on each pass of a frame, so that the cost of a GPU-bound
+// frame can be attributed. VideoCommon marks which pass the commands being issued belong to, and
+// backends implement the actual timer queries. Results are read back without waiting for the GPU,
+// so they lag a few frames behind.
+//
+// All functions must be called from the video thread.
+class GPUTimingBase
+{
+public:
+  using PassTimes = std::array<double, static_cast<std::size_t>(GPUPass::Count)>;
+  using PassTimesNs = std::array<u64, static_cast<std::size_t>(GPUPass::Count)>;
+
+  virtual ~GPUTimingBase();
+
+  // Attributes the GPU commands issued from now on to the given pass.
+  void SetPass(GPUPass pass);
+  GPUPass GetPass() const { return m_pass; }
+
+  // Finishes the measurements of the frame that was just presented and starts the next frame's.
+  // Measuring is only done while the overlay is enabled.
+  void OnFramePresented();
+
+  // GPU time in milliseconds of the most recent frame whose results have arrived.
+  const PassTimes& GetLatestTimesMs() const { return m_latest_times_ms; }
+
+  static const char* GetPassName(GPUPass pass);
+
+protected:
+  // Starts a measurement attributed to the given pass, which lasts until EndMeasurement.
+  // Only one measurement is active at a time.
+  virtual void BeginMeasurement(GPUPass pass) = 0;
+  virtual void EndMeasurement() = 0;
+
+  // Ends the frame's measurements. Returns true and fills times if the results of an earlier frame
+  // have arrived.
+  virtual bool EndFrame(PassTimesNs* times) = 0;
+
+  // Drops all pending measurements.
+  virtual void Reset() = 0;
+
+private:
+  void LogTimesToFile();
+
+  GPUPass m_pass = GPUPass::MainScene;
+  bool m_measuring = false;
+  PassTimes m_latest_times_ms{};
+  std::ofstream m_log_file;
+};
+
+extern std::unique_ptr<GPUTimingBase> g_gpu_timing;
+
+// Attributes the GPU commands issued within its scope to the given pass.
+class GPUPassScope final
+{
+public:
+  explicit GPUPassScope(GPUPass pass)
+  {
+    if (!g_gpu_timing)
+      return;
+
+    m_previous_pass = g_gpu_timing->GetPass();
+    g_gpu_timing->SetPass(pass);
+  }
+
+  ~GPUPassScope()
+  {
+    if (g_gpu_timing)
+      g_gpu_timing->SetPass(m_previous_pass);
+  }
+
+  GPUPassScope(const GPUPassScope&) = delete;
+  GPUPassScope& operator=(const GPUPassScope&) = delete;
+
+private:
+  GPUPass m_previous_pass = GPUPass::MainScene;
+};
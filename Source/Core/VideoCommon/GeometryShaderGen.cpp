@@ -31,7 +31,8 @@ constexpr Common::EnumMap<u32, PrimitiveType::TriangleStrip> vertex_out_map{4u,
 
 bool geometry_shader_uid_data::IsPassthrough() const
 {
-  const bool stereo = g_ActiveConfig.stereo_mode != StereoMode::Off;
+  const bool stereo =
+      g_ActiveConfig.stereo_mode != StereoMode::Off && !g_ActiveConfig.UseMultiviewStereo();
   const bool wireframe = g_ActiveConfig.bWireFrame;
   return primitive_type >= static_cast<u32>(PrimitiveType::Triangles) && !stereo && !wireframe;
 }
@@ -63,7 +64,8 @@ ShaderCode GenerateGeometryShaderCode(APIType api_type, const ShaderHostConfig&
   const bool wireframe = host_config.wireframe;
   const bool msaa = host_config.msaa;
   const bool ssaa = host_config.ssaa;
-  const bool stereo = host_config.stereo;
+  // With multiview, the vertex shader already offset the eyes, and the views aren't layers.
+  const bool stereo = host_config.stereo && !host_config.backend_multiview;
   const auto primitive_type = static_cast<PrimitiveType>(uid_data->primitive_type);
   const u32 vertex_in = vertex_in_map[primitive_type];
   u32 vertex_out = vertex_out_map[primitive_type];
@@ -2,9 +2,35 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
+
+#include <algorithm>
+
+#include <xxhash.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/ConfigManager.h"
 #include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/GXPipelineTypes.h"
 #include "VideoCommon/VideoConfig.h"
 
+namespace
+{
+constexpr u32 PS_UID_CACHE_FILE_MAGIC = 0x49554350;  // PCUI
+constexpr size_t PS_UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+constexpr const char* PS_UID_CACHE_FILE_EXTENSION = ".customuidcache";
+
+// Shaders that were needed in an earlier session are queued behind the ones a draw is waiting for
+constexpr u32 COMPILE_PRIORITY_ONDEMAND = 0;
+constexpr u32 COMPILE_PRIORITY_PRECOMPILE = 1;
+
+struct SerializedCustomPixelShaderUid
+{
+  u64 contents_hash;
+  pixel_shader_uid_data ps_uid_data;
+};
+}  // namespace
+
 CustomShaderCache::CustomShaderCache()
 {
   m_api_type = g_ActiveConfig.backend_info.api_type;
@@ -18,6 +44,9 @@ CustomShaderCache::CustomShaderCache()
 
   m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
                                                   "RetrieveAsyncShaders");
+
+  if (g_ActiveConfig.bShaderCache && m_api_type != APIType::Nothing)
+    LoadPixelShaderUIDCache();
 }
 
 CustomShaderCache::~CustomShaderCache()
@@ -52,6 +81,105 @@ void CustomShaderCache::Reload()
   m_uber_ps_cache = {};
   m_pipeline_cache = {};
   m_uber_pipeline_cache = {};
+  m_precompiled_contents.clear();
+}
+
+u64 CustomShaderCache::GetContentsHash(const CustomShaderInstance& custom_shaders)
+{
+  u64 hash = 0;
+  for (const CustomPixelShader& shader : custom_shaders.pixel_contents.shaders)
+  {
+    hash = XXH3_64bits_withSeed(shader.custom_shader.data(), shader.custom_shader.size(), hash);
+    hash = XXH3_64bits_withSeed(shader.material_uniform_block.data(),
+                                shader.material_uniform_block.size(), hash);
+  }
+  return hash;
+}
+
+void CustomShaderCache::LoadPixelShaderUIDCache()
+{
+  const std::string filename = File::GetUserPath(D_CACHE_IDX) +
+                               SConfig::GetInstance().GetGameID() + PS_UID_CACHE_FILE_EXTENSION;
+  if (m_ps_uid_cache_file.Open(filename, "rb+"))
+  {
+    // Pixel shader UIDs change whenever the pipeline UIDs do, so share their version.
+    u32 existing_magic;
+    u32 existing_version;
+    bool uid_file_valid =
+        m_ps_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
+        m_ps_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
+        existing_magic == PS_UID_CACHE_FILE_MAGIC &&
+        existing_version == VideoCommon::GX_PIPELINE_UID_VERSION;
+
+    const u64 file_size = m_ps_uid_cache_file.GetSize();
+    const size_t uid_count =
+        uid_file_valid ? static_cast<size_t>(file_size - PS_UID_CACHE_HEADER_SIZE) /
+                             sizeof(SerializedCustomPixelShaderUid) :
+                         0;
+    uid_file_valid &= file_size == uid_count * sizeof(SerializedCustomPixelShaderUid) +
+                                       PS_UID_CACHE_HEADER_SIZE;
+
+    std::vector<SerializedCustomPixelShaderUid> serialized_uids(uid_count);
+    if (uid_file_valid)
+      uid_file_valid = m_ps_uid_cache_file.ReadArray(serialized_uids.data(), uid_count);
+
+    if (uid_file_valid)
+    {
+      for (const SerializedCustomPixelShaderUid& serialized_uid : serialized_uids)
+      {
+        PixelShaderUid uid;
+        *uid.GetUidData() = serialized_uid.ps_uid_data;
+        m_contents_to_ps_uids[serialized_uid.contents_hash].push_back(uid);
+      }
+    }
+    else
+    {
+      m_ps_uid_cache_file.Close();
+    }
+  }
+
+  if (!m_ps_uid_cache_file.IsOpen() && m_ps_uid_cache_file.Open(filename, "wb"))
+  {
+    m_ps_uid_cache_file.WriteBytes(&PS_UID_CACHE_FILE_MAGIC, sizeof(PS_UID_CACHE_FILE_MAGIC));
+    m_ps_uid_cache_file.WriteBytes(&VideoCommon::GX_PIPELINE_UID_VERSION,
+                                   sizeof(VideoCommon::GX_PIPELINE_UID_VERSION));
+  }
+
+  INFO_LOG_FMT(VIDEO, "Read custom pixel shader UIDs for {} custom shaders from {}",
+               m_contents_to_ps_uids.size(), filename);
+}
+
+void CustomShaderCache::AppendPixelShaderUID(u64 contents_hash, const PixelShaderUid& uid)
+{
+  std::vector<PixelShaderUid>& uids = m_contents_to_ps_uids[contents_hash];
+  if (std::find(uids.begin(), uids.end(), uid) != uids.end())
+    return;
+  uids.push_back(uid);
+
+  if (!m_ps_uid_cache_file.IsOpen())
+    return;
+
+  SerializedCustomPixelShaderUid serialized_uid{};
+  serialized_uid.contents_hash = contents_hash;
+  serialized_uid.ps_uid_data = *uid.GetUidData();
+  m_ps_uid_cache_file.WriteArray(&serialized_uid, 1);
+}
+
+void CustomShaderCache::PrecompileRecordedPixelShaders(const CustomShaderInstance& custom_shaders)
+{
+  const u64 contents_hash = GetContentsHash(custom_shaders);
+  if (!m_precompiled_contents.insert(contents_hash).second)
+    return;
+
+  const auto it = m_contents_to_ps_uids.find(contents_hash);
+  if (it == m_contents_to_ps_uids.end())
+    return;
+
+  for (const PixelShaderUid& uid : it->second)
+  {
+    if (!m_ps_cache.GetHolder(uid, custom_shaders))
+      QueuePixelShaderCompile(uid, custom_shaders, COMPILE_PRIORITY_PRECOMPILE);
+  }
 }
 
 std::optional<const AbstractPipeline*>
@@ -124,7 +252,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXPipelineUid& ui
       else
       {
         m_stages_ready &= false;
-        m_shader_cache->QueuePixelShaderCompile(ps_uid, m_custom_shaders);
+        m_shader_cache->QueuePixelShaderCompile(ps_uid, m_custom_shaders,
+                                                COMPILE_PRIORITY_ONDEMAND);
       }
     }
 
@@ -148,7 +277,8 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXPipelineUid& ui
         // Re-queue for next frame.
         auto wi = m_shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             m_shader_cache, m_uid, m_custom_shaders, m_iterator, m_config);
-        m_shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), 0);
+        m_shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi),
+                                                               COMPILE_PRIORITY_ONDEMAND);
       }
     }
 
@@ -165,7 +295,10 @@ void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXPipelineUid& ui
   auto list_iter = m_pipeline_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
       this, uid, custom_shaders, list_iter, pipeline_config);
-  m_async_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_shader_compiler->QueueWorkItem(std::move(work_item), COMPILE_PRIORITY_ONDEMAND);
+
+  // Done after queueing the work item, so the pixel shader this draw needs goes first.
+  PrecompileRecordedPixelShaders(custom_shaders);
 }
 
 void CustomShaderCache::AsyncCreatePipeline(const VideoCommon::GXUberPipelineUid& uid,
@@ -266,8 +399,8 @@ void CustomShaderCache::NotifyPipelineFinished(UberPipelineIterator iterator,
 }
 
 void CustomShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
-
-                                                const CustomShaderInstance& custom_shaders)
+                                                const CustomShaderInstance& custom_shaders,
+                                                u32 priority)
 {
   class PixelShaderWorkItem final : public VideoCommon::AsyncShaderCompiler::WorkItem
   {
@@ -297,10 +430,13 @@ void CustomShaderCache::QueuePixelShaderCompile(const PixelShaderUid& uid,
     PixelShaderIterator m_iter;
   };
 
+  if (priority == COMPILE_PRIORITY_ONDEMAND && g_ActiveConfig.bShaderCache)
+    AppendPixelShaderUID(GetContentsHash(custom_shaders), uid);
+
   auto list_iter = m_ps_cache.InsertElement(uid, custom_shaders);
   auto work_item = m_async_shader_compiler->CreateWorkItem<PixelShaderWorkItem>(
       this, uid, custom_shaders, list_iter);
-  m_async_shader_compiler->QueueWorkItem(std::move(work_item), 0);
+  m_async_shader_compiler->QueueWorkItem(std::move(work_item), priority);
 }
 
 void CustomShaderCache::QueuePixelShaderCompile(const UberShader::PixelShaderUid& uid,
@@ -10,7 +10,12 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractShader.h"
 #include "VideoCommon/AsyncShaderCompiler.h"
@@ -136,9 +141,22 @@ private:
                                  std::unique_ptr<AbstractShader> shader);
 
   void QueuePixelShaderCompile(const PixelShaderUid& uid,
-                               const CustomShaderInstance& custom_shaders);
+                               const CustomShaderInstance& custom_shaders, u32 priority);
   void QueuePixelShaderCompile(const UberShader::PixelShaderUid& uid,
                                const CustomShaderInstance& custom_shaders);
 
+  // The pixel shaders that were used with a set of custom shaders in earlier sessions are kept
+  // in a UID cache, keyed by a hash of the custom shader code. When a draw first uses a set of
+  // custom shaders, all of the pixel shaders it needed before are queued in the background,
+  // instead of each one being compiled only once a draw needs it.
+  static u64 GetContentsHash(const CustomShaderInstance& custom_shaders);
+  void LoadPixelShaderUIDCache();
+  void AppendPixelShaderUID(u64 contents_hash, const PixelShaderUid& uid);
+  void PrecompileRecordedPixelShaders(const CustomShaderInstance& custom_shaders);
+
+  File::IOFile m_ps_uid_cache_file;
+  std::unordered_map<u64, std::vector<PixelShaderUid>> m_contents_to_ps_uids;
+  std::unordered_set<u64> m_precompiled_contents;
+
   Common::EventHook m_frame_end_handler;
 };
@@ -7,6 +7,8 @@
 #include <string_view>
 #include <variant>
 
+#include <xxhash.h>
+
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Common/VariantUtil.h"
@@ -114,13 +116,21 @@ GraphicsModManager::GetProjectionActions(ProjectionType projection_type) const
   return m_default;
 }
 
+u64 GraphicsModManager::GetTextureId(std::string_view texture_name)
+{
+  if (texture_name.empty())
+    return 0;
+  return XXH3_64bits(texture_name.data(), texture_name.size());
+}
+
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
-                                                const std::string& texture_name) const
+GraphicsModManager::FindTextureActions(const TextureIdToActions& map, u64 texture_id)
 {
-  const auto lookup = fmt::format("{}_{}", texture_name, static_cast<int>(projection_type));
-  if (const auto it = m_projection_texture_target_to_actions.find(lookup);
-      it != m_projection_texture_target_to_actions.end())
+  // Most games have no mods for a given category, skip the lookup entirely then
+  if (map.empty())
+    return m_default;
+
+  if (const auto it = map.find(texture_id); it != map.end())
   {
     return it->second;
   }
@@ -129,39 +139,34 @@ GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetDrawStartedActions(const std::string& texture_name) const
+GraphicsModManager::GetProjectionTextureActions(ProjectionType projection_type,
+                                                u64 texture_id) const
 {
-  if (const auto it = m_draw_started_target_to_actions.find(texture_name);
-      it != m_draw_started_target_to_actions.end())
+  if (const auto it = m_projection_texture_target_to_actions.find(projection_type);
+      it != m_projection_texture_target_to_actions.end())
   {
-    return it->second;
+    return FindTextureActions(it->second, texture_id);
   }
 
   return m_default;
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureLoadActions(const std::string& texture_name) const
+GraphicsModManager::GetDrawStartedActions(u64 texture_id) const
 {
-  if (const auto it = m_load_texture_target_to_actions.find(texture_name);
-      it != m_load_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
-
-  return m_default;
+  return FindTextureActions(m_draw_started_target_to_actions, texture_id);
 }
 
 const std::vector<GraphicsModAction*>&
-GraphicsModManager::GetTextureCreateActions(const std::string& texture_name) const
+GraphicsModManager::GetTextureLoadActions(u64 texture_id) const
 {
-  if (const auto it = m_create_texture_target_to_actions.find(texture_name);
-      it != m_create_texture_target_to_actions.end())
-  {
-    return it->second;
-  }
+  return FindTextureActions(m_load_texture_target_to_actions, texture_id);
+}
 
-  return m_default;
+const std::vector<GraphicsModAction*>&
+GraphicsModManager::GetTextureCreateActions(u64 texture_id) const
+{
+  return FindTextureActions(m_create_texture_target_to_actions, texture_id);
 }
 
 const std::vector<GraphicsModAction*>& GraphicsModManager::GetEFBActions(const FBInfo& efb) const
@@ -257,20 +262,26 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
 
       const auto internal_group = fmt::format("{}.{}", mod.m_title, feature.m_group);
 
+      const auto add_texture_target = [&](TextureIdToActions& target_to_actions,
+                                          const std::string& texture_info_string) {
+        target_to_actions[GetTextureId(texture_info_string)].push_back(m_actions.back().get());
+        m_has_texture_actions = true;
+      };
+
       const auto add_target = [&](const GraphicsTargetConfig& target) {
         std::visit(
             overloaded{
                 [&](const DrawStartedTextureTarget& the_target) {
-                  m_draw_started_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  add_texture_target(m_draw_started_target_to_actions,
+                                     the_target.m_texture_info_string);
                 },
                 [&](const LoadTextureTarget& the_target) {
-                  m_load_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  add_texture_target(m_load_texture_target_to_actions,
+                                     the_target.m_texture_info_string);
                 },
                 [&](const CreateTextureTarget& the_target) {
-                  m_create_texture_target_to_actions[the_target.m_texture_info_string].push_back(
-                      m_actions.back().get());
+                  add_texture_target(m_create_texture_target_to_actions,
+                                     the_target.m_texture_info_string);
                 },
                 [&](const EFBTarget& the_target) {
                   FBInfo info;
@@ -289,10 +300,9 @@ void GraphicsModManager::Load(const GraphicsModGroupConfig& config)
                 [&](const ProjectionTarget& the_target) {
                   if (the_target.m_texture_info_string)
                   {
-                    const auto lookup = fmt::format("{}_{}", *the_target.m_texture_info_string,
-                                                    static_cast<int>(the_target.m_projection_type));
-                    m_projection_texture_target_to_actions[lookup].push_back(
-                        m_actions.back().get());
+                    add_texture_target(
+                        m_projection_texture_target_to_actions[the_target.m_projection_type],
+                        *the_target.m_texture_info_string);
                   }
                   else
                   {
@@ -367,4 +377,5 @@ void GraphicsModManager::Reset()
   m_create_texture_target_to_actions.clear();
   m_efb_target_to_actions.clear();
   m_xfb_target_to_actions.clear();
+  m_has_texture_actions = false;
 }
@@ -6,10 +6,12 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "Common/CommonTypes.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModAction.h"
 #include "VideoCommon/TextureInfo.h"
@@ -22,16 +24,20 @@ class GraphicsModManager
 public:
   bool Initialize();
 
+  // Texture targets are looked up by a hash of the texture name, so that the name only has to be
+  // formatted and hashed once per texture cache entry instead of on every draw.
+  // An empty name has the id 0, which never has any actions.
+  static u64 GetTextureId(std::string_view texture_name);
+
   const std::vector<GraphicsModAction*>& GetProjectionActions(ProjectionType projection_type) const;
-  const std::vector<GraphicsModAction*>&
-  GetProjectionTextureActions(ProjectionType projection_type,
-                              const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetDrawStartedActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureLoadActions(const std::string& texture_name) const;
-  const std::vector<GraphicsModAction*>&
-  GetTextureCreateActions(const std::string& texture_name) const;
+  const std::vector<GraphicsModAction*>& GetProjectionTextureActions(ProjectionType projection_type,
+                                                                     u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetDrawStartedActions(u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetTextureLoadActions(u64 texture_id) const;
+  const std::vector<GraphicsModAction*>& GetTextureCreateActions(u64 texture_id) const;
+
+  // Lets callers skip gathering texture ids when no mod targets textures at all
+  bool HasTextureActions() const { return m_has_texture_actions; }
   const std::vector<GraphicsModAction*>& GetEFBActions(const FBInfo& efb) const;
   const std::vector<GraphicsModAction*>& GetXFBActions(const FBInfo& xfb) const;
 
@@ -43,16 +49,20 @@ private:
 
   class DecoratedAction;
 
+  using TextureIdToActions = std::unordered_map<u64, std::vector<GraphicsModAction*>>;
+
+  static const std::vector<GraphicsModAction*>& FindTextureActions(const TextureIdToActions& map,
+                                                                   u64 texture_id);
+
   static inline const std::vector<GraphicsModAction*> m_default = {};
   std::list<std::unique_ptr<GraphicsModAction>> m_actions;
   std::unordered_map<ProjectionType, std::vector<GraphicsModAction*>>
       m_projection_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_projection_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_draw_started_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>> m_load_texture_target_to_actions;
-  std::unordered_map<std::string, std::vector<GraphicsModAction*>>
-      m_create_texture_target_to_actions;
+  std::unordered_map<ProjectionType, TextureIdToActions> m_projection_texture_target_to_actions;
+  TextureIdToActions m_draw_started_target_to_actions;
+  TextureIdToActions m_load_texture_target_to_actions;
+  TextureIdToActions m_create_texture_target_to_actions;
+  bool m_has_texture_actions = false;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_efb_target_to_actions;
   std::unordered_map<FBInfo, std::vector<GraphicsModAction*>, FBInfoHasher> m_xfb_target_to_actions;
 
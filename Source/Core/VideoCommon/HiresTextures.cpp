@@ -10,6 +10,7 @@
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <xxhash.h>
@@ -27,6 +28,7 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackAssetLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -36,6 +38,36 @@ static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_te
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
+// Textures that are loaded from a texture pack instead of s_file_library
+static std::unordered_map<std::string, std::shared_ptr<VideoCommon::CustomAssetLibrary>>
+    s_hires_texture_id_to_pack;
+
+// The order in which a game first used its custom textures. The trace from the previous session
+// is used to start loading the textures that are likely to be needed next, before the texture
+// cache asks for them.
+struct UsageTrace
+{
+  std::string game_id;
+  std::vector<std::string> previous;
+  std::unordered_map<std::string, std::size_t> previous_positions;
+  std::vector<std::string> current;
+  std::unordered_set<std::string> used;
+};
+static UsageTrace s_usage_trace;
+
+struct PrefetchedTexture
+{
+  std::shared_ptr<HiresTexture> texture;
+  std::size_t trace_position;
+};
+static std::unordered_map<std::string, PrefetchedTexture> s_prefetched_textures;
+
+// How many of the following textures in the trace are prefetched when a texture is first used
+constexpr std::size_t PREFETCH_WINDOW = 16;
+// Prefetched textures this far from the current trace position belong to another scene, so
+// there is no reason to keep them loaded
+constexpr std::size_t PREFETCH_RELEASE_DISTANCE = PREFETCH_WINDOW * 4;
+constexpr std::size_t MAX_USAGE_TRACE_SIZE = 65536;
 
 namespace
 {
@@ -75,6 +107,150 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+std::shared_ptr<VideoCommon::CustomAssetLibrary> GetLibrary(const std::string& texture_id)
+{
+  if (auto iter = s_hires_texture_id_to_pack.find(texture_id);
+      iter != s_hires_texture_id_to_pack.end())
+  {
+    return iter->second;
+  }
+  return s_file_library;
+}
+
+bool IsPredictionEnabled()
+{
+  // With every texture cached up front there is nothing left to predict
+  return g_ActiveConfig.bPredictHiresTextures && !g_ActiveConfig.bCacheHiresTextures;
+}
+
+std::string GetUsageTracePath(const std::string& game_id)
+{
+  return File::GetUserPath(D_CACHE_IDX) + game_id + "-custom-textures.txt";
+}
+
+void SaveUsageTrace()
+{
+  if (s_usage_trace.game_id.empty() || s_usage_trace.current.empty())
+    return;
+
+  // Textures that weren't reached this session keep their place after the ones that were, so a
+  // short session doesn't throw away the rest of the trace
+  std::string contents;
+  std::size_t count = 0;
+  const auto append = [&](const std::string& texture_id) {
+    if (count++ >= MAX_USAGE_TRACE_SIZE)
+      return;
+    contents.append(texture_id);
+    contents.push_back('\n');
+  };
+  for (const std::string& texture_id : s_usage_trace.current)
+    append(texture_id);
+  for (const std::string& texture_id : s_usage_trace.previous)
+  {
+    if (!s_usage_trace.used.contains(texture_id))
+      append(texture_id);
+  }
+
+  const std::string path = GetUsageTracePath(s_usage_trace.game_id);
+  if (!File::WriteStringToFile(path, contents))
+    WARN_LOG_FMT(VIDEO, "Failed to write custom texture usage trace to '{}'", path);
+}
+
+void ResetUsageTrace(const std::string& game_id)
+{
+  SaveUsageTrace();
+  s_usage_trace = {};
+  s_prefetched_textures.clear();
+
+  if (game_id.empty() || !IsPredictionEnabled())
+    return;
+
+  s_usage_trace.game_id = game_id;
+  std::string contents;
+  if (!File::ReadFileToString(GetUsageTracePath(game_id), contents))
+    return;
+
+  for (std::string& texture_id : SplitString(contents, '\n'))
+  {
+    if (texture_id.empty() || s_usage_trace.previous.size() >= MAX_USAGE_TRACE_SIZE)
+      continue;
+    if (s_usage_trace.previous_positions.try_emplace(texture_id, s_usage_trace.previous.size())
+            .second)
+    {
+      s_usage_trace.previous.push_back(std::move(texture_id));
+    }
+  }
+}
+
+void PrefetchAfter(std::size_t trace_position)
+{
+  std::erase_if(s_prefetched_textures, [trace_position](const auto& entry) {
+    const std::size_t position = entry.second.trace_position;
+    const std::size_t distance =
+        position > trace_position ? position - trace_position : trace_position - position;
+    return distance > PREFETCH_RELEASE_DISTANCE;
+  });
+
+  auto& loader = Core::System::GetInstance().GetCustomAssetLoader();
+  const std::size_t end =
+      std::min(s_usage_trace.previous.size(), trace_position + PREFETCH_WINDOW + 1);
+  for (std::size_t i = trace_position + 1; i < end; i++)
+  {
+    const std::string& texture_id = s_usage_trace.previous[i];
+    if (s_usage_trace.used.contains(texture_id) || s_prefetched_textures.contains(texture_id))
+      continue;
+
+    // The texture may have been removed from the pack since the trace was recorded
+    const auto iter = s_hires_texture_id_to_arbmipmap.find(texture_id);
+    if (iter == s_hires_texture_id_to_arbmipmap.end())
+      continue;
+
+    auto hires_texture = std::make_shared<HiresTexture>(
+        iter->second, loader.PrefetchGameTexture(texture_id, GetLibrary(texture_id)));
+    s_prefetched_textures.try_emplace(texture_id, PrefetchedTexture{std::move(hires_texture), i});
+  }
+}
+
+void RecordUsage(const std::string& texture_id)
+{
+  if (s_usage_trace.game_id.empty() || !s_usage_trace.used.insert(texture_id).second)
+    return;
+
+  if (s_usage_trace.current.size() < MAX_USAGE_TRACE_SIZE)
+    s_usage_trace.current.push_back(texture_id);
+
+  if (auto iter = s_usage_trace.previous_positions.find(texture_id);
+      iter != s_usage_trace.previous_positions.end())
+  {
+    PrefetchAfter(iter->second);
+  }
+}
+
+// Loose files take precedence over textures in a pack, so a single texture can be replaced
+// without rebuilding the pack.
+void AddTexturePack(const std::string& path)
+{
+  auto pack = std::make_shared<VideoCommon::TexturePackAssetLibrary>();
+  if (!pack->Open(path))
+    return;
+
+  auto& system = Core::System::GetInstance();
+  for (const auto& [name, has_arbitrary_mipmaps] : pack->GetTextures())
+  {
+    std::string texture_id(name);
+    if (!s_hires_texture_id_to_arbmipmap.try_emplace(texture_id, has_arbitrary_mipmaps).second)
+      continue;
+
+    if (g_ActiveConfig.bCacheHiresTextures)
+    {
+      auto hires_texture = std::make_shared<HiresTexture>(
+          has_arbitrary_mipmaps, system.GetCustomAssetLoader().LoadGameTexture(texture_id, pack));
+      s_hires_texture_cache.try_emplace(texture_id, std::move(hires_texture));
+    }
+    s_hires_texture_id_to_pack.try_emplace(std::move(texture_id), pack);
+  }
+}
 }  // namespace
 
 void HiresTexture::Init()
@@ -96,9 +272,10 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+  ResetUsageTrace(game_id);
   const std::set<std::string> texture_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
-  const std::vector<std::string> extensions{".png", ".dds"};
+  const std::vector<std::string> extensions{".png", ".dds", ".dtp"};
 
   auto& system = Core::System::GetInstance();
 
@@ -108,10 +285,19 @@ void HiresTexture::Update()
         Common::DoFileSearch({texture_directory}, extensions, /*recursive*/ true);
 
     bool failed_insert = false;
+    std::vector<std::string> texture_packs;
     for (auto& path : texture_paths)
     {
       std::string filename;
-      SplitPath(path, nullptr, &filename, nullptr);
+      std::string extension;
+      SplitPath(path, nullptr, &filename, &extension);
+
+      Common::ToLower(&extension);
+      if (extension == ".dtp")
+      {
+        texture_packs.push_back(path);
+        continue;
+      }
 
       if (filename.substr(0, s_format_prefix.length()) == s_format_prefix)
       {
@@ -149,6 +335,9 @@ void HiresTexture::Update()
       ERROR_LOG_FMT(VIDEO, "One or more textures at path '{}' were already inserted",
                     texture_directory);
     }
+
+    for (const std::string& texture_pack : texture_packs)
+      AddTexturePack(texture_pack);
   }
 
   if (g_ActiveConfig.bCacheHiresTextures)
@@ -165,8 +354,10 @@ void HiresTexture::Update()
 
 void HiresTexture::Clear()
 {
+  ResetUsageTrace("");
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
+  s_hires_texture_id_to_pack.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
@@ -182,14 +373,26 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   }
   else
   {
-    auto& system = Core::System::GetInstance();
-    auto hires_texture = std::make_shared<HiresTexture>(
-        has_arb_mipmaps,
-        system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
+    std::shared_ptr<HiresTexture> hires_texture;
+    if (auto prefetched = s_prefetched_textures.find(base_filename);
+        prefetched != s_prefetched_textures.end())
+    {
+      // The texture cache keeps the asset alive from now on
+      hires_texture = std::move(prefetched->second.texture);
+      s_prefetched_textures.erase(prefetched);
+    }
+    else
+    {
+      auto& system = Core::System::GetInstance();
+      hires_texture = std::make_shared<HiresTexture>(
+          has_arb_mipmaps,
+          system.GetCustomAssetLoader().LoadGameTexture(base_filename, GetLibrary(base_filename)));
+    }
     if (g_ActiveConfig.bCacheHiresTextures)
     {
       s_hires_texture_cache.try_emplace(base_filename, hires_texture);
     }
+    RecordUsage(base_filename);
     return hires_texture;
   }
 }
@@ -3,10 +3,17 @@
 
 #include "VideoCommon/IndexGenerator.h"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -16,6 +23,76 @@ namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// Number of vertices covered by each precomputed index pattern. Divisible by both 3 and 4.
+constexpr u32 s_pattern_vertices = 768;
+
+// Repeats the indices of a single primitive, relative to its first vertex, for as many primitives
+// as fit into s_pattern_vertices.
+template <u32 vertices_per_primitive, size_t indices_per_primitive>
+constexpr auto MakeIndexPattern(const std::array<u16, indices_per_primitive>& primitive)
+{
+  constexpr u32 num_primitives = s_pattern_vertices / vertices_per_primitive;
+  std::array<u16, num_primitives * indices_per_primitive> pattern{};
+  for (u32 i = 0; i < num_primitives; ++i)
+  {
+    for (size_t j = 0; j < indices_per_primitive; ++j)
+    {
+      const u16 index = primitive[j];
+      pattern[i * indices_per_primitive + j] =
+          index == s_primitive_restart ? s_primitive_restart :
+                                         static_cast<u16>(i * vertices_per_primitive + index);
+    }
+  }
+  return pattern;
+}
+
+constexpr auto s_list_pattern = MakeIndexPattern<3>(std::array<u16, 3>{0, 1, 2});
+constexpr auto s_list_pattern_pr =
+    MakeIndexPattern<3>(std::array<u16, 4>{0, 1, 2, s_primitive_restart});
+constexpr auto s_strip_pattern_pr = MakeIndexPattern<1>(std::array<u16, 1>{0});
+constexpr auto s_quad_pattern = MakeIndexPattern<4>(std::array<u16, 6>{0, 1, 2, 0, 2, 3});
+constexpr auto s_quad_pattern_pr =
+    MakeIndexPattern<4>(std::array<u16, 5>{1, 2, 0, 3, s_primitive_restart});
+
+// Writes pattern[0..count) + index. The addition saturates, so primitive restart markers in the
+// pattern stay as they are. Real indices never reach UINT16_MAX, see GetRemainingIndices.
+u16* AddOffsetIndices(u16* index_ptr, const u16* pattern, u32 count, u32 index)
+{
+  u32 i = 0;
+#if defined(_M_X86_64)
+  const __m128i offset = _mm_set1_epi16(static_cast<s16>(index));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr + i), _mm_adds_epu16(indices, offset));
+  }
+#elif defined(_M_ARM_64)
+  const uint16x8_t offset = vdupq_n_u16(static_cast<u16>(index));
+  for (; i + 8 <= count; i += 8)
+    vst1q_u16(index_ptr + i, vqaddq_u16(vld1q_u16(pattern + i), offset));
+#endif
+  for (; i < count; ++i)
+    index_ptr[i] = static_cast<u16>(std::min<u32>(pattern[i] + index, s_primitive_restart));
+  return index_ptr + count;
+}
+
+// Emits num_primitives primitives using a pattern made by MakeIndexPattern, reusing the pattern
+// as many times as needed.
+template <u32 vertices_per_primitive, u32 indices_per_primitive, size_t pattern_size>
+u16* AddPattern(u16* index_ptr, const std::array<u16, pattern_size>& pattern, u32 num_primitives,
+                u32 index)
+{
+  constexpr u32 pattern_primitives = pattern_size / indices_per_primitive;
+  while (num_primitives > 0)
+  {
+    const u32 count = std::min(num_primitives, pattern_primitives);
+    index_ptr = AddOffsetIndices(index_ptr, pattern.data(), count * indices_per_primitive, index);
+    index += count * vertices_per_primitive;
+    num_primitives -= count;
+  }
+  return index_ptr;
+}
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,11 +107,10 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
-  {
-    index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
-  }
-  return index_ptr;
+  if constexpr (pr)
+    return AddPattern<3, 4>(index_ptr, s_list_pattern_pr, num_verts / 3, index);
+  else
+    return AddPattern<3, 3>(index_ptr, s_list_pattern, num_verts / 3, index);
 }
 
 template <bool pr>
@@ -42,10 +118,7 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
-    {
-      *index_ptr++ = index + i;
-    }
+    index_ptr = AddPattern<1, 1>(index_ptr, s_strip_pattern_pr, num_verts, index);
     *index_ptr++ = s_primitive_restart;
   }
   else
@@ -134,26 +207,13 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
-  for (; i < num_verts; i += 4)
-  {
-    if constexpr (pr)
-    {
-      *index_ptr++ = index + i - 2;
-      *index_ptr++ = index + i - 1;
-      *index_ptr++ = index + i - 3;
-      *index_ptr++ = index + i - 0;
-      *index_ptr++ = s_primitive_restart;
-    }
-    else
-    {
-      index_ptr = WriteTriangle<pr>(index_ptr, index + i - 3, index + i - 2, index + i - 1);
-      index_ptr = WriteTriangle<pr>(index_ptr, index + i - 3, index + i - 1, index + i - 0);
-    }
-  }
+  if constexpr (pr)
+    index_ptr = AddPattern<4, 5>(index_ptr, s_quad_pattern_pr, num_verts / 4, index);
+  else
+    index_ptr = AddPattern<4, 6>(index_ptr, s_quad_pattern, num_verts / 4, index);
 
   // three vertices remaining, so render a triangle
-  if (i == num_verts)
+  if (num_verts % 4 == 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + num_verts - 3, index + num_verts - 2,
                                   index + num_verts - 1);
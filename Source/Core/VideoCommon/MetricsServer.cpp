@@ -0,0 +1,230 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/MetricsServer.h"
+
+#include <array>
+#include <chrono>
+#include <iterator>
+#include <string_view>
+
+#include <SFML/Network.hpp>
+#include <fmt/format.h>
+
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/SoundStream.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Core/System.h"
+#include "VideoCommon/PerformanceMetrics.h"
+#include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/Statistics.h"
+
+VideoCommon::MetricsServer g_metrics_server;
+
+namespace VideoCommon
+{
+namespace
+{
+static_assert(static_cast<size_t>(AsyncShaderCompiler::WorkClass::Count) == 2);
+
+// A scraper that connects but never sends a full request is dropped after this long.
+constexpr auto REQUEST_TIMEOUT = std::chrono::seconds(1);
+
+void AppendMetric(std::string* out, std::string_view name, std::string_view type,
+                  std::string_view help, double value)
+{
+  fmt::format_to(std::back_inserter(*out), "# HELP {0} {1}\n# TYPE {0} {2}\n{0} {3}\n", name, help,
+                 type, value);
+}
+
+// Appends one sample per AsyncShaderCompiler::WorkClass, multiplied by scale.
+void AppendLabeledMetrics(std::string* out, std::string_view name, std::string_view type,
+                          std::string_view help, const std::array<std::atomic<u64>, 2>& values,
+                          double scale)
+{
+  static constexpr std::array<std::string_view, 2> class_names = {"on_demand", "background"};
+  fmt::format_to(std::back_inserter(*out), "# HELP {0} {1}\n# TYPE {0} {2}\n", name, help, type);
+  for (size_t i = 0; i < values.size(); i++)
+  {
+    fmt::format_to(std::back_inserter(*out), "{}{{class=\"{}\"}} {}\n", name, class_names[i],
+                   values[i].load(std::memory_order_relaxed) * scale);
+  }
+}
+
+void ServeClient(sf::TcpSocket& client, const std::string& body)
+{
+  // Only GET requests are expected, and the path is ignored. Wait for the end of the headers
+  // so the client doesn't see the connection reset before it is done sending.
+  client.setBlocking(false);
+  std::string request;
+  std::array<char, 1024> buffer;
+  const auto deadline = std::chrono::steady_clock::now() + REQUEST_TIMEOUT;
+  while (request.find("\r\n\r\n") == std::string::npos)
+  {
+    std::size_t received = 0;
+    const sf::Socket::Status status = client.receive(buffer.data(), buffer.size(), received);
+    if (status == sf::Socket::Done)
+      request.append(buffer.data(), received);
+    else if (status != sf::Socket::NotReady && status != sf::Socket::Partial)
+      return;
+    else if (std::chrono::steady_clock::now() > deadline)
+      return;
+    else
+      Common::SleepCurrentThread(1);
+
+    if (request.size() > 16 * 1024)
+      return;
+  }
+
+  const std::string response = fmt::format("HTTP/1.0 200 OK\r\n"
+                                           "Content-Type: text/plain; version=0.0.4\r\n"
+                                           "Content-Length: {}\r\n"
+                                           "Connection: close\r\n\r\n{}",
+                                           body.size(), body);
+  client.setBlocking(true);
+  client.send(response.data(), response.size());
+  client.disconnect();
+}
+}  // namespace
+
+MetricsServer::~MetricsServer()
+{
+  Stop();
+}
+
+void MetricsServer::Start(int port)
+{
+  if (m_thread.joinable() || port <= 0 || port > 0xFFFF)
+    return;
+
+  m_stop_requested.Clear();
+  m_thread = std::thread(&MetricsServer::ServerThread, this, static_cast<u16>(port));
+}
+
+void MetricsServer::Stop()
+{
+  if (!m_thread.joinable())
+    return;
+
+  m_stop_requested.Set();
+  m_thread.join();
+}
+
+void MetricsServer::Publish()
+{
+  if (!IsRunning())
+    return;
+
+  m_frames.fetch_add(1, std::memory_order_relaxed);
+  m_fps.store(g_perf_metrics.GetFPS(), std::memory_order_relaxed);
+  m_vps.store(g_perf_metrics.GetVPS(), std::memory_order_relaxed);
+  m_speed.store(g_perf_metrics.GetSpeed(), std::memory_order_relaxed);
+  m_max_speed.store(g_perf_metrics.GetMaxSpeed(), std::memory_order_relaxed);
+  m_throttle_sleep_us.store(
+      std::chrono::duration_cast<std::chrono::microseconds>(g_perf_metrics.GetTimeSleeping())
+          .count(),
+      std::memory_order_relaxed);
+
+  if (g_shader_cache)
+  {
+    m_shader_queue_size.store(g_shader_cache->GetAsyncCompileQueueSize(),
+                              std::memory_order_relaxed);
+    for (size_t i = 0; i < m_shader_queue_items.size(); i++)
+    {
+      const AsyncShaderCompiler::QueueLatencyStats stats =
+          g_shader_cache->GetAsyncCompileLatencyStats(
+              static_cast<AsyncShaderCompiler::WorkClass>(i));
+      m_shader_queue_items[i].store(stats.items, std::memory_order_relaxed);
+      m_shader_queue_wait_us[i].store(stats.total_wait_us, std::memory_order_relaxed);
+      m_shader_queue_max_wait_us[i].store(stats.max_wait_us, std::memory_order_relaxed);
+    }
+  }
+  m_textures_alive.store(g_stats.num_textures_alive, std::memory_order_relaxed);
+  m_texture_pool_bytes.store(g_stats.bytes_texture_pool, std::memory_order_relaxed);
+
+  const SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream();
+  if (const Mixer* mixer = sound_stream ? sound_stream->GetMixer() : nullptr)
+  {
+    m_audio_buffered_samples.store(mixer->GetDMABufferedSamples(), std::memory_order_relaxed);
+    m_audio_sample_rate.store(mixer->GetSampleRate(), std::memory_order_relaxed);
+    m_audio_underruns.store(mixer->GetDMAUnderrunCount(), std::memory_order_relaxed);
+    m_audio_deadline_misses.store(mixer->GetDeadlineMissCount(), std::memory_order_relaxed);
+  }
+}
+
+std::string MetricsServer::FormatMetrics() const
+{
+  constexpr auto relaxed = std::memory_order_relaxed;
+
+  std::string out;
+  AppendMetric(&out, "dolphin_frames_presented_total", "counter",
+               "Frames presented since the metrics server started.", m_frames.load(relaxed));
+  AppendMetric(&out, "dolphin_fps", "gauge", "Frames per second, as shown in the FPS overlay.",
+               m_fps.load(relaxed));
+  AppendMetric(&out, "dolphin_vps", "gauge", "VBlanks per second.", m_vps.load(relaxed));
+  AppendMetric(&out, "dolphin_speed_ratio", "gauge",
+               "Emulation speed relative to the console, 1 is full speed.", m_speed.load(relaxed));
+  AppendMetric(&out, "dolphin_max_speed_ratio", "gauge",
+               "Speed that could be reached without the speed limit.", m_max_speed.load(relaxed));
+  AppendMetric(&out, "dolphin_throttle_sleep_seconds_total", "counter",
+               "Time the CPU thread slept to limit emulation speed.",
+               m_throttle_sleep_us.load(relaxed) / 1e6);
+  AppendMetric(&out, "dolphin_gpu_thread_busy_seconds_total", "counter",
+               "Time the GPU thread spent processing the FIFO instead of waiting for it.",
+               m_gpu_thread_busy_us.load(relaxed) / 1e6);
+  AppendMetric(&out, "dolphin_audio_buffered_samples", "gauge",
+               "Samples buffered between the DSP and the audio backend.",
+               m_audio_buffered_samples.load(relaxed));
+  AppendMetric(&out, "dolphin_audio_sample_rate_hz", "gauge", "Output sample rate of the mixer.",
+               m_audio_sample_rate.load(relaxed));
+  AppendMetric(&out, "dolphin_audio_underruns_total", "counter",
+               "Times the audio backend drained the DSP buffer.", m_audio_underruns.load(relaxed));
+  AppendMetric(&out, "dolphin_audio_deadline_misses_total", "counter",
+               "Times audio processing took longer than the audio it produced.",
+               m_audio_deadline_misses.load(relaxed));
+  AppendMetric(&out, "dolphin_shader_compile_queue_depth", "gauge",
+               "Shaders and pipelines waiting to be compiled in the background.",
+               m_shader_queue_size.load(relaxed));
+  AppendLabeledMetrics(&out, "dolphin_shader_compile_queued_items_total", "counter",
+                       "Shader compiles picked up by a worker, by priority class.",
+                       m_shader_queue_items, 1.0);
+  AppendLabeledMetrics(&out, "dolphin_shader_compile_queue_wait_seconds_total", "counter",
+                       "Time shader compiles waited for a worker, by priority class.",
+                       m_shader_queue_wait_us, 1e-6);
+  AppendLabeledMetrics(&out, "dolphin_shader_compile_queue_max_wait_seconds", "gauge",
+                       "Longest time a shader compile waited for a worker, by priority class.",
+                       m_shader_queue_max_wait_us, 1e-6);
+  AppendMetric(&out, "dolphin_textures_alive", "gauge", "Entries in the texture cache.",
+               m_textures_alive.load(relaxed));
+  AppendMetric(&out, "dolphin_texture_pool_bytes", "gauge",
+               "Memory held by unused textures kept for reuse.",
+               m_texture_pool_bytes.load(relaxed));
+  return out;
+}
+
+void MetricsServer::ServerThread(u16 port)
+{
+  Common::SetCurrentThreadName("Metrics Server");
+
+  sf::TcpListener listener;
+  if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Done)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to listen for metrics scrapes on port {}", port);
+    return;
+  }
+  listener.setBlocking(false);
+  INFO_LOG_FMT(VIDEO, "Serving metrics on http://127.0.0.1:{}/metrics", port);
+
+  m_running.store(true, std::memory_order_relaxed);
+  sf::TcpSocket client;
+  while (!m_stop_requested.IsSet())
+  {
+    if (listener.accept(client) == sf::Socket::Done)
+      ServeClient(client, FormatMetrics());
+    else
+      Common::SleepCurrentThread(1);
+  }
+  m_running.store(false, std::memory_order_relaxed);
+}
+}  // namespace VideoCommon
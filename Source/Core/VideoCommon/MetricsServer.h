@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "Common/CommonTypes.h"
+#include "Common/Flag.h"
+
+namespace VideoCommon
+{
+// Serves performance metrics in the Prometheus text format on a local TCP port, for monitoring
+// Dolphin on unattended machines.
+//
+// The emulation side only ever stores the latest values into atomics once per presented frame.
+// The server thread reads those, so a scrape never takes a lock that emulation threads use.
+class MetricsServer
+{
+public:
+  MetricsServer() = default;
+  ~MetricsServer();
+
+  MetricsServer(const MetricsServer&) = delete;
+  MetricsServer& operator=(const MetricsServer&) = delete;
+
+  // Starts serving on 127.0.0.1:port, unless port is not a valid port number.
+  void Start(int port);
+  void Stop();
+
+  bool IsRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+  // Collects the latest values. Must be called from the video thread.
+  void Publish();
+
+  // Called by the GPU thread with the time it spent doing work instead of waiting for the FIFO.
+  void AddGPUThreadBusyTime(u64 busy_us)
+  {
+    m_gpu_thread_busy_us.fetch_add(busy_us, std::memory_order_relaxed);
+  }
+
+private:
+  void ServerThread(u16 port);
+  std::string FormatMetrics() const;
+
+  std::thread m_thread;
+  Common::Flag m_stop_requested;
+  std::atomic<bool> m_running = false;
+
+  std::atomic<double> m_fps = 0.0;
+  std::atomic<double> m_vps = 0.0;
+  std::atomic<double> m_speed = 0.0;
+  std::atomic<double> m_max_speed = 0.0;
+  std::atomic<u64> m_frames = 0;
+  std::atomic<u64> m_throttle_sleep_us = 0;
+  std::atomic<u64> m_gpu_thread_busy_us = 0;
+  std::atomic<u32> m_audio_buffered_samples = 0;
+  std::atomic<u32> m_audio_sample_rate = 0;
+  std::atomic<u32> m_audio_underruns = 0;
+  std::atomic<u32> m_audio_deadline_misses = 0;
+  std::atomic<u64> m_shader_queue_size = 0;
+  // Indexed by AsyncShaderCompiler::WorkClass.
+  std::array<std::atomic<u64>, 2> m_shader_queue_items{};
+  std::array<std::atomic<u64>, 2> m_shader_queue_wait_us{};
+  std::array<std::atomic<u64>, 2> m_shader_queue_max_wait_us{};
+  std::atomic<u64> m_textures_alive = 0;
+  std::atomic<u64> m_texture_pool_bytes = 0;
+};
+}  // namespace VideoCommon
+
+extern VideoCommon::MetricsServer g_metrics_server;
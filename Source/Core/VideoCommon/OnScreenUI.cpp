@@ -207,8 +207,9 @@ void OnScreenUI::BeginImGuiFrameUnlocked(u32 width, u32 height)
 
 void OnScreenUI::DrawImGui()
 {
+  // Nothing is shown on most frames, so skip setting up any state for drawing in that case.
   ImDrawData* draw_data = ImGui::GetDrawData();
-  if (!draw_data)
+  if (!draw_data || draw_data->TotalVtxCount == 0 || draw_data->TotalIdxCount == 0)
     return;
 
   g_gfx->SetViewport(0.0f, 0.0f, static_cast<float>(m_backbuffer_width),
@@ -231,7 +232,7 @@ void OnScreenUI::DrawImGui()
   {
     const ImDrawList* cmdlist = draw_data->CmdLists[i];
     if (cmdlist->VtxBuffer.empty() || cmdlist->IdxBuffer.empty())
-      return;
+      continue;
 
     u32 base_vertex, base_index;
     g_vertex_manager->UploadUtilityVertices(cmdlist->VtxBuffer.Data, sizeof(ImDrawVert),
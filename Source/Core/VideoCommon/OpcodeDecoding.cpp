@@ -14,6 +14,11 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <unordered_map>
+#include <vector>
+
+#include <xxhash.h>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -27,6 +32,7 @@
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStateManager.h"
 #include "VideoCommon/XFStructs.h"
@@ -35,6 +41,59 @@ namespace OpcodeDecoder
 {
 bool g_record_fifo_data = false;
 
+namespace
+{
+// Many games call the same display lists every frame. As long as the contents of a display list
+// don't change, the vertex data of its primitives doesn't need to be loaded again, unless the
+// vertex format changed or the vertices come from the vertex arrays.
+struct CachedDisplayList
+{
+  u64 hash = 0;
+  size_t size_in_bytes = 0;
+  std::vector<VertexLoaderManager::CachedVertices> primitives;
+};
+
+// Keyed by address and size. Only used on the GPU thread.
+std::unordered_map<u64, CachedDisplayList> s_display_list_cache;
+size_t s_display_list_cache_size = 0;
+
+// Everything is thrown away when the cached vertex data grows larger than this.
+constexpr size_t MAX_DISPLAY_LIST_CACHE_SIZE = 64 * 1024 * 1024;
+
+CachedDisplayList& GetCachedDisplayList(u32 address, u32 size, const u8* data)
+{
+  CachedDisplayList& display_list = s_display_list_cache[(u64(address) << 32) | size];
+
+  const u64 hash = XXH3_64bits(data, size);
+  if (display_list.hash != hash)
+  {
+    display_list.hash = hash;
+    display_list.primitives.clear();
+  }
+
+  return display_list;
+}
+
+void UpdateDisplayListCacheSize(CachedDisplayList& display_list)
+{
+  size_t size_in_bytes = 0;
+  for (const VertexLoaderManager::CachedVertices& primitive : display_list.primitives)
+    size_in_bytes += primitive.data.capacity();
+
+  s_display_list_cache_size += size_in_bytes - display_list.size_in_bytes;
+  display_list.size_in_bytes = size_in_bytes;
+
+  if (s_display_list_cache_size > MAX_DISPLAY_LIST_CACHE_SIZE)
+    ClearDisplayListCache();
+}
+}  // namespace
+
+void ClearDisplayListCache()
+{
+  s_display_list_cache.clear();
+  s_display_list_cache_size = 0;
+}
+
 template <bool is_preprocess>
 class RunCallback final : public Callback
 {
@@ -130,8 +189,19 @@ public:
     // load vertices
     const u32 size = vertex_size * num_vertices;
 
-    const u32 bytes =
-        VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices, vertex_data);
+    VertexLoaderManager::CachedVertices* cache = nullptr;
+    if constexpr (!is_preprocess)
+    {
+      if (m_display_list != nullptr)
+      {
+        if (m_display_list_primitive == m_display_list->primitives.size())
+          m_display_list->primitives.emplace_back();
+        cache = &m_display_list->primitives[m_display_list_primitive++];
+      }
+    }
+
+    const u32 bytes = VertexLoaderManager::RunVertices<is_preprocess>(vat, primitive, num_vertices,
+                                                                      vertex_data, cache);
 
     ASSERT(bytes == size);
 
@@ -188,9 +258,25 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
+          if (g_ActiveConfig.bDisplayListCache)
+          {
+            m_display_list = &GetCachedDisplayList(address, size, start_address);
+            m_display_list_primitive = 0;
+          }
+          else if (!s_display_list_cache.empty())
+          {
+            ClearDisplayListCache();
+          }
+
           Run(start_address, size, *this);
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
+          if (m_display_list != nullptr)
+          {
+            UpdateDisplayListCacheSize(*m_display_list);
+            m_display_list = nullptr;
+          }
+
           // un-swap
           g_stats.SwapDL();
         }
@@ -255,6 +341,10 @@ public:
 
   u32 m_cycles = 0;
   bool m_in_display_list = false;
+
+  // Cache entry of the display list being run, and the index of its next primitive.
+  CachedDisplayList* m_display_list = nullptr;
+  size_t m_display_list_primitive = 0;
 };
 
 template <bool is_preprocess>
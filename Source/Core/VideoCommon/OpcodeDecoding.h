@@ -276,6 +276,9 @@ DOLPHIN_FORCE_INLINE u32 Run(const u8* data, u32 available, T& callback)
 template <bool is_preprocess = false>
 u8* RunFifo(DataReader src, u32* cycles);
 
+// Drops the vertex loader output cached for display lists. Must be called from the GPU thread.
+void ClearDisplayListCache();
+
 }  // namespace OpcodeDecoder
 
 template <>
@@ -40,6 +40,11 @@ public:
   // NOTE: Called from CPU+GPU thread
   static bool ShouldEmulate();
 
+  // True if GetQueryResult can return the results of the queries issued before the last completed
+  // reset, so the CPU doesn't have to wait for the GPU when they are approximated.
+  // NOTE: Called from CPU thread
+  virtual bool SupportsApproximateResults() const { return false; }
+
   // Begin querying the specified value for the following host GPU commands
   // The call to EnableQuery() should be placed immediately before the draw command, otherwise
   // there is a risk of GPU resets if the query is left open and the buffer is submitted during
@@ -66,7 +71,7 @@ public:
 
 protected:
   std::atomic<u32> m_query_count;
-  std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results;
+  std::array<std::atomic<u32>, PQG_NUM_MEMBERS> m_results{};
 };
 
 extern std::unique_ptr<PerfQueryBase> g_perf_query;
@@ -3,7 +3,11 @@
 
 #include "VideoCommon/PerformanceMetrics.h"
 
+#include <algorithm>
+#include <array>
 #include <mutex>
+#include <numeric>
+#include <optional>
 
 #include <imgui.h>
 #include <implot.h>
@@ -11,6 +15,11 @@
 #include "Core/CoreTiming.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/System.h"
+#include "VideoCommon/GPUTiming.h"
+#include "VideoCommon/PostProcessing.h"
+#include "VideoCommon/Present.h"
+#include "VideoCommon/StutterTracker.h"
+#include "VideoCommon/TemporalUpscaler.h"
 #include "VideoCommon/VideoConfig.h"
 
 PerformanceMetrics g_perf_metrics;
@@ -74,6 +83,12 @@ double PerformanceMetrics::GetMaxSpeed() const
          DT_s(m_real_times[u8(m_time_index - 1)] - m_real_times[m_time_index]);
 }
 
+DT PerformanceMetrics::GetTimeSleeping() const
+{
+  std::shared_lock lock(m_time_lock);
+  return m_time_sleeping;
+}
+
 double PerformanceMetrics::GetLastSpeedDenominator() const
 {
   return DT_s(m_speed_counter.GetLastRawDt()).count() *
@@ -269,5 +284,110 @@ void PerformanceMetrics::DrawImGuiStats(const float backbuffer_scale)
     }
   }
 
+  if (g_ActiveConfig.bShowGPUTimes && g_gpu_timing)
+  {
+    const VideoCommon::PostProcessing* post_processor =
+        g_presenter ? g_presenter->GetPostProcessor() : nullptr;
+    const float upscale_factor =
+        post_processor ? post_processor->GetTemporalUpscaler()->GetUpscaleFactor() : 0.0f;
+    const int count = static_cast<int>(GPUPass::Count) + (upscale_factor > 0.0f ? 2 : 1);
+    const float gpu_window_width = 2.f * window_width;
+    float window_height = (12.f + 17.f * count) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(gpu_window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= gpu_window_width + window_padding;
+
+    if (ImGui::Begin("GPUStats", nullptr, imgui_flags))
+    {
+      const GPUTimingBase::PassTimes& times = g_gpu_timing->GetLatestTimesMs();
+      double total = 0.0;
+      for (u32 i = 0; i < static_cast<u32>(GPUPass::Count); ++i)
+      {
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-10s%6.2lfms",
+                           GPUTimingBase::GetPassName(static_cast<GPUPass>(i)), times[i]);
+        total += times[i];
+      }
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-10s%6.2lfms", "GPU Total", total);
+
+      // Estimates the cost of rendering the scene at the target resolution by scaling the scene
+      // pass with the pixel count, which holds for the fill-bound scenes this is meant for.
+      if (upscale_factor > 0.0f && total > 0.0)
+      {
+        const double scene = times[static_cast<u32>(GPUPass::MainScene)];
+        const double upscale = times[static_cast<u32>(GPUPass::TemporalUpscaling)];
+        const double native_total =
+            total - upscale + scene * (upscale_factor * upscale_factor - 1.0);
+        ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-10s%6.2lfx", "Speedup", native_total / total);
+      }
+      ImGui::End();
+    }
+  }
+
+  if (g_ActiveConfig.bShowStutters)
+  {
+    // The frame time, plus the three biggest contributors to the last spike.
+    constexpr int MAX_SHOWN_CAUSES = 3;
+    const int count = MAX_SHOWN_CAUSES + 2;
+    const float stutter_window_width = 3.f * window_width;
+    float window_height = (12.f + 17.f * count) * backbuffer_scale;
+
+    // Position in the top-right corner of the screen.
+    ImGui::SetNextWindowPos(ImVec2(window_x, window_y), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(stutter_window_width, window_height));
+    ImGui::SetNextWindowBgAlpha(bg_alpha);
+
+    if (stack_vertically)
+      window_y += window_height + window_padding;
+    else
+      window_x -= stutter_window_width + window_padding;
+
+    if (ImGui::Begin("StutterStats", nullptr, imgui_flags))
+    {
+      ImGui::TextColored(ImVec4(r, g, b, 1.0f), "Spikes: %llu",
+                         static_cast<unsigned long long>(g_stutter_tracker.GetSpikeCount()));
+
+      const std::optional<StutterTracker::Spike> spike = g_stutter_tracker.GetLastSpike();
+      if (spike)
+      {
+        ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "Frame %llu: %.1lfms (avg %.1lfms)",
+                           static_cast<unsigned long long>(spike->frame_number),
+                           spike->frame_time_ms, spike->average_frame_time_ms);
+
+        std::array<u32, static_cast<std::size_t>(StutterCause::Count)> order;
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&](u32 lhs, u32 rhs) {
+          return spike->causes[lhs].time_us > spike->causes[rhs].time_us;
+        });
+        for (int i = 0; i < MAX_SHOWN_CAUSES; ++i)
+        {
+          const StutterTracker::CauseStats& stats = spike->causes[order[i]];
+          if (stats.count == 0)
+            break;
+
+          const char* name = StutterTracker::GetCauseName(static_cast<StutterCause>(order[i]));
+          if (stats.bytes != 0)
+          {
+            ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-17s%4ux %6.2lfms %5lluKB", name,
+                               stats.count, stats.time_us / 1000.0,
+                               static_cast<unsigned long long>(stats.bytes / 1024));
+          }
+          else
+          {
+            ImGui::TextColored(ImVec4(r, g, b, 1.0f), "%-17s%4ux %6.2lfms", name, stats.count,
+                               stats.time_us / 1000.0);
+          }
+        }
+      }
+      ImGui::End();
+    }
+  }
+
   ImGui::PopStyleVar(2);
 }
@@ -38,6 +38,8 @@ public:
   double GetVPS() const;
   double GetSpeed() const;
   double GetMaxSpeed() const;
+  // Total time the CPU thread spent sleeping to limit emulation speed since the last Reset().
+  DT GetTimeSleeping() const;
 
   double GetLastSpeedDenominator() const;
 
@@ -187,6 +187,29 @@ constexpr Common::EnumMap<const char*, TevOutput::Color2> tev_a_output_table{
 
 constexpr Common::EnumMap<char, ColorChannel::Alpha> rgba_swizzle{'r', 'g', 'b', 'a'};
 
+bool IsPixelShaderUidBPRegister(u8 address)
+{
+  switch (address)
+  {
+  case BPMEM_GENMODE:
+  case BPMEM_IREF:
+  case BPMEM_ZMODE:
+  case BPMEM_BLENDMODE:
+  case BPMEM_CONSTANTALPHA:
+  case BPMEM_ZCOMPARE:
+  case BPMEM_FOGRANGE:
+  case BPMEM_FOGPARAM3:
+  case BPMEM_ALPHACOMPARE:
+  case BPMEM_ZTEX2:
+    return true;
+  default:
+    return (address >= BPMEM_IND_CMD && address < BPMEM_IND_CMD + 16) ||
+           (address >= BPMEM_TREF && address < BPMEM_TREF + 8) ||
+           (address >= BPMEM_TEV_COLOR_ENV && address < BPMEM_TEV_COLOR_ENV + 32) ||
+           (address >= BPMEM_TEV_KSEL && address < BPMEM_TEV_KSEL + 8);
+  }
+}
+
 PixelShaderUid GetPixelShaderUid()
 {
   PixelShaderUid out;
@@ -1027,7 +1050,7 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_gl_layer_in_fs && !host_config.backend_multiview)
       out.Write("flat in int layer;");
   }
   else
@@ -1092,7 +1115,11 @@ ShaderCode GeneratePixelShaderCode(APIType api_type, const ShaderHostConfig& hos
     out.Write("\tfloat4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (host_config.backend_multiview)
+  {
+    out.Write("\tint layer = gl_ViewIndex;\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
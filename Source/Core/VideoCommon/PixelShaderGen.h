@@ -170,3 +170,5 @@ void WritePixelShaderCommonHeader(ShaderCode& out, APIType api_type,
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid);
 PixelShaderUid GetPixelShaderUid();
+// Returns whether writes to the given BP register can change the result of GetPixelShaderUid().
+bool IsPixelShaderUidBPRegister(u8 address);
@@ -27,6 +27,7 @@
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/TemporalUpscaler.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -373,7 +374,7 @@ void PostProcessingConfiguration::SetOptionb(const std::string& option, bool val
   m_any_options_dirty = true;
 }
 
-PostProcessing::PostProcessing()
+PostProcessing::PostProcessing() : m_temporal_upscaler(std::make_unique<TemporalUpscaler>())
 {
   m_timer.Start();
 }
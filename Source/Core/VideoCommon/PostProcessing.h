@@ -20,6 +20,8 @@ class AbstractFramebuffer;
 
 namespace VideoCommon
 {
+class TemporalUpscaler;
+
 class PostProcessingConfiguration
 {
 public:
@@ -100,6 +102,7 @@ public:
   static std::vector<std::string> GetAnaglyphShaderList();
 
   PostProcessingConfiguration* GetConfig() { return &m_config; }
+  TemporalUpscaler* GetTemporalUpscaler() const { return m_temporal_upscaler.get(); }
 
   bool Initialize(AbstractTextureFormat format);
 
@@ -145,6 +148,8 @@ protected:
   std::unique_ptr<AbstractPipeline> m_pipeline;
   std::vector<u8> m_uniform_staging_buffer;
 
+  std::unique_ptr<TemporalUpscaler> m_temporal_upscaler;
+
   AbstractTextureFormat m_framebuffer_format = AbstractTextureFormat::Undefined;
 };
 }  // namespace VideoCommon
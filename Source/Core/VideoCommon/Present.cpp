@@ -4,6 +4,7 @@
 #include "VideoCommon/Present.h"
 
 #include "Common/ChunkFile.h"
+#include "Common/Instrumentation.h"
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/HW/VideoInterface.h"
 #include "Core/Host.h"
@@ -15,9 +16,13 @@
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTiming.h"
+#include "VideoCommon/MetricsServer.h"
 #include "VideoCommon/OnScreenUI.h"
 #include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/StutterTracker.h"
+#include "VideoCommon/TemporalUpscaler.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -196,6 +201,9 @@ void Presenter::ViSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height,
 
   BeforePresentEvent::Trigger(present_info);
 
+  if (m_skip_presenting.IsSet())
+    return;
+
   if (!is_duplicate || !g_ActiveConfig.bSkipPresentingDuplicateXFBs)
   {
     Present();
@@ -217,6 +225,9 @@ void Presenter::ImmediateSwap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_
 
   BeforePresentEvent::Trigger(present_info);
 
+  if (m_skip_presenting.IsSet())
+    return;
+
   Present();
   ProcessFrameDumping(ticks);
 
@@ -815,6 +826,17 @@ void Presenter::Present()
 
   UpdateDrawRectangle();
 
+  // Temporal upscaling draws to its own framebuffer, so it has to run before the backbuffer is
+  // bound.
+  const AbstractTexture* xfb_texture = m_xfb_entry ? m_xfb_entry->texture.get() : nullptr;
+  MathUtil::Rectangle<int> xfb_rect = m_xfb_rect;
+  if (m_xfb_entry)
+  {
+    GPUPassScope pass_scope(GPUPass::TemporalUpscaling);
+    xfb_texture =
+        m_post_processor->GetTemporalUpscaler()->Resolve(m_xfb_entry->id, xfb_texture, &xfb_rect);
+  }
+
   g_gfx->BeginUtilityDrawing();
   g_gfx->BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
 
@@ -823,10 +845,11 @@ void Presenter::Present()
   {
     // Adjust the source rectangle instead of using an oversized viewport to render the XFB.
     auto render_target_rc = GetTargetRectangle();
-    auto render_source_rc = m_xfb_rect;
+    auto render_source_rc = xfb_rect;
     AdjustRectanglesToFitBounds(&render_target_rc, &render_source_rc, m_backbuffer_width,
                                 m_backbuffer_height);
-    RenderXFBToScreen(render_target_rc, m_xfb_entry->texture.get(), render_source_rc);
+    GPUPassScope pass_scope(GPUPass::PostProcessing);
+    RenderXFBToScreen(render_target_rc, xfb_texture, render_source_rc);
   }
 
   if (m_onscreen_ui)
@@ -840,6 +863,11 @@ void Presenter::Present()
     std::lock_guard<std::mutex> guard(m_swap_mutex);
     g_gfx->PresentBackbuffer();
   }
+  INSTRUMENT_FRAME_MARK();
+  if (g_gpu_timing)
+    g_gpu_timing->OnFramePresented();
+  g_stutter_tracker.OnFramePresented();
+  g_metrics_server.Publish();
 
   if (m_xfb_entry)
   {
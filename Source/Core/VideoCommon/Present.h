@@ -94,6 +94,10 @@ public:
 
   int FrameCount() const { return m_frame_count; }
 
+  // While set, frames are still rendered and fetched from the XFB but never shown or dumped.
+  // Used to seek through movies quickly.
+  void SetSkipPresenting(bool skip) { m_skip_presenting.Set(skip); }
+
   void DoState(PointerWrap& p);
 
   const MathUtil::Rectangle<int>& GetTargetRectangle() const { return m_target_rectangle; }
@@ -132,6 +136,7 @@ private:
   void* m_new_surface_handle = nullptr;
   Common::Flag m_surface_changed;
   Common::Flag m_surface_resized;
+  Common::Flag m_skip_presenting;
 
   // The presentation rectangle.
   // Width and height correspond to the final output resolution.
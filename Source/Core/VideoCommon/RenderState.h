@@ -86,6 +86,10 @@ union FramebufferState
   // can specify its own format
   BitField<25, 3, u32> additional_color_attachment_count;
 
+  // All layers are rendered by each draw as multiview views, see AbstractGfx::
+  // CreateMultiviewFramebuffer.
+  BitField<28, 1, u32> multiview;
+
   u32 hex = 0;
 };
 
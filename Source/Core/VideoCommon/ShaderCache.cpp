@@ -3,11 +3,18 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <fmt/format.h>
+#include <xxhash.h>
 
 #include "Common/Assert.h"
+#include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
+#include "Common/Instrumentation.h"
 #include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractGfx.h"
@@ -17,6 +24,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/StutterTracker.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
@@ -46,6 +54,7 @@ bool ShaderCache::Initialize()
     return false;
 
   m_async_shader_compiler = g_gfx->CreateAsyncShaderCompiler();
+  m_async_shader_compiler->SetBackgroundPriority(COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   m_frame_end_handler = AfterFrameEvent::Register([this](Core::System&) { RetrieveAsyncShaders(); },
                                                   "RetrieveAsyncShaders");
   return true;
@@ -53,6 +62,7 @@ bool ShaderCache::Initialize()
 
 void ShaderCache::InitializeShaderCache()
 {
+  m_async_shader_compiler->SetReserveWorkerForOnDemand(false);
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
 
   // Load shader and UID caches.
@@ -71,8 +81,10 @@ void ShaderCache::InitializeShaderCache()
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
     WaitForAsyncCompiler();
 
-  // Switch to the runtime shader compiler thread configuration.
+  // Switch to the runtime shader compiler thread configuration, where one worker is kept free
+  // for pipelines the game needs right now.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
+  m_async_shader_compiler->SetReserveWorkerForOnDemand(true);
 }
 
 void ShaderCache::Reload()
@@ -88,6 +100,7 @@ void ShaderCache::Reload()
     LoadCaches();
 
   // Switch to the precompiling shader configuration while we rebuild.
+  m_async_shader_compiler->SetReserveWorkerForOnDemand(false);
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
 
   // We don't need to explicitly recompile the individual ubershaders here, as the pipelines
@@ -97,6 +110,7 @@ void ShaderCache::Reload()
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
     WaitForAsyncCompiler();
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
+  m_async_shader_compiler->SetReserveWorkerForOnDemand(true);
 }
 
 void ShaderCache::RetrieveAsyncShaders()
@@ -118,15 +132,24 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
+  {
+    MarkGXPipelineUIDUsed(uid);
     return it->second.first.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    INSTRUMENT_ZONE("ShaderCache::CompilePipeline");
+    StutterScope stutter_scope(StutterCause::PipelineCompile);
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
+  else
+    MarkGXPipelineUIDUsed(uid);
   return InsertGXPipeline(uid, std::move(pipeline));
 }
 
@@ -135,6 +158,8 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
+    MarkGXPipelineUIDUsed(uid);
+
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
@@ -156,10 +181,30 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
+  {
+    INSTRUMENT_ZONE("ShaderCache::CompilePipeline");
+    StutterScope stutter_scope(StutterCause::PipelineCompile);
     pipeline = g_gfx->CreatePipeline(*pipeline_config);
+  }
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+std::optional<const AbstractPipeline*>
+ShaderCache::GetUberPipelineForUidAsync(const GXUberPipelineUid& uid)
+{
+  auto it = m_gx_uber_pipeline_cache.find(uid);
+  if (it != m_gx_uber_pipeline_cache.end())
+  {
+    if (!it->second.second)
+      return it->second.first.get();
+    else
+      return {};
+  }
+
+  QueueUberPipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
+  return {};
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
@@ -408,6 +453,7 @@ void ShaderCache::ClearCaches()
     pipeline.reset();
   m_texture_reinterpret_pipelines.clear();
   m_texture_decoding_shaders.clear();
+  m_xfb_stitching_shader.reset();
 
   SETSTAT(g_stats.num_pixel_shaders_created, 0);
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
@@ -417,10 +463,18 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // Queue all uids with a null pipeline for compilation. Work items with the same priority are
+  // compiled in the order they are queued, so start with the most recently used ones, letting the
+  // pipelines which are needed soonest replace ubershaders first.
+  for (const GXPipelineUid& uid : m_gx_pipeline_uid_compile_order)
+  {
+    auto it = m_gx_pipeline_cache.find(uid);
+    if (it != m_gx_pipeline_cache.end() && !it->second.first && !it->second.second)
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+  }
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.first && !it.second.second)
       QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
   }
   for (auto& it : m_gx_uber_pipeline_cache)
@@ -432,6 +486,9 @@ void ShaderCache::CompileMissingPipelines()
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
 {
+  INSTRUMENT_ZONE("ShaderCache::CompileShader");
+  StutterScope stutter_scope(StutterCause::ShaderCompile);
+
   const ShaderCode source_code =
       GenerateVertexShaderCode(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer());
@@ -440,6 +497,9 @@ std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexSha
 std::unique_ptr<AbstractShader>
 ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) const
 {
+  INSTRUMENT_ZONE("ShaderCache::CompileShader");
+  StutterScope stutter_scope(StutterCause::ShaderCompile);
+
   const ShaderCode source_code =
       UberShader::GenVertexShader(m_api_type, m_host_config, uid.GetUidData());
   return g_gfx->CreateShaderFromSource(ShaderStage::Vertex, source_code.GetBuffer(),
@@ -448,6 +508,9 @@ ShaderCache::CompileVertexUberShader(const UberShader::VertexShaderUid& uid) con
 
 std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShaderUid& uid) const
 {
+  INSTRUMENT_ZONE("ShaderCache::CompileShader");
+  StutterScope stutter_scope(StutterCause::ShaderCompile);
+
   const ShaderCode source_code =
       GeneratePixelShaderCode(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer());
@@ -456,6 +519,9 @@ std::unique_ptr<AbstractShader> ShaderCache::CompilePixelShader(const PixelShade
 std::unique_ptr<AbstractShader>
 ShaderCache::CompilePixelUberShader(const UberShader::PixelShaderUid& uid) const
 {
+  INSTRUMENT_ZONE("ShaderCache::CompileShader");
+  StutterScope stutter_scope(StutterCause::ShaderCompile);
+
   const ShaderCode source_code =
       UberShader::GenPixelShader(m_api_type, m_host_config, uid.GetUidData(), {});
   return g_gfx->CreateShaderFromSource(ShaderStage::Pixel, source_code.GetBuffer(),
@@ -920,51 +986,71 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   return entry.first.get();
 }
 
+size_t ShaderCache::UidHash::HashBytes(const void* data, size_t size)
+{
+  return static_cast<size_t>(XXH3_64bits(data, size));
+}
+
+constexpr u32 UID_CACHE_FILE_MAGIC = 0x44495550;  // PUID
+constexpr size_t UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+constexpr const char* UID_CACHE_FILE_EXTENSION = ".uidcache";
+
+// Number of other games whose UID caches must contain a pipeline before it is precompiled for a
+// game that doesn't have a UID cache yet.
+constexpr size_t MIN_GAMES_FOR_SHARED_PIPELINE_UID = 2;
+
+// Reads all the UIDs in a UID cache file, leaving the file position at the end of the file.
+// Returns nothing if the file is from a different version or is corrupted.
+static std::optional<std::vector<SerializedGXPipelineUid>> ReadPipelineUIDs(File::IOFile& file)
+{
+  // If an existing case exists, validate the version before reading entries.
+  u32 existing_magic;
+  u32 existing_version;
+  if (!file.ReadBytes(&existing_magic, sizeof(existing_magic)) ||
+      !file.ReadBytes(&existing_version, sizeof(existing_version)) ||
+      existing_magic != UID_CACHE_FILE_MAGIC || existing_version != GX_PIPELINE_UID_VERSION)
+  {
+    return std::nullopt;
+  }
+
+  // Ensure the expected size matches the actual size of the file. If it doesn't, it means
+  // the cache file may be corrupted, and we should not proceed with loading potentially
+  // garbage or invalid UIDs.
+  const u64 file_size = file.GetSize();
+  const size_t uid_count =
+      static_cast<size_t>(file_size - UID_CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
+  const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + UID_CACHE_HEADER_SIZE;
+  if (file_size != expected_size)
+    return std::nullopt;
+
+  std::vector<SerializedGXPipelineUid> serialized_uids(uid_count);
+  if (!file.ReadArray(serialized_uids.data(), uid_count))
+    return std::nullopt;
+
+  return serialized_uids;
+}
+
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  std::string filename = File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() +
+                         UID_CACHE_FILE_EXTENSION;
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
-    // If an existing case exists, validate the version before reading entries.
-    u32 existing_magic;
-    u32 existing_version;
     bool uid_file_valid = false;
-    if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
-        m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+    if (const auto serialized_uids = ReadPipelineUIDs(m_gx_pipeline_uid_cache_file))
     {
-      // Ensure the expected size matches the actual size of the file. If it doesn't, it means
-      // the cache file may be corrupted, and we should not proceed with loading potentially
-      // garbage or invalid UIDs.
-      const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
-      const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
-      uid_file_valid = file_size == expected_size;
-      if (uid_file_valid)
-      {
-        for (size_t i = 0; i < uid_count; i++)
-        {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
-          {
-            // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
-          }
-          else
-          {
-            uid_file_valid = false;
-            break;
-          }
-        }
-      }
+      // UIDs are appended again when they are used in a later session, so the last occurrence
+      // of a UID tells how recently it was used. Walk backwards to find it first.
+      // This just adds the pipelines to the map, they are compiled later.
+      for (auto it = serialized_uids->rbegin(); it != serialized_uids->rend(); ++it)
+        AddSerializedGXPipelineUID(*it);
+
+      // Rewrite the file without duplicates once they make up most of it.
+      uid_file_valid = serialized_uids->size() <= 2 * m_gx_pipeline_uid_compile_order.size();
 
       // We open the file for reading and writing, so we must seek to the end before writing.
       if (uid_file_valid)
-        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+        uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(0, File::SeekOrigin::End);
     }
 
     // If the file is invalid, close it. We re-open and truncate it below.
@@ -978,25 +1064,92 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+      m_gx_pipeline_uid_cache_file.WriteBytes(&UID_CACHE_FILE_MAGIC,
+                                              sizeof(GX_PIPELINE_UID_VERSION));
       m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
                                               sizeof(GX_PIPELINE_UID_VERSION));
 
-      // Write any current UIDs out to the file.
+      // Write any current UIDs out to the file, the most recently used ones last.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
       for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      {
+        if (!m_unused_gx_pipeline_uids.contains(it.first))
+          AppendGXPipelineUID(it.first);
+      }
+      for (auto it = m_gx_pipeline_uid_compile_order.rbegin();
+           it != m_gx_pipeline_uid_compile_order.rend(); ++it)
+      {
+        AppendGXPipelineUID(*it);
+      }
     }
+
+    // This is a new game, or its UIDs were lost. Start with the pipelines other games share.
+    if (m_gx_pipeline_uid_compile_order.empty())
+      AddSharedPipelineUIDs();
   }
 
   INFO_LOG_FMT(VIDEO, "Read {} pipeline UIDs from {}", m_gx_pipeline_cache.size(), filename);
 }
 
+void ShaderCache::AddSharedPipelineUIDs()
+{
+  const auto less = [](const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) {
+    return std::memcmp(&a, &b, sizeof(SerializedGXPipelineUid)) < 0;
+  };
+  const auto equal = [](const SerializedGXPipelineUid& a, const SerializedGXPipelineUid& b) {
+    return std::memcmp(&a, &b, sizeof(SerializedGXPipelineUid)) == 0;
+  };
+
+  // Collect the UIDs of all other games, each of them only once per game.
+  const std::string own_filename = SConfig::GetInstance().GetGameID() + UID_CACHE_FILE_EXTENSION;
+  std::vector<SerializedGXPipelineUid> serialized_uids;
+  size_t num_games = 0;
+  for (const std::string& path :
+       Common::DoFileSearch({File::GetUserPath(D_CACHE_IDX)}, {UID_CACHE_FILE_EXTENSION}))
+  {
+    std::string name, extension;
+    SplitPath(path, nullptr, &name, &extension);
+    if (name + extension == own_filename)
+      continue;
+
+    File::IOFile file(path, "rb");
+    auto game_uids = ReadPipelineUIDs(file);
+    if (!game_uids)
+      continue;
+
+    std::sort(game_uids->begin(), game_uids->end(), less);
+    const auto end = std::unique(game_uids->begin(), game_uids->end(), equal);
+    serialized_uids.insert(serialized_uids.end(), game_uids->begin(), end);
+    num_games++;
+  }
+
+  // Pipelines that several games have in common, e.g. for simple TEV setups, are likely to be
+  // used by this game too.
+  std::sort(serialized_uids.begin(), serialized_uids.end(), less);
+  size_t num_shared_uids = 0;
+  for (auto it = serialized_uids.begin(); it != serialized_uids.end();)
+  {
+    const auto next = std::find_if_not(it, serialized_uids.end(), [&](const auto& uid) {
+      return equal(uid, *it);
+    });
+    if (static_cast<size_t>(next - it) >= MIN_GAMES_FOR_SHARED_PIPELINE_UID)
+    {
+      AddSerializedGXPipelineUID(*it);
+      num_shared_uids++;
+    }
+    it = next;
+  }
+
+  INFO_LOG_FMT(VIDEO, "Added {} pipeline UIDs shared by the UID caches of {} other games",
+               num_shared_uids, num_games);
+}
+
 void ShaderCache::ClosePipelineUIDCache()
 {
   // This is left as a method in case we need to append extra data to the file in the future.
   m_gx_pipeline_uid_cache_file.Close();
+  m_unused_gx_pipeline_uids.clear();
 }
 
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
@@ -1004,6 +1157,11 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
+  // Only the most recent occurrence of a UID counts.
+  if (!m_unused_gx_pipeline_uids.insert(real_uid).second)
+    return;
+  m_gx_pipeline_uid_compile_order.push_back(real_uid);
+
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
     return;
@@ -1027,6 +1185,12 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+void ShaderCache::MarkGXPipelineUIDUsed(const GXPipelineUid& config)
+{
+  if (m_unused_gx_pipeline_uids.erase(config) != 0)
+    AppendGXPipelineUID(config);
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -1181,6 +1345,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
     bool Compile() override
     {
+      StutterScope stutter_scope(StutterCause::AsyncPipelineCompile);
       if (config)
         pipeline = g_gfx->CreatePipeline(*config);
       return true;
@@ -1256,6 +1421,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
 
     bool Compile() override
     {
+      StutterScope stutter_scope(StutterCause::AsyncPipelineCompile);
       if (config)
         UberPipeline = g_gfx->CreatePipeline(*config);
       return true;
@@ -1525,6 +1691,16 @@ bool ShaderCache::CompileSharedPipelines()
     }
   }
 
+  // Not fatal, the texture cache stitches XFB copies with draws without it.
+  if (g_ActiveConfig.backend_info.bSupportsComputeShaders)
+  {
+    m_xfb_stitching_shader = g_gfx->CreateShaderFromSource(
+        ShaderStage::Compute, TextureConversionShaderTiled::GenerateXFBStitchingShader(m_api_type),
+        "XFB stitching compute shader");
+    if (!m_xfb_stitching_shader)
+      WARN_LOG_FMT(VIDEO, "Failed to compile XFB stitching shader, falling back to draws.");
+  }
+
   return true;
 }
 
@@ -11,7 +11,9 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -62,9 +64,21 @@ public:
   // Retrieves all pending shaders/pipelines from the async compiler.
   void RetrieveAsyncShaders();
 
+  // Number of shaders and pipelines waiting to be compiled in the background.
+  size_t GetAsyncCompileQueueSize() const
+  {
+    return m_async_shader_compiler->GetPendingWorkItemCount();
+  }
+  AsyncShaderCompiler::QueueLatencyStats
+  GetAsyncCompileLatencyStats(AsyncShaderCompiler::WorkClass work_class) const
+  {
+    return m_async_shader_compiler->GetQueueLatencyStats(work_class);
+  }
+
   // Accesses ShaderGen shader caches
   const AbstractPipeline* GetPipelineForUid(const GXPipelineUid& uid);
   const AbstractPipeline* GetUberPipelineForUid(const GXUberPipelineUid& uid);
+  std::optional<const AbstractPipeline*> GetUberPipelineForUidAsync(const GXUberPipelineUid& uid);
 
   // Accesses ShaderGen shader caches asynchronously.
   // The optional will be empty if this pipeline is now background compiling.
@@ -114,6 +128,9 @@ public:
   const AbstractShader* GetTextureDecodingShader(TextureFormat format,
                                                  std::optional<TLUTFormat> palette_format);
 
+  // XFB stitching compute shader, null if compute shaders are unsupported
+  const AbstractShader* GetXFBStitchingShader() const { return m_xfb_stitching_shader.get(); }
+
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
@@ -121,6 +138,7 @@ private:
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
+  void AddSharedPipelineUIDs();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
   void QueueUberShaderPipelines();
@@ -161,6 +179,7 @@ private:
                                                std::unique_ptr<AbstractPipeline> pipeline);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  void MarkGXPipelineUIDUsed(const GXPipelineUid& config);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -206,6 +225,21 @@ private:
   std::unique_ptr<AbstractShader> m_texture_copy_pixel_shader;
   std::unique_ptr<AbstractShader> m_color_pixel_shader;
 
+  // Hashes the raw bytes of a UID. UIDs are compared with memcmp() and have their padding bytes
+  // zeroed, so this is consistent with their operator==.
+  struct UidHash
+  {
+    template <typename UidData>
+    size_t operator()(const ShaderUid<UidData>& uid) const
+    {
+      return HashBytes(uid.GetUidDataRaw(), uid.GetUidDataSize());
+    }
+    size_t operator()(const GXPipelineUid& uid) const { return HashBytes(&uid, sizeof(uid)); }
+    size_t operator()(const GXUberPipelineUid& uid) const { return HashBytes(&uid, sizeof(uid)); }
+
+    static size_t HashBytes(const void* data, size_t size);
+  };
+
   // GX Shader Caches
   template <typename Uid>
   struct ShaderModuleCache
@@ -215,7 +249,7 @@ private:
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
-    std::map<Uid, Shader> shader_map;
+    std::unordered_map<Uid, Shader, UidHash> shader_map;
     Common::LinearDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
@@ -225,10 +259,17 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  std::unordered_map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>, UidHash>
+      m_gx_pipeline_cache;
+  std::unordered_map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>,
+                     UidHash>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // UIDs read from the UID cache which haven't been used in this session yet. A UID is appended to
+  // the file again the first time it's used, so later entries in the file are more recently used.
+  std::unordered_set<GXPipelineUid, UidHash> m_unused_gx_pipeline_uids;
+  // UIDs read from the UID cache, most recently used first. Compiled in this order.
+  std::vector<GXPipelineUid> m_gx_pipeline_uid_compile_order;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -252,6 +293,8 @@ private:
   // Texture decoding shaders
   std::map<std::pair<u32, u32>, std::unique_ptr<AbstractShader>> m_texture_decoding_shaders;
 
+  std::unique_ptr<AbstractShader> m_xfb_stitching_shader;
+
   Common::EventHook m_frame_end_handler;
 };
 
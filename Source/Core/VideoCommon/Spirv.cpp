@@ -3,17 +3,26 @@
 
 #include "VideoCommon/Spirv.h"
 
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#include <xxhash.h>
+
 // glslang includes
 #include "GlslangToSpv.h"
 #include "ResourceLimits.h"
 #include "disassemble.h"
 
 #include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
 #include "Common/Version.h"
 
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/VideoBackendBase.h"
 #include "VideoCommon/VideoConfig.h"
 
@@ -158,6 +167,136 @@ CompileShaderToSPV(EShLanguage stage, APIType api_type,
 
   return out_code;
 }
+
+// Identical source compiled for the same stage and target always produces the same code, so it
+// can be shared between shader UIDs which generate the same source, and reused across runs.
+struct CompileCacheKey
+{
+  u64 source_hash_low;
+  u64 source_hash_high;
+  u32 stage;
+  u32 api_type;
+  u32 language_version;
+  u32 debug_info;
+
+  bool operator==(const CompileCacheKey& rhs) const
+  {
+    return std::memcmp(this, &rhs, sizeof(*this)) == 0;
+  }
+};
+static_assert(sizeof(CompileCacheKey) == 32, "Key is stored on disk and must not have padding");
+
+struct CompileCacheKeyHash
+{
+  std::size_t operator()(const CompileCacheKey& key) const noexcept
+  {
+    return static_cast<std::size_t>(key.source_hash_low);
+  }
+};
+
+class CompileCache
+{
+public:
+  std::optional<SPIRV::CodeVector> Lookup(const CompileCacheKey& key)
+  {
+    std::lock_guard guard(m_lock);
+    if (!m_disk_cache_open && g_ActiveConfig.bShaderCache)
+      OpenDiskCache();
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  void Insert(const CompileCacheKey& key, const SPIRV::CodeVector& code)
+  {
+    std::lock_guard guard(m_lock);
+
+    // The cache file is never trimmed, so stop adding once it is large.
+    const std::size_t code_bytes = code.size() * sizeof(SPIRV::CodeType);
+    if (m_code_bytes + code_bytes > MAX_CODE_BYTES)
+      return;
+    if (!m_entries.emplace(key, code).second)
+      return;
+
+    m_code_bytes += code_bytes;
+    if (m_disk_cache_open)
+      m_disk_cache.Append(key, code.data(), static_cast<u32>(code.size()));
+  }
+
+  void Close()
+  {
+    std::lock_guard guard(m_lock);
+    if (m_disk_cache_open)
+    {
+      m_disk_cache.Sync();
+      m_disk_cache.Close();
+      m_disk_cache_open = false;
+    }
+    m_entries.clear();
+    m_code_bytes = 0;
+  }
+
+private:
+  static constexpr std::size_t MAX_CODE_BYTES = 64 * 1024 * 1024;
+
+  class DiskCacheReader : public Common::LinearDiskCacheReader<CompileCacheKey, SPIRV::CodeType>
+  {
+  public:
+    explicit DiskCacheReader(CompileCache* cache) : m_cache(cache) {}
+    void Read(const CompileCacheKey& key, const SPIRV::CodeType* value, u32 value_size) override
+    {
+      if (m_cache->m_entries.emplace(key, SPIRV::CodeVector(value, value + value_size)).second)
+        m_cache->m_code_bytes += value_size * sizeof(SPIRV::CodeType);
+    }
+
+  private:
+    CompileCache* m_cache;
+  };
+
+  void OpenDiskCache()
+  {
+    // The source hash covers everything which affects the output, so the cache is shared between
+    // APIs, games and host configs. The file header holds the Dolphin revision, which changes
+    // whenever the bundled glslang does.
+    const std::string filename =
+        GetDiskShaderCacheFileName(APIType::Nothing, "SPIRV", false, false, false);
+    DiskCacheReader reader(this);
+    const u32 count = m_disk_cache.OpenAndRead(filename, reader);
+    INFO_LOG_FMT(VIDEO, "Loaded {} cached SPIR-V compile results from {}", count, filename);
+    m_disk_cache_open = true;
+  }
+
+  std::mutex m_lock;
+  std::unordered_map<CompileCacheKey, SPIRV::CodeVector, CompileCacheKeyHash> m_entries;
+  std::size_t m_code_bytes = 0;
+  Common::LinearDiskCache<CompileCacheKey, SPIRV::CodeType> m_disk_cache;
+  bool m_disk_cache_open = false;
+};
+
+CompileCache s_compile_cache;
+
+std::optional<SPIRV::CodeVector>
+CompileShaderToSPVCached(EShLanguage stage, APIType api_type,
+                         glslang::EShTargetLanguageVersion language_version,
+                         const char* stage_filename, std::string_view source)
+{
+  const XXH128_hash_t source_hash = XXH3_128bits(source.data(), source.size());
+  const CompileCacheKey key = {source_hash.low64,
+                               source_hash.high64,
+                               static_cast<u32>(stage),
+                               static_cast<u32>(api_type),
+                               static_cast<u32>(language_version),
+                               g_ActiveConfig.bEnableValidationLayer};
+  if (auto code = s_compile_cache.Lookup(key))
+    return code;
+
+  auto code = CompileShaderToSPV(stage, api_type, language_version, stage_filename, source);
+  if (code)
+    s_compile_cache.Insert(key, *code);
+  return code;
+}
 }  // namespace
 
 namespace SPIRV
@@ -165,24 +304,29 @@ namespace SPIRV
 std::optional<CodeVector> CompileVertexShader(std::string_view source_code, APIType api_type,
                                               glslang::EShTargetLanguageVersion language_version)
 {
-  return CompileShaderToSPV(EShLangVertex, api_type, language_version, "vs", source_code);
+  return CompileShaderToSPVCached(EShLangVertex, api_type, language_version, "vs", source_code);
 }
 
 std::optional<CodeVector> CompileGeometryShader(std::string_view source_code, APIType api_type,
                                                 glslang::EShTargetLanguageVersion language_version)
 {
-  return CompileShaderToSPV(EShLangGeometry, api_type, language_version, "gs", source_code);
+  return CompileShaderToSPVCached(EShLangGeometry, api_type, language_version, "gs", source_code);
 }
 
 std::optional<CodeVector> CompileFragmentShader(std::string_view source_code, APIType api_type,
                                                 glslang::EShTargetLanguageVersion language_version)
 {
-  return CompileShaderToSPV(EShLangFragment, api_type, language_version, "ps", source_code);
+  return CompileShaderToSPVCached(EShLangFragment, api_type, language_version, "ps", source_code);
 }
 
 std::optional<CodeVector> CompileComputeShader(std::string_view source_code, APIType api_type,
                                                glslang::EShTargetLanguageVersion language_version)
 {
-  return CompileShaderToSPV(EShLangCompute, api_type, language_version, "cs", source_code);
+  return CompileShaderToSPVCached(EShLangCompute, api_type, language_version, "cs", source_code);
+}
+
+void CloseCompileCache()
+{
+  s_compile_cache.Close();
 }
 }  // namespace SPIRV
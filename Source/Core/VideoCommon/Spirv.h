@@ -34,4 +34,8 @@ std::optional<CodeVector> CompileFragmentShader(std::string_view source_code, AP
 // Compile a compute shader to SPIR-V.
 std::optional<CodeVector> CompileComputeShader(std::string_view source_code, APIType api_type,
                                                glslang::EShTargetLanguageVersion language_version);
+
+// Results are cached by a hash of the source, in memory and on disk when the shader cache is
+// enabled. Closes the disk cache and drops the cached code. Call when the backend shuts down.
+void CloseCompileCache();
 }  // namespace SPIRV
@@ -85,11 +85,26 @@ void Statistics::Display() const
     draw_statistic("Rasterized Pix", "%d", this_frame.rasterized_pixels);
     draw_statistic("TEV Pix In", "%d", this_frame.tev_pixels_in);
     draw_statistic("TEV Pix Out", "%d", this_frame.tev_pixels_out);
+    draw_statistic("Backend Commands", "%d", this_frame.num_backend_commands);
   }
 
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture pool hits", "%d/%d", this_frame.num_texture_pool_hits,
+                 this_frame.num_texture_pool_hits + this_frame.num_texture_pool_misses);
+  draw_statistic("Texture pool size", "%zu kB", bytes_texture_pool / 1024);
+  draw_statistic("Sampler sets reused", "%d/%d", this_frame.num_sampler_set_reuses,
+                 this_frame.num_sampler_set_reuses + this_frame.num_sampler_set_writes);
+  draw_statistic("Command encoders", "%d", this_frame.num_command_encoders);
+  draw_statistic("Resource binds", "%d", this_frame.num_resource_binds);
+  draw_statistic("Render passes", "%d (%d loaded)", this_frame.num_render_passes,
+                 this_frame.num_render_pass_loads);
+  draw_statistic("Render pass traffic", "%llu kB loaded, %llu kB stored",
+                 static_cast<unsigned long long>(this_frame.bytes_render_pass_loaded / 1024),
+                 static_cast<unsigned long long>(this_frame.bytes_render_pass_stored / 1024));
+  draw_statistic("Stream buffer stalls", "%d (%d us)", this_frame.num_stream_buffer_stalls,
+                 this_frame.stream_buffer_stall_us);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
@@ -109,6 +124,7 @@ void Statistics::Display() const
   draw_statistic("Vertex streamed", "%i kB", this_frame.bytes_vertex_streamed / 1024);
   draw_statistic("Index streamed", "%i kB", this_frame.bytes_index_streamed / 1024);
   draw_statistic("Uniform streamed", "%i kB", this_frame.bytes_uniform_streamed / 1024);
+  draw_statistic("Uniform skipped", "%i kB", this_frame.bytes_uniform_skipped / 1024);
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <vector>
 
 #include "VideoCommon/BPFunctions.h"
@@ -18,6 +19,7 @@ struct Statistics
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
+  size_t bytes_texture_pool = 0;
 
   int num_vertex_loaders = 0;
 
@@ -61,6 +63,9 @@ struct Statistics
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
+    int bytes_uniform_skipped = 0;
+
+    int num_backend_commands = 0;
 
     int num_triangles_clipped = 0;
     int num_triangles_in = 0;
@@ -73,6 +78,24 @@ struct Statistics
     int tev_pixels_in = 0;
     int tev_pixels_out = 0;
 
+    int num_texture_pool_hits = 0;
+    int num_texture_pool_misses = 0;
+
+    int num_sampler_set_reuses = 0;
+    int num_sampler_set_writes = 0;
+
+    int num_command_encoders = 0;
+    int num_resource_binds = 0;
+
+    // Render passes, and the attachment traffic they cause on tiled GPUs
+    int num_render_passes = 0;
+    int num_render_pass_loads = 0;
+    u64 bytes_render_pass_loaded = 0;
+    u64 bytes_render_pass_stored = 0;
+
+    int num_stream_buffer_stalls = 0;
+    int stream_buffer_stall_us = 0;
+
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
 
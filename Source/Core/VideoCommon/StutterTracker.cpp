@@ -0,0 +1,171 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/StutterTracker.h"
+
+#include <iomanip>
+#include <utility>
+
+#include "Common/FileUtil.h"
+
+#include "VideoCommon/VideoConfig.h"
+
+StutterTracker g_stutter_tracker;
+
+namespace
+{
+// A frame is a spike if it takes this much longer than the average of the frames before it...
+constexpr double SPIKE_RATIO = 1.5;
+// ...and at least this many milliseconds longer, so that small jitter at high frame rates
+// isn't reported.
+constexpr double SPIKE_MIN_DIFFERENCE_MS = 2.0;
+// Frames the average needs before spikes are reported.
+constexpr u64 WARMUP_FRAMES = 30;
+// Longer gaps between presents are pauses or loading, not stutters.
+constexpr double MAX_FRAME_TIME_MS = 1000.0;
+constexpr double AVERAGE_WEIGHT = 0.05;
+}  // namespace
+
+void StutterTracker::AddEvent(StutterCause cause, u64 duration_us, u64 bytes)
+{
+  if (!IsEnabled())
+    return;
+
+  AtomicCauseStats& stats = m_current[static_cast<std::size_t>(cause)];
+  stats.count.fetch_add(1, std::memory_order_relaxed);
+  stats.time_us.fetch_add(duration_us, std::memory_order_relaxed);
+  stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+StutterTracker::FrameStats StutterTracker::TakeFrameStats()
+{
+  FrameStats stats;
+  for (std::size_t i = 0; i < stats.size(); ++i)
+  {
+    stats[i].count = m_current[i].count.exchange(0, std::memory_order_relaxed);
+    stats[i].time_us = m_current[i].time_us.exchange(0, std::memory_order_relaxed);
+    stats[i].bytes = m_current[i].bytes.exchange(0, std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+void StutterTracker::OnFramePresented()
+{
+  const bool enabled = g_ActiveConfig.bShowStutters;
+  if (!enabled)
+  {
+    if (m_enabled.exchange(false, std::memory_order_relaxed))
+      Reset();
+    return;
+  }
+  m_enabled.store(true, std::memory_order_relaxed);
+
+  const u64 now_us = Common::Timer::NowUs();
+  const FrameStats stats = TakeFrameStats();
+  const u64 last_present_us = std::exchange(m_last_present_us, now_us);
+  if (last_present_us == 0)
+    return;
+
+  const double frame_time_ms = (now_us - last_present_us) / 1000.0;
+  if (frame_time_ms > MAX_FRAME_TIME_MS)
+  {
+    m_frame_number = 0;
+    return;
+  }
+
+  const bool is_spike = m_frame_number >= WARMUP_FRAMES &&
+                        frame_time_ms > m_average_frame_time_ms * SPIKE_RATIO &&
+                        frame_time_ms - m_average_frame_time_ms > SPIKE_MIN_DIFFERENCE_MS;
+  if (is_spike)
+  {
+    std::lock_guard lk(m_spike_lock);
+    m_last_spike = Spike{m_frame_number, frame_time_ms, m_average_frame_time_ms, stats};
+    ++m_spike_count;
+  }
+  else if (m_frame_number == 0)
+  {
+    m_average_frame_time_ms = frame_time_ms;
+  }
+  else
+  {
+    // Spikes are left out so that a burst of them doesn't raise the bar for the next ones.
+    m_average_frame_time_ms += (frame_time_ms - m_average_frame_time_ms) * AVERAGE_WEIGHT;
+  }
+
+  if (g_ActiveConfig.bLogRenderTimeToFile)
+    LogFrameToFile(frame_time_ms, is_spike, stats);
+
+  ++m_frame_number;
+}
+
+void StutterTracker::Reset()
+{
+  TakeFrameStats();
+  m_frame_number = 0;
+  m_last_present_us = 0;
+  m_average_frame_time_ms = 0.0;
+  m_log_file.close();
+
+  std::lock_guard lk(m_spike_lock);
+  m_last_spike.reset();
+  m_spike_count = 0;
+}
+
+std::optional<StutterTracker::Spike> StutterTracker::GetLastSpike() const
+{
+  std::lock_guard lk(m_spike_lock);
+  return m_last_spike;
+}
+
+u64 StutterTracker::GetSpikeCount() const
+{
+  std::lock_guard lk(m_spike_lock);
+  return m_spike_count;
+}
+
+void StutterTracker::LogFrameToFile(double frame_time_ms, bool is_spike, const FrameStats& stats)
+{
+  if (!m_log_file.is_open())
+  {
+    File::OpenFStream(m_log_file, File::GetUserPath(D_LOGS_IDX) + "stutter_journal.csv",
+                      std::ios_base::out);
+    m_log_file << "Frame,FrameTimeMs,Spike";
+    for (u32 i = 0; i < static_cast<u32>(StutterCause::Count); ++i)
+    {
+      const char* name = GetCauseName(static_cast<StutterCause>(i));
+      m_log_file << ',' << name << " Count," << name << " Ms," << name << " Bytes";
+    }
+    m_log_file << '\n';
+  }
+
+  m_log_file << m_frame_number << ',' << std::fixed << std::setprecision(3) << frame_time_ms
+             << ',' << (is_spike ? 1 : 0);
+  for (const CauseStats& cause : stats)
+    m_log_file << ',' << cause.count << ',' << cause.time_us / 1000.0 << ',' << cause.bytes;
+  m_log_file << '\n';
+}
+
+const char* StutterTracker::GetCauseName(StutterCause cause)
+{
+  switch (cause)
+  {
+  case StutterCause::PipelineCompile:
+    return "Pipeline Compile";
+  case StutterCause::AsyncPipelineCompile:
+    return "Async Pipeline";
+  case StutterCause::ShaderCompile:
+    return "Shader Compile";
+  case StutterCause::TextureUpload:
+    return "Texture Upload";
+  case StutterCause::JitCompile:
+    return "JIT Compile";
+  case StutterCause::GPUSync:
+    return "GPU Sync";
+  case StutterCause::DVDWait:
+    return "DVD Wait";
+  case StutterCause::SaveState:
+    return "Savestate";
+  default:
+    return "Unknown";
+  }
+}
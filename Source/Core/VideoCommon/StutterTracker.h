@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <optional>
+
+#include "Common/CommonTypes.h"
+#include "Common/Timer.h"
+
+// The kinds of work that can make a frame take longer than usual.
+enum class StutterCause : u32
+{
+  PipelineCompile,
+  AsyncPipelineCompile,
+  ShaderCompile,
+  TextureUpload,
+  JitCompile,
+  GPUSync,
+  DVDWait,
+  SaveState,
+  Count,
+};
+
+// Records what expensive work happened during each frame, so that a frame which took much longer
+// than the ones before it can be attributed to shader compiles, texture uploads, JIT compiles and
+// so on. Events can be added from any thread, and are assigned to the frame that is being built
+// by the video thread when they finish.
+class StutterTracker
+{
+public:
+  struct CauseStats
+  {
+    u32 count = 0;
+    u64 time_us = 0;
+    u64 bytes = 0;
+  };
+  using FrameStats = std::array<CauseStats, static_cast<std::size_t>(StutterCause::Count)>;
+
+  struct Spike
+  {
+    u64 frame_number = 0;
+    double frame_time_ms = 0.0;
+    double average_frame_time_ms = 0.0;
+    FrameStats causes{};
+  };
+
+  // Cheap enough to call for every event. Events are only recorded while the overlay or the
+  // journal is enabled.
+  bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  void AddEvent(StutterCause cause, u64 duration_us, u64 bytes = 0);
+
+  // Finishes the frame that was just presented and checks whether it was a spike.
+  // Must be called from the video thread.
+  void OnFramePresented();
+
+  std::optional<Spike> GetLastSpike() const;
+  u64 GetSpikeCount() const;
+
+  static const char* GetCauseName(StutterCause cause);
+
+private:
+  struct AtomicCauseStats
+  {
+    std::atomic<u32> count = 0;
+    std::atomic<u64> time_us = 0;
+    std::atomic<u64> bytes = 0;
+  };
+
+  FrameStats TakeFrameStats();
+  void Reset();
+  void LogFrameToFile(double frame_time_ms, bool is_spike, const FrameStats& stats);
+
+  std::atomic<bool> m_enabled = false;
+  std::array<AtomicCauseStats, static_cast<std::size_t>(StutterCause::Count)> m_current{};
+
+  // Only accessed by the video thread.
+  u64 m_frame_number = 0;
+  u64 m_last_present_us = 0;
+  double m_average_frame_time_ms = 0.0;
+  std::ofstream m_log_file;
+
+  mutable std::mutex m_spike_lock;
+  std::optional<Spike> m_last_spike;
+  u64 m_spike_count = 0;
+};
+
+extern StutterTracker g_stutter_tracker;
+
+// Records the time spent within its scope as an event of the given cause.
+class StutterScope final
+{
+public:
+  explicit StutterScope(StutterCause cause, u64 bytes = 0)
+      : m_cause(cause), m_bytes(bytes),
+        m_start_us(g_stutter_tracker.IsEnabled() ? Common::Timer::NowUs() : 0)
+  {
+  }
+
+  ~StutterScope()
+  {
+    if (m_start_us != 0)
+      g_stutter_tracker.AddEvent(m_cause, Common::Timer::NowUs() - m_start_us, m_bytes);
+  }
+
+  StutterScope(const StutterScope&) = delete;
+  StutterScope& operator=(const StutterScope&) = delete;
+
+private:
+  StutterCause m_cause;
+  u64 m_bytes;
+  u64 m_start_us;
+};
@@ -0,0 +1,329 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/TemporalUpscaler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Common/Logging/Log.h"
+#include "Core/System.h"
+#include "VideoCommon/AbstractFramebuffer.h"
+#include "VideoCommon/AbstractGfx.h"
+#include "VideoCommon/AbstractPipeline.h"
+#include "VideoCommon/AbstractShader.h"
+#include "VideoCommon/AbstractTexture.h"
+#include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/RenderState.h"
+#include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/VertexManagerBase.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace VideoCommon
+{
+namespace
+{
+// Number of jitter positions cycled through. Enough to cover every reconstructed pixel of a 2x
+// upscale a few times over.
+constexpr u32 JITTER_PHASES = 16;
+
+constexpr AbstractTextureFormat HISTORY_FORMAT = AbstractTextureFormat::RGBA16F;
+
+float Halton(u32 index, u32 base)
+{
+  float result = 0.0f;
+  float fraction = 1.0f;
+  while (index > 0)
+  {
+    fraction /= base;
+    result += fraction * (index % base);
+    index /= base;
+  }
+  return result;
+}
+}  // namespace
+
+TemporalUpscaler::TemporalUpscaler() = default;
+
+TemporalUpscaler::~TemporalUpscaler() = default;
+
+bool TemporalUpscaler::IsEnabled()
+{
+  return g_ActiveConfig.bTemporalUpscaling && g_ActiveConfig.stereo_mode == StereoMode::Off &&
+         !g_gfx->IsHeadless() && g_gfx->SupportsUtilityDrawing();
+}
+
+u32 TemporalUpscaler::GetRenderScale(u32 target_scale)
+{
+  // Render between a half and two thirds of the target resolution in each direction.
+  return std::max<u32>((target_scale + 1) / 2, 1);
+}
+
+bool TemporalUpscaler::IsActive() const
+{
+  return IsEnabled() &&
+         g_framebuffer_manager->GetEFBScale() < g_framebuffer_manager->GetTargetEFBScale();
+}
+
+bool TemporalUpscaler::CompilePipelines()
+{
+  if (m_resolve_pipeline && m_depth_copy_pipeline)
+    return true;
+
+  m_resolve_pixel_shader = g_gfx->CreateShaderFromSource(
+      ShaderStage::Pixel, FramebufferShaderGen::GenerateTemporalUpscalingPixelShader(),
+      "Temporal upscaling pixel shader");
+  if (!m_resolve_pixel_shader)
+    return false;
+
+  AbstractPipelineConfig config;
+  config.vertex_format = nullptr;
+  config.vertex_shader = g_shader_cache->GetScreenQuadVertexShader();
+  config.geometry_shader = nullptr;
+  config.pixel_shader = m_resolve_pixel_shader.get();
+  config.rasterization_state = RenderState::GetNoCullRasterizationState(PrimitiveType::Triangles);
+  config.depth_state = RenderState::GetNoDepthTestingDepthState();
+  config.blending_state = RenderState::GetNoBlendingBlendState();
+  config.framebuffer_state = RenderState::GetColorFramebufferState(HISTORY_FORMAT);
+  config.usage = AbstractPipelineUsage::Utility;
+  m_resolve_pipeline = g_gfx->CreatePipeline(config);
+
+  config.vertex_shader = g_shader_cache->GetTextureCopyVertexShader();
+  config.pixel_shader = g_shader_cache->GetTextureCopyPixelShader();
+  config.framebuffer_state = RenderState::GetColorFramebufferState(AbstractTextureFormat::R32F);
+  m_depth_copy_pipeline = g_gfx->CreatePipeline(config);
+
+  if (!m_resolve_pipeline || !m_depth_copy_pipeline)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to compile temporal upscaling pipelines");
+    m_resolve_pipeline.reset();
+    m_depth_copy_pipeline.reset();
+    return false;
+  }
+
+  return true;
+}
+
+bool TemporalUpscaler::CreateDepthTexture(u32 width, u32 height)
+{
+  if (m_depth_texture && m_depth_texture->GetWidth() == width &&
+      m_depth_texture->GetHeight() == height)
+  {
+    return true;
+  }
+
+  m_depth_framebuffer.reset();
+  m_depth_texture = g_gfx->CreateTexture(
+      TextureConfig(width, height, 1, 1, 1, AbstractTextureFormat::R32F,
+                    AbstractTextureFlag_RenderTarget, AbstractTextureType::Texture_2DArray),
+      "Temporal upscaling depth texture");
+  if (!m_depth_texture)
+    return false;
+
+  m_depth_framebuffer = g_gfx->CreateFramebuffer(m_depth_texture.get(), nullptr);
+  if (!m_depth_framebuffer)
+  {
+    m_depth_texture.reset();
+    return false;
+  }
+
+  return true;
+}
+
+bool TemporalUpscaler::CreateHistoryTextures(u32 width, u32 height)
+{
+  if (m_history_textures[0] && m_history_textures[0]->GetWidth() == width &&
+      m_history_textures[0]->GetHeight() == height)
+  {
+    return true;
+  }
+
+  m_history_valid = false;
+  for (u32 i = 0; i < m_history_textures.size(); i++)
+  {
+    m_history_framebuffers[i].reset();
+    m_history_textures[i] = g_gfx->CreateTexture(
+        TextureConfig(width, height, 1, 1, 1, HISTORY_FORMAT, AbstractTextureFlag_RenderTarget,
+                      AbstractTextureType::Texture_2DArray),
+        "Temporal upscaling history texture");
+    if (m_history_textures[i])
+      m_history_framebuffers[i] = g_gfx->CreateFramebuffer(m_history_textures[i].get(), nullptr);
+
+    if (!m_history_framebuffers[i])
+    {
+      m_history_textures = {};
+      m_history_framebuffers = {};
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void TemporalUpscaler::SetJitter(const std::array<float, 2>& jitter)
+{
+  m_jitter = jitter;
+  Core::System::GetInstance().GetVertexShaderManager().SetProjectionJitter(jitter[0], jitter[1]);
+}
+
+void TemporalUpscaler::OnXFBCopy(u64 xfb_id, const AbstractTexture* xfb_texture,
+                                 const MathUtil::Rectangle<int>& efb_rect)
+{
+  if (!IsActive())
+  {
+    m_capture = {};
+    if (m_jitter[0] != 0.0f || m_jitter[1] != 0.0f)
+      SetJitter({});
+    return;
+  }
+
+  const MathUtil::Rectangle<int> scaled_rect = g_framebuffer_manager->ConvertEFBRectangle(efb_rect);
+  if (static_cast<u32>(scaled_rect.GetWidth()) != xfb_texture->GetWidth() ||
+      static_cast<u32>(scaled_rect.GetHeight()) != xfb_texture->GetHeight() ||
+      !CompilePipelines() || !CreateDepthTexture(xfb_texture->GetWidth(), xfb_texture->GetHeight()))
+  {
+    m_capture = {};
+    return;
+  }
+
+  AbstractTexture* src_texture = g_framebuffer_manager->ResolveEFBDepthTexture(scaled_rect, true);
+  src_texture->FinishedRendering();
+  g_gfx->BeginUtilityDrawing();
+
+  const auto src_rect = g_gfx->ConvertFramebufferRectangle(
+      scaled_rect, g_framebuffer_manager->GetEFBFramebuffer());
+  const float rcp_src_width = 1.0f / src_texture->GetWidth();
+  const float rcp_src_height = 1.0f / src_texture->GetHeight();
+  const std::array<float, 4> uniforms = {
+      {src_rect.left * rcp_src_width, src_rect.top * rcp_src_height,
+       src_rect.GetWidth() * rcp_src_width, src_rect.GetHeight() * rcp_src_height}};
+  g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
+
+  g_gfx->SetAndDiscardFramebuffer(m_depth_framebuffer.get());
+  g_gfx->SetViewportAndScissor(m_depth_framebuffer->GetRect());
+  g_gfx->SetPipeline(m_depth_copy_pipeline.get());
+  g_gfx->SetTexture(0, src_texture);
+  g_gfx->SetSamplerState(0, RenderState::GetPointSamplerState());
+  g_gfx->Draw(0, 3);
+  m_depth_texture->FinishedRendering();
+  g_gfx->EndUtilityDrawing();
+
+  m_capture.valid = true;
+  m_capture.xfb_id = xfb_id;
+  m_capture.efb_rect = efb_rect;
+  m_capture.camera = Core::System::GetInstance().GetVertexShaderManager().GetSceneCamera();
+  m_capture.jitter = m_jitter;
+  m_capture.render_scale = g_framebuffer_manager->GetEFBScale();
+
+  // The next frame is drawn at the next position of the sequence.
+  m_frame_index = (m_frame_index + 1) % JITTER_PHASES;
+  SetJitter({Halton(m_frame_index + 1, 2) - 0.5f, Halton(m_frame_index + 1, 3) - 0.5f});
+}
+
+const AbstractTexture* TemporalUpscaler::Resolve(u64 xfb_id, const AbstractTexture* xfb_texture,
+                                                 MathUtil::Rectangle<int>* rect)
+{
+  if (!IsActive() || !m_capture.valid || m_capture.xfb_id != xfb_id ||
+      m_capture.render_scale != g_framebuffer_manager->GetEFBScale() ||
+      m_depth_texture->GetWidth() != xfb_texture->GetWidth() ||
+      m_depth_texture->GetHeight() != xfb_texture->GetHeight())
+  {
+    m_upscale_factor = 0.0f;
+    m_history_valid = false;
+    return xfb_texture;
+  }
+
+  const float factor = static_cast<float>(g_framebuffer_manager->GetTargetEFBScale()) /
+                       static_cast<float>(m_capture.render_scale);
+  const auto scale_rect = [factor](MathUtil::Rectangle<int>* r) {
+    r->left = static_cast<int>(std::floor(r->left * factor));
+    r->top = static_cast<int>(std::floor(r->top * factor));
+    r->right = static_cast<int>(std::ceil(r->right * factor));
+    r->bottom = static_cast<int>(std::ceil(r->bottom * factor));
+  };
+
+  // Presenting the same XFB again, e.g. while paused, reuses the reconstruction.
+  if (m_resolved_xfb_id == xfb_id && m_history_valid)
+  {
+    scale_rect(rect);
+    return m_history_textures[m_history_index].get();
+  }
+
+  const u32 width = static_cast<u32>(std::ceil(xfb_texture->GetWidth() * factor));
+  const u32 height = static_cast<u32>(std::ceil(xfb_texture->GetHeight() * factor));
+  if (!CreateHistoryTextures(width, height))
+  {
+    m_upscale_factor = 0.0f;
+    return xfb_texture;
+  }
+
+  struct Uniforms
+  {
+    std::array<float, 16> reprojection;
+    std::array<float, 4> render_size;
+    std::array<float, 4> viewport;
+    std::array<float, 4> prev_viewport;
+    std::array<float, 2> jitter;
+    std::array<float, 2> depth_transform;
+    float history_valid;
+    std::array<float, 3> padding;
+  };
+  Uniforms uniforms = {};
+
+  const float render_width = static_cast<float>(xfb_texture->GetWidth());
+  const float render_height = static_cast<float>(xfb_texture->GetHeight());
+  uniforms.render_size = {render_width, render_height, 1.0f / render_width, 1.0f / render_height};
+  uniforms.jitter = m_capture.jitter;
+
+  // Viewports are converted to pixels of the rendered frame. The previous frame's history covers
+  // the same EFB rectangle, otherwise it isn't used.
+  const float scale = static_cast<float>(m_capture.render_scale);
+  const auto convert_viewport = [this, scale](const VertexShaderManager::SceneCamera& camera) {
+    return std::array<float, 4>{(camera.viewport[0] - m_capture.efb_rect.left) * scale,
+                                (camera.viewport[1] - m_capture.efb_rect.top) * scale,
+                                camera.viewport[2] * scale, camera.viewport[3] * scale};
+  };
+
+  const VertexShaderManager::SceneCamera& camera = m_capture.camera;
+  const bool can_reproject = m_history_valid && camera.valid && m_history_camera.valid &&
+                             camera.z_range != 0.0f && camera.viewport[2] != 0.0f &&
+                             camera.viewport[3] != 0.0f;
+  if (can_reproject)
+  {
+    const Common::Matrix44 reprojection =
+        m_history_camera.projection * camera.projection.Inverted();
+    uniforms.reprojection = reprojection.data;
+    uniforms.viewport = convert_viewport(camera);
+    uniforms.prev_viewport = convert_viewport(m_history_camera);
+    uniforms.depth_transform = {16777216.0f / camera.z_range, -camera.far_z / camera.z_range};
+    uniforms.history_valid = 1.0f;
+  }
+
+  const u32 prev_index = m_history_index;
+  m_history_index ^= 1;
+
+  g_gfx->BeginUtilityDrawing();
+  g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
+  g_gfx->SetAndDiscardFramebuffer(m_history_framebuffers[m_history_index].get());
+  g_gfx->SetViewportAndScissor(m_history_framebuffers[m_history_index]->GetRect());
+  g_gfx->SetPipeline(m_resolve_pipeline.get());
+  g_gfx->SetTexture(0, xfb_texture);
+  g_gfx->SetSamplerState(0, RenderState::GetLinearSamplerState());
+  g_gfx->SetTexture(1, m_depth_texture.get());
+  g_gfx->SetSamplerState(1, RenderState::GetPointSamplerState());
+  g_gfx->SetTexture(2, m_history_textures[prev_index].get());
+  g_gfx->SetSamplerState(2, RenderState::GetLinearSamplerState());
+  g_gfx->Draw(0, 3);
+  m_history_textures[m_history_index]->FinishedRendering();
+  g_gfx->EndUtilityDrawing();
+
+  m_history_valid = true;
+  m_history_camera = camera;
+  m_resolved_xfb_id = xfb_id;
+  m_upscale_factor = factor;
+
+  scale_rect(rect);
+  return m_history_textures[m_history_index].get();
+}
+}  // namespace VideoCommon
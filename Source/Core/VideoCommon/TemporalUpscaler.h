@@ -0,0 +1,92 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Common/Matrix.h"
+#include "VideoCommon/VertexShaderManager.h"
+
+class AbstractFramebuffer;
+class AbstractPipeline;
+class AbstractShader;
+class AbstractTexture;
+
+namespace VideoCommon
+{
+// Temporal upscaling renders the EFB at a reduced internal resolution, and reconstructs the
+// internal resolution the user picked from several frames when presenting. 3D draws are offset by
+// a different sub-pixel jitter every frame, and each frame is blended into a history at the target
+// resolution. The history is reprojected with the EFB depth the XFB was copied with and the scene
+// camera tracked by VertexShaderManager, then clamped to the current frame's neighborhood, which
+// rejects the motion that the camera doesn't explain.
+class TemporalUpscaler
+{
+public:
+  TemporalUpscaler();
+  ~TemporalUpscaler();
+
+  // Whether the EFB should be rendered at a reduced scale with the current config.
+  static bool IsEnabled();
+
+  // The scale the EFB is rendered at when reconstructing the given target scale.
+  static u32 GetRenderScale(u32 target_scale);
+
+  // Snapshots the EFB depth and camera for an XFB copy of efb_rect (native EFB coordinates), and
+  // moves the jitter on to the next frame.
+  void OnXFBCopy(u64 xfb_id, const AbstractTexture* xfb_texture,
+                 const MathUtil::Rectangle<int>& efb_rect);
+
+  // Reconstructs the XFB at the target resolution, and scales rect to match the returned texture.
+  // Returns xfb_texture untouched if the XFB can't be reconstructed, e.g. if it was stitched
+  // together from several copies.
+  const AbstractTexture* Resolve(u64 xfb_id, const AbstractTexture* xfb_texture,
+                                 MathUtil::Rectangle<int>* rect);
+
+  // Reconstructed pixels per rendered pixel in each direction, or 0 if the last presented frame
+  // wasn't reconstructed.
+  float GetUpscaleFactor() const { return m_upscale_factor; }
+
+private:
+  struct Capture
+  {
+    bool valid = false;
+    u64 xfb_id = 0;
+    MathUtil::Rectangle<int> efb_rect;
+    VertexShaderManager::SceneCamera camera;
+    std::array<float, 2> jitter{};
+    u32 render_scale = 0;
+  };
+
+  bool IsActive() const;
+  bool CompilePipelines();
+  bool CreateDepthTexture(u32 width, u32 height);
+  bool CreateHistoryTextures(u32 width, u32 height);
+  void SetJitter(const std::array<float, 2>& jitter);
+
+  std::unique_ptr<AbstractShader> m_resolve_pixel_shader;
+  std::unique_ptr<AbstractPipeline> m_resolve_pipeline;
+  std::unique_ptr<AbstractPipeline> m_depth_copy_pipeline;
+
+  std::unique_ptr<AbstractTexture> m_depth_texture;
+  std::unique_ptr<AbstractFramebuffer> m_depth_framebuffer;
+
+  // The history is double buffered, the previous frame is read while the next is written.
+  std::array<std::unique_ptr<AbstractTexture>, 2> m_history_textures;
+  std::array<std::unique_ptr<AbstractFramebuffer>, 2> m_history_framebuffers;
+  u32 m_history_index = 0;
+  bool m_history_valid = false;
+
+  Capture m_capture;
+  VertexShaderManager::SceneCamera m_history_camera;
+  u64 m_resolved_xfb_id = 0;
+  float m_upscale_factor = 0.0f;
+
+  u32 m_frame_index = 0;
+  std::array<float, 2> m_jitter{};
+};
+}  // namespace VideoCommon
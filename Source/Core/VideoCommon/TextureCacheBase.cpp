@@ -22,6 +22,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
+#include "Common/Instrumentation.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/MemoryUtil.h"
@@ -39,16 +40,20 @@
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTiming.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/FBInfo.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/HiresTextures.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/PostProcessing.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/ShaderCache.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/StutterTracker.h"
 #include "VideoCommon/TMEM.h"
+#include "VideoCommon/TemporalUpscaler.h"
 #include "VideoCommon/TextureConversionShader.h"
 #include "VideoCommon/TextureConverterShaderGen.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -139,10 +144,15 @@ void TextureCacheBase::Invalidate()
 
   for (auto& bind : m_bound_textures)
     bind.reset();
+  m_efb_copy_chain_source = {};
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
+  m_texture_sizes_by_address.clear();
+  m_watched_hashes.clear();
 
   m_texture_pool.clear();
+  m_texture_pool_bytes = 0;
+  g_stats.bytes_texture_pool = 0;
 }
 
 void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
@@ -176,6 +186,15 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
 void TextureCacheBase::Cleanup(int _frameCount)
 {
+  if (!m_watched_hashes.empty())
+  {
+    auto& memory = Core::System::GetInstance().GetMemory();
+    std::erase_if(m_watched_hashes, [&memory](const auto& watched) {
+      return memory.WasWrittenSince(watched.first, watched.second.size,
+                                    watched.second.write_watch_token);
+    });
+  }
+
   TexAddrCache::iterator iter = m_textures_by_address.begin();
   TexAddrCache::iterator tcend = m_textures_by_address.end();
   while (iter != tcend)
@@ -224,13 +243,36 @@ void TextureCacheBase::Cleanup(int _frameCount)
     }
     if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
     {
-      iter2 = m_texture_pool.erase(iter2);
+      iter2 = RemoveTextureFromPool(iter2);
     }
     else
     {
       ++iter2;
     }
   }
+
+  // If the unused textures still take up more memory than allowed, drop the ones which were
+  // returned to the pool the longest time ago.
+  const size_t pool_budget = static_cast<size_t>(g_ActiveConfig.iTexturePoolBudgetMB) << 20;
+  if (pool_budget != 0 && m_texture_pool_bytes > pool_budget)
+  {
+    std::vector<TexPool::iterator> pool_entries;
+    pool_entries.reserve(m_texture_pool.size());
+    for (auto iter = m_texture_pool.begin(); iter != m_texture_pool.end(); ++iter)
+      pool_entries.push_back(iter);
+    std::sort(pool_entries.begin(), pool_entries.end(), [](const auto& a, const auto& b) {
+      return a->second.frameCount < b->second.frameCount;
+    });
+
+    for (const auto& pool_entry : pool_entries)
+    {
+      if (m_texture_pool_bytes <= pool_budget)
+        break;
+      RemoveTextureFromPool(pool_entry);
+    }
+  }
+
+  g_stats.bytes_texture_pool = m_texture_pool_bytes;
 }
 
 bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
@@ -348,7 +390,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddTextureByAddress(decoded_entry);
 
   return decoded_entry;
 }
@@ -394,7 +436,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddTextureByAddress(reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -431,9 +473,7 @@ void TextureCacheBase::ScaleTextureCacheEntryTo(RcTcacheEntry& entry, u32 new_wi
 
   // At this point new_texture has the old texture in it,
   // we can potentially reuse this, so let's move it back to the pool
-  auto config = new_texture->texture->GetConfig();
-  m_texture_pool.emplace(
-      config, TexPoolEntry(std::move(new_texture->texture), std::move(new_texture->framebuffer)));
+  AddTextureToPool(std::move(*new_texture));
 }
 
 bool TextureCacheBase::CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format)
@@ -748,7 +788,10 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+    {
+      ASSERT(entry->addr == addr);
+      AddTextureByAddress(entry);
+    }
   }
 
   // Fill in hash map.
@@ -1283,7 +1326,7 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
 
     // Otherwise, hash the backing memory and check it's unchanged.
     // FIXME: this doesn't correctly handle textures from tmem.
-    if (!entry->invalidated && entry->base_hash == entry->CalculateHash())
+    if (!entry->invalidated && entry->base_hash == CalculateEntryHash(*entry))
     {
       return entry;
     }
@@ -1297,11 +1340,11 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
   entry->frameCount = FRAMECOUNT_INVALID;
   if (entry->texture_info_name.empty() && g_ActiveConfig.bGraphicMods)
   {
-    entry->texture_info_name = texture_info.CalculateTextureName().GetFullName();
+    entry->SetTextureInfoName(texture_info.CalculateTextureName().GetFullName());
 
     GraphicsModActionData::TextureLoad texture_load{entry->texture_info_name};
     for (const auto& action :
-         g_graphics_mod_manager->GetTextureLoadActions(entry->texture_info_name))
+         g_graphics_mod_manager->GetTextureLoadActions(entry->texture_info_id))
     {
       action->OnTextureLoad(&texture_load);
     }
@@ -1322,6 +1365,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   if (!texture_info.IsDataValid())
     return {};
 
+  INSTRUMENT_ZONE("TextureCache::GetTexture");
+
   // Hash assigned to texcache entry (also used to generate filenames used for texture dumping and
   // custom texture lookup)
   u64 base_hash = TEXHASH_INVALID;
@@ -1352,8 +1397,16 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  if (texture_info.IsFromTmem())
+  {
+    base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
+  }
+  else
+  {
+    base_hash = HashTextureMemory(texture_info.GetRawAddress(), texture_info.GetData(),
+                                  texture_info.GetTextureSize(), textureCacheSafetyColorSampleSize);
+  }
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
@@ -1620,7 +1673,8 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
     texture_name = texture_info.CalculateTextureName().GetFullName();
     GraphicsModActionData::TextureCreate texture_create{
         texture_name, width, height, &cached_game_assets, &additional_dependencies};
-    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(texture_name))
+    const u64 texture_id = GraphicsModManager::GetTextureId(texture_name);
+    for (const auto& action : g_graphics_mod_manager->GetTextureCreateActions(texture_id))
     {
       action->OnTextureCreate(&texture_create);
     }
@@ -1645,7 +1699,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                          std::move(data_for_assets), has_arbitrary_mipmaps, skip_texture_dump);
   entry->linked_game_texture_assets = std::move(cached_game_assets);
   entry->linked_asset_dependencies = std::move(additional_dependencies);
-  entry->texture_info_name = std::move(texture_name);
+  entry->SetTextureInfoName(std::move(texture_name));
   return entry;
 }
 
@@ -1658,6 +1712,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     std::vector<std::shared_ptr<VideoCommon::TextureData>> assets_data,
     const bool custom_arbitrary_mipmaps, bool skip_texture_dump)
 {
+  StutterScope stutter_scope(StutterCause::TextureUpload, texture_info.GetTextureSize());
+
 #ifdef __APPLE__
   const bool no_mips = g_ActiveConfig.bNoMipmapping;
 #else
@@ -1716,22 +1772,30 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       return entry;
 
     // We can decode on the GPU if it is a supported format and the flag is enabled.
-    // Currently we don't decode RGBA8 textures from TMEM, as that would require copying from both
-    // banks, and if we're doing an copy we may as well just do the whole thing on the CPU, since
-    // there's no conversion between formats. In the future this could be extended with a separate
-    // shader, however.
-    const bool decode_on_gpu =
-        g_ActiveConfig.UseGPUTextureDecoding() &&
-        !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
+    const bool decode_on_gpu = g_ActiveConfig.UseGPUTextureDecoding();
+
+    // RGBA8 textures from TMEM keep their AR and GB halves in separate banks. Gathering them back
+    // into the main memory layout is only a copy, and lets the regular RGBA8 shader decode them.
+    const u8* gpu_src_data = texture_info.GetData();
+    if (decode_on_gpu && texture_info.IsFromTmem() &&
+        texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+    {
+      CheckTempSize(texture_info.GetTextureSize());
+      TexDecoder_GatherRGBA8FromTmem(m_temp, texture_info.GetData(),
+                                     texture_info.GetTmemOddAddress(), expanded_width,
+                                     expanded_height);
+      gpu_src_data = m_temp;
+    }
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
+    bool mips_decoded = false;
 
     if (!decode_on_gpu ||
         !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+            entry, 0, gpu_src_data, texture_info.GetTextureSize(),
             texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
             creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
             texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
@@ -1758,9 +1822,27 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
       dst_buffer = m_temp;
       if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
       {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
+        // Without GPU decoding, all levels are decoded on the CPU, so decode them all at once.
+        std::vector<DecodeLevel> levels{
+            {dst_buffer, texture_info.GetData(), expanded_width, expanded_height}};
+        if (!decode_on_gpu)
+        {
+          u8* level_dst = dst_buffer + decoded_texture_size;
+          for (u32 level = 1; level != texLevels; ++level)
+          {
+            const auto mip_level = texture_info.GetMipMapLevel(level - 1);
+            if (!mip_level)
+              continue;
+
+            levels.push_back({level_dst, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                              mip_level->GetExpandedHeight()});
+            level_dst += mip_level->GetExpandedWidth() * sizeof(u32) *
+                         mip_level->GetExpandedHeight();
+          }
+          mips_decoded = true;
+        }
+        DecodeTextureLevels(levels, texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
       }
       else
       {
@@ -1794,9 +1876,12 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
         const u32 decoded_mip_size =
             mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        if (!mips_decoded)
+        {
+          TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                            mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+        }
         entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
                              mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
 
@@ -1826,14 +1911,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
-  if (safety_color_sample_size == 0 ||
-      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
-          (u32)safety_color_sample_size * 8)
-  {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
-  }
-
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
                                          texture_info.GetTlutFormat());
   entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
@@ -1844,6 +1921,14 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  const auto iter = AddTextureByAddress(entry);
+  if (safety_color_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
+          (u32)safety_color_sample_size * 8)
+  {
+    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
+  }
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1926,7 +2011,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddTextureByAddress(entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1935,7 +2020,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
     const std::string id = fmt::format("{}x{}", width, height);
     if (g_ActiveConfig.bGraphicMods)
     {
-      entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+      entry->SetTextureInfoName(fmt::format("{}_{}", XFB_DUMP_PREFIX, id));
     }
 
     if (g_ActiveConfig.bDumpXFBTarget)
@@ -2031,6 +2116,8 @@ void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
 
   std::sort(candidates.begin(), candidates.end(),
             [](const TCacheEntry* a, const TCacheEntry* b) { return a->id < b->id; });
+  std::vector<XFBStitchCopy> copies;
+  copies.reserve(candidates.size());
 
   // We only upscale when necessary to preserve resolution. i.e. when there are upscaled partial
   // copies to be stitched together.
@@ -2106,30 +2193,116 @@ void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
     dstrect.top = dst_y;
     dstrect.right = (dst_x + dst_width);
     dstrect.bottom = (dst_y + dst_height);
+    copies.push_back({entry, srcrect, dstrect});
+
+    // Link the two textures together, so we won't apply this partial update again
+    entry->CreateReference(stitched_entry.get());
 
+    // Mark the texture update as used, as if it was loaded directly
+    entry->frameCount = FRAMECOUNT_INVALID;
+  }
+
+  // Every draw or copy below is a render pass of its own, which is expensive on tilers, so do
+  // all of them in one dispatch where we can.
+  if (copies.size() > 1 && StitchXFBCopiesWithCompute(stitched_entry, copies))
+    return;
+
+  for (const XFBStitchCopy& copy : copies)
+  {
     // We may have to scale if one of the copies is not internal resolution.
-    if (srcrect.GetWidth() != dstrect.GetWidth() || srcrect.GetHeight() != dstrect.GetHeight())
+    if (copy.src_rect.GetWidth() != copy.dst_rect.GetWidth() ||
+        copy.src_rect.GetHeight() != copy.dst_rect.GetHeight())
     {
-      g_gfx->ScaleTexture(stitched_entry->framebuffer.get(), dstrect, entry->texture.get(),
-                          srcrect);
+      g_gfx->ScaleTexture(stitched_entry->framebuffer.get(), copy.dst_rect,
+                          copy.entry->texture.get(), copy.src_rect);
     }
     else
     {
       // If one copy is stereo, and the other isn't... not much we can do here :/
-      const u32 layers_to_copy = std::min(entry->GetNumLayers(), stitched_entry->GetNumLayers());
+      const u32 layers_to_copy =
+          std::min(copy.entry->GetNumLayers(), stitched_entry->GetNumLayers());
       for (u32 layer = 0; layer < layers_to_copy; layer++)
       {
-        stitched_entry->texture->CopyRectangleFromTexture(entry->texture.get(), srcrect, layer, 0,
-                                                          dstrect, layer, 0);
+        stitched_entry->texture->CopyRectangleFromTexture(
+            copy.entry->texture.get(), copy.src_rect, layer, 0, copy.dst_rect, layer, 0);
       }
     }
+  }
+}
 
-    // Link the two textures together, so we won't apply this partial update again
-    entry->CreateReference(stitched_entry.get());
+bool TextureCacheBase::StitchXFBCopiesWithCompute(RcTcacheEntry& stitched_entry,
+                                                  std::span<const XFBStitchCopy> copies)
+{
+  using TextureConversionShaderTiled::XFB_STITCH_GROUP_SIZE;
+  using TextureConversionShaderTiled::XFB_STITCH_MAX_SOURCES;
 
-    // Mark the texture update as used, as if it was loaded directly
-    entry->frameCount = FRAMECOUNT_INVALID;
+  const AbstractShader* shader = g_shader_cache->GetXFBStitchingShader();
+  if (!shader)
+    return false;
+
+  // XFB textures aren't compute images, so stitch into a temporary image and copy the result back
+  // once per layer.
+  const TextureConfig& config = stitched_entry->texture->GetConfig();
+  std::optional<TexPoolEntry> output = AllocateTexture(
+      TextureConfig(config.width, config.height, 1, config.layers, 1, AbstractTextureFormat::RGBA8,
+                    AbstractTextureFlag_ComputeImage, AbstractTextureType::Texture_2DArray));
+  if (!output)
+    return false;
+
+  struct Uniforms
+  {
+    std::array<std::array<s32, 4>, XFB_STITCH_MAX_SOURCES> dst_rect;
+    std::array<std::array<float, 4>, XFB_STITCH_MAX_SOURCES> src_rect;
+    std::array<std::array<s32, 4>, XFB_STITCH_MAX_SOURCES> src_layers;
+    s32 dst_width, dst_height;
+    s32 padding[2];
+  };
+
+  const u32 groups_x = (config.width + (XFB_STITCH_GROUP_SIZE - 1)) / XFB_STITCH_GROUP_SIZE;
+  const u32 groups_y = (config.height + (XFB_STITCH_GROUP_SIZE - 1)) / XFB_STITCH_GROUP_SIZE;
+  const MathUtil::Rectangle<int> rect = config.GetRect();
+  for (size_t first = 0; first < copies.size(); first += XFB_STITCH_MAX_SOURCES)
+  {
+    const size_t count = std::min<size_t>(copies.size() - first, XFB_STITCH_MAX_SOURCES);
+    Uniforms uniforms = {};
+    uniforms.dst_width = static_cast<s32>(config.width);
+    uniforms.dst_height = static_cast<s32>(config.height);
+    for (size_t i = 0; i < count; i++)
+    {
+      const XFBStitchCopy& copy = copies[first + i];
+      const AbstractTexture* src_texture = copy.entry->texture.get();
+      const float rcp_src_width = 1.0f / static_cast<float>(src_texture->GetWidth());
+      const float rcp_src_height = 1.0f / static_cast<float>(src_texture->GetHeight());
+      uniforms.dst_rect[i] = {copy.dst_rect.left, copy.dst_rect.top, copy.dst_rect.right,
+                              copy.dst_rect.bottom};
+      uniforms.src_rect[i] = {copy.src_rect.left * rcp_src_width,
+                              copy.src_rect.top * rcp_src_height,
+                              copy.src_rect.right * rcp_src_width,
+                              copy.src_rect.bottom * rcp_src_height};
+      uniforms.src_layers[i] = {static_cast<s32>(src_texture->GetLayers()), 0, 0, 0};
+
+      // Sizes only differ when a copy isn't at internal resolution, which needs filtering.
+      g_gfx->SetTexture(static_cast<u32>(i + 1), src_texture);
+      g_gfx->SetSamplerState(static_cast<u32>(i + 1), RenderState::GetLinearSamplerState());
+    }
+
+    g_gfx->SetTexture(0, stitched_entry->texture.get());
+    g_gfx->SetSamplerState(0, RenderState::GetPointSamplerState());
+    g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
+    g_gfx->SetComputeImageTexture(0, output->texture.get(), false, true);
+    g_gfx->DispatchComputeShader(shader, XFB_STITCH_GROUP_SIZE, XFB_STITCH_GROUP_SIZE, 1, groups_x,
+                                 groups_y, config.layers);
+
+    for (u32 layer = 0; layer < config.layers; layer++)
+    {
+      stitched_entry->texture->CopyRectangleFromTexture(output->texture.get(), rect, layer, 0,
+                                                        rect, layer, 0);
+    }
   }
+
+  g_gfx->SetComputeImageTexture(0, nullptr, false, false);
+  AddTextureToPool(std::move(*output));
+  return true;
 }
 
 std::array<u32, 3>
@@ -2242,6 +2415,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // Disadvantage of all methods: Calling this function requires the GPU to perform a pipeline flush
   // which stalls any further CPU processing.
   const bool is_xfb_copy = !is_depth_copy && !isIntensity && dstFormat == EFBCopyFormat::XFB;
+  GPUPassScope pass_scope(is_xfb_copy ? GPUPass::XFBCopy : GPUPass::EFBCopy);
+
   bool copy_to_vram =
       g_ActiveConfig.backend_info.bSupportsCopyToVram && !g_ActiveConfig.bDisableCopyToVRAM;
   bool copy_to_ram =
@@ -2265,7 +2440,11 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     scaled_tex_h /= 2;
   }
 
-  if (!is_xfb_copy && !g_ActiveConfig.bCopyEFBScaled)
+  // Tiny copies are mostly blurred effect buffers, which gain nothing from being upscaled.
+  constexpr u32 MAX_NATIVE_RES_SMALL_EFB_COPY_PIXELS = 128 * 128;
+  const bool native_res_copy = g_ActiveConfig.bNativeResSmallEFBCopies &&
+                               tex_w * tex_h <= MAX_NATIVE_RES_SMALL_EFB_COPY_PIXELS;
+  if (!is_xfb_copy && (!g_ActiveConfig.bCopyEFBScaled || native_res_copy))
   {
     // No upscaling
     scaled_tex_w = tex_w;
@@ -2381,12 +2560,19 @@ void TextureCacheBase::CopyRenderTargetToTexture(
                           isIntensity, gamma, clamp_top, clamp_bottom,
                           GetVRAMCopyFilterCoefficients(filter_coefficients));
 
+      // Temporal upscaling needs the depth the XFB was copied with.
+      if (is_xfb_copy && !scaleByHalf && g_presenter->GetPostProcessor())
+      {
+        g_presenter->GetPostProcessor()->GetTemporalUpscaler()->OnXFBCopy(
+            entry->id, entry->texture.get(), srcRect);
+      }
+
       if (is_xfb_copy && (g_ActiveConfig.bDumpXFBTarget || g_ActiveConfig.bGraphicMods))
       {
         const std::string id = fmt::format("{}x{}", tex_w, tex_h);
         if (g_ActiveConfig.bGraphicMods)
         {
-          entry->texture_info_name = fmt::format("{}_{}", XFB_DUMP_PREFIX, id);
+          entry->SetTextureInfoName(fmt::format("{}_{}", XFB_DUMP_PREFIX, id));
         }
 
         if (g_ActiveConfig.bDumpXFBTarget)
@@ -2402,7 +2588,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         const std::string id = fmt::format("{}x{}_{}", tex_w, tex_h, static_cast<int>(baseFormat));
         if (g_ActiveConfig.bGraphicMods)
         {
-          entry->texture_info_name = fmt::format("{}_{}", EFB_DUMP_PREFIX, id);
+          entry->SetTextureInfoName(fmt::format("{}_{}", EFB_DUMP_PREFIX, id));
         }
 
         if (g_ActiveConfig.bDumpEFBTarget)
@@ -2425,23 +2611,35 @@ void TextureCacheBase::CopyRenderTargetToTexture(
                          AllCopyFilterCoefsNeeded(coefficients),
                          CopyFilterCanOverflow(coefficients), gamma != 1.0);
 
-    std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
-    if (staging_texture)
+    // We can't defer if there is no VRAM copy (since we need to update the hash).
+    if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
     {
-      CopyEFB(staging_texture.get(), format, tex_w, bytes_per_row, num_blocks_y, dstStride, srcRect,
-              scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom, coefficients);
-
-      // We can't defer if there is no VRAM copy (since we need to update the hash).
-      if (!copy_to_vram || !g_ActiveConfig.bDeferEFBCopies)
+      std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
+      if (staging_texture)
       {
+        CopyEFB(staging_texture.get(), 0, format, tex_w, bytes_per_row, num_blocks_y, dstStride,
+                srcRect, scaleByHalf, linear_filter, y_scale, gamma, clamp_top, clamp_bottom,
+                coefficients);
+
         // Immediately flush it.
         WriteEFBCopyToRAM(dst, bytes_per_row / sizeof(u32), num_blocks_y, dstStride,
                           std::move(staging_texture));
       }
-      else
+    }
+    else
+    {
+      u32 staging_row;
+      AbstractStagingTexture* staging_texture =
+          AllocatePendingEFBCopyRows(num_blocks_y, &staging_row);
+      if (staging_texture)
       {
+        CopyEFB(staging_texture, staging_row, format, tex_w, bytes_per_row, num_blocks_y,
+                dstStride, srcRect, scaleByHalf, linear_filter, y_scale, gamma, clamp_top,
+                clamp_bottom, coefficients);
+
         // Defer the flush until later.
-        entry->pending_efb_copy = std::move(staging_texture);
+        entry->pending_efb_copy = staging_texture;
+        entry->pending_efb_copy_row = staging_row;
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
         m_pending_efb_copies.push_back(entry);
@@ -2460,6 +2658,9 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     }
   }
 
+  // The memory may have been write watched by the texture cache itself.
+  memory.NotifyWrite(dstAddr, covered_range);
+
   // Invalidate all textures, if they are either fully overwritten by our efb copy, or if they
   // have a different stride than our efb copy. Partly overwritten textures with the same stride
   // as our efb copy are marked to check them for partial texture updates.
@@ -2541,18 +2742,22 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddTextureByAddress(std::move(entry));
   }
 }
 
 void TextureCacheBase::FlushEFBCopies()
 {
-  if (m_pending_efb_copies.empty())
-    return;
-
+  // The pending copies share a handful of staging textures, so this waits for the GPU once per
+  // staging texture rather than once per copy.
   for (auto& entry : m_pending_efb_copies)
     FlushEFBCopy(entry.get());
   m_pending_efb_copies.clear();
+
+  for (auto& staging_texture : m_pending_efb_copy_staging_textures)
+    ReleaseEFBCopyStagingTexture(std::move(staging_texture));
+  m_pending_efb_copy_staging_textures.clear();
+  m_pending_efb_copy_staging_row = 0;
 }
 
 void TextureCacheBase::FlushStaleBinds()
@@ -2580,8 +2785,13 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   u8* const dst = memory.GetPointerForRange(entry->addr, covered_range);
-  WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
-                    entry->memory_stride, std::move(entry->pending_efb_copy));
+  const MathUtil::Rectangle<int> copy_rect(
+      0, static_cast<int>(entry->pending_efb_copy_row),
+      static_cast<int>(entry->pending_efb_copy_width),
+      static_cast<int>(entry->pending_efb_copy_row + entry->pending_efb_copy_height));
+  entry->pending_efb_copy->ReadTexels(copy_rect, dst, entry->memory_stride);
+  entry->pending_efb_copy = nullptr;
+  memory.NotifyWrite(entry->addr, covered_range);
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), we don't
   // need to do anything more. The entry will be automatically deleted by smart pointers
@@ -2611,6 +2821,25 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   }
 }
 
+AbstractStagingTexture* TextureCacheBase::AllocatePendingEFBCopyRows(u32 num_rows, u32* first_row)
+{
+  if (m_pending_efb_copy_staging_textures.empty() ||
+      m_pending_efb_copy_staging_row + num_rows >
+          m_pending_efb_copy_staging_textures.back()->GetConfig().height)
+  {
+    std::unique_ptr<AbstractStagingTexture> staging_texture = GetEFBCopyStagingTexture();
+    if (!staging_texture)
+      return nullptr;
+
+    m_pending_efb_copy_staging_textures.push_back(std::move(staging_texture));
+    m_pending_efb_copy_staging_row = 0;
+  }
+
+  *first_row = m_pending_efb_copy_staging_row;
+  m_pending_efb_copy_staging_row += num_rows;
+  return m_pending_efb_copy_staging_textures.back().get();
+}
+
 std::unique_ptr<AbstractStagingTexture> TextureCacheBase::GetEFBCopyStagingTexture()
 {
   // Pull off the back first to re-use the most frequently used textures.
@@ -2634,6 +2863,91 @@ void TextureCacheBase::ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStag
   m_efb_copy_staging_texture_pool.push_back(std::move(tex));
 }
 
+u64 TextureCacheBase::HashTextureMemory(u32 address, const u8* data, u32 size, int sample_size)
+{
+  if (!g_ActiveConfig.bTextureWriteWatch)
+    return Common::GetHash64(data, size, sample_size);
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  const auto iter = m_watched_hashes.find(address);
+  if (iter != m_watched_hashes.end() && iter->second.size == size &&
+      iter->second.sample_size == sample_size &&
+      !memory.WasWrittenSince(address, size, iter->second.write_watch_token))
+  {
+    return iter->second.hash;
+  }
+
+  // Start watching before hashing, so that writes racing with the hashing aren't missed.
+  const u64 token = memory.WatchWrites(address, size);
+  const u64 hash = Common::GetHash64(data, size, sample_size);
+  if (token != 0)
+    m_watched_hashes[address] = {size, sample_size, hash, token};
+  else if (iter != m_watched_hashes.end())
+    m_watched_hashes.erase(iter);
+  return hash;
+}
+
+u64 TextureCacheBase::CalculateEntryHash(const TCacheEntry& entry)
+{
+  if (entry.IsCopy() || entry.memory_stride != entry.BytesPerRow())
+    return entry.CalculateHash();
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  return HashTextureMemory(entry.addr, memory.GetPointerForRange(entry.addr, entry.size_in_bytes),
+                           entry.size_in_bytes, entry.HashSampleSize());
+}
+
+void TextureCacheBase::DecodeTextureLevels(std::span<const DecodeLevel> levels,
+                                           TextureFormat format, const u8* tlut,
+                                           TLUTFormat tlut_format)
+{
+  constexpr u32 MAX_WORKER_THREADS = 16;
+  // Smaller strips take about as long to decode as it takes to hand them to a worker.
+  constexpr u32 MIN_TEXELS_PER_TASK = 0x10000;
+
+  const u32 num_threads =
+      std::min(static_cast<u32>(std::max(g_ActiveConfig.iTextureDecodingThreads, 0)),
+               MAX_WORKER_THREADS);
+  if (m_decode_thread_pool.GetNumThreads() != num_threads) [[unlikely]]
+    m_decode_thread_pool.Start(num_threads);
+
+  u64 total_texels = 0;
+  for (const DecodeLevel& level : levels)
+    total_texels += u64{level.width} * level.height;
+
+  if (num_threads == 0 || total_texels < 2 * MIN_TEXELS_PER_TASK)
+  {
+    for (const DecodeLevel& level : levels)
+      TexDecoder_Decode(level.dst, level.src, level.width, level.height, format, tlut, tlut_format);
+    return;
+  }
+
+  struct DecodeTask
+  {
+    const DecodeLevel* level;
+    u32 first_row;
+    u32 num_rows;
+  };
+  std::vector<DecodeTask> tasks;
+  const u32 block_height = TexDecoder_GetBlockHeightInTexels(format);
+  for (const DecodeLevel& level : levels)
+  {
+    const u32 rows_per_task =
+        std::max(MIN_TEXELS_PER_TASK / (level.width * block_height), 1u) * block_height;
+    for (u32 row = 0; row < level.height; row += rows_per_task)
+      tasks.push_back({&level, row, std::min(rows_per_task, level.height - row)});
+  }
+
+  m_decode_thread_pool.Run(tasks.size(), [&](size_t index) {
+    const DecodeTask& task = tasks[index];
+    TexDecoder_DecodeRows(task.level->dst, task.level->src, task.level->width, task.first_row,
+                          task.num_rows, format, tlut, tlut_format);
+  });
+
+  for (const DecodeLevel& level : levels)
+    TexDecoder_DrawOverlay(level.dst, level.width, level.height, format);
+}
+
 void TextureCacheBase::UninitializeEFBMemory(u8* dst, u32 stride, u32 bytes_per_row,
                                              u32 num_blocks_y)
 {
@@ -2709,10 +3023,12 @@ TextureCacheBase::AllocateTexture(const TextureConfig& config)
   TexPool::iterator iter = FindMatchingTextureFromPool(config);
   if (iter != m_texture_pool.end())
   {
+    INCSTAT(g_stats.this_frame.num_texture_pool_hits);
     auto entry = std::move(iter->second);
-    m_texture_pool.erase(iter);
+    RemoveTextureFromPool(iter);
     return std::move(entry);
   }
+  INCSTAT(g_stats.this_frame.num_texture_pool_misses);
 
   std::unique_ptr<AbstractTexture> texture = g_gfx->CreateTexture(config);
   if (!texture)
@@ -2768,16 +3084,22 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddTextureByAddress(RcTcacheEntry entry)
+{
+  m_texture_sizes_by_address.insert(entry->size_in_bytes);
+  const u32 addr = entry->addr;
+  return m_textures_by_address.emplace(addr, std::move(entry));
+}
+
 std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
 TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
 {
   // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
+  // which end after the given addr. But no texture in the cache is larger than the largest
+  // size we have recorded, so we look for all textures which have a start address bigger than
+  // addr minus that size. But this yields false-positives which must be checked later on.
+  const u32 max_texture_size =
+      m_texture_sizes_by_address.empty() ? 0 : *m_texture_sizes_by_address.rbegin();
   u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
   auto begin = m_textures_by_address.lower_bound(lower_addr);
   auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
@@ -2813,8 +3135,9 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
       // If the RAM copy is being completely overwritten by a new EFB copy, we can discard the
       // existing pending copy, and not bother waiting for it in the future. This happens in
       // Xenoblade's sunset scene, where 35 copies are done per frame, and 25 of them are
-      // copied to the same address, and can be skipped.
-      ReleaseEFBCopyStagingTexture(std::move(entry->pending_efb_copy));
+      // copied to the same address, and can be skipped. Its rows in the staging texture are
+      // simply left unused until the next flush.
+      entry->pending_efb_copy = nullptr;
       auto pending_it = std::find(m_pending_efb_copies.begin(), m_pending_efb_copies.end(), entry);
       if (pending_it != m_pending_efb_copies.end())
         m_pending_efb_copies.erase(pending_it);
@@ -2829,6 +3152,10 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   }
   entry->invalidated = true;
 
+  const auto size_iter = m_texture_sizes_by_address.find(entry->size_in_bytes);
+  if (size_iter != m_texture_sizes_by_address.end())
+    m_texture_sizes_by_address.erase(size_iter);
+
   return m_textures_by_address.erase(iter);
 }
 
@@ -2836,9 +3163,21 @@ void TextureCacheBase::ReleaseToPool(TCacheEntry* entry)
 {
   if (!entry->texture)
     return;
-  auto config = entry->texture->GetConfig();
-  m_texture_pool.emplace(config,
-                         TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
+  AddTextureToPool(TexPoolEntry(std::move(entry->texture), std::move(entry->framebuffer)));
+}
+
+void TextureCacheBase::AddTextureToPool(TexPoolEntry entry)
+{
+  const TextureConfig config = entry.texture->GetConfig();
+  m_texture_pool_bytes += config.GetSizeInBytes();
+  m_texture_pool.emplace(config, std::move(entry));
+}
+
+TextureCacheBase::TexPool::iterator
+TextureCacheBase::RemoveTextureFromPool(TexPool::iterator iter)
+{
+  m_texture_pool_bytes -= iter->first.GetSizeInBytes();
+  return m_texture_pool.erase(iter);
 }
 
 bool TextureCacheBase::CreateUtilityTextures()
@@ -2891,9 +3230,30 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   const auto scaled_src_rect = g_framebuffer_manager->ConvertEFBRectangle(src_rect);
   const auto framebuffer_rect = g_gfx->ConvertFramebufferRectangle(
       scaled_src_rect, g_framebuffer_manager->GetEFBFramebuffer());
-  AbstractTexture* src_texture =
-      is_depth_copy ? g_framebuffer_manager->ResolveEFBDepthTexture(framebuffer_rect) :
-                      g_framebuffer_manager->ResolveEFBColorTexture(framebuffer_rect);
+
+  // Only a copy that isn't larger can sample the previous copy, and the copy filter must not need
+  // the rows outside of the region, which the previous copy doesn't have.
+  const u64 efb_content_version = g_framebuffer_manager->GetEFBContentVersion();
+  if (m_efb_copy_chain_source.efb_content_version != efb_content_version)
+    m_efb_copy_chain_source = {};
+  const TCacheEntry* chain_source = m_efb_copy_chain_source.entry.get();
+  if (chain_source &&
+      (!g_ActiveConfig.bEFBCopyChains || is_depth_copy ||
+       m_efb_copy_chain_source.src_rect != src_rect ||
+       chain_source->GetWidth() < entry->GetWidth() ||
+       chain_source->GetHeight() < entry->GetHeight() ||
+       (AllCopyFilterCoefsNeeded(filter_coefficients) && (!clamp_top || !clamp_bottom))))
+  {
+    chain_source = nullptr;
+  }
+
+  AbstractTexture* src_texture;
+  if (chain_source)
+    src_texture = chain_source->texture.get();
+  else if (is_depth_copy)
+    src_texture = g_framebuffer_manager->ResolveEFBDepthTexture(framebuffer_rect);
+  else
+    src_texture = g_framebuffer_manager->ResolveEFBColorTexture(framebuffer_rect);
 
   src_texture->FinishedRendering();
   g_gfx->BeginUtilityDrawing();
@@ -2928,8 +3288,24 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   uniforms.clamp_top = (static_cast<float>(top_coord) + .5f) * rcp_efb_height;
   const u32 bottom_coord = (clamp_bottom ? framebuffer_rect.bottom : efb_height) - 1;
   uniforms.clamp_bottom = (static_cast<float>(bottom_coord) + .5f) * rcp_efb_height;
-  uniforms.pixel_height = g_ActiveConfig.bCopyEFBScaled ? rcp_efb_height : 1.0f / EFB_HEIGHT;
+  // Copies that are kept at native resolution step one native row at a time.
+  const bool is_scaled_copy =
+      g_ActiveConfig.bCopyEFBScaled && entry->GetHeight() != entry->native_height;
+  uniforms.pixel_height = is_scaled_copy ? rcp_efb_height : 1.0f / EFB_HEIGHT;
   uniforms.padding = 0;
+  if (chain_source)
+  {
+    // The previous copy covers exactly the source region.
+    const float rcp_source_height = 1.0f / static_cast<float>(chain_source->GetHeight());
+    uniforms.src_left = 0.0f;
+    uniforms.src_top = 0.0f;
+    uniforms.src_width = 1.0f;
+    uniforms.src_height = 1.0f;
+    uniforms.clamp_top = 0.5f * rcp_source_height;
+    uniforms.clamp_bottom = 1.0f - 0.5f * rcp_source_height;
+    uniforms.pixel_height *=
+        static_cast<float>(efb_height) / static_cast<float>(framebuffer_rect.GetHeight());
+  }
   g_vertex_manager->UploadUtilityUniforms(&uniforms, sizeof(uniforms));
 
   // Use the copy pipeline to render the VRAM copy.
@@ -2942,11 +3318,19 @@ void TextureCacheBase::CopyEFBToCacheEntry(RcTcacheEntry& entry, bool is_depth_c
   g_gfx->Draw(0, 3);
   g_gfx->EndUtilityDrawing();
   entry->texture->FinishedRendering();
+
+  // Copies that changed the colors can't stand in for the EFB.
+  const bool is_unmodified_copy = !is_depth_copy && !is_intensity &&
+                                  dst_format == EFBCopyFormat::RGBA8 && gamma == 1.0f &&
+                                  filter_coefficients == std::array<u32, 3>{0, 64, 0};
+  if (g_ActiveConfig.bEFBCopyChains && is_unmodified_copy)
+    m_efb_copy_chain_source = {entry, src_rect, efb_content_version};
 }
 
-void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params,
-                               u32 native_width, u32 bytes_per_row, u32 num_blocks_y,
-                               u32 memory_stride, const MathUtil::Rectangle<int>& src_rect,
+void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, u32 dst_row,
+                               const EFBCopyParams& params, u32 native_width, u32 bytes_per_row,
+                               u32 num_blocks_y, u32 memory_stride,
+                               const MathUtil::Rectangle<int>& src_rect,
                                bool scale_by_half, bool linear_filter, float y_scale, float gamma,
                                bool clamp_top, bool clamp_bottom,
                                const std::array<u32, 3>& filter_coefficients)
@@ -3017,7 +3401,8 @@ void TextureCacheBase::CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams&
   g_gfx->SetSamplerState(0, linear_filter ? RenderState::GetLinearSamplerState() :
                                             RenderState::GetPointSamplerState());
   g_gfx->Draw(0, 3);
-  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, encode_rect);
+  const auto dst_rect = MathUtil::Rectangle<int>(0, dst_row, render_width, dst_row + render_height);
+  dst->CopyFromTexture(m_efb_encoding_texture.get(), encode_rect, 0, 0, dst_rect);
   g_gfx->EndUtilityDrawing();
 
   // Flush if there's sufficient draws between this copy and the last.
@@ -3145,6 +3530,12 @@ void TCacheEntry::SetNotCopy()
   is_xfb_container = false;
 }
 
+void TCacheEntry::SetTextureInfoName(std::string name)
+{
+  texture_info_id = GraphicsModManager::GetTextureId(name);
+  texture_info_name = std::move(name);
+}
+
 int TCacheEntry::HashSampleSize() const
 {
   if (should_force_safe_hashing)
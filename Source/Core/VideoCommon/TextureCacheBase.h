@@ -9,6 +9,8 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -29,6 +31,7 @@
 #include "VideoCommon/TextureInfo.h"
 #include "VideoCommon/TextureUtils.h"
 #include "VideoCommon/VideoEvents.h"
+#include "VideoCommon/WorkerThreadPool.h"
 
 class AbstractFramebuffer;
 class AbstractStagingTexture;
@@ -160,12 +163,17 @@ struct TCacheEntry
   //   * partially updated textures which refer to this efb copy
   std::unordered_set<TCacheEntry*> references;
 
-  // Pending EFB copy
-  std::unique_ptr<AbstractStagingTexture> pending_efb_copy;
+  // Pending EFB copy. Its texels are stored in the rows starting at pending_efb_copy_row of one of
+  // the staging textures shared by all copies pending since the last flush.
+  AbstractStagingTexture* pending_efb_copy = nullptr;
+  u32 pending_efb_copy_row = 0;
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
 
   std::string texture_info_name = "";
+  // GraphicsModManager::GetTextureId of texture_info_name, so mods can be looked up on every draw
+  // without hashing the name again
+  u64 texture_info_id = 0;
 
   std::vector<VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>> linked_game_texture_assets;
   std::vector<VideoCommon::CachedAsset<VideoCommon::CustomAsset>> linked_asset_dependencies;
@@ -219,6 +227,8 @@ struct TCacheEntry
   void SetEfbCopy(u32 stride);
   void SetNotCopy();
 
+  void SetTextureInfoName(std::string name);
+
   bool OverlapsMemoryRange(u32 range_address, u32 range_size) const;
 
   bool IsEfbCopy() const { return is_efb_copy; }
@@ -253,6 +263,14 @@ public:
     TexPoolEntry(std::unique_ptr<AbstractTexture> tex, std::unique_ptr<AbstractFramebuffer> fb);
   };
 
+  // An EFB copy to write into an XFB, with both rectangles in their texture's own scale
+  struct XFBStitchCopy
+  {
+    TCacheEntry* entry;
+    MathUtil::Rectangle<int> src_rect;
+    MathUtil::Rectangle<int> dst_rect;
+  };
+
   struct TextureCreationInfo
   {
     u64 base_hash;
@@ -319,8 +337,9 @@ protected:
                           u32 aligned_height, u32 row_stride, const u8* palette,
                           TLUTFormat palette_format);
 
-  virtual void CopyEFB(AbstractStagingTexture* dst, const EFBCopyParams& params, u32 native_width,
-                       u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
+  // Encodes an EFB copy into the rows of dst starting at dst_row.
+  virtual void CopyEFB(AbstractStagingTexture* dst, u32 dst_row, const EFBCopyParams& params,
+                       u32 native_width, u32 bytes_per_row, u32 num_blocks_y, u32 memory_stride,
                        const MathUtil::Rectangle<int>& src_rect, bool scale_by_half,
                        bool linear_filter, float y_scale, float gamma, bool clamp_top,
                        bool clamp_bottom, const std::array<u32, 3>& filter_coefficients);
@@ -362,14 +381,21 @@ private:
   RcTcacheEntry DoPartialTextureUpdates(RcTcacheEntry& entry_to_update, const u8* palette,
                                         TLUTFormat tlutfmt);
   void StitchXFBCopy(RcTcacheEntry& entry_to_update);
+  bool StitchXFBCopiesWithCompute(RcTcacheEntry& stitched_entry,
+                                  std::span<const XFBStitchCopy> copies);
 
   void CheckTempSize(size_t required_size);
 
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
+  void AddTextureToPool(TexPoolEntry entry);
+  TexPool::iterator RemoveTextureFromPool(TexPool::iterator iter);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
+  // Inserts an entry into m_textures_by_address. Its address and size must not change afterwards.
+  TexAddrCache::iterator AddTextureByAddress(RcTcacheEntry entry);
+
   // Return all possible overlapping textures. As addr+size of the textures is not
   // indexed, this may return false positives.
   std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
@@ -379,6 +405,24 @@ private:
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
                                            bool discard_pending_efb_copy = false);
 
+  // Hashes texture data in guest RAM. If write watching is enabled, the hash of a range which
+  // hasn't been written since it was last hashed is reused.
+  u64 HashTextureMemory(u32 address, const u8* data, u32 size, int sample_size);
+  // Recalculates the hash of the memory backing a texture loaded from RAM.
+  u64 CalculateEntryHash(const TCacheEntry& entry);
+
+  struct DecodeLevel
+  {
+    u8* dst;
+    const u8* src;
+    u32 width;
+    u32 height;
+  };
+  // Decodes texture levels on the CPU. Levels with their expanded sizes are split into strips of
+  // block rows, which are decoded in parallel if there are texture decoding threads.
+  void DecodeTextureLevels(std::span<const DecodeLevel> levels, TextureFormat format,
+                           const u8* tlut, TLUTFormat tlut_format);
+
   void UninitializeEFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
   void UninitializeXFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
 
@@ -395,6 +439,9 @@ private:
 
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
+  // Reserves num_rows rows for a deferred EFB copy in the shared staging textures, so that all
+  // pending copies can be read back together. Returns null if no staging texture is available.
+  AbstractStagingTexture* AllocatePendingEFBCopyRows(u32 num_rows, u32* first_row);
 
   // Returns an EFB copy staging texture to the pool, so it can be re-used.
   void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
@@ -407,6 +454,22 @@ private:
   // but it's possible for invalidated TCache entries to live on elsewhere
   TexAddrCache m_textures_by_address;
 
+  // Sizes of all textures in m_textures_by_address, so that overlap queries only need to look
+  // back as far as the largest texture that is actually in the cache.
+  std::multiset<u32> m_texture_sizes_by_address;
+
+  // Hashes of write watched texture data, by address.
+  struct WatchedHash
+  {
+    u32 size;
+    int sample_size;
+    u64 hash;
+    u64 write_watch_token;
+  };
+  std::unordered_map<u32, WatchedHash> m_watched_hashes;
+
+  WorkerThreadPool m_decode_thread_pool{"Texture Decoder Worker"};
+
   // m_textures_by_hash is an alternative view of the texture cache
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
@@ -416,6 +479,8 @@ private:
   std::array<RcTcacheEntry, 8> m_bound_textures{};
 
   TexPool m_texture_pool;
+  // Approximate amount of memory used by the textures in m_texture_pool.
+  size_t m_texture_pool_bytes = 0;
   u64 m_last_entry_id = 0;
 
   // Backup configuration values
@@ -447,11 +512,27 @@ private:
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
+  // The last EFB copy to VRAM that holds the unmodified EFB colors of its source region. Copies of
+  // the same region made before the EFB changes again can sample it instead of the EFB, so a chain
+  // of downsampled copies becomes a pyramid instead of each copy resolving and reading the EFB.
+  struct EFBCopyChainSource
+  {
+    RcTcacheEntry entry;
+    MathUtil::Rectangle<int> src_rect;
+    u64 efb_content_version = 0;
+  };
+  EFBCopyChainSource m_efb_copy_chain_source;
+
   // List of pending EFB copies. It is important that the order is preserved for these,
   // so that overlapping textures are written to guest RAM in the order they are issued.
   // It's valid for textures to live be in here after they've been invalidated
   std::vector<RcTcacheEntry> m_pending_efb_copies;
 
+  // Staging textures holding the pending EFB copies, filled from the top down. The last one
+  // receives new copies, starting at m_pending_efb_copy_staging_row.
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_pending_efb_copy_staging_textures;
+  u32 m_pending_efb_copy_staging_row = 0;
+
   // Staging texture used for readbacks.
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
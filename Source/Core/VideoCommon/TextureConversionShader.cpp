@@ -1217,4 +1217,50 @@ float4 DecodePixel(int val)
   return ss.str();
 }
 
+std::string GenerateXFBStitchingShader(APIType api_type)
+{
+  std::ostringstream ss;
+
+  // Rectangles are left, top, right, bottom. Destination rectangles are in texels, source
+  // rectangles are normalized, since the source may be at a different scale.
+  ss << "UBO_BINDING(std140, 1) uniform UBO {\n";
+  ss << "  int4 u_dst_rect[" << XFB_STITCH_MAX_SOURCES << "];\n";
+  ss << "  float4 u_src_rect[" << XFB_STITCH_MAX_SOURCES << "];\n";
+  ss << "  int4 u_src_layers[" << XFB_STITCH_MAX_SOURCES << "];\n";
+  ss << "  int2 u_dst_size;\n";
+  ss << "};\n";
+
+  // samp0 is the XFB as it was before this dispatch, so texels no source covers are kept.
+  for (u32 i = 0; i <= XFB_STITCH_MAX_SOURCES; i++)
+    ss << "SAMPLER_BINDING(" << i << ") uniform sampler2DArray samp" << i << ";\n";
+  ss << "IMAGE_BINDING(rgba8, 0) uniform writeonly image2DArray output_image;\n";
+
+  ss << "layout(local_size_x = " << XFB_STITCH_GROUP_SIZE
+     << ", local_size_y = " << XFB_STITCH_GROUP_SIZE << ") in;\n";
+  ss << "void main() {\n";
+  ss << "  int2 coords = int2(gl_GlobalInvocationID.xy);\n";
+  ss << "  int layer = int(gl_GlobalInvocationID.z);\n";
+  ss << "  if (coords.x >= u_dst_size.x || coords.y >= u_dst_size.y)\n";
+  ss << "    return;\n";
+  ss << "  float4 color = texelFetch(samp0, int3(coords, layer), 0);\n";
+
+  // Sources are in the order they were copied, so later ones overwrite earlier ones. Unused
+  // slots have an empty destination rectangle.
+  for (u32 i = 0; i < XFB_STITCH_MAX_SOURCES; i++)
+  {
+    ss << "  if (layer < u_src_layers[" << i << "].x && all(greaterThanEqual(coords, u_dst_rect["
+       << i << "].xy)) && all(lessThan(coords, u_dst_rect[" << i << "].zw))) {\n";
+    ss << "    float2 pos = (float2(coords - u_dst_rect[" << i
+       << "].xy) + 0.5) / float2(u_dst_rect[" << i << "].zw - u_dst_rect[" << i << "].xy);\n";
+    ss << "    pos = mix(u_src_rect[" << i << "].xy, u_src_rect[" << i << "].zw, pos);\n";
+    ss << "    color = textureLod(samp" << (i + 1) << ", float3(pos, float(layer)), 0.0);\n";
+    ss << "  }\n";
+  }
+
+  ss << "  imageStore(output_image, int3(coords, layer), color);\n";
+  ss << "}\n";
+
+  return ss.str();
+}
+
 }  // namespace TextureConversionShaderTiled
@@ -48,4 +48,12 @@ std::string GenerateDecodingShader(TextureFormat format, std::optional<TLUTForma
 // Returns the GLSL string containing the palette conversion shader for the specified format.
 std::string GeneratePaletteConversionShader(TLUTFormat palette_format, APIType api_type);
 
+// Number of EFB copies the XFB stitching shader can read in a single dispatch. The XFB's own
+// contents take the first sampler, so this is one less than the number of sampler bindings.
+constexpr u32 XFB_STITCH_MAX_SOURCES = 7;
+constexpr u32 XFB_STITCH_GROUP_SIZE = 8;
+
+// Returns the GLSL string containing the compute shader which stitches EFB copies into an XFB.
+std::string GenerateXFBStitchingShader(APIType api_type);
+
 }  // namespace TextureConversionShaderTiled
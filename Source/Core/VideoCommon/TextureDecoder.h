@@ -191,8 +191,19 @@ TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+// Decodes the rows [first_row, first_row + num_rows) of a texture into the matching rows of dst,
+// so that a texture can be decoded in parts on several threads. Both must be multiples of the
+// block height. Unlike TexDecoder_Decode, this doesn't draw the format overlay, which has to be
+// drawn with TexDecoder_DrawOverlay once all rows have been decoded.
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
+// Interleaves the AR and GB halves that a RGBA8 texture keeps in separate TMEM banks back into the
+// layout it has in main memory, so that it can be decoded like any other RGBA8 texture.
+void TexDecoder_GatherRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                    int height);
 void TexDecoder_DecodeTexel(u8* dst, std::span<const u8> src, int s, int t, int imageWidth,
                             TextureFormat texformat, std::span<const u8> tlut, TLUTFormat tlutfmt);
 void TexDecoder_DecodeTexelRGBA8FromTmem(u8* dst, std::span<const u8> src_ar,
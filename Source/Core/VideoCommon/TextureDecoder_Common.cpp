@@ -5,6 +5,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <span>
 
 #include "Common/CommonTypes.h"
@@ -256,7 +257,7 @@ void TexDecoder_SetTexFmtOverlayOptions(bool enable, bool center)
   TexFmt_Overlay_Center = center;
 }
 
-static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+static void DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
 {
   int w = std::min(width, 40);
   int h = std::min(height, 10);
@@ -303,8 +304,22 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
 {
   _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
 
+  TexDecoder_DrawOverlay(dst, width, height, texformat);
+}
+
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  dst += static_cast<size_t>(first_row) * width * sizeof(u32);
+  src += TexDecoder_GetTextureSizeInBytes(width, first_row, texformat);
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst), src, width, num_rows, texformat, tlut,
+                         tlutfmt);
+}
+
+void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat texformat)
+{
   if (TexFmt_Overlay_Enable)
-    TexDecoder_DrawOverlay(dst, width, height, texformat);
+    DrawOverlay(dst, width, height, texformat);
 }
 
 static inline u32 DecodePixel_IA8(u16 val)
@@ -700,6 +715,20 @@ void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb,
   }
 }
 
+void TexDecoder_GatherRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
+                                    int height)
+{
+  // Each 4x4 block is 32 bytes of AR data followed by 32 bytes of GB data in main memory.
+  constexpr size_t half_block_size = 32;
+  const size_t num_blocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+  for (size_t i = 0; i < num_blocks; ++i)
+  {
+    std::memcpy(dst, src_ar + i * half_block_size, half_block_size);
+    std::memcpy(dst + half_block_size, src_gb + i * half_block_size, half_block_size);
+    dst += half_block_size * 2;
+  }
+}
+
 void TexDecoder_DecodeXFB(u8* dst, const u8* src, u32 width, u32 height, u32 stride)
 {
   const u8* src_ptr = src;
@@ -4,8 +4,13 @@
 #include "VideoCommon/TextureDecoder.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
+#if defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -71,25 +76,32 @@ static inline u32 DecodePixel_Paletted(u16 pixel, TLUTFormat tlutfmt)
   }
 }
 
-static inline void DecodeBytes_C4(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+// C4 and C8 textures have few enough palette entries that decoding all of them up front is much
+// cheaper than decoding an entry for every texel.
+template <size_t N>
+static std::array<u32, N> DecodePalette(const u8* tlut_, TLUTFormat tlutfmt)
 {
   const u16* tlut = (u16*)tlut_;
+  std::array<u32, N> palette;
+  for (size_t i = 0; i < N; i++)
+    palette[i] = DecodePixel_Paletted(tlut[i], tlutfmt);
+  return palette;
+}
+
+static inline void DecodeBytes_C4(u32* dst, const u8* src, const std::array<u32, 16>& palette)
+{
   for (int x = 0; x < 4; x++)
   {
     u8 val = src[x];
-    *dst++ = DecodePixel_Paletted(tlut[val >> 4], tlutfmt);
-    *dst++ = DecodePixel_Paletted(tlut[val & 0xF], tlutfmt);
+    *dst++ = palette[val >> 4];
+    *dst++ = palette[val & 0xF];
   }
 }
 
-static inline void DecodeBytes_C8(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+static inline void DecodeBytes_C8(u32* dst, const u8* src, const std::array<u32, 256>& palette)
 {
-  const u16* tlut = (u16*)tlut_;
   for (int x = 0; x < 8; x++)
-  {
-    u8 val = src[x];
-    *dst++ = DecodePixel_Paletted(tlut[val], tlutfmt);
-  }
+    *dst++ = palette[src[x]];
 }
 
 static inline void DecodeBytes_C14X2(u32* dst, const u16* src, const u8* tlut_, TLUTFormat tlutfmt)
@@ -183,6 +195,224 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   }
 }
 
+#if defined(_M_ARM_64)
+// NEON versions of the reference decoders below, with exactly the same output. They work on one or
+// two rows of a block at a time, which is as much as fits in a register.
+
+// Broadcasts each of 8 intensities to all channels of a texel.
+static inline void StoreIntensity_NEON(u32* dst, uint8x8_t intensity)
+{
+  static constexpr std::array<u8, 16> first_half{0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  static constexpr std::array<u8, 16> second_half{4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+  const uint8x16_t table = vcombine_u8(intensity, intensity);
+  vst1q_u8(reinterpret_cast<u8*>(dst), vqtbl1q_u8(table, vld1q_u8(first_half.data())));
+  vst1q_u8(reinterpret_cast<u8*>(dst + 4), vqtbl1q_u8(table, vld1q_u8(second_half.data())));
+}
+
+// Stores the channels of 8 texels, the first 4 of which go to row0 and the others to row1.
+static inline void StoreRGBA_NEON(u32* row0, u32* row1, uint8x8_t r, uint8x8_t g, uint8x8_t b,
+                                  uint8x8_t a)
+{
+  const uint8x8x2_t rg = vzip_u8(r, g);
+  const uint8x8x2_t ba = vzip_u8(b, a);
+  const uint16x4x2_t texels0 =
+      vzip_u16(vreinterpret_u16_u8(rg.val[0]), vreinterpret_u16_u8(ba.val[0]));
+  const uint16x4x2_t texels1 =
+      vzip_u16(vreinterpret_u16_u8(rg.val[1]), vreinterpret_u16_u8(ba.val[1]));
+  vst1q_u16(reinterpret_cast<u16*>(row0), vcombine_u16(texels0.val[0], texels0.val[1]));
+  vst1q_u16(reinterpret_cast<u16*>(row1), vcombine_u16(texels1.val[0], texels1.val[1]));
+}
+
+// Splits 8 bytes of 4-bit values into the values of the first 4 bytes and of the last 4 bytes,
+// high nibble first.
+static inline uint8x8x2_t UnpackNibbles_NEON(uint8x8_t packed)
+{
+  return vzip_u8(vshr_n_u8(packed, 4), vand_u8(packed, vdup_n_u8(0xF)));
+}
+
+// Same as the scalar ConvertXTo8 functions, for 8 values which are already masked.
+static inline uint8x8_t Convert3To8_NEON(uint16x8_t v)
+{
+  return vmovn_u16(vorrq_u16(vorrq_u16(vshlq_n_u16(v, 5), vshlq_n_u16(v, 2)), vshrq_n_u16(v, 1)));
+}
+
+static inline uint8x8_t Convert4To8_NEON(uint16x8_t v)
+{
+  return vmovn_u16(vorrq_u16(vshlq_n_u16(v, 4), v));
+}
+
+static inline uint8x8_t Convert5To8_NEON(uint16x8_t v)
+{
+  return vmovn_u16(vorrq_u16(vshlq_n_u16(v, 3), vshrq_n_u16(v, 2)));
+}
+
+static inline uint8x8_t Convert6To8_NEON(uint16x8_t v)
+{
+  return vmovn_u16(vorrq_u16(vshlq_n_u16(v, 2), vshrq_n_u16(v, 4)));
+}
+
+static inline uint16x8_t LoadBigEndian16_NEON(const u8* src)
+{
+  return vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+}
+
+static inline void DecodeBytes_C4_NEON(u32* dst, uint8x8_t indices, const uint8x16x4_t& palette)
+{
+  static constexpr std::array<u8, 16> first_half{0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  static constexpr std::array<u8, 16> second_half{4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+  static constexpr std::array<u8, 16> channels{0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+
+  // Turn each index into the indices of the 4 bytes of its palette entry.
+  const uint8x16_t table = vcombine_u8(indices, indices);
+  const uint8x16_t channel_offsets = vld1q_u8(channels.data());
+  const uint8x16_t bytes0 = vaddq_u8(
+      vshlq_n_u8(vqtbl1q_u8(table, vld1q_u8(first_half.data())), 2), channel_offsets);
+  const uint8x16_t bytes1 = vaddq_u8(
+      vshlq_n_u8(vqtbl1q_u8(table, vld1q_u8(second_half.data())), 2), channel_offsets);
+  vst1q_u8(reinterpret_cast<u8*>(dst), vqtbl4q_u8(palette, bytes0));
+  vst1q_u8(reinterpret_cast<u8*>(dst + 4), vqtbl4q_u8(palette, bytes1));
+}
+
+// Returns false for formats which don't have a NEON decoder.
+static bool DecodeImpl_NEON(u32* dst, const u8* src, int width, int height,
+                            TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  switch (texformat)
+  {
+  case TextureFormat::C4:
+  {
+    const std::array<u32, 16> decoded_palette = DecodePalette<16>(tlut, tlutfmt);
+    const uint8x16x4_t palette = vld1q_u8_x4(reinterpret_cast<const u8*>(decoded_palette.data()));
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+        {
+          const uint8x8x2_t indices = UnpackNibbles_NEON(vld1_u8(src));
+          DecodeBytes_C4_NEON(dst + (y + iy) * width + x, indices.val[0], palette);
+          DecodeBytes_C4_NEON(dst + (y + iy + 1) * width + x, indices.val[1], palette);
+        }
+    return true;
+  }
+  case TextureFormat::I4:
+    for (int y = 0; y < height; y += 8)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 8; iy += 2, src += 8)
+        {
+          const uint8x8x2_t values = UnpackNibbles_NEON(vld1_u8(src));
+          const uint8x8_t scale = vdup_n_u8(0x11);
+          StoreIntensity_NEON(dst + (y + iy) * width + x, vmul_u8(values.val[0], scale));
+          StoreIntensity_NEON(dst + (y + iy + 1) * width + x, vmul_u8(values.val[1], scale));
+        }
+    return true;
+  case TextureFormat::I8:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+          StoreIntensity_NEON(dst + (y + iy) * width + x, vld1_u8(src));
+    return true;
+  case TextureFormat::IA4:
+  {
+    // Intensity in the first half of the table, alpha in the second half.
+    static constexpr std::array<u8, 16> first_half{0, 0, 0, 8,  1, 1, 1, 9,
+                                                   2, 2, 2, 10, 3, 3, 3, 11};
+    static constexpr std::array<u8, 16> second_half{4, 4, 4, 12, 5, 5, 5, 13,
+                                                    6, 6, 6, 14, 7, 7, 7, 15};
+    const uint8x16_t first_indices = vld1q_u8(first_half.data());
+    const uint8x16_t second_indices = vld1q_u8(second_half.data());
+    const uint8x8_t scale = vdup_n_u8(0x11);
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 8)
+        for (int iy = 0; iy < 4; iy++, src += 8)
+        {
+          const uint8x8_t packed = vld1_u8(src);
+          const uint8x16_t table = vcombine_u8(vmul_u8(vand_u8(packed, vdup_n_u8(0xF)), scale),
+                                               vmul_u8(vshr_n_u8(packed, 4), scale));
+          u8* const row = reinterpret_cast<u8*>(dst + (y + iy) * width + x);
+          vst1q_u8(row, vqtbl1q_u8(table, first_indices));
+          vst1q_u8(row + 16, vqtbl1q_u8(table, second_indices));
+        }
+    return true;
+  }
+  case TextureFormat::IA8:
+  {
+    // Each texel is stored as alpha followed by intensity.
+    static constexpr std::array<u8, 16> first_row{1, 1, 1, 0, 3, 3, 3, 2,
+                                                  5, 5, 5, 4, 7, 7, 7, 6};
+    static constexpr std::array<u8, 16> second_row{9,  9,  9,  8,  11, 11, 11, 10,
+                                                   13, 13, 13, 12, 15, 15, 15, 14};
+    const uint8x16_t first_indices = vld1q_u8(first_row.data());
+    const uint8x16_t second_indices = vld1q_u8(second_row.data());
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint8x16_t packed = vld1q_u8(src);
+          vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy) * width + x),
+                   vqtbl1q_u8(packed, first_indices));
+          vst1q_u8(reinterpret_cast<u8*>(dst + (y + iy + 1) * width + x),
+                   vqtbl1q_u8(packed, second_indices));
+        }
+    return true;
+  }
+  case TextureFormat::RGB565:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint16x8_t val = LoadBigEndian16_NEON(src);
+          const uint8x8_t r = Convert5To8_NEON(vshrq_n_u16(val, 11));
+          const uint8x8_t g = Convert6To8_NEON(vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x3F)));
+          const uint8x8_t b = Convert5To8_NEON(vandq_u16(val, vdupq_n_u16(0x1F)));
+          StoreRGBA_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, r, g, b,
+                         vdup_n_u8(0xFF));
+        }
+    return true;
+  case TextureFormat::RGB5A3:
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+        for (int iy = 0; iy < 4; iy += 2, src += 16)
+        {
+          const uint16x8_t val = LoadBigEndian16_NEON(src);
+          const uint16x8_t mask5 = vdupq_n_u16(0x1F);
+          const uint16x8_t mask4 = vdupq_n_u16(0xF);
+
+          // Texels with the top bit set are RGB555, the others are ARGB3444.
+          const uint8x8_t opaque = vmovn_u16(vtstq_u16(val, vdupq_n_u16(0x8000)));
+          const uint8x8_t r5 = Convert5To8_NEON(vandq_u16(vshrq_n_u16(val, 10), mask5));
+          const uint8x8_t g5 = Convert5To8_NEON(vandq_u16(vshrq_n_u16(val, 5), mask5));
+          const uint8x8_t b5 = Convert5To8_NEON(vandq_u16(val, mask5));
+          const uint8x8_t r4 = Convert4To8_NEON(vandq_u16(vshrq_n_u16(val, 8), mask4));
+          const uint8x8_t g4 = Convert4To8_NEON(vandq_u16(vshrq_n_u16(val, 4), mask4));
+          const uint8x8_t b4 = Convert4To8_NEON(vandq_u16(val, mask4));
+          const uint8x8_t a3 = Convert3To8_NEON(vandq_u16(vshrq_n_u16(val, 12), vdupq_n_u16(0x7)));
+          const uint8x8_t r = vbsl_u8(opaque, r5, r4);
+          const uint8x8_t g = vbsl_u8(opaque, g5, g4);
+          const uint8x8_t b = vbsl_u8(opaque, b5, b4);
+          const uint8x8_t a = vbsl_u8(opaque, vdup_n_u8(0xFF), a3);
+          StoreRGBA_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, r, g, b, a);
+        }
+    return true;
+  case TextureFormat::RGBA8:
+    // Each block holds the alpha and red values of its 16 texels, then the green and blue values.
+    for (int y = 0; y < height; y += 4)
+      for (int x = 0; x < width; x += 4)
+      {
+        for (int iy = 0; iy < 4; iy += 2)
+        {
+          const uint8x8x2_t ar = vld2_u8(src + 8 * iy);
+          const uint8x8x2_t gb = vld2_u8(src + 32 + 8 * iy);
+          StoreRGBA_NEON(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x, ar.val[1],
+                         gb.val[0], gb.val[1], ar.val[0]);
+        }
+        src += 64;
+      }
+    return true;
+  default:
+    return false;
+  }
+}
+#endif
+
 // JSD 01/06/11:
 // TODO: we really should ensure BOTH the source and destination addresses are aligned to 16-byte
 // boundaries to
@@ -197,17 +427,25 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
+#if defined(_M_ARM_64)
+  if (DecodeImpl_NEON(dst, src, width, height, texformat, tlut, tlutfmt))
+    return;
+#endif
+
   const int Wsteps4 = (width + 3) / 4;
   const int Wsteps8 = (width + 7) / 8;
 
   switch (texformat)
   {
   case TextureFormat::C4:
+  {
+    const std::array<u32, 16> palette = DecodePalette<16>(tlut, tlutfmt);
     for (int y = 0; y < height; y += 8)
       for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
-          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, tlut, tlutfmt);
-    break;
+          DecodeBytes_C4(dst + (y + iy) * width + x, src + 4 * xStep, palette);
+  }
+  break;
   case TextureFormat::I4:
   {
     // Reference C implementation:
@@ -255,11 +493,14 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   }
   break;
   case TextureFormat::C8:
+  {
+    const std::array<u32, 256> palette = DecodePalette<256>(tlut, tlutfmt);
     for (int y = 0; y < height; y += 4)
       for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
         for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
-    break;
+          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, palette);
+  }
+  break;
   case TextureFormat::IA4:
   {
     for (int y = 0; y < height; y += 4)
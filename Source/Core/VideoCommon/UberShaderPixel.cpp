@@ -293,6 +293,24 @@ PixelShaderUid GetPixelShaderUid()
   return out;
 }
 
+PixelShaderUid GetSpecializedPixelShaderUid()
+{
+  PixelShaderUid out = GetPixelShaderUid();
+
+  pixel_ubershader_uid_data* const uid_data = out.GetUidData();
+  const u32 num_tev_stages = bpmem.genMode.numtevstages;
+  uid_data->specialized = 1;
+  uid_data->num_tev_stages = num_tev_stages;
+  uid_data->indirect = false;
+  for (u32 i = 0; i <= num_tev_stages; i++)
+    uid_data->indirect |= bpmem.tevind[i].hex != 0;
+  // These match the conditions under which PixelShaderManager sets the uniforms to zero.
+  uid_data->fog = !g_ActiveConfig.bDisableFog && bpmem.fog.c_proj_fsel.fsel != FogType::Off;
+  uid_data->alpha_test = bpmem.alpha_test.TestResult() != AlphaTestResult::Pass;
+
+  return out;
+}
+
 void ClearUnusedPixelShaderUidBits(APIType api_type, const ShaderHostConfig& host_config,
                                    PixelShaderUid* uid)
 {
@@ -326,6 +344,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   const bool per_pixel_depth = uid_data->per_pixel_depth != 0;
   const bool bounding_box = host_config.bounding_box;
   const u32 numTexgen = uid_data->num_texgens;
+  const bool specialized = uid_data->specialized != 0;
   ShaderCode out;
 
   ASSERT_MSG(VIDEO, !(use_dual_source && use_framebuffer_fetch),
@@ -397,7 +416,7 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                             GetInterpolationQualifier(msaa, ssaa, true, true), ShaderStage::Pixel);
 
     out.Write("}};\n\n");
-    if (stereo && !host_config.backend_gl_layer_in_fs)
+    if (stereo && !host_config.backend_gl_layer_in_fs && !host_config.backend_multiview)
       out.Write("flat in int layer;");
   }
   else
@@ -876,8 +895,16 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
   out.Write("void main()\n{{\n");
   out.Write("  float4 rawpos = gl_FragCoord;\n");
 
-  out.Write("  uint num_stages = {};\n\n",
-            BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  // A constant stage count lets the driver unroll the TEV loop.
+  if (specialized)
+  {
+    out.Write("  uint num_stages = {}u;\n\n", uid_data->num_tev_stages);
+  }
+  else
+  {
+    out.Write("  uint num_stages = {};\n\n",
+              BitfieldExtract<&GenMode::numtevstages>("bpmem_genmode"));
+  }
 
   bool has_custom_shader_details = false;
   if (std::any_of(custom_details.shaders.begin(), custom_details.shaders.end(),
@@ -907,7 +934,11 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               "  float4 ocol1;\n");
   }
 
-  if (host_config.backend_geometry_shaders && stereo)
+  if (host_config.backend_multiview)
+  {
+    out.Write("\tint layer = gl_ViewIndex;\n");
+  }
+  else if (host_config.backend_geometry_shaders && stereo)
   {
     if (host_config.backend_gl_layer_in_fs)
       out.Write("\tint layer = gl_Layer;\n");
@@ -979,10 +1010,11 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
               1 << TwoTevStageOrders().enable_tex_even.StartBit());
     out.Write("\n"
               "    // Indirect textures\n"
-              "    uint tevind = bpmem_tevind(stage);\n"
+              "    uint tevind = {};\n"
               "    if (tevind != 0u)\n"
               "    {{\n"
               "      uint bs = {};\n",
+              specialized && !uid_data->indirect ? "0u" : "bpmem_tevind(stage)",
               BitfieldExtract<&TevStageIndirect::bs>("tevind"));
     out.Write("      uint fmt = {};\n", BitfieldExtract<&TevStageIndirect::fmt>("tevind"));
     out.Write("      uint bias = {};\n", BitfieldExtract<&TevStageIndirect::bias>("tevind"));
@@ -1402,27 +1434,30 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
     out.Write("  #define discard_fragment discard\n");
   }
 
-  out.Write("  if (bpmem_alphaTest != 0u) {{\n"
-            "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
-            BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
-  out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
-            BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
-  out.Write("\n"
-            "    // These if statements are written weirdly to work around intel and Qualcomm "
-            "bugs with handling booleans.\n"
-            "    switch ({}) {{\n",
-            BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
-  out.Write("    case 0u: // AND\n"
-            "      if (comp0 && comp1) break; else discard_fragment; break;\n"
-            "    case 1u: // OR\n"
-            "      if (comp0 || comp1) break; else discard_fragment; break;\n"
-            "    case 2u: // XOR\n"
-            "      if (comp0 != comp1) break; else discard_fragment; break;\n"
-            "    case 3u: // XNOR\n"
-            "      if (comp0 == comp1) break; else discard_fragment; break;\n"
-            "    }}\n"
-            "  }}\n"
-            "\n");
+  if (!specialized || uid_data->alpha_test)
+  {
+    out.Write("  if (bpmem_alphaTest != 0u) {{\n"
+              "    bool comp0 = alphaCompare(TevResult.a, " I_ALPHA ".r, {});\n",
+              BitfieldExtract<&AlphaTest::comp0>("bpmem_alphaTest"));
+    out.Write("    bool comp1 = alphaCompare(TevResult.a, " I_ALPHA ".g, {});\n",
+              BitfieldExtract<&AlphaTest::comp1>("bpmem_alphaTest"));
+    out.Write("\n"
+              "    // These if statements are written weirdly to work around intel and Qualcomm "
+              "bugs with handling booleans.\n"
+              "    switch ({}) {{\n",
+              BitfieldExtract<&AlphaTest::logic>("bpmem_alphaTest"));
+    out.Write("    case 0u: // AND\n"
+              "      if (comp0 && comp1) break; else discard_fragment; break;\n"
+              "    case 1u: // OR\n"
+              "      if (comp0 || comp1) break; else discard_fragment; break;\n"
+              "    case 2u: // XOR\n"
+              "      if (comp0 != comp1) break; else discard_fragment; break;\n"
+              "    case 3u: // XNOR\n"
+              "      if (comp0 == comp1) break; else discard_fragment; break;\n"
+              "    }}\n"
+              "  }}\n"
+              "\n");
+  }
 
   out.Write("  // Hardware testing indicates that an alpha of 1 can pass an alpha test,\n"
             "  // but doesn't do anything in blending\n"
@@ -1444,67 +1479,71 @@ ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
 
   // FIXME: Fog is implemented the same as ShaderGen, but ShaderGen's fog is all hacks.
   //        Should be fixed point, and should not make guesses about Range-Based adjustments.
-  out.Write("  // Fog\n"
-            "  uint fog_function = {};\n",
-            BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
-  out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
-  out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
-            "    float ze;\n"
-            "    if ({} == 0u) {{\n",
-            BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
-  out.Write("      // perspective\n"
-            "      // ze = A/(B - (Zs >> B_SHF)\n"
-            "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
-            ".w));\n"
-            "    }} else {{\n"
-            "      // orthographic\n"
-            "      // ze = a*Zs    (here, no B_SHF)\n"
-            "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
-            "    }}\n"
-            "\n"
-            "    if (bool({})) {{\n",
-            BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
-  out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
-            "      // ze *= x_adjust\n"
-            "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
-            "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
-            "      uint indexlower = uint(floatindex);\n"
-            "      uint indexupper = indexlower + 1u;\n"
-            "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
-            "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
-            "      float k = lerp(klower, kupper, frac(floatindex));\n"
-            "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
-            "      ze *= x_adjust;\n"
-            "    }}\n"
-            "\n"
-            "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
-            "\n");
-  out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
-  out.Write("      switch (fog_function) {{\n"
-            "      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog);\n"
-            "        break;\n",
-            FogType::Exp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::ExpSq);
-  out.Write("      case {:s}:\n"
-            "        fog = exp2(-8.0 * (1.0 - fog));\n"
-            "        break;\n",
-            FogType::BackwardsExp);
-  out.Write("      case {:s}:\n"
-            "        fog = 1.0 - fog;\n"
-            "        fog = exp2(-8.0 * fog * fog);\n"
-            "        break;\n",
-            FogType::BackwardsExpSq);
-  out.Write("      }}\n"
-            "    }}\n"
-            "\n"
-            "    int ifog = iround(fog * 256.0);\n"
-            "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR ".rgb * ifog) >> 8;\n"
-            "  }}\n"
-            "\n");
+  if (!specialized || uid_data->fog)
+  {
+    out.Write("  // Fog\n"
+              "  uint fog_function = {};\n",
+              BitfieldExtract<&FogParam3::fsel>("bpmem_fogParam3"));
+    out.Write("  if (fog_function != {:s}) {{\n", FogType::Off);
+    out.Write("    // TODO: This all needs to be converted from float to fixed point\n"
+              "    float ze;\n"
+              "    if ({} == 0u) {{\n",
+              BitfieldExtract<&FogParam3::proj>("bpmem_fogParam3"));
+    out.Write("      // perspective\n"
+              "      // ze = A/(B - (Zs >> B_SHF)\n"
+              "      ze = (" I_FOGF ".x * 16777216.0) / float(" I_FOGI ".y - (zCoord >> " I_FOGI
+              ".w));\n"
+              "    }} else {{\n"
+              "      // orthographic\n"
+              "      // ze = a*Zs    (here, no B_SHF)\n"
+              "      ze = " I_FOGF ".x * float(zCoord) / 16777216.0;\n"
+              "    }}\n"
+              "\n"
+              "    if (bool({})) {{\n",
+              BitfieldExtract<&FogRangeParams::RangeBase::Enabled>("bpmem_fogRangeBase"));
+    out.Write("      // x_adjust = sqrt((x-center)^2 + k^2)/k\n"
+              "      // ze *= x_adjust\n"
+              "      float offset = (2.0 * (rawpos.x / " I_FOGF ".w)) - 1.0 - " I_FOGF ".z;\n"
+              "      float floatindex = clamp(9.0 - abs(offset) * 9.0, 0.0, 9.0);\n"
+              "      uint indexlower = uint(floatindex);\n"
+              "      uint indexupper = indexlower + 1u;\n"
+              "      float klower = " I_FOGRANGE "[indexlower >> 2u][indexlower & 3u];\n"
+              "      float kupper = " I_FOGRANGE "[indexupper >> 2u][indexupper & 3u];\n"
+              "      float k = lerp(klower, kupper, frac(floatindex));\n"
+              "      float x_adjust = sqrt(offset * offset + k * k) / k;\n"
+              "      ze *= x_adjust;\n"
+              "    }}\n"
+              "\n"
+              "    float fog = clamp(ze - " I_FOGF ".y, 0.0, 1.0);\n"
+              "\n");
+    out.Write("    if (fog_function >= {:s}) {{\n", FogType::Exp);
+    out.Write("      switch (fog_function) {{\n"
+              "      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog);\n"
+              "        break;\n",
+              FogType::Exp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::ExpSq);
+    out.Write("      case {:s}:\n"
+              "        fog = exp2(-8.0 * (1.0 - fog));\n"
+              "        break;\n",
+              FogType::BackwardsExp);
+    out.Write("      case {:s}:\n"
+              "        fog = 1.0 - fog;\n"
+              "        fog = exp2(-8.0 * fog * fog);\n"
+              "        break;\n",
+              FogType::BackwardsExpSq);
+    out.Write("      }}\n"
+              "    }}\n"
+              "\n"
+              "    int ifog = iround(fog * 256.0);\n"
+              "    TevResult.rgb = (TevResult.rgb * (256 - ifog) + " I_FOGCOLOR
+              ".rgb * ifog) >> 8;\n"
+              "  }}\n"
+              "\n");
+  }
 
   if (use_framebuffer_fetch)
   {
@@ -20,6 +20,14 @@ struct pixel_ubershader_uid_data
   u32 uint_output : 1;
   u32 no_dual_src : 1;
 
+  // Set for the ubershaders which are specialized by the fields below instead of reading them
+  // from the uniforms, see GetSpecializedPixelShaderUid.
+  u32 specialized : 1;
+  u32 num_tev_stages : 4;
+  u32 indirect : 1;
+  u32 fog : 1;
+  u32 alpha_test : 1;
+
   u32 NumValues() const { return sizeof(pixel_ubershader_uid_data); }
 };
 #pragma pack()
@@ -27,6 +35,9 @@ struct pixel_ubershader_uid_data
 using PixelShaderUid = ShaderUid<pixel_ubershader_uid_data>;
 
 PixelShaderUid GetPixelShaderUid();
+// Returns the uid of an ubershader which only handles the current TEV stage count and uses of
+// indirect textures, fog and the alpha test. These are much faster to execute on some GPUs.
+PixelShaderUid GetSpecializedPixelShaderUid();
 
 ShaderCode GenPixelShader(APIType api_type, const ShaderHostConfig& host_config,
                           const pixel_ubershader_uid_data* uid_data,
@@ -44,9 +55,16 @@ struct fmt::formatter<UberShader::pixel_ubershader_uid_data>
   template <typename FormatContext>
   auto format(const UberShader::pixel_ubershader_uid_data& uid, FormatContext& ctx) const
   {
-    return fmt::format_to(
+    auto out = fmt::format_to(
         ctx.out(), "Pixel UberShader for {} texgens{}{}{}{}", uid.num_texgens,
         uid.early_depth ? ", early-depth" : "", uid.per_pixel_depth ? ", per-pixel depth" : "",
         uid.uint_output ? ", uint output" : "", uid.no_dual_src ? ", no dual-source blending" : "");
+    if (uid.specialized)
+    {
+      out = fmt::format_to(out, ", specialized for {} TEV stages{}{}{}", uid.num_tev_stages + 1,
+                           uid.indirect ? ", indirect" : "", uid.fog ? ", fog" : "",
+                           uid.alpha_test ? ", alpha test" : "");
+    }
+    return out;
   }
 };
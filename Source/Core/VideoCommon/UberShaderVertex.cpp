@@ -50,7 +50,7 @@ ShaderCode GenVertexShader(APIType api_type, const ShaderHostConfig& host_config
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (vertex_loader)
+  if (vertex_loader || host_config.backend_multiview)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
@@ -396,6 +396,14 @@ float3 load_input_float3_rawtex(uint vtx_offset, uint attr_offset) {{
               "  o.colors_1 = float4(0.0, 0.0, 0.0, 0.0);\n");
   }
 
+  if (host_config.backend_multiview)
+  {
+    // Each eye is a separate view, so apply the stereo offset the geometry shader would otherwise.
+    out.Write("float hoffset = (gl_ViewIndex == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS
+              ".y;\n"
+              "o.pos.x += hoffset * (o.pos.w - " I_STEREOPARAMS ".z);\n");
+  }
+
   if (!host_config.fast_depth_calc)
   {
     // clipPos/w needs to be done in pixel shader, not here
@@ -49,8 +49,9 @@ alignas(16) static const float scale_factors[] = {
     1.0 / (1ULL << 28), 1.0 / (1ULL << 29), 1.0 / (1ULL << 30), 1.0 / (1ULL << 31),
 };
 
-VertexLoaderARM64::VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
-    : VertexLoaderBase(vtx_desc, vtx_att), m_float_emit(this)
+VertexLoaderARM64::VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att,
+                                     bool update_caches)
+    : VertexLoaderBase(vtx_desc, vtx_att), m_update_caches(update_caches), m_float_emit(this)
 {
   AllocCodeSpace(4096);
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
@@ -156,27 +157,30 @@ void VertexLoaderARM64::ReadVertex(VertexComponentFormat attribute, ComponentFor
   m_float_emit.STUR(write_size, coords, dst_reg, m_dst_ofs);
 
   // Z-Freeze
-  if (native_format == &m_native_vtx_decl.position)
+  if (m_update_caches)
   {
-    CMP(remaining_reg, 3);
-    FixupBranch dont_store = B(CC_GE);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_cache.data());
-    m_float_emit.STR(128, coords, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
-    SetJumpTarget(dont_store);
-  }
-  else if (native_format == &m_native_vtx_decl.normals[1])
-  {
-    FixupBranch dont_store = CBNZ(remaining_reg);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::tangent_cache.data());
-    m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
-    SetJumpTarget(dont_store);
-  }
-  else if (native_format == &m_native_vtx_decl.normals[2])
-  {
-    FixupBranch dont_store = CBNZ(remaining_reg);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::binormal_cache.data());
-    m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
-    SetJumpTarget(dont_store);
+    if (native_format == &m_native_vtx_decl.position)
+    {
+      CMP(remaining_reg, 3);
+      FixupBranch dont_store = B(CC_GE);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_cache.data());
+      m_float_emit.STR(128, coords, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
+      SetJumpTarget(dont_store);
+    }
+    else if (native_format == &m_native_vtx_decl.normals[1])
+    {
+      FixupBranch dont_store = CBNZ(remaining_reg);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::tangent_cache.data());
+      m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
+      SetJumpTarget(dont_store);
+    }
+    else if (native_format == &m_native_vtx_decl.normals[2])
+    {
+      FixupBranch dont_store = CBNZ(remaining_reg);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::binormal_cache.data());
+      m_float_emit.STR(128, IndexType::Unsigned, coords, EncodeRegTo64(scratch2_reg), 0);
+      SetJumpTarget(dont_store);
+    }
   }
 
   native_format->components = count_out;
@@ -360,11 +364,14 @@ void VertexLoaderARM64::GenerateVertexLoader()
     STR(IndexType::Unsigned, scratch1_reg, dst_reg, m_dst_ofs);
 
     // Z-Freeze
-    CMP(remaining_reg, 3);
-    FixupBranch dont_store = B(CC_GE);
-    MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_matrix_index_cache.data());
-    STR(scratch1_reg, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
-    SetJumpTarget(dont_store);
+    if (m_update_caches)
+    {
+      CMP(remaining_reg, 3);
+      FixupBranch dont_store = B(CC_GE);
+      MOVP2R(EncodeRegTo64(scratch2_reg), VertexLoaderManager::position_matrix_index_cache.data());
+      STR(scratch1_reg, EncodeRegTo64(scratch2_reg), ArithOption(remaining_reg, true));
+      SetJumpTarget(dont_store);
+    }
 
     m_native_vtx_decl.posmtx.components = 4;
     m_native_vtx_decl.posmtx.enable = true;
@@ -522,6 +529,5 @@ void VertexLoaderARM64::GenerateVertexLoader()
 
 int VertexLoaderARM64::RunVertices(const u8* src, u8* dst, int count)
 {
-  m_numLoadedVertices += count;
   return ((int (*)(const u8* src, u8* dst, int count))region)(src, dst, count - 1);
 }
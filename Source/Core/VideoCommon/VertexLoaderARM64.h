@@ -17,12 +17,15 @@ enum class CPArray : u8;
 class VertexLoaderARM64 : public VertexLoaderBase, public Arm64Gen::ARM64CodeBlock
 {
 public:
-  VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
+  // If update_caches is false, the zfreeze and emboss caches in VertexLoaderManager are left
+  // untouched, and several threads can run the loader at the same time.
+  VertexLoaderARM64(const TVtxDesc& vtx_desc, const VAT& vtx_att, bool update_caches = true);
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
 
 private:
+  const bool m_update_caches;
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
   Arm64Gen::FixupBranch m_skip_vertex;
@@ -152,7 +152,6 @@ public:
                fmt::join(a_binormal_cache, ", "), fmt::join(b_binormal_cache, ", "));
 
     memcpy(dst, buffer_a.data(), count_a * m_native_vtx_decl.stride);
-    m_numLoadedVertices += count;
     return count_a;
   }
 
@@ -194,6 +193,23 @@ u32 VertexLoaderBase::GetVertexSize(const TVtxDesc& vtx_desc, const VAT& vtx_att
   return size;
 }
 
+bool VertexLoaderBase::UsesVertexArrays() const
+{
+  if (IsIndexed(m_VtxDesc.low.Position) || IsIndexed(m_VtxDesc.low.Normal))
+    return true;
+  for (u32 i = 0; i < m_VtxDesc.low.Color.Size(); i++)
+  {
+    if (IsIndexed(m_VtxDesc.low.Color[i]))
+      return true;
+  }
+  for (u32 i = 0; i < m_VtxDesc.high.TexCoord.Size(); i++)
+  {
+    if (IsIndexed(m_VtxDesc.high.TexCoord[i]))
+      return true;
+  }
+  return false;
+}
+
 u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
 {
   u32 components = 0;
@@ -224,6 +240,18 @@ u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& v
   return components;
 }
 
+std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateWorkerLoader() const
+{
+#if defined(_M_X86_64)
+  return std::make_unique<VertexLoaderX64>(m_VtxDesc, m_VtxAttr, false);
+#elif defined(_M_ARM_64)
+  return std::make_unique<VertexLoaderARM64>(m_VtxDesc, m_VtxAttr, false);
+#else
+  // The software loader keeps its state in globals.
+  return nullptr;
+#endif
+}
+
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                                        const VAT& vtx_attr)
 {
@@ -62,6 +62,14 @@ public:
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(const u8* src, u8* dst, int count) = 0;
 
+  // Whether any attribute is read from the vertex arrays in memory. If not, the output of the
+  // loader only depends on the vertex data passed to RunVertices.
+  bool UsesVertexArrays() const;
+
+  // Creates a loader for the same format which doesn't update the zfreeze and emboss caches, so
+  // that several threads can use it at the same time. Returns nullptr if that isn't supported.
+  std::unique_ptr<VertexLoaderBase> CreateWorkerLoader() const;
+
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
@@ -69,6 +77,7 @@ public:
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
+  std::unique_ptr<VertexLoaderBase> m_worker_loader;
   int m_numLoadedVertices = 0;
 
 protected:
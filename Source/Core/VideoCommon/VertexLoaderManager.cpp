@@ -4,6 +4,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -27,11 +28,13 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/WorkerThreadPool.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace VertexLoaderManager
@@ -50,6 +53,7 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
+static WorkerThreadPool s_thread_pool("Vertex Loader Worker");
 // TODO - change into array of pointers. Keep a map of all seen so far.
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
@@ -74,6 +78,11 @@ void Clear()
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
+
+  s_thread_pool.Stop();
+
+  // The display list cache refers to the loaders which were just destroyed.
+  OpcodeDecoder::ClearDisplayListCache();
 }
 
 void UpdateVertexArrayPointers()
@@ -375,8 +384,89 @@ static void CheckCPConfiguration(int vtx_attr_group)
   }
 }
 
+// Batches smaller than this are loaded by the calling thread alone, as waking up any workers would
+// cost more time than it saves.
+constexpr int MIN_VERTICES_PER_TASK = 2048;
+constexpr u32 MAX_WORKER_THREADS = 16;
+
+static int LoadVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count)
+{
+  const u32 num_threads =
+      std::min(static_cast<u32>(std::max(g_ActiveConfig.iVertexLoaderThreads, 0)),
+               MAX_WORKER_THREADS);
+  if (s_thread_pool.GetNumThreads() != num_threads) [[unlikely]]
+    s_thread_pool.Start(num_threads);
+
+  const int max_tasks = count / MIN_VERTICES_PER_TASK;
+  if (num_threads == 0 || max_tasks < 2)
+    return loader->RunVertices(src, dst, count);
+
+  if (!loader->m_worker_loader) [[unlikely]]
+  {
+    loader->m_worker_loader = loader->CreateWorkerLoader();
+    if (!loader->m_worker_loader)
+      return loader->RunVertices(src, dst, count);
+  }
+
+  // The last task uses the regular loader, so that the zfreeze and emboss caches end up with the
+  // values from the last vertices, exactly as if the batch had been loaded in one go.
+  const size_t num_tasks = std::min<size_t>(num_threads + 1, max_tasks);
+  const int vertices_per_task = count / static_cast<int>(num_tasks);
+  const u32 src_stride = loader->m_vertex_size;
+  const u32 dst_stride = loader->m_native_vtx_decl.stride;
+  std::array<int, MAX_WORKER_THREADS + 1> loaded_counts;
+
+  s_thread_pool.Run(num_tasks, [&](size_t task) {
+    const bool is_last = task == num_tasks - 1;
+    const int first = static_cast<int>(task) * vertices_per_task;
+    const int task_count = is_last ? count - first : vertices_per_task;
+    VertexLoaderBase* const task_loader = is_last ? loader : loader->m_worker_loader.get();
+    loaded_counts[task] =
+        task_loader->RunVertices(src + first * src_stride, dst + first * dst_stride, task_count);
+  });
+
+  // Skipped vertices (with an index of 0xFFFF) leave gaps between the outputs of the tasks.
+  int loaded_count = loaded_counts[0];
+  for (size_t task = 1; task < num_tasks; ++task)
+  {
+    const int first = static_cast<int>(task) * vertices_per_task;
+    if (loaded_count != first)
+    {
+      std::memmove(dst + loaded_count * dst_stride, dst + first * dst_stride,
+                   loaded_counts[task] * dst_stride);
+    }
+    loaded_count += loaded_counts[task];
+  }
+  return loaded_count;
+}
+
+static void SaveLoaderCaches(CachedVertices* cache)
+{
+  cache->position_cache = position_cache;
+  cache->position_matrix_index_cache = position_matrix_index_cache;
+  cache->tangent_cache = tangent_cache;
+  cache->binormal_cache = binormal_cache;
+}
+
+// Only restores the entries which the loader writes to, the others keep their current values.
+static void RestoreLoaderCaches(const VertexLoaderBase& loader, const CachedVertices& cache)
+{
+  const int written_vertices = std::min(cache.input_count, 3);
+  std::copy_n(cache.position_cache.begin(), written_vertices, position_cache.begin());
+  if (loader.m_native_vtx_decl.posmtx.enable)
+  {
+    std::copy_n(cache.position_matrix_index_cache.begin(), written_vertices,
+                position_matrix_index_cache.begin());
+  }
+  if (loader.m_native_vtx_decl.normals[1].enable)
+    tangent_cache = cache.tangent_cache;
+  if (loader.m_native_vtx_decl.normals[2].enable)
+    binormal_cache = cache.binormal_cache;
+}
+
 template <bool IsPreprocess>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertices* cache)
 {
   if (count == 0) [[unlikely]]
     return 0;
@@ -405,6 +495,7 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
       s_current_vtx_fmt = loader->m_native_vertex_format;
       g_current_components = loader->m_native_components;
+      g_vertex_manager->SetVertexShaderUidChanged();
       auto& system = Core::System::GetInstance();
       auto& vertex_shader_manager = system.GetVertexShaderManager();
       vertex_shader_manager.SetVertexFormat(loader->m_native_components,
@@ -427,7 +518,32 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
                                                                 cullall || can_cpu_cull);
 
-    count = loader->RunVertices(src, dst.GetPointer(), count);
+    loader->m_numLoadedVertices += count;
+
+    if (cache != nullptr && cache->loader == loader && cache->input_count == count)
+    {
+      std::memcpy(dst.GetPointer(), cache->data.data(), cache->data.size());
+      RestoreLoaderCaches(*loader, *cache);
+      count = cache->output_count;
+    }
+    else
+    {
+      const int input_count = count;
+      count = LoadVertices(loader, src, dst.GetPointer(), count);
+
+      if (cache != nullptr && !loader->UsesVertexArrays())
+      {
+        cache->loader = loader;
+        cache->input_count = input_count;
+        cache->output_count = count;
+        cache->data.assign(dst.GetPointer(), dst.GetPointer() + count * stride);
+        SaveLoaderCaches(cache);
+      }
+      else if (cache != nullptr)
+      {
+        cache->loader = nullptr;
+      }
+    }
 
     if (can_cpu_cull && !cullall)
     {
@@ -448,9 +564,9 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 }
 
 template int RunVertices<false>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                                const u8* src);
+                                const u8* src, CachedVertices* cache);
 template int RunVertices<true>(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count,
-                               const u8* src);
+                               const u8* src, CachedVertices* cache);
 
 NativeVertexFormat* GetCurrentVertexFormat()
 {
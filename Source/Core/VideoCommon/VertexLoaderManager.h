@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
@@ -40,9 +41,30 @@ NativeVertexFormat* GetOrCreateMatchingFormat(const PortableVertexDeclaration& d
 // offsets set to the unused attributes.
 NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 
-// Returns -1 if buf_size is insufficient, else the amount of bytes consumed
+// The output of a vertex loader for one primitive command, kept so that display lists which didn't
+// change since they were last drawn can skip vertex loading.
+struct CachedVertices
+{
+  VertexLoaderBase* loader = nullptr;
+  int input_count = 0;
+  int output_count = 0;
+  std::vector<u8> data;
+
+  // Values of the zfreeze and emboss caches below after the vertices were loaded.
+  std::array<std::array<float, 4>, 3> position_cache{};
+  std::array<u32, 3> position_matrix_index_cache{};
+  std::array<float, 4> tangent_cache{};
+  std::array<float, 4> binormal_cache{};
+};
+
+// Returns -1 if buf_size is insufficient, else the amount of bytes consumed.
+// If cache is not null and holds the output of the current loader for count vertices, the vertices
+// are copied from it instead of being loaded from src. Otherwise it is filled with the output, if
+// that only depends on src. The caller is responsible for making sure that src holds the same
+// data as when the cache was filled.
 template <bool IsPreprocess = false>
-int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
+int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src,
+                CachedVertices* cache = nullptr);
 
 namespace detail
 {
@@ -43,8 +43,9 @@ static OpArg MPIC(const void* ptr)
   return MDisp(base_reg, PtrOffset(ptr, memory_base_ptr));
 }
 
-VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att)
-    : VertexLoaderBase(vtx_desc, vtx_att)
+VertexLoaderX64::VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att,
+                                 bool update_caches)
+    : VertexLoaderBase(vtx_desc, vtx_att), m_update_caches(update_caches)
 {
   AllocCodeSpace(4096);
   ClearCodeSpace();
@@ -127,6 +128,9 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
   X64Reg coords = XMM0;
 
   const auto write_zfreeze = [&]() {  // zfreeze
+    if (!m_emit_cache_stores)
+      return;
+
     if (native_format == &m_native_vtx_decl.position)
     {
       CMP(32, R(remaining_reg), Imm8(3));
@@ -410,31 +414,8 @@ void VertexLoaderX64::ReadColor(OpArg data, VertexComponentFormat attribute, Col
     m_src_ofs += load_bytes;
 }
 
-void VertexLoaderX64::GenerateVertexLoader()
+void VertexLoaderX64::GenerateVertex()
 {
-  BitSet32 regs = {src_reg,  dst_reg,       scratch1,    scratch2,
-                   scratch3, remaining_reg, skipped_reg, base_reg};
-  regs &= ABI_ALL_CALLEE_SAVED;
-  regs[RBP] = true;  // Give us a stack frame
-  ABI_PushRegistersAndAdjustStack(regs, 0);
-
-  // Backup count since we're going to count it down.
-  PUSH(32, R(ABI_PARAM3));
-
-  // ABI_PARAM3 is one of the lower registers, so free it for scratch2.
-  // We also have it end at a value of 0, to simplify indexing for zfreeze;
-  // this requires subtracting 1 at the start.
-  LEA(32, remaining_reg, MDisp(ABI_PARAM3, -1));
-
-  MOV(64, R(base_reg), R(ABI_PARAM4));
-
-  if (IsIndexed(m_VtxDesc.low.Position))
-    XOR(32, R(skipped_reg), R(skipped_reg));
-
-  // TODO: load constants into registers outside the main loop
-
-  const u8* loop_start = GetCodePtr();
-
   if (m_VtxDesc.low.PosMatIdx)
   {
     MOVZX(32, 8, scratch1, MDisp(src_reg, m_src_ofs));
@@ -442,11 +423,15 @@ void VertexLoaderX64::GenerateVertexLoader()
     MOV(32, MDisp(dst_reg, m_dst_ofs), R(scratch1));
 
     // zfreeze
-    CMP(32, R(remaining_reg), Imm8(3));
-    FixupBranch dont_store = J_CC(CC_AE);
-    MOV(32, MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
-        R(scratch1));
-    SetJumpTarget(dont_store);
+    if (m_emit_cache_stores)
+    {
+      CMP(32, R(remaining_reg), Imm8(3));
+      FixupBranch dont_store = J_CC(CC_AE);
+      MOV(32,
+          MPIC(VertexLoaderManager::position_matrix_index_cache.data(), remaining_reg, SCALE_4),
+          R(scratch1));
+      SetJumpTarget(dont_store);
+    }
 
     m_native_vtx_decl.posmtx.components = 4;
     m_native_vtx_decl.posmtx.enable = true;
@@ -563,6 +548,77 @@ void VertexLoaderX64::GenerateVertexLoader()
       }
     }
   }
+}
+
+// Loads UNROLL_COUNT vertices per iteration, as long as this doesn't reach the last 3 vertices
+// (which are the ones that affect the zfreeze and emboss caches), and then leaves the remaining
+// vertices to the regular loop. Only used for formats without indexed attributes, as those never
+// skip vertices.
+void VertexLoaderX64::GenerateUnrolledLoop()
+{
+  const u32 vertex_size = m_src_ofs;
+  const u32 native_stride = m_dst_ofs;
+  const PortableVertexDeclaration native_vtx_decl = m_native_vtx_decl;
+
+  CMP(32, R(remaining_reg), Imm8(UNROLL_COUNT + 2));
+  FixupBranch too_few_vertices = J_CC(CC_L, Jump::Near);
+
+  const u8* unrolled_loop_start = GetCodePtr();
+  m_emit_cache_stores = false;
+  for (u32 i = 0; i < UNROLL_COUNT; ++i)
+  {
+    m_src_ofs = vertex_size * i;
+    m_dst_ofs = native_stride * i;
+    GenerateVertex();
+  }
+
+  ADD(64, R(dst_reg), Imm32(native_stride * UNROLL_COUNT));
+  ADD(64, R(src_reg), Imm32(vertex_size * UNROLL_COUNT));
+  SUB(32, R(remaining_reg), Imm8(UNROLL_COUNT));
+  CMP(32, R(remaining_reg), Imm8(UNROLL_COUNT + 2));
+  J_CC(CC_GE, unrolled_loop_start);
+
+  SetJumpTarget(too_few_vertices);
+
+  // The copies generated above only differ from the first one by their offsets.
+  m_src_ofs = vertex_size;
+  m_dst_ofs = native_stride;
+  m_native_vtx_decl = native_vtx_decl;
+}
+
+void VertexLoaderX64::GenerateVertexLoader()
+{
+  BitSet32 regs = {src_reg,  dst_reg,       scratch1,    scratch2,
+                   scratch3, remaining_reg, skipped_reg, base_reg};
+  regs &= ABI_ALL_CALLEE_SAVED;
+  regs[RBP] = true;  // Give us a stack frame
+  ABI_PushRegistersAndAdjustStack(regs, 0);
+
+  // Backup count since we're going to count it down.
+  PUSH(32, R(ABI_PARAM3));
+
+  // ABI_PARAM3 is one of the lower registers, so free it for scratch2.
+  // We also have it end at a value of 0, to simplify indexing for zfreeze;
+  // this requires subtracting 1 at the start.
+  LEA(32, remaining_reg, MDisp(ABI_PARAM3, -1));
+
+  MOV(64, R(base_reg), R(ABI_PARAM4));
+
+  if (IsIndexed(m_VtxDesc.low.Position))
+    XOR(32, R(skipped_reg), R(skipped_reg));
+
+  // TODO: load constants into registers outside the main loop
+
+  // The unrolled loop is generated last, as it needs to know the size of the vertices.
+  const bool unroll = !UsesVertexArrays();
+  FixupBranch unrolled_entry;
+  if (unroll)
+    unrolled_entry = J(Jump::Near);
+
+  const u8* loop_start = GetCodePtr();
+  m_emit_cache_stores = m_update_caches;
+  GenerateVertex();
+  const size_t vertex_code_size = GetCodePtr() - loop_start;
 
   // Prepare for the next vertex.
   ADD(64, R(dst_reg), Imm32(m_dst_ofs));
@@ -591,6 +647,15 @@ void VertexLoaderX64::GenerateVertexLoader()
     RET();
   }
 
+  if (unroll)
+  {
+    SetJumpTarget(unrolled_entry);
+    // Copies after the first one use larger displacements, so leave some slack.
+    if (GetSpaceLeft() >= 2 * vertex_code_size * UNROLL_COUNT + 128)
+      GenerateUnrolledLoop();
+    JMP(loop_start, Jump::Near);
+  }
+
   ASSERT_MSG(VIDEO, m_vertex_size == m_src_ofs,
              "Vertex size from vertex loader ({}) does not match expected vertex size ({})!\nVtx "
              "desc: {:08x} {:08x}\nVtx attr: {:08x} {:08x} {:08x}",
@@ -601,7 +666,6 @@ void VertexLoaderX64::GenerateVertexLoader()
 
 int VertexLoaderX64::RunVertices(const u8* src, u8* dst, int count)
 {
-  m_numLoadedVertices += count;
   return ((int (*)(const u8* src, u8* dst, int count, const void* base))region)(src, dst, count,
                                                                                 memory_base_ptr);
 }
@@ -15,12 +15,19 @@ enum class CPArray : u8;
 class VertexLoaderX64 : public VertexLoaderBase, public Gen::X64CodeBlock
 {
 public:
-  VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att);
+  // If update_caches is false, the zfreeze and emboss caches in VertexLoaderManager are left
+  // untouched, and several threads can run the loader at the same time.
+  VertexLoaderX64(const TVtxDesc& vtx_desc, const VAT& vtx_att, bool update_caches = true);
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
 
 private:
+  static constexpr u32 UNROLL_COUNT = 4;
+
+  const bool m_update_caches;
+  // Whether the code currently being generated stores to the zfreeze and emboss caches.
+  bool m_emit_cache_stores = false;
   u32 m_src_ofs = 0;
   u32 m_dst_ofs = 0;
   Gen::FixupBranch m_skip_vertex;
@@ -29,5 +36,7 @@ private:
                   int count_in, int count_out, bool dequantize, u8 scaling_exponent,
                   AttributeFormat* native_format);
   void ReadColor(Gen::OpArg data, VertexComponentFormat attribute, ColorFormat format);
+  void GenerateVertex();
+  void GenerateUnrolledLoop();
   void GenerateVertexLoader();
 };
@@ -10,6 +10,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/Instrumentation.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/SmallVector.h"
@@ -437,6 +438,8 @@ void VertexManagerBase::Flush()
   if (m_is_flushed)
     return;
 
+  INSTRUMENT_ZONE("VertexManager::Flush");
+
   m_is_flushed = true;
 
   if (m_draw_counter == 0)
@@ -525,16 +528,31 @@ void VertexManagerBase::Flush()
     // This way a small minimap would have less effect than a fullscreen projection.
     const auto& viewport = xfmem.viewport;
 
+    const std::array<float, 4> aspect_inputs{projection[0], projection[2], viewport.wd,
+                                             viewport.ht};
+    if (!m_projection_aspect_valid || aspect_inputs != m_projection_aspect_inputs)
+    {
+      m_projection_viewport_ratio = CalculateProjectionViewportRatio(projection, viewport);
+      if (IsAnamorphicProjection(projection, viewport, g_ActiveConfig))
+        m_projection_aspect = ProjectionAspect::Anamorphic;
+      else if (IsNormalProjection(projection, viewport, g_ActiveConfig))
+        m_projection_aspect = ProjectionAspect::Normal;
+      else
+        m_projection_aspect = ProjectionAspect::Other;
+      m_projection_aspect_inputs = aspect_inputs;
+      m_projection_aspect_valid = true;
+    }
+
     // FYI: This average is based on flushes.
     // It doesn't look at vertex counts like the heuristic does.
-    counts.average_ratio.Push(CalculateProjectionViewportRatio(projection, viewport));
+    counts.average_ratio.Push(m_projection_viewport_ratio);
 
-    if (IsAnamorphicProjection(projection, viewport, g_ActiveConfig))
+    if (m_projection_aspect == ProjectionAspect::Anamorphic)
     {
       ++counts.anamorphic_flush_count;
       counts.anamorphic_vertex_count += m_index_generator.GetIndexLen();
     }
-    else if (IsNormalProjection(projection, viewport, g_ActiveConfig))
+    else if (m_projection_aspect == ProjectionAspect::Normal)
     {
       ++counts.normal_flush_count;
       counts.normal_vertex_count += m_index_generator.GetIndexLen();
@@ -561,11 +579,11 @@ void VertexManagerBase::Flush()
   CalculateBinormals(VertexLoaderManager::GetCurrentVertexFormat());
   // Calculate ZSlope for zfreeze
   const auto used_textures = UsedTextures();
-  std::vector<std::string> texture_names;
+  Common::SmallVector<u64, 8> texture_ids;
   Common::SmallVector<u32, 8> texture_units;
   if (!m_cull_all)
   {
-    if (!g_ActiveConfig.bGraphicMods)
+    if (!g_ActiveConfig.bGraphicMods || !g_graphics_mod_manager->HasTextureActions())
     {
       for (const u32 i : used_textures)
       {
@@ -579,17 +597,17 @@ void VertexManagerBase::Flush()
         const auto cache_entry = g_texture_cache->Load(TextureInfo::FromStage(i));
         if (cache_entry)
         {
-          if (std::find(texture_names.begin(), texture_names.end(),
-                        cache_entry->texture_info_name) == texture_names.end())
+          if (std::find(texture_ids.begin(), texture_ids.end(), cache_entry->texture_info_id) ==
+              texture_ids.end())
           {
-            texture_names.push_back(cache_entry->texture_info_name);
+            texture_ids.push_back(cache_entry->texture_info_id);
             texture_units.push_back(i);
           }
         }
       }
     }
   }
-  vertex_shader_manager.SetConstants(texture_names, xf_state_manager);
+  vertex_shader_manager.SetConstants(texture_ids, xf_state_manager);
   if (!bpmem.genMode.zfreeze)
   {
     // Must be done after VertexShaderManager::SetConstants()
@@ -605,20 +623,18 @@ void VertexManagerBase::Flush()
   {
     CustomPixelShaderContents custom_pixel_shader_contents;
     std::optional<CustomPixelShader> custom_pixel_shader;
-    std::vector<std::string> custom_pixel_texture_names;
     std::span<u8> custom_pixel_shader_uniforms;
     bool skip = false;
-    for (size_t i = 0; i < texture_names.size(); i++)
+    for (size_t i = 0; i < texture_ids.size(); i++)
     {
       GraphicsModActionData::DrawStarted draw_started{texture_units, &skip, &custom_pixel_shader,
                                                       &custom_pixel_shader_uniforms};
-      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_names[i]))
+      for (const auto& action : g_graphics_mod_manager->GetDrawStartedActions(texture_ids[i]))
       {
         action->OnDrawStarted(&draw_started);
         if (custom_pixel_shader)
         {
           custom_pixel_shader_contents.shaders.push_back(*custom_pixel_shader);
-          custom_pixel_texture_names.push_back(texture_names[i]);
         }
         custom_pixel_shader = std::nullopt;
       }
@@ -686,6 +702,9 @@ void VertexManagerBase::DoState(PointerWrap& p)
   {
     // Flush old vertex data before loading state.
     Flush();
+
+    // The loaded register state may need different shaders.
+    InvalidatePipelineObject();
   }
 
   p.Do(m_zslope);
@@ -777,12 +796,14 @@ void VertexManagerBase::CalculateBinormals(NativeVertexFormat* format)
   if (vertex_shader_manager.constants.cached_tangent != VertexLoaderManager::tangent_cache)
   {
     vertex_shader_manager.constants.cached_tangent = VertexLoaderManager::tangent_cache;
-    vertex_shader_manager.dirty = true;
+    vertex_shader_manager.MarkDirty(&vertex_shader_manager.constants.cached_tangent,
+                                    sizeof(vertex_shader_manager.constants.cached_tangent));
   }
   if (vertex_shader_manager.constants.cached_binormal != VertexLoaderManager::binormal_cache)
   {
     vertex_shader_manager.constants.cached_binormal = VertexLoaderManager::binormal_cache;
-    vertex_shader_manager.dirty = true;
+    vertex_shader_manager.MarkDirty(&vertex_shader_manager.constants.cached_binormal,
+                                    sizeof(vertex_shader_manager.constants.cached_binormal));
   }
 }
 
@@ -797,20 +818,31 @@ void VertexManagerBase::UpdatePipelineConfig()
     m_pipeline_config_changed = true;
   }
 
-  VertexShaderUid vs_uid = GetVertexShaderUid();
-  if (vs_uid != m_current_pipeline_config.vs_uid)
+  if (m_vertex_shader_uid_changed)
   {
-    m_current_pipeline_config.vs_uid = vs_uid;
-    m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
-    m_pipeline_config_changed = true;
+    m_vertex_shader_uid_changed = false;
+
+    VertexShaderUid vs_uid = GetVertexShaderUid();
+    if (vs_uid != m_current_pipeline_config.vs_uid)
+    {
+      m_current_pipeline_config.vs_uid = vs_uid;
+      m_current_uber_pipeline_config.vs_uid = UberShader::GetVertexShaderUid();
+      m_pipeline_config_changed = true;
+    }
   }
 
-  PixelShaderUid ps_uid = GetPixelShaderUid();
-  if (ps_uid != m_current_pipeline_config.ps_uid)
+  if (m_pixel_shader_uid_changed)
   {
-    m_current_pipeline_config.ps_uid = ps_uid;
-    m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
-    m_pipeline_config_changed = true;
+    m_pixel_shader_uid_changed = false;
+
+    PixelShaderUid ps_uid = GetPixelShaderUid();
+    if (ps_uid != m_current_pipeline_config.ps_uid)
+    {
+      m_current_pipeline_config.ps_uid = ps_uid;
+      m_current_uber_pipeline_config.ps_uid = UberShader::GetPixelShaderUid();
+      m_current_specialized_uber_ps_uid = UberShader::GetSpecializedPixelShaderUid();
+      m_pipeline_config_changed = true;
+    }
   }
 
   GeometryShaderUid gs_uid = GetGeometryShaderUid(GetCurrentPrimitiveType());
@@ -903,7 +935,20 @@ void VertexManagerBase::UpdatePipelineObject()
 
     if (g_ActiveConfig.iShaderCompilationMode == ShaderCompilationMode::AsynchronousUberShaders)
     {
-      // Specialized shaders not ready, use the ubershaders.
+      // Specialized shaders not ready, use the ubershaders. The ones specialized by the TEV setup
+      // are compiled in the background, like the specialized shaders.
+      if (g_ActiveConfig.bSpecializedUberShaders)
+      {
+        VideoCommon::GXUberPipelineUid uber_uid = m_current_uber_pipeline_config;
+        uber_uid.ps_uid = m_current_specialized_uber_ps_uid;
+        auto uber_res = g_shader_cache->GetUberPipelineForUidAsync(uber_uid);
+        if (uber_res && *uber_res)
+        {
+          m_current_pipeline_object = *uber_res;
+          return;
+        }
+      }
+
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
     }
@@ -992,6 +1037,9 @@ void VertexManagerBase::OnEndFrame()
   m_last_efb_copy_draw_counter = 0;
   m_scheduled_command_buffer_kicks.clear();
 
+  // Pick up changes to the heuristic's settings.
+  m_projection_aspect_valid = false;
+
   // If we have no CPU access at all, leave everything in the one command buffer for maximum
   // parallelism between CPU/GPU, at the cost of slightly higher latency.
   if (m_cpu_accesses_this_frame.empty())
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -129,10 +130,16 @@ public:
   void SetRasterizationStateChanged() { m_rasterization_state_changed = true; }
   void SetDepthStateChanged() { m_depth_state_changed = true; }
   void SetBlendingStateChanged() { m_blending_state_changed = true; }
+  void SetVertexShaderUidChanged() { m_vertex_shader_uid_changed = true; }
+  void SetPixelShaderUidChanged() { m_pixel_shader_uid_changed = true; }
   void InvalidatePipelineObject()
   {
     m_current_pipeline_object = nullptr;
     m_pipeline_config_changed = true;
+
+    // The shader UIDs also depend on the video config, which can change at the same time.
+    m_vertex_shader_uid_changed = true;
+    m_pixel_shader_uid_changed = true;
   }
   void NotifyCustomShaderCacheOfHostChange(const ShaderHostConfig& host_config);
 
@@ -208,12 +215,15 @@ protected:
 
   VideoCommon::GXPipelineUid m_current_pipeline_config;
   VideoCommon::GXUberPipelineUid m_current_uber_pipeline_config;
+  UberShader::PixelShaderUid m_current_specialized_uber_ps_uid;
   const AbstractPipeline* m_current_pipeline_object = nullptr;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
   bool m_pipeline_config_changed = true;
   bool m_rasterization_state_changed = true;
   bool m_depth_state_changed = true;
   bool m_blending_state_changed = true;
+  bool m_vertex_shader_uid_changed = true;
+  bool m_pixel_shader_uid_changed = true;
   bool m_cull_all = false;
 
   IndexGenerator m_index_generator;
@@ -240,6 +250,19 @@ private:
   bool m_is_flushed = true;
   FlushStatistics m_flush_statistics = {};
 
+  // How the widescreen heuristic classified the last projection it saw. This only depends on the
+  // aspect ratios of the projection and the viewport, so it is reused while those stay the same.
+  enum class ProjectionAspect
+  {
+    Anamorphic,
+    Normal,
+    Other,
+  };
+  ProjectionAspect m_projection_aspect = ProjectionAspect::Other;
+  float m_projection_viewport_ratio = 0.0f;
+  std::array<float, 4> m_projection_aspect_inputs{};
+  bool m_projection_aspect_valid = false;
+
   // CPU access tracking
   u32 m_draw_counter = 0;
   u32 m_last_efb_copy_draw_counter = 0;
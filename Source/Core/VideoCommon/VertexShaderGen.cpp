@@ -94,19 +94,19 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
   out.Write("{}", s_shader_uniforms);
   out.Write("}};\n");
 
-  if (uid_data->vs_expand != VSExpand::None)
+  if (uid_data->vs_expand != VSExpand::None || host_config.backend_multiview)
   {
     out.Write("UBO_BINDING(std140, 4) uniform GSBlock {{\n");
     out.Write("{}", s_geometry_shader_uniforms);
     out.Write("}};\n");
+  }
 
-    if (api_type == APIType::D3D)
-    {
-      // D3D doesn't include the base vertex in SV_VertexID
-      out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
-                "  uint base_vertex;\n"
-                "}};\n\n");
-    }
+  if (uid_data->vs_expand != VSExpand::None && api_type == APIType::D3D)
+  {
+    // D3D doesn't include the base vertex in SV_VertexID
+    out.Write("UBO_BINDING(std140, 5) uniform DX_Constants {{\n"
+              "  uint base_vertex;\n"
+              "}};\n\n");
   }
 
   out.Write("struct VS_OUTPUT {{\n");
@@ -577,6 +577,14 @@ ShaderCode GenerateVertexShaderCode(APIType api_type, const ShaderHostConfig& ho
       out.Write("o.colors_1 = float4(0.0, 0.0, 0.0, 0.0);\n");
   }
 
+  if (host_config.backend_multiview)
+  {
+    // Each eye is a separate view, so apply the stereo offset the geometry shader would otherwise.
+    out.Write("float hoffset = (gl_ViewIndex == 0) ? " I_STEREOPARAMS ".x : " I_STEREOPARAMS
+              ".y;\n"
+              "o.pos.x += hoffset * (o.pos.w - " I_STEREOPARAMS ".z);\n");
+  }
+
   // clipPos/w needs to be done in pixel shader, not here
   if (!host_config.fast_depth_calc)
     out.Write("o.clipPos = o.pos;\n");
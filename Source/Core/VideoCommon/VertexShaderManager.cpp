@@ -38,11 +38,18 @@ void VertexShaderManager::Init()
   m_projection_graphics_mod_change = false;
 
   constants = {};
+  m_uploaded_constants = {};
+  m_dirty_range_begin = 0;
+  m_dirty_range_end = 0;
 
   // TODO: should these go inside ResetView()?
   m_viewport_correction = Common::Matrix44::Identity();
   m_projection_matrix = Common::Matrix44::Identity().data;
 
+  m_projection_jitter = {};
+  m_projection_jitter_changed = false;
+  m_scene_camera = {};
+
   dirty = true;
 }
 
@@ -127,13 +134,59 @@ Common::Matrix44 VertexShaderManager::LoadProjectionMatrix()
   return corrected_matrix;
 }
 
+void VertexShaderManager::ApplyProjectionJitter(Common::Matrix44* matrix)
+{
+  if (xfmem.projection.type != ProjectionType::Perspective)
+    return;
+
+  // This ignores the scissor wrap-around handled by ComputeScissorRects, which 3D scenes don't
+  // rely on.
+  m_scene_camera.projection = *matrix;
+  m_scene_camera.viewport = {xfmem.viewport.xOrig - (bpmem.scissorOffset.x << 1),
+                             xfmem.viewport.yOrig - (bpmem.scissorOffset.y << 1),
+                             xfmem.viewport.wd, xfmem.viewport.ht};
+  m_scene_camera.z_range = xfmem.viewport.zRange;
+  m_scene_camera.far_z = xfmem.viewport.farZ;
+  m_scene_camera.valid = true;
+
+  if ((m_projection_jitter[0] == 0.0f && m_projection_jitter[1] == 0.0f) ||
+      xfmem.viewport.wd == 0.0f || xfmem.viewport.ht == 0.0f)
+  {
+    return;
+  }
+
+  // Adding a multiple of w to the clip space position moves the vertex by a constant amount of
+  // pixels after the perspective divide.
+  const float offset_x =
+      m_projection_jitter[0] / g_framebuffer_manager->EFBToScaledXf(xfmem.viewport.wd);
+  const float offset_y =
+      m_projection_jitter[1] / g_framebuffer_manager->EFBToScaledYf(xfmem.viewport.ht);
+  for (int i = 0; i < 4; i++)
+  {
+    matrix->data[i] += offset_x * matrix->data[12 + i];
+    matrix->data[4 + i] += offset_y * matrix->data[12 + i];
+  }
+}
+
+void VertexShaderManager::SetProjectionJitter(float x, float y)
+{
+  if (m_projection_jitter[0] == x && m_projection_jitter[1] == y)
+    return;
+
+  m_projection_jitter = {x, y};
+  m_projection_jitter_changed = true;
+}
+
 void VertexShaderManager::SetProjectionMatrix(XFStateManager& xf_state_manager)
 {
-  if (xf_state_manager.DidProjectionChange() || g_freelook_camera.GetController()->IsDirty())
+  if (xf_state_manager.DidProjectionChange() || g_freelook_camera.GetController()->IsDirty() ||
+      m_projection_jitter_changed)
   {
     xf_state_manager.ResetProjection();
     auto corrected_matrix = LoadProjectionMatrix();
+    ApplyProjectionJitter(&corrected_matrix);
     memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
+    MarkDirty(&constants.projection, sizeof(constants.projection));
   }
 }
 
@@ -158,7 +211,7 @@ bool VertexShaderManager::UseVertexDepthRange()
 
 // Syncs the shader constant buffers with xfmem
 // TODO: A cleaner way to control the matrices without making a mess in the parameters field
-void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
+void VertexShaderManager::SetConstants(std::span<const u64> texture_ids,
                                        XFStateManager& xf_state_manager)
 {
   if (constants.missing_color_hex != g_ActiveConfig.iMissingColorValue)
@@ -170,7 +223,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     constants.missing_color_hex = g_ActiveConfig.iMissingColorValue;
     constants.missing_color_value = {r / 255, g / 255, b / 255, a / 255};
 
-    dirty = true;
+    MarkDirty(&constants.missing_color_hex, sizeof(constants.missing_color_hex));
+    MarkDirty(&constants.missing_color_value, sizeof(constants.missing_color_value));
   }
 
   const auto per_vertex_transform_matrix_changes =
@@ -181,7 +235,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     int endn = (per_vertex_transform_matrix_changes[1] + 3) / 4;
     memcpy(constants.transformmatrices[startn].data(), &xfmem.posMatrices[startn * 4],
            (endn - startn) * sizeof(float4));
-    dirty = true;
+    MarkDirty(&constants.transformmatrices[startn], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPerVertexTransformMatrixChanges();
   }
 
@@ -195,7 +249,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     {
       memcpy(constants.normalmatrices[i].data(), &xfmem.normalMatrices[3 * i], 12);
     }
-    dirty = true;
+    MarkDirty(&constants.normalmatrices[startn], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPerVertexNormalMatrixChanges();
   }
 
@@ -206,7 +260,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     int endn = (post_transform_matrices_changed[1] + 3) / 4;
     memcpy(constants.posttransformmatrices[startn].data(), &xfmem.postMatrices[startn * 4],
            (endn - startn) * sizeof(float4));
-    dirty = true;
+    MarkDirty(&constants.posttransformmatrices[startn], (endn - startn) * sizeof(float4));
     xf_state_manager.ResetPostTransformMatrixChanges();
   }
 
@@ -267,7 +321,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       dstlight.dir[1] = sanitize(static_cast<float>(light.ddir[1] * norm));
       dstlight.dir[2] = sanitize(static_cast<float>(light.ddir[2] * norm));
     }
-    dirty = true;
+    MarkDirty(&constants.lights[istart], (iend - istart) * sizeof(VertexShaderConstants::Light));
 
     xf_state_manager.ResetLightsChanged();
   }
@@ -279,7 +333,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     constants.materials[i][1] = (data >> 16) & 0xFF;
     constants.materials[i][2] = (data >> 8) & 0xFF;
     constants.materials[i][3] = data & 0xFF;
-    dirty = true;
+    MarkDirty(&constants.materials[i], sizeof(constants.materials[i]));
   }
   xf_state_manager.ResetMaterialChanges();
 
@@ -294,7 +348,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     memcpy(constants.posnormalmatrix[3].data(), norm, 3 * sizeof(float));
     memcpy(constants.posnormalmatrix[4].data(), norm + 3, 3 * sizeof(float));
     memcpy(constants.posnormalmatrix[5].data(), norm + 6, 3 * sizeof(float));
-    dirty = true;
+    MarkDirty(&constants.posnormalmatrix, sizeof(constants.posnormalmatrix));
   }
 
   if (xf_state_manager.DidTexMatrixAChange())
@@ -311,7 +365,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     {
       memcpy(constants.texmatrices[3 * i].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
     }
-    dirty = true;
+    MarkDirty(&constants.texmatrices[0], 12 * sizeof(float4));
   }
 
   if (xf_state_manager.DidTexMatrixBChange())
@@ -328,7 +382,7 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     {
       memcpy(constants.texmatrices[3 * i + 12].data(), pos_matrix_ptrs[i], 3 * sizeof(float4));
     }
-    dirty = true;
+    MarkDirty(&constants.texmatrices[12], 12 * sizeof(float4));
   }
 
   if (xf_state_manager.DidViewportChange())
@@ -384,7 +438,12 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       }
     }
 
-    dirty = true;
+    // The jitter is in pixels, so it depends on the viewport size.
+    if (m_projection_jitter[0] != 0.0f || m_projection_jitter[1] != 0.0f)
+      m_projection_jitter_changed = true;
+
+    MarkDirty(&constants.pixelcentercorrection, sizeof(constants.pixelcentercorrection));
+    MarkDirty(&constants.viewport, sizeof(constants.viewport));
     BPFunctions::SetScissorAndViewport();
     g_stats.AddScissorRect();
   }
@@ -397,10 +456,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       projection_actions.push_back(action);
     }
 
-    for (const auto& texture : textures)
+    for (const u64 texture_id : texture_ids)
     {
       for (const auto& action :
-           g_graphics_mod_manager->GetProjectionTextureActions(xfmem.projection.type, texture))
+           g_graphics_mod_manager->GetProjectionTextureActions(xfmem.projection.type, texture_id))
       {
         projection_actions.push_back(action);
       }
@@ -408,10 +467,12 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
   }
 
   if (xf_state_manager.DidProjectionChange() || g_freelook_camera.GetController()->IsDirty() ||
-      !projection_actions.empty() || m_projection_graphics_mod_change)
+      !projection_actions.empty() || m_projection_graphics_mod_change ||
+      m_projection_jitter_changed)
   {
     xf_state_manager.ResetProjection();
     m_projection_graphics_mod_change = !projection_actions.empty();
+    m_projection_jitter_changed = false;
 
     auto corrected_matrix = LoadProjectionMatrix();
 
@@ -420,9 +481,10 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     {
       action->OnProjection(&projection);
     }
+    ApplyProjectionJitter(&corrected_matrix);
 
     memcpy(constants.projection.data(), corrected_matrix.data.data(), 4 * sizeof(float4));
-    dirty = true;
+    MarkDirty(&constants.projection, sizeof(constants.projection));
   }
 
   if (xf_state_manager.DidTexMatrixInfoChange())
@@ -434,7 +496,8 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
     for (size_t i = 0; i < std::size(xfmem.postMtxInfo); i++)
       constants.xfmem_pack1[i][1] = xfmem.postMtxInfo[i].hex;
 
-    dirty = true;
+    MarkDirty(&constants.xfmem_dualTexInfo, sizeof(constants.xfmem_dualTexInfo));
+    MarkDirty(&constants.xfmem_pack1, sizeof(constants.xfmem_pack1));
   }
 
   if (xf_state_manager.DidLightingConfigChange())
@@ -447,8 +510,41 @@ void VertexShaderManager::SetConstants(const std::vector<std::string>& textures,
       constants.xfmem_pack1[i][3] = xfmem.alpha[i].hex;
     }
     constants.xfmem_numColorChans = xfmem.numChan.numColorChans;
-    dirty = true;
+    MarkDirty(&constants.xfmem_numColorChans, sizeof(constants.xfmem_numColorChans));
+    MarkDirty(&constants.xfmem_pack1[0], 2 * sizeof(constants.xfmem_pack1[0]));
+  }
+
+  ResolveDirtyRange();
+}
+
+void VertexShaderManager::ResolveDirtyRange()
+{
+  if (dirty)
+  {
+    // Something that isn't tracked by range, e.g. the backend losing its bindings or a savestate
+    // load, requires the whole block to be uploaded anyway.
+    m_uploaded_constants = constants;
+  }
+  else if (m_dirty_range_begin != m_dirty_range_end)
+  {
+    // Games often load the same matrices again for every draw. Only upload if a byte that may
+    // have changed actually differs from what the GPU already has.
+    u8* const uploaded = reinterpret_cast<u8*>(&m_uploaded_constants) + m_dirty_range_begin;
+    const u8* const current = reinterpret_cast<const u8*>(&constants) + m_dirty_range_begin;
+    const size_t size = m_dirty_range_end - m_dirty_range_begin;
+    if (std::memcmp(uploaded, current, size) != 0)
+    {
+      std::memcpy(uploaded, current, size);
+      dirty = true;
+    }
+    else
+    {
+      ADDSTAT(g_stats.this_frame.bytes_uniform_skipped, sizeof(VertexShaderConstants));
+    }
   }
+
+  m_dirty_range_begin = 0;
+  m_dirty_range_end = 0;
 }
 
 void VertexShaderManager::TransformToClipSpace(const float* data, float* out, u32 MtxIdx)
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -21,12 +23,25 @@ class XFStateManager;
 class alignas(16) VertexShaderManager
 {
 public:
+  // The last perspective projection that was loaded, without any jitter. Temporal upscaling
+  // reprojects the previous frame with it.
+  struct SceneCamera
+  {
+    Common::Matrix44 projection;
+    // Centre of the viewport relative to the scissor offset, and its half size, in native EFB
+    // pixels.
+    std::array<float, 4> viewport;
+    float z_range;
+    float far_z;
+    bool valid = false;
+  };
+
   void Init();
   void DoState(PointerWrap& p);
 
   // constant management
   void SetProjectionMatrix(XFStateManager& xf_state_manager);
-  void SetConstants(const std::vector<std::string>& textures, XFStateManager& xf_state_manager);
+  void SetConstants(std::span<const u64> texture_ids, XFStateManager& xf_state_manager);
 
   // data: 3 floats representing the X, Y and Z vertex model coordinates and the posmatrix index.
   // out:  4 floats which will be initialized with the corresponding clip space coordinates
@@ -36,49 +51,81 @@ public:
 
   static bool UseVertexDepthRange();
 
+  // Offsets perspective draws by a sub-pixel amount, in pixels of the EFB at its current scale.
+  void SetProjectionJitter(float x, float y);
+  const SceneCamera& GetSceneCamera() const { return m_scene_camera; }
+
   VertexShaderConstants constants{};
+  // Whether the constants have to be uploaded again. Setting this forces an upload of the whole
+  // block. Changes to the constants are recorded with MarkDirty instead, and only set this once
+  // SetConstants finds that they differ from what was last uploaded.
   bool dirty = false;
 
-  static DOLPHIN_FORCE_INLINE void UpdateValue(bool* dirty, u32* old_value, u32 new_value)
+  // Records that size bytes of constants starting at field may have been changed.
+  DOLPHIN_FORCE_INLINE void MarkDirty(const void* field, size_t size)
+  {
+    const u32 begin = static_cast<u32>(static_cast<const u8*>(field) -
+                                       reinterpret_cast<const u8*>(&constants));
+    const u32 end = begin + static_cast<u32>(size);
+    if (m_dirty_range_begin == m_dirty_range_end)
+    {
+      m_dirty_range_begin = begin;
+      m_dirty_range_end = end;
+    }
+    else
+    {
+      m_dirty_range_begin = std::min(m_dirty_range_begin, begin);
+      m_dirty_range_end = std::max(m_dirty_range_end, end);
+    }
+  }
+
+  DOLPHIN_FORCE_INLINE void UpdateValue(u32* old_value, u32 new_value)
   {
     if (*old_value == new_value)
       return;
     *old_value = new_value;
-    *dirty = true;
+    MarkDirty(old_value, sizeof(u32));
   }
 
-  static DOLPHIN_FORCE_INLINE void UpdateOffset(bool* dirty, bool include_components,
-                                                u32* old_value, const AttributeFormat& attribute)
+  DOLPHIN_FORCE_INLINE void UpdateOffset(bool include_components, u32* old_value,
+                                         const AttributeFormat& attribute)
   {
     if (!attribute.enable)
       return;
     u32 new_value = attribute.offset / 4;  // GPU uses uint offsets
     if (include_components)
       new_value |= attribute.components << 16;
-    UpdateValue(dirty, old_value, new_value);
+    UpdateValue(old_value, new_value);
   }
 
   template <size_t N>
-  static DOLPHIN_FORCE_INLINE void UpdateOffsets(bool* dirty, bool include_components,
-                                                 std::array<u32, N>* old_value,
-                                                 const std::array<AttributeFormat, N>& attribute)
+  DOLPHIN_FORCE_INLINE void UpdateOffsets(bool include_components, std::array<u32, N>* old_value,
+                                          const std::array<AttributeFormat, N>& attribute)
   {
     for (size_t i = 0; i < N; i++)
-      UpdateOffset(dirty, include_components, &(*old_value)[i], attribute[i]);
+      UpdateOffset(include_components, &(*old_value)[i], attribute[i]);
   }
 
   DOLPHIN_FORCE_INLINE void SetVertexFormat(u32 components, const PortableVertexDeclaration& format)
   {
-    UpdateValue(&dirty, &constants.components, components);
-    UpdateValue(&dirty, &constants.vertex_stride, format.stride / 4);
-    UpdateOffset(&dirty, true, &constants.vertex_offset_position, format.position);
-    UpdateOffset(&dirty, false, &constants.vertex_offset_posmtx, format.posmtx);
-    UpdateOffsets(&dirty, true, &constants.vertex_offset_texcoords, format.texcoords);
-    UpdateOffsets(&dirty, false, &constants.vertex_offset_colors, format.colors);
-    UpdateOffsets(&dirty, false, &constants.vertex_offset_normals, format.normals);
+    UpdateValue(&constants.components, components);
+    UpdateValue(&constants.vertex_stride, format.stride / 4);
+    UpdateOffset(true, &constants.vertex_offset_position, format.position);
+    UpdateOffset(false, &constants.vertex_offset_posmtx, format.posmtx);
+    UpdateOffsets(true, &constants.vertex_offset_texcoords, format.texcoords);
+    UpdateOffsets(false, &constants.vertex_offset_colors, format.colors);
+    UpdateOffsets(false, &constants.vertex_offset_normals, format.normals);
   }
 
 private:
+  void ResolveDirtyRange();
+
+  // A copy of the constants as the backend last uploaded them, which lets recorded changes that
+  // restore the previous values skip the upload.
+  VertexShaderConstants m_uploaded_constants{};
+  u32 m_dirty_range_begin = 0;
+  u32 m_dirty_range_end = 0;
+
   alignas(16) std::array<float, 16> m_projection_matrix;
 
   // track changes
@@ -86,5 +133,11 @@ private:
 
   Common::Matrix44 m_viewport_correction{};
 
+  std::array<float, 2> m_projection_jitter{};
+  bool m_projection_jitter_changed = false;
+  SceneCamera m_scene_camera;
+
   Common::Matrix44 LoadProjectionMatrix();
+  // Called once everything else has modified the projection matrix.
+  void ApplyProjectionJitter(Common::Matrix44* matrix);
 };
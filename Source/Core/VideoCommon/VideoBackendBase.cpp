@@ -49,14 +49,17 @@
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/FrameDumper.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUTiming.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModManager.h"
 #include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/MetricsServer.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Spirv.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -158,6 +161,11 @@ u32 VideoBackendBase::Video_GetQueryResult(PerfQueryType type)
     return 0;
   }
 
+  // The approximated results are only ever updated by the GPU thread, so there is nothing to wait
+  // for.
+  if (g_ActiveConfig.bPerfQueriesApproximate && g_perf_query->SupportsApproximateResults())
+    return g_perf_query->GetQueryResult(type);
+
   auto& system = Core::System::GetInstance();
   system.GetFifo().SyncGPU(Fifo::SyncGPUReason::PerfQuery);
 
@@ -394,11 +402,15 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
 
   g_shader_cache->InitializeShaderCache();
 
+  g_metrics_server.Start(Config::Get(Config::MAIN_METRICS_PORT));
+
   return true;
 }
 
 void VideoBackendBase::ShutdownShared()
 {
+  g_metrics_server.Stop();
+
   g_frame_dumper.reset();
   g_presenter.reset();
 
@@ -409,10 +421,12 @@ void VideoBackendBase::ShutdownShared()
 
   g_bounding_box.reset();
   g_perf_query.reset();
+  g_gpu_timing.reset();
   g_graphics_mod_manager.reset();
   g_texture_cache.reset();
   g_framebuffer_manager.reset();
   g_shader_cache.reset();
+  SPIRV::CloseCompileCache();
   g_vertex_manager.reset();
   g_renderer.reset();
   g_widescreen.reset();
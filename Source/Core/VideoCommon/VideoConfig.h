@@ -19,6 +19,9 @@
 
 constexpr int EFB_SCALE_AUTO_INTEGRAL = 0;
 
+// Coarse shading is only used once there are this many pixels per native pixel in each direction.
+constexpr unsigned int COARSE_SHADING_MIN_EFB_SCALE = 3;
+
 enum class AspectMode : int
 {
   Auto,           // ~4:3 or ~16:9 (auto detected)
@@ -141,6 +144,8 @@ struct VideoConfig final
   bool bArbitraryMipmapDetection = false;
   float fArbitraryMipmapDetectionThreshold = 0;
   bool bHDR = false;
+  bool bCoarseShading = false;
+  bool bTemporalUpscaling = false;
 
   // Color Correction
   struct
@@ -170,6 +175,8 @@ struct VideoConfig final
   bool bShowGraphs = false;
   bool bShowSpeed = false;
   bool bShowSpeedColors = false;
+  bool bShowGPUTimes = false;
+  bool bShowStutters = false;
   int iPerfSampleUSec = 0;
   bool bShowNetPlayPing = false;
   bool bShowNetPlayMessages = false;
@@ -190,6 +197,7 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bPredictHiresTextures = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
@@ -202,7 +210,7 @@ struct VideoConfig final
   FrameDumpResolutionType frame_dumps_resolution_type =
       FrameDumpResolutionType::XFBAspectRatioCorrectedResolution;
   bool bBorderlessFullscreen = false;
-  bool bEnableGPUTextureDecoding = false;
+  bool bEnableGPUTextureDecoding = true;
   bool bPreferVSForLinePointExpansion = false;
   int iBitrateKbps = 0;
   bool bGraphicMods = false;
@@ -212,9 +220,24 @@ struct VideoConfig final
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
   bool bPerfQueriesEnable = false;
+  // Return the perf query results of the last completed frame instead of waiting for the GPU.
+  bool bPerfQueriesApproximate = false;
   bool bBBoxEnable = false;
+  // Return the bounding box values read back during the previous frame instead of stalling.
+  bool bBBoxDeferredReadback = false;
   bool bForceProgressive = false;
   bool bCPUCull = false;
+  bool bDisplayListCache = false;
+  // Number of worker threads which help loading large batches of vertices, 0 to disable.
+  int iVertexLoaderThreads = 0;
+  // Number of worker threads which help decoding large textures on the CPU, 0 to disable.
+  int iTextureDecodingThreads = 0;
+  // Maximum size of the unused textures kept around for reuse, in MiB, 0 for no limit.
+  int iTexturePoolBudgetMB = 0;
+  // Number of worker threads which help the software renderer draw large triangles, 0 to disable.
+  int iSWRasterizerThreads = 0;
+  // Number of worker threads which record draws into D3D11 deferred contexts, 0 to disable.
+  int iD3D11RecordingThreads = 0;
 
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
@@ -224,6 +247,8 @@ struct VideoConfig final
   bool bImmediateXFB = false;
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
+  bool bEFBCopyChains = false;
+  bool bNativeResSmallEFBCopies = false;
   int iSafeTextureCache_ColorSamples = 0;
   float fAspectRatioHackW = 1;  // Initial value needed for the first frame
   float fAspectRatioHackH = 1;
@@ -235,6 +260,7 @@ struct VideoConfig final
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  bool bTextureWriteWatch = false;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -268,6 +294,9 @@ struct VideoConfig final
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
   ShaderCompilationMode iShaderCompilationMode{};
+  // In hybrid ubershader mode, try ubershaders specialized for the current TEV stage count and
+  // features before falling back to the generic ones.
+  bool bSpecializedUberShaders = false;
 
   // Number of shader compiler threads.
   // 0 disables background compilation.
@@ -337,6 +366,7 @@ struct VideoConfig final
     bool bSupportsVSLinePointExpand = false;
     bool bSupportsGLLayerInFS = true;
     bool bSupportsHDROutput = false;
+    bool bSupportsMultiview = false;
   } backend_info;
 
   // Utility
@@ -348,6 +378,12 @@ struct VideoConfig final
       return true;
     return bPreferVSForLinePointExpansion;
   }
+  // With multiview, every draw to the EFB renders both eyes, and the vertex shader offsets each
+  // view, so stereoscopy doesn't need a geometry shader selecting the layer.
+  bool UseMultiviewStereo() const
+  {
+    return stereo_mode != StereoMode::Off && backend_info.bSupportsMultiview;
+  }
   bool MultisamplingEnabled() const { return iMultisamples > 1; }
   bool ExclusiveFullscreenEnabled() const
   {
@@ -355,7 +391,10 @@ struct VideoConfig final
   }
   bool UseGPUTextureDecoding() const
   {
-    return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
+    // Arbitrary mipmap detection and the format overlay both work on the decoded texels, which
+    // only exist in host memory when decoding on the CPU.
+    return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding &&
+           !bArbitraryMipmapDetection && !bTexFmtOverlayEnable;
   }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
   bool ManualTextureSamplingWithCustomTextureSizes() const
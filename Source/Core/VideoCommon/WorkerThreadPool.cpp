@@ -0,0 +1,91 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/WorkerThreadPool.h"
+
+#include <utility>
+
+#include "Common/Thread.h"
+
+WorkerThreadPool::WorkerThreadPool(std::string thread_name) : m_thread_name(std::move(thread_name))
+{
+}
+
+WorkerThreadPool::~WorkerThreadPool()
+{
+  Stop();
+}
+
+void WorkerThreadPool::Start(u32 num_threads)
+{
+  Stop();
+
+  m_shutdown = false;
+  for (u32 i = 0; i < num_threads; ++i)
+    m_threads.emplace_back(&WorkerThreadPool::WorkerLoop, this, m_generation);
+}
+
+void WorkerThreadPool::Stop()
+{
+  if (m_threads.empty())
+    return;
+
+  {
+    std::lock_guard lk(m_mutex);
+    m_shutdown = true;
+  }
+  m_work_available.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+  m_threads.clear();
+}
+
+void WorkerThreadPool::Run(size_t num_tasks, const std::function<void(size_t)>& task)
+{
+  {
+    std::lock_guard lk(m_mutex);
+    m_task = &task;
+    m_num_tasks = num_tasks;
+    m_next_task.store(0, std::memory_order_relaxed);
+    m_busy_workers = m_threads.size();
+    ++m_generation;
+  }
+  m_work_available.notify_all();
+
+  RunTasks();
+
+  std::unique_lock lk(m_mutex);
+  m_work_done.wait(lk, [this] { return m_busy_workers == 0; });
+  m_task = nullptr;
+}
+
+void WorkerThreadPool::RunTasks()
+{
+  size_t index;
+  while ((index = m_next_task.fetch_add(1, std::memory_order_relaxed)) < m_num_tasks)
+    (*m_task)(index);
+}
+
+// seen_generation is passed in rather than read here, so that work submitted before the thread got
+// to run isn't missed.
+void WorkerThreadPool::WorkerLoop(u64 seen_generation)
+{
+  Common::SetCurrentThreadName(m_thread_name.c_str());
+
+  std::unique_lock lk(m_mutex);
+  while (true)
+  {
+    m_work_available.wait(lk, [&] { return m_shutdown || m_generation != seen_generation; });
+    if (m_shutdown)
+      return;
+    seen_generation = m_generation;
+
+    lk.unlock();
+    RunTasks();
+    lk.lock();
+
+    if (--m_busy_workers == 0)
+      m_work_done.notify_one();
+  }
+}
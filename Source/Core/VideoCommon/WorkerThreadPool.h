@@ -0,0 +1,55 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Worker threads which help the GPU thread with work that splits into independent tasks, like
+// loading large batches of vertices. The calling thread takes part in the work, so Run returns as
+// soon as all tasks are done.
+class WorkerThreadPool
+{
+public:
+  explicit WorkerThreadPool(std::string thread_name);
+  WorkerThreadPool(const WorkerThreadPool&) = delete;
+  WorkerThreadPool& operator=(const WorkerThreadPool&) = delete;
+  ~WorkerThreadPool();
+
+  // Stops any running worker threads and starts num_threads new ones.
+  void Start(u32 num_threads);
+  void Stop();
+
+  u32 GetNumThreads() const { return static_cast<u32>(m_threads.size()); }
+
+  // Calls task once for every index in [0, num_tasks), spread over the workers and the calling
+  // thread, and waits for all of them to finish. Must only be called from one thread at a time.
+  void Run(size_t num_tasks, const std::function<void(size_t)>& task);
+
+private:
+  void WorkerLoop(u64 seen_generation);
+  void RunTasks();
+
+  std::string m_thread_name;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_available;
+  std::condition_variable m_work_done;
+  u64 m_generation = 0;
+  size_t m_busy_workers = 0;
+  bool m_shutdown = false;
+
+  const std::function<void(size_t)>* m_task = nullptr;
+  size_t m_num_tasks = 0;
+  std::atomic<size_t> m_next_task = 0;
+};
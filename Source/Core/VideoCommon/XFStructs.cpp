@@ -62,7 +62,11 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
 
     case XFMEM_SETNUMCHAN:
       if (xfmem.numChan.numColorChans != (value & 3))
+      {
         g_vertex_manager->Flush();
+        g_vertex_manager->SetVertexShaderUidChanged();
+        g_vertex_manager->SetPixelShaderUidChanged();
+      }
       xf_state_manager.SetLightingConfigChanged();
       break;
 
@@ -95,13 +99,20 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETCHAN0_ALPHA:  // Channel Alpha
     case XFMEM_SETCHAN1_ALPHA:
       if (((u32*)&xfmem)[address] != (value & 0x7fff))
+      {
         g_vertex_manager->Flush();
+        g_vertex_manager->SetVertexShaderUidChanged();
+        g_vertex_manager->SetPixelShaderUidChanged();
+      }
       xf_state_manager.SetLightingConfigChanged();
       break;
 
     case XFMEM_DUALTEX:
       if (xfmem.dualTexTrans.enabled != bool(value & 1))
+      {
         g_vertex_manager->Flush();
+        g_vertex_manager->SetVertexShaderUidChanged();
+      }
       xf_state_manager.SetTexMatrixInfoChanged(-1);
       break;
 
@@ -140,7 +151,10 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
 
     case XFMEM_SETNUMTEXGENS:  // GXSetNumTexGens
       if (xfmem.numTexGen.numTexGens != (value & 15))
+      {
         g_vertex_manager->Flush();
+        g_vertex_manager->SetVertexShaderUidChanged();
+      }
       break;
 
     case XFMEM_SETTEXMTXINFO:
@@ -152,6 +166,8 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
       g_vertex_manager->Flush();
+      g_vertex_manager->SetVertexShaderUidChanged();
+      g_vertex_manager->SetPixelShaderUidChanged();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
       break;
 
@@ -164,6 +180,7 @@ static void XFRegWritten(Core::System& system, XFStateManager& xf_state_manager,
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
       g_vertex_manager->Flush();
+      g_vertex_manager->SetVertexShaderUidChanged();
       xf_state_manager.SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
       break;
 
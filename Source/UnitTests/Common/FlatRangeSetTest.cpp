@@ -0,0 +1,72 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FlatRangeSet.h"
+
+using Range = Common::FlatRangeSet<u32>::Range;
+
+static std::vector<Range> ToVector(const Common::FlatRangeSet<u32>& set)
+{
+  return std::vector<Range>(set.begin(), set.end());
+}
+
+TEST(FlatRangeSet, AscendingInsertsExtendLastRange)
+{
+  Common::FlatRangeSet<u32> set;
+  for (u32 address = 0x100; address < 0x140; address += 4)
+    set.Insert(address, address + 4);
+  set.Insert(0x200, 0x204);
+
+  EXPECT_EQ(ToVector(set), (std::vector<Range>{{0x100, 0x140}, {0x200, 0x204}}));
+}
+
+TEST(FlatRangeSet, InsertMergesOverlappingAndAdjacentRanges)
+{
+  Common::FlatRangeSet<u32> set;
+  set.Insert(40, 50);
+  set.Insert(10, 20);
+  set.Insert(30, 35);
+  EXPECT_EQ(set.NumRanges(), 3u);
+
+  set.Insert(0, 5);
+  EXPECT_EQ(ToVector(set), (std::vector<Range>{{0, 5}, {10, 20}, {30, 35}, {40, 50}}));
+
+  set.Insert(20, 32);
+  EXPECT_EQ(ToVector(set), (std::vector<Range>{{0, 5}, {10, 35}, {40, 50}}));
+
+  set.Insert(3, 60);
+  EXPECT_EQ(ToVector(set), (std::vector<Range>{{0, 60}}));
+
+  set.Insert(70, 70);
+  EXPECT_EQ(set.NumRanges(), 1u);
+}
+
+TEST(FlatRangeSet, Queries)
+{
+  Common::FlatRangeSet<u32> set;
+  set.Insert(10, 20);
+  set.Insert(30, 40);
+
+  EXPECT_FALSE(set.Contains(9));
+  EXPECT_TRUE(set.Contains(10));
+  EXPECT_TRUE(set.Contains(19));
+  EXPECT_FALSE(set.Contains(20));
+  EXPECT_TRUE(set.Contains(30));
+
+  EXPECT_FALSE(set.Overlaps(0, 10));
+  EXPECT_TRUE(set.Overlaps(0, 11));
+  EXPECT_TRUE(set.Overlaps(19, 30));
+  EXPECT_FALSE(set.Overlaps(20, 30));
+  EXPECT_TRUE(set.Overlaps(0, 100));
+  EXPECT_FALSE(set.Overlaps(40, 100));
+  EXPECT_FALSE(set.Overlaps(15, 15));
+
+  set.Clear();
+  EXPECT_TRUE(set.Empty());
+  EXPECT_FALSE(set.Overlaps(0, 100));
+}
@@ -327,6 +327,45 @@ TEST(CoreTiming, ScheduleIntoPast)
   AdvanceAndCheck(system, 0, MAX_SLICE_LENGTH, 1000);
 }
 
+TEST(CoreTiming, RemoveEvent)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  auto& core_timing = system.GetCoreTiming();
+  auto& ppc_state = system.GetPPCState();
+
+  CoreTiming::EventType* cb_a = core_timing.RegisterEvent("callbackA", CallbackTemplate<0>);
+  CoreTiming::EventType* cb_b = core_timing.RegisterEvent("callbackB", CallbackTemplate<1>);
+  CoreTiming::EventType* cb_c = core_timing.RegisterEvent("callbackC", CallbackTemplate<2>);
+
+  // Enter slice 0
+  core_timing.Advance();
+
+  core_timing.ScheduleEvent(100, cb_a, CB_IDS[0]);
+  core_timing.ScheduleEvent(200, cb_b, CB_IDS[1]);
+  core_timing.ScheduleEvent(300, cb_c, CB_IDS[2]);
+  EXPECT_EQ(100, ppc_state.downcount);
+
+  // Removing the next event doesn't shorten the slice, but nothing runs when it ends.
+  core_timing.RemoveEvent(cb_a);
+  s_callbacks_ran_flags = 0;
+  ppc_state.downcount = 0;
+  core_timing.Advance();
+  EXPECT_EQ(0u, s_callbacks_ran_flags.count());
+  EXPECT_EQ(100, ppc_state.downcount);
+
+  // An event scheduled again after being removed still runs, at its new time.
+  core_timing.RemoveEvent(cb_c);
+  core_timing.ScheduleEvent(50, cb_c, CB_IDS[2]);
+  EXPECT_EQ(50, ppc_state.downcount);
+
+  AdvanceAndCheck(system, 2, 50);                // cb_c
+  AdvanceAndCheck(system, 1, MAX_SLICE_LENGTH);  // cb_b
+}
+
 TEST(CoreTiming, Overclocking)
 {
   auto& system = Core::System::GetInstance();
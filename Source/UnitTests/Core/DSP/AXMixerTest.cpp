@@ -0,0 +1,90 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixer.h"
+
+namespace
+{
+constexpr u32 MAX_COUNT = 96;
+
+// The mixing loop as it was written before it got vectorized.
+void ReferenceMixAdd(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                     s16* dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= *volume;
+    sample >>= 15;
+    sample = std::clamp((s32)sample, -32767, 32767);
+
+    out[i] += (s16)sample;
+    *volume += volume_delta;
+
+    *dpop = (s16)sample;
+  }
+}
+
+void CheckMatchesReference(const std::array<s16, MAX_COUNT>& input, u32 count, u16 volume,
+                           u16 volume_delta)
+{
+  std::array<int, MAX_COUNT> expected_out;
+  for (u32 i = 0; i < MAX_COUNT; ++i)
+    expected_out[i] = static_cast<int>(i * 1000) - 40000;
+  std::array<int, MAX_COUNT> actual_out = expected_out;
+
+  u16 expected_volume = volume;
+  u16 actual_volume = volume;
+  s16 expected_dpop = 0x1234;
+  s16 actual_dpop = 0x1234;
+
+  ReferenceMixAdd(expected_out.data(), input.data(), count, &expected_volume, volume_delta,
+                  &expected_dpop);
+  DSP::HLE::MixAddVoiceSamples(actual_out.data(), input.data(), count, &actual_volume,
+                               volume_delta, &actual_dpop);
+
+  EXPECT_EQ(expected_out, actual_out);
+  EXPECT_EQ(expected_volume, actual_volume);
+  EXPECT_EQ(expected_dpop, actual_dpop);
+}
+}  // namespace
+
+TEST(AXMixer, ExtremeValues)
+{
+  std::array<s16, MAX_COUNT> input;
+  for (u32 i = 0; i < MAX_COUNT; ++i)
+    input[i] = (i & 1) ? -32768 : 32767;
+
+  for (u16 volume : {0x0000, 0x0001, 0x7fff, 0x8000, 0x8001, 0xffff})
+  {
+    for (u32 count : {0u, 1u, 7u, 8u, 9u, 32u, 95u, 96u})
+    {
+      CheckMatchesReference(input, count, volume, 0);
+      CheckMatchesReference(input, count, volume, 1);
+      CheckMatchesReference(input, count, volume, 0xffff);
+    }
+  }
+}
+
+TEST(AXMixer, RandomValues)
+{
+  std::mt19937 rng(0);
+  std::array<s16, MAX_COUNT> input;
+  for (int iteration = 0; iteration < 10000; ++iteration)
+  {
+    for (s16& sample : input)
+      sample = static_cast<s16>(rng());
+
+    const u32 count = rng() % (MAX_COUNT + 1);
+    const u16 volume = static_cast<u16>(rng());
+    const u16 volume_delta = (iteration & 1) ? static_cast<u16>(rng()) : 0;
+    CheckMatchesReference(input, count, volume, volume_delta);
+  }
+}
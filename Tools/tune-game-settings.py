@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Finds the fastest combination of performance-related game INI settings for a game.
+
+The game is run with dolphin-nogui's --bench_frames mode, playing back a movie (ideally one that
+starts from a savestate) so that every run emulates the same thing. Starting from the current
+settings, each candidate setting is tried in turn and kept if it makes the run faster by at least
+--min-gain. The result is printed, and with --write added to the game's user INI.
+
+Only speed is measured. Some of these settings can break games, so check that the game still
+behaves correctly with the result before relying on it.
+"""
+
+import argparse
+import json
+import statistics
+import subprocess
+import sys
+from pathlib import Path
+
+# (game INI section, -C option, values). The first value is the default, which isn't tried.
+CANDIDATES = [
+    ("Core", "Dolphin.Core.SyncOnSkipIdle", ["True", "False"]),
+    ("Core", "Dolphin.Core.Fastmem", ["True", "False"]),
+    ("Video_Hacks", "GFX.Hacks.EFBAccessEnable", ["True", "False"]),
+    ("Video_Hacks", "GFX.Hacks.VertexRounding", ["False", "True"]),
+    ("Video_Settings", "GFX.Settings.EnableGPUTextureDecoding", ["True", "False"]),
+    ("Video_Settings", "GFX.Settings.ShaderCompilationMode", ["0", "1", "2", "3"]),
+]
+
+
+def run_benchmark(args, settings):
+    command = [args.dolphin, "--platform=headless", f"--video_backend={args.video_backend}",
+               f"--movie={args.movie}", f"--bench_frames={args.frames}"]
+    if args.user:
+        command.append(f"--user={args.user}")
+    for option, value in settings.items():
+        command.append(f"--config={option}={value}")
+    command += ["--exec", args.game]
+
+    times = []
+    for _ in range(args.runs):
+        result = subprocess.run(command, capture_output=True, text=True)
+        lines = [line for line in result.stdout.splitlines() if line.startswith("{")]
+        if result.returncode != 0 or not lines:
+            print(f"Benchmark failed with {settings}:\n{result.stderr}", file=sys.stderr)
+            return None
+        times.append(json.loads(lines[-1])["host_ms"])
+    return statistics.median(times)
+
+
+def write_game_ini(path, settings):
+    lines = path.read_text().splitlines() if path.exists() else []
+
+    for option, value in settings.items():
+        section = next(section for section, name, _ in CANDIDATES if name == option)
+        key = option.rsplit(".", 1)[1]
+        header = f"[{section}]"
+        if header not in lines:
+            lines += ["", header]
+
+        # Replace the key if the section already sets it, otherwise add it at the end of the section
+        index = lines.index(header) + 1
+        while index < len(lines) and not lines[index].startswith("["):
+            if lines[index].split("=", 1)[0].strip() == key:
+                del lines[index]
+                break
+            index += 1
+        while index > 0 and not lines[index - 1].strip():
+            index -= 1
+        lines.insert(index, f"{key} = {value}")
+
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text("\n".join(lines).lstrip("\n") + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dolphin", help="path to dolphin-nogui")
+    parser.add_argument("game", help="path to the game")
+    parser.add_argument("movie", help="movie (.dtm) to play back")
+    parser.add_argument("--game-id", help="game ID, needed for --write")
+    parser.add_argument("--user", help="Dolphin user folder to use")
+    parser.add_argument("--video-backend", default="Vulkan")
+    parser.add_argument("--frames", type=int, default=600)
+    parser.add_argument("--runs", type=int, default=3, help="runs per configuration")
+    parser.add_argument("--min-gain", type=float, default=0.02,
+                        help="minimum relative speedup for keeping a setting")
+    parser.add_argument("--write", action="store_true",
+                        help="add the result to the game's INI in the user folder")
+    args = parser.parse_args()
+
+    if args.write and not (args.game_id and args.user):
+        parser.error("--write requires --game-id and --user")
+
+    best = {}
+    best_time = run_benchmark(args, best)
+    if best_time is None:
+        return 1
+    print(f"Baseline: {best_time:.1f} ms")
+
+    for _, option, values in CANDIDATES:
+        for value in values[1:]:
+            settings = dict(best, **{option: value})
+            time = run_benchmark(args, settings)
+            if time is None:
+                continue
+            print(f"{option}={value}: {time:.1f} ms")
+            if time < best_time * (1.0 - args.min_gain):
+                best, best_time = settings, time
+
+    print(f"Fastest: {best_time:.1f} ms with {best if best else 'the current settings'}")
+
+    if args.write and best:
+        path = Path(args.user) / "GameSettings" / f"{args.game_id}.ini"
+        write_game_ini(path, best)
+        print(f"Wrote {path}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())